@@ -0,0 +1,105 @@
+/* Purpose: Pack the launcher's fonts and images into the assets.pak shipped next to the executable.
+ * Usage: AssetPacker <output_pack> <output_header> <asset_dir> <asset>...
+ * Assets are named by their path relative to <asset_dir>, which is the name the launcher asks AssetPack for. PNGs are
+ * decoded to RGBA8 here and stored as <name>.rgba, the header lists their sizes so the launcher can upload them
+ * without decoding anything.
+ * This program is automatically ran by the build system
+ */
+
+#define STB_IMAGE_IMPLEMENTATION
+#include <cctype>
+#include <filesystem>
+#include <fstream>
+#include <ios>
+#include <iostream>
+#include <iterator>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "Backend/AssetPack/AssetPack.hpp"
+#include "stb_image/stb_image.h"
+
+namespace {
+  // "Images/settingsIcon.png" -> SETTINGS_ICON
+  std::string ConstantName(const std::filesystem::path &name) {
+    std::string constant;
+    const std::string stem = name.stem().string();
+    for (size_t i = 0; i < stem.size(); ++i) {
+      const auto c = static_cast<unsigned char>(stem[i]);
+      if (!std::isalnum(c)) {
+        constant += '_';
+        continue;
+      }
+      if (std::isupper(c) && i > 0 && std::islower(static_cast<unsigned char>(stem[i - 1]))) constant += '_';
+      constant += static_cast<char>(std::toupper(c));
+    }
+    return constant;
+  }
+}  // namespace
+
+int main(const int argc, const char *argv[]) {
+  if (argc < 5) {
+    std::cerr << "Usage: AssetPacker <output_pack> <output_header> <asset_dir> <asset>..." << std::endl;
+    return 1;
+  }
+
+  const std::filesystem::path asset_dir = argv[3];
+  std::vector<Infinity::AssetPack::Asset> assets;
+  std::ostringstream icons;
+
+  for (int i = 4; i < argc; ++i) {
+    std::filesystem::path name = argv[i];
+    std::ifstream in(asset_dir / name, std::ios::binary);
+    if (!in) {
+      std::cerr << "Error: failed to open asset: " << (asset_dir / name).string() << std::endl;
+      return 1;
+    }
+    std::vector<uint8_t> data((std::istreambuf_iterator(in)), std::istreambuf_iterator<char>());
+
+    if (name.extension() == ".png") {
+      int width, height;
+      uint8_t *pixels = stbi_load_from_memory(data.data(), static_cast<int>(data.size()), &width, &height, nullptr, 4);
+      if (!pixels) {
+        std::cerr << "Error: failed to decode " << name.string() << ": " << stbi_failure_reason() << std::endl;
+        return 1;
+      }
+      data.assign(pixels, pixels + static_cast<size_t>(width) * height * 4);
+      stbi_image_free(pixels);
+
+      name.replace_extension(".rgba");
+      icons << "  inline constexpr AssetPack::Icon " << ConstantName(name) << "{\"" << name.generic_string() << "\", "
+            << width << ", " << height << "};\n";
+    }
+    assets.push_back({name.generic_string(), std::move(data)});
+  }
+
+  const auto stamp = Infinity::AssetPack::Build(assets, argv[1]);
+  if (!stamp) {
+    std::cerr << "Error: " << stamp.error() << std::endl;
+    return 1;
+  }
+
+  std::ostringstream header;
+  header << "// Generated by AssetPacker from the PNGs in the asset pack, do not edit\n"
+         << "#pragma once\n\n"
+         << "#include <cstdint>\n\n"
+         << "#include \"Backend/AssetPack/AssetPack.hpp\"\n\n"
+         << "namespace Infinity {\n"
+         << "  // AssetPack::Open only accepts the assets.pak built together with this header\n"
+         << "  inline constexpr uint32_t ASSET_PACK_STAMP = 0x" << std::hex << *stamp << std::dec << ";\n"
+         << "}  // namespace Infinity\n\n"
+         << "namespace Infinity::Icons {\n"
+         << icons.str() << "}  // namespace Infinity::Icons\n";
+
+  std::filesystem::create_directories(std::filesystem::path(argv[2]).parent_path());
+  std::ofstream out(argv[2], std::ios::binary | std::ios::trunc);
+  out << header.str();
+  if (!out) {
+    std::cerr << "Error: failed to write " << argv[2] << std::endl;
+    return 1;
+  }
+
+  std::cout << "Packed " << assets.size() << " assets into " << argv[1] << std::endl;
+  return 0;
+}
@@ -0,0 +1,37 @@
+/* Purpose: Generate and apply delta patches between two versions of a package.
+ * Usage: PatchBuilder build <old_dir> <new_dir> <output_patch>
+ *        PatchBuilder apply <patch> <install_dir>
+ * Patches are uploaded next to the release archive and listed under the package's `patches` in groups.bin,
+ * apply is there to check a generated patch against a local copy of the old version before publishing it
+ */
+
+#include <iostream>
+#include <string>
+
+#include "Backend/DeltaPatch/DeltaPatch.hpp"
+
+int main(const int argc, const char *argv[]) {
+  if (argc < 4) {
+    std::cerr << "Usage: PatchBuilder build <old_dir> <new_dir> <output_patch>\n"
+              << "       PatchBuilder apply <patch> <install_dir>" << std::endl;
+    return 1;
+  }
+
+  const std::string mode = argv[1];
+  std::expected<void, std::string> result;
+  if (mode == "build" && argc == 5) {
+    result = Infinity::DeltaPatch::Build(argv[2], argv[3], argv[4]);
+  } else if (mode == "apply" && argc == 4) {
+    result = Infinity::DeltaPatch::Apply(argv[2], argv[3]);
+  } else {
+    std::cerr << "Unknown mode or wrong number of arguments: " << mode << std::endl;
+    return 1;
+  }
+
+  if (!result) {
+    std::cerr << "Error: " << result.error() << std::endl;
+    return 1;
+  }
+  std::cout << "Done" << std::endl;
+  return 0;
+}
@@ -3,7 +3,10 @@
 #include <filesystem>
 #include <fstream>
 #include <iostream>
+#include <string>
 #include <thread>
+#include <utility>
+#include <vector>
 #ifdef WIN32
 #include <Windows.h>
 #else
@@ -119,21 +122,86 @@ void WaitForProcess(const int pid) {
   }
 }
 
+// Moves every staged file over its target. The old files are kept as
+// <target>.old until all of them are in place, so a failure part way through
+// restores the previous install instead of leaving a new exe next to an old
+// asset pack
+void SwapFiles(
+    const std::vector<std::pair<std::string, std::string>> &files) {
+  for (const auto &[staged, target]: files) {
+    if (!std::filesystem::exists(staged)) {
+      throw std::runtime_error("Staged file does not exist: " + staged);
+    }
+  }
+
+  // every file moved so far, undone in reverse if a later one fails
+  struct Swapped {
+    std::string staged;
+    std::string target;
+    bool had_old;
+  };
+  std::vector<Swapped> swapped;
+  std::string moved_aside;  // target of a file that failed after its backup
+  try {
+    for (const auto &[staged, target]: files) {
+      const bool had_old = std::filesystem::exists(target);
+      if (had_old) {
+        std::filesystem::remove(target + ".old");
+        std::filesystem::rename(target, target + ".old");
+        moved_aside = target;
+      }
+      std::filesystem::rename(staged, target);
+      moved_aside.clear();
+      swapped.push_back({staged, target, had_old});
+      std::cout << "Replaced " << target << std::endl;
+    }
+  } catch (const std::filesystem::filesystem_error &) {
+    // the staged files are put back too, so the update can be tried again
+    std::error_code ec;
+    if (!moved_aside.empty()) {
+      std::filesystem::rename(moved_aside + ".old", moved_aside, ec);
+    }
+    for (auto it = swapped.rbegin(); it != swapped.rend(); ++it) {
+      std::filesystem::rename(it->target, it->staged, ec);
+      if (it->had_old) {
+        std::filesystem::rename(it->target + ".old", it->target, ec);
+      }
+      if (ec) {
+        std::cerr << "Failed to restore " << it->target << ": " << ec.message()
+                  << std::endl;
+      }
+    }
+    throw;
+  }
+
+  for (const auto &entry: swapped) {
+    std::error_code ec;
+    if (entry.had_old) std::filesystem::remove(entry.target + ".old", ec);
+  }
+}
+
 int main(const int argc, char **argv) {
   try {
-    if (argc < 4) {
+    if (argc < 6) {
       throw std::runtime_error(
-          "Usage: Updater <tempExePath> <currentExePath> <pidFilePath>");
+          "Usage: Updater <tempExePath> <currentExePath> <pidFilePath> "
+          "<tempPackPath> <currentPackPath>");
     }
 
     const std::string temp_exe_path = argv[1];
     const std::string current_exe_path = argv[2];
     const std::string pid_file_path = argv[3];
+    // the launcher refuses an assets.pak that was not built with it, so the
+    // pack is always replaced together with the exe
+    const std::string temp_pack_path = argv[4];
+    const std::string current_pack_path = argv[5];
 
     std::cout << "Starting update process..." << std::endl;
     std::cout << "Temp exe path: " << temp_exe_path << std::endl;
     std::cout << "Current exe path: " << current_exe_path << std::endl;
     std::cout << "PID file path: " << pid_file_path << std::endl;
+    std::cout << "Temp pack path: " << temp_pack_path << std::endl;
+    std::cout << "Current pack path: " << current_pack_path << std::endl;
 
     int pid;
     try {
@@ -154,20 +222,13 @@ int main(const int argc, char **argv) {
     std::cout << "Process ended, starting update..." << std::endl;
 
     try {
-      if (!std::filesystem::exists(temp_exe_path)) {
-        throw std::runtime_error("Temp exe does not exist: " + temp_exe_path);
-      }
-
       if (!std::filesystem::exists(current_exe_path)) {
         throw std::runtime_error("Current exe does not exist: " +
                                  current_exe_path);
       }
 
-      std::filesystem::remove(current_exe_path);
-      std::cout << "Removed old exe" << std::endl;
-
-      std::filesystem::rename(temp_exe_path, current_exe_path);
-      std::cout << "Renamed new exe" << std::endl;
+      SwapFiles({{temp_exe_path, current_exe_path},
+                 {temp_pack_path, current_pack_path}});
 
 #ifdef _WIN32
       std::cout << "Launching updated executable..." << std::endl;
@@ -1,2848 +0,0 @@
-
-unsigned char g_infAppIconTransparent[34137] = {
-	0x89, 0x50, 0x4E, 0x47, 0x0D, 0x0A, 0x1A, 0x0A, 0x00, 0x00, 0x00, 0x0D,
-	0x49, 0x48, 0x44, 0x52, 0x00, 0x00, 0x01, 0x2C, 0x00, 0x00, 0x01, 0x2C,
-	0x08, 0x06, 0x00, 0x00, 0x00, 0x79, 0x7D, 0x8E, 0x75, 0x00, 0x00, 0x00,
-	0x09, 0x70, 0x48, 0x59, 0x73, 0x00, 0x00, 0x0B, 0x13, 0x00, 0x00, 0x0B,
-	0x13, 0x01, 0x00, 0x9A, 0x9C, 0x18, 0x00, 0x00, 0x85, 0x0B, 0x49, 0x44,
-	0x41, 0x54, 0x78, 0x9C, 0xED, 0xBD, 0x77, 0x78, 0x1B, 0xD7, 0x95, 0xF7,
-	0x7F, 0x66, 0x00, 0x0C, 0x7A, 0x23, 0xD8, 0x7B, 0x2F, 0xA2, 0x48, 0x89,
-	0x2A, 0x54, 0xEF, 0xBD, 0xDA, 0x92, 0x25, 0xF7, 0xEE, 0x38, 0x76, 0xE2,
-	0x64, 0xD7, 0x9B, 0x6C, 0x92, 0x77, 0x37, 0x9B, 0xDD, 0xEC, 0xFB, 0xCB,
-	0xEE, 0xBB, 0x2D, 0xD9, 0x5D, 0x67, 0xB3, 0x71, 0x1C, 0xF7, 0x38, 0xB6,
-	0x65, 0xB9, 0xDB, 0x92, 0x6C, 0xF5, 0xDE, 0xC5, 0x2A, 0x51, 0xA4, 0x44,
-	0xB1, 0x48, 0xEC, 0x0D, 0x44, 0xC7, 0x60, 0x80, 0x99, 0xDF, 0x1F, 0xC2,
-	0x81, 0x2E, 0x61, 0x52, 0x02, 0x25, 0xCA, 0x12, 0xA4, 0xFB, 0x79, 0x1E,
-	0x3E, 0xA2, 0x48, 0x70, 0x30, 0x98, 0xB9, 0xF3, 0xBD, 0xE7, 0x9E, 0x76,
-	0x19, 0x49, 0x92, 0x80, 0x42, 0xA1, 0x50, 0xA2, 0x01, 0xF6, 0x56, 0x9F,
-	0x00, 0x85, 0x42, 0xA1, 0x44, 0x0A, 0x15, 0x2C, 0x0A, 0x85, 0x12, 0x35,
-	0x50, 0xC1, 0xA2, 0x50, 0x28, 0x51, 0x03, 0x15, 0x2C, 0x0A, 0x85, 0x12,
-	0x35, 0x50, 0xC1, 0xA2, 0x50, 0x28, 0x51, 0x03, 0x15, 0x2C, 0x0A, 0x85,
-	0x12, 0x35, 0x50, 0xC1, 0xA2, 0x50, 0x28, 0x51, 0x03, 0x15, 0x2C, 0x0A,
-	0x85, 0x12, 0x35, 0x50, 0xC1, 0xA2, 0x50, 0x28, 0x51, 0x03, 0x15, 0x2C,
-	0x0A, 0x85, 0x12, 0x35, 0x50, 0xC1, 0xA2, 0x50, 0x28, 0x51, 0x03, 0x15,
-	0x2C, 0x0A, 0x85, 0x12, 0x35, 0x50, 0xC1, 0xA2, 0x50, 0x28, 0x51, 0x03,
-	0x15, 0x2C, 0x0A, 0x85, 0x12, 0x35, 0x50, 0xC1, 0xA2, 0x50, 0x28, 0x51,
-	0x03, 0x15, 0x2C, 0x0A, 0x85, 0x12, 0x35, 0x50, 0xC1, 0xA2, 0x50, 0x28,
-	0x51, 0x03, 0x15, 0x2C, 0x0A, 0x85, 0x12, 0x35, 0x50, 0xC1, 0xA2, 0x50,
-	0x28, 0x51, 0x03, 0x15, 0x2C, 0x0A, 0x85, 0x12, 0x35, 0x50, 0xC1, 0xA2,
-	0x50, 0x28, 0x51, 0x03, 0x15, 0x2C, 0x0A, 0x85, 0x12, 0x35, 0x50, 0xC1,
-	0xA2, 0x50, 0x28, 0x51, 0x03, 0x15, 0x2C, 0x0A, 0x85, 0x12, 0x35, 0x50,
-	0xC1, 0xA2, 0x50, 0x28, 0x51, 0x03, 0x15, 0x2C, 0x0A, 0x85, 0x12, 0x35,
-	0x50, 0xC1, 0xA2, 0x50, 0x28, 0x51, 0x03, 0x15, 0x2C, 0x0A, 0x85, 0x12,
-	0x35, 0x50, 0xC1, 0xA2, 0x50, 0x28, 0x51, 0x03, 0x15, 0x2C, 0x0A, 0x85,
-	0x12, 0x35, 0x50, 0xC1, 0xA2, 0x50, 0x28, 0x51, 0x03, 0x15, 0x2C, 0x0A,
-	0x85, 0x12, 0x35, 0x50, 0xC1, 0xA2, 0x50, 0x28, 0x51, 0x03, 0x15, 0x2C,
-	0x0A, 0x85, 0x12, 0x35, 0x50, 0xC1, 0xA2, 0x50, 0x28, 0x51, 0x03, 0x15,
-	0x2C, 0x0A, 0x85, 0x12, 0x35, 0x50, 0xC1, 0xA2, 0x50, 0x28, 0x51, 0x03,
-	0x15, 0x2C, 0x0A, 0x85, 0x12, 0x35, 0x50, 0xC1, 0xA2, 0x50, 0x28, 0x51,
-	0x03, 0x15, 0x2C, 0x0A, 0x85, 0x12, 0x35, 0x50, 0xC1, 0xA2, 0x50, 0x28,
-	0x51, 0x03, 0x15, 0x2C, 0x0A, 0x85, 0x12, 0x35, 0x50, 0xC1, 0xA2, 0x50,
-	0x28, 0x51, 0x03, 0x15, 0x2C, 0x0A, 0x85, 0x12, 0x35, 0x50, 0xC1, 0xA2,
-	0x50, 0x28, 0x51, 0x03, 0x15, 0x2C, 0x0A, 0x85, 0x12, 0x35, 0x50, 0xC1,
-	0xA2, 0x50, 0x28, 0x51, 0x03, 0x15, 0x2C, 0x0A, 0x85, 0x12, 0x35, 0x50,
-	0xC1, 0xA2, 0x50, 0x28, 0x51, 0x03, 0x15, 0x2C, 0x0A, 0x85, 0x12, 0x35,
-	0x50, 0xC1, 0xA2, 0x50, 0x28, 0x51, 0x03, 0x15, 0x2C, 0x0A, 0x85, 0x12,
-	0x35, 0x50, 0xC1, 0xA2, 0x50, 0x28, 0x51, 0x03, 0x15, 0x2C, 0x0A, 0x85,
-	0x12, 0x35, 0x50, 0xC1, 0xA2, 0x50, 0x28, 0x51, 0x03, 0x15, 0x2C, 0x0A,
-	0x85, 0x12, 0x35, 0x50, 0xC1, 0xA2, 0x50, 0x28, 0x51, 0x03, 0x15, 0x2C,
-	0x0A, 0x85, 0x12, 0x35, 0x50, 0xC1, 0xA2, 0x50, 0x28, 0x51, 0x03, 0x15,
-	0x2C, 0x0A, 0x85, 0x12, 0x35, 0x50, 0xC1, 0xA2, 0x50, 0x28, 0x51, 0x03,
-	0x15, 0x2C, 0x0A, 0x85, 0x12, 0x35, 0x50, 0xC1, 0xA2, 0x50, 0x28, 0x51,
-	0x03, 0x15, 0x2C, 0x0A, 0x85, 0x12, 0x35, 0x50, 0xC1, 0xA2, 0x50, 0x28,
-	0x51, 0x03, 0x15, 0x2C, 0x0A, 0x85, 0x12, 0x35, 0x50, 0xC1, 0xA2, 0x50,
-	0x28, 0x51, 0x03, 0x15, 0x2C, 0x0A, 0x85, 0x12, 0x35, 0x50, 0xC1, 0xA2,
-	0x50, 0x28, 0x51, 0x03, 0x15, 0x2C, 0x0A, 0x85, 0x12, 0x35, 0x50, 0xC1,
-	0xA2, 0x50, 0x28, 0x51, 0x03, 0x15, 0x2C, 0x0A, 0x85, 0x12, 0x35, 0x50,
-	0xC1, 0xA2, 0x50, 0x28, 0x51, 0x03, 0x15, 0x2C, 0x0A, 0x85, 0x12, 0x35,
-	0x50, 0xC1, 0xA2, 0x50, 0x28, 0x51, 0x03, 0x15, 0x2C, 0x0A, 0x85, 0x12,
-	0x35, 0x50, 0xC1, 0xA2, 0x50, 0x28, 0x51, 0x03, 0x15, 0x2C, 0x0A, 0x85,
-	0x12, 0x35, 0x50, 0xC1, 0xA2, 0x50, 0x28, 0x51, 0x03, 0x15, 0x2C, 0x0A,
-	0x85, 0x12, 0x35, 0x50, 0xC1, 0xA2, 0x50, 0x28, 0x51, 0x03, 0x15, 0x2C,
-	0x0A, 0x85, 0x12, 0x35, 0x50, 0xC1, 0xA2, 0x50, 0x28, 0x51, 0x03, 0x15,
-	0x2C, 0x0A, 0x85, 0x12, 0x35, 0x50, 0xC1, 0xA2, 0x50, 0x28, 0x51, 0x83,
-	0x7C, 0xA4, 0x5F, 0x4C, 0x9D, 0x3A, 0x75, 0x54, 0x07, 0x12, 0x45, 0x11,
-	0x64, 0x32, 0x19, 0x64, 0x64, 0x64, 0x40, 0x71, 0x71, 0x31, 0xA4, 0xA6,
-	0xA6, 0x82, 0x4A, 0xA5, 0x02, 0xB5, 0x5A, 0x0D, 0x3A, 0x9D, 0x0E, 0x3C,
-	0x1E, 0x0F, 0x08, 0x82, 0x00, 0x0E, 0x87, 0x03, 0xDC, 0x6E, 0x37, 0x0C,
-	0x0E, 0x0E, 0x42, 0x75, 0x75, 0x35, 0xF4, 0xF6, 0xF6, 0xC2, 0xF2, 0xE5,
-	0xCB, 0xC1, 0x64, 0x32, 0xC1, 0xEE, 0xDD, 0xBB, 0x21, 0x37, 0x37, 0x17,
-	0x7E, 0xF5, 0xAB, 0x5F, 0x01, 0xCB, 0xB2, 0xD0, 0xD5, 0xD5, 0x05, 0xFB,
-	0xF7, 0xEF, 0x87, 0xCD, 0x9B, 0x37, 0x83, 0xDB, 0xED, 0x86, 0x9C, 0x9C,
-	0x1C, 0xA8, 0xAA, 0xAA, 0x82, 0x84, 0x84, 0x04, 0x28, 0x2A, 0x2A, 0x82,
-	0xAE, 0xAE, 0x2E, 0x50, 0xA9, 0x54, 0x10, 0x17, 0x17, 0x07, 0x9F, 0x7D,
-	0xF6, 0x19, 0xC4, 0xC6, 0xC6, 0xC2, 0xEC, 0xD9, 0xB3, 0x61, 0xC5, 0x8A,
-	0x15, 0x50, 0x55, 0x55, 0x05, 0xFF, 0xF3, 0x3F, 0xFF, 0x03, 0xD3, 0xA6,
-	0x4D, 0x33, 0xFC, 0xF0, 0x87, 0x3F, 0x34, 0xC6, 0xC7, 0xC7, 0xAB, 0x36,
-	0x6F, 0xDE, 0x1C, 0xB7, 0x65, 0xCB, 0x96, 0xA4, 0xB4, 0xB4, 0x34, 0x73,
-	0x6C, 0x6C, 0x6C, 0x9C, 0xC5, 0x62, 0x89, 0xB3, 0x58, 0x2C, 0xB1, 0x26,
-	0x93, 0xC9, 0xAC, 0xD3, 0xE9, 0x8C, 0x3A, 0x9D, 0x4E, 0xCB, 0x71, 0x1C,
-	0x27, 0x8A, 0xA2, 0x24, 0x97, 0xCB, 0x19, 0x99, 0x4C, 0x26, 0x67, 0x59,
-	0x96, 0x15, 0x45, 0xD1, 0xEF, 0x70, 0x38, 0x1C, 0x3D, 0x3D, 0x3D, 0xDD,
-	0xDD, 0xDD, 0xDD, 0xED, 0xFD, 0xFD, 0xFD, 0x7D, 0xAD, 0xAD, 0xAD, 0x4D,
-	0xFD, 0xFD, 0xFD, 0xAD, 0xA9, 0xA9, 0xA9, 0xF6, 0xBC, 0xBC, 0xBC, 0xDE,
-	0x8A, 0x8A, 0x0A, 0xEB, 0xC1, 0x83, 0x07, 0x1D, 0xF7, 0xDF, 0x7F, 0x3F,
-	0xCC, 0x9A, 0x35, 0x0B, 0xDE, 0x7D, 0xF7, 0x5D, 0xE8, 0xE8, 0xE8, 0x80,
-	0x07, 0x1E, 0x78, 0x00, 0xAA, 0xAB, 0xAB, 0x61, 0xEA, 0xD4, 0xA9, 0x60,
-	0xB1, 0x58, 0xA0, 0xBD, 0xBD, 0x1D, 0xEE, 0xB9, 0xE7, 0x1E, 0xF8, 0xE8,
-	0xA3, 0x8F, 0x60, 0xD3, 0xA6, 0x4D, 0x10, 0x17, 0x17, 0x07, 0x6A, 0xB5,
-	0x1A, 0x6A, 0x6B, 0x6B, 0xC1, 0x66, 0xB3, 0x81, 0x4C, 0x26, 0x83, 0xBC,
-	0xBC, 0x3C, 0x58, 0xBD, 0x7A, 0x35, 0xB4, 0xB4, 0xB4, 0x40, 0x73, 0x73,
-	0x33, 0xA4, 0xA6, 0xA6, 0xC2, 0xEE, 0xDD, 0xBB, 0x41, 0xAF, 0xD7, 0x43,
-	0x5C, 0x5C, 0x1C, 0x64, 0x65, 0x65, 0x81, 0xC7, 0xE3, 0x81, 0xD6, 0xD6,
-	0x56, 0x98, 0x31, 0x63, 0x06, 0x94, 0x96, 0x96, 0xC2, 0x96, 0x2D, 0x5B,
-	0xA0, 0xA3, 0xA3, 0x03, 0x04, 0x41, 0x80, 0xB3, 0x67, 0xCF, 0x82, 0x5C,
-	0x2E, 0x07, 0x8E, 0xE3, 0x20, 0x37, 0x37, 0x17, 0x8A, 0x8B, 0x8B, 0x21,
-	0x2D, 0x2D, 0x0D, 0x72, 0x72, 0x72, 0xC0, 0xED, 0x76, 0xC3, 0x6F, 0x7E,
-	0xF3, 0x1B, 0xF0, 0xFB, 0xFD, 0x30, 0x6D, 0xDA, 0x34, 0x48, 0x48, 0x48,
-	0x00, 0x99, 0x4C, 0x06, 0xDD, 0xDD, 0xDD, 0xF0, 0xC5, 0x17, 0x5F, 0x80,
-	0xC3, 0xE1, 0x80, 0xF4, 0xF4, 0x74, 0x30, 0x1A, 0x8D, 0x20, 0x49, 0x12,
-	0xC8, 0x64, 0x32, 0x50, 0x2A, 0x95, 0x90, 0x9C, 0x9C, 0x0C, 0x46, 0xA3,
-	0x11, 0x02, 0x81, 0x00, 0xC8, 0x64, 0x32, 0x88, 0x89, 0x89, 0x01, 0xAB,
-	0xD5, 0x0A, 0x9F, 0x7E, 0xFA, 0x29, 0xB4, 0xB7, 0xB7, 0x83, 0xD9, 0x6C,
-	0x06, 0x85, 0x42, 0x01, 0x5E, 0xAF, 0x17, 0x2C, 0x16, 0x0B, 0xAC, 0x59,
-	0xB3, 0x06, 0x7E, 0xF0, 0x83, 0x1F, 0x40, 0x72, 0x72, 0xF2, 0x88, 0x63,
-	0xE6, 0xB5, 0xD7, 0x5E, 0x83, 0x37, 0xDE, 0x78, 0x03, 0x4A, 0x4A, 0x4A,
-	0x80, 0xE7, 0x79, 0xE8, 0xEB, 0xEB, 0x03, 0x87, 0xC3, 0x01, 0x1A, 0x8D,
-	0x06, 0x38, 0x8E, 0x83, 0xC4, 0xC4, 0x44, 0x98, 0x3D, 0x7B, 0x36, 0xB8,
-	0xDD, 0x6E, 0xE8, 0xEF, 0xEF, 0x87, 0xB6, 0xB6, 0x36, 0x68, 0x69, 0x69,
-	0x81, 0xCE, 0xCE, 0x4E, 0xB0, 0x58, 0x2C, 0xF0, 0x83, 0x1F, 0xFC, 0x00,
-	0x74, 0x3A, 0x1D, 0x9C, 0x3B, 0x77, 0x0E, 0x1A, 0x1A, 0x1A, 0xA0, 0xA1,
-	0xA1, 0x01, 0xEC, 0x76, 0x3B, 0x30, 0x0C, 0x03, 0x9D, 0x9D, 0x9D, 0x90,
-	0x9A, 0x9A, 0x0A, 0x5E, 0xAF, 0x17, 0x92, 0x93, 0x93, 0xE1, 0xC9, 0x27,
-	0x9F, 0x84, 0xCA, 0xCA, 0x4A, 0x38, 0x78, 0xF0, 0x20, 0xDC, 0x73, 0xCF,
-	0x3D, 0x90, 0x9D, 0x9D, 0x0D, 0xEF, 0xBD, 0xF7, 0x1E, 0xF0, 0x3C, 0x0F,
-	0xCF, 0x3E, 0xFB, 0x2C, 0x34, 0x35, 0x35, 0xC1, 0xC7, 0x1F, 0x7F, 0x0C,
-	0xC5, 0xC5, 0xC5, 0x90, 0x9E, 0x9E, 0x0E, 0x07, 0x0E, 0x1C, 0x00, 0xBF,
-	0xDF, 0x0F, 0x6A, 0xB5, 0x1A, 0x7E, 0xF1, 0x8B, 0x5F, 0x00, 0xCB, 0xB2,
-	0xF0, 0x2F, 0xFF, 0xF2, 0x2F, 0xD0, 0xD9, 0xD9, 0x09, 0x59, 0x59, 0x59,
-	0x70, 0xE2, 0xC4, 0x09, 0x18, 0x37, 0x6E, 0x1C, 0xFC, 0xF5, 0x5F, 0xFF,
-	0x35, 0x9C, 0x3B, 0x77, 0x0E, 0x3E, 0xFE, 0xF8, 0x63, 0x48, 0x4A, 0x4A,
-	0x82, 0xEA, 0xEA, 0x6A, 0xC8, 0xCD, 0xCD, 0x85, 0xC6, 0xC6, 0x46, 0x38,
-	0x7D, 0xFA, 0x34, 0xA4, 0xA4, 0xA4, 0x30, 0xAB, 0x57, 0xAF, 0x36, 0xDC,
-	0x7F, 0xFF, 0xFD, 0xA6, 0x37, 0xDE, 0x78, 0x23, 0xAE, 0xB1, 0xB1, 0xD1,
-	0x54, 0x50, 0x50, 0x90, 0x95, 0x90, 0x90, 0x90, 0xAD, 0xD3, 0xE9, 0x4C,
-	0x71, 0x71, 0x71, 0x89, 0xB1, 0xB1, 0xB1, 0xF1, 0x26, 0x93, 0xC9, 0xA8,
-	0x54, 0x2A, 0x39, 0x49, 0x92, 0x24, 0x41, 0x10, 0x04, 0x51, 0x14, 0xFD,
-	0x92, 0x24, 0x31, 0x82, 0x20, 0x08, 0x6E, 0xB7, 0xDB, 0xE9, 0x70, 0x38,
-	0xEC, 0x56, 0xAB, 0x75, 0xB0, 0xBF, 0xBF, 0xBF, 0xAF, 0xBF, 0xBF, 0xBF,
-	0xB7, 0xAF, 0xAF, 0xAF, 0x77, 0x70, 0x70, 0x70, 0x70, 0xDC, 0xB8, 0x71,
-	0x1D, 0xEB, 0xD6, 0xAD, 0xEB, 0x65, 0x18, 0xC6, 0xFB, 0xBB, 0xDF, 0xFD,
-	0xCE, 0xB6, 0x6F, 0xDF, 0x3E, 0xFB, 0x5F, 0xFE, 0xE5, 0x5F, 0x42, 0x79,
-	0x79, 0x39, 0x7C, 0xFE, 0xF9, 0xE7, 0x70, 0xE8, 0xD0, 0x21, 0xF0, 0x7A,
-	0xBD, 0xB0, 0x76, 0xED, 0x5A, 0x68, 0x6E, 0x6E, 0x86, 0xF3, 0xE7, 0xCF,
-	0x43, 0x5C, 0x5C, 0x1C, 0x00, 0x00, 0xB0, 0x2C, 0x0B, 0xC9, 0xC9, 0xC9,
-	0x50, 0x51, 0x51, 0x01, 0x66, 0xB3, 0x19, 0xD2, 0xD2, 0xD2, 0xE0, 0xE2,
-	0xC5, 0x8B, 0xC0, 0x30, 0x0C, 0x48, 0x92, 0x04, 0x0E, 0x87, 0x03, 0x32,
-	0x32, 0x32, 0x60, 0xDA, 0xB4, 0x69, 0xD0, 0xD3, 0xD3, 0x03, 0xDB, 0xB7,
-	0x6F, 0x07, 0xB3, 0xD9, 0x0C, 0xE3, 0xC7, 0x8F, 0x87, 0xB8, 0xB8, 0x38,
-	0xD0, 0x6A, 0xB5, 0xA0, 0xD5, 0x6A, 0x41, 0xA9, 0x54, 0x82, 0x4A, 0xA5,
-	0x02, 0x9E, 0xE7, 0xE1, 0xCB, 0x2F, 0xBF, 0x84, 0x9A, 0x9A, 0x1A, 0x50,
-	0xAB, 0xD5, 0xA3, 0xD2, 0x8F, 0x70, 0xF6, 0xEC, 0xD9, 0x33, 0xEC, 0xCF,
-	0x47, 0x14, 0xAC, 0x68, 0x42, 0x92, 0x24, 0xF0, 0xF9, 0x7C, 0xE0, 0xF3,
-	0xF9, 0xC0, 0xEF, 0xF7, 0xAB, 0x05, 0x41, 0x50, 0x69, 0x34, 0x1A, 0x63,
-	0x4E, 0x4E, 0x4E, 0x81, 0xD9, 0x6C, 0x2E, 0xA9, 0xAE, 0xAE, 0x2E, 0x4A,
-	0x49, 0x49, 0x49, 0x5D, 0xBA, 0x74, 0x69, 0xC6, 0x03, 0x0F, 0x3C, 0x90,
-	0x20, 0x97, 0xCB, 0x39, 0x8E, 0xE3, 0x14, 0x72, 0xB9, 0x9C, 0x65, 0x18,
-	0x86, 0x01, 0x00, 0x46, 0x14, 0x45, 0x86, 0x61, 0x18, 0x60, 0x18, 0x06,
-	0x58, 0x96, 0x05, 0x49, 0x92, 0x40, 0x14, 0x45, 0x90, 0x24, 0x09, 0x58,
-	0x96, 0xC5, 0x9B, 0x28, 0x49, 0x92, 0x24, 0x06, 0x02, 0x01, 0x89, 0x61,
-	0x18, 0x91, 0xE7, 0x79, 0xBE, 0xAD, 0xAD, 0xAD, 0xAD, 0xAE, 0xAE, 0xAE,
-	0xC2, 0x62, 0xB1, 0x9C, 0xC8, 0xCA, 0xCA, 0xAA, 0x31, 0x1A, 0x8D, 0x17,
-	0x04, 0x41, 0x18, 0xF4, 0xF9, 0x7C, 0x6E, 0x9F, 0xCF, 0xE7, 0x97, 0x24,
-	0xE9, 0x56, 0x5F, 0x1E, 0xCA, 0xB7, 0x84, 0x28, 0x8A, 0xC0, 0xF3, 0x3C,
-	0xF8, 0x7C, 0x3E, 0x99, 0x5E, 0xAF, 0xD7, 0x67, 0x64, 0x64, 0x24, 0x66,
-	0x66, 0x66, 0xE6, 0x30, 0x0C, 0x33, 0xEE, 0xEC, 0xD9, 0xB3, 0x25, 0x8F,
-	0x3F, 0xFE, 0x78, 0x49, 0x66, 0x66, 0x66, 0xA6, 0x5A, 0xAD, 0xD6, 0xB0,
-	0x2C, 0xCB, 0x4A, 0x92, 0xC4, 0x00, 0x00, 0xCB, 0x5C, 0x06, 0x00, 0x00,
-	0x70, 0x0C, 0xE2, 0xF1, 0x00, 0x2E, 0x8F, 0x6F, 0x86, 0x61, 0xA4, 0xCB,
-	0xDF, 0x4A, 0x52, 0x20, 0x10, 0x10, 0x7D, 0x3E, 0x9F, 0xE0, 0xF7, 0xFB,
-	0x7D, 0x7D, 0x7D, 0x7D, 0xDD, 0xED, 0xED, 0xED, 0x2D, 0x5D, 0x5D, 0x5D,
-	0xED, 0x26, 0x93, 0xE9, 0x6C, 0x6E, 0x6E, 0x6E, 0xAD, 0x4E, 0xA7, 0x6B,
-	0x10, 0x04, 0xC1, 0xE6, 0xF7, 0xFB, 0xBD, 0x3E, 0x9F, 0xCF, 0xE3, 0xF3,
-	0xF9, 0xE0, 0x4E, 0x19, 0x87, 0x51, 0x2D, 0x58, 0xA2, 0x28, 0x86, 0x6E,
-	0xAA, 0x52, 0xA9, 0x8C, 0x51, 0x2A, 0x95, 0x85, 0x0A, 0x85, 0x62, 0x9A,
-	0xD7, 0xEB, 0x9D, 0x52, 0x5E, 0x5E, 0x9E, 0x3B, 0x6B, 0xD6, 0xAC, 0x44,
-	0x95, 0x4A, 0xA5, 0x97, 0xC9, 0x64, 0x6A, 0x85, 0x42, 0xC1, 0xE9, 0x74,
-	0x3A, 0x96, 0x65, 0x23, 0x5F, 0x05, 0xCB, 0x64, 0xB2, 0xF0, 0x1F, 0x31,
-	0x00, 0x20, 0x53, 0x28, 0x14, 0xF8, 0x9E, 0x5C, 0x61, 0x61, 0x61, 0x51,
-	0x5A, 0x5A, 0x5A, 0xCE, 0xDC, 0xB9, 0x73, 0x57, 0xF0, 0x3C, 0xEF, 0x76,
-	0xB9, 0x5C, 0x97, 0xEA, 0xEA, 0xEA, 0x8E, 0x72, 0x1C, 0x77, 0x40, 0xA9,
-	0x54, 0x56, 0x02, 0xC0, 0x45, 0x51, 0x14, 0xC5, 0x3B, 0x65, 0xC0, 0x50,
-	0xBE, 0x09, 0x4E, 0x6E, 0x2C, 0xCB, 0xCA, 0x39, 0x8E, 0x8B, 0x97, 0xC9,
-	0x64, 0xE5, 0xEB, 0xD6, 0xAD, 0x5B, 0x3C, 0x7E, 0xFC, 0xF8, 0xA9, 0x89,
-	0x89, 0x89, 0x49, 0x1C, 0xC7, 0xE9, 0x58, 0x96, 0xD5, 0x98, 0x4C, 0x26,
-	0xA5, 0x5C, 0x1E, 0xF9, 0x23, 0x17, 0x36, 0x56, 0x99, 0xE0, 0x17, 0x28,
-	0x14, 0x0A, 0x99, 0x4A, 0xA5, 0x52, 0x00, 0x80, 0xC6, 0x64, 0x32, 0x99,
-	0x12, 0x13, 0x13, 0xF3, 0xFC, 0x7E, 0xBF, 0x6F, 0xD1, 0xA2, 0x45, 0x1E,
-	0x9E, 0xE7, 0x1D, 0x81, 0x40, 0xA0, 0xAB, 0xB5, 0xB5, 0xB5, 0x51, 0xA1,
-	0x50, 0x1C, 0x57, 0x2A, 0x95, 0x87, 0x25, 0x49, 0xAA, 0x03, 0x00, 0x17,
-	0x3E, 0x2F, 0x41, 0x01, 0x1C, 0xCB, 0x4B, 0xF0, 0xAD, 0x11, 0xB5, 0x82,
-	0x25, 0x8A, 0x22, 0xF8, 0xFD, 0x7E, 0x83, 0xCD, 0x66, 0x2B, 0x2B, 0x29,
-	0x29, 0x99, 0xF2, 0xF3, 0x9F, 0xFF, 0x7C, 0xBA, 0xD9, 0x6C, 0xCE, 0x8C,
-	0x8F, 0x8F, 0x4F, 0x8E, 0x8D, 0x8D, 0x8D, 0x8B, 0x89, 0x89, 0x51, 0x0C,
-	0x23, 0x38, 0x21, 0xAE, 0x26, 0x20, 0xA3, 0xB9, 0x99, 0x2C, 0xCB, 0x82,
-	0x5E, 0xAF, 0xE7, 0xF4, 0x7A, 0x7D, 0x0C, 0x00, 0xC4, 0xF8, 0xFD, 0xFE,
-	0x54, 0x9D, 0x4E, 0x37, 0x3E, 0x33, 0x33, 0x73, 0x95, 0xDD, 0x6E, 0xBF,
-	0x68, 0xB5, 0x5A, 0x8F, 0xDA, 0xED, 0xF6, 0xDD, 0x81, 0x40, 0xE0, 0x30,
-	0xC3, 0x30, 0xFC, 0x68, 0x3E, 0x23, 0xE5, 0xF6, 0x87, 0x61, 0x18, 0xF0,
-	0xF9, 0x7C, 0xAC, 0x28, 0x8A, 0x33, 0x27, 0x4C, 0x98, 0xB0, 0x72, 0xF5,
-	0xEA, 0xD5, 0x65, 0x71, 0x71, 0x71, 0xD9, 0x19, 0x19, 0x19, 0xC9, 0x46,
-	0xA3, 0x51, 0x37, 0xD2, 0xDF, 0x91, 0xE3, 0x6F, 0xB4, 0xE2, 0x81, 0x7F,
-	0x8B, 0xAB, 0x01, 0x83, 0xC1, 0xC0, 0x02, 0x80, 0x2A, 0xF8, 0x65, 0x06,
-	0x80, 0x74, 0xBD, 0x5E, 0x5F, 0x96, 0x94, 0x94, 0x34, 0x6F, 0xC1, 0x82,
-	0x05, 0x6D, 0x0E, 0x87, 0xA3, 0xB5, 0xB7, 0xB7, 0xB7, 0xB2, 0xB2, 0xB2,
-	0x72, 0x9F, 0x20, 0x08, 0x95, 0xA2, 0x28, 0x7A, 0xAF, 0xF6, 0x6C, 0xDC,
-	0xCE, 0x44, 0x8D, 0x60, 0x31, 0x0C, 0x03, 0xA2, 0x28, 0x82, 0xD3, 0xE9,
-	0x04, 0xB5, 0x5A, 0x9D, 0x66, 0x36, 0x9B, 0x67, 0x4F, 0x9A, 0x34, 0x69,
-	0x8E, 0x56, 0xAB, 0x1D, 0x9F, 0x93, 0x93, 0x93, 0x93, 0x9B, 0x9B, 0x3B,
-	0xC4, 0x59, 0x12, 0x08, 0x04, 0x40, 0x10, 0x84, 0xD0, 0x4D, 0xC5, 0x63,
-	0x8C, 0x15, 0x81, 0x40, 0x20, 0xB4, 0x5C, 0x94, 0x24, 0x29, 0x34, 0x88,
-	0x64, 0x32, 0x19, 0xA4, 0xA6, 0xA6, 0xEA, 0x53, 0x53, 0x53, 0xF5, 0x00,
-	0x90, 0x7F, 0xF1, 0xE2, 0xC5, 0x29, 0x3A, 0x9D, 0x6E, 0x41, 0x42, 0x42,
-	0x42, 0x55, 0x5D, 0x5D, 0xDD, 0x49, 0xAF, 0xD7, 0xBB, 0x07, 0x00, 0x5A,
-	0xC7, 0xEC, 0x44, 0x28, 0xDF, 0x2A, 0x38, 0x0E, 0x5D, 0x2E, 0x17, 0x38,
-	0x9D, 0xCE, 0x6C, 0x87, 0xC3, 0xB1, 0x74, 0xCA, 0x94, 0x29, 0x13, 0xE3,
-	0xE3, 0xE3, 0x0B, 0x0B, 0x0B, 0x0B, 0x27, 0x66, 0x64, 0x64, 0x18, 0xC9,
-	0xD7, 0x0B, 0x82, 0x10, 0xF2, 0x05, 0xB2, 0x2C, 0x0B, 0x7E, 0xBF, 0x1F,
-	0x18, 0x86, 0x01, 0xB9, 0x5C, 0x7E, 0xC3, 0xCB, 0x34, 0xFC, 0x7B, 0xB4,
-	0x9C, 0xD0, 0x7A, 0x92, 0xC9, 0x64, 0x60, 0xB1, 0x58, 0x14, 0x16, 0x8B,
-	0x25, 0x25, 0x3F, 0x3F, 0x3F, 0x05, 0x00, 0xA6, 0x35, 0x35, 0x35, 0xCD,
-	0x4B, 0x4A, 0x4A, 0x5A, 0xD6, 0xD1, 0xD1, 0x71, 0xAA, 0xBE, 0xBE, 0xFE,
-	0xE0, 0x99, 0x33, 0x67, 0x8E, 0xC8, 0xE5, 0xF2, 0x6E, 0x51, 0x14, 0xA3,
-	0xCA, 0xDA, 0xBA, 0xED, 0x05, 0x2B, 0x38, 0x83, 0xC1, 0xC0, 0xC0, 0x00,
-	0x97, 0x93, 0x93, 0x53, 0xB8, 0x78, 0xF1, 0xE2, 0x09, 0x39, 0x39, 0x39,
-	0xB3, 0xA7, 0x4E, 0x9D, 0x3A, 0x77, 0xFC, 0xF8, 0xF1, 0x85, 0x1C, 0xC7,
-	0x01, 0x00, 0x80, 0xDF, 0xEF, 0x0F, 0xDD, 0x30, 0x14, 0x12, 0xF2, 0x6B,
-	0xAC, 0x97, 0x64, 0xF8, 0x3E, 0xA4, 0x20, 0x92, 0x83, 0x06, 0x97, 0x09,
-	0x09, 0x09, 0x09, 0xA6, 0xF4, 0xF4, 0xF4, 0x59, 0x00, 0x30, 0xCB, 0xEB,
-	0xF5, 0xB6, 0xA4, 0xA6, 0xA6, 0xCE, 0x66, 0x18, 0xE6, 0x80, 0xCB, 0xE5,
-	0xAA, 0x76, 0x38, 0x1C, 0x55, 0x46, 0xA3, 0x11, 0x34, 0x1A, 0xCD, 0x98,
-	0x9E, 0x1B, 0x65, 0xEC, 0x61, 0x18, 0x06, 0x04, 0x41, 0x80, 0x81, 0x81,
-	0x01, 0x26, 0x3D, 0x3D, 0x3D, 0x77, 0xE1, 0xC2, 0x85, 0xA5, 0x93, 0x26,
-	0x4D, 0x5A, 0x91, 0x98, 0x98, 0xB8, 0x2A, 0x37, 0x37, 0x37, 0xB1, 0xA8,
-	0xA8, 0x08, 0x02, 0x81, 0x00, 0xF8, 0x7C, 0x3E, 0x60, 0x18, 0x06, 0x64,
-	0x32, 0x59, 0x68, 0x1C, 0x92, 0xD6, 0xCC, 0xCD, 0x70, 0x0D, 0xE0, 0xF8,
-	0x23, 0xC7, 0x9D, 0xCF, 0xE7, 0x0B, 0x8D, 0x7D, 0x86, 0x61, 0x20, 0x2B,
-	0x2B, 0x2B, 0x21, 0x3B, 0x3B, 0x3B, 0x41, 0x14, 0xC5, 0xF9, 0x27, 0x4F,
-	0x9E, 0x5C, 0x98, 0x9B, 0x9B, 0x7B, 0x68, 0x70, 0x70, 0xF0, 0x44, 0x4F,
-	0x4F, 0x4F, 0x75, 0x7F, 0x7F, 0x7F, 0x8D, 0x46, 0xA3, 0x91, 0xA2, 0x41,
-	0xB8, 0x6E, 0x3B, 0xC1, 0x22, 0x05, 0x40, 0x26, 0x93, 0x81, 0xDB, 0xED,
-	0xE6, 0xCC, 0x66, 0x73, 0x5E, 0x62, 0x62, 0xE2, 0xB4, 0x19, 0x33, 0x66,
-	0xAC, 0x9A, 0x33, 0x67, 0xCE, 0xBC, 0x94, 0x94, 0x14, 0x0B, 0x0A, 0x03,
-	0xCE, 0x60, 0x7E, 0xBF, 0x3F, 0x34, 0x40, 0xE4, 0x72, 0x79, 0x68, 0x46,
-	0x03, 0x80, 0x21, 0xEB, 0xF6, 0xD1, 0xF8, 0xB0, 0xAE, 0x06, 0xFA, 0x22,
-	0x24, 0x49, 0x82, 0x40, 0x20, 0x10, 0xF2, 0xA5, 0xE1, 0x0C, 0x1C, 0x08,
-	0x04, 0x86, 0x7C, 0xC9, 0xE5, 0x72, 0x28, 0x2F, 0x2F, 0xCF, 0x04, 0x80,
-	0x67, 0x6C, 0x36, 0xDB, 0x13, 0x39, 0x39, 0x39, 0x5F, 0x4E, 0x9F, 0x3E,
-	0xFD, 0x1D, 0xB7, 0xDB, 0x7D, 0x6A, 0x60, 0x60, 0xA0, 0xD5, 0xE3, 0xF1,
-	0x48, 0xE8, 0x1C, 0x0D, 0x04, 0x02, 0x51, 0x35, 0xEB, 0xDD, 0x69, 0xE0,
-	0x3D, 0xE4, 0x79, 0x1E, 0x94, 0x4A, 0x25, 0xB0, 0x2C, 0x0B, 0x3E, 0x9F,
-	0x4F, 0x69, 0x32, 0x99, 0xF2, 0x26, 0x4E, 0x9C, 0x38, 0x61, 0xE6, 0xCC,
-	0x99, 0x8B, 0x66, 0xCD, 0x9A, 0xB5, 0x28, 0x37, 0x37, 0x37, 0x9D, 0x61,
-	0x18, 0xF0, 0x7A, 0xBD, 0x20, 0x49, 0x12, 0x70, 0x1C, 0x17, 0xBA, 0x77,
-	0xE1, 0x63, 0x0F, 0x85, 0x83, 0xE3, 0xB8, 0x21, 0x16, 0xF9, 0x8D, 0x42,
-	0x8E, 0x6D, 0xB9, 0x5C, 0x1E, 0x72, 0xDA, 0xA3, 0x70, 0xE1, 0xEF, 0x31,
-	0xBA, 0xCB, 0xB2, 0x2C, 0x94, 0x97, 0x97, 0x97, 0x95, 0x97, 0x97, 0x97,
-	0xF5, 0xF5, 0xF5, 0x39, 0xF6, 0xEC, 0xD9, 0xB3, 0xD3, 0x6A, 0xB5, 0x7E,
-	0x24, 0x49, 0xD2, 0x71, 0x87, 0xC3, 0xD1, 0xCC, 0xF3, 0xBC, 0x9F, 0xE3,
-	0xB8, 0x90, 0x01, 0x70, 0xBB, 0x8D, 0xC3, 0xDB, 0x4A, 0xB0, 0x70, 0xA0,
-	0x04, 0x53, 0x1F, 0x64, 0x2E, 0x97, 0x2B, 0x46, 0xAB, 0xD5, 0x2E, 0x5E,
-	0xBA, 0x74, 0xE9, 0x43, 0x33, 0x67, 0xCE, 0x9C, 0x9A, 0x96, 0x96, 0x96,
-	0x28, 0x93, 0xC9, 0xC0, 0xE3, 0xF1, 0x80, 0xDF, 0xEF, 0x07, 0xA5, 0x52,
-	0x19, 0x32, 0xAD, 0x51, 0x40, 0xC8, 0x0B, 0x8C, 0x83, 0x82, 0x5C, 0xF3,
-	0x8F, 0x15, 0xA4, 0x39, 0x8E, 0x62, 0x29, 0x93, 0xC9, 0x42, 0x5F, 0x78,
-	0x3E, 0xB8, 0x8C, 0xF5, 0xFB, 0xFD, 0x40, 0x38, 0xEB, 0xE5, 0xAB, 0x57,
-	0xAF, 0xBE, 0x77, 0xFA, 0xF4, 0xE9, 0x73, 0xF6, 0xEC, 0xD9, 0xB3, 0x75,
-	0xDF, 0xBE, 0x7D, 0x9B, 0x6D, 0x36, 0x5B, 0x6D, 0x4F, 0x4F, 0x4F, 0x97,
-	0x5E, 0xAF, 0xF7, 0xAA, 0xD5, 0x6A, 0x08, 0x04, 0x02, 0x63, 0x76, 0xAE,
-	0x94, 0xD1, 0x21, 0x8A, 0x22, 0x70, 0x1C, 0x07, 0x1A, 0x8D, 0x06, 0xFC,
-	0x7E, 0x3F, 0xE7, 0x76, 0xBB, 0x8D, 0x0C, 0xC3, 0x2C, 0x99, 0x3F, 0x7F,
-	0xFE, 0x93, 0x33, 0x66, 0xCC, 0x28, 0x4B, 0x4E, 0x4E, 0xB6, 0xC8, 0x64,
-	0x32, 0xC6, 0xEF, 0xF7, 0x83, 0x20, 0x08, 0xC0, 0xB2, 0x6C, 0x48, 0x88,
-	0x94, 0x4A, 0x25, 0x00, 0x5C, 0x19, 0xCB, 0xA4, 0x70, 0x90, 0x93, 0xE8,
-	0x58, 0x80, 0xEF, 0x81, 0xCB, 0x4C, 0xD2, 0xA2, 0x0A, 0xB7, 0xEC, 0x14,
-	0x0A, 0x05, 0xF0, 0x3C, 0x0F, 0x82, 0x20, 0x00, 0xC7, 0x71, 0x20, 0x97,
-	0xCB, 0x21, 0x36, 0x36, 0x56, 0xBF, 0x7E, 0xFD, 0xFA, 0x75, 0x33, 0x66,
-	0xCC, 0x98, 0x7D, 0xFC, 0xF8, 0xF1, 0x03, 0x27, 0x4F, 0x9E, 0xDC, 0xE4,
-	0xF5, 0x7A, 0x0F, 0xB8, 0xDD, 0xEE, 0x5E, 0x83, 0xC1, 0xE0, 0x47, 0xD1,
-	0xBA, 0x9D, 0xB8, 0xAD, 0x04, 0x8B, 0x65, 0x59, 0x70, 0x3A, 0x9D, 0xB0,
-	0x77, 0xEF, 0x5E, 0x75, 0x4D, 0x4D, 0xCD, 0x82, 0x99, 0x33, 0x67, 0x3E,
-	0xB5, 0x64, 0xC9, 0x92, 0x79, 0x1C, 0xC7, 0xC5, 0xA8, 0xD5, 0x6A, 0x19,
-	0xC0, 0x95, 0xC1, 0xC4, 0x71, 0xDC, 0x10, 0x53, 0x18, 0x6F, 0x1A, 0x8A,
-	0x12, 0x29, 0x52, 0x78, 0xE3, 0xC6, 0x52, 0xB0, 0xC8, 0x41, 0x88, 0xCB,
-	0x52, 0xD2, 0x24, 0x47, 0x11, 0x53, 0x28, 0x14, 0xA0, 0xD7, 0xEB, 0x43,
-	0x7F, 0x83, 0xB3, 0x6C, 0x20, 0x10, 0x00, 0xA3, 0xD1, 0x68, 0x59, 0xB3,
-	0x66, 0xCD, 0x03, 0x4B, 0x97, 0x2E, 0x5D, 0x7E, 0xF8, 0xF0, 0xE1, 0xE3,
-	0x27, 0x4F, 0x9E, 0x7C, 0xB5, 0xA4, 0xA4, 0xE4, 0xEB, 0xFD, 0xFB, 0xF7,
-	0x7B, 0x5C, 0x2E, 0xD7, 0x98, 0x9D, 0x2B, 0x65, 0x74, 0x78, 0xBD, 0x5E,
-	0x88, 0x8F, 0x8F, 0x87, 0xB9, 0x73, 0xE7, 0xAA, 0xAB, 0xAA, 0xAA, 0x16,
-	0x75, 0x75, 0x75, 0x3D, 0x36, 0x69, 0xD2, 0xA4, 0xB9, 0x59, 0x59, 0x59,
-	0xF1, 0x66, 0xB3, 0x99, 0x25, 0xEF, 0x3D, 0xC0, 0xE5, 0x71, 0xE5, 0xF7,
-	0xFB, 0xC1, 0xEB, 0xF5, 0x82, 0x42, 0xA1, 0x18, 0xE2, 0x33, 0x45, 0x11,
-	0x01, 0xB8, 0x92, 0xF6, 0x20, 0x93, 0xC9, 0x40, 0xA1, 0x50, 0x8C, 0x89,
-	0x0F, 0x0B, 0x27, 0x48, 0x7C, 0xBF, 0xF0, 0x49, 0x1A, 0xBF, 0x27, 0x57,
-	0x1F, 0x28, 0x74, 0xF8, 0x37, 0xC9, 0xC9, 0xC9, 0x71, 0xCB, 0x97, 0x2F,
-	0x5F, 0x3B, 0x7B, 0xF6, 0xEC, 0x79, 0xC7, 0x8F, 0x1F, 0x3F, 0x7A, 0xE0,
-	0xC0, 0x81, 0x3F, 0xE4, 0xE5, 0xE5, 0xED, 0x3C, 0x74, 0xE8, 0x90, 0x87,
-	0xE7, 0x6F, 0xAF, 0x38, 0xD1, 0x6D, 0x25, 0x58, 0x00, 0xC0, 0x39, 0x9D,
-	0xCE, 0x59, 0x2C, 0xCB, 0xDE, 0xB7, 0x72, 0xE5, 0xCA, 0x45, 0x69, 0x69,
-	0x69, 0xB9, 0x46, 0xA3, 0x31, 0x74, 0x8E, 0x82, 0x20, 0x40, 0x20, 0x10,
-	0x08, 0x5D, 0x78, 0xF2, 0x67, 0x1C, 0xC7, 0x0D, 0x2B, 0x58, 0x28, 0x20,
-	0x00, 0x30, 0xA6, 0x4B, 0x42, 0x72, 0x26, 0x23, 0xDF, 0x07, 0xDF, 0x17,
-	0x2D, 0x3F, 0x9F, 0xCF, 0x07, 0x2A, 0x95, 0x0A, 0x18, 0x86, 0x01, 0xB7,
-	0xDB, 0x0D, 0xA2, 0x28, 0x86, 0x96, 0x19, 0xC1, 0x99, 0x8E, 0xD3, 0xEB,
-	0xF5, 0x71, 0x4B, 0x97, 0x2E, 0x5D, 0x31, 0x75, 0xEA, 0xD4, 0xBC, 0x9E,
-	0x9E, 0x9E, 0x35, 0xFB, 0xF6, 0xED, 0xDB, 0x1C, 0x08, 0x04, 0x76, 0x01,
-	0x80, 0x30, 0x26, 0x27, 0x4B, 0x19, 0x15, 0x81, 0x40, 0x40, 0xEE, 0xF7,
-	0xFB, 0xE7, 0xA4, 0xA7, 0xA7, 0x6F, 0x9C, 0x3A, 0x75, 0xEA, 0x02, 0x85,
-	0x42, 0x91, 0x63, 0x32, 0x99, 0x14, 0x6A, 0xB5, 0x1A, 0x24, 0x49, 0x02,
-	0xB7, 0xDB, 0x0D, 0x0C, 0xC3, 0x80, 0x52, 0xA9, 0x1C, 0xB2, 0xE4, 0x53,
-	0xAB, 0xD5, 0xA1, 0x71, 0x41, 0xA6, 0xDC, 0xE0, 0xB8, 0x24, 0xBF, 0xC6,
-	0x62, 0x49, 0xC8, 0x30, 0x4C, 0xC8, 0xE5, 0x80, 0x63, 0x31, 0xFC, 0x7D,
-	0x82, 0x9F, 0x07, 0x3C, 0x1E, 0x0F, 0x28, 0x95, 0x4A, 0xC0, 0x15, 0x8A,
-	0x24, 0x49, 0xA0, 0x52, 0xA9, 0x40, 0x14, 0x45, 0x10, 0x04, 0x01, 0xD4,
-	0x6A, 0xB5, 0x5C, 0xA3, 0xD1, 0x58, 0x16, 0x2D, 0x5A, 0xB4, 0x32, 0x3F,
-	0x3F, 0x3F, 0xE7, 0xE2, 0xC5, 0x8B, 0x3B, 0xF6, 0xED, 0xDB, 0xF7, 0xBE,
-	0x24, 0x49, 0x47, 0x00, 0xE0, 0xB6, 0xC9, 0xC9, 0xB9, 0x6D, 0x04, 0xCB,
-	0xE9, 0x74, 0x26, 0xE6, 0xE5, 0xE5, 0xAD, 0x9B, 0x3E, 0x7D, 0xFA, 0xC6,
-	0x29, 0x53, 0xA6, 0xCC, 0x88, 0x8F, 0x8F, 0x57, 0x91, 0x33, 0xD2, 0x48,
-	0xCE, 0x4B, 0xD2, 0xDF, 0x45, 0xFA, 0x06, 0xC8, 0x81, 0x71, 0x33, 0x96,
-	0x84, 0xE1, 0xC7, 0x47, 0x3F, 0x42, 0xF8, 0xCF, 0x65, 0x32, 0x59, 0x68,
-	0x40, 0x29, 0x14, 0x8A, 0xD0, 0x52, 0x0F, 0x07, 0x18, 0x46, 0x1B, 0x55,
-	0x2A, 0x15, 0x9B, 0x94, 0x94, 0x94, 0xAF, 0x54, 0x2A, 0x73, 0x1E, 0x7A,
-	0xE8, 0xA1, 0x92, 0xDE, 0xDE, 0xDE, 0x19, 0x5F, 0x7C, 0xF1, 0xC5, 0x67,
-	0x1E, 0x8F, 0xA7, 0x62, 0xCC, 0x4E, 0x9A, 0x72, 0x55, 0x3C, 0x1E, 0x0F,
-	0xF4, 0xF7, 0xF7, 0x97, 0xCE, 0x9C, 0x39, 0xF3, 0x9E, 0x79, 0xF3, 0xE6,
-	0xAD, 0xC8, 0xC9, 0xC9, 0x99, 0x14, 0x1B, 0x1B, 0xAB, 0x04, 0x00, 0x70,
-	0xBB, 0xDD, 0xC0, 0xF3, 0x7C, 0xC8, 0xBA, 0x0F, 0xBF, 0xD7, 0x38, 0x3E,
-	0x49, 0xA7, 0x7B, 0xF8, 0x64, 0x46, 0x8A, 0xCA, 0x58, 0x08, 0x16, 0xE9,
-	0x97, 0x1D, 0x4E, 0xA8, 0xC8, 0x67, 0x44, 0xA1, 0x50, 0x0C, 0xF1, 0x4B,
-	0xB1, 0x2C, 0x8B, 0xB9, 0x63, 0x20, 0x97, 0xCB, 0x43, 0x4B, 0x5B, 0xB5,
-	0x5A, 0xCD, 0xE4, 0xE7, 0xE7, 0x17, 0x1A, 0x0C, 0x86, 0x8C, 0x47, 0x1E,
-	0x79, 0x64, 0x7C, 0x65, 0x65, 0xE5, 0x87, 0x0E, 0x87, 0xE3, 0x13, 0x00,
-	0xE8, 0xBC, 0xE1, 0x13, 0x1E, 0x03, 0x6E, 0x99, 0x60, 0xE1, 0x4D, 0x73,
-	0xB9, 0x5C, 0x8C, 0xD3, 0xE9, 0x2C, 0x99, 0x34, 0x69, 0xD2, 0xC3, 0xB9,
-	0xB9, 0xB9, 0xF7, 0x97, 0x96, 0x96, 0x66, 0x01, 0x5C, 0xB1, 0x9C, 0x64,
-	0x32, 0x59, 0xE8, 0x06, 0x0C, 0x17, 0xF1, 0xBB, 0x56, 0x78, 0x98, 0xBC,
-	0x81, 0x00, 0x57, 0xF7, 0x67, 0x91, 0xC2, 0x13, 0x2E, 0x7C, 0xC3, 0x11,
-	0x9E, 0x4B, 0x43, 0x5A, 0x6F, 0x28, 0x4C, 0x1C, 0xC7, 0x85, 0x06, 0x09,
-	0xE9, 0xD7, 0x0A, 0x17, 0x52, 0x41, 0x10, 0x40, 0x14, 0x45, 0x88, 0x89,
-	0x89, 0x91, 0xCD, 0x9A, 0x35, 0x6B, 0x6A, 0x4F, 0x4F, 0xCF, 0x38, 0x41,
-	0x10, 0xCA, 0x2E, 0x5C, 0xB8, 0xF0, 0x79, 0x53, 0x53, 0xD3, 0x2E, 0x9B,
-	0xCD, 0xD6, 0xAC, 0xD1, 0x68, 0x6E, 0x3B, 0x27, 0xE8, 0x9D, 0x40, 0x20,
-	0x10, 0x00, 0xAF, 0xD7, 0x9B, 0x35, 0x67, 0xCE, 0x9C, 0x05, 0xA5, 0xA5,
-	0xA5, 0xAB, 0x67, 0xCF, 0x9E, 0xBD, 0x28, 0x31, 0x31, 0xD1, 0x00, 0x00,
-	0x21, 0x57, 0x03, 0x4E, 0x88, 0xB8, 0xA4, 0x47, 0xC8, 0xF1, 0x48, 0x8E,
-	0x1F, 0xFC, 0x1D, 0xF9, 0xF3, 0xE1, 0x26, 0x53, 0x64, 0x34, 0x79, 0x59,
-	0xA4, 0x20, 0x91, 0x4B, 0x42, 0x12, 0xF2, 0x78, 0x2C, 0xCB, 0x82, 0x4A,
-	0xA5, 0x02, 0x0C, 0xEA, 0xA0, 0xE0, 0xE2, 0x18, 0xC5, 0x89, 0x14, 0x83,
-	0x58, 0x7E, 0xBF, 0x1F, 0x12, 0x13, 0x13, 0xD5, 0xCB, 0x97, 0x2F, 0x5F,
-	0x90, 0x99, 0x99, 0x99, 0x73, 0xEE, 0xDC, 0xB9, 0x8C, 0xE3, 0xC7, 0x8F,
-	0xBF, 0xEB, 0x72, 0xB9, 0xAA, 0x4D, 0x26, 0xD3, 0x2D, 0x1D, 0x83, 0xB7,
-	0x44, 0xB0, 0x18, 0x86, 0x01, 0x9E, 0xE7, 0xC1, 0xEF, 0xF7, 0x1B, 0xC6,
-	0x8D, 0x1B, 0xB7, 0xB0, 0xB0, 0xB0, 0xF0, 0xA1, 0xD9, 0xB3, 0x67, 0xAF,
-	0x88, 0x8D, 0x8D, 0xD5, 0x0B, 0x82, 0x10, 0x7A, 0x8D, 0x4A, 0xA5, 0x02,
-	0x80, 0x6F, 0x3A, 0xCF, 0x49, 0xC2, 0x6F, 0xF4, 0xD5, 0x2E, 0x66, 0xF8,
-	0xDF, 0x87, 0x1F, 0x77, 0x38, 0x31, 0x43, 0xB1, 0xC1, 0x01, 0x36, 0x5C,
-	0x09, 0xC5, 0x70, 0xEF, 0x49, 0x0E, 0xA4, 0xF0, 0x01, 0x15, 0xBE, 0x2C,
-	0x45, 0x7F, 0x17, 0x2E, 0x31, 0x04, 0x41, 0x80, 0xF8, 0xF8, 0x78, 0xED,
-	0xC6, 0x8D, 0x1B, 0xD7, 0x5C, 0xBC, 0x78, 0x71, 0xCA, 0xA7, 0x9F, 0x7E,
-	0x3A, 0xA1, 0xB7, 0xB7, 0xF7, 0x83, 0x9E, 0x9E, 0x9E, 0x2A, 0x97, 0xCB,
-	0xE5, 0xA0, 0x59, 0xF3, 0x37, 0x0E, 0x4E, 0x12, 0x4E, 0xA7, 0x53, 0xE3,
-	0xF7, 0xFB, 0x4B, 0x32, 0x33, 0x33, 0x1F, 0x5B, 0xBD, 0x7A, 0xF5, 0x86,
-	0x9C, 0x9C, 0x9C, 0x04, 0x80, 0xCB, 0x13, 0xA6, 0x5C, 0x2E, 0x0F, 0x4D,
-	0x88, 0xF8, 0x90, 0x0F, 0x77, 0x1C, 0xF2, 0xE7, 0xE8, 0x74, 0x0F, 0x7F,
-	0x4D, 0xF8, 0xEA, 0x80, 0x74, 0x66, 0x87, 0x8F, 0x87, 0xF0, 0x4C, 0xF4,
-	0xF0, 0xA8, 0x62, 0xB8, 0x25, 0x35, 0xD2, 0xE7, 0x0B, 0x87, 0x14, 0x5A,
-	0x80, 0xA1, 0xE3, 0x12, 0xBF, 0xC7, 0xF7, 0xC2, 0xE8, 0x7B, 0x7E, 0x7E,
-	0x7E, 0x7A, 0x7C, 0x7C, 0xFC, 0xF7, 0x9D, 0x4E, 0x67, 0x76, 0x5B, 0x5B,
-	0xDB, 0xBB, 0x03, 0x03, 0x03, 0xBB, 0x78, 0x9E, 0xB7, 0xDF, 0x2A, 0xD1,
-	0xBA, 0x25, 0x82, 0x15, 0x14, 0xA5, 0xB4, 0xF1, 0xE3, 0xC7, 0x6F, 0x5C,
-	0xBD, 0x7A, 0xF5, 0x53, 0x93, 0x27, 0x4F, 0x1E, 0xCF, 0xB2, 0x2C, 0xD8,
-	0xED, 0x76, 0x90, 0xCB, 0xE5, 0xA0, 0xD5, 0x6A, 0xBF, 0x61, 0xD6, 0x8E,
-	0x05, 0xC3, 0x0D, 0x82, 0xE1, 0x66, 0x36, 0x72, 0x79, 0x47, 0x3A, 0xD2,
-	0xC9, 0x9F, 0x87, 0x1F, 0xEF, 0x46, 0xCF, 0x8B, 0x1C, 0xB4, 0x18, 0x44,
-	0x90, 0xCB, 0xE5, 0x90, 0x92, 0x92, 0x92, 0xF4, 0xF8, 0xE3, 0x8F, 0x7F,
-	0x77, 0xE6, 0xCC, 0x99, 0xB3, 0x37, 0x6D, 0xDA, 0xF4, 0x46, 0x63, 0x63,
-	0xE3, 0x17, 0xA2, 0x28, 0x36, 0xD3, 0x28, 0xE2, 0x8D, 0xC1, 0xF3, 0x3C,
-	0x68, 0xB5, 0xDA, 0x64, 0xB3, 0xD9, 0xBC, 0x2A, 0x3E, 0x3E, 0xFE, 0xB9,
-	0x71, 0xE3, 0xC6, 0x4D, 0xD4, 0xE9, 0x74, 0x32, 0x80, 0xD0, 0xF8, 0x0C,
-	0x31, 0xD6, 0x2E, 0x05, 0x32, 0xB2, 0x37, 0x5C, 0x40, 0x08, 0xD3, 0x10,
-	0xC8, 0xA4, 0xE4, 0x70, 0x8B, 0x69, 0x2C, 0xCF, 0x87, 0x7C, 0x5F, 0xB4,
-	0xDA, 0x00, 0x00, 0x5C, 0x2E, 0x17, 0x30, 0x0C, 0x03, 0x66, 0xB3, 0x59,
-	0xB7, 0x71, 0xE3, 0xC6, 0x0D, 0xB9, 0xB9, 0xB9, 0xE3, 0x3F, 0xFF, 0xFC,
-	0xF3, 0x57, 0x02, 0x81, 0xC0, 0x87, 0x82, 0x20, 0x5C, 0x1A, 0xD3, 0x37,
-	0x8F, 0x90, 0x6F, 0x5D, 0xB0, 0x82, 0x49, 0x6D, 0xE3, 0x0B, 0x0B, 0x0B,
-	0x7F, 0xB4, 0x64, 0xC9, 0x92, 0x0D, 0x46, 0xA3, 0x51, 0x8F, 0x22, 0x80,
-	0xD1, 0x34, 0x32, 0x8F, 0xE4, 0x5A, 0x33, 0xC9, 0x68, 0x08, 0x37, 0xC9,
-	0xC3, 0x07, 0x09, 0x8A, 0x92, 0xDF, 0xEF, 0x0F, 0xAD, 0xFB, 0xC3, 0xCD,
-	0xF7, 0x70, 0xD1, 0x1A, 0x0B, 0x70, 0xB9, 0x81, 0xC8, 0xE5, 0xF2, 0x21,
-	0x11, 0x25, 0x93, 0xC9, 0xC4, 0x4D, 0x9E, 0x3C, 0x79, 0x62, 0x66, 0x66,
-	0xE6, 0xDF, 0x6F, 0xDF, 0xBE, 0x7D, 0x5A, 0x73, 0x73, 0xF3, 0xEF, 0x5B,
-	0x5B, 0x5B, 0x8F, 0x05, 0x02, 0x01, 0xEA, 0x94, 0x1F, 0x25, 0x41, 0x27,
-	0xB5, 0x5C, 0x10, 0x84, 0x89, 0x73, 0xE6, 0xCC, 0x79, 0x7E, 0xF1, 0xE2,
-	0xC5, 0x6B, 0xE2, 0xE3, 0xE3, 0xE3, 0x31, 0x2D, 0x01, 0x2D, 0x0B, 0x4C,
-	0x41, 0x41, 0xFF, 0xD4, 0x58, 0x81, 0xC7, 0x43, 0x6B, 0x87, 0x1C, 0xEB,
-	0xE4, 0x6B, 0xC8, 0x00, 0x0E, 0xFA, 0xC7, 0x46, 0x5A, 0x21, 0x8C, 0xA5,
-	0x90, 0x8A, 0xA2, 0x18, 0x72, 0x5D, 0xA0, 0xE1, 0x80, 0xEF, 0x53, 0x56,
-	0x56, 0x56, 0x98, 0x9B, 0x9B, 0xFB, 0x8F, 0x5B, 0xB6, 0x6C, 0x29, 0xEA,
-	0xE8, 0xE8, 0xF8, 0x6F, 0x51, 0x14, 0xCF, 0x8C, 0xC9, 0x1B, 0x8F, 0x82,
-	0x6F, 0x5D, 0xB0, 0x7C, 0x3E, 0xDF, 0xE4, 0x8C, 0x8C, 0x8C, 0xBF, 0x5A,
-	0xB8, 0x70, 0xE1, 0xBA, 0xB8, 0xB8, 0x38, 0x8D, 0xD7, 0xEB, 0x05, 0x8F,
-	0xC7, 0x03, 0x5A, 0xAD, 0x16, 0x58, 0x96, 0x05, 0x9E, 0xE7, 0x87, 0x98,
-	0xE2, 0x00, 0x63, 0x77, 0x43, 0x30, 0xA2, 0x42, 0x66, 0xC0, 0x93, 0xD6,
-	0x12, 0x0E, 0xCC, 0x91, 0x66, 0xB6, 0x70, 0xD1, 0x1A, 0xCB, 0x81, 0x0C,
-	0x30, 0xD4, 0x5F, 0x82, 0x4E, 0x51, 0x4C, 0x4A, 0x0D, 0xE6, 0xCD, 0x58,
-	0xD6, 0xAE, 0x5D, 0xBB, 0xBE, 0xAB, 0xAB, 0xAB, 0xE4, 0xE3, 0x8F, 0x3F,
-	0x7E, 0xB7, 0xA9, 0xA9, 0xE9, 0x35, 0x51, 0x14, 0x7B, 0xC7, 0xF4, 0x24,
-	0xEE, 0x60, 0x82, 0x42, 0x60, 0xF6, 0xF9, 0x7C, 0x8F, 0x94, 0x95, 0x95,
-	0x3D, 0x12, 0x1B, 0x1B, 0x5B, 0x6A, 0x32, 0x99, 0x34, 0x98, 0xA1, 0x0E,
-	0x00, 0x21, 0x9F, 0x29, 0x5E, 0x7F, 0x4C, 0x5F, 0xB8, 0xD1, 0x31, 0x38,
-	0x52, 0x9A, 0xC1, 0x70, 0x63, 0x3C, 0x7C, 0x42, 0x25, 0xFF, 0x25, 0xF3,
-	0xBA, 0xD0, 0xC7, 0x1B, 0x49, 0x41, 0x75, 0x24, 0xE7, 0x4F, 0x3E, 0x0F,
-	0x98, 0x0C, 0x8B, 0x11, 0x6D, 0x74, 0xCA, 0xC7, 0xC4, 0xC4, 0xE8, 0x97,
-	0x2D, 0x5B, 0xF6, 0xF0, 0xBE, 0x7D, 0xFB, 0x74, 0xBD, 0xBD, 0xBD, 0xFF,
-	0xA9, 0xD7, 0xEB, 0x4F, 0x44, 0x7E, 0x15, 0x6E, 0x9C, 0x6F, 0x4D, 0xB0,
-	0x24, 0x49, 0x02, 0xAF, 0xD7, 0xBB, 0x30, 0x3F, 0x3F, 0xFF, 0x2F, 0x4B,
-	0x4A, 0x4A, 0x16, 0xC7, 0xC4, 0xC4, 0x68, 0xAC, 0x56, 0x6B, 0xA8, 0x67,
-	0x96, 0x24, 0x49, 0xC0, 0xF3, 0x7C, 0xE8, 0x46, 0xA1, 0x95, 0x33, 0x96,
-	0xA2, 0x80, 0x03, 0x0F, 0x6F, 0x8A, 0xDF, 0xEF, 0x07, 0x80, 0x2B, 0x03,
-	0x84, 0x8C, 0xB6, 0x00, 0x5C, 0x71, 0xFC, 0x93, 0x22, 0x32, 0xD6, 0xCB,
-	0x41, 0x80, 0x6F, 0xFA, 0x28, 0x86, 0xCB, 0x21, 0xC3, 0xD7, 0x68, 0x34,
-	0x1A, 0x55, 0x56, 0x56, 0x56, 0xC9, 0xC6, 0x8D, 0x1B, 0x5F, 0x4C, 0x4F,
-	0x4F, 0x2F, 0x6A, 0x68, 0x68, 0xF8, 0xA3, 0xD7, 0xEB, 0x3D, 0x48, 0x9D,
-	0xF1, 0x23, 0xC3, 0x30, 0x97, 0xB3, 0xD1, 0x19, 0x86, 0x99, 0xF5, 0xDD,
-	0xEF, 0x7E, 0xF7, 0x99, 0x89, 0x13, 0x27, 0x2E, 0x4A, 0x4C, 0x4C, 0x4C,
-	0x27, 0xFD, 0x4D, 0x78, 0x9D, 0x87, 0x8B, 0xE2, 0xDD, 0xE8, 0xC4, 0x39,
-	0x9C, 0x0F, 0x96, 0x7C, 0x9F, 0xF0, 0x2E, 0x0A, 0xE1, 0x11, 0x46, 0x9C,
-	0xB4, 0xC8, 0x89, 0x32, 0x7C, 0x3C, 0x8E, 0x05, 0x78, 0x2C, 0x9C, 0x20,
-	0xF1, 0x99, 0x64, 0x59, 0x16, 0x94, 0x4A, 0x25, 0xF8, 0x7C, 0x3E, 0xB0,
-	0xD9, 0x6C, 0x60, 0xB1, 0x58, 0xB4, 0xF3, 0xE7, 0xCF, 0x5F, 0x57, 0x53,
-	0x53, 0xA3, 0x69, 0x6F, 0x6F, 0xFF, 0x4F, 0x8E, 0xE3, 0xF6, 0x8D, 0xD9,
-	0x49, 0x5C, 0x83, 0x6F, 0x45, 0xB0, 0x82, 0x8E, 0xE4, 0xB9, 0x19, 0x19,
-	0x19, 0x3F, 0x2B, 0x2D, 0x2D, 0x5D, 0x6A, 0x32, 0x99, 0xC0, 0xEB, 0xF5,
-	0x86, 0x92, 0x2E, 0x49, 0x53, 0x14, 0x13, 0xEA, 0xB0, 0x16, 0x6A, 0xAC,
-	0x42, 0xC0, 0x00, 0x97, 0x05, 0x0A, 0x85, 0x10, 0x60, 0xE4, 0xFC, 0x18,
-	0x52, 0x94, 0x30, 0xD1, 0x8E, 0xCC, 0xAF, 0x41, 0x2B, 0x6D, 0xAC, 0x2B,
-	0xDE, 0x71, 0x90, 0x60, 0xA4, 0x06, 0xDF, 0x9F, 0x14, 0x2D, 0x9C, 0xE9,
-	0xB2, 0xB2, 0xB2, 0x12, 0x92, 0x93, 0x93, 0x1F, 0x3F, 0x71, 0xE2, 0x44,
-	0x72, 0x5F, 0x5F, 0xDF, 0x9F, 0xAC, 0x56, 0xEB, 0xC7, 0x3C, 0xCF, 0x3B,
-	0xA3, 0xB5, 0x0A, 0xFF, 0x66, 0x80, 0x42, 0xD5, 0xD7, 0xD7, 0xA7, 0x52,
-	0x2A, 0x95, 0xF7, 0x2D, 0x5A, 0xB4, 0xE8, 0x89, 0xE9, 0xD3, 0xA7, 0x2F,
-	0x91, 0xCB, 0xE5, 0xE0, 0xF5, 0x7A, 0x87, 0x8C, 0x31, 0x80, 0xD0, 0x38,
-	0x0D, 0x59, 0x3F, 0x78, 0xED, 0xC7, 0x3A, 0xC8, 0x11, 0xEE, 0xEE, 0xC0,
-	0xF1, 0x15, 0x1E, 0x65, 0xC4, 0xCF, 0x40, 0xFE, 0x4B, 0xE6, 0x77, 0xE1,
-	0x33, 0x33, 0x9A, 0x96, 0x35, 0x91, 0x9E, 0x1B, 0x2E, 0x89, 0x31, 0x9A,
-	0x88, 0x91, 0x46, 0x5C, 0xA5, 0x58, 0x2C, 0x16, 0xD5, 0xC4, 0x89, 0x13,
-	0xD7, 0x70, 0x1C, 0xA7, 0xEC, 0xEA, 0xEA, 0x62, 0x94, 0x4A, 0xE5, 0xDE,
-	0x31, 0x3B, 0x89, 0xAB, 0x70, 0xD3, 0x05, 0x2B, 0x38, 0x3B, 0x2C, 0x48,
-	0x4D, 0x4D, 0xFD, 0xFB, 0xE2, 0xE2, 0xE2, 0xF9, 0x46, 0xA3, 0x11, 0x04,
-	0x41, 0x00, 0x99, 0x4C, 0x06, 0x7A, 0xBD, 0x3E, 0x64, 0xC5, 0xE0, 0x05,
-	0xF2, 0x7A, 0xBD, 0xC0, 0x71, 0x1C, 0x28, 0x14, 0x8A, 0x50, 0xA8, 0x7F,
-	0xAC, 0x6E, 0x08, 0x29, 0x36, 0x64, 0x46, 0x32, 0x09, 0x0E, 0x0C, 0x32,
-	0xB9, 0x8E, 0x7C, 0xDD, 0xCD, 0x2A, 0xA4, 0x0E, 0x1F, 0xC0, 0xA4, 0xA5,
-	0x47, 0xFA, 0x38, 0xE4, 0x72, 0x79, 0xA8, 0xEA, 0x9F, 0x65, 0x59, 0x98,
-	0x35, 0x6B, 0xD6, 0xE2, 0x86, 0x86, 0x86, 0xBC, 0x69, 0xD3, 0xA6, 0x25,
-	0xD7, 0xD4, 0xD4, 0x7C, 0xD2, 0xD0, 0xD0, 0x70, 0xDE, 0xEF, 0xF7, 0x8B,
-	0x63, 0x39, 0x88, 0xA3, 0x11, 0x41, 0x10, 0xC0, 0x6A, 0xB5, 0x42, 0x56,
-	0x56, 0x56, 0xFE, 0xC4, 0x89, 0x13, 0xEF, 0x29, 0x28, 0x28, 0x78, 0xBE,
-	0xA0, 0xA0, 0x20, 0x1B, 0x00, 0x42, 0x65, 0x52, 0x78, 0x1D, 0xD1, 0xF2,
-	0x1E, 0x2E, 0xFD, 0x00, 0x00, 0x42, 0x63, 0xE6, 0x46, 0xAC, 0x99, 0xE1,
-	0x7C, 0xA0, 0xC3, 0x8D, 0x3F, 0xA7, 0xD3, 0x09, 0x81, 0x40, 0x20, 0x14,
-	0x21, 0x07, 0xF8, 0x66, 0x94, 0x19, 0x27, 0x2E, 0x52, 0xBC, 0xAE, 0x35,
-	0x26, 0x23, 0x39, 0x77, 0x9C, 0xD0, 0xD1, 0x9F, 0xE7, 0xF3, 0xF9, 0x42,
-	0x1D, 0x67, 0x71, 0xA5, 0xA1, 0xD5, 0x6A, 0x01, 0xE0, 0x72, 0x5E, 0x9A,
-	0xC1, 0x60, 0x60, 0x27, 0x4C, 0x98, 0xB0, 0x5C, 0x2E, 0x97, 0x6B, 0xFA,
-	0xFB, 0xFB, 0x7F, 0x11, 0x08, 0x04, 0xF6, 0x5F, 0xF3, 0x4D, 0x6E, 0x90,
-	0x9B, 0x3A, 0xAA, 0x03, 0x81, 0x00, 0x23, 0x8A, 0xE2, 0xAC, 0xB8, 0xB8,
-	0xB8, 0x7F, 0x9D, 0x30, 0x61, 0xC2, 0x54, 0x9C, 0xF1, 0xB0, 0x34, 0x85,
-	0x2C, 0x5F, 0x91, 0xC9, 0x64, 0x80, 0xFE, 0x2C, 0xBC, 0x99, 0x64, 0x92,
-	0xE5, 0x58, 0x88, 0x84, 0x52, 0xA9, 0x04, 0xA5, 0x52, 0x09, 0x6E, 0xB7,
-	0x1B, 0xDC, 0x6E, 0xB7, 0x8F, 0xE7, 0x79, 0x97, 0x20, 0x08, 0x1E, 0x9F,
-	0xCF, 0xE7, 0xE1, 0x79, 0xDE, 0xE3, 0xF1, 0x78, 0x3C, 0x7E, 0xBF, 0xDF,
-	0x63, 0x30, 0x18, 0x84, 0xD8, 0xD8, 0x58, 0x49, 0x2E, 0x97, 0x33, 0xDD,
-	0xDD, 0xDD, 0xAC, 0xD5, 0x6A, 0x55, 0xC8, 0x64, 0x32, 0xBD, 0x56, 0xAB,
-	0x8D, 0x35, 0x1A, 0x8D, 0x66, 0xB5, 0x5A, 0xAD, 0xD1, 0xE9, 0x46, 0x6C,
-	0x75, 0x34, 0x6A, 0x48, 0x41, 0xC2, 0xB2, 0x8D, 0xF0, 0xD2, 0x0D, 0x5C,
-	0x1A, 0x90, 0x8E, 0x58, 0x41, 0x10, 0xC0, 0xED, 0x76, 0x43, 0x41, 0x41,
-	0x41, 0x46, 0x7A, 0x7A, 0xFA, 0x2F, 0xBF, 0xFE, 0xFA, 0xEB, 0x09, 0xEF,
-	0xBC, 0xF3, 0xCE, 0xEB, 0xDD, 0xDD, 0xDD, 0xC7, 0x7D, 0x3E, 0x9F, 0x0D,
-	0x27, 0x81, 0xBB, 0x09, 0x0C, 0x9A, 0xA8, 0x54, 0x2A, 0x4D, 0x4A, 0x4A,
-	0xCA, 0xA4, 0xC7, 0x1E, 0x7B, 0xEC, 0xF9, 0x35, 0x6B, 0xD6, 0x3C, 0x20,
-	0x93, 0xC9, 0xE4, 0x2E, 0x97, 0x0B, 0x94, 0x4A, 0x25, 0x28, 0x14, 0x0A,
-	0xEC, 0x4E, 0x0B, 0x1C, 0xC7, 0x0D, 0xBB, 0x1C, 0x44, 0x31, 0x20, 0x85,
-	0xEC, 0x7A, 0xCF, 0x07, 0xE0, 0x9B, 0xE9, 0x0F, 0x76, 0xBB, 0x5D, 0x72,
-	0xBB, 0xDD, 0x4E, 0x8F, 0xC7, 0x33, 0xE8, 0xF7, 0xFB, 0x5D, 0x3E, 0x9F,
-	0xCF, 0xA5, 0xD5, 0x6A, 0x9D, 0x7A, 0xBD, 0x9E, 0x1F, 0x18, 0x18, 0x80,
-	0xFE, 0xFE, 0x7E, 0xCE, 0xE7, 0xF3, 0xC9, 0x95, 0x4A, 0x25, 0xA7, 0x52,
-	0xA9, 0x34, 0x4A, 0xA5, 0x52, 0x2D, 0x97, 0xCB, 0x55, 0x1C, 0xC7, 0xA9,
-	0x39, 0x8E, 0xD3, 0xA8, 0x54, 0x2A, 0x15, 0x8A, 0x07, 0x1E, 0xFF, 0x46,
-	0xCE, 0x13, 0x00, 0x42, 0xDD, 0x26, 0xC2, 0x8D, 0x07, 0xBC, 0x3E, 0xE4,
-	0xD2, 0x54, 0xAD, 0x56, 0x87, 0xEA, 0x79, 0x4B, 0x4B, 0x4B, 0xE7, 0x9E,
-	0x39, 0x73, 0xE6, 0xFF, 0xB5, 0xB5, 0xB5, 0xFD, 0x1F, 0x9F, 0xCF, 0x77,
-	0x44, 0x10, 0x04, 0x3F, 0x96, 0xCE, 0x85, 0x07, 0xAD, 0x6E, 0x94, 0x9B,
-	0x26, 0x58, 0x92, 0x24, 0xB1, 0x92, 0x24, 0x4D, 0x8B, 0x8B, 0x8B, 0xFB,
-	0xC5, 0xF8, 0xF1, 0xE3, 0xA7, 0x28, 0x95, 0x4A, 0xF0, 0x78, 0x3C, 0xF8,
-	0xBB, 0x21, 0x0F, 0xA4, 0xDF, 0xEF, 0x0F, 0xCD, 0x2A, 0x1C, 0xC7, 0x81,
-	0xCF, 0xE7, 0x03, 0xAF, 0xD7, 0x0B, 0x1A, 0x8D, 0xE6, 0xAA, 0x35, 0x57,
-	0xC3, 0xA5, 0x3E, 0x84, 0x9B, 0xD4, 0x00, 0xA1, 0x1B, 0x21, 0xF8, 0xFD,
-	0x7E, 0x8F, 0xC7, 0xE3, 0x71, 0xF4, 0xF4, 0xF4, 0x74, 0x9E, 0xBB, 0x4C,
-	0x7D, 0x6B, 0x6B, 0x6B, 0x4B, 0x77, 0x77, 0x77, 0x97, 0xD3, 0xE9, 0x1C,
-	0xB0, 0xD9, 0x6C, 0x76, 0x00, 0x70, 0xAD, 0x5E, 0xBD, 0x9A, 0x7F, 0xEE,
-	0xB9, 0xE7, 0xFC, 0x46, 0xA3, 0x11, 0x76, 0xEC, 0xD8, 0x01, 0x7F, 0xFA,
-	0xD3, 0x9F, 0xB4, 0x82, 0x20, 0x64, 0xE4, 0xE6, 0xE6, 0x96, 0x4C, 0x9A,
-	0x34, 0xA9, 0x2C, 0x3F, 0x3F, 0x3F, 0x3F, 0x33, 0x33, 0x33, 0xC7, 0x64,
-	0x32, 0xC5, 0x71, 0x1C, 0xA7, 0xE2, 0x38, 0xEE, 0x1B, 0x53, 0xE5, 0x68,
-	0xFC, 0x1E, 0xE4, 0x0C, 0x1F, 0x9E, 0xF7, 0x45, 0x1E, 0x07, 0xAF, 0x05,
-	0x5A, 0x8A, 0x0C, 0xC3, 0x00, 0x26, 0x93, 0x72, 0x1C, 0xA7, 0x5C, 0xB3,
-	0x66, 0xCD, 0xC6, 0xA4, 0xA4, 0xA4, 0x8C, 0x3F, 0xFC, 0xE1, 0x0F, 0xBF,
-	0x39, 0x72, 0xE4, 0xC8, 0xD7, 0x3C, 0xCF, 0x3B, 0x6E, 0xB7, 0xE2, 0xD5,
-	0x9B, 0x09, 0x2E, 0xE9, 0x74, 0x3A, 0x9D, 0x61, 0xC2, 0x84, 0x09, 0xCB,
-	0x9F, 0x78, 0xE2, 0x89, 0x17, 0xCB, 0xCB, 0xCB, 0xA7, 0xCA, 0x83, 0xE6,
-	0x26, 0x96, 0x48, 0x91, 0xEE, 0x07, 0x72, 0xA9, 0x05, 0xF0, 0xCD, 0x08,
-	0x75, 0xA4, 0x4E, 0xED, 0x91, 0x20, 0xFD, 0xA5, 0x3E, 0x9F, 0x4F, 0x14,
-	0x45, 0x91, 0xB7, 0xDB, 0xED, 0x5D, 0xCD, 0xCD, 0xCD, 0xE7, 0xCE, 0x9E,
-	0x3D, 0x5B, 0x5F, 0x57, 0x57, 0x77, 0xBA, 0xA5, 0xA5, 0xA5, 0xDE, 0x66,
-	0xB3, 0x5D, 0x7A, 0xEC, 0xB1, 0xC7, 0x6C, 0x8F, 0x3F, 0xFE, 0xB8, 0xD8,
-	0xD4, 0xD4, 0x04, 0x2F, 0xBD, 0xF4, 0x92, 0xAC, 0xB2, 0xB2, 0x52, 0x11,
-	0x13, 0x13, 0xA3, 0xD2, 0x6A, 0xB5, 0x06, 0x95, 0x4A, 0x15, 0x9B, 0x94,
-	0x94, 0x94, 0x94, 0x9E, 0x9E, 0x9E, 0x99, 0x9B, 0x9B, 0x5B, 0x90, 0x97,
-	0x97, 0x57, 0x10, 0x1B, 0x1B, 0x9B, 0xA4, 0xD1, 0x68, 0x4C, 0x1C, 0xC7,
-	0x69, 0x38, 0x8E, 0x53, 0x0C, 0xF7, 0x79, 0xAE, 0x46, 0xF8, 0x18, 0xC5,
-	0x5C, 0x33, 0x8F, 0xC7, 0x03, 0x2A, 0x95, 0x0A, 0xF4, 0x7A, 0x7D, 0xE8,
-	0x7A, 0xE1, 0x33, 0x4B, 0xFA, 0xD2, 0x50, 0xF8, 0x59, 0x96, 0x85, 0xD2,
-	0xD2, 0xD2, 0x99, 0x3C, 0xCF, 0xFF, 0x13, 0xC7, 0x71, 0xFF, 0xA8, 0xD1,
-	0x68, 0xF6, 0x28, 0x95, 0x4A, 0x11, 0x27, 0xD8, 0xB1, 0x1C, 0x83, 0x37,
-	0x4D, 0xB0, 0x7C, 0x3E, 0xDF, 0x8C, 0xCC, 0xCC, 0xCC, 0x9F, 0x4D, 0x9D,
-	0x3A, 0x75, 0xA1, 0x4A, 0xA5, 0x62, 0x70, 0x36, 0x1B, 0x2E, 0xF2, 0x42,
-	0xE6, 0xA2, 0xA0, 0x5F, 0x8B, 0x5C, 0x9B, 0x93, 0x83, 0x88, 0xB4, 0x30,
-	0x86, 0x8B, 0x9E, 0xE0, 0x43, 0x8E, 0xBE, 0x27, 0xB7, 0xDB, 0xED, 0x39,
-	0x73, 0xE6, 0x4C, 0xDD, 0xF1, 0xE3, 0xC7, 0x4F, 0x54, 0x56, 0x56, 0xEE,
-	0x2A, 0x2D, 0x2D, 0xAD, 0x9F, 0x3F, 0x7F, 0xBE, 0xCF, 0xEB, 0xF5, 0xBA,
-	0x06, 0x07, 0x07, 0x5D, 0x7D, 0x7D, 0x7D, 0x9E, 0x9E, 0x9E, 0x1E, 0x9F,
-	0xD3, 0xE9, 0x94, 0x06, 0x07, 0x07, 0x81, 0x61, 0x18, 0x70, 0x38, 0x1C,
-	0xA1, 0xF7, 0x08, 0xFA, 0x40, 0x6C, 0x3C, 0xCF, 0x77, 0xC4, 0xC4, 0xC4,
-	0x54, 0x3B, 0x9D, 0xCE, 0xCF, 0x18, 0x86, 0xD1, 0x7C, 0xF6, 0xD9, 0x67,
-	0x49, 0xF5, 0xF5, 0xF5, 0x53, 0x17, 0x2D, 0x5A, 0x34, 0x7F, 0xE6, 0xCC,
-	0x99, 0x33, 0xE3, 0xE3, 0xE3, 0xE3, 0xF1, 0xB3, 0xE3, 0x2C, 0x8F, 0xBE,
-	0x00, 0x8C, 0x38, 0xE1, 0xB9, 0xE3, 0xE7, 0x45, 0xA7, 0x3F, 0x3A, 0x50,
-	0x47, 0x8A, 0x18, 0x85, 0x7F, 0x8F, 0xFE, 0x33, 0x72, 0xD6, 0x0E, 0xFE,
-	0x5F, 0x36, 0x6D, 0xDA, 0xB4, 0xE9, 0x31, 0x31, 0x31, 0xBF, 0xDA, 0xB4,
-	0x69, 0x53, 0xF1, 0x87, 0x1F, 0x7E, 0xF8, 0x26, 0xCF, 0xF3, 0x77, 0x4D,
-	0xB3, 0x40, 0x9F, 0xCF, 0x07, 0x5A, 0xAD, 0x36, 0xE9, 0x9E, 0x7B, 0xEE,
-	0x79, 0x7E, 0xF5, 0xEA, 0xD5, 0x0F, 0x65, 0x67, 0x67, 0xE7, 0xE1, 0x03,
-	0x47, 0x06, 0x30, 0x10, 0xD2, 0x67, 0x49, 0x5E, 0xE7, 0xE1, 0x82, 0x2B,
-	0xE4, 0xE4, 0x41, 0xB6, 0x5D, 0x21, 0x27, 0x16, 0xBC, 0xCF, 0x00, 0xDF,
-	0x5C, 0xC6, 0xF5, 0xF4, 0xF4, 0x74, 0x9E, 0x3C, 0x79, 0xF2, 0xD4, 0x81,
-	0x03, 0x07, 0x0E, 0x15, 0x14, 0x14, 0x1C, 0x1E, 0x37, 0x6E, 0xDC, 0x45,
-	0x97, 0xCB, 0xE5, 0x1E, 0x18, 0x18, 0x70, 0xF6, 0xF4, 0xF4, 0xB8, 0x07,
-	0x07, 0x07, 0xC1, 0xE3, 0xF1, 0x84, 0x56, 0x16, 0x56, 0xAB, 0x15, 0xBA,
-	0xBA, 0xBA, 0x50, 0x80, 0x41, 0xA9, 0x54, 0x02, 0xC7, 0x71, 0x9C, 0xC1,
-	0x60, 0x50, 0xF3, 0x3C, 0xAF, 0x95, 0x24, 0x49, 0xF3, 0xCA, 0x2B, 0xAF,
-	0x68, 0xCE, 0x9E, 0x3D, 0x5B, 0xB4, 0x68, 0xD1, 0xA2, 0xB9, 0x13, 0x27,
-	0x4E, 0x9C, 0x32, 0x6E, 0xDC, 0xB8, 0x62, 0xBD, 0x5E, 0xAF, 0x25, 0xCF,
-	0x31, 0xDC, 0x3F, 0x86, 0x9F, 0x0F, 0x7B, 0x66, 0x01, 0x5C, 0x71, 0x33,
-	0x00, 0x40, 0xC8, 0xA2, 0x22, 0xAF, 0x01, 0x19, 0x51, 0x47, 0x9F, 0x5E,
-	0x78, 0xB9, 0x19, 0xC3, 0x30, 0x50, 0x52, 0x52, 0x32, 0x7B, 0xC5, 0x8A,
-	0x15, 0x3F, 0x4A, 0x4E, 0x4E, 0xF6, 0x0E, 0x0E, 0x0E, 0x1E, 0xBA, 0x74,
-	0xE9, 0x12, 0x74, 0x75, 0x75, 0x8D, 0x69, 0x9B, 0x9A, 0x9B, 0x22, 0x58,
-	0x3E, 0x9F, 0x6F, 0xA2, 0xC5, 0x62, 0x79, 0xB6, 0xA0, 0xA0, 0x60, 0xA9,
-	0xC1, 0x60, 0x90, 0xA3, 0xA3, 0x98, 0xFC, 0xB0, 0xE8, 0x3B, 0x00, 0xF8,
-	0xA6, 0xA5, 0x44, 0x66, 0x89, 0x63, 0xA1, 0x29, 0x3A, 0xFC, 0xF0, 0x38,
-	0x5E, 0xAF, 0x17, 0xEC, 0x76, 0x3B, 0x70, 0x1C, 0x17, 0xDA, 0xCD, 0x05,
-	0x4D, 0x59, 0x87, 0xC3, 0x21, 0x9E, 0x3A, 0x75, 0xAA, 0xE2, 0xE8, 0xD1,
-	0xA3, 0x07, 0x7B, 0x7A, 0x7A, 0x2A, 0x26, 0x4E, 0x9C, 0x78, 0xA1, 0xAB,
-	0xAB, 0xAB, 0xA3, 0xB2, 0xB2, 0xB2, 0x25, 0x26, 0x26, 0x26, 0x34, 0xBB,
-	0x2A, 0x95, 0x4A, 0x50, 0xAB, 0xD5, 0xA0, 0xD1, 0x68, 0x42, 0x37, 0x30,
-	0x68, 0xAD, 0x5C, 0xB9, 0x40, 0x72, 0x39, 0xA8, 0xD5, 0x6A, 0x90, 0xC9,
-	0x64, 0xA0, 0x52, 0xA9, 0xDC, 0x1C, 0xC7, 0xB9, 0x95, 0x4A, 0x25, 0x74,
-	0x75, 0x75, 0x35, 0x37, 0x34, 0x34, 0xD4, 0x24, 0x26, 0x26, 0xEE, 0xAA,
-	0xAD, 0xAD, 0xCD, 0x54, 0xAB, 0xD5, 0x33, 0xA7, 0x4C, 0x99, 0x32, 0x7F,
-	0xFA, 0xF4, 0xE9, 0xE5, 0x2A, 0x95, 0x4A, 0xA6, 0x50, 0x28, 0xC0, 0xE5,
-	0x72, 0x85, 0x66, 0x2B, 0x32, 0x53, 0x1A, 0x2D, 0x24, 0xFC, 0xEC, 0x23,
-	0xE5, 0x76, 0x8D, 0x74, 0x93, 0xAF, 0xF6, 0x5A, 0x86, 0x61, 0x98, 0xFC,
-	0xFC, 0xFC, 0x82, 0xA7, 0x9E, 0x7A, 0xEA, 0xFB, 0xE3, 0xC7, 0x8F, 0x2F,
-	0xFB, 0xF2, 0xCB, 0x2F, 0xFF, 0x68, 0xB3, 0xD9, 0xBE, 0x4A, 0x4F, 0x4F,
-	0xBF, 0x63, 0x33, 0x4D, 0x19, 0x86, 0x01, 0x9B, 0xCD, 0x06, 0x69, 0x69,
-	0x69, 0x8B, 0x1E, 0x78, 0xE0, 0x81, 0xEF, 0x95, 0x95, 0x95, 0xCD, 0x4D,
-	0x4A, 0x4A, 0x8A, 0x03, 0x18, 0xDE, 0xE2, 0x46, 0x48, 0xCB, 0xFC, 0x5A,
-	0xD7, 0x3E, 0x5C, 0x98, 0x00, 0x20, 0xE4, 0xE3, 0xC1, 0x5A, 0x3C, 0xAC,
-	0x35, 0xC4, 0x89, 0xD6, 0x6A, 0xB5, 0xF2, 0xBB, 0x76, 0xED, 0x3A, 0xE5,
-	0xF5, 0x7A, 0xF7, 0x2C, 0x5C, 0xB8, 0xF0, 0xB0, 0xD3, 0xE9, 0xBC, 0x54,
-	0x53, 0x53, 0xD3, 0x66, 0x34, 0x1A, 0xAD, 0x13, 0x27, 0x4E, 0x04, 0x85,
-	0x42, 0x01, 0x2A, 0x95, 0x0A, 0x34, 0x1A, 0x0D, 0xF8, 0x7C, 0xBE, 0xD0,
-	0xDF, 0xA1, 0x83, 0x5B, 0xAB, 0xD5, 0x82, 0x46, 0xA3, 0x01, 0x8D, 0x46,
-	0x83, 0x3B, 0xD3, 0xF8, 0x94, 0x4A, 0xA5, 0x4F, 0xA1, 0x50, 0xD8, 0x14,
-	0x0A, 0x05, 0x34, 0x37, 0x37, 0xC3, 0xC9, 0x93, 0x27, 0x6B, 0xC7, 0x8F,
-	0x1F, 0x7F, 0xB4, 0xBE, 0xBE, 0x3E, 0xE9, 0xBD, 0xF7, 0xDE, 0xCB, 0x4C,
-	0x49, 0x49, 0x29, 0x9F, 0x3E, 0x7D, 0xFA, 0xBC, 0xB2, 0xB2, 0xB2, 0x32,
-	0x9D, 0x4E, 0xC7, 0x00, 0x40, 0x28, 0x50, 0xE3, 0xF5, 0x7A, 0x01, 0x00,
-	0x42, 0x45, 0xDA, 0x38, 0xE9, 0xE1, 0xF3, 0x24, 0x8A, 0x22, 0x68, 0xB5,
-	0xDA, 0x61, 0x85, 0x7D, 0xB8, 0x6B, 0x01, 0x70, 0x65, 0x75, 0x20, 0x08,
-	0x02, 0x98, 0x4C, 0x26, 0x66, 0xFA, 0xF4, 0xE9, 0x0B, 0xFD, 0x7E, 0x7F,
-	0x4F, 0x45, 0x45, 0x85, 0x93, 0xE3, 0xB8, 0x6A, 0x7C, 0xDE, 0xC7, 0xAC,
-	0x0F, 0xDD, 0x98, 0x1C, 0x05, 0xAE, 0xF4, 0xE6, 0xF1, 0x78, 0x3C, 0x09,
-	0xB9, 0xB9, 0xB9, 0xCF, 0x4C, 0x9F, 0x3E, 0x7D, 0x6D, 0x72, 0x72, 0xB2,
-	0x32, 0x3C, 0xF2, 0x31, 0xDC, 0xC3, 0x16, 0x4E, 0x78, 0xF8, 0x17, 0x00,
-	0x42, 0x85, 0x9A, 0xD8, 0x83, 0x08, 0x4D, 0x54, 0xB4, 0x60, 0x58, 0x96,
-	0x85, 0x8B, 0x17, 0x2F, 0x76, 0x1E, 0x3E, 0x7C, 0xF8, 0x98, 0x46, 0xA3,
-	0x39, 0x3E, 0x38, 0x38, 0x58, 0xB9, 0x6D, 0xDB, 0xB6, 0xEA, 0xCE, 0xCE,
-	0xCE, 0xCE, 0x82, 0x82, 0x02, 0x30, 0x1A, 0x8D, 0x60, 0x30, 0x18, 0x86,
-	0x38, 0x33, 0xAF, 0x17, 0xCC, 0x4F, 0x89, 0x89, 0x89, 0x71, 0x06, 0x02,
-	0x81, 0xD3, 0xA7, 0x4E, 0x9D, 0x3A, 0xED, 0xF1, 0x78, 0x0E, 0x1F, 0x3F,
-	0x7E, 0x7C, 0xDF, 0x9E, 0x3D, 0x7B, 0x66, 0x95, 0x97, 0x97, 0x4F, 0x9B,
-	0x32, 0x65, 0xCA, 0xD4, 0x84, 0x84, 0x04, 0x33, 0x3A, 0x47, 0x11, 0x8C,
-	0x00, 0x92, 0xF9, 0x3E, 0x63, 0x09, 0xBE, 0x57, 0x6A, 0x6A, 0x6A, 0x7C,
-	0x72, 0x72, 0xF2, 0x3D, 0x16, 0x8B, 0x25, 0xF1, 0xF0, 0xE1, 0xC3, 0xA9,
-	0x4E, 0xA7, 0xF3, 0x63, 0x00, 0xB8, 0x23, 0x73, 0xB6, 0x1C, 0x0E, 0x87,
-	0x25, 0x3B, 0x3B, 0x7B, 0xCD, 0xCC, 0x99, 0x33, 0x9F, 0x9C, 0x37, 0x6F,
-	0xDE, 0x3C, 0xB2, 0x08, 0x79, 0x2C, 0xDA, 0xB8, 0x00, 0x5C, 0xB1, 0xB0,
-	0xD0, 0x8F, 0xA3, 0x50, 0x28, 0x42, 0x51, 0x5D, 0x8F, 0xC7, 0x13, 0x7A,
-	0xD8, 0x01, 0x00, 0x5A, 0x5B, 0x5B, 0xFB, 0x8E, 0x1C, 0x39, 0x72, 0x2C,
-	0x21, 0x21, 0xE1, 0x90, 0xCB, 0xE5, 0x3A, 0x76, 0xEA, 0xD4, 0xA9, 0xAA,
-	0xE5, 0xCB, 0x97, 0x0F, 0xE8, 0xF5, 0xFA, 0x90, 0xB5, 0x74, 0xA3, 0xE7,
-	0x14, 0x4C, 0x71, 0x01, 0xA3, 0xD1, 0x28, 0x19, 0x8D, 0xC6, 0x56, 0xB7,
-	0xDB, 0xDD, 0xBA, 0x65, 0xCB, 0x96, 0xA3, 0x19, 0x19, 0x19, 0x7B, 0x53,
-	0x53, 0x53, 0x77, 0x0C, 0x0E, 0x0E, 0x96, 0x79, 0xBD, 0xDE, 0x29, 0x33,
-	0x67, 0xCE, 0x2C, 0x4F, 0x49, 0x49, 0x49, 0x01, 0x80, 0xD0, 0x92, 0x8E,
-	0xE7, 0xF9, 0xD0, 0x67, 0xC0, 0x6B, 0x35, 0x9A, 0xE0, 0xD6, 0x70, 0x93,
-	0x00, 0x8E, 0xE3, 0xB8, 0xB8, 0x38, 0xD5, 0xE4, 0xC9, 0x93, 0xD7, 0x0E,
-	0x0C, 0x0C, 0xD8, 0x4F, 0x9F, 0x3E, 0xFD, 0xCF, 0xA2, 0x28, 0x76, 0x47,
-	0xF2, 0xCC, 0x47, 0xCA, 0x88, 0x67, 0x38, 0x9A, 0x0B, 0x8A, 0x37, 0x4D,
-	0x2E, 0x97, 0x2B, 0xC7, 0x8D, 0x1B, 0x77, 0xFF, 0x82, 0x05, 0x0B, 0xD6,
-	0x65, 0x66, 0x66, 0x9A, 0x01, 0xAE, 0x24, 0x43, 0x86, 0xB7, 0x5E, 0x89,
-	0xF4, 0x03, 0x60, 0x0B, 0x0C, 0x5C, 0xE6, 0x61, 0xAB, 0x0C, 0x95, 0x4A,
-	0x05, 0x31, 0x31, 0x31, 0x00, 0x00, 0xD0, 0xDC, 0xDC, 0xDC, 0xD3, 0xDC,
-	0xDC, 0x5C, 0x73, 0xE4, 0xC8, 0x91, 0x1D, 0x5B, 0xB7, 0x6E, 0xFD, 0x6A,
-	0xF1, 0xE2, 0xC5, 0x35, 0x93, 0x26, 0x4D, 0x02, 0xA3, 0xD1, 0x08, 0x6E,
-	0xB7, 0xFB, 0xA6, 0x84, 0xA6, 0xF1, 0x73, 0xB3, 0x2C, 0x0B, 0x06, 0x83,
-	0x01, 0x14, 0x0A, 0xC5, 0xC0, 0xC9, 0x93, 0x27, 0xBF, 0x3E, 0x7C, 0xF8,
-	0xF0, 0xBE, 0x73, 0xE7, 0xCE, 0x95, 0x5D, 0xB8, 0x70, 0x61, 0xC1, 0xF8,
-	0xF1, 0xE3, 0xE7, 0x17, 0x14, 0x14, 0xCC, 0x4A, 0x49, 0x49, 0xD1, 0x00,
-	0x5C, 0x49, 0x5C, 0x45, 0x0B, 0x92, 0xF4, 0x9B, 0x8C, 0xE5, 0x39, 0xA1,
-	0xF5, 0x16, 0x08, 0x04, 0x60, 0xD6, 0xAC, 0x59, 0xD3, 0x8C, 0x46, 0x63,
-	0x42, 0x45, 0x45, 0x45, 0x1C, 0xCF, 0xF3, 0x6F, 0x49, 0x92, 0x74, 0x4B,
-	0x4A, 0x2A, 0x6E, 0x06, 0xC1, 0x48, 0x56, 0x66, 0x7C, 0x7C, 0xFC, 0x63,
-	0x93, 0x26, 0x4D, 0x7A, 0x62, 0xFC, 0xF8, 0xF1, 0x39, 0x6E, 0xB7, 0x5B,
-	0x94, 0xCB, 0xE5, 0x8C, 0x24, 0x49, 0xCC, 0x58, 0x4E, 0x06, 0xE1, 0xF7,
-	0x8A, 0xEC, 0x24, 0x8B, 0x51, 0xB5, 0x9E, 0x9E, 0x9E, 0xFE, 0xBA, 0xBA,
-	0xBA, 0x13, 0xED, 0xED, 0xED, 0xBB, 0x3F, 0xFA, 0xE8, 0xA3, 0xDD, 0x6B,
-	0xD7, 0xAE, 0xAD, 0x2C, 0x2D, 0x2D, 0x15, 0x1B, 0x1A, 0x1A, 0x86, 0x8C,
-	0xFF, 0xB1, 0x46, 0x92, 0x2E, 0x97, 0xD3, 0x18, 0x8D, 0x46, 0x30, 0x1A,
-	0x8D, 0x5D, 0x06, 0x83, 0x61, 0x5B, 0x65, 0x65, 0xE5, 0xB6, 0x6D, 0xDB,
-	0xB6, 0x15, 0x57, 0x56, 0x56, 0x2E, 0x5D, 0xB8, 0x70, 0xE1, 0xF2, 0x82,
-	0x82, 0x82, 0x29, 0x69, 0x69, 0x69, 0x31, 0x00, 0x57, 0x22, 0x91, 0xD8,
-	0xC1, 0x41, 0x10, 0x84, 0x50, 0x30, 0x22, 0x12, 0xC8, 0x65, 0x26, 0x09,
-	0x4E, 0xC4, 0xD9, 0xD9, 0xD9, 0x31, 0x8B, 0x17, 0x2F, 0x5E, 0xDF, 0xD4,
-	0xD4, 0xD4, 0xB4, 0x73, 0xE7, 0xCE, 0xFF, 0xF5, 0xFB, 0xFD, 0x02, 0x46,
-	0xDB, 0x6F, 0xF4, 0x1A, 0x8C, 0x28, 0x58, 0xA3, 0x51, 0x5B, 0xB9, 0x5C,
-	0x0E, 0x1A, 0x8D, 0x06, 0x92, 0x92, 0x92, 0x16, 0x3E, 0xF4, 0xD0, 0x43,
-	0xCF, 0x66, 0x65, 0x65, 0xA5, 0x90, 0x0F, 0x0E, 0xB6, 0x58, 0xC1, 0x07,
-	0x7C, 0x34, 0x03, 0x29, 0xDC, 0x77, 0xC0, 0xB2, 0x2C, 0x68, 0xB5, 0x5A,
-	0x10, 0x45, 0x11, 0xFA, 0xFB, 0xFB, 0x7D, 0x7D, 0x7D, 0x7D, 0xB5, 0x47,
-	0x8E, 0x1C, 0xF9, 0xE4, 0xBD, 0xF7, 0xDE, 0xFB, 0xC8, 0x66, 0xB3, 0x35,
-	0x05, 0x02, 0x01, 0x9F, 0x4E, 0xA7, 0xBB, 0x69, 0x83, 0xE3, 0x6A, 0x28,
-	0x95, 0x4A, 0xD0, 0x68, 0x34, 0x5E, 0x9F, 0xCF, 0x77, 0xE4, 0xF3, 0xCF,
-	0x3F, 0x3F, 0xF2, 0xD9, 0x67, 0x9F, 0x7D, 0xF0, 0xC2, 0x0B, 0x2F, 0xFC,
-	0x70, 0xC2, 0x84, 0x09, 0xCB, 0x8D, 0x46, 0x63, 0xBA, 0xC5, 0x62, 0x51,
-	0xA1, 0xF9, 0x8F, 0x4B, 0xCF, 0xF0, 0x66, 0x70, 0x37, 0x0A, 0x8A, 0x33,
-	0x76, 0x96, 0x14, 0x04, 0x01, 0xC6, 0x8D, 0x1B, 0x97, 0xA9, 0x56, 0xAB,
-	0x5F, 0xEC, 0xE8, 0xE8, 0x88, 0xEB, 0xEA, 0xEA, 0xFA, 0x2F, 0xB7, 0xDB,
-	0xDD, 0x3C, 0x16, 0xD9, 0xDB, 0xB7, 0x02, 0xCC, 0x0B, 0xF2, 0x78, 0x3C,
-	0x10, 0x08, 0x04, 0x72, 0xB4, 0x5A, 0xED, 0x8F, 0xCB, 0xCB, 0xCB, 0x1F,
-	0xC9, 0xCB, 0xCB, 0x33, 0x00, 0x00, 0x28, 0x95, 0x4A, 0xD6, 0xEB, 0xF5,
-	0x0E, 0xE9, 0x46, 0x3B, 0x56, 0xEF, 0x0B, 0x70, 0x25, 0xAD, 0x05, 0xEF,
-	0x5B, 0xB0, 0x80, 0xDA, 0xD9, 0xDC, 0xDC, 0xDC, 0xFC, 0xF5, 0xD7, 0x5F,
-	0x7F, 0xB6, 0x6B, 0xD7, 0xAE, 0x57, 0x97, 0x2F, 0x5F, 0xDE, 0x1A, 0x17,
-	0x17, 0x07, 0x72, 0xB9, 0x3C, 0xE4, 0xA7, 0xFC, 0x36, 0x91, 0x24, 0x09,
-	0xF4, 0x7A, 0x3D, 0x58, 0xAD, 0xD6, 0x33, 0xAF, 0xBD, 0xF6, 0xDA, 0xD9,
-	0x63, 0xC7, 0x8E, 0x7D, 0xF9, 0xBD, 0xEF, 0x7D, 0xEF, 0x71, 0xAF, 0xD7,
-	0x7B, 0xAF, 0xD1, 0x68, 0x2C, 0x32, 0x9B, 0xCD, 0x32, 0xEC, 0x40, 0x0A,
-	0x00, 0xA1, 0x6B, 0x35, 0x9A, 0xE3, 0x87, 0xBB, 0x71, 0xF0, 0xBE, 0xA0,
-	0x1E, 0xE4, 0xE4, 0xE4, 0xA4, 0x3E, 0xF0, 0xC0, 0x03, 0xCF, 0xB4, 0xB4,
-	0xB4, 0xD4, 0xF4, 0xF4, 0xF4, 0xEC, 0x41, 0x37, 0xD0, 0x8D, 0x4E, 0x22,
-	0x23, 0x9E, 0x65, 0xA4, 0x3B, 0xB7, 0xFA, 0xFD, 0x7E, 0x30, 0x99, 0x4C,
-	0x50, 0x56, 0x56, 0x96, 0x3D, 0x77, 0xEE, 0xDC, 0x17, 0x0B, 0x0B, 0x0B,
-	0xC7, 0xE3, 0xCF, 0x01, 0x60, 0x48, 0x4D, 0x16, 0x7E, 0x50, 0x9C, 0x6D,
-	0x22, 0x7D, 0x48, 0xD1, 0x0C, 0x47, 0xF3, 0x35, 0x18, 0xFA, 0xB7, 0xED,
-	0xDD, 0xBB, 0x77, 0xDB, 0xB9, 0x73, 0xE7, 0xFE, 0x27, 0x39, 0x39, 0xF9,
-	0xB8, 0x4C, 0x26, 0xBB, 0x2D, 0xEA, 0xEA, 0x48, 0x11, 0x90, 0xCB, 0xE5,
-	0x8D, 0x81, 0x40, 0xE0, 0xA7, 0x9B, 0x37, 0x6F, 0xFE, 0x3C, 0x23, 0x23,
-	0xE3, 0xB1, 0x55, 0xAB, 0x56, 0x2D, 0x06, 0x80, 0x04, 0x00, 0x90, 0x6B,
-	0x34, 0x9A, 0x90, 0xB0, 0x0C, 0xE7, 0x10, 0xBE, 0x5E, 0xF0, 0xBA, 0xE2,
-	0xF1, 0x38, 0x8E, 0x03, 0x9E, 0xE7, 0x21, 0x3D, 0x3D, 0xDD, 0x92, 0x94,
-	0x94, 0xF4, 0xDD, 0xBD, 0x7B, 0xF7, 0xA6, 0x58, 0x2C, 0x96, 0x5F, 0x39,
-	0x1C, 0x8E, 0xD3, 0x7E, 0xBF, 0xDF, 0x1F, 0x6D, 0xA2, 0x15, 0xF4, 0xC7,
-	0xB0, 0x16, 0x8B, 0x65, 0xB2, 0x56, 0xAB, 0xFD, 0x65, 0x61, 0x61, 0xE1,
-	0x12, 0x96, 0x65, 0x15, 0x2E, 0x97, 0x2B, 0xA0, 0xD3, 0xE9, 0x64, 0xC3,
-	0x39, 0x99, 0xC7, 0x02, 0x32, 0xDA, 0xE7, 0xF5, 0x7A, 0xD1, 0xF2, 0x17,
-	0xFA, 0xFA, 0xFA, 0x2E, 0xED, 0xD9, 0xB3, 0x67, 0xDB, 0x07, 0x1F, 0x7C,
-	0xB0, 0xB9, 0xB6, 0xB6, 0xF6, 0x54, 0x7C, 0x7C, 0xBC, 0x73, 0xB8, 0x8E,
-	0x0D, 0xB7, 0x82, 0xE0, 0x52, 0x4C, 0x94, 0xC9, 0x64, 0xE7, 0x19, 0x86,
-	0xF9, 0xFF, 0xB6, 0x6C, 0xD9, 0xB2, 0x3B, 0x2F, 0x2F, 0xEF, 0xAF, 0x96,
-	0x2F, 0x5F, 0x3E, 0xC7, 0xE5, 0x72, 0x99, 0x78, 0x9E, 0x07, 0xBD, 0x5E,
-	0x3F, 0xA4, 0x4F, 0x5B, 0x24, 0xE3, 0x90, 0xEC, 0xA9, 0x45, 0xFA, 0xB2,
-	0xD0, 0x65, 0x83, 0x96, 0x67, 0x41, 0x41, 0x41, 0xD1, 0xE3, 0x8F, 0x3F,
-	0xFE, 0x83, 0x23, 0x47, 0x8E, 0x34, 0x57, 0x57, 0x57, 0xB7, 0x0C, 0x0E,
-	0x0E, 0x46, 0x6C, 0xC5, 0x8D, 0xC4, 0x88, 0x72, 0x47, 0xD6, 0xDB, 0x8D,
-	0xF4, 0x45, 0x38, 0x22, 0xE3, 0x12, 0x13, 0x13, 0x1F, 0x9A, 0x3E, 0x7D,
-	0xFA, 0x6C, 0x99, 0x4C, 0xC6, 0x90, 0x4D, 0xF7, 0xC8, 0x81, 0x83, 0x3F,
-	0x43, 0xB5, 0x8D, 0x04, 0x74, 0xD8, 0x61, 0x32, 0xA9, 0x4C, 0x26, 0x83,
-	0xCA, 0xCA, 0xCA, 0x8A, 0x81, 0x81, 0x81, 0xE7, 0x59, 0x96, 0xFD, 0x91,
-	0xCB, 0xE5, 0x3A, 0xC4, 0xB2, 0xAC, 0x80, 0x59, 0xC9, 0xB7, 0xC3, 0x03,
-	0x48, 0x86, 0xC3, 0x59, 0x96, 0xE5, 0xDD, 0x6E, 0xF7, 0x6E, 0x49, 0x92,
-	0x7E, 0x56, 0x55, 0x55, 0xF5, 0xE4, 0x97, 0x5F, 0x7E, 0xF9, 0x11, 0x00,
-	0x78, 0x59, 0x96, 0x05, 0x6C, 0x83, 0x3C, 0x96, 0xF9, 0x52, 0xE4, 0xF6,
-	0x66, 0x82, 0x20, 0x84, 0x2A, 0x0A, 0x82, 0xCE, 0x5D, 0x55, 0x59, 0x59,
-	0xD9, 0xF2, 0xBF, 0xF9, 0x9B, 0xBF, 0xF9, 0xAF, 0xA2, 0xA2, 0xA2, 0xB5,
-	0x6E, 0xB7, 0x5B, 0x13, 0x4D, 0x69, 0x0F, 0x92, 0x24, 0x81, 0xD7, 0xEB,
-	0x95, 0x15, 0x14, 0x14, 0x2C, 0xFF, 0xCB, 0xBF, 0xFC, 0xCB, 0xFF, 0x28,
-	0x2B, 0x2B, 0x5B, 0x66, 0x36, 0x9B, 0x15, 0x66, 0xB3, 0x19, 0x54, 0x2A,
-	0x15, 0x8B, 0xFE, 0x42, 0x4C, 0x74, 0x44, 0x77, 0xC4, 0x58, 0x40, 0x06,
-	0x65, 0xD4, 0x6A, 0x35, 0x38, 0x1C, 0x0E, 0xC7, 0x47, 0x1F, 0x7D, 0xB4,
-	0xA9, 0xA2, 0xA2, 0xE2, 0x3B, 0xA2, 0x28, 0xFE, 0x72, 0x70, 0x70, 0x70,
-	0x9F, 0xDB, 0xED, 0x76, 0x8E, 0x75, 0x39, 0xD9, 0x8D, 0x10, 0x36, 0x0E,
-	0x7D, 0x6E, 0xB7, 0x7B, 0xAF, 0x24, 0x49, 0xDF, 0xEB, 0xEE, 0xEE, 0x7E,
-	0xF6, 0xF8, 0xF1, 0xE3, 0xC7, 0x54, 0x2A, 0x55, 0x68, 0xEC, 0xE1, 0x12,
-	0x37, 0x12, 0xC2, 0x27, 0x02, 0xD2, 0xCA, 0xC2, 0xE7, 0x10, 0xBB, 0x98,
-	0xCE, 0x99, 0x33, 0x67, 0x49, 0x52, 0x52, 0xD2, 0xC3, 0x92, 0x24, 0xC5,
-	0x85, 0xE7, 0xA4, 0x5D, 0xED, 0x6B, 0x24, 0x6E, 0xC8, 0xE9, 0x2E, 0x49,
-	0x12, 0xB8, 0x5C, 0x2E, 0x18, 0x3F, 0x7E, 0xFC, 0xFC, 0xE5, 0xCB, 0x97,
-	0x7F, 0x5F, 0xA7, 0xD3, 0x69, 0x5C, 0x2E, 0x57, 0x28, 0x4C, 0x8A, 0xD1,
-	0xB0, 0x70, 0x27, 0xDD, 0x68, 0xD6, 0xB2, 0xA4, 0x9A, 0x5B, 0xAD, 0x56,
-	0xCF, 0x97, 0x5F, 0x7E, 0xF9, 0x11, 0xCF, 0xF3, 0xAF, 0xE5, 0xE6, 0xE6,
-	0x1E, 0x50, 0xA9, 0x54, 0x81, 0x68, 0x48, 0x8E, 0x54, 0x28, 0x14, 0x92,
-	0x52, 0xA9, 0xEC, 0xF6, 0xFB, 0xFD, 0xDD, 0x07, 0x0E, 0x1C, 0xB8, 0x54,
-	0x53, 0x53, 0x73, 0x64, 0xF1, 0xE2, 0xC5, 0x1B, 0x66, 0xCC, 0x98, 0x31,
-	0x5B, 0xA5, 0x52, 0x8D, 0xA9, 0x25, 0x80, 0x13, 0x09, 0x59, 0xE4, 0x0D,
-	0x00, 0x21, 0xF1, 0x32, 0x1A, 0x8D, 0xDA, 0x85, 0x0B, 0x17, 0xCE, 0x33,
-	0x9B, 0xCD, 0xFA, 0x4D, 0x9B, 0x36, 0x99, 0x5B, 0x5B, 0x5B, 0x3F, 0x28,
-	0x2E, 0x2E, 0x76, 0xA8, 0xD5, 0xEA, 0x31, 0x4D, 0xF0, 0xBB, 0x19, 0xD8,
-	0xED, 0x76, 0xFD, 0xC4, 0x89, 0x13, 0x1F, 0x78, 0xEA, 0xA9, 0xA7, 0x7E,
-	0x58, 0x52, 0x52, 0x52, 0x6A, 0xB7, 0xDB, 0xF1, 0xC1, 0x00, 0x85, 0x42,
-	0xC1, 0xE0, 0x58, 0x23, 0xA3, 0xAE, 0x63, 0xF5, 0x79, 0xB0, 0x9E, 0xCE,
-	0xE3, 0xF1, 0xF8, 0x77, 0xEC, 0xD8, 0xB1, 0x73, 0xFB, 0xF6, 0xED, 0x9F,
-	0xB8, 0xDD, 0xEE, 0xDD, 0xAB, 0x56, 0xAD, 0x6A, 0x0C, 0x46, 0xF0, 0x46,
-	0xEC, 0x99, 0x75, 0xBB, 0xA0, 0x50, 0x28, 0x24, 0x8E, 0xE3, 0xDA, 0x25,
-	0x49, 0xFA, 0xA8, 0xBE, 0xBE, 0xBE, 0xAF, 0xB7, 0xB7, 0xF7, 0xF9, 0x25,
-	0x4B, 0x96, 0xAC, 0x31, 0x9B, 0xCD, 0x9A, 0xD1, 0x58, 0xF9, 0xE4, 0xB8,
-	0xC2, 0x15, 0x53, 0x78, 0xBB, 0x1C, 0x80, 0xCB, 0xCF, 0xAE, 0xC1, 0x60,
-	0xD0, 0xAF, 0x5A, 0xB5, 0xEA, 0x85, 0xDA, 0xDA, 0xDA, 0x86, 0xF6, 0xF6,
-	0xF6, 0x8F, 0xC8, 0x5C, 0xB1, 0xEB, 0x61, 0x44, 0xC1, 0x72, 0xBB, 0xDD,
-	0x23, 0xFE, 0x11, 0x0E, 0x82, 0xF8, 0xF8, 0x78, 0x28, 0x2C, 0x2C, 0x2C,
-	0x59, 0xB1, 0x62, 0xC5, 0x33, 0xD9, 0xD9, 0xD9, 0xC9, 0x58, 0x28, 0x89,
-	0xBE, 0x03, 0x52, 0x2D, 0xC9, 0x68, 0x1F, 0x46, 0x6F, 0x22, 0x01, 0x3F,
-	0xE0, 0xF9, 0xF3, 0xE7, 0xDB, 0xB7, 0x6E, 0xDD, 0xBA, 0xF9, 0xEC, 0xD9,
-	0xB3, 0xAF, 0x4E, 0x9C, 0x38, 0xF1, 0x0C, 0x3A, 0x3A, 0xA3, 0x05, 0x8C,
-	0xEA, 0xD8, 0x6C, 0xB6, 0x86, 0xAA, 0xAA, 0xAA, 0xD6, 0x94, 0x94, 0x94,
-	0x6A, 0xA7, 0xD3, 0xF9, 0x60, 0x66, 0x66, 0xE6, 0xDA, 0x92, 0x92, 0x92,
-	0xA4, 0xB1, 0x5A, 0x12, 0xE2, 0x75, 0x26, 0x3B, 0x9E, 0xA2, 0xCF, 0x05,
-	0xA3, 0x44, 0x3E, 0x9F, 0x0F, 0xCA, 0xCA, 0xCA, 0x26, 0x01, 0xC0, 0x8F,
-	0xF7, 0xEF, 0xDF, 0x9F, 0xE0, 0xF1, 0x78, 0xDE, 0x91, 0xC9, 0x64, 0x17,
-	0x6F, 0xD7, 0x87, 0x4D, 0x92, 0x24, 0x70, 0x3A, 0x9D, 0xA9, 0x53, 0xA6,
-	0x4C, 0x79, 0x6C, 0xE1, 0xC2, 0x85, 0x4F, 0x96, 0x94, 0x94, 0xE4, 0x03,
-	0x5C, 0x19, 0x1B, 0xC3, 0xE5, 0xE7, 0x8D, 0x26, 0xB0, 0x13, 0x09, 0x82,
-	0x20, 0xC0, 0xE9, 0xD3, 0xA7, 0x9B, 0x5B, 0x5A, 0x5A, 0xB6, 0x9E, 0x39,
-	0x73, 0xE6, 0x9D, 0x7D, 0xFB, 0xF6, 0x9D, 0x2C, 0x2A, 0x2A, 0xF2, 0x6B,
-	0x34, 0x1A, 0xB8, 0xDD, 0x36, 0x6A, 0xB8, 0x1A, 0x92, 0x24, 0x01, 0xC7,
-	0x71, 0x52, 0x20, 0x10, 0xD8, 0x7B, 0xFC, 0xF8, 0xF1, 0xC1, 0xFE, 0xFE,
-	0xFE, 0x9E, 0xE5, 0xCB, 0x97, 0xDF, 0x9F, 0x95, 0x95, 0x95, 0x10, 0xE9,
-	0x31, 0x70, 0x42, 0x04, 0xB8, 0x92, 0xD6, 0x10, 0xBE, 0xBD, 0x19, 0x5A,
-	0x59, 0x1E, 0x8F, 0x07, 0x32, 0x33, 0x33, 0x93, 0x57, 0xAC, 0x58, 0xF1,
-	0x04, 0xC3, 0x30, 0x75, 0x9D, 0x9D, 0x9D, 0x67, 0xBB, 0xBA, 0xBA, 0x42,
-	0xC7, 0x19, 0x2D, 0x23, 0x0A, 0x16, 0x66, 0xA5, 0x0F, 0x07, 0xCE, 0x62,
-	0x32, 0x99, 0xCC, 0xBC, 0x68, 0xD1, 0xA2, 0x0D, 0x0B, 0x16, 0x2C, 0x58,
-	0x80, 0xE1, 0x7A, 0x95, 0x4A, 0x35, 0xA4, 0x9D, 0x2C, 0xF9, 0xFD, 0x70,
-	0x65, 0x0A, 0xC3, 0xE5, 0xC2, 0x90, 0x25, 0x3B, 0x0C, 0xC3, 0x40, 0x6D,
-	0x6D, 0x6D, 0xE3, 0xA6, 0x4D, 0x9B, 0x5E, 0xAF, 0xAE, 0xAE, 0xFE, 0x53,
-	0x7A, 0x7A, 0x7A, 0xDB, 0x58, 0x5B, 0x25, 0xDF, 0x16, 0xF8, 0x99, 0xCC,
-	0x66, 0xB3, 0x57, 0xA1, 0x50, 0xEC, 0xDD, 0xB7, 0x6F, 0x5F, 0x93, 0x28,
-	0x8A, 0x35, 0x19, 0x19, 0x19, 0xF7, 0xF0, 0x3C, 0x3F, 0x37, 0x31, 0x31,
-	0x51, 0x85, 0xAF, 0x03, 0x18, 0x5A, 0xF0, 0x4A, 0x4E, 0x00, 0x23, 0xDD,
-	0x68, 0x5C, 0xDE, 0xE1, 0x0C, 0x88, 0x41, 0x0A, 0x80, 0x2B, 0x25, 0x3F,
-	0x92, 0x24, 0x85, 0x26, 0xA3, 0x49, 0x93, 0x26, 0x15, 0x25, 0x24, 0x24,
-	0xBC, 0x78, 0xE8, 0xD0, 0x21, 0xF3, 0xB1, 0x63, 0xC7, 0x7E, 0x6F, 0xB7,
-	0xDB, 0x9B, 0x1C, 0x0E, 0x47, 0x68, 0x49, 0x79, 0x3B, 0x5C, 0xE3, 0x40,
-	0x20, 0x00, 0x3C, 0xCF, 0xE7, 0x17, 0x14, 0x14, 0x7C, 0x77, 0xE1, 0xC2,
-	0x85, 0x8F, 0xA7, 0xA4, 0xA4, 0xC4, 0xE1, 0xF9, 0x61, 0xF0, 0x85, 0x1C,
-	0x4B, 0x61, 0xAE, 0x0A, 0x00, 0xF8, 0x66, 0xF2, 0x67, 0xF8, 0xF8, 0x0B,
-	0x4F, 0x04, 0x0D, 0x7F, 0xF8, 0xBA, 0xBB, 0xBB, 0x3D, 0x4E, 0xA7, 0x73,
-	0x67, 0x4D, 0x4D, 0xCD, 0xA7, 0xA7, 0x4F, 0x9F, 0xDE, 0x11, 0x17, 0x17,
-	0x77, 0xC9, 0x6C, 0x36, 0x8F, 0xA9, 0x53, 0xFF, 0xDB, 0x04, 0xD3, 0x72,
-	0x64, 0x32, 0x59, 0xD5, 0xBE, 0x7D, 0xFB, 0x7E, 0xD3, 0xDD, 0xDD, 0xDD,
-	0xBD, 0x71, 0xE3, 0xC6, 0xA7, 0x8A, 0x8B, 0x8B, 0x73, 0x00, 0x00, 0xEC,
-	0x76, 0x3B, 0xE8, 0x74, 0xBA, 0x61, 0x97, 0xB6, 0xC3, 0x7D, 0x5E, 0x32,
-	0xA7, 0x8B, 0xFC, 0x19, 0xFA, 0xB4, 0x78, 0x9E, 0x87, 0xF9, 0xF3, 0xE7,
-	0x2F, 0x0A, 0x04, 0x02, 0xF7, 0xBF, 0xFF, 0xFE, 0xFB, 0xBF, 0x75, 0xBB,
-	0xDD, 0x03, 0xF8, 0x9A, 0xD1, 0x32, 0xA2, 0x60, 0x5D, 0xED, 0x60, 0x18,
-	0x1D, 0x31, 0x18, 0x0C, 0x73, 0xD2, 0xD3, 0xD3, 0xD7, 0xE8, 0xF5, 0x7A,
-	0x0E, 0x43, 0xA3, 0x64, 0x22, 0x24, 0x72, 0xB5, 0x1C, 0x2C, 0x51, 0x14,
-	0xBF, 0x51, 0xF0, 0xCC, 0xF3, 0x3C, 0xEE, 0xA3, 0xE6, 0xAF, 0xAE, 0xAE,
-	0xAE, 0x79, 0xE7, 0x9D, 0x77, 0x5E, 0xA9, 0xAE, 0xAE, 0xDE, 0x9C, 0x90,
-	0x90, 0x30, 0x10, 0xAD, 0x83, 0x64, 0x38, 0x54, 0x2A, 0xD5, 0xC5, 0xF8,
-	0xF8, 0xF8, 0xFF, 0x75, 0x3A, 0x9D, 0x07, 0x8F, 0x1D, 0x3B, 0xF6, 0xC3,
-	0xC2, 0xC2, 0xC2, 0x65, 0xE3, 0xC6, 0x8D, 0x4B, 0x23, 0xAF, 0xFD, 0x70,
-	0x19, 0xFE, 0x64, 0xA4, 0x2A, 0xBC, 0xDB, 0x00, 0xBE, 0x66, 0x24, 0x13,
-	0x1F, 0x1F, 0x74, 0x9C, 0x14, 0x52, 0x52, 0x52, 0xE2, 0x16, 0x2C, 0x58,
-	0xF0, 0xEC, 0xC0, 0xC0, 0x80, 0x76, 0xDC, 0xB8, 0x71, 0xBF, 0x17, 0x04,
-	0xA1, 0x56, 0xA9, 0x54, 0x8E, 0x49, 0x44, 0xE7, 0x7A, 0x60, 0x18, 0x26,
-	0xE4, 0xB8, 0x0D, 0x46, 0x02, 0xC7, 0xA7, 0xA7, 0xA7, 0xFF, 0xD5, 0xE4,
-	0xC9, 0x93, 0x1F, 0x88, 0x8F, 0x8F, 0xD7, 0xE2, 0x79, 0x93, 0x56, 0x3C,
-	0xFE, 0x1D, 0xD9, 0xD5, 0x02, 0xB9, 0xDA, 0xF7, 0xE4, 0xB5, 0x25, 0x05,
-	0x0A, 0x03, 0x17, 0xA2, 0x28, 0x42, 0x7D, 0x7D, 0x7D, 0x6B, 0x43, 0x43,
-	0xC3, 0xF6, 0x84, 0x84, 0x84, 0xDF, 0x6A, 0x34, 0x9A, 0xDA, 0xB1, 0xC8,
-	0xE3, 0xBB, 0x1D, 0xC0, 0x6B, 0xA8, 0x52, 0xA9, 0x5A, 0x76, 0xEE, 0xDC,
-	0xF9, 0xDB, 0x81, 0x81, 0x81, 0xFE, 0xA7, 0x9F, 0x7E, 0xFA, 0xFB, 0x39,
-	0x39, 0x39, 0xC5, 0x3E, 0x9F, 0x8F, 0xC5, 0x16, 0xD1, 0x68, 0x29, 0x05,
-	0x02, 0x81, 0x50, 0xFE, 0xD8, 0x70, 0x63, 0x6B, 0xB8, 0xB1, 0x26, 0x97,
-	0xCB, 0x43, 0x49, 0xDD, 0x06, 0x83, 0x41, 0x93, 0x9E, 0x9E, 0x7E, 0xAF,
-	0x5E, 0xAF, 0xAF, 0xF6, 0xFB, 0xFD, 0x9F, 0x5E, 0xAF, 0x05, 0x3C, 0xA2,
-	0x60, 0x5D, 0xCD, 0x01, 0x17, 0x74, 0x6C, 0xEA, 0xE7, 0xCD, 0x9B, 0xB7,
-	0x72, 0xDC, 0xB8, 0x71, 0x13, 0x31, 0x4B, 0x17, 0x1D, 0xBD, 0x23, 0x35,
-	0xC6, 0x1F, 0xEE, 0x38, 0x92, 0x74, 0xA5, 0x0F, 0x96, 0x5C, 0x2E, 0x0F,
-	0x95, 0x0B, 0xB0, 0x2C, 0x0B, 0x07, 0x0F, 0x1E, 0x3C, 0xFE, 0xD2, 0x4B,
-	0x2F, 0xFD, 0xBF, 0x86, 0x86, 0x86, 0xAD, 0x69, 0x69, 0x69, 0xE2, 0xED,
-	0xE2, 0xCC, 0x1C, 0x4B, 0x24, 0x49, 0x02, 0x95, 0x4A, 0x55, 0x73, 0xF1,
-	0xE2, 0xC5, 0xBF, 0xA9, 0xA8, 0xA8, 0xA8, 0x5C, 0xB9, 0x72, 0xE5, 0x93,
-	0x13, 0x26, 0x4C, 0x98, 0xA8, 0xD7, 0xEB, 0x15, 0x00, 0x30, 0xC4, 0x4A,
-	0xC2, 0x07, 0x8E, 0x7C, 0xD8, 0xC8, 0x7E, 0x5D, 0xA3, 0x09, 0x3A, 0x10,
-	0xDD, 0x55, 0x25, 0xBD, 0x5E, 0x6F, 0x7C, 0xE0, 0x81, 0x07, 0x9E, 0x2E,
-	0x28, 0x28, 0x88, 0x13, 0x45, 0xF1, 0x9F, 0x3E, 0xFC, 0xF0, 0xC3, 0x9A,
-	0xE3, 0xC7, 0x8F, 0x8B, 0x26, 0x93, 0xE9, 0xE6, 0x7C, 0xE8, 0x6B, 0x9C,
-	0x97, 0x4E, 0xA7, 0x03, 0xBD, 0x5E, 0xCF, 0x18, 0x8D, 0xC6, 0xF2, 0x84,
-	0x84, 0x84, 0x5F, 0xCC, 0x99, 0x33, 0x67, 0xA9, 0x28, 0x8A, 0x0A, 0x87,
-	0xC3, 0x21, 0x19, 0x8D, 0x46, 0x66, 0x34, 0x7E, 0x4B, 0xD2, 0xD2, 0x0A,
-	0x2F, 0x6E, 0x26, 0x4B, 0xA3, 0xF0, 0xB5, 0x68, 0x2D, 0xD8, 0xED, 0x76,
-	0x5F, 0x55, 0x55, 0x55, 0xE5, 0xD6, 0xAD, 0x5B, 0xDF, 0x4C, 0x4C, 0x4C,
-	0xFC, 0x30, 0x23, 0x23, 0xA3, 0x6F, 0xEC, 0x3F, 0xED, 0xAD, 0x27, 0x18,
-	0x44, 0xB0, 0xEF, 0xDA, 0xB5, 0xEB, 0x95, 0xBE, 0xBE, 0xBE, 0xAE, 0xE7,
-	0x9F, 0x7F, 0xFE, 0x6F, 0x66, 0xCD, 0x9A, 0x55, 0x4E, 0xB6, 0xDA, 0xF1,
-	0x7A, 0xBD, 0xA1, 0x42, 0xF1, 0x48, 0x9F, 0x41, 0xBC, 0xEE, 0x38, 0xC1,
-	0x06, 0x8B, 0xF4, 0x27, 0xCE, 0x99, 0x33, 0x67, 0xF9, 0xA9, 0x53, 0xA7,
-	0x76, 0x49, 0x92, 0xE4, 0xB8, 0x9E, 0xF3, 0x1D, 0xB5, 0x0F, 0x4B, 0x10,
-	0x04, 0x50, 0x28, 0x14, 0xEC, 0xB2, 0x65, 0xCB, 0x56, 0xCD, 0x9A, 0x35,
-	0x6B, 0xAE, 0x4E, 0xA7, 0x63, 0x30, 0x53, 0x76, 0xB4, 0x0F, 0x0C, 0xFE,
-	0x8D, 0xC1, 0x60, 0xC0, 0x87, 0x07, 0x30, 0xDC, 0x5F, 0x59, 0x59, 0x59,
-	0xFD, 0xD6, 0x5B, 0x6F, 0xBD, 0x52, 0x55, 0x55, 0xB5, 0x5B, 0xA7, 0xD3,
-	0xDD, 0x91, 0x62, 0x85, 0x30, 0x0C, 0x03, 0x4A, 0xA5, 0xB2, 0xEF, 0xD2,
-	0xA5, 0x4B, 0x6F, 0xFC, 0xF7, 0x7F, 0xFF, 0xF7, 0x99, 0x7B, 0xEF, 0xBD,
-	0xF7, 0xFB, 0x2B, 0x56, 0xAC, 0x58, 0x69, 0x36, 0x9B, 0x75, 0x98, 0x81,
-	0x4C, 0x06, 0x1F, 0x00, 0xAE, 0xE4, 0xC2, 0x5C, 0x6F, 0x6F, 0x77, 0xB9,
-	0x5C, 0x8E, 0xF7, 0x98, 0x09, 0x16, 0xBA, 0x2A, 0x67, 0xCD, 0x9A, 0x75,
-	0x4F, 0x6B, 0x6B, 0x6B, 0xB2, 0x4A, 0xA5, 0xFA, 0x25, 0xCB, 0xB2, 0x3B,
-	0xC6, 0x32, 0x3F, 0x2C, 0x12, 0x30, 0x01, 0x79, 0xEA, 0xD4, 0xA9, 0xB0,
-	0x64, 0xC9, 0x92, 0xD9, 0x82, 0x20, 0xFC, 0x6B, 0x51, 0x51, 0x51, 0xB9,
-	0x4C, 0x26, 0x93, 0x05, 0x33, 0xCB, 0x19, 0x80, 0xA1, 0x22, 0x7E, 0x35,
-	0xC2, 0x73, 0xA6, 0xC8, 0x25, 0x35, 0x46, 0x9E, 0xC3, 0x13, 0x6D, 0x01,
-	0x00, 0xAC, 0x56, 0xAB, 0x7D, 0xEB, 0xD6, 0xAD, 0x5F, 0x6E, 0xDE, 0xBC,
-	0xF9, 0x65, 0x9D, 0x4E, 0x77, 0x32, 0x33, 0x33, 0xD3, 0x73, 0xBB, 0xFA,
-	0xF7, 0xC6, 0x82, 0xA0, 0xA8, 0x88, 0xD5, 0xD5, 0xD5, 0x5B, 0x37, 0x6D,
-	0xDA, 0xA4, 0x33, 0x1A, 0x8D, 0x7F, 0x57, 0x5A, 0x5A, 0x5A, 0x80, 0x06,
-	0x04, 0xE6, 0x3E, 0x92, 0x4B, 0xEA, 0x6B, 0x81, 0xAF, 0x25, 0xAD, 0x58,
-	0xBD, 0x5E, 0x0F, 0x53, 0xA7, 0x4E, 0x9D, 0x33, 0x63, 0xC6, 0x8C, 0x95,
-	0xC7, 0x8F, 0x1F, 0xFF, 0x20, 0x10, 0x08, 0x48, 0xA3, 0x2D, 0x2C, 0x1F,
-	0xF1, 0xAE, 0x63, 0x6F, 0x1C, 0xF2, 0x0B, 0xCD, 0x74, 0x00, 0x88, 0x5D,
-	0xBD, 0x7A, 0xF5, 0xC3, 0x39, 0x39, 0x39, 0xB9, 0x98, 0xDD, 0x4A, 0xF6,
-	0xAE, 0x8A, 0x64, 0x30, 0x91, 0xFE, 0x2D, 0xB2, 0x72, 0x9E, 0x61, 0x18,
-	0xE8, 0xEF, 0xEF, 0xEF, 0x7E, 0xF5, 0xD5, 0x57, 0xFF, 0xAD, 0xA2, 0xA2,
-	0xE2, 0x63, 0xB9, 0x5C, 0xEE, 0x0E, 0xDF, 0xED, 0xE3, 0x4E, 0x24, 0xB8,
-	0xC4, 0xF1, 0x74, 0x75, 0x75, 0xED, 0xEB, 0xEF, 0xEF, 0xFF, 0xF9, 0xA1,
-	0x43, 0x87, 0x7E, 0x5D, 0x5F, 0x5F, 0xDF, 0x16, 0x14, 0x16, 0x89, 0xCC,
-	0xB0, 0x26, 0xC5, 0x0B, 0x8B, 0xC4, 0xC3, 0xFD, 0x36, 0x57, 0x03, 0x27,
-	0x07, 0xB2, 0x4E, 0x32, 0xE8, 0x2B, 0x52, 0x24, 0x24, 0x24, 0xCC, 0x7C,
-	0xEE, 0xB9, 0xE7, 0x7E, 0xBD, 0x68, 0xD1, 0xA2, 0x27, 0x5D, 0x2E, 0x97,
-	0xEC, 0xDB, 0x5E, 0x7E, 0x07, 0x5D, 0x0B, 0x0F, 0x8F, 0x1F, 0x3F, 0xFE,
-	0x37, 0x53, 0xA7, 0x4E, 0x9D, 0x61, 0x34, 0x1A, 0x65, 0xA4, 0x60, 0x8F,
-	0x46, 0x40, 0xC3, 0xC3, 0xED, 0xA4, 0x75, 0x15, 0xEE, 0xEF, 0x73, 0xB9,
-	0x5C, 0x22, 0xCB, 0xB2, 0x50, 0x57, 0x57, 0xD7, 0x7A, 0xE8, 0xD0, 0xA1,
-	0x5F, 0xF7, 0xF5, 0xF5, 0xFD, 0xA2, 0xA3, 0xA3, 0xE3, 0x80, 0x24, 0x49,
-	0x9E, 0xBB, 0xA1, 0xB7, 0x58, 0xD0, 0x25, 0xE3, 0x3B, 0x75, 0xEA, 0xD4,
-	0xA7, 0xAF, 0xBC, 0xF2, 0xCA, 0xBF, 0xB5, 0xB7, 0xB7, 0xB7, 0xE2, 0x75,
-	0x0B, 0x46, 0x61, 0x87, 0xB4, 0x97, 0xB9, 0x16, 0xF8, 0x2C, 0x0B, 0x82,
-	0x10, 0x4A, 0x62, 0x06, 0x00, 0xC8, 0xCB, 0xCB, 0xCB, 0xBB, 0xE7, 0x9E,
-	0x7B, 0x1E, 0x92, 0xCB, 0xE5, 0x31, 0xE4, 0x6E, 0xED, 0x37, 0x9C, 0xD6,
-	0x80, 0x1B, 0x42, 0x90, 0xF8, 0xFD, 0x7E, 0xD0, 0xE9, 0x74, 0xDC, 0xB4,
-	0x69, 0xD3, 0x16, 0x4D, 0x98, 0x30, 0x61, 0x8A, 0x5C, 0x2E, 0x57, 0x90,
-	0x3D, 0xD8, 0xF1, 0x44, 0x23, 0x01, 0x5F, 0xE7, 0xF5, 0x7A, 0xD1, 0x82,
-	0x90, 0x94, 0x4A, 0x25, 0xD3, 0xDB, 0xDB, 0xDB, 0xF5, 0xD2, 0x4B, 0x2F,
-	0xFD, 0xEA, 0xE8, 0xD1, 0xA3, 0x9F, 0x00, 0x80, 0x67, 0x2C, 0xEA, 0xAE,
-	0xA2, 0x01, 0x34, 0x9F, 0x35, 0x1A, 0x0D, 0xA8, 0x54, 0xAA, 0xC6, 0x81,
-	0x81, 0x81, 0xFF, 0xFD, 0xFC, 0xF3, 0xCF, 0x9B, 0x5A, 0x5B, 0x5B, 0x1F,
-	0x99, 0x3B, 0x77, 0xEE, 0x52, 0x32, 0xFA, 0x47, 0x2E, 0x05, 0xC9, 0x9C,
-	0x38, 0x0C, 0xEB, 0x5F, 0xEB, 0xA1, 0x26, 0xFF, 0x8E, 0xF4, 0x77, 0xC9,
-	0x64, 0x32, 0xD0, 0x68, 0x34, 0x60, 0x30, 0x18, 0x4A, 0x9E, 0x7E, 0xFA,
-	0xE9, 0xBF, 0x51, 0xA9, 0x54, 0x9A, 0xED, 0xDB, 0xB7, 0xBF, 0x29, 0x97,
-	0xCB, 0xDD, 0x37, 0xD3, 0xC2, 0xC0, 0x73, 0x77, 0xBB, 0xDD, 0x86, 0x25,
-	0x4B, 0x96, 0x3C, 0x30, 0x6F, 0xDE, 0xBC, 0xBF, 0x52, 0x28, 0x14, 0x45,
-	0x68, 0x21, 0xE1, 0x64, 0x86, 0xDD, 0x0C, 0xD0, 0x0A, 0xBF, 0x16, 0xB8,
-	0xE4, 0x23, 0xFD, 0x25, 0xA4, 0x60, 0xA1, 0x05, 0x19, 0xFC, 0x62, 0xBF,
-	0xFE, 0xFA, 0xEB, 0xED, 0xD5, 0xD5, 0xD5, 0xEF, 0x24, 0x27, 0x27, 0x7F,
-	0xA5, 0x56, 0xAB, 0x7B, 0x71, 0x9F, 0x81, 0xBB, 0x65, 0xFC, 0x05, 0x13,
-	0x5E, 0x9D, 0x87, 0x0E, 0x1D, 0xDA, 0xF4, 0x9B, 0xDF, 0xFC, 0x86, 0xFD,
-	0xE9, 0x4F, 0x7F, 0xFA, 0x8F, 0x89, 0x89, 0x89, 0xC9, 0xE8, 0xC3, 0x1A,
-	0xCD, 0x2A, 0x8A, 0xBC, 0xDE, 0x78, 0x8D, 0x83, 0xC2, 0xA5, 0x28, 0x2B,
-	0x2B, 0x9B, 0x3A, 0x65, 0xCA, 0x94, 0x45, 0xFB, 0xF7, 0xEF, 0xFF, 0xCC,
-	0x6E, 0xB7, 0xF3, 0xA3, 0x99, 0x10, 0x46, 0x7C, 0xE5, 0x70, 0x83, 0xDE,
-	0xEB, 0xF5, 0x42, 0x4A, 0x4A, 0x4A, 0xC2, 0xFD, 0xF7, 0xDF, 0xFF, 0x60,
-	0x4C, 0x4C, 0x8C, 0x85, 0x74, 0xFA, 0x62, 0xC8, 0x3C, 0xD2, 0xEE, 0x8C,
-	0x38, 0xCB, 0x03, 0x00, 0xD6, 0x35, 0x31, 0x7D, 0x7D, 0x7D, 0xB6, 0x8F,
-	0x3F, 0xFE, 0x78, 0xD3, 0x96, 0x2D, 0x5B, 0x5E, 0x91, 0x24, 0x49, 0x50,
-	0xAB, 0xD5, 0xE0, 0x74, 0x3A, 0x23, 0xFE, 0x30, 0x77, 0x12, 0x3A, 0x9D,
-	0xAE, 0xA7, 0xB5, 0xB5, 0xF5, 0xED, 0xEA, 0xEA, 0xEA, 0xA6, 0xF6, 0xF6,
-	0xF6, 0x4B, 0x73, 0xE7, 0xCE, 0x5D, 0x9D, 0x97, 0x97, 0x97, 0x40, 0x96,
-	0xDE, 0xA0, 0x68, 0x91, 0x3B, 0x11, 0x47, 0x0A, 0xD9, 0x26, 0x18, 0xFF,
-	0x5E, 0xA3, 0xD1, 0x00, 0xC0, 0xE5, 0x08, 0x71, 0x7E, 0x7E, 0x7E, 0xFE,
-	0x33, 0xCF, 0x3C, 0xF3, 0x13, 0xAF, 0xD7, 0xCB, 0x1C, 0x3B, 0x76, 0xEC,
-	0x1D, 0xAF, 0xD7, 0x6B, 0x33, 0x1A, 0x8D, 0x63, 0xFE, 0x39, 0x19, 0x86,
-	0x01, 0x9F, 0xCF, 0x07, 0x82, 0x20, 0xA4, 0x4E, 0x9D, 0x3A, 0x75, 0xE3,
-	0x93, 0x4F, 0x3E, 0xF9, 0x83, 0xC2, 0xC2, 0xC2, 0x6C, 0x0C, 0xC6, 0x60,
-	0x71, 0x3B, 0x76, 0xBF, 0xF0, 0xFB, 0xFD, 0x11, 0x57, 0x61, 0x90, 0x90,
-	0x56, 0x15, 0x5A, 0x0E, 0x2C, 0xCB, 0x82, 0xCF, 0xE7, 0x83, 0xA6, 0xA6,
-	0xA6, 0xCE, 0x83, 0x07, 0x0F, 0x6E, 0xD9, 0xB9, 0x73, 0xE7, 0x5B, 0x06,
-	0x83, 0xE1, 0x60, 0x7E, 0x7E, 0x7E, 0xA8, 0xB3, 0xC1, 0xDD, 0x04, 0xA6,
-	0xDE, 0x78, 0x3C, 0x1E, 0xD7, 0xD6, 0xAD, 0x5B, 0xDF, 0xCC, 0xC8, 0xC8,
-	0xC8, 0x7D, 0xE4, 0x91, 0x47, 0x9E, 0x8D, 0x89, 0x89, 0x89, 0x71, 0xBB,
-	0xDD, 0xA1, 0x7E, 0x62, 0xA3, 0x01, 0xEF, 0x1F, 0x8A, 0xBE, 0xDF, 0xEF,
-	0x07, 0xB3, 0xD9, 0x1C, 0xBB, 0x66, 0xCD, 0x9A, 0x87, 0x8E, 0x1E, 0x3D,
-	0x7A, 0xF0, 0xD2, 0xA5, 0x4B, 0x1D, 0xA3, 0x69, 0x86, 0x39, 0xA2, 0x60,
-	0xC5, 0xC6, 0xC6, 0x7E, 0xE3, 0x8D, 0x3D, 0x1E, 0x8F, 0x22, 0x2D, 0x2D,
-	0x6D, 0x4A, 0x49, 0x49, 0xC9, 0x0C, 0xA5, 0x52, 0xC9, 0x91, 0xCE, 0x76,
-	0x3C, 0xA1, 0xA0, 0x8F, 0xEB, 0x9A, 0xB3, 0x7C, 0x70, 0x09, 0x12, 0xDA,
-	0x80, 0xC2, 0xEF, 0xF7, 0x0B, 0x95, 0x95, 0x95, 0x3B, 0xF7, 0xEC, 0xD9,
-	0xF3, 0xAA, 0x46, 0xA3, 0x11, 0x70, 0x97, 0x5A, 0x04, 0x9D, 0xA1, 0xD8,
-	0x92, 0xE3, 0x66, 0x15, 0x34, 0xDF, 0x2E, 0x48, 0x92, 0x04, 0x26, 0x93,
-	0x09, 0x2A, 0x2A, 0x2A, 0x0E, 0x9E, 0x3F, 0x7F, 0xFE, 0xBC, 0x52, 0xA9,
-	0x6C, 0x0A, 0x04, 0x02, 0x4F, 0x27, 0x24, 0x24, 0xA4, 0x1B, 0x8D, 0x46,
-	0x05, 0xD6, 0x09, 0x92, 0x33, 0xDF, 0x68, 0xFC, 0x7C, 0xE8, 0x77, 0x04,
-	0x80, 0x50, 0x29, 0x05, 0x5A, 0x1F, 0x58, 0xE3, 0x98, 0x96, 0x96, 0x96,
-	0xF9, 0xBD, 0xEF, 0x7D, 0xEF, 0xA7, 0x6A, 0xB5, 0x5A, 0xDD, 0xD2, 0xD2,
-	0xF2, 0xAE, 0xD7, 0xEB, 0xED, 0x18, 0xEB, 0x44, 0x5D, 0x41, 0x10, 0x18,
-	0x49, 0x92, 0xD2, 0x8B, 0x8B, 0x8B, 0x9F, 0xDE, 0xB0, 0x61, 0xC3, 0xD3,
-	0x79, 0x79, 0x79, 0xA9, 0xE8, 0x7E, 0x40, 0xFF, 0x09, 0x2E, 0x07, 0xC9,
-	0xF6, 0xD0, 0x91, 0xCC, 0xCA, 0xE4, 0xD8, 0xC4, 0xB4, 0x1B, 0x6C, 0xFF,
-	0x22, 0x49, 0x12, 0xD8, 0x6C, 0x36, 0xA1, 0xA3, 0xA3, 0xE3, 0xD2, 0xB1,
-	0x63, 0xC7, 0xFE, 0xF8, 0xCA, 0x2B, 0xAF, 0xBC, 0xCE, 0xB2, 0x6C, 0xCF,
-	0xDC, 0xB9, 0x73, 0xEF, 0xD8, 0x71, 0x85, 0x56, 0x94, 0x56, 0xAB, 0x0D,
-	0x5D, 0x07, 0xD2, 0x27, 0x8A, 0x5F, 0x41, 0x8B, 0xD6, 0xBF, 0x6B, 0xD7,
-	0xAE, 0x3F, 0xE6, 0xE5, 0xE5, 0xA5, 0xCD, 0x9F, 0x3F, 0x7F, 0x03, 0xC7,
-	0x71, 0x9C, 0x52, 0xA9, 0x0C, 0xED, 0xD9, 0x78, 0xAD, 0xB1, 0x46, 0x3A,
-	0xDD, 0xC9, 0x54, 0x12, 0x9F, 0xCF, 0x07, 0x1A, 0x8D, 0x86, 0x2B, 0x2D,
-	0x2D, 0x9D, 0x9E, 0x9B, 0x9B, 0x3B, 0x91, 0x61, 0x98, 0x5E, 0x93, 0xC9,
-	0x24, 0x44, 0x7A, 0xCD, 0x47, 0xBC, 0xEB, 0x1B, 0x36, 0x6C, 0x18, 0xF2,
-	0x7F, 0x97, 0xCB, 0x05, 0x76, 0xBB, 0x3D, 0x31, 0x27, 0x27, 0x67, 0xAD,
-	0x46, 0xA3, 0x31, 0x01, 0x5C, 0xC9, 0x72, 0xC5, 0x7F, 0xAF, 0xA7, 0x2C,
-	0x01, 0x97, 0x23, 0x27, 0x4E, 0x9C, 0xA8, 0x3D, 0x70, 0xE0, 0xC0, 0xDB,
-	0x81, 0x40, 0xE0, 0x74, 0xB8, 0x93, 0x14, 0xE0, 0xF2, 0x03, 0xE6, 0xF1,
-	0x78, 0xC0, 0x6E, 0xB7, 0x43, 0x57, 0x57, 0x17, 0xB8, 0xDD, 0xEE, 0xDB,
-	0xA6, 0x04, 0xE2, 0x66, 0x81, 0x37, 0x9C, 0xE3, 0xB8, 0xEE, 0x40, 0x20,
-	0xF0, 0x9B, 0x43, 0x87, 0x0E, 0xF5, 0xE9, 0x74, 0xBA, 0x8D, 0xB3, 0x66,
-	0xCD, 0x9A, 0x96, 0x9A, 0x9A, 0xAA, 0xBF, 0x5E, 0xF1, 0x90, 0x24, 0x89,
-	0xAC, 0xC9, 0x0C, 0xBD, 0x0F, 0x59, 0x7E, 0x82, 0x13, 0x44, 0x7A, 0x7A,
-	0x7A, 0xFA, 0x8F, 0x7F, 0xFC, 0xE3, 0x9F, 0xBF, 0xF1, 0xC6, 0x1B, 0xB1,
-	0x0D, 0x0D, 0x0D, 0x7F, 0x90, 0x24, 0xA9, 0x79, 0xAC, 0x42, 0xFB, 0x41,
-	0x87, 0x77, 0x42, 0x66, 0x66, 0xE6, 0x63, 0x1B, 0x37, 0x6E, 0x7C, 0x3A,
-	0x2B, 0x2B, 0x2B, 0x15, 0xF3, 0xFF, 0xB0, 0x57, 0x19, 0xFA, 0x41, 0xF0,
-	0x61, 0xC3, 0xD2, 0xAE, 0xD1, 0xBC, 0x07, 0xE9, 0x2C, 0x46, 0xA1, 0x6B,
-	0x6F, 0x6F, 0x1F, 0x3C, 0x7E, 0xFC, 0xF8, 0x09, 0xA7, 0xD3, 0xF9, 0xA9,
-	0x28, 0x8A, 0xAF, 0xAB, 0xD5, 0x6A, 0x2F, 0xBE, 0xCF, 0x9D, 0x0A, 0xCB,
-	0xB2, 0xD0, 0xDB, 0xDB, 0x0B, 0x4D, 0x4D, 0x4D, 0x30, 0x30, 0x30, 0x00,
-	0x4E, 0xA7, 0x33, 0xB4, 0x7D, 0x3D, 0x39, 0xE1, 0xA1, 0xB1, 0x21, 0x93,
-	0xC9, 0x2E, 0x1C, 0x38, 0x70, 0xE0, 0x6D, 0xA3, 0xD1, 0x98, 0x3D, 0x6B,
-	0xD6, 0xAC, 0xE9, 0xA3, 0x2D, 0xD4, 0x27, 0x57, 0x51, 0x28, 0x5C, 0xF8,
-	0x1E, 0x46, 0xA3, 0x31, 0x66, 0xCD, 0x9A, 0x35, 0x6B, 0x9B, 0x9A, 0x9A,
-	0xAA, 0x19, 0x86, 0x69, 0x8F, 0xF4, 0x59, 0x1E, 0x51, 0xB0, 0x1E, 0x7B,
-	0xEC, 0xB1, 0x21, 0xFF, 0xFF, 0xFA, 0xEB, 0xAF, 0xE1, 0xF4, 0xE9, 0xD3,
-	0x19, 0x73, 0xE6, 0xCC, 0x59, 0x24, 0x97, 0xCB, 0x15, 0x38, 0x2B, 0x93,
-	0xB5, 0x6B, 0x68, 0xBA, 0x47, 0x62, 0x36, 0xA2, 0xBF, 0x04, 0x00, 0xA0,
-	0xAF, 0xAF, 0xCF, 0xFE, 0xE5, 0x97, 0x5F, 0x7E, 0xF8, 0xD9, 0x67, 0x9F,
-	0xED, 0x54, 0xA9, 0x54, 0x43, 0xEA, 0x0C, 0xD1, 0x21, 0xDC, 0xDF, 0xDF,
-	0x0F, 0x03, 0x03, 0x03, 0xD0, 0xDC, 0xDC, 0x0C, 0xD5, 0xD5, 0xD5, 0x50,
-	0x5E, 0x5E, 0x3E, 0x26, 0xBD, 0xAD, 0x6E, 0x77, 0x08, 0x7F, 0x93, 0x37,
-	0x10, 0x08, 0xBC, 0x7D, 0xEA, 0xD4, 0xA9, 0x76, 0x00, 0x78, 0x61, 0xF9,
-	0xF2, 0xE5, 0x8B, 0x8C, 0x46, 0x23, 0x87, 0x0E, 0x69, 0xB4, 0x8E, 0x00,
-	0xAE, 0x5D, 0xC0, 0x8A, 0xCB, 0x3F, 0xB7, 0xDB, 0x0D, 0x92, 0x24, 0x85,
-	0xAC, 0x5C, 0xF4, 0x27, 0xA2, 0x85, 0x85, 0x75, 0x88, 0x3A, 0x9D, 0xCE,
-	0xB4, 0x61, 0xC3, 0x86, 0xEF, 0x7C, 0xF6, 0xD9, 0x67, 0xAA, 0x9A, 0x9A,
-	0x9A, 0xDF, 0x8B, 0xA2, 0xD8, 0x10, 0xC9, 0xB9, 0x5F, 0x6B, 0x10, 0x0A,
-	0x82, 0x00, 0x89, 0x89, 0x89, 0x93, 0xE7, 0xCF, 0x9F, 0xBF, 0x2E, 0x3B,
-	0x3B, 0x3B, 0xD5, 0x6A, 0xB5, 0x82, 0x52, 0xA9, 0x0C, 0x25, 0x2D, 0xA2,
-	0x95, 0x85, 0x4B, 0x56, 0xB2, 0xB0, 0x36, 0x12, 0xF0, 0x61, 0xC4, 0xCF,
-	0x84, 0xA2, 0x3C, 0x30, 0x30, 0xE0, 0xDC, 0xBF, 0x7F, 0xFF, 0x9E, 0xDA,
-	0xDA, 0xDA, 0x57, 0xF2, 0xF3, 0xF3, 0xF7, 0xCA, 0x64, 0x32, 0x6F, 0x24,
-	0x6E, 0x8C, 0x68, 0x47, 0xA9, 0x54, 0xC2, 0x87, 0x1F, 0x7E, 0x08, 0x6E,
-	0xB7, 0x1B, 0x7C, 0x3E, 0x5F, 0xA8, 0x7E, 0x90, 0xDC, 0xF4, 0x02, 0xDB,
-	0xCE, 0x28, 0x14, 0x0A, 0xB0, 0x5A, 0xAD, 0xB0, 0x7B, 0xF7, 0xEE, 0xDD,
-	0x46, 0xA3, 0xB1, 0x78, 0xDC, 0xB8, 0x71, 0x65, 0x0A, 0x85, 0x42, 0x89,
-	0x93, 0xC8, 0xB5, 0x20, 0x9D, 0xEE, 0x78, 0x2F, 0xB1, 0xBC, 0x29, 0x78,
-	0x2E, 0xDC, 0xDC, 0xB9, 0x73, 0x97, 0x74, 0x74, 0x74, 0xFC, 0xE9, 0xDC,
-	0xB9, 0x73, 0xED, 0xA8, 0x05, 0xD7, 0x62, 0xC4, 0x3B, 0x1F, 0x7E, 0x00,
-	0x96, 0x65, 0x63, 0x18, 0x86, 0x99, 0x93, 0x9A, 0x9A, 0x9A, 0x8A, 0x37,
-	0x17, 0xAD, 0x23, 0xB2, 0xAE, 0x88, 0x5C, 0x1E, 0xE2, 0x00, 0xC3, 0x93,
-	0x24, 0x4D, 0x43, 0x32, 0x01, 0x70, 0xF3, 0xE6, 0xCD, 0x7F, 0xDE, 0xB9,
-	0x73, 0xE7, 0xBB, 0x5E, 0xAF, 0xD7, 0x1D, 0x7C, 0xAF, 0x6F, 0x5C, 0x14,
-	0x9C, 0xFD, 0x7C, 0x3E, 0x1F, 0x38, 0x1C, 0x8E, 0xD0, 0xC3, 0x75, 0xB7,
-	0x10, 0xB4, 0x0E, 0xBC, 0x00, 0xB0, 0x63, 0xCB, 0x96, 0x2D, 0xDD, 0xCD,
-	0xCD, 0xCD, 0xF5, 0x1B, 0x37, 0x6E, 0x7C, 0x20, 0x27, 0x27, 0x27, 0x19,
-	0x4D, 0x6D, 0xB2, 0xB8, 0x9C, 0x5C, 0x32, 0xA3, 0x05, 0x4C, 0x9A, 0xE8,
-	0x2C, 0xCB, 0x86, 0x7C, 0x41, 0x78, 0xAD, 0x83, 0xD9, 0xCF, 0x21, 0x91,
-	0xC4, 0xC9, 0xC3, 0x6E, 0xB7, 0x43, 0x52, 0x52, 0x92, 0x65, 0xC3, 0x86,
-	0x0D, 0x4F, 0xCA, 0x64, 0x32, 0x45, 0x75, 0x75, 0xF5, 0x4B, 0x92, 0x24,
-	0x5D, 0x53, 0xB4, 0xAE, 0x25, 0x58, 0x1A, 0x8D, 0x26, 0xA1, 0xB4, 0xB4,
-	0x74, 0xD6, 0x94, 0x29, 0x53, 0x4A, 0x64, 0x32, 0x19, 0xA8, 0xD5, 0xEA,
-	0x21, 0xBB, 0x14, 0x61, 0xEA, 0x01, 0x0A, 0x30, 0xD9, 0x91, 0x13, 0xE0,
-	0x9B, 0x8D, 0xE4, 0x48, 0x1F, 0x2A, 0x4E, 0x9E, 0xD8, 0xAA, 0x1A, 0xFF,
-	0xF6, 0xFC, 0xF9, 0xF3, 0x1D, 0xEF, 0xBF, 0xFF, 0xFE, 0x1B, 0xF5, 0xF5,
-	0xF5, 0xEF, 0x65, 0x64, 0x64, 0x9C, 0x93, 0xCB, 0xE5, 0x11, 0x2F, 0x47,
-	0xEE, 0x04, 0xFA, 0xFA, 0xFA, 0xA0, 0xB7, 0xB7, 0x37, 0x74, 0x9D, 0xF1,
-	0x5E, 0x93, 0xC9, 0xC7, 0xE4, 0xAA, 0x46, 0x10, 0x04, 0x61, 0xFB, 0xF6,
-	0xED, 0x1F, 0x9B, 0xCD, 0xE6, 0x71, 0x4F, 0x3D, 0xF5, 0xD4, 0x33, 0x64,
-	0xA7, 0x15, 0x7C, 0x8E, 0x47, 0x4A, 0x1A, 0xC7, 0xFB, 0x87, 0x90, 0x2B,
-	0x26, 0xB9, 0x5C, 0x0E, 0xA9, 0xA9, 0xA9, 0x99, 0x2C, 0xCB, 0x2E, 0xB0,
-	0xDB, 0xED, 0x0D, 0x0C, 0xC3, 0xF4, 0x45, 0x72, 0x1F, 0x22, 0x7E, 0xE2,
-	0x33, 0x32, 0x32, 0x72, 0x03, 0x81, 0xC0, 0x22, 0xCC, 0x85, 0x19, 0xEE,
-	0x24, 0x90, 0x91, 0xB2, 0x8B, 0xC9, 0x8B, 0x12, 0xF4, 0x45, 0x48, 0xA7,
-	0x4F, 0x9F, 0xAE, 0x3B, 0x79, 0xF2, 0xE4, 0x26, 0xBB, 0xDD, 0xDE, 0x8A,
-	0x4E, 0xBD, 0x91, 0xC2, 0xF3, 0xE4, 0x52, 0x05, 0xBB, 0x3B, 0xE2, 0xEC,
-	0x79, 0xA7, 0xCF, 0x8E, 0x88, 0x52, 0xA9, 0xF4, 0xD9, 0x6C, 0xB6, 0x93,
-	0x9F, 0x7E, 0xFA, 0x69, 0x77, 0x67, 0x67, 0xE7, 0xA5, 0x27, 0x9E, 0x78,
-	0xE2, 0xB9, 0x49, 0x93, 0x26, 0x15, 0x60, 0x95, 0x00, 0x00, 0x84, 0xCA,
-	0x6F, 0xD4, 0x6A, 0x35, 0xC8, 0xE5, 0x72, 0xCC, 0x18, 0x0F, 0x4D, 0x42,
-	0xD8, 0x2F, 0x8A, 0xB4, 0xC4, 0xC8, 0xE5, 0x12, 0xFE, 0x9F, 0xAC, 0x13,
-	0x73, 0xB9, 0x5C, 0x10, 0x1B, 0x1B, 0x6B, 0x5C, 0xBD, 0x7A, 0xF5, 0x43,
-	0x2A, 0x95, 0x4A, 0xD1, 0xD8, 0xD8, 0xF8, 0x5F, 0x2A, 0x95, 0xAA, 0x6E,
-	0x38, 0x5F, 0x22, 0xF6, 0x81, 0xDA, 0xB4, 0x69, 0x13, 0x2C, 0x5E, 0xBC,
-	0x18, 0x8A, 0x8A, 0x8A, 0x86, 0xFD, 0x2C, 0xB9, 0xB9, 0xB9, 0xB9, 0x7A,
-	0xBD, 0x7E, 0x1A, 0xC7, 0x71, 0x0A, 0xF4, 0x9D, 0x91, 0x22, 0x17, 0x9E,
-	0xC6, 0x40, 0xD6, 0xA3, 0xA2, 0x3F, 0x0A, 0xE0, 0xB2, 0xBB, 0x02, 0xAD,
-	0xC6, 0x60, 0xB4, 0x31, 0x94, 0xAE, 0x81, 0xA9, 0x1F, 0xC1, 0x5A, 0xC0,
-	0x6A, 0x9D, 0x4E, 0xF7, 0xDB, 0xFE, 0xFE, 0xFE, 0xAD, 0x1D, 0x1D, 0x1D,
-	0x9D, 0xF9, 0xF9, 0xF9, 0x37, 0x72, 0x2B, 0xA2, 0x02, 0x14, 0xA0, 0xF4,
-	0xF4, 0x74, 0x28, 0x2C, 0x2C, 0x84, 0xA2, 0xA2, 0xA2, 0xD0, 0xB2, 0x3F,
-	0x52, 0x3C, 0x1E, 0x4F, 0x8B, 0x4A, 0xA5, 0xFA, 0x73, 0x7D, 0x7D, 0xFD,
-	0xD4, 0xDC, 0xDC, 0xDC, 0x12, 0x95, 0x4A, 0xC5, 0x0C, 0x97, 0xD0, 0x1C,
-	0x5E, 0xD2, 0x04, 0x70, 0xF5, 0x49, 0x8B, 0x65, 0x59, 0x76, 0xDC, 0xB8,
-	0x71, 0x8B, 0x6A, 0x6B, 0x6B, 0x77, 0x5E, 0xB8, 0x70, 0xA1, 0x2F, 0x12,
-	0x17, 0xC7, 0x88, 0x82, 0xF5, 0xCA, 0x2B, 0xAF, 0x84, 0xBE, 0xE7, 0x79,
-	0x1E, 0x72, 0x73, 0x73, 0x27, 0xCE, 0x9C, 0x39, 0x73, 0xF2, 0xB5, 0x3F,
-	0x1E, 0x0C, 0x71, 0x92, 0x92, 0xFE, 0x2D, 0x1C, 0xFC, 0x58, 0x88, 0xCB,
-	0xF3, 0xBC, 0xEF, 0x8B, 0x2F, 0xBE, 0xF8, 0xB8, 0xB3, 0xB3, 0xB3, 0x3A,
-	0x36, 0x36, 0x36, 0xA2, 0x76, 0x20, 0x78, 0x51, 0xF6, 0xEE, 0xDD, 0x0B,
-	0x00, 0x00, 0xAD, 0xAD, 0xAD, 0xA1, 0xB5, 0xF8, 0x9D, 0xEE, 0xD3, 0x02,
-	0xB8, 0x3C, 0x38, 0x74, 0x3A, 0x1D, 0x34, 0x36, 0x36, 0x5E, 0xFA, 0xFA,
-	0xEB, 0xAF, 0x5F, 0xD5, 0x6A, 0xB5, 0xBD, 0x4E, 0xA7, 0xF3, 0xBB, 0xD3,
-	0xA7, 0x4F, 0x9F, 0xA3, 0x54, 0x2A, 0x43, 0xED, 0x6F, 0x51, 0xF8, 0x79,
-	0x9E, 0x0F, 0x59, 0x5C, 0xC1, 0x16, 0xD6, 0x11, 0x17, 0x06, 0xE3, 0xBD,
-	0x0A, 0x46, 0x8E, 0xC0, 0xEB, 0xF5, 0x42, 0x52, 0x52, 0x92, 0x79, 0xC5,
-	0x8A, 0x15, 0x0F, 0x1F, 0x3E, 0x7C, 0x58, 0x59, 0x51, 0x51, 0xF1, 0x92,
-	0xCB, 0xE5, 0xAA, 0x08, 0x04, 0x02, 0x12, 0x79, 0x3C, 0x74, 0x15, 0x1C,
-	0x3C, 0x78, 0x10, 0xB4, 0x5A, 0x2D, 0x18, 0x0C, 0x86, 0x61, 0x97, 0xA9,
-	0x06, 0x83, 0x21, 0x51, 0xAD, 0x56, 0x67, 0xB8, 0x5C, 0x2E, 0xD0, 0x6A,
-	0xB5, 0xA3, 0x7A, 0x88, 0x24, 0x49, 0x02, 0xA7, 0xD3, 0x19, 0x8A, 0x5C,
-	0x61, 0x3B, 0x19, 0x2C, 0x27, 0xC1, 0xF2, 0x2E, 0x8E, 0xE3, 0xC0, 0xED,
-	0x76, 0xC3, 0xA1, 0x43, 0x87, 0xF6, 0x74, 0x74, 0x74, 0xFC, 0x6E, 0xED,
-	0xDA, 0xB5, 0x9F, 0xA4, 0xA6, 0xA6, 0x8A, 0x75, 0x75, 0x75, 0x77, 0xB4,
-	0xBF, 0x0A, 0x00, 0x42, 0x4B, 0x32, 0x87, 0xC3, 0x01, 0x16, 0x8B, 0x05,
-	0x32, 0x33, 0x33, 0x47, 0x9C, 0x3C, 0xAE, 0xC5, 0xE9, 0xD3, 0xA7, 0x2B,
-	0xDE, 0x79, 0xE7, 0x9D, 0x8F, 0x7F, 0xF2, 0x93, 0x9F, 0x14, 0x68, 0x34,
-	0x1A, 0x25, 0xB9, 0xE1, 0x2C, 0x5A, 0x57, 0x38, 0xCE, 0x46, 0x43, 0x79,
-	0x79, 0xF9, 0xC4, 0x3D, 0x7B, 0xF6, 0x14, 0xEF, 0xDD, 0xBB, 0xF7, 0x68,
-	0x24, 0xD1, 0xC2, 0x11, 0x05, 0xEB, 0x4F, 0x7F, 0xFA, 0x53, 0x68, 0x00,
-	0xF5, 0xF4, 0xF4, 0x98, 0x9E, 0x7D, 0xF6, 0xD9, 0x92, 0x15, 0x2B, 0x56,
-	0x98, 0x22, 0x39, 0x89, 0xF0, 0x8C, 0x62, 0xB2, 0x04, 0x02, 0x4D, 0x76,
-	0x51, 0x14, 0xA5, 0xE6, 0xE6, 0xE6, 0x86, 0xDA, 0xDA, 0xDA, 0x6D, 0x36,
-	0x9B, 0x6D, 0xD0, 0x60, 0x30, 0x44, 0x72, 0xE8, 0x10, 0xDB, 0xB7, 0x6F,
-	0x0F, 0x1D, 0xF3, 0xC2, 0x85, 0x0B, 0xA3, 0x4E, 0x2A, 0x8C, 0x66, 0x82,
-	0xE5, 0x3C, 0xE0, 0xF1, 0x78, 0x1C, 0xF5, 0xF5, 0xF5, 0xEF, 0x28, 0x14,
-	0x8A, 0x1E, 0xA7, 0xD3, 0xF9, 0xC2, 0xB4, 0x69, 0xD3, 0x16, 0x59, 0x2C,
-	0x16, 0x2D, 0xB6, 0x5C, 0xC1, 0xBD, 0xF7, 0x54, 0x2A, 0x55, 0x28, 0x8D,
-	0x01, 0xFB, 0x45, 0x45, 0x22, 0xEE, 0x64, 0x16, 0x38, 0x1E, 0xCF, 0xE3,
-	0xF1, 0x40, 0x4C, 0x4C, 0x8C, 0x76, 0xF1, 0xE2, 0xC5, 0x0F, 0x79, 0x3C,
-	0x1E, 0x4D, 0x6E, 0x6E, 0xEE, 0x6F, 0xFA, 0xFB, 0xFB, 0x8F, 0x79, 0xBD,
-	0x5E, 0x11, 0x73, 0xF7, 0x70, 0x59, 0x80, 0x56, 0x70, 0x47, 0x47, 0x07,
-	0xB4, 0xB4, 0xB4, 0x7C, 0xC3, 0x1A, 0xF7, 0xFB, 0xFD, 0xAE, 0xB4, 0xB4,
-	0x34, 0x3B, 0xCE, 0xAC, 0x91, 0x06, 0x11, 0x70, 0xB9, 0x87, 0x9F, 0x07,
-	0x2D, 0x2B, 0xF4, 0xA5, 0xA2, 0xC0, 0x72, 0x1C, 0x07, 0x7D, 0x7D, 0x7D,
-	0xF6, 0xFD, 0xFB, 0xF7, 0xEF, 0xAA, 0xAA, 0xAA, 0xFA, 0x5D, 0x4E, 0x4E,
-	0xCE, 0xAE, 0xD1, 0x3A, 0xED, 0xA3, 0x19, 0x41, 0x10, 0xC0, 0x6C, 0x36,
-	0xC3, 0xBC, 0x79, 0xF3, 0xAE, 0x2B, 0x15, 0x84, 0x44, 0x14, 0x45, 0x9B,
-	0xD1, 0x68, 0xDC, 0xDE, 0xDD, 0xDD, 0xBD, 0xCE, 0x60, 0x30, 0x94, 0xB2,
-	0x2C, 0xCB, 0x90, 0x65, 0x61, 0xE8, 0x43, 0x25, 0xCB, 0x9C, 0x22, 0x99,
-	0x80, 0x62, 0x63, 0x63, 0x4D, 0x19, 0x19, 0x19, 0xE3, 0x2D, 0x16, 0x8B,
-	0x41, 0xAB, 0xD5, 0xDA, 0xAF, 0xF5, 0xFA, 0x11, 0x05, 0x2B, 0x37, 0x37,
-	0x37, 0x34, 0x03, 0x15, 0x16, 0x16, 0x4E, 0x2C, 0x2A, 0x2A, 0x2A, 0x8E,
-	0xF4, 0x24, 0xC2, 0x1F, 0x06, 0xB4, 0xB0, 0xD0, 0x29, 0x2C, 0x97, 0xCB,
-	0xA1, 0xAF, 0xAF, 0x6F, 0x60, 0xDB, 0xB6, 0x6D, 0x1F, 0xD9, 0x6C, 0xB6,
-	0xD3, 0xE8, 0x6B, 0x18, 0x0D, 0xE1, 0x7E, 0x8C, 0x68, 0x6A, 0x44, 0x37,
-	0x56, 0x60, 0xFE, 0x9B, 0x20, 0x08, 0xDB, 0x3F, 0xF8, 0xE0, 0x83, 0x8E,
-	0xA6, 0xA6, 0xA6, 0xAE, 0x07, 0x1F, 0x7C, 0x70, 0x63, 0x6C, 0x6C, 0xAC,
-	0x19, 0x7F, 0x8F, 0x16, 0x08, 0x5A, 0x1F, 0xD8, 0x23, 0x3F, 0x12, 0x30,
-	0xEC, 0x8D, 0x09, 0x9B, 0x61, 0xBB, 0xAB, 0x28, 0x56, 0xAD, 0x5A, 0x75,
-	0x6F, 0xB0, 0x55, 0xC9, 0x4B, 0x67, 0xCF, 0x9E, 0x3D, 0x2A, 0x08, 0x42,
-	0xE8, 0x26, 0xE2, 0x00, 0xCE, 0xCD, 0xCD, 0x05, 0xB9, 0x5C, 0x0E, 0xFB,
-	0xF6, 0xED, 0xFB, 0x46, 0x15, 0x84, 0xCB, 0xE5, 0xBA, 0x30, 0x73, 0xE6,
-	0xCC, 0xDA, 0x99, 0x33, 0x67, 0x96, 0xA1, 0x35, 0x38, 0xD2, 0x8E, 0xDC,
-	0x24, 0x78, 0x6C, 0x83, 0xC1, 0x30, 0x24, 0x52, 0x8D, 0x4B, 0x3F, 0xF4,
-	0x87, 0x75, 0x77, 0x77, 0x0F, 0xBE, 0xFF, 0xFE, 0xFB, 0x6F, 0x57, 0x54,
-	0x54, 0xFC, 0x3E, 0x27, 0x27, 0xA7, 0xFE, 0x6E, 0xF2, 0x79, 0x02, 0x5C,
-	0xCE, 0xA7, 0xCB, 0xCB, 0xCB, 0x83, 0x1F, 0xFF, 0xF8, 0xC7, 0x70, 0xA3,
-	0x75, 0xA1, 0xA5, 0xA5, 0xA5, 0x90, 0x94, 0x94, 0x74, 0xFA, 0x8B, 0x2F,
-	0xBE, 0xF8, 0x50, 0xAD, 0x56, 0xA7, 0x66, 0x65, 0x65, 0x59, 0x48, 0xD7,
-	0x4D, 0xB8, 0x1B, 0x28, 0xD2, 0x68, 0xA2, 0x24, 0x49, 0x90, 0x9E, 0x9E,
-	0x3E, 0x61, 0xE9, 0xD2, 0xA5, 0x13, 0xCD, 0x66, 0xF3, 0x35, 0x77, 0x8E,
-	0x1E, 0xF1, 0x0E, 0xEE, 0xD9, 0xB3, 0x27, 0x34, 0xB0, 0x9F, 0x7E, 0xFA,
-	0xE9, 0x09, 0x25, 0x25, 0x25, 0xE3, 0x71, 0x8B, 0xEF, 0x6B, 0x41, 0x66,
-	0x5D, 0x93, 0xBE, 0x10, 0xD2, 0xF9, 0x79, 0xE1, 0xC2, 0x85, 0x73, 0xDB,
-	0xB6, 0x6D, 0xFB, 0x70, 0x70, 0x70, 0xD0, 0xA1, 0x54, 0x2A, 0x43, 0x45,
-	0xCF, 0xD7, 0x0B, 0x69, 0x61, 0x85, 0xAF, 0xA3, 0xEF, 0x54, 0xD0, 0x62,
-	0xBD, 0x78, 0xF1, 0x22, 0xF0, 0x3C, 0x7F, 0x66, 0xF3, 0xE6, 0xCD, 0x7F,
-	0xDF, 0xD6, 0xD6, 0xD6, 0xFC, 0xFC, 0xF3, 0xCF, 0xBF, 0x98, 0x9A, 0x9A,
-	0x9A, 0x40, 0xF6, 0xBF, 0x42, 0x71, 0x23, 0xA3, 0x89, 0x91, 0x96, 0x50,
-	0x91, 0xBB, 0xF8, 0xEA, 0x74, 0xBA, 0xD0, 0xF2, 0x4B, 0xA7, 0xD3, 0xC9,
-	0xD7, 0xAC, 0x59, 0xB3, 0x8E, 0x61, 0x18, 0xE5, 0x6B, 0xAF, 0xBD, 0xF6,
-	0xDF, 0xA7, 0x4E, 0x9D, 0xDA, 0x23, 0x8A, 0xE2, 0x90, 0x75, 0x16, 0xC7,
-	0x71, 0xD0, 0xDB, 0xDB, 0x0B, 0x27, 0x4F, 0x9E, 0x0C, 0x59, 0x76, 0x38,
-	0xB8, 0xED, 0x76, 0x7B, 0x8B, 0xC9, 0x64, 0x3A, 0xE9, 0x76, 0xBB, 0x1F,
-	0xD4, 0x68, 0x34, 0x1C, 0xD9, 0x63, 0xFC, 0x6A, 0x84, 0x3F, 0x10, 0xA4,
-	0x63, 0x1D, 0x3F, 0x73, 0x4F, 0x4F, 0x8F, 0xF5, 0x77, 0xBF, 0xFB, 0xDD,
-	0x7F, 0xEF, 0xDB, 0xB7, 0xEF, 0xF7, 0x79, 0x79, 0x79, 0x3D, 0x77, 0xC3,
-	0x78, 0x40, 0xF0, 0x5E, 0xA1, 0x90, 0xDF, 0xA8, 0x75, 0x85, 0xF8, 0x7C,
-	0x3E, 0xC7, 0xB6, 0x6D, 0xDB, 0x3E, 0x4A, 0x4A, 0x4A, 0x5A, 0x99, 0x95,
-	0x95, 0x35, 0x03, 0xC7, 0x1F, 0xC0, 0xD0, 0x64, 0xDC, 0x48, 0x4B, 0xC4,
-	0x00, 0x2E, 0x5B, 0x81, 0xE9, 0xE9, 0xE9, 0x25, 0x19, 0x19, 0x19, 0x65,
-	0xE3, 0xC6, 0x8D, 0xDB, 0x7F, 0xAD, 0xBF, 0x1B, 0x51, 0xB0, 0x9C, 0x4E,
-	0x67, 0x68, 0x20, 0x24, 0x24, 0x24, 0x64, 0xA6, 0xA4, 0xA4, 0xC4, 0x8E,
-	0xC6, 0x8A, 0xC1, 0xE5, 0x04, 0xD9, 0xBA, 0x18, 0xD7, 0xBC, 0x4E, 0xA7,
-	0x93, 0x3F, 0x77, 0xEE, 0x5C, 0xAD, 0xCB, 0xE5, 0x6A, 0xC4, 0xA8, 0xC3,
-	0x8D, 0xFA, 0x13, 0xEE, 0xA6, 0x01, 0x49, 0x82, 0x49, 0x91, 0x2C, 0xCB,
-	0x4A, 0x7E, 0xBF, 0xBF, 0x7B, 0xCF, 0x9E, 0x3D, 0xAF, 0x33, 0x0C, 0xE3,
-	0x5B, 0xBF, 0x7E, 0xFD, 0x77, 0xA6, 0x4C, 0x99, 0x52, 0x84, 0x4E, 0x67,
-	0xB4, 0x70, 0x79, 0x9E, 0x1F, 0x12, 0x89, 0xBB, 0x1A, 0x18, 0xF2, 0xC6,
-	0x54, 0x15, 0x72, 0x69, 0x4F, 0x44, 0x7B, 0xE4, 0x2B, 0x56, 0xAC, 0x58,
-	0x1E, 0xB4, 0x90, 0x02, 0x15, 0x15, 0x15, 0xFB, 0xC2, 0xC7, 0x89, 0xD7,
-	0xEB, 0x05, 0x87, 0xC3, 0x31, 0x5C, 0x80, 0x46, 0x68, 0x6C, 0x6C, 0xDC,
-	0xB3, 0x63, 0xC7, 0x8E, 0xCF, 0x57, 0xAD, 0x5A, 0xB5, 0x5E, 0xAB, 0xD5,
-	0xB2, 0x91, 0x5A, 0xF0, 0x32, 0x99, 0x0C, 0x70, 0xEB, 0x79, 0x32, 0x7A,
-	0x28, 0x49, 0x12, 0x9C, 0x3E, 0x7D, 0xFA, 0xC2, 0x27, 0x9F, 0x7C, 0xF2,
-	0xC6, 0x9E, 0x3D, 0x7B, 0xDE, 0x90, 0x24, 0xA9, 0x27, 0x1A, 0xBA, 0xD2,
-	0xDE, 0x0C, 0x50, 0xB4, 0x7C, 0x3E, 0xDF, 0x35, 0x27, 0x81, 0x48, 0x10,
-	0x04, 0x01, 0xEC, 0x76, 0x7B, 0x63, 0x5D, 0x5D, 0xDD, 0x89, 0x99, 0x33,
-	0x67, 0x96, 0x18, 0x8D, 0x46, 0x1D, 0x8E, 0x2B, 0x1C, 0x67, 0xA4, 0x50,
-	0x46, 0x82, 0x5C, 0x2E, 0x87, 0x8C, 0x8C, 0x0C, 0x8B, 0x52, 0xA9, 0x4C,
-	0xBB, 0x21, 0xA7, 0xFB, 0xEB, 0xAF, 0xBF, 0x0E, 0x3E, 0x9F, 0x0F, 0xDE,
-	0x7E, 0xFB, 0xED, 0x14, 0x9D, 0x4E, 0x97, 0xCE, 0xB2, 0x2C, 0x13, 0xE9,
-	0x49, 0x90, 0xE1, 0x74, 0x00, 0xF8, 0x46, 0x34, 0xA1, 0xB1, 0xB1, 0xF1,
-	0xC2, 0xF1, 0xE3, 0xC7, 0xF7, 0x25, 0x25, 0x25, 0xF9, 0xC8, 0x64, 0xB2,
-	0x1B, 0x01, 0x1F, 0x06, 0xB4, 0x38, 0x9C, 0x4E, 0xE7, 0x5D, 0x63, 0x69,
-	0xE1, 0x83, 0xAA, 0x56, 0xAB, 0xC1, 0x6E, 0xB7, 0xF7, 0x1C, 0x3A, 0x74,
-	0xE8, 0x8D, 0xDE, 0xDE, 0x5E, 0xAB, 0xCF, 0xE7, 0xFB, 0xEE, 0xD4, 0xA9,
-	0x53, 0xA7, 0x61, 0xFB, 0x60, 0x1C, 0x54, 0xC3, 0x45, 0x73, 0x86, 0x03,
-	0x5F, 0x43, 0x96, 0x01, 0xA1, 0x78, 0xA1, 0x43, 0x5E, 0x2E, 0x97, 0x83,
-	0x52, 0xA9, 0xE4, 0x96, 0x2D, 0x5B, 0xB6, 0x54, 0x14, 0x45, 0xE9, 0x0F,
-	0x7F, 0xF8, 0x83, 0xD8, 0xD5, 0xD5, 0x75, 0x30, 0x10, 0x08, 0x48, 0xE4,
-	0x71, 0x50, 0xC4, 0x62, 0x63, 0x63, 0x43, 0xE2, 0x19, 0x7C, 0x98, 0xEA,
-	0x77, 0xEC, 0xD8, 0xF1, 0x92, 0x5A, 0xAD, 0xB6, 0xCC, 0x9B, 0x37, 0x6F,
-	0xAE, 0x52, 0xA9, 0xBC, 0xE6, 0x3A, 0x82, 0xCC, 0xC8, 0x07, 0x08, 0x15,
-	0x4C, 0x43, 0x20, 0x10, 0x80, 0x93, 0x27, 0x4F, 0x56, 0xFC, 0xF9, 0xCF,
-	0x7F, 0x7E, 0xB5, 0xBE, 0xBE, 0xFE, 0xC3, 0x40, 0x20, 0xD0, 0x8B, 0x5D,
-	0x06, 0xEE, 0x06, 0xF0, 0x79, 0x3B, 0x7A, 0xF4, 0x28, 0xF4, 0xF4, 0xF4,
-	0x40, 0x6E, 0x6E, 0x2E, 0xE8, 0x74, 0x3A, 0xF8, 0xFD, 0xEF, 0x7F, 0x3F,
-	0x26, 0xFB, 0x06, 0xB8, 0x5C, 0x2E, 0x50, 0xA9, 0x54, 0x42, 0x75, 0x75,
-	0xF5, 0xDE, 0xD3, 0xA7, 0x4F, 0xCF, 0x9D, 0x35, 0x6B, 0xD6, 0x44, 0x1C,
-	0x0B, 0x64, 0x6A, 0xC4, 0x68, 0xEA, 0x2F, 0x59, 0x96, 0x05, 0x93, 0xC9,
-	0xC4, 0x54, 0x57, 0x57, 0x67, 0x7C, 0xFD, 0xF5, 0xD7, 0x49, 0x2C, 0xCB,
-	0x76, 0xB2, 0x2C, 0x0B, 0x3F, 0xFE, 0xF1, 0x8F, 0x87, 0x7D, 0xFD, 0x88,
-	0x82, 0xB5, 0x76, 0xED, 0x5A, 0x00, 0x00, 0xA6, 0xB3, 0xB3, 0x73, 0xBC,
-	0x4E, 0xA7, 0x4B, 0x8B, 0xD4, 0x7F, 0x05, 0x00, 0x43, 0x7C, 0x55, 0x08,
-	0xE6, 0x5D, 0xB1, 0x2C, 0x0B, 0x3D, 0x3D, 0x3D, 0xB5, 0x6D, 0x6D, 0x6D,
-	0x7B, 0x30, 0xEC, 0x3E, 0xD6, 0x74, 0x75, 0x75, 0xC1, 0xC0, 0xC0, 0xC0,
-	0xA8, 0x94, 0xFE, 0x4E, 0x00, 0x45, 0x4B, 0x14, 0x45, 0xEB, 0xA1, 0x43,
-	0x87, 0x3E, 0x10, 0x04, 0x61, 0xD0, 0x66, 0xB3, 0xFD, 0xC5, 0xFC, 0xF9,
-	0xF3, 0xE7, 0x69, 0x34, 0x1A, 0x06, 0xCB, 0x2E, 0x22, 0x75, 0x3A, 0x63,
-	0x3E, 0x13, 0x2E, 0x29, 0xB1, 0xA4, 0x85, 0xAC, 0xB2, 0xC7, 0xDC, 0x38,
-	0xA5, 0x52, 0xA9, 0x5A, 0xBE, 0x7C, 0xF9, 0x72, 0x00, 0x60, 0x3E, 0xFB,
-	0xEC, 0x33, 0x19, 0xCB, 0xB2, 0x7B, 0xC9, 0xE5, 0x02, 0xC0, 0xE5, 0xBC,
-	0x1E, 0xAF, 0xD7, 0x0B, 0x31, 0x31, 0x31, 0x64, 0x87, 0x08, 0x7F, 0x7F,
-	0x7F, 0xFF, 0xE1, 0xBA, 0xBA, 0xBA, 0x7F, 0x4B, 0x4A, 0x4A, 0x8A, 0x2D,
-	0x28, 0x28, 0x28, 0x89, 0xA4, 0x3B, 0x07, 0x79, 0x3E, 0x72, 0xB9, 0x1C,
-	0x9C, 0x4E, 0xA7, 0xB8, 0x6F, 0xDF, 0xBE, 0x3D, 0xEF, 0xBE, 0xFB, 0xEE,
-	0xEF, 0xCE, 0x9E, 0x3D, 0xBB, 0x2B, 0x36, 0x36, 0xD6, 0x8E, 0x09, 0xB1,
-	0x77, 0x0B, 0x58, 0x18, 0x6E, 0xB7, 0xDB, 0x41, 0x14, 0x45, 0x98, 0x30,
-	0x61, 0x02, 0x04, 0x02, 0x01, 0x18, 0xAB, 0x88, 0x28, 0xCB, 0xB2, 0x90,
-	0x92, 0x92, 0x02, 0x3E, 0x9F, 0xEF, 0x90, 0xD5, 0x6A, 0x3D, 0x2D, 0x8A,
-	0xE2, 0x44, 0x80, 0x2B, 0x7B, 0x8F, 0x92, 0x7B, 0x6D, 0x46, 0x6A, 0x28,
-	0xA0, 0x75, 0x66, 0xB3, 0xD9, 0xB2, 0x4F, 0x9F, 0x3E, 0x3D, 0x41, 0x26,
-	0x93, 0x75, 0xC9, 0x64, 0xB2, 0x11, 0x4F, 0x76, 0x44, 0xB5, 0xD8, 0xBD,
-	0x7B, 0x37, 0x00, 0x00, 0x9B, 0x90, 0x90, 0x30, 0x39, 0x2B, 0x2B, 0x2B,
-	0x23, 0xBC, 0xBB, 0x65, 0x24, 0x1F, 0x8E, 0xCC, 0xBB, 0x02, 0xB8, 0x3C,
-	0xC8, 0xFA, 0xFA, 0xFA, 0xEC, 0x56, 0xAB, 0xB5, 0x2A, 0x33, 0x33, 0xB3,
-	0xF3, 0x66, 0x59, 0x40, 0x18, 0x45, 0x6B, 0x6D, 0x6D, 0x85, 0xAE, 0xAE,
-	0xAE, 0xD0, 0xB2, 0xF4, 0x6E, 0x18, 0xBC, 0x58, 0xC2, 0xC2, 0x30, 0x8C,
-	0xEB, 0xE8, 0xD1, 0xA3, 0x9F, 0xA5, 0xA7, 0xA7, 0x7B, 0xCD, 0x66, 0xB3,
-	0x33, 0x2F, 0x2F, 0x6F, 0x51, 0x6C, 0x6C, 0xAC, 0x1A, 0x45, 0x8B, 0x7C,
-	0x3D, 0x7E, 0x85, 0x77, 0xEC, 0xC4, 0xFB, 0x47, 0x56, 0x2F, 0x90, 0xED,
-	0xAB, 0xC9, 0xD7, 0xF2, 0x3C, 0x0F, 0x1A, 0x8D, 0x46, 0xB9, 0x62, 0xC5,
-	0x8A, 0x95, 0x5A, 0xAD, 0x16, 0x8E, 0x1C, 0x39, 0xC2, 0xB7, 0xB4, 0xB4,
-	0x1C, 0x45, 0x4B, 0x0B, 0xA3, 0x73, 0x7D, 0x7D, 0x7D, 0xA1, 0x3A, 0x49,
-	0x9C, 0xAC, 0x94, 0x4A, 0x65, 0x40, 0xA1, 0x50, 0x7C, 0xD5, 0xDE, 0xDE,
-	0x9E, 0xA4, 0xD3, 0xE9, 0xFE, 0x4F, 0x72, 0x72, 0x72, 0x3E, 0x76, 0xE9,
-	0x40, 0xCB, 0x2E, 0x3C, 0x29, 0x11, 0xDF, 0x97, 0x65, 0x59, 0x18, 0x1C,
-	0x1C, 0xF4, 0xD6, 0xD7, 0xD7, 0xEF, 0xD8, 0xBB, 0x77, 0xEF, 0x7F, 0xEF,
-	0xDE, 0xBD, 0x7B, 0x57, 0x52, 0x52, 0x12, 0xA8, 0x54, 0xAA, 0xD0, 0x32,
-	0xF4, 0x4E, 0x06, 0xEF, 0x1B, 0x56, 0x3C, 0xA8, 0xD5, 0x6A, 0x48, 0x4F,
-	0x4F, 0x1F, 0xD2, 0x67, 0x3E, 0x29, 0x29, 0x69, 0xCC, 0xDE, 0x2F, 0xE8,
-	0xC2, 0xE9, 0x71, 0x38, 0x1C, 0xD5, 0x1D, 0x1D, 0x1D, 0xAB, 0x53, 0x52,
-	0x52, 0x4C, 0xA4, 0x45, 0x45, 0xFE, 0x1B, 0xE9, 0xB5, 0xF7, 0xFB, 0xFD,
-	0x90, 0x98, 0x98, 0x98, 0xBE, 0x7E, 0xFD, 0xFA, 0xA9, 0x5A, 0xAD, 0x76,
-	0x07, 0xCB, 0xB2, 0x23, 0xCE, 0xA8, 0x23, 0x0A, 0xD6, 0xDF, 0xFE, 0xED,
-	0xDF, 0x82, 0x5A, 0xAD, 0x66, 0x5E, 0x78, 0xE1, 0x85, 0xA2, 0xEC, 0xEC,
-	0xEC, 0xF8, 0xD1, 0xD4, 0x10, 0xA1, 0x38, 0xE0, 0x49, 0x93, 0x99, 0xB1,
-	0xA7, 0x4F, 0x9F, 0xAE, 0x6F, 0x68, 0x68, 0xA8, 0x0E, 0xEE, 0x9E, 0x7D,
-	0xD3, 0xE0, 0x38, 0x0E, 0x3C, 0x1E, 0x0F, 0x74, 0x75, 0x75, 0x81, 0xDD,
-	0x6E, 0x07, 0x2C, 0xD4, 0xBE, 0x5B, 0x60, 0x18, 0x06, 0x94, 0x4A, 0xA5,
-	0xA8, 0x56, 0xAB, 0xB7, 0x55, 0x56, 0x56, 0x0E, 0xB4, 0xB6, 0xB6, 0x3A,
-	0x97, 0x2F, 0x5F, 0xBE, 0xD6, 0x64, 0x32, 0x69, 0x00, 0x60, 0x48, 0x8D,
-	0x57, 0x78, 0x27, 0x83, 0xF0, 0xDE, 0x53, 0xE1, 0x39, 0x56, 0xE1, 0xEF,
-	0x83, 0x59, 0xF3, 0xC1, 0x07, 0x46, 0x3E, 0x73, 0xE6, 0xCC, 0xE5, 0x4E,
-	0xA7, 0x53, 0xEA, 0xE8, 0xE8, 0xF8, 0x77, 0x95, 0x4A, 0x75, 0x54, 0x2E,
-	0x97, 0x07, 0xF0, 0xBD, 0x18, 0x86, 0x81, 0x81, 0x81, 0x01, 0x90, 0x24,
-	0x09, 0xCC, 0x66, 0x73, 0xE8, 0x18, 0x1C, 0xC7, 0x81, 0x56, 0xAB, 0x7D,
-	0x63, 0x70, 0x70, 0x50, 0xC1, 0x30, 0xCC, 0x5F, 0x25, 0x25, 0x25, 0x15,
-	0x28, 0x95, 0x4A, 0x86, 0x8C, 0x1C, 0x92, 0x16, 0x33, 0x8E, 0x2D, 0xAB,
-	0xD5, 0xEA, 0xD8, 0xBF, 0x7F, 0xFF, 0x97, 0x56, 0xAB, 0xF5, 0xB7, 0x6A,
-	0xB5, 0xFA, 0x08, 0x99, 0x7C, 0x7C, 0x37, 0x80, 0xE9, 0x2A, 0x98, 0xCA,
-	0x12, 0x08, 0x04, 0x42, 0xE3, 0xFD, 0x66, 0x52, 0x51, 0x51, 0x51, 0x1B,
-	0x1B, 0x1B, 0x7B, 0x36, 0x35, 0x35, 0x75, 0x06, 0x96, 0x72, 0x85, 0x4F,
-	0x28, 0x91, 0xFA, 0x23, 0x79, 0x9E, 0x07, 0xA3, 0xD1, 0x18, 0x9B, 0x93,
-	0x93, 0x53, 0xD0, 0xD3, 0xD3, 0x73, 0xD5, 0x28, 0xF6, 0x55, 0x5B, 0x24,
-	0x8B, 0xA2, 0xA8, 0xD3, 0x68, 0x34, 0x06, 0x8D, 0x46, 0x73, 0x5D, 0x96,
-	0x10, 0x99, 0x8F, 0x85, 0x0E, 0xF8, 0xAE, 0xAE, 0xAE, 0x96, 0xAA, 0xAA,
-	0xAA, 0xA6, 0xD1, 0xE6, 0x5D, 0x5D, 0x0F, 0xA2, 0x28, 0x42, 0x5C, 0x5C,
-	0x1C, 0x9C, 0x3A, 0x75, 0x2A, 0x94, 0xDC, 0x76, 0x37, 0x81, 0xD7, 0x9E,
-	0xE3, 0xB8, 0x63, 0xB5, 0xB5, 0xB5, 0xFF, 0xEC, 0xF3, 0xF9, 0x3C, 0xF7,
-	0xDE, 0x7B, 0xEF, 0x23, 0x3A, 0x9D, 0x8E, 0x73, 0xBB, 0xDD, 0xA0, 0x50,
-	0x28, 0x42, 0x05, 0xC6, 0xE8, 0xAB, 0xC2, 0xC9, 0x65, 0x34, 0x39, 0x6D,
-	0x78, 0x7F, 0xF1, 0x7B, 0x83, 0xC1, 0xC0, 0x2D, 0x5F, 0xBE, 0x7C, 0x35,
-	0xC7, 0x71, 0xAC, 0x4E, 0xA7, 0xFB, 0xE7, 0xFA, 0xFA, 0xFA, 0xA3, 0x28,
-	0x8A, 0x38, 0x1B, 0xF7, 0xF7, 0xF7, 0x03, 0x00, 0x80, 0xD1, 0x68, 0x04,
-	0x51, 0x14, 0xC1, 0xE9, 0x74, 0x82, 0xD5, 0x6A, 0x05, 0xBF, 0xDF, 0xFF,
-	0x46, 0x73, 0x73, 0x73, 0xAF, 0xC5, 0x62, 0xF9, 0xD9, 0xB4, 0x69, 0xD3,
-	0xCA, 0x95, 0x4A, 0x25, 0x83, 0xE7, 0x12, 0x5E, 0x5C, 0x6F, 0xB3, 0xD9,
-	0x1C, 0x1F, 0x7D, 0xF4, 0xD1, 0x9B, 0xED, 0xED, 0xED, 0xBF, 0xCB, 0xCF,
-	0xCF, 0x3F, 0x37, 0x5C, 0xD5, 0xC5, 0x9D, 0x8E, 0x4C, 0x26, 0x83, 0x96,
-	0x96, 0x16, 0xB0, 0x5A, 0xAD, 0x10, 0x17, 0x17, 0x07, 0x0E, 0x87, 0x03,
-	0xEA, 0xEB, 0xEB, 0x6F, 0xFA, 0xFB, 0x3A, 0x9D, 0xCE, 0xA6, 0x92, 0x92,
-	0x92, 0x56, 0x00, 0x98, 0x81, 0x4D, 0x3C, 0x71, 0x1C, 0x8C, 0x36, 0x27,
-	0x52, 0x2E, 0x97, 0x83, 0xC5, 0x62, 0x81, 0xB3, 0x67, 0xCF, 0xEA, 0xFF,
-	0xE3, 0x3F, 0xFE, 0x43, 0xEE, 0x76, 0xBB, 0x03, 0x4B, 0x97, 0x2E, 0x1D,
-	0xFE, 0xB5, 0x23, 0x1D, 0x44, 0xAD, 0x56, 0x83, 0x5A, 0xAD, 0x4E, 0xD5,
-	0x6A, 0xB5, 0x16, 0x9C, 0x55, 0x23, 0x55, 0x4D, 0xD2, 0xBA, 0x02, 0xB8,
-	0x32, 0x6B, 0x8B, 0xA2, 0x08, 0x2D, 0x2D, 0x2D, 0x67, 0x8E, 0x1F, 0x3F,
-	0xDE, 0xA4, 0xD7, 0xEB, 0x6F, 0xFA, 0xE0, 0xC2, 0x68, 0x12, 0x16, 0x60,
-	0x92, 0xD9, 0xF7, 0x77, 0x13, 0xC1, 0x12, 0x95, 0xDA, 0xBA, 0xBA, 0xBA,
-	0x7F, 0x17, 0x04, 0x81, 0x5F, 0xBA, 0x74, 0xE9, 0xC3, 0xC9, 0xC9, 0xC9,
-	0x06, 0x72, 0x36, 0xC4, 0x6B, 0x44, 0x26, 0x01, 0x46, 0xBA, 0x64, 0xC7,
-	0xFE, 0xDF, 0x64, 0x70, 0x45, 0xA7, 0xD3, 0xC9, 0x16, 0x2F, 0x5E, 0xBC,
-	0xFC, 0xD0, 0xA1, 0x43, 0xF6, 0x5D, 0xBB, 0x76, 0xF9, 0x38, 0x8E, 0xAB,
-	0x20, 0x05, 0x07, 0x97, 0x96, 0x1C, 0xC7, 0x81, 0xC3, 0xE1, 0x80, 0x6D,
-	0xDB, 0xB6, 0x61, 0x23, 0x48, 0xC1, 0xE1, 0x70, 0x7C, 0x99, 0x95, 0x95,
-	0xC5, 0x03, 0xC0, 0xCF, 0x66, 0xCF, 0x9E, 0x3D, 0x17, 0xEB, 0x19, 0x83,
-	0xCD, 0x0D, 0x81, 0x61, 0x18, 0xE8, 0xE8, 0xE8, 0xE8, 0x7C, 0xFD, 0xF5,
-	0xD7, 0x7F, 0xDF, 0xD6, 0xD6, 0xF6, 0x66, 0x7A, 0x7A, 0xFA, 0xA5, 0xBB,
-	0x25, 0x69, 0x18, 0x41, 0x51, 0xB0, 0x5A, 0xAD, 0xD0, 0xD8, 0xD8, 0x08,
-	0x3E, 0x9F, 0x2F, 0x94, 0xD2, 0xF1, 0x6D, 0xE4, 0x24, 0x3A, 0x9D, 0xCE,
-	0x16, 0xAB, 0xD5, 0x7A, 0x16, 0xFB, 0x86, 0x91, 0xD7, 0x7F, 0xB4, 0xD6,
-	0x2D, 0x3E, 0x93, 0x4A, 0xA5, 0x32, 0x66, 0x60, 0x60, 0x20, 0xD9, 0xE1,
-	0x70, 0x34, 0x8F, 0xF8, 0xDA, 0x91, 0x7E, 0x61, 0xB1, 0x58, 0x64, 0x1A,
-	0x8D, 0x26, 0x43, 0xAF, 0xD7, 0x5B, 0xC8, 0x13, 0x19, 0x8D, 0x60, 0x21,
-	0xF8, 0x37, 0xBD, 0xBD, 0xBD, 0xFD, 0xED, 0xED, 0xED, 0x2D, 0x83, 0x83,
-	0x83, 0xC2, 0x58, 0xEE, 0xCA, 0x1B, 0x09, 0xB8, 0xBE, 0xBF, 0x9B, 0x32,
-	0xE2, 0x49, 0x38, 0x8E, 0x03, 0xBF, 0xDF, 0x7F, 0xB6, 0xAE, 0xAE, 0xEE,
-	0xD7, 0x0E, 0x87, 0xC3, 0xB5, 0x61, 0xC3, 0x86, 0xA7, 0x53, 0x53, 0x53,
-	0xCD, 0x00, 0x30, 0x24, 0xE2, 0x87, 0xBE, 0xA6, 0xD1, 0xB8, 0x00, 0xC8,
-	0x4E, 0x94, 0x28, 0x76, 0xC1, 0x72, 0x1B, 0xC5, 0xB8, 0x71, 0xE3, 0xEE,
-	0x99, 0x35, 0x6B, 0x96, 0x4C, 0x26, 0x93, 0xFD, 0xA7, 0x42, 0xA1, 0x38,
-	0x8E, 0x5D, 0x21, 0xF0, 0x7E, 0x48, 0x92, 0x04, 0x1D, 0x1D, 0x1D, 0xD0,
-	0xDD, 0xDD, 0x1D, 0xDA, 0x8C, 0xC4, 0xEB, 0xF5, 0x0A, 0x26, 0x93, 0x69,
-	0x7B, 0x6D, 0x6D, 0xAD, 0xF5, 0xD4, 0xA9, 0x53, 0xAB, 0xB2, 0xB2, 0xB2,
-	0xA6, 0x67, 0x66, 0x66, 0xE6, 0xC9, 0xE5, 0x72, 0x59, 0x6F, 0x6F, 0x6F,
-	0x4F, 0x4B, 0x4B, 0xCB, 0xD9, 0xBA, 0xBA, 0xBA, 0x3D, 0x17, 0x2E, 0x5C,
-	0xF8, 0x22, 0x21, 0x21, 0xA1, 0x3B, 0xDA, 0xF6, 0xA8, 0x1C, 0x0B, 0xF0,
-	0xDE, 0xB8, 0x5C, 0xAE, 0x50, 0x93, 0x4B, 0xAC, 0x25, 0xFD, 0x36, 0x10,
-	0x04, 0x41, 0xE8, 0xEB, 0xEB, 0x6B, 0xE9, 0xED, 0xED, 0x1D, 0x48, 0x48,
-	0x48, 0x88, 0x21, 0x9F, 0xE5, 0xD1, 0x96, 0x58, 0xE1, 0xEB, 0xF5, 0x7A,
-	0xBD, 0x39, 0x35, 0x35, 0x35, 0xD3, 0xE5, 0x72, 0xB5, 0x02, 0xC0, 0xB0,
-	0xAA, 0x3B, 0xA2, 0x60, 0x65, 0x66, 0x66, 0x2A, 0x54, 0x2A, 0x55, 0x8A,
-	0x46, 0xA3, 0xD1, 0x01, 0x5C, 0xD9, 0x65, 0x25, 0xD2, 0x93, 0x20, 0xFF,
-	0xC5, 0x99, 0xBA, 0xA1, 0xA1, 0xE1, 0x9C, 0x56, 0xAB, 0x6D, 0x5B, 0xBD,
-	0x7A, 0xF5, 0x98, 0x6E, 0xCF, 0x1E, 0x29, 0xD8, 0xFF, 0xA9, 0xA9, 0xA9,
-	0x69, 0xD4, 0xCB, 0x9E, 0x68, 0x07, 0x9D, 0xF1, 0x81, 0x40, 0xA0, 0xB1,
-	0xB6, 0xB6, 0xF6, 0xB7, 0x5E, 0xAF, 0xD7, 0xF1, 0xD8, 0x63, 0x8F, 0x3D,
-	0x9F, 0x92, 0x92, 0x92, 0x88, 0x91, 0x36, 0xCC, 0xB5, 0x1A, 0x6D, 0x80,
-	0x05, 0x00, 0x86, 0xE4, 0xE0, 0x60, 0x39, 0x16, 0xCF, 0xF3, 0x90, 0x92,
-	0x92, 0xA2, 0xDB, 0xB8, 0x71, 0xE3, 0xBD, 0x49, 0x49, 0x49, 0xB2, 0x8A,
-	0x8A, 0x8A, 0x7F, 0x05, 0x80, 0x53, 0x1E, 0x8F, 0xE7, 0x1B, 0xAF, 0xEB,
-	0xE8, 0xE8, 0x00, 0x80, 0x2B, 0x1D, 0x2A, 0x0D, 0x06, 0x83, 0xDF, 0xE5,
-	0x72, 0x1D, 0x39, 0x72, 0xE4, 0xC8, 0x39, 0xB7, 0xDB, 0x5D, 0x58, 0x5B,
-	0x5B, 0x9B, 0x6E, 0x34, 0x1A, 0x59, 0x83, 0xC1, 0x30, 0x70, 0xEC, 0xD8,
-	0xB1, 0xD6, 0xDA, 0xDA, 0xDA, 0xC6, 0x84, 0x84, 0x04, 0x5F, 0xB4, 0xEE,
-	0x51, 0x79, 0xBD, 0x60, 0x41, 0xF7, 0x85, 0x0B, 0x17, 0xC0, 0x6C, 0x36,
-	0xC3, 0xFC, 0xF9, 0xF3, 0xC1, 0x68, 0x34, 0x7E, 0xEB, 0xD7, 0x20, 0x68,
-	0x21, 0xB7, 0x37, 0x36, 0x36, 0x36, 0x24, 0x27, 0x27, 0xCF, 0x00, 0xB8,
-	0x12, 0x5C, 0xC3, 0x49, 0x2B, 0x52, 0x37, 0x12, 0x8A, 0x96, 0x4A, 0xA5,
-	0xD2, 0xA4, 0xA5, 0xA5, 0x25, 0x7B, 0x3C, 0x1E, 0x19, 0x8C, 0x56, 0xB0,
-	0x32, 0x32, 0x32, 0xE4, 0x1C, 0xC7, 0x25, 0xA8, 0x82, 0x8D, 0x72, 0x46,
-	0x63, 0x66, 0x92, 0xD9, 0xAE, 0xE4, 0x85, 0x3C, 0x77, 0xEE, 0x5C, 0xBD,
-	0xD7, 0xEB, 0x6D, 0x2B, 0x2C, 0x2C, 0x8C, 0xF8, 0x58, 0x63, 0x89, 0x24,
-	0x49, 0x60, 0xB5, 0x5A, 0x61, 0xFF, 0xFE, 0xFD, 0x10, 0x1B, 0x1B, 0x1B,
-	0x5A, 0x22, 0xDE, 0x2D, 0x60, 0x74, 0x8F, 0xE3, 0xB8, 0xD6, 0x23, 0x47,
-	0x8E, 0xFC, 0xD6, 0xEB, 0xF5, 0x5A, 0x1F, 0x7F, 0xFC, 0xF1, 0x1F, 0x66,
-	0x67, 0x67, 0xE7, 0xE2, 0x92, 0x8E, 0x14, 0xAB, 0xD1, 0x38, 0x4E, 0xC3,
-	0xB3, 0xE9, 0xB1, 0x04, 0x88, 0xE7, 0x79, 0x30, 0x18, 0x0C, 0xAA, 0x99,
-	0x33, 0x67, 0xDE, 0x63, 0xB3, 0xD9, 0x84, 0x9A, 0x9A, 0x9A, 0x7F, 0xF7,
-	0x78, 0x3C, 0x55, 0x38, 0x61, 0x71, 0x1C, 0x07, 0xC9, 0xC9, 0xC9, 0x60,
-	0xB7, 0xDB, 0xA1, 0xA5, 0xA5, 0x65, 0x48, 0xC7, 0x09, 0x99, 0x4C, 0x06,
-	0x46, 0xA3, 0xB1, 0x5F, 0xA5, 0x52, 0x1D, 0xDA, 0xBB, 0x77, 0xEF, 0xA1,
-	0xCC, 0xCC, 0x4C, 0x98, 0x3F, 0x7F, 0x3E, 0x68, 0xB5, 0xDA, 0x50, 0xCF,
-	0xAC, 0xBB, 0x4D, 0xAC, 0x18, 0x86, 0x81, 0x96, 0x96, 0x16, 0xE8, 0xEF,
-	0xEF, 0x07, 0x51, 0x14, 0x21, 0x27, 0x27, 0xE7, 0x96, 0x94, 0xA5, 0x05,
-	0x03, 0x1E, 0x17, 0x9B, 0x9A, 0x9A, 0xCE, 0xCE, 0x9F, 0x3F, 0x7F, 0x06,
-	0x00, 0x84, 0xF2, 0xB1, 0xC2, 0xBF, 0xBF, 0x16, 0x38, 0xCE, 0x14, 0x0A,
-	0x85, 0x3A, 0x25, 0x25, 0x25, 0x89, 0xE7, 0x79, 0x05, 0x00, 0x0C, 0x6B,
-	0x2E, 0x8E, 0xF8, 0xB4, 0x26, 0x24, 0x24, 0xC8, 0x15, 0x0A, 0x45, 0x82,
-	0x52, 0xA9, 0x0C, 0xED, 0x46, 0x1C, 0xE9, 0x8C, 0x3B, 0x5C, 0xA4, 0x40,
-	0x92, 0x24, 0xA9, 0xBD, 0xBD, 0xBD, 0xB5, 0xAA, 0xAA, 0xAA, 0xE7, 0xDB,
-	0x70, 0xB8, 0x5F, 0x0D, 0x4C, 0x3A, 0x8C, 0x8F, 0x8F, 0x07, 0x80, 0xBB,
-	0x2F, 0x4B, 0x3E, 0xD8, 0x94, 0x6F, 0xE0, 0xA3, 0x8F, 0x3E, 0x7A, 0x69,
-	0x70, 0x70, 0xD0, 0xF9, 0x93, 0x9F, 0xFC, 0xE4, 0x17, 0x29, 0x29, 0x29,
-	0x99, 0x18, 0x49, 0xC5, 0x65, 0xE1, 0x68, 0x92, 0xFF, 0x50, 0x68, 0x30,
-	0xCF, 0x0B, 0xAD, 0x36, 0x9F, 0xCF, 0x07, 0x6E, 0xB7, 0x1B, 0x0C, 0x06,
-	0x03, 0xB7, 0x74, 0xE9, 0xD2, 0xB5, 0x7E, 0xBF, 0x9F, 0x39, 0x79, 0xF2,
-	0xE4, 0xAF, 0x78, 0x9E, 0xAF, 0xC3, 0x7E, 0x5B, 0x3A, 0x9D, 0x0E, 0x4A,
-	0x4B, 0x4B, 0x81, 0x61, 0x18, 0x68, 0x6E, 0x6E, 0x06, 0xB7, 0xDB, 0xFD,
-	0x8D, 0x5C, 0x31, 0xA5, 0x52, 0x19, 0x12, 0xC3, 0xBB, 0x11, 0x1C, 0xA3,
-	0x9D, 0x9D, 0x9D, 0xD0, 0xD3, 0xD3, 0x33, 0xC4, 0x67, 0x78, 0xAB, 0xB0,
-	0xD9, 0x6C, 0xDD, 0x89, 0x89, 0x89, 0xCD, 0xA2, 0x28, 0x4A, 0x32, 0x99,
-	0x8C, 0x21, 0x83, 0x6C, 0x91, 0x42, 0x26, 0x9E, 0x2A, 0x95, 0x4A, 0x4D,
-	0x72, 0x72, 0x72, 0xB2, 0xCF, 0xE7, 0x1B, 0x71, 0xF9, 0x75, 0x35, 0x1F,
-	0x96, 0x5C, 0x2E, 0x97, 0x5B, 0x94, 0x44, 0x4E, 0xFF, 0x68, 0x2E, 0x50,
-	0x78, 0x2E, 0x4F, 0x20, 0x10, 0x10, 0xFA, 0xFB, 0xFB, 0xFB, 0xDA, 0xDB,
-	0xDB, 0x9D, 0x2E, 0x97, 0x2B, 0xE2, 0xE3, 0xDC, 0x0C, 0xF0, 0xDC, 0x3A,
-	0x3A, 0x3A, 0x20, 0x2E, 0x2E, 0xEE, 0xAE, 0x73, 0xC2, 0x23, 0x7A, 0xBD,
-	0x1E, 0x3E, 0xF9, 0xE4, 0x93, 0xB7, 0x44, 0x51, 0xB4, 0xFD, 0xE2, 0x17,
-	0xBF, 0xF8, 0x83, 0x4A, 0xA5, 0xB2, 0xA0, 0xD5, 0x82, 0x2D, 0x80, 0x22,
-	0x21, 0x3C, 0xB7, 0x8B, 0x61, 0x98, 0x50, 0xE7, 0x04, 0x95, 0x4A, 0x15,
-	0xEA, 0xF2, 0x60, 0xB1, 0x58, 0x74, 0x1B, 0x36, 0x6C, 0xD8, 0xE0, 0xF1,
-	0x78, 0xAC, 0xB5, 0xB5, 0xB5, 0xFF, 0x25, 0x08, 0xC2, 0xF9, 0xA0, 0x6F,
-	0x0D, 0x38, 0x8E, 0x83, 0x49, 0x93, 0x26, 0x01, 0x00, 0xC0, 0xB9, 0x73,
-	0xE7, 0x40, 0xAD, 0x56, 0xDF, 0xF2, 0x07, 0xF2, 0x76, 0x82, 0x61, 0x18,
-	0xE8, 0xEF, 0xEF, 0x87, 0xFE, 0xFE, 0xFE, 0x21, 0x89, 0xBB, 0xB7, 0x12,
-	0x9B, 0xCD, 0xE6, 0xEC, 0xEB, 0xEB, 0xEB, 0xF1, 0x78, 0x3C, 0x6E, 0x9D,
-	0x4E, 0xA7, 0x25, 0x9B, 0x43, 0x8E, 0xE6, 0xDE, 0xA1, 0x85, 0xC8, 0x71,
-	0x9C, 0x3A, 0x3E, 0x3E, 0x3E, 0xD9, 0xEF, 0xF7, 0x8F, 0x5E, 0xB0, 0xCC,
-	0x66, 0x33, 0xCB, 0x30, 0x8C, 0x41, 0x11, 0x1C, 0x89, 0xA3, 0xD9, 0x24,
-	0x15, 0xE0, 0x9B, 0x05, 0xAA, 0x82, 0x20, 0x78, 0xBC, 0x5E, 0xAF, 0xD3,
-	0xE3, 0xF1, 0xF8, 0x6F, 0x87, 0xD6, 0xC6, 0xB8, 0x5C, 0xF5, 0x7A, 0xBD,
-	0xA1, 0x66, 0x6F, 0x77, 0x1B, 0xC1, 0xA8, 0x5C, 0x60, 0xF7, 0xEE, 0xDD,
-	0x9F, 0x73, 0x1C, 0xA7, 0xFD, 0xD1, 0x8F, 0x7E, 0xF4, 0xFF, 0xF4, 0x7A,
-	0x7D, 0xB2, 0xDB, 0xED, 0x1E, 0xD5, 0xC6, 0x16, 0x64, 0x1F, 0x78, 0xB4,
-	0xD2, 0x70, 0x93, 0x0C, 0x8C, 0x04, 0xE2, 0x78, 0x50, 0xAB, 0xD5, 0x8A,
-	0x0D, 0x1B, 0x36, 0x3C, 0xCA, 0xB2, 0xAC, 0x58, 0x59, 0x59, 0xF9, 0x3B,
-	0x85, 0x42, 0x51, 0x8F, 0xF7, 0x42, 0xA1, 0x50, 0x40, 0x41, 0x41, 0x01,
-	0xA4, 0xA4, 0xA4, 0x40, 0x4A, 0x4A, 0x4A, 0xC8, 0x9F, 0x76, 0xAB, 0x1F,
-	0xCC, 0x5B, 0x0D, 0xCB, 0xB2, 0xE0, 0x70, 0x38, 0xC0, 0x6A, 0xB5, 0x86,
-	0xAE, 0xF5, 0xED, 0x70, 0x4D, 0xBC, 0x5E, 0xAF, 0xE8, 0x76, 0xBB, 0x1D,
-	0x1E, 0x8F, 0xC7, 0xA9, 0xD3, 0xE9, 0xB4, 0x00, 0x30, 0xAA, 0xE8, 0x32,
-	0xBE, 0x1E, 0xBF, 0x14, 0x0A, 0x85, 0xC2, 0x6C, 0x36, 0xC7, 0xF8, 0xFD,
-	0xFE, 0x11, 0x1F, 0xC6, 0x11, 0x05, 0x2B, 0x39, 0x39, 0x59, 0xE6, 0xF3,
-	0xF9, 0x8C, 0x00, 0x23, 0x6F, 0x5B, 0x7F, 0xB5, 0x8B, 0x16, 0x9E, 0x9D,
-	0x6C, 0xB7, 0xDB, 0x3D, 0x1E, 0x8F, 0xA7, 0xDB, 0xEF, 0xF7, 0xDF, 0xF4,
-	0xA4, 0xB6, 0xD1, 0xC0, 0xF3, 0x3C, 0x48, 0x92, 0xF4, 0x8D, 0x96, 0xD0,
-	0x77, 0x03, 0xE8, 0x6B, 0x02, 0x00, 0xE1, 0xD0, 0xA1, 0x43, 0x9B, 0x18,
-	0x86, 0x61, 0x9E, 0x7C, 0xF2, 0xC9, 0xBF, 0x29, 0x2A, 0x2A, 0x2A, 0xF0,
-	0xF9, 0x7C, 0xE0, 0xF3, 0xF9, 0x00, 0x9D, 0xDA, 0xE4, 0xFE, 0x93, 0xA4,
-	0x53, 0x15, 0x7D, 0x4D, 0xE8, 0xF7, 0xC2, 0xC1, 0x4A, 0x3E, 0x54, 0x38,
-	0x78, 0x05, 0x41, 0x00, 0xB7, 0xDB, 0x0D, 0x31, 0x31, 0x31, 0x86, 0x7B,
-	0xEE, 0xB9, 0xE7, 0x31, 0x86, 0x61, 0x64, 0x55, 0x55, 0x55, 0xFF, 0xA9,
-	0x54, 0x2A, 0xCF, 0x63, 0x56, 0xBB, 0x4A, 0xA5, 0x02, 0x9D, 0x4E, 0x07,
-	0x56, 0xAB, 0x15, 0xCE, 0x9F, 0x3F, 0x8F, 0x1B, 0x7C, 0xDE, 0x16, 0x0F,
-	0xE8, 0xAD, 0x02, 0xBB, 0xA8, 0xA2, 0xD5, 0x7A, 0xBB, 0x20, 0x08, 0x02,
-	0xF8, 0x7C, 0xBE, 0x3E, 0x9F, 0xCF, 0xC7, 0x03, 0xC0, 0x90, 0x7B, 0x3F,
-	0x1A, 0xF0, 0xFE, 0xCA, 0x64, 0x32, 0xB0, 0x58, 0x2C, 0x06, 0x51, 0x14,
-	0x47, 0x54, 0xBB, 0x11, 0x05, 0xEB, 0x8F, 0x7F, 0xFC, 0x23, 0xF3, 0xF0,
-	0xC3, 0x0F, 0xAB, 0xAE, 0xB7, 0xCA, 0x9B, 0x54, 0x58, 0xBF, 0xDF, 0x0F,
-	0x6E, 0xB7, 0xDB, 0xB3, 0x60, 0xC1, 0x02, 0x67, 0x61, 0x61, 0x21, 0x44,
-	0x52, 0x2B, 0xF6, 0x6D, 0xA2, 0xD5, 0x6A, 0xA1, 0xBA, 0xBA, 0x1A, 0xB6,
-	0x6D, 0xDB, 0x06, 0xA3, 0xD9, 0x23, 0xED, 0x4E, 0x00, 0xC5, 0x9A, 0x65,
-	0x59, 0x7E, 0xFF, 0xFE, 0xFD, 0xEF, 0xFA, 0x7C, 0x3E, 0xDF, 0xF3, 0xCF,
-	0x3F, 0xFF, 0x77, 0x45, 0x45, 0x45, 0xE3, 0xBC, 0x5E, 0x2F, 0x38, 0x9D,
-	0x4E, 0xD0, 0x68, 0x34, 0xA4, 0xA5, 0x0C, 0x00, 0x57, 0x1C, 0xED, 0x58,
-	0x16, 0x82, 0x90, 0x96, 0x6A, 0xB8, 0xD5, 0x8A, 0x3E, 0x2D, 0x97, 0xCB,
-	0x05, 0x71, 0x71, 0x71, 0xC6, 0x15, 0x2B, 0x56, 0x3C, 0xA8, 0x54, 0x2A,
-	0x99, 0xEA, 0xEA, 0xEA, 0x97, 0x64, 0x32, 0xD9, 0x59, 0xAC, 0x2F, 0x0C,
-	0x3A, 0x74, 0xA1, 0xBD, 0xBD, 0x1D, 0x62, 0x62, 0x62, 0xE0, 0xFC, 0xF9,
-	0xF3, 0x30, 0x38, 0x38, 0x08, 0xF9, 0xF9, 0xF9, 0xB7, 0xDD, 0xD8, 0xB9,
-	0x99, 0x48, 0x92, 0x04, 0x2E, 0x97, 0x0B, 0x66, 0xCD, 0x9A, 0x05, 0xE3,
-	0xC7, 0x8F, 0x07, 0xB7, 0xDB, 0x7D, 0xAB, 0x4F, 0x69, 0x08, 0x3E, 0x9F,
-	0x0F, 0x92, 0x93, 0x93, 0x3D, 0x3E, 0x9F, 0xCF, 0x4F, 0xEE, 0x9A, 0x35,
-	0x5A, 0xC1, 0x22, 0x2B, 0x2A, 0x54, 0x2A, 0x95, 0x82, 0xE3, 0xB8, 0xD1,
-	0x0B, 0xD6, 0x3B, 0xEF, 0xBC, 0xA3, 0x58, 0xB7, 0x6E, 0x9D, 0x9C, 0x34,
-	0xE7, 0x47, 0x0B, 0x99, 0xE5, 0xCE, 0xF3, 0xBC, 0x67, 0xF2, 0xE4, 0xC9,
-	0xE2, 0xED, 0x18, 0x86, 0x56, 0x2A, 0x95, 0x90, 0x9A, 0x9A, 0x0A, 0xED,
-	0xED, 0xED, 0x70, 0xFA, 0xF4, 0xE9, 0x88, 0x5A, 0x35, 0x8F, 0x16, 0xDC,
-	0x89, 0xE4, 0xDB, 0x06, 0x77, 0x47, 0xB9, 0xDA, 0xE7, 0xC1, 0x94, 0x07,
-	0x85, 0x42, 0x21, 0x1C, 0x39, 0x72, 0xE4, 0x3D, 0xBF, 0xDF, 0x0F, 0xCF,
-	0x3E, 0xFB, 0xEC, 0xDF, 0x4C, 0x9C, 0x38, 0xB1, 0x04, 0x1D, 0xE0, 0x38,
-	0x18, 0xB1, 0xE5, 0x0C, 0x19, 0x05, 0x8E, 0x24, 0x20, 0x83, 0x7D, 0xD8,
-	0xB1, 0x1B, 0xA8, 0xDB, 0xED, 0x86, 0xE4, 0xE4, 0x64, 0xF3, 0x8A, 0x15,
-	0x2B, 0x1E, 0x95, 0x24, 0x49, 0xDE, 0xD0, 0xD0, 0xF0, 0x12, 0xCB, 0xB2,
-	0xB5, 0x68, 0x95, 0xE3, 0xB2, 0xD2, 0xE3, 0xF1, 0x84, 0xDA, 0x60, 0x37,
-	0x36, 0x36, 0x42, 0x4C, 0x4C, 0x4C, 0xA8, 0x87, 0x3F, 0x26, 0xBA, 0xE2,
-	0xBF, 0x7E, 0xBF, 0x1F, 0x06, 0x06, 0x06, 0x80, 0x61, 0x18, 0x48, 0x4A,
-	0x4A, 0x1A, 0x12, 0x45, 0xC4, 0x73, 0xD4, 0xEB, 0xF5, 0xA0, 0x54, 0x2A,
-	0x87, 0x94, 0x22, 0x21, 0x38, 0xCB, 0x93, 0x7E, 0x3C, 0xFC, 0x59, 0x30,
-	0x91, 0xFA, 0x1B, 0x5D, 0x09, 0x30, 0x3D, 0x86, 0x9C, 0xA0, 0xC3, 0x1B,
-	0x15, 0xE2, 0xB1, 0xB1, 0x8F, 0x3E, 0xC7, 0x71, 0x57, 0xDD, 0xF1, 0x09,
-	0xD3, 0x4B, 0xDC, 0x6E, 0x37, 0x4C, 0x9E, 0x3C, 0x19, 0x56, 0xAD, 0x5A,
-	0x05, 0xE3, 0xC6, 0x8D, 0x1B, 0x52, 0x1F, 0x78, 0x3B, 0x10, 0xCC, 0x99,
-	0x13, 0x3D, 0x1E, 0x0F, 0x1F, 0xE9, 0x06, 0xCA, 0xC3, 0x41, 0x44, 0x09,
-	0xC1, 0xE3, 0xF1, 0x30, 0xC7, 0x8F, 0x1F, 0x87, 0x7B, 0xEF, 0xBD, 0x77,
-	0xD8, 0xD7, 0x5E, 0x2D, 0xD3, 0x5D, 0x29, 0x97, 0xCB, 0x65, 0x78, 0x62,
-	0xA3, 0x09, 0x73, 0x87, 0x9F, 0x08, 0x00, 0x80, 0xDB, 0xED, 0xF6, 0x38,
-	0x1C, 0x0E, 0xFF, 0xED, 0x98, 0x46, 0x20, 0x49, 0x12, 0xA4, 0xA6, 0xA6,
-	0xC2, 0xC6, 0x8D, 0x1B, 0x81, 0x61, 0x18, 0x20, 0xAB, 0xFC, 0xC9, 0xF5,
-	0xF8, 0x70, 0x42, 0x1B, 0x08, 0x04, 0x00, 0xF3, 0x8A, 0xF0, 0xE1, 0xC5,
-	0x87, 0x13, 0x73, 0x93, 0x58, 0x96, 0x85, 0xBE, 0xBE, 0xBE, 0x21, 0x3B,
-	0x34, 0x93, 0x83, 0xFE, 0x5A, 0x37, 0x3A, 0xFC, 0x7D, 0xC9, 0x89, 0x00,
-	0x97, 0x0A, 0x98, 0xAD, 0x1E, 0xEE, 0xDF, 0x48, 0x48, 0x48, 0x00, 0x83,
-	0xC1, 0x00, 0x6D, 0x6D, 0x6D, 0x00, 0x70, 0x25, 0x8F, 0x07, 0x9B, 0xF0,
-	0x91, 0x0F, 0x34, 0x6E, 0xEE, 0xB1, 0x65, 0xCB, 0x96, 0xF7, 0x9C, 0x4E,
-	0x27, 0xFC, 0xDD, 0xDF, 0xFD, 0xDD, 0x3F, 0xE5, 0xE5, 0xE5, 0x65, 0x09,
-	0x82, 0x10, 0xCA, 0x66, 0x57, 0x28, 0x14, 0x21, 0x4B, 0x89, 0x6C, 0xD8,
-	0x16, 0x89, 0x60, 0xA1, 0x75, 0xA6, 0x52, 0xA9, 0x80, 0xE7, 0x79, 0x70,
-	0xBB, 0xDD, 0x60, 0x32, 0x99, 0x74, 0xAB, 0x56, 0xAD, 0x7A, 0x44, 0x92,
-	0x24, 0x65, 0x53, 0x53, 0xD3, 0xBF, 0xFB, 0x7C, 0xBE, 0x5A, 0xB2, 0xE1,
-	0x1C, 0x0E, 0x64, 0x96, 0x65, 0xA1, 0xAA, 0xAA, 0x0A, 0x3C, 0x1E, 0x0F,
-	0xA4, 0xA6, 0xA6, 0x02, 0xC0, 0xE5, 0x8E, 0x9A, 0x4E, 0xA7, 0x33, 0xB4,
-	0x5F, 0xA5, 0xC9, 0x64, 0x82, 0x95, 0x2B, 0x57, 0x82, 0x4E, 0xA7, 0x83,
-	0x9E, 0x9E, 0x1E, 0xF0, 0x78, 0x3C, 0x80, 0x15, 0x15, 0xB8, 0x31, 0xC6,
-	0xF1, 0xE3, 0xC7, 0xA1, 0xAD, 0xAD, 0x6D, 0xC8, 0xB6, 0x56, 0x78, 0xFE,
-	0x82, 0x20, 0x84, 0x8E, 0x87, 0x22, 0x25, 0x08, 0x02, 0xB8, 0x5C, 0x2E,
-	0x38, 0x7F, 0xFE, 0x3C, 0x34, 0x34, 0x34, 0x84, 0xFA, 0x89, 0x79, 0x3C,
-	0x1E, 0x70, 0xB9, 0x5C, 0xE0, 0x72, 0xB9, 0xC0, 0xE1, 0x70, 0x80, 0xCB,
-	0xE5, 0x0A, 0x05, 0x17, 0xFA, 0xFB, 0xFB, 0xC1, 0x66, 0xB3, 0x85, 0x5A,
-	0x39, 0x63, 0x52, 0x6E, 0x47, 0x47, 0x07, 0x0C, 0x0E, 0x0E, 0x42, 0x7B,
-	0x7B, 0x3B, 0x5C, 0xB8, 0x70, 0x61, 0xC8, 0x98, 0x21, 0xEF, 0x1B, 0x96,
-	0xB1, 0x95, 0x94, 0x94, 0xC0, 0xFA, 0xF5, 0xEB, 0x21, 0x29, 0x29, 0x09,
-	0x5A, 0x5B, 0x5B, 0x6F, 0xAB, 0xE5, 0x20, 0x22, 0x08, 0x82, 0xDF, 0x60,
-	0x30, 0xB8, 0xC7, 0xC2, 0x08, 0x41, 0xC1, 0xFA, 0xE4, 0x93, 0x4F, 0x98,
-	0xEB, 0x11, 0xAC, 0x6F, 0xCC, 0x3E, 0xA3, 0x49, 0x1C, 0x0D, 0xCF, 0xC1,
-	0xF2, 0xF9, 0x7C, 0x3E, 0x8F, 0xC7, 0x13, 0xB8, 0x5D, 0x9B, 0xA9, 0xF5,
-	0xF5, 0xF5, 0x41, 0x46, 0x46, 0x06, 0x3C, 0xFE, 0xF8, 0xE3, 0xD0, 0xD0,
-	0xD0, 0x00, 0x76, 0xBB, 0x1D, 0xE2, 0xE3, 0xE3, 0x43, 0xBD, 0xC2, 0x01,
-	0xBE, 0x19, 0x25, 0x95, 0x82, 0xED, 0x5C, 0x92, 0x93, 0x93, 0xA1, 0xA7,
-	0xA7, 0x27, 0x24, 0x3E, 0x1C, 0xC7, 0x81, 0x4E, 0xA7, 0x0B, 0x15, 0x18,
-	0x4B, 0x92, 0x04, 0xD5, 0xD5, 0xD5, 0xD0, 0xDB, 0xDB, 0x3B, 0xA4, 0x4C,
-	0x09, 0xE0, 0xB2, 0x05, 0x84, 0xBB, 0x30, 0x87, 0x5F, 0x5F, 0x1C, 0xC8,
-	0xE1, 0x4B, 0x2B, 0xB4, 0x72, 0xD4, 0x6A, 0x35, 0xA4, 0xA5, 0xA5, 0x01,
-	0x76, 0x36, 0x68, 0x6D, 0x6D, 0x85, 0xC1, 0xC1, 0xC1, 0x90, 0x18, 0xA9,
-	0xD5, 0x6A, 0x98, 0x32, 0x65, 0x0A, 0x48, 0x92, 0x04, 0x35, 0x35, 0x35,
-	0xC0, 0x30, 0x0C, 0xF0, 0x3C, 0x0F, 0x3E, 0x9F, 0x0F, 0xD4, 0x6A, 0x35,
-	0xE8, 0x74, 0x3A, 0x18, 0x1C, 0x1C, 0x1C, 0x92, 0x21, 0xCD, 0x30, 0x97,
-	0x7B, 0xA2, 0x1F, 0x3D, 0x7A, 0xF4, 0xB3, 0x3F, 0xFE, 0xF1, 0x8F, 0xE6,
-	0xE7, 0x9F, 0x7F, 0xFE, 0x6F, 0x33, 0x33, 0x33, 0x53, 0x18, 0x86, 0x01,
-	0xA7, 0xD3, 0x09, 0x82, 0x20, 0x80, 0x56, 0xAB, 0x0D, 0xF9, 0xB2, 0x22,
-	0x9D, 0x55, 0x51, 0xBC, 0x5D, 0x2E, 0x17, 0x68, 0x34, 0x1A, 0x50, 0xAB,
-	0xD5, 0xE0, 0x74, 0x3A, 0xC1, 0xE5, 0x72, 0x41, 0x4C, 0x4C, 0x8C, 0x7A,
-	0xC5, 0x8A, 0x15, 0xEB, 0xB7, 0x6F, 0xDF, 0x2E, 0x9D, 0x3E, 0x7D, 0xFA,
-	0xD7, 0x82, 0x20, 0xD4, 0x0C, 0x77, 0x0C, 0x8E, 0xE3, 0xA0, 0xA7, 0xA7,
-	0x07, 0xDC, 0x6E, 0x37, 0xFA, 0x45, 0x43, 0x4B, 0x5A, 0xBF, 0xDF, 0x0F,
-	0xE3, 0xC7, 0x8F, 0x87, 0x17, 0x5F, 0x7C, 0x11, 0x44, 0x51, 0x84, 0xA7,
-	0x9E, 0x7A, 0x0A, 0x06, 0x06, 0x06, 0x20, 0x31, 0x31, 0x31, 0xD4, 0x1A,
-	0xDA, 0xE3, 0xF1, 0xC0, 0xBF, 0xFC, 0xCB, 0xBF, 0x40, 0x47, 0x47, 0x07,
-	0xE4, 0xE4, 0xE4, 0x84, 0xAE, 0x3F, 0x7E, 0x0E, 0xB7, 0xDB, 0x0D, 0x1D,
-	0x1D, 0x1D, 0xD0, 0xD7, 0xD7, 0x07, 0x26, 0x93, 0x09, 0x62, 0x62, 0x62,
-	0xC0, 0x6E, 0xB7, 0x43, 0x77, 0x77, 0x37, 0x54, 0x54, 0x54, 0xC0, 0xE9,
-	0xD3, 0xA7, 0xA1, 0xB4, 0xB4, 0x14, 0x0C, 0x06, 0x03, 0x24, 0x26, 0x26,
-	0x02, 0xCF, 0xF3, 0x70, 0xE9, 0xD2, 0x25, 0xE8, 0xEB, 0xEB, 0x83, 0xFE,
-	0xFE, 0x7E, 0x88, 0x8B, 0x8B, 0x83, 0x84, 0x84, 0x04, 0xB8, 0x78, 0xF1,
-	0x62, 0x68, 0xF2, 0xB0, 0xDB, 0xED, 0xA0, 0xD7, 0xEB, 0xA1, 0xAD, 0xAD,
-	0x0D, 0xBE, 0xFE, 0xFA, 0x6B, 0xB0, 0xDB, 0xED, 0x50, 0x5D, 0x5D, 0x0D,
-	0x76, 0xBB, 0x1D, 0xA6, 0x4E, 0x9D, 0x1A, 0x0A, 0xF8, 0x60, 0x75, 0x01,
-	0xC0, 0x65, 0xBF, 0xAA, 0xD9, 0x6C, 0x86, 0xFB, 0xEE, 0xBB, 0x0F, 0x52,
-	0x53, 0x53, 0xA1, 0xB7, 0xB7, 0xF7, 0xB6, 0x0D, 0x3E, 0x08, 0x82, 0x10,
-	0x50, 0x2A, 0x95, 0xBE, 0xF0, 0x64, 0x71, 0x80, 0xC8, 0x33, 0xDE, 0xC9,
-	0x09, 0x8F, 0x65, 0x59, 0x46, 0xAB, 0xD5, 0x8E, 0x7E, 0x49, 0x58, 0x58,
-	0x58, 0x28, 0x90, 0x6D, 0x1E, 0x46, 0xE3, 0xF9, 0x27, 0xFF, 0x26, 0xFC,
-	0xFB, 0xDB, 0xF1, 0xA2, 0x87, 0x99, 0xA4, 0x70, 0xE2, 0xC4, 0x09, 0x98,
-	0x39, 0x73, 0x26, 0xE4, 0xE6, 0xE6, 0x82, 0xD5, 0x6A, 0x85, 0xEE, 0xEE,
-	0x6E, 0x48, 0x48, 0x48, 0x00, 0x95, 0x4A, 0x35, 0x64, 0xEB, 0xA8, 0x40,
-	0x20, 0x00, 0x05, 0x05, 0x05, 0xB0, 0x71, 0xE3, 0x46, 0xF8, 0xDF, 0xFF,
-	0xFD, 0x5F, 0x68, 0x68, 0x68, 0xC0, 0xFD, 0xD6, 0x40, 0xAF, 0xD7, 0xC3,
-	0x89, 0x13, 0x27, 0xC0, 0xEB, 0xF5, 0xC2, 0xE0, 0xE0, 0x60, 0x48, 0x00,
-	0x79, 0x9E, 0x07, 0x9B, 0xCD, 0x16, 0xB2, 0xCA, 0x7A, 0x7A, 0x7A, 0xC0,
-	0x60, 0x30, 0x00, 0xCF, 0xF3, 0xA1, 0x7D, 0x1C, 0xF1, 0x5F, 0xB4, 0x68,
-	0x8C, 0x46, 0xE3, 0x90, 0xED, 0xD9, 0x83, 0xBB, 0x70, 0x43, 0x79, 0x79,
-	0x39, 0xFC, 0xE2, 0x17, 0xBF, 0x08, 0xB5, 0xC0, 0x7D, 0xF3, 0xCD, 0x37,
-	0xE1, 0xFD, 0xF7, 0xDF, 0x07, 0xBF, 0xDF, 0x0F, 0x7E, 0xBF, 0x1F, 0xB4,
-	0x5A, 0x6D, 0x68, 0x83, 0x06, 0x95, 0x4A, 0x05, 0x83, 0x83, 0x83, 0xD0,
-	0xD6, 0xD6, 0x06, 0x3C, 0xCF, 0xC3, 0x8C, 0x19, 0x33, 0x20, 0x36, 0x36,
-	0x16, 0xBC, 0x5E, 0x6F, 0xA8, 0x54, 0x86, 0xB4, 0xFA, 0xE4, 0x72, 0xB9,
-	0xFB, 0xC8, 0x91, 0x23, 0x6F, 0xF9, 0xFD, 0xFE, 0xC0, 0x8F, 0x7E, 0xF4,
-	0xA3, 0xBF, 0x8F, 0x8B, 0x8B, 0x4B, 0xD6, 0x6A, 0xB5, 0x21, 0x8B, 0x03,
-	0x77, 0xB9, 0x09, 0x4F, 0x5F, 0xB9, 0x1A, 0x0C, 0xC3, 0x0C, 0xD9, 0xCA,
-	0x0B, 0xF3, 0xB0, 0x04, 0x41, 0x80, 0xB8, 0xB8, 0x38, 0xED, 0x3D, 0xF7,
-	0xDC, 0xF3, 0x80, 0x28, 0x8A, 0x52, 0x7D, 0x7D, 0xFD, 0x7F, 0x89, 0xA2,
-	0x58, 0x35, 0x52, 0x89, 0x17, 0x5A, 0x20, 0x64, 0x84, 0x09, 0x77, 0x6C,
-	0xC1, 0x09, 0x11, 0x27, 0x86, 0xF0, 0xF3, 0x42, 0x8B, 0x74, 0xB8, 0xB1,
-	0x8C, 0xD6, 0x31, 0xD9, 0xD3, 0x09, 0x7F, 0xC6, 0xF3, 0x3C, 0x78, 0xBD,
-	0x5E, 0xDC, 0x84, 0x03, 0x9E, 0x7F, 0xFE, 0x79, 0xD8, 0xBE, 0x7D, 0x3B,
-	0xB8, 0x5C, 0x2E, 0xF0, 0x78, 0x3C, 0x60, 0x34, 0x1A, 0x61, 0xC9, 0x92,
-	0x25, 0x30, 0x65, 0xCA, 0x14, 0x38, 0x7E, 0xFC, 0x38, 0x4C, 0x9D, 0x3A,
-	0x15, 0x9C, 0x4E, 0x27, 0x1C, 0x3D, 0x7A, 0x14, 0x8A, 0x8B, 0x8B, 0xE1,
-	0xDD, 0x77, 0xDF, 0x85, 0xFA, 0xFA, 0x7A, 0x98, 0x3A, 0x75, 0x6A, 0xC8,
-	0xF7, 0x97, 0x9B, 0x9B, 0x0B, 0x83, 0x83, 0x83, 0x70, 0xE9, 0xD2, 0x25,
-	0x68, 0x6A, 0x6A, 0x02, 0xDC, 0xF5, 0x1A, 0xCF, 0xED, 0x76, 0x89, 0x06,
-	0x5E, 0x8D, 0xE0, 0xFD, 0x19, 0x33, 0x1F, 0x8F, 0x5C, 0x2E, 0x87, 0xE4,
-	0xE4, 0xE4, 0x11, 0x3F, 0xF4, 0x88, 0x82, 0xA5, 0x52, 0xA9, 0x7C, 0x00,
-	0x30, 0x24, 0x3C, 0x18, 0xA9, 0x95, 0x15, 0x7E, 0x91, 0x83, 0xEB, 0x77,
-	0x4E, 0xA3, 0xD1, 0xC8, 0x6E, 0x47, 0x0B, 0x4B, 0x92, 0x24, 0xD0, 0xEB,
-	0xF5, 0xD0, 0xD8, 0xD8, 0x08, 0x7F, 0xFA, 0xD3, 0x9F, 0x42, 0x59, 0xC4,
-	0x00, 0x10, 0xB1, 0x85, 0x85, 0x0F, 0x22, 0x69, 0x61, 0x01, 0x5C, 0xF1,
-	0xDD, 0x00, 0x40, 0xA8, 0xC1, 0x19, 0x39, 0x9B, 0x8E, 0x85, 0x85, 0x85,
-	0x60, 0xE7, 0x03, 0x8C, 0xEA, 0xE2, 0xFB, 0xE1, 0x72, 0x4F, 0x14, 0xC5,
-	0x21, 0xAD, 0x48, 0x64, 0x32, 0x19, 0xAC, 0x58, 0xB1, 0x02, 0x0C, 0x06,
-	0x03, 0x6C, 0xDA, 0xB4, 0x29, 0xE4, 0x3B, 0x02, 0x00, 0xDC, 0xC0, 0xD4,
-	0x75, 0xF4, 0xE8, 0xD1, 0x3F, 0xFF, 0xFA, 0xD7, 0xBF, 0xF6, 0xFD, 0xC5,
-	0x5F, 0xFC, 0xC5, 0x3F, 0x66, 0x65, 0x65, 0xA5, 0xE1, 0x72, 0x10, 0x73,
-	0xA7, 0x22, 0xF5, 0x5D, 0x60, 0x09, 0x0E, 0xFA, 0x81, 0xF0, 0x9A, 0xA2,
-	0x3F, 0x29, 0x58, 0x30, 0xAD, 0x5C, 0xB9, 0x72, 0xE5, 0x7D, 0x3A, 0x9D,
-	0x4E, 0xF1, 0xF9, 0xE7, 0x9F, 0xBF, 0x24, 0x8A, 0xE2, 0xB1, 0xF0, 0xEB,
-	0x42, 0x4E, 0x9C, 0xE4, 0xF2, 0x1A, 0xB3, 0xF4, 0xF1, 0x9A, 0xE3, 0xB5,
-	0x0B, 0xBF, 0xA6, 0xB8, 0x31, 0xEB, 0x70, 0xE3, 0x38, 0x7C, 0xB9, 0x4E,
-	0x2E, 0xD5, 0xB0, 0x5F, 0x3C, 0xA6, 0x5F, 0x24, 0x25, 0x25, 0x81, 0x46,
-	0xA3, 0x09, 0x1D, 0x47, 0xA1, 0x50, 0x40, 0x6C, 0x6C, 0x2C, 0x60, 0x2F,
-	0xAE, 0x98, 0x98, 0x18, 0xE8, 0xEF, 0xEF, 0x0F, 0x15, 0x6D, 0x63, 0xB2,
-	0xA7, 0x5E, 0xAF, 0x07, 0xB7, 0xDB, 0x1D, 0xF2, 0x63, 0xE1, 0xF9, 0x90,
-	0x63, 0x82, 0xE3, 0x38, 0xB0, 0xDB, 0xED, 0xF0, 0xEE, 0xBB, 0xEF, 0xC2,
-	0xC3, 0x0F, 0x3F, 0x0C, 0x79, 0x79, 0x79, 0xA1, 0x7A, 0xC1, 0xDB, 0x0D,
-	0x99, 0x4C, 0x26, 0xE3, 0x38, 0x4E, 0x79, 0xBD, 0x06, 0x49, 0xB8, 0x3B,
-	0x41, 0x14, 0x45, 0xA9, 0xAB, 0xAB, 0x6B, 0xF4, 0x0D, 0xFC, 0xEE, 0xB9,
-	0xE7, 0x1E, 0x49, 0xA3, 0xD1, 0x88, 0x38, 0xCB, 0xDF, 0x08, 0xC1, 0x65,
-	0x86, 0x4E, 0xA5, 0x52, 0x29, 0x6E, 0x47, 0xA7, 0xBB, 0x4A, 0xA5, 0x82,
-	0xCA, 0xCA, 0x4A, 0xF8, 0xE0, 0x83, 0x0F, 0xA0, 0xBE, 0xBE, 0x1E, 0xE2,
-	0xE3, 0xE3, 0x43, 0xD1, 0xA8, 0x1B, 0xF1, 0x61, 0xE1, 0xDF, 0x93, 0x0F,
-	0xC1, 0xCD, 0xF0, 0x61, 0x61, 0x4A, 0x46, 0xB8, 0x0F, 0x8B, 0xFC, 0x3B,
-	0x52, 0xFC, 0xD0, 0x8A, 0xF3, 0x7A, 0xBD, 0x90, 0x97, 0x97, 0x07, 0x0B,
-	0x16, 0x2C, 0x00, 0x8F, 0xC7, 0x03, 0x27, 0x4F, 0x9E, 0x84, 0xF6, 0xF6,
-	0x76, 0x10, 0x04, 0x01, 0x54, 0x2A, 0x15, 0xA8, 0x54, 0x2A, 0x10, 0x04,
-	0xC1, 0x79, 0xE0, 0xC0, 0x81, 0x77, 0xE5, 0x72, 0xB9, 0xEA, 0xF9, 0xE7,
-	0x9F, 0xFF, 0x59, 0x4E, 0x4E, 0x4E, 0x06, 0xB9, 0xFF, 0x1C, 0x8E, 0x8F,
-	0x6B, 0x59, 0xDF, 0x68, 0x95, 0x62, 0x4A, 0x0B, 0x3A, 0xAC, 0xF1, 0x7B,
-	0x80, 0xCB, 0x42, 0x63, 0xB1, 0x58, 0x74, 0xF3, 0xE7, 0xCF, 0xBF, 0xD7,
-	0xE3, 0xF1, 0x28, 0xD5, 0x6A, 0xF5, 0x7F, 0x68, 0xB5, 0xDA, 0xA3, 0x5D,
-	0x5D, 0x5D, 0xA3, 0xDE, 0x55, 0xE9, 0x66, 0x81, 0x96, 0x1B, 0x6E, 0x4E,
-	0x4B, 0xFA, 0x77, 0x79, 0x9E, 0x0F, 0x8D, 0x05, 0xB2, 0x54, 0x09, 0xB7,
-	0x5A, 0xC3, 0xC0, 0x00, 0x8E, 0x15, 0x14, 0xA9, 0x70, 0x1F, 0x16, 0xDE,
-	0xA3, 0xFA, 0xFA, 0x7A, 0xF8, 0xF0, 0xC3, 0x0F, 0xE1, 0xB1, 0xC7, 0x1E,
-	0x83, 0xB2, 0xB2, 0xB2, 0xDB, 0xD2, 0xE9, 0xEE, 0xF1, 0x78, 0xE4, 0x2C,
-	0xCB, 0xAA, 0x6F, 0xC4, 0x12, 0xC4, 0x71, 0x2A, 0x08, 0x02, 0x68, 0x34,
-	0x1A, 0x69, 0xDD, 0xBA, 0x75, 0x23, 0x46, 0xF8, 0x46, 0x14, 0xAC, 0x79,
-	0xF3, 0xE6, 0x01, 0xCF, 0xF3, 0x2C, 0x6E, 0x42, 0x70, 0x3D, 0x27, 0x80,
-	0x04, 0x1D, 0x98, 0xDA, 0x83, 0x07, 0x0F, 0xCA, 0x3B, 0x3B, 0x3B, 0x6F,
-	0xBB, 0xD0, 0xB4, 0x46, 0xA3, 0x81, 0x13, 0x27, 0x4E, 0x40, 0x55, 0x55,
-	0x55, 0x68, 0xB7, 0xE4, 0xDB, 0x4D, 0x54, 0x6F, 0x06, 0xE8, 0x97, 0xD2,
-	0xEB, 0xF5, 0x50, 0x5E, 0x5E, 0x0E, 0x1D, 0x1D, 0x1D, 0x10, 0x1B, 0x1B,
-	0x0B, 0x35, 0x35, 0x35, 0x60, 0xB3, 0xD9, 0xC8, 0x3C, 0x2D, 0x7E, 0xD7,
-	0xAE, 0x5D, 0x6F, 0x72, 0x1C, 0xA7, 0x7A, 0xE6, 0x99, 0x67, 0x5E, 0xCC,
-	0xCE, 0xCE, 0x4E, 0xF7, 0xFB, 0xFD, 0xE0, 0xF1, 0x78, 0x22, 0x76, 0x15,
-	0xA0, 0xE5, 0x89, 0x0F, 0x1D, 0xB9, 0xD5, 0x39, 0x59, 0x78, 0xED, 0xF3,
-	0xF9, 0xC0, 0x6C, 0x36, 0x6B, 0x56, 0xAF, 0x5E, 0xBD, 0x26, 0x39, 0x39,
-	0x59, 0x7E, 0xFE, 0xFC, 0xF9, 0xFF, 0xEE, 0xE8, 0xE8, 0xD8, 0xF3, 0x6D,
-	0x77, 0xF7, 0xB8, 0x95, 0xA0, 0x45, 0xAC, 0x56, 0xAB, 0xA1, 0xA6, 0xA6,
-	0x06, 0xB6, 0x6E, 0xDD, 0x0A, 0x6D, 0x6D, 0x6D, 0x60, 0xB5, 0x5A, 0x01,
-	0xE0, 0xF6, 0x71, 0xAB, 0xF0, 0x3C, 0x0F, 0x69, 0x69, 0x69, 0xEC, 0xA2,
-	0x45, 0x8B, 0x94, 0x68, 0xB5, 0xDE, 0xC8, 0xB9, 0x05, 0x05, 0x0B, 0x16,
-	0x2D, 0x5A, 0x34, 0xE2, 0x6B, 0x46, 0x14, 0x2C, 0xAB, 0xD5, 0x2A, 0xB1,
-	0x2C, 0xEB, 0xC3, 0xCD, 0x30, 0x87, 0x0B, 0x03, 0x5F, 0x0D, 0xB4, 0x36,
-	0xD0, 0xE7, 0xA3, 0x50, 0x28, 0xE4, 0xBB, 0x77, 0xEF, 0x56, 0xED, 0xD9,
-	0xB3, 0x07, 0x8C, 0x46, 0xE3, 0x68, 0x3E, 0xC7, 0x4D, 0x05, 0x4B, 0x50,
-	0xE4, 0x72, 0x39, 0xE8, 0xF5, 0x7A, 0xB8, 0xD5, 0x65, 0x43, 0xDF, 0x36,
-	0x28, 0x14, 0x4E, 0xA7, 0x13, 0x58, 0x96, 0x85, 0xE9, 0xD3, 0xA7, 0x83,
-	0xCB, 0xE5, 0x82, 0xCA, 0xCA, 0xCA, 0x90, 0xE5, 0x20, 0x97, 0xCB, 0x41,
-	0xAB, 0xD5, 0x7A, 0xF6, 0xEC, 0xD9, 0xF3, 0x47, 0xAD, 0x56, 0xAB, 0x7C,
-	0xEA, 0xA9, 0xA7, 0x5E, 0x4C, 0x4A, 0x4A, 0x4A, 0xF0, 0x7A, 0xBD, 0xA1,
-	0x65, 0x12, 0xB9, 0x04, 0x23, 0x2B, 0xF5, 0xC3, 0xAD, 0x3D, 0x8C, 0xCE,
-	0xA1, 0x85, 0x31, 0x9C, 0xF5, 0x29, 0x08, 0x02, 0x18, 0x0C, 0x06, 0x6E,
-	0xC6, 0x8C, 0x19, 0xF7, 0x08, 0x82, 0x60, 0x4A, 0x48, 0x48, 0x90, 0xD5,
-	0xD5, 0xD5, 0x1D, 0xF0, 0x7A, 0xBD, 0x3C, 0x8E, 0xC7, 0xBB, 0x01, 0x86,
-	0xB9, 0xBC, 0xAD, 0x5A, 0x4D, 0x4D, 0x0D, 0xEC, 0xDD, 0xBB, 0x17, 0xBA,
-	0xBB, 0xBB, 0xAF, 0x3B, 0x75, 0xE0, 0x66, 0x60, 0xB5, 0x5A, 0x61, 0xCD,
-	0x9A, 0x35, 0xDC, 0xEA, 0xD5, 0xAB, 0x15, 0xE8, 0xEF, 0xF3, 0xFB, 0xFD,
-	0xA3, 0x2E, 0xCD, 0x21, 0xC7, 0x88, 0xDB, 0xED, 0x0E, 0x0C, 0x0E, 0x0E,
-	0x8A, 0x23, 0xED, 0xA3, 0x38, 0xA2, 0x60, 0xF5, 0xF6, 0xF6, 0x8A, 0x2C,
-	0xCB, 0x5A, 0x0D, 0x06, 0x03, 0x90, 0xCB, 0xB8, 0x48, 0x4E, 0x04, 0x07,
-	0x2E, 0x39, 0x90, 0xE5, 0x72, 0x39, 0xAB, 0x50, 0x28, 0x62, 0x30, 0x5B,
-	0xFA, 0x56, 0x83, 0xE7, 0xA6, 0x52, 0xA9, 0x42, 0x05, 0xBB, 0xB7, 0xCB,
-	0xB2, 0xE3, 0x56, 0x81, 0x03, 0x4E, 0xAF, 0xD7, 0x87, 0x42, 0xFA, 0x48,
-	0xB0, 0x0D, 0xB2, 0x73, 0xD7, 0xAE, 0x5D, 0x7F, 0x04, 0x00, 0xF6, 0xB9,
-	0xE7, 0x9E, 0xFB, 0xB1, 0xC5, 0x62, 0x89, 0xE1, 0x79, 0x1E, 0x04, 0x41,
-	0x18, 0x52, 0x34, 0x8D, 0x4B, 0x20, 0x72, 0x00, 0x87, 0xFB, 0xE1, 0xD0,
-	0x2F, 0x44, 0x82, 0xBD, 0xF7, 0x71, 0x49, 0xAD, 0x54, 0x2A, 0x61, 0xCE,
-	0x9C, 0x39, 0xF3, 0x14, 0x0A, 0x85, 0xA2, 0xBF, 0xBF, 0xFF, 0xBF, 0x4F,
-	0x9E, 0x3C, 0xF9, 0x19, 0xCF, 0xF3, 0xFC, 0x58, 0xED, 0xB3, 0x17, 0x2D,
-	0xB0, 0x2C, 0x0B, 0x3A, 0x9D, 0x2E, 0xE4, 0xEF, 0xBC, 0x5D, 0x44, 0x8B,
-	0xE7, 0x79, 0xD0, 0x6A, 0xB5, 0x46, 0x95, 0x4A, 0xA5, 0x05, 0xB8, 0x32,
-	0xF9, 0xA1, 0x35, 0x1D, 0x29, 0xA8, 0x2D, 0xA2, 0x28, 0xC2, 0xC0, 0xC0,
-	0x80, 0xAB, 0xB7, 0xB7, 0x57, 0x9C, 0x3C, 0x79, 0xF2, 0xB0, 0xAF, 0x1D,
-	0x51, 0x39, 0xFA, 0xFB, 0xFB, 0x03, 0x72, 0xB9, 0xDC, 0xC6, 0xF3, 0xBC,
-	0xA0, 0xD7, 0xEB, 0x15, 0x78, 0x42, 0x91, 0x9E, 0x00, 0xE9, 0xF7, 0x09,
-	0xE6, 0x36, 0x69, 0x14, 0x0A, 0x85, 0x8E, 0xBD, 0xCC, 0x2D, 0xDB, 0xA6,
-	0x19, 0x85, 0x0A, 0x73, 0x64, 0x12, 0x12, 0x12, 0x40, 0x10, 0x04, 0xE8,
-	0xEB, 0xEB, 0xBB, 0x55, 0xA7, 0x74, 0x5B, 0x81, 0xF7, 0x0B, 0xEB, 0x09,
-	0x49, 0x8B, 0x26, 0x18, 0x3C, 0xE9, 0xDF, 0xB7, 0x6F, 0xDF, 0xCB, 0x5E,
-	0xAF, 0xD7, 0xFF, 0xE2, 0x8B, 0x2F, 0xFE, 0x5D, 0x4C, 0x4C, 0x8C, 0x1E,
-	0xE0, 0x72, 0xF0, 0x00, 0x77, 0x5D, 0x46, 0x21, 0x0A, 0xFA, 0x38, 0x42,
-	0x41, 0x8D, 0x48, 0xBB, 0x97, 0x62, 0x1D, 0xA3, 0x20, 0x08, 0x20, 0x08,
-	0x02, 0x4C, 0x9F, 0x3E, 0x7D, 0x86, 0xD1, 0x68, 0x8C, 0x79, 0xF5, 0xD5,
-	0x57, 0x15, 0x87, 0x0F, 0x1F, 0x7E, 0x3F, 0x10, 0x08, 0x04, 0xEE, 0xA6,
-	0xC2, 0x68, 0x51, 0x14, 0x21, 0x3E, 0x3E, 0x3E, 0x94, 0x3E, 0x83, 0x79,
-	0x77, 0xD7, 0x13, 0xB9, 0x1F, 0x4B, 0x82, 0x81, 0x06, 0x3D, 0xF6, 0xCC,
-	0x03, 0xB8, 0x92, 0xBE, 0x12, 0x29, 0x64, 0x60, 0xC4, 0xE7, 0xF3, 0x89,
-	0x83, 0x83, 0x83, 0x36, 0xBF, 0xDF, 0x3F, 0xFA, 0x4D, 0x28, 0xBA, 0xBA,
-	0xBA, 0xFC, 0x0A, 0x85, 0xA2, 0x37, 0x27, 0x27, 0xC7, 0x0B, 0x00, 0x8A,
-	0xD1, 0x84, 0x58, 0x31, 0x9C, 0x8C, 0x0E, 0x4A, 0x00, 0x00, 0x8D, 0x46,
-	0xA3, 0xB1, 0x58, 0x2C, 0x71, 0x71, 0x71, 0x71, 0x5A, 0xA3, 0xD1, 0xE8,
-	0x88, 0xF8, 0x13, 0x8D, 0x31, 0x38, 0x7B, 0x6B, 0xB5, 0x5A, 0xC8, 0xCC,
-	0xCC, 0x04, 0xAF, 0xD7, 0x0B, 0x17, 0x2F, 0x5E, 0xBC, 0x55, 0xA7, 0x73,
-	0x5B, 0x42, 0x16, 0x86, 0x03, 0xC0, 0x90, 0x8D, 0x57, 0x39, 0x8E, 0x03,
-	0xB7, 0xDB, 0x3D, 0x50, 0x53, 0x53, 0xF3, 0xCE, 0xE6, 0xCD, 0x9B, 0x93,
-	0xD6, 0xAC, 0x59, 0xF3, 0x44, 0x72, 0x72, 0xB2, 0x19, 0x97, 0x04, 0xE8,
-	0xEF, 0xC4, 0x99, 0x16, 0x93, 0x44, 0x31, 0x42, 0x18, 0x09, 0x18, 0x50,
-	0xC0, 0x74, 0x0C, 0x85, 0x42, 0xC1, 0x94, 0x94, 0x94, 0x14, 0xBE, 0xF0,
-	0xC2, 0x0B, 0xBF, 0x30, 0x9B, 0xCD, 0x96, 0x3D, 0x7B, 0xF6, 0xBC, 0xCD,
-	0xB2, 0xEC, 0xE0, 0x4D, 0xF9, 0xF0, 0xB7, 0x29, 0x0C, 0xC3, 0x40, 0x62,
-	0x62, 0x22, 0xA4, 0xA5, 0xA5, 0xC1, 0xC5, 0x8B, 0x17, 0xC1, 0xE3, 0xF1,
-	0x0C, 0x9B, 0x51, 0xFF, 0x6D, 0xC2, 0x71, 0x9C, 0xC6, 0x6C, 0x36, 0x27,
-	0x28, 0x14, 0x0A, 0x25, 0x06, 0x0F, 0xC8, 0x74, 0x93, 0x48, 0x57, 0x63,
-	0xA8, 0x2B, 0x5E, 0xAF, 0xD7, 0xDB, 0xD3, 0xD3, 0xD3, 0xED, 0xBF, 0xCA,
-	0x52, 0xE7, 0x6A, 0x82, 0x25, 0x70, 0x1C, 0xD7, 0xC5, 0xF3, 0xBC, 0x17,
-	0x00, 0xF4, 0xD7, 0x23, 0x58, 0xE4, 0x32, 0x40, 0x2E, 0x97, 0xB3, 0xE9,
-	0xE9, 0xE9, 0x99, 0x93, 0x26, 0x4D, 0x8A, 0x37, 0x9B, 0xCD, 0x8E, 0x5B,
-	0xE1, 0xD4, 0x16, 0x04, 0x01, 0x72, 0x73, 0x73, 0x21, 0x2D, 0x2D, 0x0D,
-	0xCE, 0x9F, 0x3F, 0x0F, 0x6E, 0xB7, 0x1B, 0x9A, 0x9B, 0x9B, 0xEF, 0xDA,
-	0xA5, 0xA0, 0x20, 0x08, 0x23, 0x7E, 0x76, 0x32, 0xF2, 0x15, 0xEC, 0x55,
-	0x14, 0xFA, 0x59, 0x30, 0xE2, 0xD5, 0x51, 0x57, 0x57, 0xF7, 0xDB, 0x40,
-	0x20, 0x20, 0xDE, 0x77, 0xDF, 0x7D, 0xCF, 0x24, 0x24, 0x24, 0x18, 0x31,
-	0x73, 0x1E, 0x2D, 0x2D, 0x5C, 0x22, 0x2A, 0x14, 0x8A, 0x88, 0xBB, 0x61,
-	0x60, 0xCA, 0x03, 0xF9, 0x77, 0x6E, 0xB7, 0x1B, 0x94, 0x4A, 0x25, 0x8C,
-	0x1B, 0x37, 0xAE, 0xE0, 0xA9, 0xA7, 0x9E, 0xFA, 0x91, 0x42, 0xA1, 0xD0,
-	0x6F, 0xDF, 0xBE, 0xFD, 0x75, 0x9F, 0xCF, 0xD7, 0x79, 0x3B, 0x2C, 0x8D,
-	0xBE, 0x0D, 0x30, 0x23, 0x3F, 0x3E, 0x3E, 0x1E, 0x72, 0x73, 0x73, 0xA1,
-	0xB0, 0xB0, 0x10, 0x9A, 0x9B, 0x9B, 0xA1, 0xBE, 0xBE, 0xFE, 0x96, 0x05,
-	0xB1, 0xAC, 0x56, 0x6B, 0x42, 0x42, 0x42, 0x42, 0x36, 0x4E, 0x30, 0xE8,
-	0xB3, 0x26, 0x57, 0x31, 0x91, 0x80, 0xF7, 0x90, 0xE7, 0x79, 0x4F, 0x77,
-	0x77, 0x77, 0x27, 0xCF, 0xF3, 0xA3, 0x17, 0xAC, 0x4B, 0x97, 0x2E, 0xF9,
-	0x55, 0x2A, 0x55, 0xB7, 0x20, 0x08, 0x1E, 0xF2, 0xA0, 0x91, 0x80, 0x7E,
-	0x08, 0x52, 0x65, 0x45, 0x51, 0x84, 0xFC, 0xFC, 0xFC, 0xC2, 0xC6, 0xC6,
-	0xC6, 0xB4, 0x0B, 0x17, 0x2E, 0x5C, 0xB8, 0x15, 0xF9, 0x58, 0x4E, 0xA7,
-	0x13, 0xCA, 0xCB, 0xCB, 0x61, 0xD9, 0xB2, 0x65, 0xC0, 0x30, 0x0C, 0x54,
-	0x56, 0x56, 0xDE, 0x94, 0xBA, 0xC1, 0xDB, 0x15, 0xB4, 0x78, 0x9D, 0x4E,
-	0xA7, 0xCA, 0xE5, 0x72, 0x95, 0x64, 0x67, 0x67, 0x67, 0x65, 0x66, 0x66,
-	0x9A, 0xFD, 0x7E, 0x3F, 0xCB, 0xF3, 0x7C, 0x97, 0xCB, 0xE5, 0xAA, 0x0C,
-	0x04, 0x02, 0x2D, 0xE1, 0x39, 0x35, 0x64, 0x6F, 0x2B, 0x3C, 0x06, 0xC7,
-	0x71, 0x20, 0x97, 0xCB, 0x9B, 0x6A, 0x6A, 0x6A, 0x7E, 0x07, 0x00, 0x81,
-	0xF5, 0xEB, 0xD7, 0x3F, 0x99, 0x98, 0x98, 0x18, 0xE7, 0xF1, 0x78, 0x42,
-	0x42, 0x45, 0x96, 0xED, 0x44, 0x7A, 0xBF, 0x71, 0x99, 0x83, 0x7E, 0x2F,
-	0x14, 0x4C, 0x96, 0xBD, 0xBC, 0x1D, 0x54, 0x46, 0x46, 0x46, 0xC6, 0x93,
-	0x4F, 0x3E, 0xF9, 0x02, 0xC7, 0x71, 0xEA, 0x4D, 0x9B, 0x36, 0xFD, 0xDA,
-	0xE5, 0x72, 0x59, 0xEF, 0x96, 0xFB, 0x87, 0x13, 0x42, 0x5E, 0x5E, 0x1E,
-	0xAC, 0x5C, 0xB9, 0x12, 0x36, 0x6F, 0xDE, 0x0C, 0x5F, 0x7F, 0xFD, 0x35,
-	0xDC, 0x8A, 0x40, 0x84, 0xDF, 0xEF, 0x87, 0xE4, 0xE4, 0xE4, 0xB4, 0xC2,
-	0xC2, 0xC2, 0x62, 0x80, 0xEB, 0x2F, 0xDF, 0x0B, 0x3B, 0xA6, 0xA7, 0xAB,
-	0xAB, 0xAB, 0xD3, 0xEB, 0xF5, 0x8E, 0xD8, 0x9C, 0x7E, 0x44, 0xC1, 0x6A,
-	0x6E, 0x6E, 0xF6, 0xAB, 0xD5, 0xEA, 0x6E, 0x8F, 0xC7, 0x33, 0xEA, 0x8C,
-	0x35, 0x4C, 0xE2, 0x23, 0xFB, 0x61, 0x05, 0x02, 0x01, 0xC8, 0xC9, 0xC9,
-	0x29, 0x74, 0xBB, 0xDD, 0xA9, 0xDB, 0xB6, 0x6D, 0x03, 0xBD, 0x5E, 0x3F,
-	0xDA, 0xC3, 0xDE, 0x10, 0x58, 0xF9, 0x5E, 0x56, 0x56, 0x06, 0x1E, 0x8F,
-	0x27, 0x54, 0x92, 0x71, 0xB7, 0xC0, 0x30, 0x0C, 0x78, 0xBD, 0x5E, 0x90,
-	0x24, 0x29, 0x7E, 0xF2, 0xE4, 0xC9, 0xF7, 0x8E, 0x1F, 0x3F, 0x7E, 0x6D,
-	0x5E, 0x5E, 0x5E, 0xB1, 0x5E, 0xAF, 0x8F, 0x67, 0x18, 0x46, 0x91, 0x9E,
-	0x9E, 0xDE, 0x32, 0x7D, 0xFA, 0xF4, 0x5D, 0x4A, 0xA5, 0xF2, 0x23, 0xBB,
-	0xDD, 0x7E, 0x52, 0x10, 0x84, 0x41, 0xAC, 0x7D, 0x04, 0x80, 0x50, 0xE7,
-	0x50, 0xA5, 0x52, 0x19, 0x12, 0xA2, 0xE0, 0x36, 0xF5, 0x4D, 0x07, 0x0F,
-	0x1E, 0xFC, 0x4F, 0x00, 0x10, 0xD6, 0xAF, 0x5F, 0xFF, 0x9D, 0xC4, 0xC4,
-	0xC4, 0x78, 0xF4, 0x3D, 0x61, 0x61, 0x70, 0xA4, 0x05, 0xD2, 0x00, 0x43,
-	0x37, 0xB4, 0x40, 0xEB, 0x4F, 0xA1, 0x50, 0x80, 0x20, 0x08, 0xA1, 0x94,
-	0x88, 0xD4, 0xD4, 0xD4, 0xA4, 0x67, 0x9F, 0x7D, 0xF6, 0x7B, 0x81, 0x40,
-	0xC0, 0x7F, 0xF8, 0xF0, 0xE1, 0x37, 0x9D, 0x4E, 0x67, 0xCB, 0x48, 0x51,
-	0xA5, 0x3B, 0x0D, 0x49, 0x92, 0x42, 0xF7, 0xA2, 0xA9, 0xA9, 0x09, 0x8E,
-	0x1E, 0x3D, 0x7A, 0x4B, 0x5A, 0x23, 0x39, 0x9D, 0x4E, 0x78, 0xF0, 0xC1,
-	0x07, 0x33, 0x0A, 0x83, 0xFD, 0xCE, 0x31, 0x10, 0x80, 0x49, 0xCB, 0xA3,
-	0x69, 0x8F, 0x0C, 0x00, 0x58, 0x36, 0xE6, 0xEE, 0xE8, 0xE8, 0xE8, 0x74,
-	0xBB, 0xDD, 0xA3, 0x17, 0xAC, 0xB6, 0xB6, 0xB6, 0x80, 0x4E, 0xA7, 0xBB,
-	0xE4, 0x70, 0x38, 0xAC, 0xE4, 0xC1, 0xAF, 0x57, 0x3D, 0x25, 0x49, 0x82,
-	0xB8, 0xB8, 0xB8, 0xB8, 0xC4, 0xC4, 0xC4, 0x2C, 0xBD, 0x5E, 0xAF, 0x30,
-	0x18, 0x0C, 0x37, 0x7D, 0x8B, 0x0F, 0x9C, 0x99, 0xC9, 0x7D, 0xD3, 0xEE,
-	0x26, 0x67, 0x2D, 0x49, 0x30, 0x91, 0x31, 0x6B, 0xEA, 0xD4, 0xA9, 0x8F,
-	0x3F, 0xF2, 0xC8, 0x23, 0xDF, 0xCD, 0xCC, 0xCC, 0x4C, 0x06, 0xB8, 0x5C,
-	0x40, 0x2C, 0x08, 0x02, 0xA4, 0xA6, 0xA6, 0xE6, 0x4D, 0x9A, 0x34, 0x29,
-	0xAF, 0xBA, 0xBA, 0x7A, 0x56, 0x55, 0x55, 0xD5, 0x6B, 0x3A, 0x9D, 0xEE,
-	0xCF, 0x56, 0xAB, 0xB5, 0x8F, 0xE3, 0xB8, 0xD0, 0x03, 0xE1, 0x72, 0xB9,
-	0x40, 0x2E, 0x97, 0x83, 0x46, 0xA3, 0x19, 0x92, 0xF8, 0xAA, 0xD5, 0x6A,
-	0x3B, 0x77, 0xEF, 0xDE, 0xFD, 0x5F, 0x5E, 0xAF, 0xD7, 0xFB, 0xE8, 0xA3,
-	0x8F, 0xFE, 0x30, 0x26, 0x26, 0x26, 0x0E, 0x37, 0xF5, 0x24, 0xFB, 0x66,
-	0x45, 0x32, 0x76, 0xC8, 0xE8, 0xB2, 0x24, 0x49, 0xB8, 0xDB, 0x0F, 0x60,
-	0x0A, 0x85, 0x28, 0x8A, 0xE0, 0x70, 0x38, 0x20, 0x36, 0x36, 0x36, 0xE6,
-	0xA7, 0x3F, 0xFD, 0xE9, 0xDF, 0xBF, 0xFA, 0xEA, 0xAB, 0x49, 0x67, 0xCE,
-	0x9C, 0xF9, 0x1F, 0x9E, 0xE7, 0xEB, 0x20, 0xAC, 0x32, 0xE3, 0x4E, 0x07,
-	0xD3, 0x1E, 0x4C, 0x26, 0x53, 0x68, 0x09, 0x8D, 0xD7, 0xFC, 0x66, 0x5B,
-	0x9D, 0x2C, 0xCB, 0x72, 0xC9, 0xC9, 0xC9, 0xB9, 0x71, 0x71, 0x71, 0x71,
-	0x64, 0xB5, 0xC3, 0x68, 0x4A, 0xB5, 0x10, 0x7C, 0xAD, 0xDD, 0x6E, 0xB7,
-	0x5E, 0xBC, 0x78, 0xB1, 0xD5, 0xE5, 0x72, 0x8D, 0xDE, 0xE9, 0x1E, 0x6C,
-	0xCE, 0xD5, 0xEE, 0xF1, 0x78, 0x06, 0xC8, 0x52, 0x8F, 0x48, 0x09, 0x6F,
-	0xED, 0x81, 0x21, 0xEB, 0xD4, 0xD4, 0xD4, 0xA2, 0xD2, 0xD2, 0xD2, 0x0C,
-	0xBD, 0x5E, 0xDF, 0x18, 0xF1, 0xC1, 0xAE, 0x13, 0xEC, 0x10, 0xA0, 0x54,
-	0x2A, 0x41, 0xA9, 0x54, 0x42, 0x6D, 0x6D, 0xED, 0x88, 0xCD, 0x08, 0xEF,
-	0x54, 0x82, 0xCB, 0x33, 0x46, 0x10, 0x84, 0xF1, 0x53, 0xA6, 0x4C, 0x79,
-	0x71, 0xFD, 0xFA, 0xF5, 0x0F, 0xE9, 0xF5, 0x7A, 0x35, 0xC0, 0x95, 0x9A,
-	0x3C, 0x4C, 0x41, 0x10, 0x04, 0x01, 0x8A, 0x8B, 0x8B, 0x4B, 0xBE, 0xF3,
-	0x9D, 0xEF, 0xFC, 0x04, 0x00, 0xC4, 0x1D, 0x3B, 0x76, 0xFC, 0x81, 0xE3,
-	0x38, 0x1F, 0x99, 0x8D, 0x8D, 0xBB, 0x0A, 0x93, 0x51, 0xBF, 0x60, 0x25,
-	0x43, 0xEF, 0x8E, 0x1D, 0x3B, 0xFE, 0xB3, 0xA7, 0xA7, 0xC7, 0xF6, 0xB3,
-	0x9F, 0xFD, 0xEC, 0x57, 0x66, 0xB3, 0x59, 0x3F, 0x5C, 0x27, 0x82, 0x48,
-	0xCE, 0x17, 0x97, 0x3E, 0x98, 0x93, 0x85, 0xCB, 0x51, 0xCC, 0x1E, 0x37,
-	0x18, 0x0C, 0xB8, 0x2C, 0x65, 0x9E, 0x79, 0xE6, 0x99, 0xA7, 0xB6, 0x6F,
-	0xDF, 0x9E, 0x72, 0xF0, 0xE0, 0xC1, 0xDF, 0x88, 0xA2, 0xB8, 0x17, 0x00,
-	0xC4, 0xBB, 0x69, 0x89, 0x18, 0x1F, 0x1F, 0x0F, 0xA5, 0xA5, 0xA5, 0xF8,
-	0xBC, 0x86, 0x9E, 0x33, 0x80, 0xD1, 0xEF, 0x0F, 0x38, 0x1A, 0x1C, 0x0E,
-	0x47, 0x6E, 0x66, 0x66, 0xE6, 0x38, 0x52, 0x24, 0x91, 0xD1, 0x5C, 0x7F,
-	0x5C, 0x8D, 0xB1, 0x2C, 0x0B, 0x36, 0x9B, 0xAD, 0xBF, 0xB3, 0xB3, 0xB3,
-	0xF5, 0x6A, 0xB9, 0x90, 0x23, 0x0A, 0x56, 0x5A, 0x5A, 0x1A, 0xA8, 0x54,
-	0x2A, 0x5B, 0x20, 0x10, 0xB0, 0xB9, 0xDD, 0xEE, 0x50, 0x69, 0x41, 0x24,
-	0x90, 0x03, 0x1C, 0x97, 0x86, 0x18, 0xEA, 0x4E, 0x4E, 0x4E, 0xCE, 0x9C,
-	0x30, 0x61, 0x42, 0xB6, 0x46, 0xA3, 0xB9, 0xA9, 0x82, 0xC5, 0x71, 0x1C,
-	0xB4, 0xB6, 0xB6, 0xC2, 0xE9, 0xD3, 0xA7, 0x61, 0xD5, 0xAA, 0x55, 0xE0,
-	0x72, 0xB9, 0xA0, 0xBA, 0xBA, 0xFA, 0x66, 0xBE, 0xE5, 0x6D, 0x07, 0x0A,
-	0x06, 0xCF, 0xF3, 0xB3, 0x4B, 0x4A, 0x4A, 0x5E, 0x5C, 0xB6, 0x6C, 0xD9,
-	0x72, 0xBD, 0x5E, 0xAF, 0xF6, 0x7A, 0xBD, 0x21, 0xE1, 0xC6, 0x6E, 0x8F,
-	0x58, 0x32, 0xA2, 0x50, 0x28, 0x20, 0x3B, 0x3B, 0x3B, 0xE5, 0xB1, 0xC7,
-	0x1E, 0xFB, 0x3F, 0x73, 0xE7, 0xCE, 0x65, 0x5A, 0x5A, 0x5A, 0x5E, 0x7A,
-	0xF7, 0xDD, 0x77, 0xC1, 0xE9, 0x74, 0x86, 0x5A, 0x1D, 0xBB, 0x5C, 0x2E,
-	0x18, 0x1C, 0x1C, 0x1C, 0x32, 0x93, 0x07, 0x8F, 0xE3, 0x3C, 0x76, 0xEC,
-	0xD8, 0xDB, 0x2F, 0xBF, 0xFC, 0x32, 0xF7, 0xC4, 0x13, 0x4F, 0xFC, 0x34,
-	0x39, 0x39, 0x39, 0x0E, 0x73, 0xB1, 0x00, 0x22, 0x9B, 0xF0, 0xD0, 0x59,
-	0x8B, 0x89, 0xA5, 0x18, 0x79, 0x24, 0x4B, 0x98, 0xF0, 0xF7, 0x92, 0x24,
-	0x81, 0x52, 0xA9, 0x54, 0x2C, 0x5A, 0xB4, 0x68, 0x99, 0x28, 0x8A, 0x6A,
-	0x8F, 0xC7, 0xA3, 0x06, 0x80, 0x2D, 0x37, 0xED, 0x82, 0xDE, 0x86, 0x48,
-	0x92, 0x04, 0x99, 0x99, 0x99, 0xA0, 0xD5, 0x6A, 0xE1, 0xEB, 0xAF, 0xBF,
-	0x86, 0xA2, 0xA2, 0x22, 0x48, 0x4B, 0x4B, 0xBB, 0xE9, 0x5D, 0x7D, 0xDD,
-	0x6E, 0x77, 0x76, 0x52, 0x52, 0x52, 0x26, 0x00, 0x84, 0x52, 0x50, 0xC2,
-	0x2D, 0xAD, 0x48, 0x85, 0x2B, 0x10, 0x08, 0xE0, 0x32, 0xD7, 0x21, 0x49,
-	0x92, 0xF3, 0x6A, 0x42, 0x3B, 0xA2, 0x60, 0xE9, 0xF5, 0x7A, 0x90, 0xC9,
-	0x64, 0x62, 0x4B, 0x4B, 0xCB, 0xF9, 0xE2, 0xE2, 0xE2, 0xBE, 0x8C, 0x8C,
-	0x8C, 0x58, 0x5C, 0x5A, 0x21, 0xD7, 0x3A, 0x21, 0x32, 0xD9, 0x14, 0x3F,
-	0xCC, 0xF8, 0xF1, 0xE3, 0xC7, 0xB5, 0xB5, 0xB5, 0x95, 0x1C, 0x3F, 0x7E,
-	0x7C, 0xFB, 0xCD, 0x5A, 0xA2, 0x05, 0x0B, 0x69, 0xC1, 0x66, 0xB3, 0x85,
-	0x4A, 0x4F, 0xB0, 0x60, 0xF7, 0x6E, 0x81, 0x65, 0x59, 0xF0, 0x7A, 0xBD,
-	0xB0, 0x77, 0xEF, 0xDE, 0x45, 0x73, 0xE7, 0xCE, 0xFD, 0xAB, 0xC5, 0x8B,
-	0x17, 0x2F, 0x35, 0x99, 0x4C, 0x0A, 0xB7, 0xDB, 0x3D, 0x64, 0x16, 0x26,
-	0xFF, 0x45, 0x21, 0x90, 0xC9, 0x64, 0x30, 0x7E, 0xFC, 0xF8, 0xE4, 0x82,
-	0x82, 0x82, 0x1F, 0x6D, 0xDB, 0xB6, 0xCD, 0xCF, 0xF3, 0xFC, 0xCB, 0x1E,
-	0x8F, 0x47, 0x24, 0x1B, 0xD5, 0xF5, 0xF5, 0xF5, 0x41, 0x5D, 0x5D, 0x1D,
-	0xA4, 0xA7, 0xA7, 0x87, 0x7A, 0x4D, 0x05, 0x53, 0x18, 0x06, 0x4F, 0x9C,
-	0x38, 0xF1, 0xAA, 0x20, 0x08, 0xEC, 0xA3, 0x8F, 0x3E, 0xFA, 0x7C, 0x76,
-	0x76, 0x76, 0x16, 0xB9, 0x1F, 0x00, 0x0E, 0x6C, 0x32, 0x81, 0x18, 0x6B,
-	0xEF, 0x48, 0x61, 0x22, 0x2D, 0x33, 0x7C, 0x4F, 0xF2, 0xF5, 0xE8, 0xEB,
-	0xE2, 0x79, 0x1E, 0x34, 0x1A, 0x8D, 0x7C, 0xFE, 0xFC, 0xF9, 0xF3, 0x1B,
-	0x1A, 0x1A, 0x54, 0x87, 0x0F, 0x1F, 0x56, 0x97, 0x94, 0x94, 0x7C, 0x78,
-	0x3B, 0x16, 0xD9, 0xDF, 0x0C, 0xFC, 0x7E, 0x3F, 0x28, 0x14, 0x0A, 0xD0,
-	0xE9, 0x74, 0xE0, 0x74, 0x3A, 0xA1, 0xAF, 0xAF, 0x2F, 0xD4, 0x59, 0x82,
-	0x2C, 0xCE, 0x1E, 0x2B, 0xD0, 0x18, 0x99, 0x3D, 0x7B, 0xF6, 0xF8, 0xF1,
-	0xE3, 0xC7, 0xE7, 0x63, 0xD0, 0x0A, 0xEB, 0x1F, 0x01, 0x46, 0xBF, 0x91,
-	0xAA, 0x4C, 0x26, 0x83, 0xB6, 0xB6, 0xB6, 0x81, 0xC1, 0xC1, 0xC1, 0x86,
-	0x55, 0xAB, 0x56, 0x05, 0xAE, 0xB6, 0x0A, 0x1A, 0x51, 0xB0, 0x82, 0xCE,
-	0x52, 0xA9, 0xB2, 0xB2, 0xB2, 0xB2, 0xAC, 0xAC, 0xEC, 0x62, 0x56, 0x56,
-	0x56, 0x6C, 0xA4, 0x1F, 0x9E, 0x9C, 0x01, 0xF1, 0xE4, 0x51, 0xB0, 0x12,
-	0x13, 0x13, 0x8D, 0x7A, 0xBD, 0x7E, 0x62, 0x73, 0x73, 0x73, 0xBC, 0x5A,
-	0xAD, 0xEE, 0xB9, 0x19, 0x9B, 0x3F, 0x78, 0xBD, 0x5E, 0xD0, 0xE9, 0x74,
-	0xE0, 0xF5, 0x7A, 0x43, 0x4B, 0x8C, 0xDB, 0xB5, 0x9F, 0xD0, 0x58, 0x13,
-	0x74, 0x5E, 0x82, 0x28, 0x8A, 0xF2, 0x09, 0x13, 0x26, 0xAC, 0x4A, 0x4D,
-	0x4D, 0xFD, 0x61, 0x42, 0x42, 0xC2, 0x7C, 0x93, 0xC9, 0x24, 0xC3, 0x7B,
-	0x80, 0x51, 0x3E, 0x72, 0xB2, 0x08, 0x5F, 0xB6, 0x05, 0x33, 0xD1, 0x33,
-	0x92, 0x93, 0x93, 0xFF, 0xCF, 0x86, 0x0D, 0x1B, 0xA0, 0xA3, 0xA3, 0xE3,
-	0x8F, 0xCD, 0xCD, 0xCD, 0x82, 0xD5, 0x6A, 0x0D, 0xB5, 0xD6, 0xB1, 0x5A,
-	0xAD, 0xA0, 0x56, 0xAB, 0xC1, 0x64, 0x32, 0x85, 0x9C, 0xEB, 0xC1, 0xBC,
-	0xA9, 0xC1, 0x23, 0x47, 0x8E, 0xFC, 0xD1, 0xE9, 0x74, 0x5A, 0xBF, 0xFB,
-	0xDD, 0xEF, 0xFE, 0x75, 0x6E, 0x6E, 0x6E, 0x3E, 0x76, 0x8A, 0x20, 0x9B,
-	0xFE, 0x61, 0x02, 0x24, 0xBE, 0x1F, 0x3E, 0x7C, 0x78, 0x2E, 0x23, 0x8D,
-	0x0D, 0x9C, 0xC1, 0x31, 0x4F, 0x4C, 0x10, 0x04, 0x30, 0x1A, 0x8D, 0x6C,
-	0x41, 0x41, 0xC1, 0xCC, 0x96, 0x96, 0x16, 0x6D, 0x73, 0x73, 0x73, 0x72,
-	0x77, 0x77, 0xF7, 0x5B, 0x81, 0x40, 0xC0, 0x76, 0xA7, 0xDF, 0x73, 0x5C,
-	0xC5, 0xE0, 0xBD, 0xB5, 0xD9, 0x6C, 0x21, 0xD1, 0x32, 0x9B, 0xCD, 0x63,
-	0xFE, 0x7E, 0xC1, 0x1A, 0xD2, 0xB8, 0x55, 0xAB, 0x56, 0x15, 0xC7, 0xC5,
-	0xC5, 0x19, 0x70, 0x99, 0x3E, 0xDA, 0x84, 0x51, 0xF2, 0xFC, 0x19, 0x86,
-	0x81, 0xB6, 0xB6, 0xB6, 0x96, 0x8A, 0x8A, 0x8A, 0x63, 0x06, 0x83, 0x41,
-	0xBA, 0x5A, 0x5B, 0xF6, 0x11, 0x05, 0xEB, 0xC2, 0x85, 0x0B, 0x10, 0x08,
-	0x04, 0x44, 0x97, 0xCB, 0x55, 0xBD, 0x68, 0xD1, 0xA2, 0x96, 0x59, 0xB3,
-	0x66, 0x4D, 0x1A, 0xA9, 0x2D, 0xC7, 0xD5, 0x4E, 0x04, 0xE0, 0x9B, 0x9B,
-	0xB0, 0x26, 0x25, 0x25, 0x95, 0xA4, 0xA6, 0xA6, 0xCE, 0xEE, 0xEC, 0xEC,
-	0xFC, 0x18, 0x60, 0x6C, 0xF6, 0x05, 0x24, 0x07, 0x7E, 0x5A, 0x5A, 0x1A,
-	0x58, 0x2C, 0x16, 0x38, 0x73, 0xE6, 0xCC, 0x5D, 0x17, 0x09, 0x0C, 0x76,
-	0x6F, 0x30, 0xCF, 0x9F, 0x3F, 0x7F, 0xC5, 0x13, 0x4F, 0x3C, 0xF1, 0x97,
-	0x33, 0x66, 0xCC, 0x28, 0x47, 0xA7, 0x35, 0xA6, 0x25, 0x90, 0xBB, 0x3B,
-	0x5F, 0xEB, 0x78, 0xA5, 0xA5, 0xA5, 0x69, 0xD9, 0xD9, 0xD9, 0x7F, 0x73,
-	0xF8, 0xF0, 0xE1, 0xCE, 0x4F, 0x3E, 0xF9, 0xE4, 0x6B, 0xB7, 0xDB, 0xED,
-	0x26, 0xD3, 0x1B, 0xB0, 0x48, 0x9A, 0xEC, 0x8F, 0xA5, 0x50, 0x28, 0x40,
-	0xAD, 0x56, 0x5B, 0xF7, 0xEC, 0xD9, 0xF3, 0x3A, 0xC3, 0x30, 0xCC, 0x33,
-	0xCF, 0x3C, 0xF3, 0xE3, 0xBC, 0xBC, 0xBC, 0x7C, 0x14, 0x21, 0x72, 0x02,
-	0x09, 0x5F, 0xFA, 0x45, 0xFA, 0x39, 0xB1, 0xE1, 0x9E, 0x4E, 0xA7, 0x03,
-	0x85, 0x42, 0x11, 0xDA, 0x30, 0x63, 0xC2, 0x84, 0x09, 0x13, 0x1A, 0x1A,
-	0x1A, 0xFE, 0x7E, 0xC2, 0x84, 0x09, 0x4A, 0xA7, 0xD3, 0xF9, 0xBE, 0xD3,
-	0xE9, 0xBC, 0x74, 0xA7, 0x8B, 0x16, 0x09, 0x19, 0x61, 0x25, 0x5B, 0x23,
-	0x8D, 0x05, 0xF8, 0x1C, 0xA7, 0xA5, 0xA5, 0xCD, 0x8C, 0x8B, 0x8B, 0x1B,
-	0x87, 0xEF, 0x47, 0xF6, 0x0F, 0xBB, 0x5E, 0x06, 0x06, 0x06, 0xCE, 0xD7,
-	0xD6, 0xD6, 0x56, 0xC9, 0xE5, 0x72, 0xE9, 0x6A, 0x46, 0xCC, 0x55, 0x7D,
-	0x58, 0xC1, 0xAC, 0xF0, 0x8B, 0x72, 0xB9, 0xBC, 0x85, 0xE7, 0x79, 0x49,
-	0xA9, 0x54, 0x8E, 0xFA, 0xCE, 0xA3, 0xA5, 0x85, 0xDF, 0x33, 0x0C, 0x03,
-	0xE3, 0xC6, 0x8D, 0xCB, 0x9D, 0x3E, 0x7D, 0xFA, 0x82, 0x57, 0x5F, 0x7D,
-	0x75, 0x8B, 0x20, 0x08, 0x3C, 0x46, 0x7F, 0xAE, 0x67, 0x60, 0x91, 0x25,
-	0x0A, 0xB8, 0x4C, 0x58, 0xB4, 0x68, 0x11, 0x64, 0x66, 0x66, 0x42, 0x6D,
-	0x6D, 0xED, 0x1D, 0x2D, 0x58, 0xE1, 0xF9, 0x4D, 0xC1, 0xC1, 0x69, 0x99,
-	0x37, 0x6F, 0xDE, 0x23, 0x4F, 0x3D, 0xF5, 0xD4, 0x0B, 0xE3, 0xC7, 0x8F,
-	0xCF, 0xC7, 0x6B, 0xA2, 0xD5, 0x6A, 0x43, 0xDD, 0x46, 0x75, 0x3A, 0x5D,
-	0xC4, 0xD7, 0x5A, 0xA1, 0x50, 0x80, 0xD9, 0x6C, 0x4E, 0xB5, 0x58, 0x2C,
-	0x3F, 0x63, 0x59, 0xB6, 0xCB, 0xE7, 0xF3, 0x1D, 0x09, 0xEF, 0x89, 0x6E,
-	0xB7, 0xDB, 0xBF, 0x51, 0xDF, 0x16, 0xAC, 0x7F, 0x0B, 0x6C, 0xDF, 0xBE,
-	0xFD, 0x4D, 0xA7, 0xD3, 0xE9, 0x7A, 0xEE, 0xB9, 0xE7, 0x7E, 0x5A, 0x5A,
-	0x5A, 0x5A, 0x8A, 0xE9, 0x09, 0x32, 0x99, 0x2C, 0x94, 0x22, 0xE1, 0xF5,
-	0x7A, 0x43, 0x3D, 0xA2, 0x46, 0x13, 0x0E, 0xC7, 0x59, 0x9D, 0x6C, 0xD3,
-	0x22, 0x8A, 0x22, 0x14, 0x14, 0x14, 0x58, 0x5E, 0x7C, 0xF1, 0xC5, 0xBF,
-	0x49, 0x4C, 0x4C, 0x4C, 0x3E, 0x70, 0xE0, 0xC0, 0x2B, 0x1E, 0x8F, 0xE7,
-	0x1C, 0xDC, 0x45, 0x11, 0x44, 0xBC, 0x26, 0x36, 0x9B, 0x0D, 0x06, 0x07,
-	0x07, 0x43, 0xD1, 0xD5, 0xEB, 0xD9, 0x97, 0x01, 0xC1, 0x95, 0x8A, 0x5C,
-	0x2E, 0x57, 0xAC, 0x5F, 0xBF, 0x7E, 0x7E, 0x41, 0x41, 0x41, 0x3E, 0xBE,
-	0x17, 0x00, 0x8C, 0x6A, 0x6B, 0x7A, 0x92, 0xA0, 0xC6, 0x48, 0x32, 0x99,
-	0xAC, 0x65, 0xDC, 0xB8, 0x71, 0x1D, 0xC3, 0xD5, 0x9D, 0x92, 0x8C, 0x28,
-	0x58, 0x6F, 0xBD, 0xF5, 0x56, 0xE8, 0x61, 0x3F, 0x7F, 0xFE, 0x7C, 0xEB,
-	0xB9, 0x73, 0xE7, 0x7A, 0x8B, 0x8B, 0x8B, 0xE3, 0xC9, 0xE8, 0xDF, 0x48,
-	0x90, 0x95, 0xFB, 0xC3, 0x45, 0x18, 0x4D, 0x26, 0x93, 0xB6, 0xB8, 0xB8,
-	0xB8, 0x5C, 0xA7, 0xD3, 0x15, 0x0E, 0x0E, 0x0E, 0x56, 0x8F, 0x66, 0xA0,
-	0x8E, 0xF4, 0x7E, 0x63, 0x39, 0x93, 0x44, 0x03, 0x44, 0x12, 0x28, 0xA8,
-	0x54, 0x2A, 0xF0, 0x7A, 0xBD, 0xC0, 0xF3, 0x7C, 0xD2, 0xA2, 0x45, 0x8B,
-	0x1E, 0x7B, 0xEE, 0xB9, 0xE7, 0xBE, 0x97, 0x97, 0x97, 0x97, 0x09, 0x70,
-	0x25, 0xE9, 0x13, 0xB3, 0xC6, 0xC9, 0x94, 0x84, 0x6B, 0x81, 0x33, 0x74,
-	0xB0, 0xD5, 0xF2, 0xB4, 0xDD, 0xBB, 0x77, 0x2F, 0x38, 0x77, 0xEE, 0x5C,
-	0x2D, 0xC3, 0x30, 0x4E, 0xF2, 0x18, 0xE4, 0x84, 0x14, 0x8E, 0x5A, 0xAD,
-	0xF6, 0x1D, 0x3C, 0x78, 0x70, 0x93, 0xDB, 0xED, 0xF6, 0xFD, 0xE0, 0x07,
-	0x3F, 0xF8, 0xBB, 0x9C, 0x9C, 0x9C, 0x52, 0x8C, 0xF2, 0xE1, 0x12, 0x50,
-	0xA1, 0x50, 0x8C, 0x2A, 0x97, 0x08, 0x1F, 0x3E, 0x8C, 0x54, 0x3A, 0x9D,
-	0x4E, 0x8C, 0x54, 0x86, 0xFC, 0x94, 0x49, 0x49, 0x49, 0xE6, 0x27, 0x9F,
-	0x7C, 0xF2, 0xBB, 0xB1, 0xB1, 0xB1, 0xA9, 0xC7, 0x8F, 0x1F, 0x7F, 0x59,
-	0x10, 0x84, 0x7D, 0x92, 0x24, 0xDD, 0x35, 0x4E, 0x4C, 0x4C, 0x09, 0xC1,
-	0xA2, 0xE9, 0xAB, 0x35, 0x2E, 0xBC, 0x16, 0x28, 0x80, 0x82, 0x20, 0x80,
-	0x4E, 0xA7, 0xCB, 0x2A, 0x2A, 0x2A, 0x9A, 0x6A, 0x34, 0x1A, 0x75, 0xA4,
-	0x8F, 0x9A, 0x3C, 0xEE, 0x68, 0x1D, 0xEE, 0x8D, 0x8D, 0x8D, 0x7D, 0x2C,
-	0xCB, 0x76, 0xDC, 0x73, 0xCF, 0x3D, 0xD7, 0x7C, 0xFD, 0x88, 0x82, 0x45,
-	0x6E, 0x77, 0x75, 0xE1, 0xC2, 0x85, 0x6A, 0x00, 0xA8, 0x2D, 0x29, 0x29,
-	0x19, 0xB9, 0x51, 0xCD, 0x30, 0xE0, 0xDA, 0x9A, 0xF4, 0x5B, 0x60, 0xF3,
-	0xB7, 0xEC, 0xEC, 0xEC, 0xDC, 0x85, 0x0B, 0x17, 0xAE, 0xDD, 0xBF, 0x7F,
-	0xFF, 0x85, 0xE4, 0xE4, 0x64, 0x67, 0x42, 0x42, 0xC2, 0x75, 0x39, 0xC5,
-	0x65, 0x32, 0x19, 0x38, 0x9D, 0x4E, 0xA8, 0xAF, 0xAF, 0x07, 0x87, 0xC3,
-	0x31, 0xA4, 0xC5, 0xC9, 0x9D, 0x8C, 0x42, 0xA1, 0x00, 0xBB, 0xDD, 0x0E,
-	0x3B, 0x76, 0xEC, 0x00, 0x87, 0xC3, 0x01, 0xE7, 0xCE, 0x9D, 0x2B, 0x2A,
-	0x2D, 0x2D, 0xFD, 0x8B, 0x27, 0x9E, 0x78, 0xE2, 0xFE, 0x98, 0x98, 0x98,
-	0x18, 0x8F, 0xC7, 0x13, 0xEA, 0x44, 0x81, 0x89, 0x9C, 0xD8, 0xE7, 0x2B,
-	0xD2, 0x01, 0x45, 0x5A, 0x70, 0xA2, 0x28, 0xC2, 0xA4, 0x49, 0x93, 0x16,
-	0x77, 0x76, 0x76, 0xEE, 0x6B, 0x6F, 0x6F, 0x3F, 0x34, 0x5C, 0xC7, 0x8D,
-	0xE1, 0xEE, 0x5F, 0x70, 0xF7, 0x1B, 0xFF, 0xA1, 0x43, 0x87, 0x3E, 0x73,
-	0xBB, 0xDD, 0xAE, 0x7F, 0xF8, 0x87, 0x7F, 0xF8, 0x77, 0x93, 0xC9, 0x34,
-	0x0E, 0x83, 0x20, 0x38, 0x51, 0x29, 0x95, 0xCA, 0x90, 0xB8, 0x5E, 0xAB,
-	0x9B, 0x07, 0x99, 0x0D, 0x8F, 0xEF, 0x81, 0x2E, 0x08, 0xAC, 0x65, 0x73,
-	0xB9, 0x5C, 0x60, 0x30, 0x18, 0x34, 0xEB, 0xD7, 0xAF, 0x5F, 0x9B, 0x9B,
-	0x9B, 0x9B, 0x7A, 0xF8, 0xF0, 0xE1, 0xFF, 0xF2, 0xFB, 0xFD, 0x1F, 0x4B,
-	0x92, 0x24, 0xDC, 0xC9, 0x56, 0x37, 0xC2, 0xF3, 0x3C, 0x14, 0x16, 0x16,
-	0x42, 0x42, 0x42, 0x02, 0xEC, 0xD9, 0xB3, 0x07, 0x72, 0x72, 0x72, 0x42,
-	0x85, 0xFE, 0xA3, 0x45, 0xA1, 0x50, 0x40, 0x7B, 0x7B, 0x3B, 0xB4, 0xB6,
-	0xB6, 0xEA, 0x16, 0x2E, 0x5C, 0x78, 0x4F, 0x6E, 0x6E, 0x6E, 0x3E, 0xBE,
-	0x07, 0x5A, 0xC9, 0xF8, 0xBC, 0x8D, 0xF6, 0xDA, 0xCA, 0xE5, 0x72, 0x68,
-	0x6A, 0x6A, 0xAA, 0x3B, 0x78, 0xF0, 0xE0, 0x69, 0x83, 0xC1, 0x10, 0xFA,
-	0xF9, 0xCA, 0x95, 0x2B, 0x87, 0x7F, 0x7D, 0x24, 0x07, 0x3D, 0x73, 0xE6,
-	0x4C, 0x85, 0x4A, 0xA5, 0xAA, 0x05, 0x80, 0x51, 0x09, 0xD6, 0x70, 0x49,
-	0x64, 0x38, 0xA8, 0x2D, 0x16, 0x8B, 0x69, 0xF9, 0xF2, 0xE5, 0xEB, 0xAA,
-	0xAA, 0xAA, 0xB6, 0x2B, 0x14, 0x8A, 0x63, 0x31, 0x31, 0x31, 0xD7, 0x15,
-	0x8A, 0xC5, 0xC1, 0x7A, 0xB7, 0xED, 0xDC, 0x8C, 0x7E, 0x8A, 0xCE, 0xCE,
-	0x4E, 0x18, 0x18, 0x18, 0x58, 0x50, 0x5C, 0x5C, 0xFC, 0x83, 0xC5, 0x8B,
-	0x17, 0x2F, 0x8D, 0x8F, 0x8F, 0xD7, 0xE1, 0xA6, 0xA7, 0x00, 0x30, 0x44,
-	0x04, 0xD0, 0x97, 0x15, 0xE9, 0x92, 0x10, 0xFD, 0x13, 0x2E, 0x97, 0x0B,
-	0x18, 0x86, 0x81, 0x82, 0x82, 0x82, 0xA2, 0xDA, 0xDA, 0xDA, 0x9C, 0xB6,
-	0xB6, 0xB6, 0x43, 0xE1, 0xD7, 0x1B, 0x97, 0x68, 0x58, 0xD7, 0x46, 0x5A,
-	0x5D, 0x4A, 0xA5, 0x12, 0x3C, 0x1E, 0x8F, 0xAF, 0xBD, 0xBD, 0xFD, 0x2B,
-	0x95, 0x4A, 0xE5, 0x1E, 0x18, 0x18, 0xF8, 0x67, 0xB9, 0x5C, 0x3E, 0x83,
-	0xE3, 0x38, 0xF0, 0x7A, 0xBD, 0xA0, 0xD5, 0x6A, 0x87, 0xF4, 0x65, 0x8F,
-	0xE4, 0xB3, 0x63, 0xA9, 0x0E, 0x99, 0x47, 0xE6, 0xF3, 0xF9, 0xC0, 0xEB,
-	0xF5, 0xE2, 0x96, 0x65, 0x00, 0x00, 0xA0, 0xD5, 0x6A, 0xB9, 0xF2, 0xF2,
-	0xF2, 0xE9, 0x7A, 0xBD, 0xFE, 0xE7, 0x87, 0x0E, 0x1D, 0x4A, 0x70, 0x3A,
-	0x9D, 0xAF, 0x8B, 0xA2, 0xE8, 0xBC, 0x1E, 0xF7, 0x43, 0x34, 0x21, 0x8A,
-	0x22, 0x68, 0x34, 0x1A, 0x88, 0x8D, 0x8D, 0x0D, 0xB5, 0xA7, 0x31, 0x9B,
-	0xCD, 0xD7, 0xF5, 0x8C, 0x29, 0x95, 0x4A, 0xE8, 0xE9, 0xE9, 0x01, 0x9D,
-	0x4E, 0x97, 0xB7, 0x6C, 0xD9, 0xB2, 0x8D, 0xB1, 0xB1, 0xB1, 0x16, 0x4C,
-	0x8D, 0x21, 0x13, 0x88, 0xC3, 0x7B, 0xE1, 0x47, 0x02, 0xC3, 0x30, 0xD0,
-	0xDA, 0xDA, 0x5A, 0xBB, 0x73, 0xE7, 0xCE, 0x4A, 0x52, 0xB0, 0xFE, 0xF6,
-	0x6F, 0xFF, 0x76, 0xD8, 0xD7, 0x47, 0x24, 0x58, 0x3C, 0xCF, 0x3B, 0x3A,
-	0x3A, 0x3A, 0x6A, 0xFA, 0xFA, 0xFA, 0xFA, 0x63, 0x63, 0x63, 0x2D, 0x64,
-	0x46, 0xEB, 0x48, 0x90, 0xBF, 0xC7, 0xE5, 0x0B, 0x0E, 0xB4, 0x40, 0x20,
-	0x00, 0x1C, 0xC7, 0xB1, 0xB9, 0xB9, 0xB9, 0x45, 0x13, 0x26, 0x4C, 0x58,
-	0x3E, 0x38, 0x38, 0x78, 0xCE, 0xEF, 0xF7, 0x5B, 0x47, 0xBB, 0x2C, 0xC4,
-	0x70, 0x38, 0x6E, 0xA2, 0x70, 0xB7, 0x80, 0x62, 0xE5, 0x70, 0x38, 0x94,
-	0x4A, 0xA5, 0x72, 0xDD, 0xB2, 0x65, 0xCB, 0xBE, 0x3B, 0x61, 0xC2, 0x84,
-	0x05, 0x5A, 0xAD, 0x16, 0x5C, 0x2E, 0x57, 0x68, 0xB7, 0x64, 0x74, 0x6E,
-	0x93, 0x96, 0x15, 0x46, 0xF8, 0x22, 0x49, 0xE6, 0xC4, 0x56, 0xC0, 0xE8,
-	0xF7, 0x52, 0xAB, 0xD5, 0x32, 0x96, 0x65, 0x59, 0xEC, 0xA4, 0x10, 0x0E,
-	0xB6, 0x41, 0x0E, 0x07, 0xDF, 0xD7, 0x62, 0xB1, 0x88, 0x1C, 0xC7, 0xED,
-	0x7D, 0xEF, 0xBD, 0xF7, 0x7E, 0x61, 0x32, 0x99, 0x7E, 0xB6, 0x6E, 0xDD,
-	0xBA, 0xC5, 0x1C, 0xC7, 0x31, 0x4E, 0xA7, 0x53, 0x54, 0xA9, 0x54, 0x2C,
-	0xCE, 0xD6, 0xD7, 0x02, 0x2D, 0x68, 0x1C, 0x4B, 0x18, 0x7D, 0xC4, 0xD6,
-	0x36, 0x68, 0x19, 0x62, 0xF1, 0x36, 0xC7, 0x71, 0x30, 0x7E, 0xFC, 0xF8,
-	0x12, 0x99, 0x4C, 0xF6, 0x23, 0xB7, 0xDB, 0x9D, 0xFC, 0xD5, 0x57, 0x5F,
-	0xFD, 0xC9, 0x66, 0xB3, 0x9D, 0xB9, 0x93, 0x45, 0x0B, 0x97, 0x71, 0x58,
-	0x82, 0xE6, 0xF5, 0x7A, 0x87, 0xB4, 0xA7, 0x1E, 0x0D, 0x7E, 0xBF, 0x1F,
-	0x0C, 0x06, 0x83, 0x21, 0x31, 0x31, 0x71, 0x49, 0x5E, 0x5E, 0x5E, 0x31,
-	0x8E, 0x81, 0xF0, 0x16, 0x52, 0x64, 0xFD, 0x68, 0xA4, 0x56, 0x7C, 0x7F,
-	0x7F, 0xFF, 0xE0, 0xC5, 0x8B, 0x17, 0x6B, 0x7A, 0x7A, 0x7A, 0xAC, 0xB8,
-	0x09, 0xC7, 0xD5, 0x18, 0x51, 0xB0, 0x8E, 0x1D, 0x3B, 0x16, 0xFA, 0x3E,
-	0x98, 0x2C, 0x58, 0x7B, 0xEA, 0xD4, 0xA9, 0x93, 0xCB, 0x96, 0x2D, 0x5B,
-	0x76, 0xAD, 0x83, 0x86, 0xE7, 0xD0, 0x90, 0x15, 0xFC, 0xB8, 0x8E, 0x0E,
-	0x8A, 0x96, 0x72, 0xCD, 0x9A, 0x35, 0xF7, 0x6D, 0xDA, 0xB4, 0x69, 0x5F,
-	0x65, 0x65, 0xE5, 0xDE, 0xAB, 0x6D, 0x2E, 0x39, 0xDC, 0x7B, 0x68, 0x34,
-	0x1A, 0xC8, 0xCE, 0xCE, 0x86, 0xA4, 0xA4, 0x24, 0xA8, 0xAF, 0xAF, 0xBF,
-	0x2B, 0x44, 0x8B, 0x61, 0x2E, 0xB7, 0x35, 0xD6, 0xE9, 0x74, 0x09, 0xE5,
-	0xE5, 0xE5, 0x6B, 0x27, 0x4D, 0x9A, 0xF4, 0x62, 0x79, 0x79, 0xF9, 0x38,
-	0x80, 0xCB, 0x3B, 0xC2, 0xA0, 0x68, 0xA0, 0x65, 0x85, 0x1B, 0x45, 0x08,
-	0x82, 0x00, 0x1C, 0xC7, 0x81, 0x52, 0xA9, 0x8C, 0x78, 0xE9, 0x8D, 0xD7,
-	0x53, 0xAD, 0x56, 0x83, 0x42, 0xA1, 0x80, 0x96, 0x96, 0x96, 0xC6, 0xC1,
-	0xC1, 0xC1, 0xD6, 0xD8, 0xD8, 0xD8, 0x11, 0x97, 0x6D, 0x98, 0x9D, 0x3E,
-	0x1C, 0xD8, 0x89, 0x61, 0xEF, 0xDE, 0xBD, 0xBB, 0xFA, 0xFA, 0xFA, 0x78,
-	0xA3, 0xD1, 0x68, 0x9F, 0x39, 0x73, 0xE6, 0x72, 0x8D, 0x46, 0xA3, 0x25,
-	0x13, 0x43, 0x23, 0xBD, 0x0E, 0x64, 0xC4, 0x11, 0x53, 0x35, 0x34, 0x1A,
-	0xCD, 0x10, 0x07, 0x3C, 0x8A, 0x9A, 0x4C, 0x26, 0x83, 0xA2, 0xA2, 0xA2,
-	0x8C, 0xE4, 0xE4, 0xE4, 0x1F, 0xC5, 0xC5, 0xC5, 0x25, 0x1F, 0x3A, 0x74,
-	0xE8, 0x4D, 0x97, 0xCB, 0x75, 0x02, 0x00, 0x6E, 0x59, 0xAB, 0xA3, 0x6F,
-	0x03, 0x4C, 0xC4, 0x4D, 0x48, 0x48, 0x00, 0x85, 0x42, 0x01, 0xCD, 0xCD,
-	0xCD, 0xA1, 0x6D, 0xD2, 0x22, 0xC5, 0xED, 0x76, 0x43, 0x66, 0x66, 0x66,
-	0xE9, 0xFA, 0xF5, 0xEB, 0xEF, 0xD7, 0x6A, 0xB5, 0x2A, 0xB2, 0x93, 0x06,
-	0xD9, 0xE4, 0x80, 0xDC, 0xFF, 0x21, 0x52, 0x27, 0xFC, 0xF1, 0xE3, 0xC7,
-	0x2B, 0xBB, 0xBB, 0xBB, 0x6B, 0x72, 0x72, 0x72, 0x22, 0xEA, 0x3A, 0x31,
-	0xA2, 0x60, 0xFD, 0xF2, 0x97, 0xBF, 0xBC, 0xF2, 0x22, 0xB9, 0x1C, 0x1C,
-	0x0E, 0xC7, 0x85, 0x43, 0x87, 0x0E, 0xED, 0x5B, 0xB2, 0x64, 0xC9, 0x32,
-	0xF2, 0x44, 0x86, 0x2B, 0xBF, 0x20, 0xFF, 0x25, 0x55, 0x18, 0xE0, 0x8A,
-	0xBA, 0x07, 0x05, 0x8C, 0x29, 0x2E, 0x2E, 0x2E, 0x49, 0x4E, 0x4E, 0xDE,
-	0xB0, 0x75, 0xEB, 0xD6, 0xC6, 0xEE, 0xEE, 0xEE, 0x36, 0xB2, 0xF7, 0x52,
-	0x38, 0xF8, 0x5E, 0xD8, 0x4F, 0x3C, 0x2B, 0x2B, 0x0B, 0x8A, 0x8B, 0x8B,
-	0x21, 0x25, 0x25, 0x05, 0x0E, 0x1C, 0x38, 0x70, 0x57, 0x08, 0x16, 0xCF,
-	0xF3, 0x72, 0x93, 0xC9, 0x94, 0x3B, 0x7B, 0xF6, 0xEC, 0xFB, 0x9F, 0x7A,
-	0xEA, 0xA9, 0xA7, 0x72, 0x72, 0x72, 0x32, 0x01, 0x20, 0xB4, 0x71, 0x44,
-	0x78, 0xD7, 0x4F, 0xB4, 0x6E, 0x31, 0xE9, 0x73, 0xB8, 0xE2, 0x62, 0x32,
-	0x21, 0x93, 0xBC, 0x77, 0x98, 0x6E, 0xA0, 0x52, 0xA9, 0x40, 0x14, 0x45,
-	0xE9, 0xF0, 0xE1, 0xC3, 0x87, 0x6B, 0x6B, 0x6B, 0xEB, 0x8D, 0x46, 0xE3,
-	0xB0, 0x16, 0x16, 0x1E, 0x33, 0x58, 0x64, 0x3D, 0xEC, 0x43, 0x11, 0xAC,
-	0x3D, 0x84, 0xE3, 0xC7, 0x8F, 0x1F, 0xFC, 0xF3, 0x9F, 0xFF, 0xEC, 0xB4,
-	0xDB, 0xED, 0xF6, 0x25, 0x4B, 0x96, 0xAC, 0x8B, 0x8B, 0x8B, 0x33, 0xE1,
-	0x31, 0xC3, 0xC7, 0x53, 0xB8, 0xB5, 0x8E, 0x62, 0x85, 0xD6, 0x23, 0x16,
-	0xD2, 0x87, 0x6F, 0xE8, 0x10, 0x9E, 0x07, 0x28, 0x49, 0x12, 0x18, 0x0C,
-	0x06, 0xC5, 0x83, 0x0F, 0x3E, 0xF8, 0x60, 0x52, 0x52, 0x52, 0xDE, 0xE1,
-	0xC3, 0x87, 0x5F, 0x15, 0x04, 0xE1, 0x63, 0x99, 0x4C, 0x66, 0x85, 0x3B,
-	0x14, 0xBC, 0x46, 0x59, 0x59, 0x59, 0xE0, 0x70, 0x38, 0xA0, 0xA6, 0xA6,
-	0x06, 0x5A, 0x5A, 0x5A, 0x42, 0xBB, 0x17, 0xE1, 0x24, 0x41, 0x5E, 0x6B,
-	0x32, 0x68, 0xE6, 0xF5, 0x7A, 0x21, 0x26, 0x26, 0x26, 0x69, 0xD6, 0xAC,
-	0x59, 0x1B, 0x26, 0x4E, 0x9C, 0x38, 0x39, 0x3C, 0x5F, 0x8E, 0xDC, 0x05,
-	0x3C, 0xDC, 0x6A, 0x27, 0x33, 0x04, 0xC2, 0x7F, 0x17, 0x14, 0x3A, 0xB1,
-	0xB6, 0xB6, 0x76, 0xA7, 0xDD, 0x6E, 0x6F, 0xCC, 0xCA, 0xCA, 0x8A, 0x68,
-	0x19, 0x19, 0xD1, 0x92, 0x30, 0x78, 0x70, 0xAB, 0xCB, 0xE5, 0x3A, 0xD2,
-	0xD5, 0xD5, 0xD5, 0x16, 0x17, 0x17, 0x97, 0x8A, 0xCB, 0x0C, 0x4C, 0xFE,
-	0x43, 0xEB, 0x09, 0x4F, 0x8E, 0xFC, 0x17, 0xE0, 0x4A, 0x2F, 0xEF, 0xD0,
-	0x1B, 0x13, 0x1B, 0x3D, 0xDC, 0x77, 0xDF, 0x7D, 0x8F, 0x34, 0x35, 0x35,
-	0x35, 0x7C, 0xFC, 0xF1, 0xC7, 0xBF, 0xD7, 0x68, 0x34, 0x7E, 0x54, 0xED,
-	0xF0, 0x01, 0x8F, 0x02, 0xA8, 0x52, 0xA9, 0x40, 0x2E, 0x97, 0x43, 0x4C,
-	0x4C, 0xCC, 0xB0, 0xDB, 0x63, 0xDD, 0x89, 0x04, 0x85, 0x5A, 0xC5, 0xB2,
-	0xEC, 0x9C, 0x7B, 0xEF, 0xBD, 0xF7, 0x99, 0x95, 0x2B, 0x57, 0x2E, 0x8B,
-	0x8F, 0x8F, 0x37, 0x01, 0x5C, 0x19, 0x94, 0x78, 0xBD, 0x64, 0x32, 0x59,
-	0x48, 0xAC, 0x00, 0x60, 0x48, 0xEA, 0x03, 0xD9, 0xEE, 0x07, 0x37, 0x91,
-	0x40, 0x1F, 0x12, 0x3A, 0xE6, 0xD1, 0x0A, 0xC6, 0x2E, 0xA2, 0xA2, 0x28,
-	0xC2, 0xE9, 0xD3, 0xA7, 0xCF, 0x1D, 0x38, 0x70, 0xE0, 0xE0, 0x81, 0x03,
-	0x07, 0x3A, 0xAF, 0xD6, 0x93, 0x1F, 0x37, 0x70, 0xCD, 0xCF, 0xCF, 0x0F,
-	0x95, 0x6C, 0x0C, 0x07, 0xC7, 0x71, 0x70, 0xE9, 0xD2, 0xA5, 0xAA, 0x8F,
-	0x3E, 0xFA, 0xE8, 0x9F, 0xDD, 0x6E, 0x77, 0xDF, 0xEA, 0xD5, 0xAB, 0xBF,
-	0x93, 0x98, 0x98, 0x68, 0x06, 0x80, 0xD0, 0x7B, 0x62, 0xB0, 0x26, 0xBC,
-	0xF3, 0x07, 0x5A, 0x0D, 0xE1, 0x13, 0x5B, 0xF8, 0xFF, 0xC9, 0x92, 0x91,
-	0xA0, 0xE8, 0x82, 0xDB, 0xED, 0x06, 0xB5, 0x5A, 0xAD, 0x98, 0x33, 0x67,
-	0xCE, 0x74, 0x9D, 0x4E, 0x67, 0xAE, 0xAB, 0xAB, 0xB3, 0xB8, 0x5C, 0xAE,
-	0xD7, 0x7C, 0x3E, 0x5F, 0xFF, 0x9D, 0x3C, 0xE1, 0xA1, 0xC5, 0x19, 0x13,
-	0x13, 0x03, 0x00, 0x10, 0xDA, 0xBB, 0x12, 0x05, 0x07, 0x9F, 0x23, 0xB2,
-	0xB4, 0x26, 0x38, 0x0E, 0x64, 0x4B, 0x96, 0x2C, 0x59, 0xF7, 0xE0, 0x83,
-	0x0F, 0x3E, 0x86, 0x95, 0x2E, 0x23, 0xDD, 0x07, 0xF2, 0x19, 0x27, 0x27,
-	0x4E, 0x80, 0x2B, 0xBE, 0x66, 0xD2, 0x60, 0x69, 0x6B, 0x6B, 0x6B, 0xB5,
-	0x5A, 0xAD, 0xFB, 0x05, 0x41, 0xE8, 0x8F, 0x64, 0x39, 0x08, 0x70, 0x15,
-	0xC1, 0xFA, 0xC3, 0x1F, 0xFE, 0x30, 0xE4, 0xFF, 0xA2, 0x28, 0x42, 0x47,
-	0x47, 0x47, 0xD3, 0xBE, 0x7D, 0xFB, 0xB6, 0xAF, 0x5C, 0xB9, 0xF2, 0x51,
-	0xA3, 0xD1, 0xC8, 0x61, 0x96, 0x6B, 0xF8, 0x7E, 0x7B, 0xE4, 0x87, 0x1A,
-	0x09, 0xDC, 0x1E, 0x4B, 0xAB, 0xD5, 0x42, 0x42, 0x42, 0x82, 0x69, 0xD9,
-	0xB2, 0x65, 0xEB, 0x78, 0x9E, 0xAF, 0xED, 0xEE, 0xEE, 0xDE, 0xDB, 0xD7,
-	0xD7, 0x07, 0x76, 0xBB, 0x3D, 0xE4, 0x8B, 0xC1, 0x48, 0xA3, 0x5A, 0xAD,
-	0x06, 0x8D, 0x46, 0x03, 0xF3, 0xE7, 0xCF, 0x87, 0xF9, 0xF3, 0xE7, 0xC3,
-	0x89, 0x13, 0x27, 0xA0, 0xA7, 0xA7, 0xE7, 0x8E, 0xB6, 0xAC, 0x70, 0x30,
-	0x05, 0x02, 0x01, 0x95, 0x42, 0xA1, 0x78, 0x6A, 0xFA, 0xF4, 0xE9, 0x1B,
-	0xA6, 0x4C, 0x99, 0x32, 0x39, 0x3E, 0x3E, 0xDE, 0x08, 0x70, 0xC5, 0xA9,
-	0x1E, 0x9E, 0xC0, 0x77, 0x35, 0x93, 0x1F, 0x67, 0x4E, 0x74, 0x92, 0xE3,
-	0xC0, 0x25, 0x67, 0x41, 0xAF, 0xD7, 0x0B, 0x32, 0x99, 0x0C, 0x38, 0x8E,
-	0x83, 0x33, 0x67, 0xCE, 0x34, 0x7D, 0xF5, 0xD5, 0x57, 0xEF, 0xF5, 0xF6,
-	0xF6, 0x1E, 0xC7, 0x44, 0xCD, 0x91, 0x60, 0x83, 0xFD, 0xBC, 0xAF, 0xB5,
-	0xE4, 0x20, 0x2C, 0x9F, 0xC6, 0xA6, 0xA6, 0xA6, 0x97, 0xDE, 0x7B, 0xEF,
-	0x3D, 0xDB, 0x86, 0x0D, 0x1B, 0x7E, 0x90, 0x96, 0x96, 0x96, 0x88, 0x11,
-	0x50, 0x87, 0xC3, 0x01, 0x31, 0x31, 0x31, 0xDF, 0xD8, 0xD0, 0x62, 0x34,
-	0x84, 0xCF, 0xEC, 0xF8, 0x10, 0x71, 0x1C, 0x07, 0xA5, 0xA5, 0xA5, 0x05,
-	0x6A, 0xB5, 0xFA, 0x7B, 0x27, 0x4E, 0x9C, 0x48, 0x94, 0xCB, 0xE5, 0xAF,
-	0x30, 0x0C, 0x53, 0x7F, 0xA7, 0x8E, 0x25, 0x9C, 0xA0, 0xEE, 0xBB, 0xEF,
-	0x3E, 0x28, 0x2A, 0x2A, 0x82, 0xBD, 0x7B, 0xF7, 0x42, 0x53, 0x53, 0x13,
-	0xF4, 0xF6, 0xF6, 0x82, 0xDB, 0xED, 0x06, 0xAB, 0xD5, 0x0A, 0x3C, 0xCF,
-	0x83, 0xC5, 0x62, 0x01, 0xB5, 0x5A, 0x0D, 0x2E, 0x97, 0x0B, 0x2C, 0x16,
-	0x0B, 0xA4, 0xA7, 0xA7, 0xCF, 0x5E, 0xB6, 0x6C, 0xD9, 0x7D, 0xF1, 0xF1,
-	0xF1, 0x31, 0x81, 0x40, 0x00, 0x5C, 0x2E, 0x57, 0x28, 0xFA, 0x7C, 0x35,
-	0x43, 0x01, 0xAD, 0x2B, 0x74, 0x09, 0x91, 0x8D, 0x19, 0x83, 0xCB, 0x76,
-	0xDF, 0x81, 0x03, 0x07, 0xF6, 0xB4, 0xB7, 0xB7, 0xB7, 0xE2, 0xD2, 0x3E,
-	0x12, 0x46, 0x14, 0xAC, 0xF4, 0xF4, 0xF4, 0x6F, 0xFC, 0xAC, 0xA7, 0xA7,
-	0xA7, 0x73, 0xE7, 0xCE, 0x9D, 0x9F, 0xCF, 0x9C, 0x39, 0x73, 0x85, 0xD1,
-	0x68, 0x4C, 0x02, 0x18, 0xAA, 0x9C, 0xA4, 0x09, 0x78, 0x2D, 0xB0, 0x8B,
-	0x25, 0xBE, 0x7E, 0xE6, 0xCC, 0x99, 0xD3, 0x5D, 0x2E, 0xD7, 0x93, 0x9B,
-	0x37, 0x6F, 0x6E, 0x97, 0xCB, 0xE5, 0xE7, 0xD1, 0x81, 0x8A, 0xA6, 0x27,
-	0xFA, 0x5F, 0x34, 0x1A, 0x0D, 0x24, 0x25, 0x25, 0x41, 0x61, 0x61, 0x21,
-	0xB4, 0xB6, 0xB6, 0x42, 0x67, 0x67, 0x67, 0x44, 0xEF, 0x17, 0xAD, 0x04,
-	0x4B, 0x5A, 0xE2, 0x64, 0x32, 0xD9, 0x77, 0x66, 0xCC, 0x98, 0xF1, 0x9D,
-	0xC4, 0xC4, 0xC4, 0x0C, 0x83, 0xC1, 0x20, 0x03, 0x18, 0x6A, 0x89, 0x8C,
-	0xE6, 0x61, 0x0E, 0xF7, 0x6D, 0xA1, 0x93, 0x1A, 0x97, 0x8F, 0x1E, 0x8F,
-	0x27, 0xB4, 0x8B, 0x72, 0x55, 0x55, 0x55, 0xCB, 0x96, 0x2D, 0x5B, 0x5E,
-	0x9D, 0x31, 0x63, 0xC6, 0xBB, 0xB3, 0x67, 0xCF, 0xEE, 0x24, 0x9D, 0xAD,
-	0xC3, 0x21, 0x49, 0x12, 0x38, 0x9D, 0x4E, 0x78, 0xEF, 0xBD, 0xF7, 0xA0,
-	0xB1, 0xB1, 0xF1, 0xAA, 0xAF, 0x45, 0x71, 0x63, 0x59, 0xB6, 0xAD, 0xB9,
-	0xB9, 0xF9, 0xE5, 0xD7, 0x5F, 0x7F, 0xDD, 0xFA, 0xD8, 0x63, 0x8F, 0xFD,
-	0x24, 0x3B, 0x3B, 0x3B, 0xD3, 0xE7, 0xF3, 0x79, 0xB5, 0x5A, 0xAD, 0x2A,
-	0xFC, 0xF3, 0xA1, 0xB8, 0x62, 0x07, 0xD4, 0x48, 0x3E, 0x2B, 0x69, 0xF9,
-	0xE3, 0x83, 0x26, 0x8A, 0x22, 0xA8, 0xD5, 0x6A, 0x28, 0x2A, 0x2A, 0xCA,
-	0x8C, 0x8D, 0x8D, 0x7D, 0xDA, 0x6C, 0x36, 0x67, 0xBF, 0xFD, 0xF6, 0xDB,
-	0xBF, 0x73, 0x38, 0x1C, 0x3B, 0xEE, 0x54, 0x67, 0x7C, 0x20, 0x10, 0x80,
-	0xF8, 0xF8, 0x78, 0xC8, 0xCB, 0xCB, 0x83, 0x33, 0x67, 0xCE, 0x40, 0x6F,
-	0x6F, 0x2F, 0x38, 0x9D, 0xCE, 0x50, 0x7A, 0x09, 0x8E, 0x0B, 0xCC, 0xEB,
-	0x93, 0xC9, 0x64, 0x79, 0x0B, 0x16, 0x2C, 0x78, 0x7A, 0xDA, 0xB4, 0x69,
-	0x33, 0xF0, 0x18, 0x4A, 0xA5, 0x32, 0xA2, 0x7C, 0x2E, 0xBC, 0xEE, 0xE1,
-	0xCB, 0x7A, 0x9C, 0x10, 0xDC, 0x6E, 0xB7, 0x6D, 0xEF, 0xDE, 0xBD, 0x5F,
-	0x9E, 0x39, 0x73, 0xA6, 0x6B, 0x34, 0x39, 0x78, 0xA3, 0xDA, 0xBE, 0x46,
-	0x14, 0x45, 0xE1, 0xD2, 0xA5, 0x4B, 0xA7, 0xAA, 0xAA, 0xAA, 0x8E, 0x24,
-	0x24, 0x24, 0xAC, 0xE2, 0x38, 0x4E, 0x89, 0xCE, 0x35, 0xD2, 0x8C, 0x8C,
-	0xE4, 0x86, 0xE3, 0x60, 0x0D, 0x46, 0xBB, 0x40, 0xAB, 0xD5, 0xAA, 0x67,
-	0xCF, 0x9E, 0xBD, 0xB6, 0xAD, 0xAD, 0xAD, 0xED, 0xBD, 0xF7, 0xDE, 0xFB,
-	0x25, 0xCF, 0xF3, 0x7E, 0x72, 0x57, 0x60, 0x5C, 0x16, 0x60, 0x54, 0xC8,
-	0xE1, 0x70, 0x00, 0xCF, 0xF3, 0xD7, 0x35, 0xEB, 0x46, 0x03, 0x98, 0x41,
-	0x9E, 0x94, 0x94, 0x34, 0x6D, 0xE5, 0xCA, 0x95, 0x4F, 0x95, 0x97, 0x97,
-	0xDF, 0x93, 0x97, 0x97, 0x97, 0x88, 0x4E, 0x6D, 0x2C, 0x3A, 0xBD, 0xDE,
-	0xBE, 0xDE, 0x18, 0x2D, 0x04, 0x08, 0xD5, 0x8D, 0x86, 0x1E, 0x6C, 0x9F,
-	0xCF, 0x07, 0x1A, 0x8D, 0x06, 0xCE, 0x9D, 0x3B, 0x77, 0xEE, 0xCD, 0x37,
-	0xDF, 0xFC, 0xFD, 0xC0, 0xC0, 0xC0, 0xA6, 0xEF, 0x7E, 0xF7, 0xBB, 0x9D,
-	0x09, 0x09, 0x09, 0x11, 0x1D, 0x5B, 0x10, 0x04, 0xF8, 0xF4, 0xD3, 0x4F,
-	0x43, 0xAD, 0x7D, 0xAE, 0x05, 0xC7, 0x71, 0xC0, 0x71, 0x5C, 0x7F, 0x5D,
-	0x5D, 0xDD, 0x5B, 0xAF, 0xBF, 0xFE, 0xBA, 0x77, 0xFD, 0xFA, 0xF5, 0x7F,
-	0x51, 0x56, 0x56, 0x36, 0x81, 0x61, 0x98, 0x50, 0x14, 0x18, 0x0B, 0xA3,
-	0x47, 0x9B, 0xFC, 0x48, 0x3E, 0x30, 0x0C, 0xC3, 0x80, 0x52, 0xA9, 0x1C,
-	0x52, 0xB2, 0xC2, 0x30, 0x0C, 0x24, 0x24, 0x24, 0x18, 0x57, 0xAF, 0x5E,
-	0x7D, 0x4F, 0x7C, 0x7C, 0x7C, 0xE2, 0x96, 0x2D, 0x5B, 0x72, 0x07, 0x07,
-	0x07, 0xDF, 0x37, 0x99, 0x4C, 0x77, 0x9C, 0x5F, 0x8B, 0x61, 0x2E, 0xD7,
-	0x99, 0x3A, 0x9D, 0x4E, 0xE0, 0x79, 0x3E, 0x24, 0xFE, 0xA4, 0x5B, 0x45,
-	0x92, 0x24, 0xF0, 0x78, 0x3C, 0xE0, 0x74, 0x3A, 0xE5, 0x6B, 0xD7, 0xAE,
-	0x7D, 0x6A, 0xFA, 0xF4, 0xE9, 0x6B, 0xD4, 0x6A, 0xB5, 0x1A, 0x8B, 0xE6,
-	0xC9, 0xB4, 0x95, 0x48, 0xAC, 0x68, 0xF2, 0x75, 0x98, 0xE2, 0xE2, 0xF3,
-	0xF9, 0x84, 0xEA, 0xEA, 0xEA, 0x63, 0x6D, 0x6D, 0x6D, 0xA7, 0x9C, 0x4E,
-	0xE7, 0xA8, 0x12, 0xC3, 0x46, 0x14, 0xAC, 0xDF, 0xFE, 0xF6, 0xB7, 0xDF,
-	0xF8, 0x59, 0x63, 0x63, 0x23, 0x9C, 0x3D, 0x7B, 0xB6, 0xE7, 0xB5, 0xD7,
-	0x5E, 0xDB, 0x54, 0x56, 0x56, 0x36, 0x2D, 0x3D, 0x3D, 0x3D, 0x85, 0xE7,
-	0xF9, 0x50, 0x72, 0x22, 0x3E, 0x40, 0xA3, 0xC9, 0x72, 0xC5, 0x35, 0xB4,
-	0x20, 0x08, 0x60, 0x36, 0x9B, 0x8D, 0xAB, 0x57, 0xAF, 0x7E, 0xD8, 0x6E,
-	0xB7, 0x77, 0x7F, 0xF0, 0xC1, 0x07, 0xBF, 0x75, 0xBB, 0xDD, 0xB7, 0xD5,
-	0x1E, 0x86, 0xDF, 0x26, 0x4E, 0xA7, 0x33, 0x2E, 0x3B, 0x3B, 0x7B, 0x71,
-	0x71, 0x71, 0xF1, 0x23, 0x73, 0xE7, 0xCE, 0x5D, 0x6E, 0x36, 0x9B, 0x65,
-	0x18, 0xA6, 0xC7, 0xE5, 0x1B, 0x2E, 0xBD, 0xC9, 0xAA, 0x82, 0x48, 0x73,
-	0xD2, 0x30, 0x72, 0x86, 0x7F, 0x8B, 0xCB, 0x44, 0x95, 0x4A, 0x05, 0x26,
-	0x93, 0x09, 0x2A, 0x2A, 0x2A, 0xEA, 0xDE, 0x7D, 0xF7, 0xDD, 0xFF, 0xA8,
-	0xAE, 0xAE, 0xFE, 0x24, 0x3B, 0x3B, 0x7B, 0x70, 0x34, 0x49, 0xBD, 0x36,
-	0x9B, 0x6D, 0x54, 0xA5, 0x56, 0x28, 0x96, 0x3A, 0x9D, 0xCE, 0x75, 0xE2,
-	0xC4, 0x89, 0xB7, 0x9D, 0x4E, 0xA7, 0x5B, 0x10, 0x84, 0xBF, 0x2A, 0x2B,
-	0x2B, 0x2B, 0xC7, 0xFC, 0x31, 0x2C, 0xE9, 0x51, 0x28, 0x14, 0xA3, 0xEA,
-	0x61, 0x8E, 0xBE, 0x94, 0x70, 0x4B, 0x12, 0xC3, 0xFD, 0x7E, 0xBF, 0x1F,
-	0x93, 0x4C, 0x61, 0xF6, 0xEC, 0xD9, 0xD3, 0x62, 0x63, 0x63, 0x93, 0x6A,
-	0x6B, 0x6B, 0x53, 0x7B, 0x7A, 0x7A, 0x3E, 0x70, 0xB9, 0x5C, 0xD5, 0x77,
-	0x4B, 0xD1, 0x3C, 0xC0, 0x95, 0x5D, 0x8E, 0x4C, 0x26, 0x13, 0xDC, 0x7B,
-	0xEF, 0xBD, 0xDF, 0x5B, 0xBD, 0x7A, 0xF5, 0x23, 0x31, 0x31, 0x31, 0x26,
-	0xF4, 0x53, 0xE3, 0xF3, 0x1A, 0xA9, 0x51, 0x42, 0xA6, 0xBF, 0x60, 0x60,
-	0x47, 0xA1, 0x50, 0x40, 0x47, 0x47, 0x47, 0xCF, 0xBB, 0xEF, 0xBE, 0xFB,
-	0x4E, 0x77, 0x77, 0x77, 0x37, 0xCB, 0xB2, 0xA3, 0xCA, 0x0D, 0x1B, 0x51,
-	0xB0, 0xF6, 0xEF, 0xDF, 0xFF, 0x8D, 0x9F, 0xC9, 0x64, 0x32, 0x98, 0x3E,
-	0x7D, 0xBA, 0x4F, 0xAB, 0xD5, 0xEE, 0x6D, 0x6F, 0x6F, 0x3F, 0x19, 0x1F,
-	0x1F, 0x1F, 0x2F, 0x93, 0xC9, 0x14, 0x64, 0xD2, 0x1F, 0x2E, 0x19, 0xAE,
-	0x35, 0xEB, 0x93, 0x65, 0x3B, 0x18, 0xE5, 0x71, 0x38, 0x1C, 0xDE, 0x94,
-	0x94, 0x94, 0xAC, 0x17, 0x5E, 0x78, 0xE1, 0x1F, 0xBB, 0xBA, 0xBA, 0xDA,
-	0x8E, 0x1E, 0x3D, 0xBA, 0xCB, 0xEB, 0xF5, 0xDA, 0xEF, 0x86, 0x56, 0x21,
-	0xB8, 0x1C, 0x73, 0xBB, 0xDD, 0xE0, 0xF5, 0x7A, 0xB3, 0x92, 0x93, 0x93,
-	0x1F, 0x9D, 0x31, 0x63, 0xC6, 0xD3, 0x05, 0x05, 0x05, 0x99, 0x76, 0xBB,
-	0x3D, 0x80, 0x49, 0x92, 0xB8, 0x54, 0x26, 0xFD, 0x54, 0xA4, 0xD3, 0x74,
-	0x34, 0x0F, 0x57, 0x78, 0x74, 0x07, 0x7D, 0x09, 0x17, 0x2E, 0x5C, 0xA8,
-	0x79, 0xEB, 0xAD, 0xB7, 0x7E, 0x7D, 0xF0, 0xE0, 0xC1, 0xB7, 0xE3, 0xE2,
-	0xE2, 0xAE, 0xBB, 0xA4, 0xE3, 0x7A, 0x30, 0x1A, 0x8D, 0xFE, 0xCA, 0xCA,
-	0xCA, 0xF7, 0xFB, 0xFA, 0xFA, 0xFA, 0x1F, 0x7A, 0xE8, 0xA1, 0x1F, 0x4D,
-	0x9D, 0x3A, 0x75, 0x71, 0x7C, 0x7C, 0xBC, 0xDC, 0xE3, 0xF1, 0x00, 0xCF,
-	0xF3, 0x21, 0x7F, 0x48, 0xA4, 0xBD, 0xB5, 0x00, 0xAE, 0xD4, 0xC1, 0xE1,
-	0xD8, 0x44, 0xDF, 0x1C, 0x82, 0xB5, 0x76, 0x3E, 0x9F, 0x0F, 0x0A, 0x0B,
-	0x0B, 0xD3, 0x53, 0x52, 0x52, 0x7E, 0xBA, 0x7F, 0xFF, 0xFE, 0xA2, 0xBC,
-	0xBC, 0xBC, 0xDF, 0xD4, 0xD6, 0xD6, 0x56, 0xF1, 0x3C, 0x7F, 0xC7, 0x27,
-	0x9A, 0xA2, 0xF5, 0xA5, 0xD5, 0x6A, 0x75, 0x93, 0x27, 0x4F, 0x5E, 0xF4,
-	0x17, 0x7F, 0xF1, 0x17, 0xFF, 0xC8, 0xB2, 0xAC, 0xD9, 0xE9, 0x74, 0x7A,
-	0xF4, 0x7A, 0xBD, 0x1A, 0x0B, 0xCC, 0xC9, 0x9E, 0x57, 0x57, 0x03, 0x35,
-	0x01, 0xE0, 0xCA, 0x0E, 0x4A, 0xC1, 0xC9, 0x47, 0xA8, 0xA9, 0xA9, 0x39,
-	0xB9, 0x6F, 0xDF, 0xBE, 0x1D, 0x76, 0xBB, 0x9D, 0x1F, 0x6D, 0x7B, 0xE7,
-	0x11, 0x05, 0xEB, 0x9D, 0x77, 0xDE, 0x19, 0xF6, 0x43, 0x05, 0x33, 0x8C,
-	0xFB, 0xDE, 0x7F, 0xFF, 0xFD, 0x4D, 0x32, 0x99, 0x2C, 0xBF, 0xBC, 0xBC,
-	0xBC, 0x08, 0x4D, 0x7F, 0x9C, 0xB9, 0x00, 0x22, 0x4B, 0x4E, 0x43, 0xA5,
-	0x46, 0xB3, 0x54, 0xA5, 0x52, 0x69, 0xE4, 0x72, 0x39, 0x18, 0x8D, 0x46,
-	0xF3, 0xF7, 0xBF, 0xFF, 0xFD, 0x7F, 0x93, 0x24, 0xE9, 0xFF, 0x9D, 0x38,
-	0x71, 0x62, 0x93, 0x24, 0x49, 0xAE, 0xDB, 0x61, 0xF3, 0xD5, 0x9B, 0x49,
-	0xD0, 0x82, 0x51, 0x25, 0x26, 0x26, 0x4E, 0x8C, 0x89, 0x89, 0xF9, 0xDE,
-	0xAC, 0x59, 0xB3, 0xEE, 0x8D, 0x8B, 0x8B, 0x33, 0x04, 0x02, 0x01, 0x50,
-	0xAB, 0xD5, 0x32, 0x2C, 0x18, 0x0E, 0xF7, 0x0B, 0x90, 0x79, 0x30, 0xA3,
-	0xB1, 0x6E, 0x65, 0x32, 0x19, 0x5A, 0x19, 0x92, 0x42, 0xA1, 0x60, 0x82,
-	0xFF, 0xF7, 0x57, 0x54, 0x54, 0x1C, 0xF9, 0x9F, 0xFF, 0xF9, 0x9F, 0x5F,
-	0x56, 0x54, 0x54, 0xEC, 0x4E, 0x48, 0x48, 0xB8, 0x25, 0xD6, 0x85, 0x4E,
-	0xA7, 0x83, 0xD3, 0xA7, 0x4F, 0xEF, 0x78, 0xF9, 0xE5, 0x97, 0x7B, 0x8C,
-	0x46, 0xE3, 0xDF, 0x29, 0x14, 0x8A, 0xE5, 0x7A, 0xBD, 0x5E, 0x87, 0x9B,
-	0xBB, 0x0A, 0x82, 0x10, 0xD1, 0x43, 0x43, 0xF6, 0x84, 0x47, 0xF7, 0x03,
-	0xC0, 0xD0, 0x2C, 0x7C, 0x5C, 0x15, 0x60, 0x1E, 0x57, 0xB0, 0xEB, 0x83,
-	0x7C, 0xD9, 0xB2, 0x65, 0xEB, 0x32, 0x32, 0x32, 0xF2, 0xDE, 0x78, 0xE3,
-	0x8D, 0xFF, 0x65, 0x18, 0xE6, 0x33, 0x8F, 0xC7, 0xD3, 0x71, 0x27, 0xF7,
-	0x53, 0xF3, 0xF9, 0x7C, 0x20, 0x8A, 0xA2, 0xAC, 0xB4, 0xB4, 0xF4, 0x9E,
-	0x75, 0xEB, 0xD6, 0xFD, 0x83, 0x4A, 0xA5, 0x32, 0x03, 0x00, 0x30, 0x0C,
-	0xA3, 0xC6, 0xE8, 0xE0, 0xB5, 0x1C, 0xED, 0x24, 0xF8, 0x3A, 0x5C, 0xCA,
-	0x4B, 0xC1, 0x6E, 0x1C, 0xE7, 0xCE, 0x9D, 0x6B, 0xFA, 0xF2, 0xCB, 0x2F,
-	0x3F, 0x0C, 0x04, 0x02, 0xD6, 0x48, 0xFD, 0x90, 0x24, 0x23, 0xAA, 0xC0,
-	0xD5, 0x7C, 0x0F, 0x0C, 0xC3, 0x88, 0x3B, 0x77, 0xEE, 0xFC, 0x6A, 0x60,
-	0x60, 0x60, 0xE1, 0x84, 0x09, 0x13, 0x8A, 0xF0, 0xA4, 0x00, 0x22, 0xDF,
-	0x48, 0x11, 0xC5, 0xCF, 0xEF, 0xF7, 0x87, 0x2A, 0xF5, 0xD5, 0x6A, 0x35,
-	0x60, 0xCA, 0x7F, 0x7E, 0x7E, 0x7E, 0xEE, 0xC3, 0x0F, 0x3F, 0xFC, 0x7D,
-	0x41, 0x10, 0x02, 0x15, 0x15, 0x15, 0x1F, 0x89, 0xA2, 0x38, 0xEA, 0xCD,
-	0x30, 0xA2, 0x85, 0x60, 0x0A, 0x81, 0x25, 0x2D, 0x2D, 0xED, 0xDE, 0x95,
-	0x2B, 0x57, 0x3E, 0x5E, 0x56, 0x56, 0x36, 0xCD, 0x64, 0x32, 0x29, 0xC9,
-	0x9A, 0x48, 0xB2, 0x7D, 0x4B, 0xF8, 0x17, 0x5E, 0xCB, 0xD1, 0xDC, 0x7C,
-	0x51, 0x14, 0x41, 0xA9, 0x54, 0x82, 0xD3, 0xE9, 0x94, 0x44, 0x51, 0x64,
-	0x18, 0x86, 0xF1, 0xED, 0xD9, 0xB3, 0xE7, 0xAB, 0xB7, 0xDF, 0x7E, 0xFB,
-	0x57, 0xD5, 0xD5, 0xD5, 0x27, 0x6F, 0xB4, 0x20, 0xFD, 0x46, 0x20, 0xD2,
-	0x2A, 0xAA, 0xAD, 0x56, 0xEB, 0x5F, 0x1D, 0x3C, 0x78, 0xB0, 0xBD, 0xB4,
-	0xB4, 0xF4, 0xD1, 0x8C, 0x8C, 0x0C, 0x8B, 0x42, 0xA1, 0x18, 0x95, 0x30,
-	0x93, 0x82, 0x4E, 0x3A, 0xDC, 0xD1, 0x22, 0x25, 0xAD, 0x53, 0x72, 0x3B,
-	0x32, 0x99, 0x4C, 0x06, 0xC5, 0xC5, 0xC5, 0xE3, 0x7F, 0xF6, 0xB3, 0x9F,
-	0xFD, 0x72, 0xF7, 0xEE, 0xDD, 0xD3, 0x9A, 0x9A, 0x9A, 0x5E, 0x56, 0x28,
-	0x14, 0xC7, 0xC5, 0x3B, 0x30, 0x8C, 0x18, 0xB4, 0x86, 0xD8, 0x89, 0x13,
-	0x27, 0x2E, 0x79, 0xE8, 0xA1, 0x87, 0x7E, 0x50, 0x50, 0x50, 0x90, 0xE7,
-	0x74, 0x3A, 0x41, 0xA9, 0x54, 0x02, 0xC7, 0x71, 0xA1, 0x2E, 0x1F, 0x58,
-	0xA8, 0x3E, 0x9A, 0xE7, 0x1B, 0x2D, 0xF7, 0x40, 0x20, 0x00, 0x6E, 0xB7,
-	0x1B, 0xF6, 0xEF, 0xDF, 0x7F, 0x78, 0xE7, 0xCE, 0x9D, 0x5B, 0x18, 0x86,
-	0x91, 0x46, 0x93, 0x28, 0x8E, 0x5C, 0x97, 0xD9, 0xC2, 0xF3, 0x3C, 0x38,
-	0x1C, 0x0E, 0xEB, 0xDE, 0xBD, 0x7B, 0x3F, 0x5F, 0xB8, 0x70, 0xE1, 0xA4,
-	0xC9, 0x93, 0x27, 0x4F, 0xC2, 0xED, 0x98, 0x22, 0x1D, 0x4C, 0x64, 0xD3,
-	0x31, 0xB5, 0x5A, 0x3D, 0x64, 0xA0, 0xF8, 0x7C, 0x3E, 0xE0, 0x79, 0x1E,
-	0x26, 0x4F, 0x9E, 0x3C, 0x49, 0xA9, 0x54, 0xFE, 0xE4, 0x8D, 0x37, 0xDE,
-	0x50, 0x55, 0x54, 0x54, 0xFC, 0x59, 0xAB, 0xD5, 0xDE, 0x91, 0xA2, 0xE5,
-	0xF1, 0x78, 0xC6, 0xA5, 0xA7, 0xA7, 0x3F, 0xBF, 0x66, 0xCD, 0x9A, 0x95,
-	0x45, 0x45, 0x45, 0x39, 0x38, 0xE3, 0x93, 0x41, 0x0C, 0xF2, 0x9A, 0x86,
-	0x27, 0xFA, 0xA1, 0x90, 0xA1, 0x23, 0x39, 0x12, 0x1F, 0x0F, 0xE6, 0x5C,
-	0xE9, 0x74, 0x3A, 0xB6, 0xB7, 0xB7, 0xD7, 0xBE, 0x75, 0xEB, 0xD6, 0x4D,
-	0x5F, 0x7D, 0xF5, 0xD5, 0xFF, 0xD6, 0xD7, 0xD7, 0x57, 0x85, 0x2F, 0x99,
-	0xBE, 0x6D, 0x30, 0x59, 0xD5, 0xE5, 0x72, 0xC1, 0xD6, 0xAD, 0x5B, 0xDB,
-	0x44, 0x51, 0xFC, 0x8F, 0xBA, 0xBA, 0xBA, 0xCE, 0x95, 0x2B, 0x57, 0x3E,
-	0x59, 0x52, 0x52, 0x52, 0x18, 0xA9, 0x58, 0xA1, 0xFF, 0x0B, 0xAD, 0x53,
-	0x4C, 0xB7, 0x08, 0x17, 0x78, 0x74, 0x4F, 0xE0, 0x72, 0x11, 0xFF, 0x46,
-	0xA9, 0x54, 0x42, 0x7C, 0x7C, 0x7C, 0xFC, 0xD2, 0xA5, 0x4B, 0x1F, 0x48,
-	0x4E, 0x4E, 0x2E, 0xFA, 0xE2, 0x8B, 0x2F, 0xDE, 0xBD, 0x70, 0xE1, 0xC2,
-	0x7B, 0x81, 0x40, 0xA0, 0xE7, 0x66, 0x7E, 0xFE, 0x6F, 0x93, 0xA0, 0xEF,
-	0x32, 0x6E, 0xF1, 0xE2, 0xC5, 0x0F, 0x3E, 0xF2, 0xC8, 0x23, 0x4F, 0x17,
-	0x15, 0x15, 0x95, 0xFA, 0x7C, 0xBE, 0x6F, 0x14, 0x97, 0xE3, 0xFF, 0x71,
-	0xDC, 0x5C, 0x6B, 0x32, 0xC3, 0xDF, 0x63, 0x7F, 0x7E, 0x85, 0x42, 0x01,
-	0xD5, 0xD5, 0xD5, 0xD5, 0xFB, 0xF7, 0xEF, 0xFF, 0xD2, 0xED, 0x76, 0x5B,
-	0x71, 0x42, 0x1C, 0x75, 0xB1, 0xF4, 0xF5, 0x7C, 0x48, 0x8D, 0x46, 0x03,
-	0x4A, 0xA5, 0x12, 0xBA, 0xBA, 0xBA, 0xF6, 0x5F, 0xBA, 0x74, 0xE9, 0xCB,
-	0xA2, 0xA2, 0xA2, 0x12, 0x85, 0x42, 0xA1, 0x08, 0xCF, 0x6C, 0x25, 0xFF,
-	0x4F, 0x26, 0x2C, 0xE2, 0xEF, 0x71, 0x80, 0x84, 0x6D, 0xB8, 0x0A, 0x6A,
-	0xB5, 0x1A, 0x24, 0x49, 0x02, 0x8E, 0xE3, 0x98, 0x49, 0x93, 0x26, 0x15,
-	0xCB, 0xE5, 0xF2, 0xBF, 0xDA, 0xBC, 0x79, 0xB3, 0xFE, 0xF0, 0xE1, 0xC3,
-	0x7F, 0x52, 0xAB, 0xD5, 0xDD, 0x77, 0x8A, 0x3F, 0xC1, 0xE3, 0xF1, 0x24,
-	0xBA, 0x5C, 0xAE, 0x25, 0x29, 0x29, 0x29, 0xEB, 0xF3, 0xF3, 0xF3, 0x17,
-	0xA5, 0xA4, 0xA4, 0x84, 0xF6, 0x3E, 0x23, 0x45, 0x09, 0x93, 0x27, 0xC3,
-	0x85, 0x0B, 0x5F, 0x87, 0xE0, 0x00, 0x40, 0x8B, 0x82, 0x7C, 0x10, 0xC9,
-	0x01, 0x86, 0x03, 0x52, 0x26, 0x93, 0xC1, 0xC5, 0x8B, 0x17, 0xFB, 0x0F,
-	0x1E, 0x3C, 0xF8, 0xE6, 0xB9, 0x73, 0xE7, 0x5E, 0xEE, 0xE8, 0xE8, 0x68,
-	0xC4, 0xE8, 0xED, 0xAD, 0x4E, 0xC6, 0x95, 0xC9, 0x64, 0xE0, 0xF5, 0x7A,
-	0xA1, 0xB5, 0xB5, 0x15, 0x94, 0x4A, 0x65, 0x9B, 0x5C, 0x2E, 0x7F, 0x75,
-	0xEB, 0xD6, 0xAD, 0xDD, 0x76, 0xBB, 0xFD, 0xF9, 0x99, 0x33, 0x67, 0x4E,
-	0x23, 0x73, 0x7C, 0x48, 0xD1, 0x06, 0xB8, 0x32, 0xD6, 0x70, 0xB9, 0x47,
-	0xFE, 0x2C, 0xFC, 0x7B, 0xF2, 0x67, 0xE4, 0xF5, 0x26, 0xAF, 0x6B, 0x4C,
-	0x4C, 0x8C, 0x6A, 0xEE, 0xDC, 0xB9, 0xE5, 0xC9, 0xC9, 0xC9, 0x49, 0x47,
-	0x8F, 0x1E, 0x2D, 0x1D, 0x1C, 0x1C, 0x7C, 0xCF, 0xE7, 0xF3, 0xED, 0xBC,
-	0x69, 0x1F, 0xFE, 0x5B, 0x00, 0x33, 0xD6, 0x3D, 0x1E, 0x4F, 0xF2, 0x8C,
-	0x19, 0x33, 0x1E, 0x7F, 0xE8, 0xA1, 0x87, 0x9E, 0x2D, 0x2E, 0x2E, 0xCE,
-	0xC6, 0xDF, 0x87, 0xB7, 0xD1, 0x0E, 0x6F, 0x8D, 0x4E, 0x3A, 0xE0, 0x87,
-	0x2B, 0x84, 0xC7, 0xFB, 0x81, 0x81, 0x12, 0x97, 0xCB, 0xE5, 0x69, 0x6B,
-	0x6B, 0xFB, 0xD4, 0x6E, 0xB7, 0xEF, 0x45, 0x4B, 0xF7, 0x7A, 0x36, 0x84,
-	0x19, 0x51, 0xB0, 0x36, 0x6F, 0xDE, 0x3C, 0xE2, 0x1F, 0xA1, 0x05, 0xA4,
-	0x52, 0xA9, 0x6C, 0xBB, 0x77, 0xEF, 0xDE, 0xAC, 0x54, 0x2A, 0xA7, 0xAE,
-	0x58, 0xB1, 0x62, 0x05, 0x86, 0x44, 0xD1, 0x74, 0x04, 0xB8, 0x62, 0x92,
-	0x87, 0xAB, 0xF2, 0x48, 0xD1, 0x2C, 0x8C, 0xE4, 0x90, 0x1F, 0xBE, 0xB4,
-	0xB4, 0xB4, 0x40, 0xAF, 0xD7, 0xFF, 0xA5, 0x46, 0xA3, 0x31, 0x1D, 0x3F,
-	0x7E, 0xFC, 0xF7, 0x1E, 0x8F, 0xA7, 0x3D, 0x1A, 0x45, 0x0B, 0x53, 0x12,
-	0x06, 0x06, 0x06, 0xC0, 0xE7, 0xF3, 0x4D, 0x9F, 0x3F, 0x7F, 0xFE, 0x83,
-	0x69, 0x69, 0x69, 0x2B, 0xB3, 0xB2, 0xB2, 0xF2, 0xC2, 0x03, 0x0B, 0xE1,
-	0x9F, 0xEF, 0x5A, 0x33, 0x1A, 0xE9, 0x8B, 0x21, 0x8B, 0x50, 0x71, 0x86,
-	0xC3, 0x9C, 0x37, 0x9C, 0x21, 0xE5, 0x72, 0x39, 0xD4, 0xD4, 0xD4, 0xD4,
-	0xED, 0xDC, 0xB9, 0xF3, 0xCF, 0x36, 0x9B, 0xED, 0x1D, 0x8D, 0x46, 0x73,
-	0x51, 0xA3, 0xD1, 0x80, 0xCB, 0xE5, 0xBA, 0x2D, 0x76, 0x16, 0x42, 0x41,
-	0x52, 0xA9, 0x54, 0xC0, 0x71, 0x1C, 0xE8, 0xF5, 0xFA, 0xFE, 0xB6, 0xB6,
-	0xB6, 0xF7, 0xDE, 0x7F, 0xFF, 0xFD, 0xDE, 0xC1, 0xC1, 0xC1, 0xEF, 0x2F,
-	0x5E, 0xBC, 0x78, 0xB9, 0x52, 0xA9, 0x64, 0xC9, 0xD7, 0x63, 0xE0, 0x02,
-	0x1F, 0x12, 0x14, 0x9E, 0x48, 0x82, 0x36, 0xE1, 0xC2, 0x3F, 0x1C, 0xB9,
-	0xB9, 0xB9, 0x69, 0x71, 0x71, 0x71, 0x4F, 0xD7, 0xD7, 0xD7, 0xE7, 0xF0,
-	0x3C, 0x9F, 0x69, 0xB3, 0xD9, 0xF6, 0x6A, 0x34, 0x9A, 0xC6, 0x68, 0x1B,
-	0x8B, 0x0C, 0xC3, 0xA0, 0xEB, 0xA5, 0x70, 0xD1, 0xA2, 0x45, 0x4F, 0x2F,
-	0x5B, 0xB6, 0xEC, 0x81, 0xBC, 0xBC, 0xBC, 0x74, 0x9C, 0xE8, 0xAE, 0xE6,
-	0x0E, 0x1A, 0x69, 0x47, 0x1E, 0x32, 0x53, 0x1E, 0xFF, 0x1F, 0x6C, 0xF8,
-	0x07, 0x1C, 0xC7, 0xC1, 0xCE, 0x9D, 0x3B, 0x77, 0xED, 0xDC, 0xB9, 0xF3,
-	0x03, 0x51, 0x14, 0x07, 0x70, 0x0F, 0xC9, 0xEB, 0xB9, 0x6E, 0x23, 0x0A,
-	0xD6, 0x7F, 0xFE, 0xE7, 0x7F, 0x8E, 0xF8, 0x47, 0x0C, 0x73, 0x65, 0x17,
-	0xE0, 0x83, 0x07, 0x0F, 0x9E, 0x0E, 0x04, 0x02, 0x7F, 0x2C, 0x29, 0x29,
-	0x99, 0x90, 0x9A, 0x9A, 0x9A, 0x8C, 0xA1, 0x75, 0xB2, 0x37, 0x37, 0x7E,
-	0x00, 0x32, 0x35, 0x3F, 0xD2, 0xE2, 0x48, 0x8C, 0x30, 0x64, 0x65, 0x65,
-	0xA5, 0x3E, 0xFE, 0xF8, 0xE3, 0x2F, 0x68, 0x34, 0x1A, 0xB5, 0x4A, 0xA5,
-	0xFA, 0xD4, 0xE7, 0xF3, 0x1D, 0x01, 0x80, 0xA8, 0xF1, 0x82, 0x62, 0xB3,
-	0x3D, 0x83, 0xC1, 0x90, 0x33, 0x7F, 0xFE, 0xFC, 0x99, 0x25, 0x25, 0x25,
-	0x0F, 0x2F, 0x5E, 0xBC, 0x78, 0x29, 0xC7, 0x71, 0xEC, 0x58, 0x5A, 0x33,
-	0xE4, 0x35, 0x0E, 0xEF, 0x65, 0x8F, 0x83, 0x4A, 0x2E, 0x97, 0x43, 0x55,
-	0x55, 0x55, 0xE5, 0x9B, 0x6F, 0xBE, 0xF9, 0x52, 0x6F, 0x6F, 0xEF, 0x87,
-	0x13, 0x27, 0x4E, 0x74, 0xE2, 0x26, 0xA5, 0xB7, 0x2B, 0x92, 0x24, 0x81,
-	0xD1, 0x68, 0xE4, 0x6B, 0x6A, 0x6A, 0xB6, 0xBC, 0xF1, 0xC6, 0x1B, 0xBD,
-	0x82, 0x20, 0x78, 0xA7, 0x4C, 0x99, 0xB2, 0x3C, 0x35, 0x35, 0x55, 0x83,
-	0x65, 0x45, 0xE4, 0x24, 0x19, 0x69, 0x47, 0x8A, 0x48, 0xC1, 0xD4, 0x0A,
-	0xAD, 0x56, 0x0B, 0xD3, 0xA6, 0x4D, 0x9B, 0xD7, 0xDC, 0xDC, 0x3C, 0x6E,
-	0xF2, 0xE4, 0xC9, 0x9F, 0x01, 0xC0, 0xC7, 0xA7, 0x4E, 0x9D, 0x3A, 0xE1,
-	0xF1, 0x78, 0xFA, 0xC6, 0xE4, 0x8D, 0x6E, 0x32, 0xC1, 0x68, 0x20, 0x23,
-	0x97, 0xCB, 0x67, 0xCF, 0x98, 0x31, 0xE3, 0xA9, 0x55, 0xAB, 0x56, 0xDD,
-	0x17, 0x13, 0x13, 0x63, 0x40, 0x77, 0x42, 0x24, 0xCF, 0x24, 0x4E, 0x88,
-	0x68, 0xBD, 0x92, 0xFE, 0x54, 0xAC, 0x74, 0xC1, 0xA4, 0x66, 0xB5, 0x5A,
-	0x0D, 0x2D, 0x2D, 0x2D, 0xED, 0x5F, 0x7E, 0xF9, 0xE5, 0xEB, 0x47, 0x8F,
-	0x1E, 0xAD, 0x33, 0x9B, 0xCD, 0x60, 0xB1, 0x58, 0x42, 0x7F, 0x37, 0x5A,
-	0x46, 0x14, 0x2C, 0xB5, 0x5A, 0x3D, 0xE2, 0x1F, 0x91, 0x03, 0x41, 0xAF,
-	0xD7, 0x43, 0x67, 0x67, 0xE7, 0xC1, 0x1D, 0x3B, 0x76, 0xFC, 0x7E, 0xC3,
-	0x86, 0x0D, 0x3F, 0x55, 0xA9, 0x54, 0x7A, 0x72, 0x29, 0x88, 0x3E, 0x18,
-	0xD2, 0x57, 0x49, 0x3A, 0x42, 0xAF, 0x05, 0xB6, 0x49, 0x71, 0xB9, 0x5C,
-	0x10, 0x1B, 0x1B, 0x6B, 0x7A, 0xEE, 0xB9, 0xE7, 0x7E, 0x54, 0x57, 0x57,
-	0xB7, 0x2C, 0x10, 0x08, 0xFC, 0xB3, 0x20, 0x08, 0x7B, 0x04, 0x41, 0xB8,
-	0xED, 0x53, 0xDD, 0x83, 0x62, 0x60, 0xD4, 0x6A, 0xB5, 0x93, 0x16, 0x2E,
-	0x5C, 0xF8, 0xF4, 0x8A, 0x15, 0x2B, 0xD6, 0x98, 0xCD, 0x66, 0x63, 0xD0,
-	0x17, 0x18, 0xCA, 0x1E, 0x1E, 0x0B, 0xD0, 0x72, 0x25, 0xAF, 0x31, 0xB9,
-	0x89, 0xAC, 0xD3, 0xE9, 0x0C, 0x54, 0x56, 0x56, 0x1E, 0x7D, 0xED, 0xB5,
-	0xD7, 0x7E, 0xD3, 0xDA, 0xDA, 0xBA, 0x25, 0x37, 0x37, 0xF7, 0xF6, 0x56,
-	0x2A, 0x02, 0x49, 0xBA, 0xBC, 0x1B, 0x52, 0x73, 0x73, 0xF3, 0xF1, 0xDF,
-	0xFF, 0xFE, 0xF7, 0x7F, 0xF7, 0xFD, 0xEF, 0x7F, 0xBF, 0x47, 0x26, 0x93,
-	0xDD, 0xA7, 0xD3, 0xE9, 0xE2, 0xB0, 0x43, 0x85, 0x42, 0xA1, 0x00, 0x95,
-	0x4A, 0x15, 0x12, 0xEB, 0xB1, 0xBA, 0xAE, 0xF8, 0x00, 0x02, 0x5C, 0x1E,
-	0xBF, 0x59, 0x59, 0x59, 0x71, 0xCF, 0x3E, 0xFB, 0xEC, 0x77, 0x1A, 0x1B,
-	0x1B, 0x17, 0xB4, 0xB7, 0xB7, 0xBF, 0x93, 0x92, 0x92, 0xF2, 0xA1, 0x20,
-	0x08, 0x8D, 0xA2, 0x28, 0x7A, 0xC7, 0xE4, 0x0D, 0x6F, 0x02, 0xC1, 0xBD,
-	0x0B, 0x13, 0x59, 0x96, 0x9D, 0x3D, 0x7E, 0xFC, 0xF8, 0xBF, 0x9E, 0x36,
-	0x6D, 0xDA, 0x34, 0x95, 0x4A, 0x15, 0x71, 0x1F, 0x32, 0x64, 0xB8, 0xD7,
-	0xE3, 0xFF, 0x31, 0xAF, 0x12, 0xE0, 0xF2, 0xB2, 0xD2, 0xE9, 0x74, 0xBA,
-	0xB7, 0x6E, 0xDD, 0xFA, 0xF2, 0xA5, 0x4B, 0x97, 0x0E, 0x62, 0x1F, 0xB6,
-	0x1B, 0x89, 0x5B, 0x5C, 0x97, 0x0F, 0x8B, 0x14, 0xA4, 0xE0, 0xBF, 0xBD,
-	0x6D, 0x6D, 0x6D, 0xEF, 0xEC, 0xD9, 0xB3, 0xA7, 0x74, 0xE1, 0xC2, 0x85,
-	0xF7, 0xEA, 0x74, 0x3A, 0x05, 0x2A, 0x76, 0x78, 0xCE, 0x10, 0x32, 0x9A,
-	0xA4, 0x42, 0x8C, 0x52, 0xE0, 0xDE, 0x88, 0x79, 0x79, 0x79, 0xC5, 0x0A,
-	0x85, 0xE2, 0x77, 0x72, 0xB9, 0xFC, 0x2B, 0xB5, 0x5A, 0xFD, 0x7B, 0x51,
-	0x14, 0x8F, 0xF9, 0xFD, 0x7E, 0x9E, 0xBC, 0x58, 0xB7, 0x1A, 0x5C, 0x8E,
-	0x89, 0xA2, 0xC8, 0x69, 0xB5, 0xDA, 0xFC, 0xB8, 0xB8, 0xB8, 0x75, 0x6B,
-	0xD7, 0xAE, 0xDD, 0x98, 0x9D, 0x9D, 0x5D, 0xA8, 0x56, 0xAB, 0x15, 0x3E,
-	0x9F, 0x0F, 0x93, 0x25, 0xC7, 0x3C, 0x1A, 0x47, 0xB6, 0x93, 0x41, 0xF3,
-	0x3F, 0x98, 0x70, 0xCA, 0x57, 0x56, 0x56, 0x6E, 0x7F, 0xE9, 0xA5, 0x97,
-	0xFE, 0x6F, 0x7F, 0x7F, 0x7F, 0x55, 0x5C, 0x5C, 0x9C, 0x3F, 0x1A, 0x97,
-	0x33, 0x00, 0x00, 0xA2, 0x28, 0x9E, 0x0D, 0x04, 0x02, 0x3F, 0x3B, 0x79,
-	0xF2, 0x64, 0x73, 0x46, 0x46, 0xC6, 0xF3, 0xE3, 0xC6, 0x8D, 0xCB, 0xC2,
-	0x19, 0x1F, 0xC3, 0xF0, 0x63, 0x79, 0x5D, 0x83, 0x4D, 0x08, 0x43, 0xDB,
-	0xC6, 0x01, 0x5C, 0x16, 0x80, 0x8C, 0x8C, 0x8C, 0x9C, 0x17, 0x5F, 0x7C,
-	0xF1, 0xAF, 0x8F, 0x1E, 0x3D, 0x3A, 0xBF, 0xA1, 0xA1, 0xE1, 0x6D, 0xBF,
-	0xDF, 0xFF, 0x71, 0x20, 0x10, 0x70, 0x48, 0x92, 0x74, 0xEB, 0xD7, 0xD5,
-	0x30, 0x64, 0x1C, 0x2A, 0x34, 0x1A, 0xCD, 0x64, 0x96, 0x65, 0x5F, 0x48,
-	0x4D, 0x4D, 0x5D, 0x9D, 0x98, 0x98, 0x68, 0x02, 0xB8, 0xB2, 0xD9, 0x30,
-	0x56, 0x01, 0x44, 0x02, 0x99, 0x70, 0x8C, 0xE2, 0x83, 0x82, 0x85, 0x56,
-	0x3C, 0xC7, 0x71, 0xE0, 0xF1, 0x78, 0xE0, 0xE4, 0xC9, 0x93, 0x87, 0x7B,
-	0x7A, 0x7A, 0xDE, 0x63, 0x18, 0xA6, 0x77, 0x2C, 0xC6, 0xDA, 0x88, 0x82,
-	0xD5, 0xD7, 0x17, 0x99, 0x85, 0x2B, 0x49, 0x97, 0x37, 0xD6, 0xBC, 0x74,
-	0xE9, 0x52, 0xCB, 0x91, 0x23, 0x47, 0x7E, 0x93, 0x98, 0x98, 0x98, 0x5B,
-	0x5E, 0x5E, 0x5E, 0x86, 0x66, 0x21, 0xD9, 0x07, 0x0B, 0x5F, 0x3F, 0x1A,
-	0x53, 0xDD, 0xE3, 0xF1, 0x80, 0x24, 0x49, 0xB8, 0x4F, 0x22, 0x48, 0xD2,
-	0xE5, 0x1D, 0x5A, 0x02, 0x81, 0x80, 0x69, 0xE6, 0xCC, 0x99, 0xEB, 0x0B,
-	0x0B, 0x0B, 0x8B, 0x4F, 0x9F, 0x3E, 0xBD, 0x35, 0x10, 0x08, 0xFC, 0x19,
-	0x00, 0x2E, 0x00, 0x80, 0x3B, 0xA2, 0x03, 0xDF, 0x24, 0x48, 0x21, 0x17,
-	0x04, 0x21, 0x8B, 0x65, 0xD9, 0x67, 0xBF, 0xF3, 0x9D, 0xEF, 0x2C, 0xD1,
-	0xE9, 0x74, 0x59, 0x16, 0x8B, 0xC5, 0x42, 0xB6, 0x78, 0xC1, 0x65, 0x06,
-	0x19, 0x4E, 0x1F, 0xAB, 0x73, 0xC0, 0x02, 0x5F, 0x5C, 0xBE, 0x5F, 0xB8,
-	0x70, 0x61, 0xB0, 0xBB, 0xBB, 0xFB, 0x5D, 0x97, 0xCB, 0xF5, 0xEB, 0xDE,
-	0xDE, 0xDE, 0x26, 0x8C, 0xDC, 0x44, 0x23, 0xE8, 0x72, 0x90, 0xC9, 0x64,
-	0x76, 0xBF, 0xDF, 0xFF, 0x87, 0x2D, 0x5B, 0xB6, 0xB4, 0xF4, 0xF6, 0xF6,
-	0xFE, 0x70, 0xD1, 0xA2, 0x45, 0xB3, 0x25, 0x49, 0xC2, 0x52, 0xAF, 0x31,
-	0x8D, 0x74, 0xE2, 0xF5, 0xC2, 0xE8, 0x96, 0xCF, 0xE7, 0x03, 0x8F, 0xC7,
-	0x03, 0x6A, 0xB5, 0x1A, 0xCC, 0x66, 0xB3, 0x76, 0xD1, 0xA2, 0x45, 0xF3,
-	0x4A, 0x4B, 0x4B, 0x73, 0x5A, 0x5B, 0x5B, 0x97, 0xFB, 0x7C, 0xBE, 0xCF,
-	0x24, 0x49, 0xFA, 0x12, 0x00, 0x6C, 0x63, 0x76, 0x02, 0xD7, 0x71, 0xBE,
-	0x88, 0xDF, 0xEF, 0x4F, 0x94, 0x24, 0xE9, 0x89, 0x7B, 0xEF, 0xBD, 0xF7,
-	0x7E, 0x93, 0xC9, 0x54, 0xEC, 0xF3, 0xF9, 0x94, 0x64, 0x6F, 0xBA, 0xD1,
-	0x8A, 0x3B, 0x29, 0x4E, 0xF8, 0x5E, 0x64, 0xE2, 0x32, 0xFE, 0xFE, 0xCC,
-	0x99, 0x33, 0x55, 0x6F, 0xBE, 0xF9, 0xE6, 0xAF, 0xBB, 0xBA, 0xBA, 0x2E,
-	0x90, 0x5B, 0xCC, 0xDD, 0x08, 0x23, 0x0A, 0x16, 0xEE, 0xF9, 0x16, 0x09,
-	0xB8, 0xEB, 0xC9, 0xC0, 0xC0, 0xC0, 0xB1, 0xCD, 0x9B, 0x37, 0xBF, 0x61,
-	0x36, 0x9B, 0x2D, 0x79, 0x79, 0x79, 0xE9, 0xE4, 0x6E, 0x1D, 0x64, 0xBD,
-	0x21, 0x40, 0xE4, 0x5D, 0x0F, 0xC9, 0xC4, 0x33, 0xDC, 0x7D, 0x18, 0xE0,
-	0xF2, 0xA0, 0x4D, 0x4E, 0x4E, 0xE6, 0x92, 0x93, 0x93, 0x4B, 0x0C, 0x06,
-	0x43, 0x7A, 0x7C, 0x7C, 0x7C, 0xF9, 0xD1, 0xA3, 0x47, 0xF7, 0xEC, 0xD9,
-	0xB3, 0x67, 0x9B, 0xD3, 0xE9, 0x3C, 0x79, 0x2B, 0x2C, 0x87, 0x60, 0x22,
-	0xA6, 0xB2, 0xAF, 0xAF, 0xAF, 0x64, 0xC2, 0x84, 0x09, 0xF3, 0x7F, 0xFE,
-	0xF3, 0x9F, 0x2F, 0xCE, 0xCD, 0xCD, 0x9D, 0x96, 0x9A, 0x9A, 0x6A, 0xC2,
-	0xCF, 0x8B, 0xD9, 0xC2, 0xE8, 0xF8, 0x26, 0x1D, 0x95, 0x63, 0x01, 0x1E,
-	0x4F, 0xA1, 0x50, 0x84, 0x36, 0xD3, 0x6C, 0x68, 0x68, 0xB8, 0x70, 0xF2,
-	0xE4, 0xC9, 0x37, 0x62, 0x63, 0x63, 0xDF, 0x91, 0xCB, 0xE5, 0xAD, 0x1A,
-	0x8D, 0x26, 0xD4, 0xB3, 0x2A, 0x9A, 0x61, 0x2E, 0x17, 0xEB, 0xDA, 0x06,
-	0x07, 0x07, 0x3F, 0xDE, 0xBC, 0x79, 0x73, 0xEF, 0xC5, 0x8B, 0x17, 0x9F,
-	0x58, 0xB9, 0x72, 0xE5, 0x9A, 0xD8, 0xD8, 0xD8, 0x98, 0xB1, 0xBE, 0xFF,
-	0x64, 0xC4, 0x11, 0x27, 0x1C, 0x8D, 0x46, 0x13, 0xBA, 0x77, 0x1C, 0xC7,
-	0x41, 0x4A, 0x4A, 0x4A, 0xAA, 0x4A, 0xA5, 0xDA, 0xF8, 0xD0, 0x43, 0x0F,
-	0x95, 0x8A, 0xA2, 0xB8, 0x6A, 0xE7, 0xCE, 0x9D, 0xBB, 0x78, 0x9E, 0xDF,
-	0x02, 0x00, 0x5D, 0x63, 0x7A, 0x32, 0xD7, 0x40, 0x10, 0x04, 0x70, 0xBB,
-	0xDD, 0xF2, 0xBE, 0xBE, 0xBE, 0x92, 0xC9, 0x93, 0x27, 0x2F, 0xF8, 0xF9,
-	0xCF, 0x7F, 0x3E, 0x3F, 0x3B, 0x3B, 0x7B, 0x6A, 0x4E, 0x4E, 0x4E, 0x22,
-	0xC0, 0xE5, 0x86, 0x7C, 0x58, 0x2F, 0x4A, 0x3E, 0x93, 0x91, 0x42, 0x66,
-	0x02, 0xE0, 0x12, 0x2F, 0xDC, 0xAF, 0xD5, 0xD8, 0xD8, 0xD8, 0xFA, 0xFE,
-	0xFB, 0xEF, 0xBF, 0xD2, 0xD0, 0xD0, 0xB0, 0x0B, 0xD3, 0x54, 0xAE, 0xE7,
-	0xBD, 0xC2, 0x19, 0x51, 0xB0, 0x46, 0xFB, 0x10, 0x69, 0x34, 0x1A, 0x90,
-	0xCB, 0xE5, 0x52, 0x7D, 0x7D, 0xFD, 0x07, 0xBB, 0x77, 0xEF, 0xCE, 0x92,
-	0xCB, 0xE5, 0x4F, 0x66, 0x64, 0x64, 0x98, 0x31, 0x17, 0x06, 0x09, 0x6F,
-	0xB2, 0x76, 0x2D, 0xB0, 0x4E, 0x11, 0x43, 0xF1, 0x00, 0x57, 0x2E, 0x14,
-	0x66, 0xD5, 0xA7, 0xA7, 0xA7, 0x1B, 0xD3, 0xD3, 0xD3, 0x17, 0x14, 0x16,
-	0x16, 0x8E, 0x2F, 0x2C, 0x2C, 0x2C, 0x57, 0x28, 0x14, 0x47, 0xAD, 0x56,
-	0xEB, 0x29, 0xBB, 0xDD, 0x5E, 0x6D, 0xB3, 0xD9, 0x3A, 0xC9, 0xDE, 0xD3,
-	0x63, 0x0D, 0xDE, 0x04, 0x97, 0xCB, 0x65, 0x2E, 0x2C, 0x2C, 0x9C, 0x32,
-	0x75, 0xEA, 0xD4, 0x19, 0x85, 0x85, 0x85, 0xD3, 0x26, 0x4D, 0x9A, 0x34,
-	0x35, 0x2D, 0x2D, 0x2D, 0x0E, 0xE0, 0x4A, 0xAB, 0x16, 0x32, 0x0C, 0x8F,
-	0x5F, 0xE1, 0xB5, 0x56, 0x63, 0x01, 0x19, 0xE9, 0x39, 0x70, 0xE0, 0xC0,
-	0xA1, 0x23, 0x47, 0x8E, 0xBC, 0x2E, 0x97, 0xCB, 0x3F, 0x4B, 0x4E, 0x4E,
-	0xEE, 0xBF, 0xD3, 0xB2, 0xB5, 0x83, 0xD6, 0xB7, 0xBF, 0xBE, 0xBE, 0x7E,
-	0xCF, 0xBB, 0xEF, 0xBE, 0xDB, 0x39, 0x30, 0x30, 0xD0, 0xB5, 0x7A, 0xF5,
-	0xEA, 0x0D, 0x05, 0x05, 0x05, 0x39, 0x63, 0xF9, 0x3E, 0x68, 0x1D, 0xA0,
-	0xFF, 0x86, 0x2C, 0xF7, 0xC1, 0x31, 0xE0, 0xF3, 0xF9, 0xC0, 0x62, 0xB1,
-	0x80, 0xC5, 0x62, 0x29, 0xB0, 0xD9, 0x6C, 0x05, 0x0E, 0x87, 0xA3, 0xDC,
-	0x6E, 0xB7, 0x4F, 0xF4, 0xF9, 0x7C, 0xFB, 0x6C, 0x36, 0x5B, 0x85, 0xDD,
-	0x6E, 0x6F, 0xC2, 0xE5, 0xD7, 0x58, 0x82, 0x69, 0x06, 0x83, 0x83, 0x83,
-	0x20, 0x93, 0xC9, 0x62, 0x8A, 0x8B, 0x8B, 0x27, 0xCD, 0x99, 0x33, 0x67,
-	0x5A, 0x6E, 0x6E, 0xEE, 0xB4, 0x49, 0x93, 0x26, 0x95, 0x67, 0x66, 0x66,
-	0x26, 0x00, 0x00, 0xB8, 0x5C, 0x2E, 0xF0, 0xF9, 0x7C, 0xA0, 0x56, 0xAB,
-	0x01, 0x7D, 0x57, 0x38, 0xC1, 0xA1, 0xCF, 0x2F, 0x12, 0xAB, 0x1B, 0xC7,
-	0x2E, 0xD9, 0xFC, 0x0F, 0xFF, 0x1F, 0x08, 0x04, 0xE0, 0xE2, 0xC5, 0x8B,
-	0xFD, 0x3B, 0x76, 0xEC, 0xF8, 0xB8, 0xAE, 0xAE, 0xEE, 0x43, 0x85, 0x42,
-	0x21, 0x8C, 0xE5, 0xEA, 0x61, 0x4C, 0xEB, 0x5D, 0x82, 0x49, 0xA0, 0xDD,
-	0x4D, 0x4D, 0x4D, 0x6F, 0x1D, 0x39, 0x72, 0xC4, 0xA2, 0x54, 0x2A, 0x1F,
-	0x4E, 0x4E, 0x4E, 0x96, 0x87, 0xE7, 0xCA, 0x8C, 0x46, 0x65, 0x31, 0x3C,
-	0x8A, 0x21, 0x6E, 0x80, 0x2B, 0x4B, 0x1E, 0x7C, 0xF8, 0xF0, 0xDF, 0xE4,
-	0xE4, 0xE4, 0xB8, 0xF5, 0xEB, 0xD7, 0xAF, 0xB6, 0xD9, 0x6C, 0x2B, 0x2B,
-	0x2A, 0x2A, 0x2A, 0x97, 0x2F, 0x5F, 0x7E, 0xA0, 0xA3, 0xA3, 0xE3, 0xA4,
-	0x5A, 0xAD, 0x6E, 0xBC, 0x74, 0xE9, 0x52, 0x9B, 0xCD, 0x66, 0x6B, 0xC7,
-	0x24, 0xC2, 0x1B, 0x01, 0xEB, 0xAE, 0x9C, 0x4E, 0xA7, 0xD1, 0xE1, 0x70,
-	0x64, 0x78, 0xBD, 0xDE, 0xD4, 0xF2, 0xF2, 0xF2, 0x69, 0x16, 0x8B, 0x65,
-	0xD1, 0x82, 0x05, 0x0B, 0xA6, 0xA8, 0x54, 0x2A, 0x25, 0x9E, 0x17, 0x76,
-	0x55, 0xC0, 0xFF, 0x63, 0x7B, 0x59, 0xBC, 0x16, 0x63, 0x2D, 0xA6, 0x78,
-	0xAC, 0xC6, 0xC6, 0xC6, 0xEE, 0xC6, 0xC6, 0xC6, 0xC3, 0x9B, 0x37, 0x6F,
-	0xFE, 0xBD, 0x5C, 0x2E, 0xDF, 0x31, 0x65, 0xCA, 0x94, 0x31, 0x7B, 0x8F,
-	0xDB, 0x0D, 0x49, 0x92, 0xC0, 0x60, 0x30, 0xC0, 0xC0, 0xC0, 0x40, 0xFD,
-	0xA7, 0x9F, 0x7E, 0xFA, 0x52, 0x5F, 0x5F, 0xDF, 0xC5, 0x55, 0xAB, 0x56,
-	0x3D, 0x3C, 0x75, 0xEA, 0xD4, 0xE9, 0x4A, 0xA5, 0x72, 0x4C, 0x9E, 0x96,
-	0xF0, 0x44, 0x5E, 0xB2, 0x39, 0x1D, 0x46, 0x62, 0x31, 0x77, 0x2C, 0x58,
-	0x66, 0x06, 0xF3, 0xE6, 0xCD, 0xCB, 0xE1, 0x79, 0xFE, 0x07, 0x67, 0xCE,
-	0x9C, 0x59, 0x3E, 0x6B, 0xD6, 0xAC, 0x3D, 0x1C, 0xC7, 0xED, 0x34, 0x9B,
-	0xCD, 0x0D, 0xE7, 0xCF, 0x9F, 0x6F, 0x30, 0x9B, 0xCD, 0x37, 0xE4, 0x9C,
-	0xC7, 0xF7, 0xB2, 0xD9, 0x6C, 0x60, 0xB3, 0xD9, 0x52, 0xE3, 0xE3, 0xE3,
-	0x53, 0x97, 0x2F, 0x5F, 0x9E, 0x11, 0x13, 0x13, 0x33, 0x71, 0xFA, 0xF4,
-	0xE9, 0x73, 0x26, 0x4F, 0x9E, 0x3C, 0x45, 0xAB, 0xD5, 0x86, 0xC6, 0x21,
-	0x4E, 0xF0, 0xD8, 0x99, 0x16, 0x0D, 0x01, 0x5C, 0xEA, 0xE2, 0x4A, 0x28,
-	0x12, 0xD0, 0xAA, 0xC2, 0xE7, 0x18, 0x45, 0x98, 0x61, 0x18, 0xE8, 0xEC,
-	0xEC, 0xE4, 0x0F, 0x1F, 0x3E, 0xFC, 0xC5, 0xF9, 0xF3, 0xE7, 0xDF, 0x52,
-	0xAB, 0xD5, 0xBD, 0xE8, 0xD2, 0x19, 0xAB, 0x31, 0x7E, 0x53, 0x0A, 0xF4,
-	0x94, 0x4A, 0x65, 0xF5, 0xC0, 0xC0, 0xC0, 0x6B, 0xE7, 0xCE, 0x9D, 0x8B,
-	0xD3, 0x6A, 0xB5, 0x4B, 0x75, 0x3A, 0x9D, 0x0C, 0x2D, 0x09, 0xFC, 0x60,
-	0xE4, 0x07, 0x20, 0x1B, 0xCF, 0x01, 0x5C, 0x59, 0x13, 0xE3, 0x4C, 0x86,
-	0xD6, 0x02, 0x99, 0x10, 0x89, 0xBE, 0x19, 0x9C, 0xF9, 0x48, 0xAB, 0x45,
-	0xAD, 0x56, 0xB3, 0xF3, 0xE6, 0xCD, 0x9B, 0xBC, 0x60, 0xC1, 0x82, 0xC9,
-	0x0E, 0x87, 0xC3, 0x59, 0x53, 0x53, 0x73, 0xDA, 0xE9, 0x74, 0x1E, 0x9E,
-	0x32, 0x65, 0xCA, 0xA1, 0xC4, 0xC4, 0xC4, 0x0B, 0x4E, 0xA7, 0xD3, 0x23,
-	0x08, 0x82, 0xDB, 0xE7, 0xF3, 0xB9, 0xBD, 0x5E, 0xAF, 0xC7, 0xE3, 0xF1,
-	0xF0, 0x6E, 0xB7, 0x5B, 0xF4, 0xF9, 0x7C, 0xA1, 0x4D, 0x1C, 0xF0, 0x9C,
-	0x04, 0x41, 0x00, 0x97, 0xCB, 0x05, 0x6E, 0xB7, 0x1B, 0x78, 0x9E, 0xD7,
-	0x08, 0x82, 0xA0, 0xE7, 0x79, 0x5E, 0x9B, 0x98, 0x98, 0x98, 0x5C, 0x5A,
-	0x5A, 0x3A, 0x5D, 0xAB, 0xD5, 0xCE, 0x67, 0x18, 0x66, 0xF2, 0xA3, 0x8F,
-	0x3E, 0x1A, 0x0F, 0x00, 0x2C, 0x9E, 0x27, 0x99, 0xD3, 0xE2, 0x76, 0xBB,
-	0x43, 0xD9, 0xDB, 0x98, 0x0F, 0x85, 0x4B, 0x8C, 0xF0, 0x9C, 0x33, 0xE4,
-	0x6A, 0x37, 0x78, 0xB8, 0x01, 0x80, 0x3F, 0xE3, 0x79, 0x5E, 0xEA, 0xEE,
-	0xEE, 0x3E, 0x57, 0x55, 0x55, 0xF5, 0xA7, 0x57, 0x5E, 0x79, 0xE5, 0x35,
-	0xBF, 0xDF, 0xDF, 0x35, 0x65, 0xCA, 0x94, 0xA8, 0x5F, 0xFE, 0x5D, 0x0B,
-	0xCC, 0x35, 0xF3, 0x78, 0x3C, 0x1D, 0x87, 0x0F, 0x1F, 0x7E, 0xC3, 0x66,
-	0xB3, 0x35, 0xF0, 0x3C, 0xFF, 0x42, 0x59, 0x59, 0xD9, 0xA2, 0x98, 0x98,
-	0x18, 0x03, 0xBE, 0x26, 0xDC, 0x21, 0x4F, 0x46, 0xAB, 0xC9, 0xA5, 0xCE,
-	0x70, 0xC7, 0x07, 0x18, 0xBA, 0x3B, 0x0C, 0x2E, 0xA9, 0x48, 0x31, 0xC3,
-	0x92, 0x27, 0xF4, 0x0F, 0x71, 0x1C, 0x07, 0x93, 0x26, 0x4D, 0xCA, 0x2D,
-	0x2B, 0x2B, 0xCB, 0x5D, 0xB1, 0x62, 0xC5, 0xB2, 0xB3, 0x67, 0xCF, 0x9E,
-	0x11, 0x45, 0xF1, 0x33, 0xA3, 0xD1, 0x78, 0xD0, 0xEF, 0xF7, 0xBB, 0x79,
-	0x9E, 0xB7, 0x7B, 0x3C, 0x1E, 0xBB, 0xD3, 0xE9, 0x14, 0x30, 0x50, 0x85,
-	0x81, 0x26, 0xEC, 0xD1, 0x1F, 0x74, 0x21, 0x30, 0x5E, 0xAF, 0x97, 0xF3,
-	0xF9, 0x7C, 0x2A, 0x41, 0x10, 0xB4, 0x4E, 0xA7, 0x53, 0x93, 0x92, 0x92,
-	0xA2, 0x9D, 0x32, 0x65, 0x4A, 0x5E, 0x62, 0x62, 0xE2, 0xCC, 0xC2, 0xC2,
-	0xC2, 0x99, 0x0F, 0x3C, 0xF0, 0xC0, 0x04, 0xB5, 0x5A, 0xAD, 0x22, 0x3F,
-	0x2B, 0xF9, 0xDC, 0x19, 0x8D, 0xC6, 0x21, 0x56, 0x3E, 0x59, 0x97, 0x4A,
-	0xB6, 0x8D, 0x09, 0xEF, 0xC8, 0x40, 0x5A, 0x54, 0x78, 0x2C, 0xF2, 0xFA,
-	0xE1, 0xB5, 0xB1, 0xDB, 0xED, 0xFE, 0x73, 0xE7, 0xCE, 0xED, 0x1A, 0x18,
-	0x18, 0x78, 0x5D, 0xA9, 0x54, 0x56, 0xDF, 0x8C, 0x55, 0xCD, 0x4D, 0xAB,
-	0x28, 0xE6, 0x38, 0xEE, 0x60, 0x7B, 0x7B, 0xFB, 0x3F, 0x49, 0x92, 0xA4,
-	0x9C, 0x3E, 0x7D, 0xFA, 0x42, 0x85, 0x42, 0x01, 0x1E, 0x8F, 0x07, 0xE4,
-	0x72, 0xF9, 0x90, 0xC6, 0x7D, 0x00, 0x10, 0x2A, 0x9D, 0x20, 0xF3, 0x68,
-	0xBC, 0x5E, 0x2F, 0x70, 0x1C, 0x37, 0x6C, 0x19, 0x40, 0x78, 0x76, 0x2D,
-	0x99, 0xE2, 0x4F, 0xE6, 0x80, 0x01, 0x00, 0xE8, 0xF5, 0x7A, 0x5D, 0x79,
-	0x79, 0xF9, 0xF4, 0xB2, 0xB2, 0xB2, 0x49, 0x8F, 0x3E, 0xFA, 0xE8, 0x13,
-	0x5E, 0xAF, 0xD7, 0xD6, 0xDD, 0xDD, 0xDD, 0xAF, 0x50, 0x28, 0x9A, 0x0D,
-	0x06, 0xC3, 0xB9, 0x98, 0x98, 0x98, 0x0B, 0x2E, 0x97, 0xAB, 0x43, 0xA9,
-	0x54, 0xF6, 0x0B, 0x82, 0xE0, 0x74, 0xBB, 0xDD, 0x7E, 0x83, 0xC1, 0xE0,
-	0x93, 0xCB, 0xE5, 0x4E, 0x51, 0x14, 0x45, 0xAD, 0x56, 0xCB, 0x26, 0x26,
-	0x26, 0x1A, 0xE3, 0xE3, 0xE3, 0xD3, 0x4D, 0x26, 0x53, 0xA1, 0x56, 0xAB,
-	0x9D, 0x28, 0x49, 0x52, 0xD1, 0x9A, 0x35, 0x6B, 0xB2, 0x8D, 0x46, 0x63,
-	0x9C, 0x5C, 0x2E, 0x57, 0xCA, 0xE5, 0xF2, 0x21, 0x27, 0x48, 0x3A, 0x1E,
-	0x51, 0xA8, 0xF0, 0xE7, 0x23, 0x89, 0x12, 0xE9, 0xB8, 0x24, 0x3F, 0x6F,
-	0xB8, 0xBF, 0x00, 0xCD, 0xF8, 0xF0, 0x36, 0xB5, 0x00, 0x00, 0x7E, 0xBF,
-	0x3F, 0xB0, 0x77, 0xEF, 0xDE, 0x23, 0xDD, 0xDD, 0xDD, 0xFF, 0x35, 0x63,
-	0xC6, 0x8C, 0xAD, 0x7A, 0xBD, 0xDE, 0xD3, 0xDB, 0xDB, 0x3B, 0xFA, 0x9B,
-	0x17, 0xC5, 0x04, 0xAF, 0x93, 0x47, 0x26, 0x93, 0xED, 0xFE, 0xF8, 0xE3,
-	0x8F, 0x2F, 0x55, 0x55, 0x55, 0x3D, 0xB3, 0x6E, 0xDD, 0xBA, 0xC7, 0xD2,
-	0xD3, 0xD3, 0x93, 0x58, 0x96, 0x05, 0x87, 0xC3, 0x11, 0x5A, 0x12, 0x91,
-	0xC9, 0x8D, 0x78, 0x6D, 0xC9, 0x9E, 0x5B, 0x64, 0xFE, 0x5A, 0x78, 0x26,
-	0x3C, 0x49, 0x78, 0x16, 0x3D, 0xBE, 0x8E, 0xBC, 0xBF, 0x0C, 0xC3, 0x40,
-	0x66, 0x66, 0x66, 0x7A, 0x6A, 0x6A, 0x6A, 0xEA, 0xDC, 0xB9, 0x73, 0xE7,
-	0xBA, 0x5C, 0xAE, 0xFE, 0xA6, 0xA6, 0xA6, 0x73, 0x1A, 0x8D, 0xE6, 0x54,
-	0x6C, 0x6C, 0xEC, 0xA9, 0x94, 0x94, 0x94, 0x7A, 0x9D, 0x4E, 0xD7, 0x29,
-	0x8A, 0xA2, 0xC0, 0xB2, 0xAC, 0x64, 0x32, 0x99, 0xE4, 0xF1, 0xF1, 0xF1,
-	0x6A, 0x96, 0x65, 0x35, 0x4A, 0xA5, 0xD2, 0x60, 0x30, 0x18, 0x62, 0x2C,
-	0x16, 0x4B, 0xBC, 0xC9, 0x64, 0xCA, 0xE4, 0x38, 0x2E, 0xAF, 0xB7, 0xB7,
-	0x37, 0xFF, 0xBE, 0xFB, 0xEE, 0x4B, 0x79, 0xE8, 0xA1, 0x87, 0x8C, 0x72,
-	0xB9, 0x5C, 0xAD, 0x50, 0x28, 0x38, 0x72, 0xF2, 0xC3, 0x31, 0x18, 0xEE,
-	0x46, 0x09, 0xFF, 0x3E, 0x1C, 0xEC, 0xC9, 0x8F, 0x11, 0x79, 0xBC, 0x2E,
-	0xB8, 0x5C, 0x24, 0xC5, 0x0B, 0x97, 0xC8, 0xC1, 0x4C, 0x76, 0x38, 0x71,
-	0xE2, 0xC4, 0x9E, 0xF6, 0xF6, 0xF6, 0x7F, 0xE2, 0x38, 0xEE, 0xE8, 0x8D,
-	0xDE, 0xC7, 0x91, 0xB8, 0x69, 0x82, 0xC5, 0x30, 0x8C, 0xC8, 0x30, 0xCC,
-	0x91, 0xEE, 0xEE, 0xEE, 0x7F, 0xA8, 0xA8, 0xA8, 0x50, 0x95, 0x95, 0x95,
-	0xCD, 0xC4, 0xB5, 0x32, 0x59, 0x2B, 0x87, 0x26, 0x29, 0x46, 0x5E, 0x30,
-	0x39, 0x0F, 0xBB, 0x1E, 0xE2, 0x2C, 0x35, 0x5A, 0xC2, 0x05, 0x4C, 0xA1,
-	0x50, 0x70, 0x1A, 0x8D, 0xC6, 0x02, 0x00, 0x16, 0xB7, 0xDB, 0x9D, 0x9D,
-	0x98, 0x98, 0x38, 0x71, 0xF2, 0xE4, 0xC9, 0x6E, 0xAF, 0xD7, 0xEB, 0xF0,
-	0xF9, 0x7C, 0xAE, 0x40, 0x20, 0xE0, 0x63, 0x18, 0x26, 0x20, 0x8A, 0xA2,
-	0xE8, 0xF7, 0xFB, 0x7D, 0x31, 0x31, 0x31, 0xDE, 0x81, 0x81, 0x01, 0x71,
-	0xF1, 0xE2, 0xC5, 0xF2, 0xF2, 0xF2, 0x72, 0x8D, 0x5A, 0xAD, 0xD6, 0x6A,
-	0x34, 0x1A, 0xBD, 0x56, 0xAB, 0x35, 0xAB, 0xD5, 0x6A, 0x2D, 0xB9, 0xD1,
-	0x2C, 0xF9, 0x7E, 0xC3, 0x11, 0x3E, 0x83, 0x87, 0x83, 0x65, 0x0E, 0xA4,
-	0x4F, 0x80, 0x1C, 0x5C, 0x28, 0x66, 0x38, 0xDB, 0xE2, 0xF1, 0x3C, 0x1E,
-	0x0F, 0xF8, 0xFD, 0x7E, 0xD0, 0x6A, 0xB5, 0x20, 0x49, 0x92, 0xF4, 0xF9,
-	0xE7, 0x9F, 0x7F, 0xBC, 0x6D, 0xDB, 0xB6, 0xDF, 0xCE, 0x9B, 0x37, 0xEF,
-	0xA8, 0xC1, 0x60, 0x10, 0xAE, 0xA7, 0x1A, 0xFE, 0x4E, 0x20, 0xD8, 0x82,
-	0x47, 0x72, 0xBB, 0xDD, 0xE7, 0xB6, 0x6D, 0xDB, 0xF6, 0x6F, 0x0D, 0x0D,
-	0x0D, 0xD5, 0x0F, 0x3D, 0xF4, 0xD0, 0xF7, 0xE7, 0xCE, 0x9D, 0x3B, 0xCB,
-	0x60, 0x30, 0x40, 0x20, 0x10, 0x00, 0xA7, 0xD3, 0x19, 0x72, 0x33, 0x84,
-	0x07, 0x41, 0xD0, 0x9F, 0x83, 0xE2, 0x45, 0x2E, 0xF9, 0xAE, 0xC5, 0xB5,
-	0xAE, 0xB7, 0x5C, 0x2E, 0x67, 0xE5, 0x72, 0xB9, 0x36, 0x48, 0x7A, 0x4E,
-	0x4E, 0x4E, 0xF9, 0xDA, 0xB5, 0x6B, 0x1D, 0x1E, 0x8F, 0xC7, 0xA9, 0xD3,
-	0xE9, 0x1C, 0x76, 0xBB, 0xDD, 0x1D, 0x1F, 0x1F, 0xEF, 0x7B, 0xE1, 0x85,
-	0x17, 0x24, 0x51, 0x14, 0x95, 0x72, 0xB9, 0x5C, 0xA9, 0x52, 0xA9, 0x34,
-	0x6A, 0xB5, 0x5A, 0xC3, 0x71, 0x9C, 0x5A, 0x2E, 0x97, 0xAB, 0x39, 0x8E,
-	0x53, 0xAB, 0x54, 0x2A, 0xD5, 0x70, 0xAD, 0x59, 0xC2, 0xC7, 0xD8, 0x70,
-	0xE2, 0x39, 0x12, 0x28, 0x4C, 0x1A, 0x8D, 0x06, 0x24, 0x49, 0x02, 0xBB,
-	0xDD, 0x0E, 0x4A, 0xA5, 0x32, 0xE4, 0x30, 0x47, 0xD7, 0x0C, 0x16, 0x42,
-	0xE3, 0xB8, 0x0D, 0x04, 0x02, 0xD0, 0xD2, 0xD2, 0x72, 0xCA, 0x6A, 0xB5,
-	0xFE, 0x7F, 0x00, 0x70, 0x84, 0x61, 0x98, 0x9B, 0x66, 0xCE, 0xDF, 0xD4,
-	0x9E, 0x2D, 0x32, 0x99, 0x4C, 0x64, 0x18, 0xE6, 0x60, 0x57, 0x57, 0xD7,
-	0xFF, 0x39, 0x75, 0xEA, 0xD4, 0xDF, 0x97, 0x94, 0x94, 0x2C, 0xD2, 0xEB,
-	0xF5, 0x8C, 0xCF, 0xE7, 0x0B, 0xB5, 0xA3, 0xC1, 0xD0, 0x3E, 0x3E, 0xAC,
-	0x64, 0x81, 0xEA, 0x58, 0x84, 0xFB, 0x49, 0xE1, 0xC2, 0xE4, 0x3F, 0x95,
-	0x4A, 0x05, 0x1A, 0x8D, 0x46, 0x01, 0x00, 0xC6, 0xE0, 0xD7, 0x37, 0xC0,
-	0xDC, 0xAF, 0x9C, 0x9C, 0x9C, 0x6F, 0xCC, 0xA8, 0x64, 0x1D, 0x55, 0x24,
-	0x4B, 0xAD, 0x6B, 0xBD, 0x86, 0x9C, 0x0D, 0x49, 0xFF, 0x08, 0x9A, 0xDE,
-	0xA4, 0x19, 0x8F, 0xD6, 0x00, 0xB6, 0x43, 0xE1, 0x38, 0x0E, 0x1A, 0x1B,
-	0x1B, 0x9B, 0xBE, 0xFA, 0xEA, 0xAB, 0xD7, 0x8E, 0x1E, 0x3D, 0xFA, 0x89,
-	0x24, 0x49, 0x67, 0xD5, 0x6A, 0xF5, 0x90, 0x04, 0xBE, 0xBB, 0x15, 0xB5,
-	0x5A, 0x0D, 0x76, 0xBB, 0xBD, 0xBF, 0xB5, 0xB5, 0xF5, 0xC3, 0x86, 0x86,
-	0x86, 0x4B, 0xFD, 0xFD, 0xFD, 0xCF, 0x2C, 0x5B, 0xB6, 0xEC, 0x61, 0xBD,
-	0x5E, 0xAF, 0xC0, 0x56, 0xD0, 0xF8, 0x80, 0xA2, 0x65, 0x81, 0xD7, 0x74,
-	0xB8, 0xDA, 0xD7, 0xB1, 0x02, 0x97, 0x6A, 0x2A, 0x95, 0x0A, 0xB4, 0x5A,
-	0xAD, 0x01, 0x00, 0x42, 0x3B, 0x88, 0x62, 0x64, 0x77, 0xB8, 0x16, 0xE5,
-	0x24, 0xC1, 0xB4, 0x99, 0x88, 0x7A, 0xCF, 0x45, 0x0A, 0x29, 0xCA, 0xD8,
-	0x94, 0x00, 0x0B, 0x9E, 0xD1, 0xD0, 0xC0, 0x22, 0x72, 0x0C, 0x82, 0xB9,
-	0xDD, 0x6E, 0xB8, 0x78, 0xF1, 0xE2, 0x3E, 0xA7, 0xD3, 0xF9, 0x7F, 0x59,
-	0x96, 0x3D, 0xC8, 0xB2, 0xEC, 0x4D, 0x1D, 0x74, 0x37, 0xBD, 0xC9, 0x54,
-	0x70, 0xF9, 0x76, 0xE0, 0xD2, 0xA5, 0x4B, 0xFF, 0x28, 0x8A, 0xA2, 0xAF,
-	0xB4, 0xB4, 0x74, 0xB9, 0xD9, 0x6C, 0x66, 0xB1, 0xAD, 0x8C, 0x56, 0xAB,
-	0x0D, 0xED, 0xA3, 0x87, 0x75, 0x47, 0x68, 0xAA, 0x47, 0xDA, 0xCA, 0x02,
-	0x20, 0xB2, 0x01, 0x45, 0x86, 0x61, 0x01, 0xBE, 0x69, 0xDA, 0x93, 0x3F,
-	0x27, 0x77, 0x4E, 0x26, 0xD7, 0xF3, 0x28, 0x04, 0x63, 0x1D, 0xD5, 0x1B,
-	0xE9, 0x5C, 0xC9, 0x16, 0x1D, 0xD8, 0x64, 0x0E, 0x7D, 0x5F, 0xA2, 0x28,
-	0xC2, 0xB1, 0x63, 0xC7, 0x76, 0xF6, 0xF7, 0xF7, 0xBF, 0x75, 0xF8, 0xF0,
-	0xE1, 0x4F, 0x3A, 0x3A, 0x3A, 0x5C, 0x85, 0x85, 0x85, 0x77, 0xBD, 0x50,
-	0x21, 0x68, 0x9D, 0x1B, 0x8D, 0x46, 0x9F, 0x24, 0x49, 0x07, 0x8E, 0x1D,
-	0x3B, 0xD6, 0x73, 0xF1, 0xE2, 0xC5, 0xC6, 0x99, 0x33, 0x67, 0x3E, 0x30,
-	0x65, 0xCA, 0x94, 0xF1, 0xE8, 0x5F, 0xC4, 0x28, 0x2E, 0x4E, 0x06, 0xE1,
-	0x51, 0xB0, 0xE1, 0x12, 0x9F, 0x6F, 0x04, 0x5C, 0x4E, 0xE1, 0x17, 0x69,
-	0x51, 0x93, 0x01, 0x19, 0x32, 0xA7, 0x2F, 0xDC, 0x21, 0x4E, 0x5A, 0xE3,
-	0x63, 0x79, 0x5E, 0xE8, 0x9C, 0x57, 0x28, 0x14, 0x43, 0xDA, 0x49, 0xA3,
-	0x6B, 0xC6, 0xE1, 0x70, 0x80, 0x46, 0xA3, 0x01, 0xB5, 0x5A, 0x0D, 0xBD,
-	0xBD, 0xBD, 0x52, 0x63, 0x63, 0xE3, 0x4E, 0x9B, 0xCD, 0xF6, 0x2B, 0xAD,
-	0x56, 0xBB, 0x7F, 0xAC, 0x13, 0xA0, 0x87, 0xE3, 0x5B, 0xE9, 0x8A, 0x17,
-	0xCC, 0x0B, 0x3A, 0xD8, 0xD4, 0xD4, 0xF4, 0xAF, 0x7E, 0xBF, 0xDF, 0x57,
-	0x5A, 0x5A, 0xBA, 0xC2, 0x62, 0xB1, 0x28, 0x03, 0x81, 0x40, 0xA8, 0x50,
-	0x15, 0xD7, 0xC7, 0x58, 0xAC, 0x8B, 0x37, 0x75, 0x2C, 0x07, 0xCB, 0x70,
-	0xCD, 0xEF, 0xAE, 0xB5, 0xAE, 0x0F, 0x1F, 0x2C, 0x64, 0xA9, 0xCB, 0x58,
-	0x0A, 0x43, 0x78, 0xE2, 0x1D, 0x99, 0x9C, 0x87, 0x91, 0x44, 0xEC, 0xA4,
-	0xE0, 0xF1, 0x78, 0xE0, 0xDC, 0xB9, 0x73, 0xAD, 0xA7, 0x4F, 0x9F, 0xDE,
-	0xD9, 0xD2, 0xD2, 0xF2, 0x56, 0x7E, 0x7E, 0xFE, 0x01, 0xB3, 0xD9, 0x0C,
-	0xFD, 0xFD, 0xFD, 0x54, 0xAC, 0x86, 0x01, 0x1D, 0xF2, 0x32, 0x99, 0xAC,
-	0xE1, 0xF3, 0xCF, 0x3F, 0xFF, 0x57, 0xB9, 0x5C, 0xDE, 0x68, 0x34, 0x1A,
-	0x1F, 0x31, 0x99, 0x4C, 0xF3, 0x92, 0x92, 0x92, 0xF4, 0x58, 0xB0, 0x4F,
-	0x0A, 0x09, 0x82, 0xCB, 0x70, 0xD2, 0xD1, 0x7C, 0xA3, 0x90, 0x39, 0x5D,
-	0xA4, 0x38, 0x91, 0x02, 0x85, 0xE3, 0x80, 0x1C, 0x7F, 0x57, 0x0B, 0x0A,
-	0x8C, 0x05, 0xE8, 0x70, 0xC7, 0xCF, 0x1C, 0x1E, 0x19, 0xC5, 0x5D, 0x6F,
-	0x44, 0x51, 0x84, 0xC1, 0xC1, 0x41, 0xE1, 0xFC, 0xF9, 0xF3, 0xBB, 0xBA,
-	0xBA, 0xBA, 0xFE, 0xDD, 0x60, 0x30, 0x7C, 0x2B, 0x62, 0x05, 0xF0, 0x2D,
-	0x09, 0x16, 0x40, 0xA8, 0x60, 0x7A, 0xFF, 0x85, 0x0B, 0x17, 0x3C, 0x36,
-	0x9B, 0xCD, 0x3B, 0x6B, 0xD6, 0xAC, 0x35, 0x09, 0x09, 0x09, 0x5A, 0xB7,
-	0xDB, 0x0D, 0x6E, 0xB7, 0x3B, 0x54, 0xA2, 0x42, 0x6E, 0x5B, 0x45, 0x6E,
-	0x1B, 0x36, 0x16, 0x90, 0x0F, 0x3F, 0x9E, 0x13, 0x29, 0x54, 0x38, 0x20,
-	0xF0, 0x35, 0xE4, 0x76, 0x55, 0x78, 0x2E, 0xC8, 0x58, 0x0A, 0x03, 0x1E,
-	0x8B, 0x8C, 0x82, 0xE2, 0x17, 0x59, 0xB0, 0xCC, 0x30, 0x0C, 0x38, 0x9D,
-	0x4E, 0x4F, 0x57, 0x57, 0x57, 0xCD, 0x17, 0x5F, 0x7C, 0xF1, 0xF6, 0xF6,
-	0xED, 0xDB, 0xDF, 0x5E, 0xB2, 0x64, 0x89, 0x33, 0x3C, 0x88, 0x41, 0xF9,
-	0x26, 0x28, 0x02, 0x6A, 0xB5, 0x5A, 0xD0, 0xE9, 0x74, 0xEF, 0x9F, 0x3D,
-	0x7B, 0xB6, 0xA2, 0xAF, 0xAF, 0xEF, 0xFB, 0xCB, 0x96, 0x2D, 0xBB, 0x2F,
-	0x35, 0x35, 0x35, 0x35, 0x7C, 0xBC, 0x91, 0x63, 0x22, 0xD2, 0xB6, 0xDF,
-	0x91, 0x32, 0x9C, 0x65, 0x05, 0x30, 0x74, 0x42, 0x05, 0x80, 0x50, 0x84,
-	0x2F, 0xDC, 0x9A, 0xC2, 0x71, 0x8C, 0x6E, 0x89, 0xB1, 0xB2, 0xF6, 0xD1,
-	0x15, 0x81, 0x9B, 0xBF, 0xA0, 0xA3, 0x1D, 0xB7, 0xE4, 0x93, 0xCB, 0xE5,
-	0x60, 0x32, 0x99, 0xA0, 0xB5, 0xB5, 0x75, 0xE0, 0xF4, 0xE9, 0xD3, 0xBB,
-	0xDD, 0x6E, 0xF7, 0x6F, 0xD5, 0x6A, 0xF5, 0xFE, 0x6F, 0xD3, 0x4F, 0xFA,
-	0xAD, 0xF7, 0x1D, 0xE6, 0x38, 0xEE, 0x44, 0x4B, 0x4B, 0xCB, 0xAF, 0x3C,
-	0x1E, 0x8F, 0x63, 0xC5, 0x8A, 0x15, 0x0F, 0xEA, 0x74, 0x3A, 0x3D, 0x29,
-	0x48, 0x64, 0x64, 0xE3, 0x66, 0x98, 0xE2, 0xE1, 0x2D, 0x6E, 0x50, 0x14,
-	0x70, 0x10, 0x90, 0xBE, 0xA2, 0xE1, 0xA2, 0x3F, 0xE1, 0xCE, 0xF0, 0xB1,
-	0x80, 0x5C, 0xFE, 0xE1, 0x03, 0x82, 0xE2, 0x48, 0x6E, 0x9A, 0xD0, 0xDD,
-	0xDD, 0xDD, 0xB3, 0x6F, 0xDF, 0xBE, 0x2F, 0x34, 0x1A, 0xCD, 0xCB, 0x1C,
-	0xC7, 0x55, 0x31, 0x0C, 0x13, 0x75, 0xB5, 0x80, 0xB7, 0x1A, 0xBC, 0x5E,
-	0x1A, 0x8D, 0xE6, 0x5C, 0x6D, 0x6D, 0xED, 0xFF, 0xAD, 0xAF, 0xAF, 0xAF,
-	0xD9, 0xB8, 0x71, 0xE3, 0x53, 0xD9, 0xD9, 0xD9, 0x53, 0x62, 0x63, 0x63,
-	0x55, 0x68, 0xE9, 0xE3, 0x9E, 0x9B, 0x64, 0xAB, 0xA4, 0xB1, 0x22, 0x7C,
-	0x2C, 0x91, 0xD6, 0x0C, 0x8E, 0x51, 0x6C, 0x93, 0x03, 0x10, 0x0A, 0x22,
-	0x0C, 0x59, 0xA2, 0x92, 0x6E, 0x8B, 0x9B, 0x71, 0x6E, 0x64, 0xD3, 0x02,
-	0x4C, 0x21, 0x92, 0x24, 0x09, 0x7A, 0x7B, 0x7B, 0x6D, 0x7B, 0xF7, 0xEE,
-	0x7D, 0xCF, 0xED, 0x76, 0xFF, 0x2E, 0x39, 0x39, 0xB9, 0x7E, 0xCC, 0x4F,
-	0xE0, 0x1A, 0x7C, 0xEB, 0x82, 0x15, 0x5C, 0xD6, 0x9C, 0x39, 0x7B, 0xF6,
-	0xEC, 0xFF, 0x3D, 0x7F, 0xFE, 0x7C, 0xDD, 0xCA, 0x95, 0x2B, 0xBF, 0x3F,
-	0x71, 0xE2, 0xC4, 0x3C, 0x4C, 0x84, 0x03, 0x80, 0x21, 0x69, 0x0F, 0x63,
-	0xFD, 0x40, 0x0E, 0x17, 0x45, 0x21, 0x05, 0x92, 0x0C, 0x67, 0x93, 0x16,
-	0x4E, 0xF8, 0xF9, 0x8C, 0xA5, 0x98, 0x92, 0xBE, 0x33, 0x1C, 0x24, 0xB8,
-	0x2C, 0x0C, 0xB6, 0xA5, 0xF1, 0xD7, 0xD7, 0xD7, 0x57, 0xBF, 0xFE, 0xFA,
-	0xEB, 0xBF, 0x95, 0x24, 0x69, 0xDB, 0xAA, 0x55, 0xAB, 0x7A, 0x86, 0x6B,
-	0x9C, 0x46, 0x89, 0x9C, 0xE0, 0xF5, 0x1B, 0x68, 0x6E, 0x6E, 0x7E, 0xF7,
-	0x8D, 0x37, 0xDE, 0x38, 0x3C, 0x79, 0xF2, 0xE4, 0xE7, 0x57, 0xAD, 0x5A,
-	0xF5, 0x48, 0x6A, 0x6A, 0x6A, 0x2C, 0xFA, 0x50, 0xF1, 0xFA, 0x92, 0x3B,
-	0xEE, 0x8C, 0x05, 0x18, 0xFC, 0x41, 0xE7, 0x7E, 0xF8, 0xBD, 0x44, 0xA7,
-	0x7C, 0x78, 0x9B, 0x6A, 0x32, 0x01, 0x7B, 0xB8, 0x95, 0xC1, 0x8D, 0x12,
-	0x7E, 0x1E, 0x6E, 0xB7, 0x1B, 0x44, 0x51, 0x04, 0x9D, 0x4E, 0x07, 0x92,
-	0x24, 0x41, 0x55, 0x55, 0x55, 0xDD, 0x97, 0x5F, 0x7E, 0xF9, 0x8A, 0xCF,
-	0xE7, 0xFB, 0x30, 0x2F, 0x2F, 0xEF, 0x96, 0xF4, 0xA4, 0xBB, 0x25, 0x3B,
-	0x3B, 0x04, 0x6F, 0x7C, 0x5B, 0x6D, 0x6D, 0xED, 0x6B, 0x4D, 0x4D, 0x4D,
-	0x6D, 0x4B, 0x97, 0x2E, 0x7D, 0x78, 0xD5, 0xAA, 0x55, 0xCB, 0xCC, 0x66,
-	0xB3, 0x06, 0x0B, 0xA6, 0x31, 0xDD, 0xE1, 0x66, 0x40, 0xFA, 0xAF, 0x48,
-	0xEB, 0x06, 0x60, 0x68, 0x67, 0x54, 0x32, 0x29, 0x8E, 0x7C, 0xCD, 0x58,
-	0x2F, 0xBF, 0x48, 0x27, 0x2F, 0x99, 0xD4, 0x07, 0x00, 0x70, 0xEE, 0xDC,
-	0xB9, 0x4B, 0xA7, 0x4F, 0x9F, 0xFE, 0x58, 0xAD, 0x56, 0xBF, 0xD7, 0xDA,
-	0xDA, 0x5A, 0x65, 0xB1, 0x58, 0xF8, 0x5B, 0xD9, 0xBE, 0xF8, 0x4E, 0x01,
-	0x1D, 0xF2, 0x0C, 0xC3, 0x78, 0x7B, 0x7B, 0x7B, 0xEB, 0x7B, 0x7B, 0x7B,
-	0xFF, 0xED, 0xF5, 0xD7, 0x5F, 0x3F, 0x9A, 0x95, 0x95, 0x75, 0xDF, 0x8A,
-	0x15, 0x2B, 0x96, 0xC6, 0xC6, 0xC6, 0x1A, 0xD0, 0xA7, 0x3A, 0x96, 0xCB,
-	0x41, 0x80, 0x2B, 0xAB, 0x08, 0xB4, 0xD2, 0xC9, 0xA5, 0x28, 0xBE, 0xD7,
-	0x70, 0xCE, 0x7E, 0x72, 0xDC, 0xDD, 0x8C, 0xE8, 0x25, 0x4E, 0x96, 0x68,
-	0x5D, 0x62, 0x1E, 0xA4, 0xD5, 0x6A, 0xB5, 0x7F, 0xF5, 0xD5, 0x57, 0xDB,
-	0x76, 0xEE, 0xDC, 0xF9, 0xBE, 0xDD, 0x6E, 0xDF, 0x95, 0x9F, 0x9F, 0xEF,
-	0xB8, 0x55, 0x85, 0xF3, 0xB7, 0x44, 0xB0, 0xD0, 0x09, 0xCA, 0xB2, 0xAC,
-	0xA3, 0xAE, 0xAE, 0xEE, 0xA3, 0xD4, 0xD4, 0xD4, 0x0B, 0x5A, 0xAD, 0xB6,
-	0xA1, 0xB0, 0xB0, 0xF0, 0xA1, 0xA2, 0xA2, 0xA2, 0x0C, 0x49, 0xBA, 0x5C,
-	0x71, 0x8F, 0x37, 0x90, 0x74, 0x3A, 0x92, 0x19, 0xC5, 0xE4, 0x4D, 0xC6,
-	0xDF, 0x87, 0x47, 0x00, 0xC9, 0x59, 0x08, 0xC5, 0x09, 0xBF, 0x0F, 0xB7,
-	0xA6, 0xC2, 0xBF, 0x0F, 0x5F, 0x3E, 0x92, 0xBF, 0x1F, 0x4E, 0xF4, 0xF0,
-	0x77, 0xE4, 0xFB, 0x02, 0x5C, 0x2E, 0x78, 0x46, 0xB3, 0x1E, 0xC3, 0xD1,
-	0xE4, 0x4E, 0xCB, 0xE4, 0xEB, 0x70, 0x87, 0xEB, 0x8E, 0x8E, 0x0E, 0xDB,
-	0xC1, 0x83, 0x07, 0x77, 0x55, 0x55, 0x55, 0x7D, 0x16, 0x13, 0x13, 0xB3,
-	0xB7, 0xA4, 0xA4, 0xE4, 0xA2, 0x5E, 0xAF, 0x1F, 0xD5, 0xCE, 0x25, 0x94,
-	0xAB, 0x83, 0x93, 0x44, 0x30, 0xD7, 0xA8, 0xE3, 0xD4, 0xA9, 0x53, 0xEF,
-	0xEF, 0xDB, 0xB7, 0xEF, 0xEC, 0xC5, 0x8B, 0x17, 0xCF, 0x2C, 0x5F, 0xBE,
-	0x7C, 0xDD, 0xE4, 0xC9, 0x93, 0x4B, 0xC3, 0xDB, 0xF9, 0x92, 0xCB, 0x76,
-	0x14, 0x17, 0xB2, 0x6F, 0x39, 0x79, 0x6C, 0x92, 0x70, 0x5F, 0x15, 0xF9,
-	0x3A, 0x72, 0xAC, 0x85, 0xFB, 0xB5, 0xC8, 0x71, 0x19, 0x2E, 0x4E, 0xE1,
-	0x63, 0x6D, 0xA4, 0x71, 0x81, 0xBF, 0xC7, 0x8D, 0x87, 0xB1, 0x05, 0x36,
-	0x8E, 0x4B, 0x7C, 0x9E, 0x70, 0x5C, 0x63, 0x2E, 0x24, 0xC3, 0x30, 0x70,
-	0xFE, 0xFC, 0xF9, 0x4B, 0x0D, 0x0D, 0x0D, 0xEF, 0xD7, 0xD5, 0xD5, 0xFD,
-	0xE9, 0xCC, 0x99, 0x33, 0xA7, 0x33, 0x32, 0x32, 0xA4, 0x5B, 0xE9, 0x33,
-	0xBD, 0x65, 0x7B, 0x67, 0xE1, 0x60, 0xD1, 0x6A, 0xB5, 0x92, 0x5E, 0xAF,
-	0xAF, 0xBC, 0x70, 0xE1, 0xC2, 0xA5, 0xBA, 0xBA, 0xBA, 0x4B, 0xB3, 0x66,
-	0xCD, 0x7A, 0xA4, 0xB8, 0xB8, 0x78, 0x4A, 0x5C, 0x5C, 0x1C, 0x87, 0xAF,
-	0x23, 0x05, 0x86, 0x4C, 0x9C, 0x24, 0x97, 0x6A, 0x08, 0x79, 0x53, 0x87,
-	0xBB, 0xC1, 0xE1, 0x02, 0x33, 0x1C, 0x23, 0x0D, 0x90, 0xE1, 0x8E, 0x1B,
-	0x1E, 0xD9, 0x09, 0x87, 0x14, 0x5B, 0xDC, 0xBC, 0x13, 0x3F, 0x0B, 0x96,
-	0x62, 0x90, 0x8E, 0xD3, 0x81, 0x81, 0x81, 0xC0, 0xD9, 0xB3, 0x67, 0x4F,
-	0xB5, 0xB7, 0xB7, 0x7F, 0xF9, 0xD5, 0x57, 0x5F, 0x7D, 0xD6, 0xDC, 0xDC,
-	0x5C, 0x73, 0xDF, 0x7D, 0xF7, 0xD1, 0xE5, 0xDF, 0xB7, 0x80, 0xD1, 0x68,
-	0x84, 0x53, 0xA7, 0x4E, 0x55, 0x6F, 0xDF, 0xBE, 0xBD, 0x15, 0x00, 0x4E,
-	0x37, 0x36, 0x36, 0xDE, 0x3B, 0x69, 0xD2, 0xA4, 0xE9, 0x79, 0x79, 0x79,
-	0x39, 0x72, 0xB9, 0x3C, 0x74, 0xFF, 0xC8, 0x4D, 0x19, 0x70, 0xF9, 0x38,
-	0xD2, 0xC4, 0x18, 0x4E, 0xF8, 0x38, 0x21, 0x73, 0x9F, 0x86, 0xE3, 0x6A,
-	0x63, 0x90, 0xF4, 0xC1, 0x86, 0x1F, 0x33, 0x3C, 0xF2, 0x48, 0x4E, 0xF0,
-	0x64, 0x1D, 0x24, 0xFE, 0x0E, 0x5F, 0x87, 0x3E, 0xBB, 0x9E, 0x9E, 0x1E,
-	0x4F, 0x45, 0x45, 0xC5, 0xE1, 0x9A, 0x9A, 0x9A, 0x8F, 0xB5, 0x5A, 0xED,
-	0xA7, 0x3A, 0x9D, 0xAE, 0x43, 0xAB, 0xD5, 0x0E, 0xA9, 0x2A, 0xB9, 0x15,
-	0xDC, 0x36, 0x9B, 0xFD, 0x19, 0x0C, 0x86, 0xBE, 0xBD, 0x7B, 0xF7, 0xBE,
-	0xD2, 0xD4, 0xD4, 0x54, 0xF7, 0xE8, 0xA3, 0x8F, 0x3E, 0x90, 0x92, 0x92,
-	0x32, 0x3F, 0x2E, 0x2E, 0xAE, 0xC0, 0x6C, 0x36, 0x33, 0xE1, 0xCD, 0xC1,
-	0x00, 0xAE, 0x98, 0xD5, 0x64, 0x64, 0x0F, 0x00, 0x86, 0x15, 0xB3, 0x6B,
-	0x09, 0xD0, 0xF5, 0x42, 0x46, 0x6D, 0xC2, 0x9D, 0xF1, 0x18, 0xC5, 0x41,
-	0x5F, 0x05, 0xC0, 0xE5, 0x19, 0x0E, 0x67, 0x74, 0x4C, 0x98, 0xC5, 0x12,
-	0x08, 0x9B, 0xCD, 0x16, 0x18, 0x18, 0x18, 0x68, 0xEC, 0xEE, 0xEE, 0x3E,
-	0xF8, 0xE7, 0x3F, 0xFF, 0xF9, 0x83, 0xC4, 0xC4, 0xC4, 0x3D, 0x16, 0x8B,
-	0x45, 0xE8, 0xEA, 0xFA, 0x56, 0x3B, 0x93, 0xDC, 0xD5, 0xE0, 0x32, 0xD1,
-	0x62, 0xB1, 0x0C, 0x5A, 0xAD, 0xD6, 0x0F, 0x5F, 0x7E, 0xF9, 0xE5, 0xA3,
-	0xE3, 0xC6, 0x8D, 0x5B, 0xBD, 0x7E, 0xFD, 0xFA, 0x0D, 0x85, 0x85, 0x85,
-	0x13, 0x63, 0x62, 0x62, 0x2C, 0x98, 0xF0, 0x8C, 0xF7, 0x32, 0x3C, 0x05,
-	0x85, 0x14, 0x2C, 0x80, 0x6F, 0x4E, 0x6E, 0x37, 0xD3, 0x37, 0x3B, 0x9C,
-	0x68, 0x01, 0x5C, 0x89, 0xFE, 0xE1, 0x16, 0x69, 0x58, 0x94, 0x8F, 0x79,
-	0x56, 0xC1, 0xB4, 0x23, 0x00, 0x00, 0xB0, 0x5A, 0xAD, 0x81, 0xFE, 0xFE,
-	0xFE, 0xF3, 0xAD, 0xAD, 0xAD, 0x3B, 0xDE, 0x78, 0xE3, 0x8D, 0xF7, 0xE4,
-	0x72, 0xF9, 0xD1, 0x65, 0xCB, 0x96, 0x49, 0x76, 0xBB, 0x7D, 0x4C, 0xCF,
-	0xF7, 0x7A, 0xB9, 0x6D, 0x04, 0x0B, 0x00, 0x80, 0x65, 0x59, 0xBF, 0x46,
-	0xA3, 0xD9, 0x3B, 0x30, 0x30, 0x70, 0x74, 0xEB, 0xD6, 0xAD, 0xF3, 0x57,
-	0xAC, 0x58, 0xF1, 0xFD, 0xC9, 0x93, 0x27, 0xCF, 0x92, 0xCB, 0xE5, 0x26,
-	0x8D, 0x46, 0xC3, 0x06, 0x5F, 0x13, 0x4A, 0x3B, 0x40, 0xEB, 0x65, 0xB8,
-	0x4A, 0x73, 0x72, 0x8D, 0x3F, 0xD6, 0x3E, 0x08, 0x80, 0xA1, 0x83, 0x2F,
-	0xBC, 0x7E, 0x0C, 0xAD, 0x27, 0x4C, 0xB8, 0x13, 0xC5, 0xCB, 0x9B, 0x70,
-	0x60, 0x89, 0x03, 0xFE, 0x8D, 0x56, 0xAB, 0x05, 0x8F, 0xC7, 0x03, 0xDD,
-	0xDD, 0xDD, 0xFD, 0x07, 0x0F, 0x1E, 0xDC, 0x7B, 0xE1, 0xC2, 0x85, 0x37,
-	0x66, 0xCF, 0x9E, 0xBD, 0x4B, 0xAD, 0x56, 0x7B, 0xBF, 0xAD, 0xBC, 0x16,
-	0xCA, 0xF0, 0x28, 0x95, 0x4A, 0x10, 0x04, 0xA1, 0xED, 0x93, 0x4F, 0x3E,
-	0x79, 0xEB, 0xD4, 0xA9, 0x53, 0x7B, 0x9F, 0x78, 0xE2, 0x89, 0x07, 0x97,
-	0x2F, 0x5F, 0xBE, 0x51, 0xAF, 0xD7, 0xA7, 0xC7, 0xC4, 0xC4, 0xE8, 0x3C,
-	0x1E, 0x0F, 0x30, 0x0C, 0x03, 0x3A, 0x9D, 0x6E, 0x88, 0x08, 0x0C, 0x17,
-	0x85, 0x26, 0xC5, 0x63, 0x24, 0x4B, 0x7C, 0x2C, 0x20, 0x57, 0x23, 0xE4,
-	0x98, 0x47, 0x51, 0xC5, 0x76, 0x4C, 0xA4, 0x6B, 0x02, 0x4B, 0xBB, 0x78,
-	0x9E, 0x97, 0xBC, 0x5E, 0x6F, 0xFF, 0xA9, 0x53, 0xA7, 0x0E, 0x6C, 0xDF,
-	0xBE, 0xFD, 0xD5, 0xA9, 0x53, 0xA7, 0xEE, 0xD1, 0x68, 0x34, 0x9E, 0xDB,
-	0xAD, 0x1D, 0xD1, 0x6D, 0x25, 0x58, 0x44, 0xB2, 0x9C, 0xD7, 0xEB, 0xF5,
-	0x6E, 0x17, 0x45, 0xB1, 0xE2, 0xD4, 0xA9, 0x53, 0x4B, 0x6C, 0x36, 0xDB,
-	0x13, 0xD3, 0xA6, 0x4D, 0x9B, 0x96, 0x90, 0x90, 0x60, 0xE0, 0x38, 0x2E,
-	0xD4, 0xC2, 0x03, 0x2F, 0x3C, 0x43, 0x24, 0xE2, 0x21, 0xE1, 0x0E, 0xF2,
-	0x48, 0xB7, 0xD8, 0x8E, 0x14, 0x5C, 0x0E, 0x90, 0x16, 0x15, 0xFE, 0x9C,
-	0x61, 0x98, 0xD0, 0x26, 0x94, 0xA4, 0x23, 0x1D, 0x00, 0x86, 0x08, 0xAB,
-	0xCD, 0x66, 0x1B, 0x3C, 0x7B, 0xF6, 0xEC, 0x99, 0x77, 0xDF, 0x7D, 0xF7,
-	0xAD, 0x13, 0x27, 0x4E, 0x7C, 0x3A, 0x77, 0xEE, 0xDC, 0x01, 0x85, 0x42,
-	0x11, 0x08, 0xCF, 0xC7, 0xA1, 0x7C, 0xFB, 0xE0, 0x58, 0xF4, 0xF9, 0x7C,
-	0x1E, 0xA7, 0xD3, 0x59, 0x2F, 0x93, 0xC9, 0x7E, 0x7D, 0xEA, 0xD4, 0xA9,
-	0x4F, 0xEA, 0xEB, 0xEB, 0xEF, 0x59, 0xB3, 0x66, 0xCD, 0xFD, 0xF9, 0xF9,
-	0xF9, 0x45, 0x1C, 0xC7, 0xB1, 0x38, 0xCE, 0x46, 0x4A, 0x31, 0x20, 0xEF,
-	0x23, 0x39, 0xB1, 0x8E, 0xD5, 0x12, 0x1F, 0x33, 0xD1, 0xC9, 0xE0, 0x51,
-	0x78, 0xB4, 0x1B, 0xDF, 0x8F, 0x1C, 0xB3, 0x1C, 0xC7, 0x85, 0xF2, 0xB8,
-	0x06, 0x07, 0x07, 0xDD, 0xC7, 0x8E, 0x1D, 0x3B, 0xA2, 0x50, 0x28, 0x5E,
-	0x13, 0x45, 0x71, 0x97, 0xD7, 0xEB, 0xED, 0x97, 0x24, 0x29, 0x80, 0xCB,
-	0xC7, 0xDB, 0x89, 0xDB, 0x4A, 0xB0, 0x90, 0xE0, 0x05, 0x15, 0xE5, 0x72,
-	0x79, 0x8F, 0xCF, 0xE7, 0xDB, 0xBC, 0x6D, 0xDB, 0xB6, 0x9A, 0x6D, 0xDB,
-	0xB6, 0x95, 0x2F, 0x5A, 0xB4, 0x68, 0xF9, 0xAC, 0x59, 0xB3, 0x16, 0xA4,
-	0xA4, 0xA4, 0x58, 0x30, 0x37, 0x09, 0x85, 0x2B, 0x3C, 0x67, 0x05, 0x1F,
-	0x7A, 0x86, 0xB9, 0xB2, 0x87, 0x1A, 0xFE, 0x7E, 0x2C, 0x08, 0xEF, 0xAC,
-	0x40, 0x56, 0xAF, 0x93, 0x02, 0xC5, 0x71, 0x5C, 0xC8, 0xDA, 0x52, 0xA9,
-	0x54, 0x20, 0x97, 0xCB, 0xA1, 0xBF, 0xBF, 0xDF, 0xB9, 0x6F, 0xDF, 0xBE,
-	0xAF, 0x0E, 0x1F, 0x3E, 0xFC, 0x41, 0x7C, 0x7C, 0x7C, 0xFD, 0xC0, 0xC0,
-	0xC0, 0x85, 0xEE, 0xEE, 0x6E, 0xF7, 0x68, 0x4A, 0x91, 0x28, 0xDF, 0x0E,
-	0xE8, 0xD3, 0x89, 0x8B, 0x8B, 0x73, 0x4C, 0x99, 0x32, 0xA5, 0x5A, 0x10,
-	0x84, 0x8E, 0x7F, 0xFA, 0xA7, 0x7F, 0x3A, 0x59, 0x56, 0x56, 0xB6, 0x70,
-	0xDD, 0xBA, 0x75, 0xF7, 0x16, 0x16, 0x16, 0xE6, 0x00, 0x5C, 0x2E, 0x44,
-	0xC7, 0xCC, 0x74, 0xD2, 0xC7, 0x83, 0xD6, 0x0D, 0x0A, 0xC9, 0x58, 0x5B,
-	0xCE, 0x58, 0xFD, 0x00, 0x30, 0x34, 0x11, 0x9A, 0xCC, 0x2F, 0xC4, 0xEF,
-	0x71, 0x82, 0x47, 0xBA, 0xBA, 0xBA, 0x06, 0x8E, 0x1E, 0x3D, 0xBA, 0xFB,
-	0xE8, 0xD1, 0xA3, 0x5F, 0x08, 0x82, 0x70, 0x72, 0xD9, 0xB2, 0x65, 0xE7,
-	0x95, 0x4A, 0xA5, 0x40, 0x26, 0x4C, 0xDF, 0x6E, 0xDC, 0x96, 0x82, 0x45,
-	0xA2, 0x52, 0xA9, 0x7C, 0xBD, 0xBD, 0xBD, 0xB5, 0xED, 0xED, 0xED, 0x67,
-	0x39, 0x8E, 0x3B, 0xBE, 0x6F, 0xDF, 0xBE, 0xCF, 0x27, 0x4D, 0x9A, 0xB4,
-	0x78, 0xE6, 0xCC, 0x99, 0xF3, 0xF3, 0xF2, 0xF2, 0xD2, 0xC9, 0xED, 0xAE,
-	0xC9, 0x9B, 0x11, 0xBE, 0xCD, 0xD3, 0x58, 0x6F, 0x4A, 0x80, 0xE2, 0x44,
-	0x0A, 0x23, 0x2E, 0x57, 0x49, 0x6B, 0xCA, 0xE3, 0xF1, 0x80, 0x46, 0xA3,
-	0x01, 0x8E, 0xE3, 0xE0, 0xDC, 0xB9, 0x73, 0xDD, 0x07, 0x0E, 0x1C, 0xF8,
-	0xB2, 0xB1, 0xB1, 0x71, 0xBF, 0x24, 0x49, 0x95, 0x95, 0x95, 0x95, 0xB5,
-	0x93, 0x26, 0x4D, 0x02, 0x83, 0xC1, 0x70, 0xD5, 0x5D, 0x8A, 0x28, 0xB7,
-	0x16, 0xF4, 0x6D, 0xA5, 0xA5, 0xA5, 0x41, 0x41, 0x41, 0x41, 0x6F, 0x4D,
-	0x4D, 0xCD, 0x56, 0x8F, 0xC7, 0x53, 0x65, 0xB3, 0xD9, 0xF6, 0x65, 0x64,
-	0x64, 0xCC, 0x2F, 0x2C, 0x2C, 0x9C, 0x57, 0x5C, 0x5C, 0x5C, 0x16, 0x1F,
-	0x1F, 0xCF, 0x02, 0x0C, 0xDD, 0x39, 0xE6, 0x6A, 0x41, 0xA0, 0xB1, 0x80,
-	0x8C, 0x5A, 0x62, 0xB4, 0x12, 0xAD, 0x43, 0xF4, 0xB1, 0x91, 0xEF, 0xEF,
-	0xF7, 0xFB, 0xE1, 0xC8, 0x91, 0x23, 0xE7, 0xEC, 0x76, 0xFB, 0x9E, 0xA4,
-	0xA4, 0xA4, 0x3D, 0x17, 0x2E, 0x5C, 0xA8, 0x3B, 0x7A, 0xF4, 0x68, 0x6D,
-	0x7A, 0x7A, 0x3A, 0xA8, 0xD5, 0xEA, 0x1B, 0xEE, 0xB9, 0x7E, 0xB3, 0xB9,
-	0xED, 0x05, 0x8B, 0x70, 0x84, 0xFA, 0x05, 0x41, 0xA8, 0xDD, 0xBA, 0x75,
-	0x6B, 0x6D, 0x7B, 0x7B, 0xFB, 0xD1, 0xB4, 0xB4, 0xB4, 0x7D, 0x76, 0xBB,
-	0xBD, 0xAC, 0xBF, 0xBF, 0x7F, 0x5C, 0x5E, 0x5E, 0xDE, 0xB8, 0xFC, 0xFC,
-	0xFC, 0xC4, 0xF0, 0xBF, 0x1B, 0xCE, 0xC7, 0x34, 0x56, 0x90, 0xF9, 0x5A,
-	0x64, 0x99, 0x44, 0x78, 0x7E, 0x4A, 0x4B, 0x4B, 0x0B, 0xDF, 0xD8, 0xD8,
-	0x78, 0x28, 0x3F, 0x3F, 0xBF, 0x61, 0x60, 0x60, 0xA0, 0xF6, 0x93, 0x4F,
-	0x3E, 0xD9, 0xDA, 0xD8, 0xD8, 0xD8, 0xBA, 0x66, 0xCD, 0x1A, 0xB0, 0x58,
-	0x2C, 0xC0, 0x71, 0x1C, 0x38, 0x9D, 0xCE, 0x31, 0x3D, 0x37, 0xCA, 0xD8,
-	0x83, 0x0F, 0x32, 0xCF, 0xF3, 0x60, 0x34, 0x1A, 0x41, 0xAB, 0xD5, 0x76,
-	0x9C, 0x3A, 0x75, 0xAA, 0xE3, 0xD4, 0xA9, 0x53, 0x87, 0xEE, 0xBD, 0xF7,
-	0xDE, 0x7D, 0x2A, 0x95, 0x6A, 0xFA, 0x99, 0x33, 0x67, 0xE6, 0xE4, 0xE6,
-	0xE6, 0x4E, 0x4E, 0x4C, 0x4C, 0x54, 0x87, 0x8F, 0x03, 0xD2, 0xDA, 0x19,
-	0xCB, 0xC9, 0x73, 0xB8, 0x48, 0xF9, 0x70, 0x59, 0xF0, 0x8D, 0x8D, 0x8D,
-	0xBD, 0x75, 0x75, 0x75, 0x15, 0x46, 0xA3, 0xB1, 0xA6, 0xB5, 0xB5, 0xB5,
-	0xBA, 0xB5, 0xB5, 0x75, 0xFF, 0x9A, 0x35, 0x6B, 0x2E, 0xE9, 0xF5, 0x7A,
-	0xD0, 0xEB, 0xF5, 0xB7, 0xC5, 0x6E, 0xDF, 0x91, 0x70, 0xDB, 0x0B, 0x16,
-	0x82, 0xCB, 0x2F, 0xBD, 0x5E, 0x0F, 0x3A, 0x9D, 0xEE, 0xBC, 0x5E, 0xAF,
-	0x3F, 0x7F, 0xE8, 0xD0, 0x21, 0xC5, 0xFE, 0xFD, 0xFB, 0x27, 0xAD, 0x5C,
-	0xB9, 0x72, 0x5E, 0x4D, 0x4D, 0xCD, 0x54, 0xB3, 0xD9, 0x9C, 0x9E, 0x90,
-	0x90, 0x90, 0x96, 0x96, 0x96, 0x16, 0x6F, 0x34, 0x1A, 0x65, 0x37, 0xD3,
-	0xAC, 0x25, 0xCB, 0x17, 0xC8, 0x19, 0x4D, 0x10, 0x04, 0xE8, 0xEB, 0xEB,
-	0x73, 0x74, 0x76, 0x76, 0x76, 0xDA, 0xED, 0xF6, 0x0E, 0xAF, 0xD7, 0x5B,
-	0xF3, 0xE7, 0x3F, 0xFF, 0xF9, 0xDD, 0x95, 0x2B, 0x57, 0x1E, 0x9B, 0x30,
-	0x61, 0x02, 0xE0, 0x00, 0xB9, 0xD5, 0xE1, 0x61, 0xCA, 0x8D, 0xA3, 0x56,
-	0xAB, 0x41, 0x2E, 0x97, 0x0F, 0x98, 0xCD, 0xE6, 0xCF, 0x5B, 0x5B, 0x5B,
-	0xBF, 0xD8, 0xB1, 0x63, 0xC7, 0xBC, 0xF5, 0xEB, 0xD7, 0xAF, 0xAD, 0xAF,
-	0xAF, 0x2F, 0xE0, 0x38, 0x2E, 0x2B, 0x2B, 0x2B, 0x2B, 0x3D, 0x31, 0x31,
-	0x51, 0x8B, 0xBE, 0x4C, 0x36, 0xD8, 0x4B, 0x8A, 0xEC, 0x72, 0x7A, 0xA3,
-	0x90, 0xD6, 0x3D, 0x29, 0x52, 0xFD, 0xFD, 0xFD, 0x42, 0x6F, 0x6F, 0x6F,
-	0x57, 0x67, 0x67, 0xE7, 0xC5, 0xC1, 0xC1, 0xC1, 0xF6, 0x81, 0x81, 0x81,
-	0xEA, 0x0F, 0x3F, 0xFC, 0x70, 0xCB, 0xF4, 0xE9, 0xD3, 0xAB, 0x27, 0x4E,
-	0x9C, 0x08, 0x6A, 0xB5, 0x7A, 0xC4, 0xD4, 0x8B, 0xDB, 0x99, 0xA8, 0x11,
-	0xAC, 0x70, 0x82, 0x33, 0x95, 0x60, 0x32, 0x99, 0x8E, 0x75, 0x77, 0x77,
-	0x1F, 0x7B, 0xF9, 0xE5, 0x97, 0x0D, 0x71, 0x71, 0x71, 0xE3, 0x16, 0x2E,
-	0x5C, 0x38, 0x7B, 0xE2, 0xC4, 0x89, 0xE5, 0xC9, 0xC9, 0xC9, 0xD9, 0x46,
-	0xA3, 0x31, 0x5E, 0xAB, 0xD5, 0xEA, 0x15, 0x0A, 0x85, 0x9A, 0x65, 0x59,
-	0x4E, 0xAB, 0xD5, 0x32, 0x63, 0x39, 0x50, 0xF0, 0x3C, 0x9C, 0x4E, 0xA7,
-	0xCF, 0xE3, 0xF1, 0xB8, 0x5C, 0x2E, 0xD7, 0xA0, 0xD3, 0xE9, 0xBC, 0x54,
-	0x5F, 0x5F, 0x7F, 0x6A, 0xDB, 0xB6, 0x6D, 0xFB, 0xED, 0x76, 0x7B, 0xF5,
-	0x86, 0x0D, 0x1B, 0x2E, 0xEA, 0xF5, 0xFA, 0x40, 0xA4, 0xBD, 0xB3, 0x28,
-	0xD1, 0x47, 0x70, 0x19, 0x26, 0x69, 0x34, 0x9A, 0xBD, 0xA2, 0x28, 0xEE,
-	0xDB, 0xBC, 0x79, 0x73, 0x3A, 0xCF, 0xF3, 0xD3, 0xD6, 0xAE, 0x5D, 0x3B,
-	0x37, 0x3F, 0x3F, 0xBF, 0x58, 0xAD, 0x56, 0xA7, 0x1A, 0x8D, 0xC6, 0x38,
-	0x8E, 0xE3, 0x74, 0x06, 0x83, 0x61, 0x4C, 0x27, 0xD2, 0xE0, 0xF8, 0x93,
-	0x44, 0x51, 0xF4, 0xF9, 0x7C, 0x3E, 0x37, 0xCF, 0xF3, 0x8E, 0x40, 0x20,
-	0xD0, 0x75, 0xF1, 0xE2, 0xC5, 0xF3, 0xFB, 0xF7, 0xEF, 0x3F, 0xBE, 0x7B,
-	0xF7, 0xEE, 0x83, 0x56, 0xAB, 0xB5, 0xEE, 0xBE, 0xFB, 0xEE, 0xF3, 0x9A,
-	0x4C, 0xA6, 0x6F, 0xF8, 0xB1, 0xA2, 0x8D, 0xA8, 0x15, 0x2C, 0x80, 0xA1,
-	0xE5, 0x32, 0x3C, 0xCF, 0xDB, 0x7D, 0x3E, 0xDF, 0x51, 0x00, 0xA8, 0x3E,
-	0x79, 0xF2, 0xE4, 0xEB, 0x15, 0x15, 0x15, 0x66, 0x86, 0x61, 0x0A, 0x8A,
-	0x8B, 0x8B, 0x4B, 0x0A, 0x0A, 0x0A, 0xC6, 0xA5, 0xA6, 0xA6, 0xA6, 0x27,
-	0x25, 0x25, 0x25, 0x99, 0x4C, 0xA6, 0x18, 0x8E, 0xE3, 0x38, 0x95, 0x4A,
-	0xA5, 0x96, 0xC9, 0x64, 0x32, 0xE6, 0xF2, 0xE8, 0x61, 0x24, 0x49, 0x62,
-	0xC8, 0x94, 0x03, 0xF4, 0x0B, 0xA0, 0x65, 0x17, 0xFC, 0x9D, 0x24, 0x49,
-	0x92, 0x28, 0x49, 0x52, 0x40, 0x92, 0x24, 0x89, 0xE7, 0x79, 0xBE, 0xB5,
-	0xB5, 0xB5, 0xAD, 0xBE, 0xBE, 0xBE, 0xBA, 0xBA, 0xBA, 0xFA, 0xE4, 0xE9,
-	0xD3, 0xA7, 0x6B, 0xE7, 0xCE, 0x9D, 0x7B, 0x3E, 0x27, 0x27, 0x67, 0x20,
-	0xD8, 0x33, 0xDE, 0x1F, 0xF6, 0xF7, 0x94, 0x3B, 0x14, 0xA2, 0x94, 0x46,
-	0x12, 0x04, 0xA1, 0xD5, 0xE7, 0xF3, 0x75, 0xA8, 0x54, 0xAA, 0xAF, 0x2B,
-	0x2B, 0x2B, 0x75, 0x1F, 0x7E, 0xF8, 0x61, 0x41, 0x69, 0x69, 0xE9, 0xF4,
-	0x59, 0xB3, 0x66, 0xCD, 0xC8, 0xCB, 0xCB, 0x2B, 0xB0, 0x58, 0x2C, 0x16,
-	0xB5, 0x5A, 0xAD, 0x64, 0x59, 0x56, 0xC1, 0xB2, 0xAC, 0x9C, 0x61, 0x18,
-	0x96, 0x9C, 0x00, 0xC3, 0x6B, 0x4B, 0x83, 0xCB, 0x3E, 0xE9, 0xF2, 0xAF,
-	0x25, 0x49, 0x92, 0xA4, 0x80, 0xCF, 0xE7, 0xE3, 0x05, 0x41, 0xE0, 0xAD,
-	0x56, 0x6B, 0x7F, 0x7B, 0x7B, 0x7B, 0xFB, 0xA5, 0x4B, 0x97, 0x2E, 0xD5,
-	0xD6, 0xD6, 0x9E, 0x39, 0x7F, 0xFE, 0x7C, 0xCD, 0xFD, 0xF7, 0xDF, 0x5F,
-	0x9F, 0x95, 0x95, 0x65, 0x17, 0x04, 0xC1, 0xCB, 0xF3, 0xBC, 0x07, 0x03,
-	0x52, 0x77, 0xC2, 0x38, 0x8C, 0x6A, 0xC1, 0x42, 0x30, 0x4C, 0xCB, 0x71,
-	0x1C, 0x28, 0x14, 0x0A, 0x8F, 0xD3, 0xE9, 0xF4, 0x74, 0x74, 0x74, 0x0C,
-	0x04, 0x02, 0x81, 0x26, 0x8B, 0xC5, 0x72, 0x28, 0x29, 0x29, 0xC9, 0x20,
-	0x08, 0x82, 0x66, 0xCB, 0x96, 0x2D, 0xA6, 0x13, 0x27, 0x4E, 0xC4, 0x19,
-	0x8D, 0xC6, 0x98, 0xB8, 0xB8, 0xB8, 0xA4, 0x98, 0x98, 0x98, 0x04, 0x8B,
-	0xC5, 0x12, 0x6B, 0x30, 0x18, 0x62, 0xF4, 0x7A, 0xBD, 0x51, 0xAB, 0xD5,
-	0xEA, 0x94, 0x4A, 0x25, 0xA7, 0x54, 0x2A, 0x65, 0x32, 0x99, 0x4C, 0xC6,
-	0xB2, 0x2C, 0x2B, 0x49, 0x12, 0xC3, 0xF3, 0xBC, 0xCF, 0x66, 0xB3, 0x0D,
-	0x76, 0x76, 0x76, 0xB6, 0x75, 0x74, 0x74, 0x5C, 0xB4, 0x5A, 0xAD, 0xDD,
-	0x56, 0xAB, 0xF5, 0x52, 0x67, 0x67, 0x67, 0xA7, 0x52, 0xA9, 0xB4, 0x95,
-	0x97, 0x97, 0xF7, 0x0F, 0x0C, 0x0C, 0x58, 0x5B, 0x5B, 0x5B, 0xED, 0x0E,
-	0x87, 0x23, 0x14, 0x59, 0xA2, 0x51, 0xBF, 0xBB, 0x93, 0x60, 0x83, 0x45,
-	0x41, 0xA1, 0x50, 0xD8, 0x3C, 0x1E, 0x8F, 0xAD, 0xB9, 0xB9, 0xB9, 0x3D,
-	0x3D, 0x3D, 0xBD, 0x22, 0x3B, 0x3B, 0xFB, 0x83, 0x0F, 0x3F, 0xFC, 0xD0,
-	0x78, 0xF0, 0xE0, 0xC1, 0xE4, 0xA2, 0xA2, 0xA2, 0xF4, 0xB8, 0xB8, 0xB8,
-	0xA4, 0xE4, 0xE4, 0xE4, 0xCC, 0xD4, 0xD4, 0xD4, 0x8C, 0xB8, 0xB8, 0x38,
-	0x8B, 0x5A, 0xAD, 0xD6, 0x00, 0x00, 0xF8, 0x2F, 0x13, 0x10, 0x04, 0xC1,
-	0xCF, 0xF3, 0x3C, 0xEF, 0x72, 0xB9, 0x5C, 0x0E, 0x87, 0x63, 0xD0, 0x6E,
-	0xB7, 0x5B, 0xFB, 0xFA, 0xFA, 0xFA, 0xFA, 0xFB, 0xFB, 0xBB, 0xFB, 0xFB,
-	0xFB, 0xBB, 0xFA, 0xFB, 0xFB, 0xFB, 0xA7, 0x4C, 0x99, 0xD2, 0x33, 0x65,
-	0xCA, 0x94, 0x41, 0xBB, 0xDD, 0xEE, 0xE9, 0xEA, 0xEA, 0xB2, 0x5F, 0xBC,
-	0x78, 0xD1, 0xE6, 0x72, 0xB9, 0x42, 0x49, 0xA2, 0xF8, 0x5C, 0xDC, 0x29,
-	0xE3, 0x90, 0x89, 0x66, 0xF3, 0x90, 0x42, 0xA1, 0xDC, 0x5D, 0xD0, 0x74,
-	0x6A, 0x0A, 0x85, 0x12, 0x35, 0x50, 0xC1, 0xA2, 0x50, 0x28, 0x51, 0x03,
-	0x15, 0x2C, 0x0A, 0x85, 0x12, 0x35, 0x50, 0xC1, 0xA2, 0x50, 0x28, 0x51,
-	0x03, 0x15, 0x2C, 0x0A, 0x85, 0x12, 0x35, 0x50, 0xC1, 0xA2, 0x50, 0x28,
-	0x51, 0x03, 0x15, 0x2C, 0x0A, 0x85, 0x12, 0x35, 0x50, 0xC1, 0xA2, 0x50,
-	0x28, 0x51, 0x03, 0x15, 0x2C, 0x0A, 0x85, 0x12, 0x35, 0x50, 0xC1, 0xA2,
-	0x50, 0x28, 0x51, 0x03, 0x15, 0x2C, 0x0A, 0x85, 0x12, 0x35, 0x50, 0xC1,
-	0xA2, 0x50, 0x28, 0x51, 0x03, 0x15, 0x2C, 0x0A, 0x85, 0x12, 0x35, 0x50,
-	0xC1, 0xA2, 0x50, 0x28, 0x51, 0x03, 0x15, 0x2C, 0x0A, 0x85, 0x12, 0x35,
-	0x50, 0xC1, 0xA2, 0x50, 0x28, 0x51, 0x03, 0x15, 0x2C, 0x0A, 0x85, 0x12,
-	0x35, 0x50, 0xC1, 0xA2, 0x50, 0x28, 0x51, 0x03, 0x15, 0x2C, 0x0A, 0x85,
-	0x12, 0x35, 0x50, 0xC1, 0xA2, 0x50, 0x28, 0x51, 0x03, 0x15, 0x2C, 0x0A,
-	0x85, 0x12, 0x35, 0x50, 0xC1, 0xA2, 0x50, 0x28, 0x51, 0x03, 0x15, 0x2C,
-	0x0A, 0x85, 0x12, 0x35, 0x50, 0xC1, 0xA2, 0x50, 0x28, 0x51, 0x03, 0x15,
-	0x2C, 0x0A, 0x85, 0x12, 0x35, 0x50, 0xC1, 0xA2, 0x50, 0x28, 0x51, 0x03,
-	0x15, 0x2C, 0x0A, 0x85, 0x12, 0x35, 0x50, 0xC1, 0xA2, 0x50, 0x28, 0x51,
-	0x03, 0x15, 0x2C, 0x0A, 0x85, 0x12, 0x35, 0x50, 0xC1, 0xA2, 0x50, 0x28,
-	0x51, 0x03, 0x15, 0x2C, 0x0A, 0x85, 0x12, 0x35, 0x50, 0xC1, 0xA2, 0x50,
-	0x28, 0x51, 0x03, 0x15, 0x2C, 0x0A, 0x85, 0x12, 0x35, 0x50, 0xC1, 0xA2,
-	0x50, 0x28, 0x51, 0x03, 0x15, 0x2C, 0x0A, 0x85, 0x12, 0x35, 0x50, 0xC1,
-	0xA2, 0x50, 0x28, 0x51, 0x03, 0x15, 0x2C, 0x0A, 0x85, 0x12, 0x35, 0x50,
-	0xC1, 0xA2, 0x50, 0x28, 0x51, 0x03, 0x15, 0x2C, 0x0A, 0x85, 0x12, 0x35,
-	0x50, 0xC1, 0xA2, 0x50, 0x28, 0x51, 0x03, 0x15, 0x2C, 0x0A, 0x85, 0x12,
-	0x35, 0x50, 0xC1, 0xA2, 0x50, 0x28, 0x51, 0x03, 0x15, 0x2C, 0x0A, 0x85,
-	0x12, 0x35, 0x50, 0xC1, 0xA2, 0x50, 0x28, 0x51, 0x03, 0x15, 0x2C, 0x0A,
-	0x85, 0x12, 0x35, 0x50, 0xC1, 0xA2, 0x50, 0x28, 0x51, 0x03, 0x15, 0x2C,
-	0x0A, 0x85, 0x12, 0x35, 0x50, 0xC1, 0xA2, 0x50, 0x28, 0x51, 0x03, 0x15,
-	0x2C, 0x0A, 0x85, 0x12, 0x35, 0x50, 0xC1, 0xA2, 0x50, 0x28, 0x51, 0x03,
-	0x15, 0x2C, 0x0A, 0x85, 0x12, 0x35, 0x50, 0xC1, 0xA2, 0x50, 0x28, 0x51,
-	0x03, 0x15, 0x2C, 0x0A, 0x85, 0x12, 0x35, 0x50, 0xC1, 0xA2, 0x50, 0x28,
-	0x51, 0x03, 0x15, 0x2C, 0x0A, 0x85, 0x12, 0x35, 0x50, 0xC1, 0xA2, 0x50,
-	0x28, 0x51, 0x03, 0x15, 0x2C, 0x0A, 0x85, 0x12, 0x35, 0x50, 0xC1, 0xA2,
-	0x50, 0x28, 0x51, 0x03, 0x15, 0x2C, 0x0A, 0x85, 0x12, 0x35, 0x50, 0xC1,
-	0xA2, 0x50, 0x28, 0x51, 0x03, 0x15, 0x2C, 0x0A, 0x85, 0x12, 0x35, 0x50,
-	0xC1, 0xA2, 0x50, 0x28, 0x51, 0x03, 0x15, 0x2C, 0x0A, 0x85, 0x12, 0x35,
-	0x50, 0xC1, 0xA2, 0x50, 0x28, 0x51, 0x03, 0x15, 0x2C, 0x0A, 0x85, 0x12,
-	0x35, 0x50, 0xC1, 0xA2, 0x50, 0x28, 0x51, 0x03, 0x15, 0x2C, 0x0A, 0x85,
-	0x12, 0x35, 0x50, 0xC1, 0xA2, 0x50, 0x28, 0x51, 0x03, 0x15, 0x2C, 0x0A,
-	0x85, 0x12, 0x35, 0x50, 0xC1, 0xA2, 0x50, 0x28, 0x51, 0x03, 0x15, 0x2C,
-	0x0A, 0x85, 0x12, 0x35, 0x50, 0xC1, 0xA2, 0x50, 0x28, 0x51, 0x03, 0x15,
-	0x2C, 0x0A, 0x85, 0x12, 0x35, 0x50, 0xC1, 0xA2, 0x50, 0x28, 0x51, 0x03,
-	0x15, 0x2C, 0x0A, 0x85, 0x12, 0x35, 0x50, 0xC1, 0xA2, 0x50, 0x28, 0x51,
-	0x03, 0x15, 0x2C, 0x0A, 0x85, 0x12, 0x35, 0x50, 0xC1, 0xA2, 0x50, 0x28,
-	0x51, 0x03, 0x15, 0x2C, 0x0A, 0x85, 0x12, 0x35, 0x50, 0xC1, 0xA2, 0x50,
-	0x28, 0x51, 0x03, 0x15, 0x2C, 0x0A, 0x85, 0x12, 0x35, 0x50, 0xC1, 0xA2,
-	0x50, 0x28, 0x51, 0x03, 0x15, 0x2C, 0x0A, 0x85, 0x12, 0x35, 0x50, 0xC1,
-	0xA2, 0x50, 0x28, 0x51, 0x03, 0x15, 0x2C, 0x0A, 0x85, 0x12, 0x35, 0xFC,
-	0xFF, 0x2B, 0x8E, 0xF3, 0x95, 0xBF, 0x94, 0xC2, 0x85, 0x00, 0x00, 0x00,
-	0x00, 0x49, 0x45, 0x4E, 0x44, 0xAE, 0x42, 0x60, 0x82
-};
@@ -1,1066 +0,0 @@
-
-inline unsigned char g_BackArrow[12746] = {
-	0x89, 0x50, 0x4E, 0x47, 0x0D, 0x0A, 0x1A, 0x0A, 0x00, 0x00, 0x00, 0x0D,
-	0x49, 0x48, 0x44, 0x52, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00,
-	0x08, 0x06, 0x00, 0x00, 0x00, 0xF4, 0x78, 0xD4, 0xFA, 0x00, 0x00, 0x20,
-	0x00, 0x49, 0x44, 0x41, 0x54, 0x78, 0x5E, 0xED, 0xDD, 0x3D, 0xAC, 0x5D,
-	0xD7, 0x99, 0x1E, 0x60, 0x4A, 0x98, 0x4A, 0x6A, 0x5C, 0x19, 0xFA, 0xB1,
-	0x01, 0x03, 0xEA, 0x44, 0x20, 0x45, 0x24, 0x4D, 0x9A, 0x24, 0xA2, 0x30,
-	0x4D, 0x3A, 0x49, 0x9D, 0x08, 0x17, 0xA9, 0x02, 0x04, 0x70, 0x11, 0x49,
-	0xC4, 0x54, 0xAE, 0x53, 0x0D, 0x28, 0x71, 0x8A, 0x00, 0x01, 0x52, 0x1B,
-	0xE4, 0x54, 0xA2, 0xA6, 0x4A, 0x23, 0x48, 0xC2, 0x4C, 0x91, 0xD8, 0xD4,
-	0x14, 0x03, 0x88, 0xC5, 0x00, 0x02, 0x0C, 0xD8, 0x96, 0x89, 0xA9, 0xDC,
-	0x8C, 0x52, 0x24, 0x10, 0xF3, 0xED, 0xEB, 0x73, 0xE9, 0x4B, 0xF2, 0xDE,
-	0x7B, 0xF6, 0xEF, 0xDA, 0x6B, 0xAD, 0xEF, 0x11, 0x70, 0x70, 0x3D, 0xC3,
-	0xBD, 0xD7, 0xCF, 0xF3, 0xAD, 0x7B, 0xD7, 0x7B, 0xF6, 0xD9, 0xE7, 0x9C,
-	0x67, 0xAE, 0xF8, 0x8F, 0x00, 0x01, 0x02, 0x04, 0x08, 0x10, 0x48, 0x27,
-	0xF0, 0x4C, 0xBA, 0x19, 0x9B, 0x30, 0x01, 0x02, 0x04, 0x08, 0x10, 0x20,
-	0x70, 0x45, 0x00, 0xB0, 0x08, 0x08, 0x10, 0x20, 0x40, 0x80, 0x40, 0x42,
-	0x01, 0x01, 0x20, 0x61, 0xD1, 0x4D, 0x99, 0x00, 0x01, 0x02, 0x04, 0x08,
-	0x08, 0x00, 0xD6, 0x00, 0x01, 0x02, 0x04, 0x08, 0x10, 0x48, 0x28, 0x20,
-	0x00, 0x24, 0x2C, 0xBA, 0x29, 0x13, 0x20, 0x40, 0x80, 0x00, 0x01, 0x01,
-	0xC0, 0x1A, 0x20, 0x40, 0x80, 0x00, 0x01, 0x02, 0x09, 0x05, 0x04, 0x80,
-	0x84, 0x45, 0x37, 0x65, 0x02, 0x04, 0x08, 0x10, 0x20, 0x20, 0x00, 0x58,
-	0x03, 0x04, 0x08, 0x10, 0x20, 0x40, 0x20, 0xA1, 0x80, 0x00, 0x90, 0xB0,
-	0xE8, 0xA6, 0x4C, 0x80, 0x00, 0x01, 0x02, 0x04, 0x04, 0x00, 0x6B, 0x80,
-	0x00, 0x01, 0x02, 0x04, 0x08, 0x24, 0x14, 0x10, 0x00, 0x12, 0x16, 0xDD,
-	0x94, 0x09, 0x10, 0x20, 0x40, 0x80, 0x80, 0x00, 0x60, 0x0D, 0x10, 0x20,
-	0x40, 0x80, 0x00, 0x81, 0x84, 0x02, 0x02, 0x40, 0xC2, 0xA2, 0x9B, 0x32,
-	0x01, 0x02, 0x04, 0x08, 0x10, 0x10, 0x00, 0xAC, 0x01, 0x02, 0x04, 0x08,
-	0x10, 0x20, 0x90, 0x50, 0x40, 0x00, 0x48, 0x58, 0x74, 0x53, 0x26, 0x40,
-	0x80, 0x00, 0x01, 0x02, 0x02, 0x80, 0x35, 0x40, 0x80, 0x00, 0x01, 0x02,
-	0x04, 0x12, 0x0A, 0x08, 0x00, 0x09, 0x8B, 0x6E, 0xCA, 0x04, 0x08, 0x10,
-	0x20, 0x40, 0x40, 0x00, 0xB0, 0x06, 0x08, 0x10, 0x20, 0x40, 0x80, 0x40,
-	0x42, 0x01, 0x01, 0x20, 0x61, 0xD1, 0x4D, 0x99, 0x00, 0x01, 0x02, 0x04,
-	0x08, 0x08, 0x00, 0xD6, 0x00, 0x01, 0x02, 0x04, 0x08, 0x10, 0x48, 0x28,
-	0x20, 0x00, 0x24, 0x2C, 0xBA, 0x29, 0x13, 0x20, 0x40, 0x80, 0x00, 0x01,
-	0x01, 0xC0, 0x1A, 0x20, 0x40, 0x80, 0x00, 0x01, 0x02, 0x09, 0x05, 0x04,
-	0x80, 0x84, 0x45, 0x37, 0x65, 0x02, 0x04, 0x08, 0x10, 0x20, 0x20, 0x00,
-	0x58, 0x03, 0x04, 0x08, 0x10, 0x20, 0x40, 0x20, 0xA1, 0x80, 0x00, 0x90,
-	0xB0, 0xE8, 0xA6, 0x4C, 0x80, 0x00, 0x01, 0x02, 0x04, 0x04, 0x00, 0x6B,
-	0x80, 0x00, 0x01, 0x02, 0x04, 0x08, 0x24, 0x14, 0x10, 0x00, 0x12, 0x16,
-	0xDD, 0x94, 0x09, 0x10, 0x20, 0x40, 0x80, 0x80, 0x00, 0x60, 0x0D, 0x10,
-	0x20, 0x40, 0x80, 0x00, 0x81, 0x84, 0x02, 0x02, 0x40, 0xC2, 0xA2, 0x9B,
-	0x32, 0x01, 0x02, 0x04, 0x08, 0x10, 0x10, 0x00, 0xAC, 0x01, 0x02, 0x3B,
-	0x08, 0x3C, 0x7C, 0xF8, 0xF0, 0xB9, 0xE8, 0xF6, 0x07, 0x87, 0xAE, 0xFF,
-	0xF0, 0xCC, 0x33, 0xCF, 0x7C, 0xB7, 0xC3, 0x30, 0x74, 0x49, 0x80, 0x40,
-	0x62, 0x01, 0x01, 0x20, 0x71, 0xF1, 0x4D, 0x7D, 0x1B, 0x81, 0xD8, 0xDC,
-	0x5F, 0x8D, 0x96, 0x7F, 0x18, 0x8F, 0x7F, 0x1D, 0x8F, 0x1F, 0xC7, 0xE3,
-	0xDF, 0xC6, 0xE3, 0x47, 0x87, 0xDE, 0x5E, 0x18, 0xD1, 0xEB, 0x83, 0x38,
-	0xE6, 0xB7, 0xF1, 0xF8, 0xFB, 0x78, 0xFC, 0x26, 0x1E, 0xDF, 0xC6, 0xE3,
-	0x1F, 0x23, 0x24, 0xDC, 0x1F, 0x71, 0xAE, 0x43, 0x08, 0x10, 0x20, 0x30,
-	0x4A, 0x40, 0x00, 0x18, 0xC5, 0xE4, 0x20, 0x02, 0xE7, 0x0B, 0x1C, 0x9E,
-	0xC9, 0xFF, 0x79, 0xFC, 0xEB, 0xDB, 0x87, 0x8D, 0xFE, 0xF5, 0x8D, 0xAD,
-	0xEE, 0x1D, 0x82, 0xC1, 0xA7, 0xF1, 0xF3, 0x97, 0xAE, 0x1C, 0x6C, 0xAC,
-	0xAD, 0x79, 0x02, 0x1D, 0x0B, 0x08, 0x00, 0x1D, 0x17, 0xD7, 0xD4, 0xB6,
-	0x11, 0x38, 0x3C, 0xC3, 0xFF, 0x0F, 0xD1, 0xFA, 0xF5, 0x78, 0x6C, 0xBD,
-	0xE1, 0x1F, 0x9B, 0xC4, 0x10, 0x08, 0x6E, 0xC7, 0xE3, 0x4E, 0x84, 0x81,
-	0xE1, 0x4A, 0x81, 0xFF, 0x08, 0x10, 0x20, 0x30, 0x4A, 0x40, 0x00, 0x18,
-	0xC5, 0xE4, 0xA0, 0xEC, 0x02, 0xB1, 0xE9, 0xBF, 0x14, 0x06, 0xEF, 0x55,
-	0xB2, 0xE9, 0x5F, 0x54, 0x0E, 0x61, 0x20, 0xFB, 0x42, 0x35, 0x7F, 0x02,
-	0x13, 0x04, 0x04, 0x80, 0x09, 0x58, 0x0E, 0xCD, 0x27, 0x10, 0x1B, 0xFF,
-	0xB5, 0x98, 0xF5, 0x7F, 0x89, 0xC7, 0x3B, 0x8D, 0xCD, 0xFE, 0x6E, 0x8C,
-	0xF7, 0xAF, 0xE3, 0xAA, 0xC0, 0x17, 0x8D, 0x8D, 0xDB, 0x70, 0x09, 0x10,
-	0x28, 0x24, 0x20, 0x00, 0x14, 0x82, 0xD6, 0x4D, 0x5B, 0x02, 0xB1, 0xF1,
-	0x0F, 0xCF, 0xF6, 0x6F, 0xC4, 0x63, 0xEF, 0x4B, 0xFC, 0x4B, 0xE1, 0x86,
-	0xAB, 0x02, 0x37, 0x23, 0x08, 0xDC, 0x59, 0xDA, 0x90, 0xF3, 0x09, 0x10,
-	0xE8, 0x4B, 0x40, 0x00, 0xE8, 0xAB, 0x9E, 0x66, 0xB3, 0x50, 0xE0, 0xB0,
-	0xF1, 0x7F, 0x1C, 0xCD, 0x8C, 0xB9, 0x5B, 0x7F, 0x61, 0x6F, 0x45, 0x4F,
-	0x1F, 0xDE, 0x59, 0xF0, 0x81, 0x20, 0x50, 0xD4, 0x5C, 0x67, 0x04, 0xAA,
-	0x16, 0x10, 0x00, 0xAA, 0x2E, 0x8F, 0xC1, 0x95, 0x12, 0x38, 0x5C, 0xEA,
-	0x1F, 0x6E, 0xA6, 0xEB, 0x6D, 0xE3, 0x7F, 0x92, 0x70, 0xB8, 0x22, 0xF0,
-	0x97, 0x5E, 0x1A, 0x28, 0xB5, 0xB2, 0xF4, 0x43, 0xA0, 0x5E, 0x01, 0x01,
-	0xA0, 0xDE, 0xDA, 0x18, 0x59, 0x01, 0x81, 0xC3, 0xCD, 0x7D, 0xFF, 0x2D,
-	0xBA, 0x6A, 0xED, 0x35, 0xFE, 0xA5, 0x3A, 0xC3, 0x3D, 0x02, 0x3F, 0xF3,
-	0xCE, 0x81, 0xA5, 0x8C, 0xCE, 0x27, 0xD0, 0xAE, 0x80, 0x00, 0xD0, 0x6E,
-	0xED, 0x8C, 0x7C, 0xA1, 0xC0, 0xC3, 0xFF, 0xFB, 0xF0, 0xC3, 0x2B, 0x7F,
-	0x76, 0xE5, 0xE6, 0xC2, 0x66, 0x26, 0x9E, 0xFE, 0x30, 0x8E, 0xAF, 0xEA,
-	0xD7, 0xEE, 0x46, 0x84, 0x80, 0x8F, 0x26, 0x4E, 0xC2, 0xE1, 0x04, 0x08,
-	0x74, 0x20, 0x50, 0xD5, 0x5F, 0xA2, 0x0E, 0x3C, 0x4D, 0xA1, 0x01, 0x81,
-	0xC3, 0xB3, 0xFE, 0xE1, 0x83, 0x74, 0x5A, 0xBF, 0xC1, 0x6F, 0x2D, 0xED,
-	0xE1, 0x65, 0x81, 0xB7, 0x5D, 0x0D, 0x58, 0x8B, 0x53, 0x3B, 0x04, 0xDA,
-	0x10, 0x10, 0x00, 0xDA, 0xA8, 0x93, 0x51, 0xAE, 0x24, 0x70, 0x78, 0xAD,
-	0xFF, 0xF3, 0x95, 0x9A, 0xEB, 0xAD, 0x99, 0xB7, 0xDC, 0x1B, 0xD0, 0x5B,
-	0x49, 0xCD, 0x87, 0xC0, 0xC5, 0x02, 0x02, 0x80, 0xD5, 0x91, 0x46, 0x20,
-	0x36, 0xFF, 0xE1, 0xEE, 0xFE, 0xF7, 0xD3, 0x4C, 0x78, 0xDE, 0x44, 0x6F,
-	0xC5, 0x69, 0x3F, 0xF7, 0x11, 0xC3, 0xF3, 0xF0, 0x9C, 0x45, 0xA0, 0x25,
-	0x01, 0x01, 0xA0, 0xA5, 0x6A, 0x19, 0xEB, 0x2C, 0x01, 0x97, 0xFC, 0x27,
-	0xB3, 0x0D, 0x2F, 0x09, 0xBC, 0x29, 0x04, 0x4C, 0x76, 0x73, 0x02, 0x81,
-	0xA6, 0x04, 0x04, 0x80, 0xA6, 0xCA, 0x65, 0xB0, 0x53, 0x05, 0x0E, 0x9B,
-	0xFF, 0x57, 0x71, 0x5E, 0xEF, 0x6F, 0xEF, 0x9B, 0x4A, 0x73, 0xEC, 0xF8,
-	0x07, 0x57, 0x9E, 0xBB, 0xF2, 0xDA, 0x33, 0xFF, 0xC7, 0xF7, 0x0B, 0x1C,
-	0x83, 0xF2, 0xEF, 0x04, 0x5A, 0x15, 0x10, 0x00, 0x5A, 0xAD, 0x9C, 0x71,
-	0x1F, 0x15, 0x38, 0x7C, 0x69, 0xCF, 0xD7, 0x47, 0x0F, 0x74, 0xC0, 0x65,
-	0x02, 0x57, 0x7D, 0x0D, 0xB1, 0x05, 0x42, 0xA0, 0x4F, 0x01, 0x01, 0xA0,
-	0xCF, 0xBA, 0xA6, 0x9F, 0x95, 0x9B, 0xFD, 0x56, 0x5D, 0x02, 0x6E, 0x0E,
-	0x5C, 0x95, 0x53, 0x63, 0x04, 0xEA, 0x10, 0x10, 0x00, 0xEA, 0xA8, 0x83,
-	0x51, 0xAC, 0x28, 0x50, 0xE3, 0xE6, 0xFF, 0x7D, 0xCC, 0xEF, 0xD9, 0x15,
-	0xE7, 0xB8, 0x43, 0x53, 0x42, 0xC0, 0x0E, 0xE8, 0xBA, 0x24, 0xB0, 0xA5,
-	0x80, 0x00, 0xB0, 0xA5, 0xAE, 0xB6, 0x8B, 0x0B, 0xD4, 0xB8, 0xF9, 0x17,
-	0x47, 0xD8, 0xAE, 0x43, 0x2F, 0x07, 0x6C, 0x67, 0xAB, 0x65, 0x02, 0xC5,
-	0x05, 0x04, 0x80, 0xE2, 0xE4, 0x3A, 0xDC, 0x4A, 0xC0, 0xE6, 0xBF, 0x95,
-	0xEC, 0x63, 0xED, 0x0A, 0x01, 0x45, 0x98, 0x75, 0x42, 0x60, 0x7B, 0x01,
-	0x01, 0x60, 0x7B, 0x63, 0x3D, 0x14, 0x10, 0xB0, 0xF9, 0x17, 0x40, 0xFE,
-	0x63, 0x17, 0xC3, 0xB7, 0x0A, 0xBE, 0xE6, 0x53, 0x03, 0x8B, 0x79, 0xEB,
-	0x88, 0xC0, 0x66, 0x02, 0x02, 0xC0, 0x66, 0xB4, 0x1A, 0x2E, 0x25, 0x60,
-	0xF3, 0x2F, 0x25, 0xFD, 0xA8, 0x9F, 0x21, 0x04, 0xBC, 0xE2, 0x73, 0x02,
-	0x8A, 0xBB, 0xEB, 0x90, 0xC0, 0xAA, 0x02, 0x02, 0xC0, 0xAA, 0x9C, 0x1A,
-	0x2B, 0x2D, 0x60, 0xF3, 0x2F, 0x2D, 0xFE, 0xA8, 0xBF, 0xBB, 0x11, 0x00,
-	0xDE, 0xDD, 0xAD, 0x77, 0x1D, 0x13, 0x20, 0xB0, 0x58, 0x40, 0x00, 0x58,
-	0x4C, 0xA8, 0x81, 0xBD, 0x04, 0x6C, 0xFE, 0x7B, 0xC9, 0x3F, 0xEA, 0xF7,
-	0x7A, 0x84, 0x80, 0x3B, 0xBB, 0x8F, 0xC2, 0x00, 0x08, 0x10, 0x98, 0x25,
-	0x20, 0x00, 0xCC, 0x62, 0x73, 0xD2, 0xDE, 0x02, 0x3E, 0xE4, 0x67, 0xEF,
-	0x0A, 0x3C, 0xEA, 0xDF, 0x4D, 0x81, 0xD5, 0x94, 0xC2, 0x40, 0x08, 0x4C,
-	0x13, 0x10, 0x00, 0xA6, 0x79, 0x39, 0xBA, 0x02, 0x01, 0x9B, 0x7F, 0x05,
-	0x45, 0xF8, 0xD3, 0x10, 0xDC, 0x0F, 0x50, 0x55, 0x39, 0x0C, 0x86, 0xC0,
-	0x78, 0x01, 0x01, 0x60, 0xBC, 0x95, 0x23, 0x2B, 0x10, 0xB0, 0xF9, 0x57,
-	0x50, 0x84, 0xA7, 0x87, 0x70, 0x2B, 0x5E, 0x0A, 0xF8, 0xA0, 0xCA, 0x91,
-	0x19, 0x14, 0x01, 0x02, 0x17, 0x0A, 0x08, 0x00, 0x16, 0x47, 0x33, 0x02,
-	0x36, 0xFF, 0xAA, 0x4B, 0xE5, 0xA5, 0x80, 0xAA, 0xCB, 0x63, 0x70, 0x04,
-	0x9E, 0x16, 0x10, 0x00, 0xAC, 0x8A, 0x26, 0x04, 0x6C, 0xFE, 0xD5, 0x97,
-	0xE9, 0x5E, 0x5C, 0x05, 0x78, 0xA3, 0xFA, 0x51, 0x1A, 0x20, 0x01, 0x02,
-	0x8F, 0x04, 0x04, 0x00, 0x8B, 0xA1, 0x7A, 0x81, 0xEA, 0x37, 0xFF, 0x87,
-	0x07, 0x42, 0xBF, 0x4D, 0xDE, 0x15, 0x50, 0xFD, 0x6F, 0x93, 0x01, 0x12,
-	0xF8, 0x93, 0x80, 0x3F, 0x59, 0x56, 0x43, 0xD5, 0x02, 0xB1, 0xF9, 0xBF,
-	0x14, 0x03, 0xFC, 0x5D, 0xD5, 0x83, 0x34, 0xB8, 0xB3, 0x02, 0xCF, 0xFB,
-	0x80, 0x20, 0x0B, 0x82, 0x40, 0x1B, 0x02, 0x02, 0x40, 0x1B, 0x75, 0x4A,
-	0x39, 0xCA, 0xC3, 0x33, 0xFF, 0xCF, 0x62, 0xF2, 0x2F, 0xA4, 0x04, 0x68,
-	0x73, 0xD2, 0x6E, 0x08, 0x6C, 0xB3, 0x6E, 0x46, 0x9D, 0x50, 0x40, 0x00,
-	0x48, 0x58, 0xF4, 0x16, 0xA6, 0x7C, 0x78, 0xE6, 0xFF, 0x95, 0xCD, 0xBF,
-	0x85, 0x6A, 0x3D, 0x35, 0xC6, 0x97, 0x7D, 0x57, 0x40, 0x93, 0x75, 0x33,
-	0xE8, 0x64, 0x02, 0x02, 0x40, 0xB2, 0x82, 0xB7, 0x30, 0x5D, 0x9B, 0x7F,
-	0x0B, 0x55, 0xBA, 0x74, 0x8C, 0x37, 0x22, 0x00, 0x7C, 0xD4, 0xFC, 0x2C,
-	0x4C, 0x80, 0x40, 0xE7, 0x02, 0x02, 0x40, 0xE7, 0x05, 0x6E, 0x6D, 0x7A,
-	0x36, 0xFF, 0xD6, 0x2A, 0x76, 0xE1, 0x78, 0xDD, 0x0B, 0xD0, 0x4D, 0x29,
-	0x4D, 0xA4, 0x57, 0x01, 0x01, 0xA0, 0xD7, 0xCA, 0x36, 0x38, 0x2F, 0x9B,
-	0x7F, 0x83, 0x45, 0xBB, 0x78, 0xC8, 0xAE, 0x02, 0x74, 0x55, 0x4E, 0x93,
-	0xE9, 0x51, 0x40, 0x00, 0xE8, 0xB1, 0xAA, 0x0D, 0xCE, 0xC9, 0xE6, 0xDF,
-	0x60, 0xD1, 0x8E, 0x0C, 0x39, 0x5E, 0x06, 0xF0, 0xF7, 0xA5, 0xBF, 0xB2,
-	0x9A, 0x51, 0x47, 0x02, 0x7E, 0x41, 0x3B, 0x2A, 0x66, 0xAB, 0x53, 0x99,
-	0xB4, 0xF9, 0x0F, 0xEF, 0xB9, 0xB7, 0x6A, 0x47, 0x95, 0xFA, 0xFB, 0x38,
-	0xEA, 0xD9, 0x51, 0x47, 0x6E, 0x76, 0xD0, 0x5B, 0x91, 0x01, 0xBE, 0xD8,
-	0xAC, 0x75, 0x0D, 0x13, 0x20, 0xB0, 0x48, 0xC0, 0x9F, 0xD2, 0x45, 0x7C,
-	0x4E, 0x5E, 0x2A, 0x30, 0x69, 0xF3, 0x5F, 0xDA, 0x99, 0xF3, 0xD7, 0x17,
-	0xB8, 0x3C, 0x65, 0xDC, 0x8D, 0x00, 0xF0, 0xEE, 0xFA, 0x9D, 0x6A, 0x91,
-	0x00, 0x81, 0x35, 0x04, 0x04, 0x80, 0x35, 0x14, 0xB5, 0x31, 0x4B, 0xC0,
-	0xE6, 0x3F, 0x8B, 0xAD, 0xB5, 0x93, 0xDC, 0x0C, 0xD8, 0x5A, 0xC5, 0x8C,
-	0x37, 0x8D, 0x80, 0x00, 0x90, 0xA6, 0xD4, 0x75, 0x4D, 0x34, 0x36, 0xFF,
-	0xE7, 0x62, 0x44, 0xDF, 0xC4, 0xC3, 0x87, 0xFC, 0xD4, 0x55, 0x9A, 0x93,
-	0xD1, 0xAC, 0xF8, 0x4A, 0x8B, 0x8F, 0x07, 0xAE, 0xB0, 0xBE, 0x86, 0x44,
-	0x60, 0x10, 0x10, 0x00, 0xAC, 0x83, 0xE2, 0x02, 0x87, 0xCD, 0xFF, 0xCB,
-	0xE8, 0xF8, 0xF5, 0xE2, 0x9D, 0xEB, 0xB0, 0xB4, 0x80, 0x2F, 0x09, 0x2A,
-	0x2D, 0xAE, 0x3F, 0x02, 0x23, 0x05, 0x04, 0x80, 0x91, 0x50, 0x0E, 0x5B,
-	0x47, 0xC0, 0xE6, 0xBF, 0x8E, 0x63, 0x63, 0xAD, 0x78, 0x19, 0xA0, 0xB1,
-	0x82, 0x19, 0x6E, 0x0E, 0x01, 0x01, 0x20, 0x47, 0x9D, 0xAB, 0x98, 0xA5,
-	0xCD, 0xBF, 0x8A, 0x32, 0xEC, 0x31, 0x08, 0xEF, 0x06, 0xD8, 0x43, 0x5D,
-	0x9F, 0x04, 0x8E, 0x08, 0x08, 0x00, 0x96, 0x48, 0x11, 0x01, 0x9B, 0x7F,
-	0x11, 0xE6, 0xCA, 0x3A, 0x79, 0x74, 0x27, 0x81, 0x2F, 0x08, 0xAA, 0xAC,
-	0x32, 0x86, 0x43, 0x60, 0x10, 0x10, 0x00, 0xAC, 0x83, 0xCD, 0x05, 0x6C,
-	0xFE, 0x9B, 0x13, 0xD7, 0xDE, 0x81, 0xFB, 0x00, 0x6A, 0xAF, 0x90, 0xF1,
-	0xA5, 0x14, 0x10, 0x00, 0x52, 0x96, 0xBD, 0xDC, 0xA4, 0x6D, 0xFE, 0xE5,
-	0xAC, 0x2B, 0xEF, 0xC9, 0x7D, 0x00, 0x95, 0x17, 0xC8, 0xF0, 0xF2, 0x09,
-	0x08, 0x00, 0xF9, 0x6A, 0x5E, 0x6C, 0xC6, 0x36, 0xFF, 0x62, 0xD4, 0x2D,
-	0x74, 0xE4, 0x3E, 0x80, 0x16, 0xAA, 0x64, 0x8C, 0xA9, 0x04, 0x04, 0x80,
-	0x54, 0xE5, 0x2E, 0x37, 0xD9, 0xC3, 0xE6, 0xFF, 0x8B, 0xE8, 0xF1, 0x9D,
-	0x72, 0xBD, 0xEA, 0xA9, 0x62, 0x01, 0x5F, 0x0E, 0x54, 0x71, 0x71, 0x0C,
-	0x2D, 0xA7, 0x80, 0x00, 0x90, 0xB3, 0xEE, 0x9B, 0xCE, 0xDA, 0xE6, 0xBF,
-	0x29, 0x6F, 0xAB, 0x8D, 0xBB, 0x11, 0xB0, 0xD5, 0xCA, 0x19, 0x77, 0xB7,
-	0x02, 0x02, 0x40, 0xB7, 0xA5, 0xDD, 0x6F, 0x62, 0x11, 0x00, 0x3E, 0x59,
-	0xF6, 0xCC, 0x7F, 0xC5, 0xCF, 0xA1, 0xDB, 0x8F, 0x41, 0xCF, 0x8F, 0x0B,
-	0xB8, 0x11, 0xD0, 0x8A, 0x20, 0x50, 0x99, 0x80, 0x00, 0x50, 0x59, 0x41,
-	0x5A, 0x1F, 0xCE, 0xF2, 0xCD, 0xBF, 0x75, 0x01, 0xE3, 0xBF, 0x48, 0xC0,
-	0xD7, 0x03, 0x5B, 0x1B, 0x04, 0xEA, 0x12, 0x10, 0x00, 0xEA, 0xAA, 0x47,
-	0xD3, 0xA3, 0xB1, 0xF9, 0x37, 0x5D, 0xBE, 0x12, 0x83, 0xF7, 0x4E, 0x80,
-	0x12, 0xCA, 0xFA, 0x20, 0x30, 0x52, 0x40, 0x00, 0x18, 0x09, 0xE5, 0xB0,
-	0xCB, 0x05, 0x6A, 0xD9, 0xFC, 0xBD, 0x78, 0x50, 0xF5, 0x4A, 0xBD, 0x1A,
-	0x57, 0x01, 0xEE, 0x57, 0x3D, 0x42, 0x83, 0x23, 0x90, 0x48, 0x40, 0x00,
-	0x48, 0x54, 0xEC, 0xAD, 0xA6, 0x5A, 0xCB, 0xE6, 0xBF, 0xD5, 0xFC, 0xB4,
-	0xBB, 0x9A, 0x80, 0xB7, 0x02, 0xAE, 0x46, 0xA9, 0x21, 0x02, 0xCB, 0x05,
-	0x04, 0x80, 0xE5, 0x86, 0xA9, 0x5B, 0xB0, 0xF9, 0xA7, 0x2E, 0xFF, 0xD4,
-	0xC9, 0x0B, 0x00, 0x53, 0xC5, 0x1C, 0x4F, 0x60, 0x43, 0x01, 0x01, 0x60,
-	0x43, 0xDC, 0xDE, 0x9B, 0x8E, 0xCD, 0xFF, 0xE3, 0x98, 0xE3, 0xFB, 0xBD,
-	0xCF, 0xD3, 0xFC, 0x56, 0x13, 0xB8, 0x1E, 0x2F, 0x01, 0xDC, 0x59, 0xAD,
-	0x35, 0x0D, 0x11, 0x20, 0xB0, 0x48, 0x40, 0x00, 0x58, 0xC4, 0x97, 0xF7,
-	0x64, 0x9B, 0x7F, 0xDE, 0xDA, 0x2F, 0x98, 0xB9, 0x00, 0xB0, 0x00, 0xCF,
-	0xA9, 0x04, 0xD6, 0x16, 0x10, 0x00, 0xD6, 0x16, 0x4D, 0xD0, 0x9E, 0xCD,
-	0x3F, 0x41, 0x91, 0xB7, 0x99, 0xA2, 0x4F, 0x03, 0xDC, 0xC6, 0x55, 0xAB,
-	0x04, 0x66, 0x09, 0x08, 0x00, 0xB3, 0xD8, 0xF2, 0x9E, 0x64, 0xF3, 0xCF,
-	0x5B, 0xFB, 0x15, 0x66, 0x2E, 0x00, 0xAC, 0x80, 0xA8, 0x09, 0x02, 0x6B,
-	0x09, 0x08, 0x00, 0x6B, 0x49, 0x26, 0x68, 0xC7, 0xE6, 0x9F, 0xA0, 0xC8,
-	0xDB, 0x4E, 0x51, 0x00, 0xD8, 0xD6, 0x57, 0xEB, 0x04, 0x26, 0x09, 0x08,
-	0x00, 0x93, 0xB8, 0xF2, 0x1E, 0x6C, 0xF3, 0xCF, 0x5B, 0xFB, 0x15, 0x67,
-	0xEE, 0x1E, 0x80, 0x15, 0x31, 0x35, 0x45, 0x60, 0xA9, 0x80, 0x00, 0xB0,
-	0x54, 0x30, 0xC1, 0xF9, 0x36, 0xFF, 0x04, 0x45, 0x2E, 0x33, 0x45, 0x01,
-	0xA0, 0x8C, 0xB3, 0x5E, 0x08, 0x8C, 0x12, 0x10, 0x00, 0x46, 0x31, 0xE5,
-	0x3D, 0x28, 0x36, 0xFF, 0x0F, 0x63, 0xF6, 0x37, 0xCF, 0x13, 0xF0, 0xA9,
-	0x7B, 0x79, 0xD7, 0xC5, 0xCC, 0x99, 0xFB, 0x1C, 0x80, 0x99, 0x70, 0x4E,
-	0x23, 0xB0, 0x85, 0x80, 0x00, 0xB0, 0x85, 0x6A, 0x27, 0x6D, 0x5E, 0xB6,
-	0xF9, 0x77, 0x32, 0xC5, 0x73, 0xA6, 0xF1, 0x7D, 0xFC, 0xFF, 0x9E, 0xED,
-	0x77, 0x7A, 0x4B, 0x67, 0xB6, 0x2C, 0xF5, 0x09, 0x00, 0x4B, 0xFD, 0x9D,
-	0x4F, 0x60, 0x45, 0x01, 0x01, 0x60, 0x45, 0xCC, 0x9E, 0x9A, 0xCA, 0xB9,
-	0xF9, 0xF7, 0x54, 0xC1, 0x2A, 0xE7, 0xF2, 0x72, 0x7C, 0x10, 0xD0, 0xB7,
-	0x55, 0x8E, 0xCC, 0xA0, 0x08, 0x24, 0x14, 0x10, 0x00, 0x12, 0x16, 0xFD,
-	0xD8, 0x94, 0x6D, 0xFE, 0xC7, 0x84, 0xFC, 0xFB, 0x1C, 0x01, 0x5F, 0x07,
-	0x3C, 0x47, 0xCD, 0x39, 0x04, 0xB6, 0x13, 0x10, 0x00, 0xB6, 0xB3, 0x6D,
-	0xB2, 0x65, 0x9B, 0x7F, 0x93, 0x65, 0x6B, 0x61, 0xD0, 0x0F, 0x22, 0x00,
-	0xBC, 0xD8, 0xC2, 0x40, 0x8D, 0x91, 0x40, 0x16, 0x01, 0x01, 0x20, 0x4B,
-	0xA5, 0x47, 0xCC, 0xD3, 0xE6, 0x3F, 0x02, 0xC9, 0x21, 0x73, 0x05, 0xEE,
-	0x46, 0x00, 0x78, 0x77, 0xEE, 0xC9, 0xCE, 0x23, 0x40, 0x60, 0x7D, 0x01,
-	0x01, 0x60, 0x7D, 0xD3, 0x26, 0x5B, 0x8C, 0xCD, 0xFF, 0xBD, 0x18, 0xF8,
-	0xED, 0xF9, 0x83, 0x77, 0xF3, 0xDC, 0x7C, 0xBB, 0x14, 0x67, 0xDE, 0x8A,
-	0x00, 0xF0, 0x41, 0x8A, 0x99, 0x9A, 0x24, 0x81, 0x46, 0x04, 0x04, 0x80,
-	0x46, 0x0A, 0xB5, 0xE5, 0x30, 0x97, 0x6F, 0xFE, 0x5B, 0x8E, 0x4E, 0xDB,
-	0x9D, 0x08, 0xF8, 0x14, 0xC0, 0x4E, 0x0A, 0x69, 0x1A, 0xFD, 0x08, 0x08,
-	0x00, 0xFD, 0xD4, 0x72, 0xD6, 0x4C, 0x6C, 0xFE, 0xB3, 0xD8, 0x9C, 0x34,
-	0x5D, 0xE0, 0x6A, 0x5C, 0x01, 0xB8, 0x3F, 0xFD, 0x34, 0x67, 0x10, 0x20,
-	0xB0, 0x95, 0x80, 0x00, 0xB0, 0x95, 0x6C, 0x03, 0xED, 0xDA, 0xFC, 0x1B,
-	0x28, 0x52, 0x27, 0x43, 0xF4, 0x0E, 0x80, 0x4E, 0x0A, 0x69, 0x1A, 0x5D,
-	0x09, 0x08, 0x00, 0x5D, 0x95, 0x73, 0xFC, 0x64, 0x6C, 0xFE, 0xE3, 0xAD,
-	0x1C, 0xB9, 0x58, 0xC0, 0x0D, 0x80, 0x8B, 0x09, 0x35, 0x40, 0x60, 0x7D,
-	0x01, 0x01, 0x60, 0x7D, 0xD3, 0xEA, 0x5B, 0xB4, 0xF9, 0x57, 0x5F, 0xA2,
-	0xDE, 0x06, 0xE8, 0xF5, 0xFF, 0xDE, 0x2A, 0x6A, 0x3E, 0x5D, 0x08, 0x08,
-	0x00, 0x5D, 0x94, 0x71, 0xFC, 0x24, 0x6C, 0xFE, 0xE3, 0xAD, 0xCE, 0x3D,
-	0x72, 0xD9, 0x47, 0xE1, 0x1E, 0xED, 0x7C, 0xE3, 0xE6, 0x8F, 0xF6, 0xBF,
-	0xD1, 0x01, 0x3E, 0x02, 0x78, 0x23, 0x58, 0xCD, 0x12, 0x58, 0x22, 0x20,
-	0x00, 0x2C, 0xD1, 0x6B, 0xEC, 0x5C, 0x9B, 0x7F, 0x63, 0x05, 0xEB, 0x64,
-	0xB8, 0x5E, 0xFF, 0xEF, 0xA4, 0x90, 0xA6, 0xD1, 0x9D, 0x80, 0x00, 0xD0,
-	0x5D, 0x49, 0xCF, 0x9F, 0x50, 0x6C, 0xFE, 0xD7, 0xE2, 0x5F, 0x3E, 0x4F,
-	0x32, 0x5D, 0xD3, 0xAC, 0x47, 0xC0, 0xFB, 0xFF, 0xEB, 0xA9, 0x85, 0x91,
-	0x10, 0x78, 0x4C, 0x40, 0x00, 0x48, 0xB0, 0x20, 0x6C, 0xFE, 0x09, 0x8A,
-	0x5C, 0xEF, 0x14, 0x5D, 0xFE, 0xAF, 0xB7, 0x36, 0x46, 0x96, 0x5C, 0x40,
-	0x00, 0xE8, 0x7C, 0x01, 0xD8, 0xFC, 0x3B, 0x2F, 0x70, 0xE5, 0xD3, 0x73,
-	0xF9, 0xBF, 0xF2, 0x02, 0x19, 0x5E, 0x6A, 0x01, 0x01, 0xA0, 0xE3, 0xF2,
-	0xDB, 0xFC, 0x3B, 0x2E, 0x6E, 0x1B, 0x53, 0x73, 0xF9, 0xBF, 0x8D, 0x3A,
-	0x19, 0x65, 0x52, 0x01, 0x01, 0xA0, 0xD3, 0xC2, 0xDB, 0xFC, 0x3B, 0x2D,
-	0x6C, 0x5B, 0xD3, 0xF2, 0xE9, 0x7F, 0x6D, 0xD5, 0xCB, 0x68, 0x93, 0x09,
-	0x08, 0x00, 0x1D, 0x16, 0xDC, 0xE6, 0xDF, 0x61, 0x51, 0xDB, 0x9B, 0xD2,
-	0xBD, 0xB8, 0xFC, 0xFF, 0x46, 0x7B, 0xC3, 0x36, 0x62, 0x02, 0x79, 0x04,
-	0x04, 0x80, 0xCE, 0x6A, 0x6D, 0xF3, 0xEF, 0xAC, 0xA0, 0xED, 0x4E, 0xC7,
-	0xCD, 0x7F, 0xED, 0xD6, 0xCE, 0xC8, 0x93, 0x08, 0x08, 0x00, 0x1D, 0x15,
-	0x3A, 0x36, 0xFF, 0x57, 0x63, 0x3A, 0x5F, 0x77, 0x34, 0x25, 0x53, 0x69,
-	0x53, 0xE0, 0x41, 0x3C, 0xFB, 0x7F, 0xB1, 0xCD, 0xA1, 0x1B, 0x35, 0x81,
-	0x3C, 0x02, 0x02, 0x40, 0x27, 0xB5, 0xB6, 0xF9, 0x77, 0x52, 0xC8, 0x3E,
-	0xA6, 0x71, 0x3D, 0x02, 0xC0, 0x9D, 0x3E, 0xA6, 0x62, 0x16, 0x04, 0xFA,
-	0x15, 0x10, 0x00, 0x3A, 0xA8, 0xAD, 0xCD, 0xBF, 0x83, 0x22, 0xF6, 0x33,
-	0x85, 0x07, 0x31, 0x95, 0x57, 0x22, 0x00, 0x7C, 0xD7, 0xCF, 0x94, 0xCC,
-	0x84, 0x40, 0x9F, 0x02, 0x02, 0x40, 0xE3, 0x75, 0xB5, 0xF9, 0x37, 0x5E,
-	0xC0, 0xFE, 0x86, 0xEF, 0xD9, 0x7F, 0x7F, 0x35, 0x35, 0xA3, 0x4E, 0x05,
-	0x04, 0x80, 0x86, 0x0B, 0x6B, 0xF3, 0x6F, 0xB8, 0x78, 0x7D, 0x0E, 0xDD,
-	0x9D, 0xFF, 0x7D, 0xD6, 0xD5, 0xAC, 0x3A, 0x15, 0x10, 0x00, 0x1A, 0x2D,
-	0xAC, 0xCD, 0xBF, 0xD1, 0xC2, 0xF5, 0x3D, 0x6C, 0xEF, 0xFB, 0xEF, 0xBB,
-	0xBE, 0x66, 0xD7, 0x99, 0x80, 0x00, 0xD0, 0x60, 0x41, 0x63, 0xF3, 0x7F,
-	0x29, 0x86, 0xFD, 0xBB, 0x06, 0x87, 0x6E, 0xC8, 0xFD, 0x0A, 0xF8, 0xD4,
-	0xBF, 0x7E, 0x6B, 0x6B, 0x66, 0x9D, 0x0A, 0x08, 0x00, 0x8D, 0x15, 0xF6,
-	0xF0, 0xCC, 0xFF, 0xB3, 0x18, 0xF6, 0x0B, 0x8D, 0x0D, 0xDD, 0x70, 0xFB,
-	0x16, 0x78, 0x39, 0x6E, 0xFC, 0xFB, 0xB6, 0xEF, 0x29, 0x9A, 0x1D, 0x81,
-	0xBE, 0x04, 0x04, 0x80, 0x86, 0xEA, 0x79, 0x78, 0xE6, 0xFF, 0x55, 0x57,
-	0x9B, 0xFF, 0xC3, 0x98, 0x4D, 0xC3, 0xAB, 0xF0, 0xFB, 0x18, 0xFE, 0xB3,
-	0x0D, 0xAD, 0xA1, 0xF1, 0x43, 0x9D, 0x54, 0x18, 0x37, 0xFE, 0x8D, 0x87,
-	0x75, 0x24, 0x81, 0x6A, 0x04, 0x1A, 0xFE, 0xD3, 0x5B, 0x8D, 0x61, 0x91,
-	0x81, 0x9C, 0xBF, 0xF9, 0x4F, 0xFA, 0x23, 0x5D, 0x64, 0x9C, 0x3A, 0x49,
-	0x27, 0xE0, 0xD2, 0x7F, 0xBA, 0x92, 0x9B, 0x70, 0x2F, 0x02, 0x02, 0x40,
-	0x03, 0x95, 0xEC, 0xF2, 0x99, 0x7F, 0x03, 0xEE, 0x86, 0x78, 0x54, 0xC0,
-	0x7B, 0xFE, 0x8F, 0x12, 0x39, 0x80, 0x40, 0xBD, 0x02, 0x02, 0x40, 0xBD,
-	0xB5, 0x39, 0x19, 0x99, 0xCD, 0xBF, 0xF2, 0x02, 0xE5, 0x1E, 0x9E, 0xBB,
-	0xFE, 0x73, 0xD7, 0xDF, 0xEC, 0x1B, 0x17, 0x10, 0x00, 0x2A, 0x2E, 0xA0,
-	0xCD, 0xBF, 0xE2, 0xE2, 0x18, 0xDA, 0x8D, 0xB8, 0xE9, 0xEF, 0x23, 0x0C,
-	0x04, 0x08, 0xB4, 0x2B, 0x20, 0x00, 0x54, 0x5A, 0x3B, 0x9B, 0x7F, 0xA5,
-	0x85, 0x31, 0xAC, 0x41, 0xC0, 0xEB, 0xFE, 0xD6, 0x01, 0x81, 0x0E, 0x04,
-	0x04, 0x80, 0x0A, 0x8B, 0x68, 0xF3, 0xAF, 0xB0, 0x28, 0x86, 0x74, 0x2A,
-	0x70, 0x37, 0x9E, 0xF9, 0xBF, 0x8B, 0x83, 0x00, 0x81, 0xF6, 0x05, 0x04,
-	0x80, 0xCA, 0x6A, 0x68, 0xF3, 0xAF, 0xAC, 0x20, 0x86, 0x73, 0x56, 0xE0,
-	0x5E, 0xFC, 0x1F, 0x6F, 0xFA, 0xA2, 0x1F, 0x8B, 0x82, 0x40, 0x1F, 0x02,
-	0x02, 0x40, 0x45, 0x75, 0x8C, 0xCD, 0xFF, 0xB9, 0x18, 0xCE, 0x37, 0xF1,
-	0xF0, 0x21, 0x3F, 0x15, 0xD5, 0xC5, 0x50, 0x4E, 0x04, 0xDC, 0xF1, 0x6F,
-	0x21, 0x10, 0xE8, 0x4C, 0x40, 0x00, 0xA8, 0xA4, 0xA0, 0x87, 0xCD, 0xFF,
-	0xCB, 0x18, 0xCE, 0xEB, 0x95, 0x0C, 0xC9, 0x30, 0x08, 0x9C, 0x0A, 0x0C,
-	0x9B, 0xFF, 0x6B, 0x3E, 0xE9, 0xCF, 0x82, 0x20, 0xD0, 0x97, 0x80, 0x00,
-	0x50, 0x41, 0x3D, 0x6D, 0xFE, 0x15, 0x14, 0xC1, 0x10, 0x2E, 0x12, 0xB0,
-	0xF9, 0x5B, 0x1B, 0x04, 0x3A, 0x15, 0x10, 0x00, 0x76, 0x2E, 0xAC, 0xCD,
-	0x7F, 0xE7, 0x02, 0xE8, 0xFE, 0x32, 0x01, 0x9B, 0xBF, 0xF5, 0x41, 0xA0,
-	0x63, 0x01, 0x01, 0x60, 0xC7, 0xE2, 0xDA, 0xFC, 0x77, 0xC4, 0xD7, 0xF5,
-	0x31, 0x01, 0x9B, 0xFF, 0x31, 0x21, 0xFF, 0x4E, 0xA0, 0x71, 0x01, 0x01,
-	0x60, 0xA7, 0x02, 0xDA, 0xFC, 0x77, 0x82, 0xD7, 0xED, 0x18, 0x81, 0x61,
-	0xF3, 0xFF, 0x8B, 0x78, 0xCD, 0xFF, 0xFE, 0x98, 0x83, 0x1D, 0x43, 0x80,
-	0x40, 0x9B, 0x02, 0x02, 0xC0, 0x0E, 0x75, 0xB3, 0xF9, 0xEF, 0x80, 0xAE,
-	0xCB, 0x29, 0x02, 0x3E, 0xE2, 0x77, 0x8A, 0x96, 0x63, 0x09, 0x34, 0x2A,
-	0x20, 0x00, 0x14, 0x2E, 0x9C, 0xCD, 0xBF, 0x30, 0xB8, 0xEE, 0xA6, 0x0A,
-	0xD8, 0xFC, 0xA7, 0x8A, 0x39, 0x9E, 0x40, 0xA3, 0x02, 0x02, 0x40, 0xC1,
-	0xC2, 0x1D, 0x36, 0xFF, 0x5F, 0x44, 0x97, 0xEF, 0x14, 0xEC, 0x56, 0x57,
-	0x04, 0xC6, 0x0A, 0xD8, 0xFC, 0xC7, 0x4A, 0x39, 0x8E, 0x40, 0x07, 0x02,
-	0x02, 0x40, 0xA1, 0x22, 0xDA, 0xFC, 0x0B, 0x41, 0xEB, 0x66, 0xAE, 0x80,
-	0xCD, 0x7F, 0xAE, 0x9C, 0xF3, 0x08, 0x34, 0x2A, 0x20, 0x00, 0x14, 0x2A,
-	0x5C, 0x04, 0x80, 0x4F, 0x3C, 0xF3, 0x2F, 0x84, 0xAD, 0x9B, 0xA9, 0x02,
-	0x36, 0xFF, 0xA9, 0x62, 0x8E, 0x27, 0xD0, 0x81, 0x80, 0x00, 0x50, 0xA0,
-	0x88, 0x36, 0xFF, 0x02, 0xC8, 0xBA, 0x98, 0x2B, 0x60, 0xF3, 0x9F, 0x2B,
-	0xE7, 0x3C, 0x02, 0x8D, 0x0B, 0x08, 0x00, 0x1B, 0x17, 0xD0, 0xE6, 0xBF,
-	0x31, 0xB0, 0xE6, 0x97, 0x08, 0xBC, 0x15, 0x6F, 0xF5, 0xFB, 0x62, 0x49,
-	0x03, 0xCE, 0x25, 0x40, 0xA0, 0x5D, 0x01, 0x01, 0x60, 0xC3, 0xDA, 0xD9,
-	0xFC, 0x37, 0xC4, 0xD5, 0xF4, 0x52, 0x01, 0x9B, 0xFF, 0x52, 0x41, 0xE7,
-	0x13, 0x68, 0x5C, 0x40, 0x00, 0xD8, 0xA8, 0x80, 0x36, 0xFF, 0x8D, 0x60,
-	0x35, 0xBB, 0x86, 0x80, 0xCD, 0x7F, 0x0D, 0x45, 0x6D, 0x10, 0x68, 0x5C,
-	0x40, 0x00, 0xD8, 0xA0, 0x80, 0x36, 0xFF, 0x0D, 0x50, 0x35, 0xB9, 0x96,
-	0x80, 0xCD, 0x7F, 0x2D, 0x49, 0xED, 0x10, 0x68, 0x5C, 0x40, 0x00, 0x58,
-	0xB9, 0x80, 0xB1, 0xF9, 0x7F, 0x1C, 0x4D, 0xBE, 0xBF, 0x72, 0xB3, 0x9A,
-	0x5B, 0x55, 0xE0, 0xFB, 0x68, 0xED, 0xD9, 0x55, 0x5B, 0x6C, 0xA4, 0x31,
-	0x9B, 0x7F, 0x23, 0x85, 0x32, 0x4C, 0x02, 0x25, 0x04, 0x04, 0x80, 0x15,
-	0x95, 0x6D, 0xFE, 0x2B, 0x62, 0x26, 0x6D, 0x6A, 0xC3, 0x68, 0x62, 0xF3,
-	0x4F, 0xBA, 0xA6, 0x4C, 0x9B, 0xC0, 0x45, 0x02, 0x02, 0xC0, 0x4A, 0x6B,
-	0xC3, 0xE6, 0xBF, 0x12, 0xA4, 0x66, 0xB6, 0x10, 0xB0, 0xF9, 0x6F, 0xA1,
-	0xAA, 0x4D, 0x02, 0x8D, 0x0B, 0x08, 0x00, 0x2B, 0x14, 0xD0, 0xE6, 0xBF,
-	0x02, 0xA2, 0x26, 0xB6, 0x12, 0xB8, 0x1E, 0x6F, 0xF5, 0xBB, 0xB3, 0x55,
-	0xE3, 0xDA, 0x25, 0x40, 0xA0, 0x5D, 0x01, 0x01, 0x60, 0x61, 0xED, 0x6C,
-	0xFE, 0x0B, 0x01, 0x9D, 0xBE, 0xA5, 0x80, 0xCD, 0x7F, 0x4B, 0x5D, 0x6D,
-	0x13, 0x68, 0x5C, 0x40, 0x00, 0x58, 0x50, 0xC0, 0x3C, 0x9B, 0xFF, 0xC3,
-	0x50, 0xB2, 0x54, 0x16, 0x2C, 0x95, 0x3D, 0x4E, 0xB5, 0xF9, 0xEF, 0xA1,
-	0xAE, 0x4F, 0x02, 0x0D, 0x09, 0xF8, 0xAB, 0x3E, 0xB3, 0x58, 0x79, 0x36,
-	0xFF, 0x99, 0x40, 0x4E, 0xDB, 0x53, 0xC0, 0xE6, 0xBF, 0xA7, 0xBE, 0xBE,
-	0x09, 0x34, 0x22, 0x20, 0x00, 0xCC, 0x28, 0x54, 0x6C, 0xFE, 0x1F, 0xC6,
-	0x69, 0x37, 0x67, 0x9C, 0xEA, 0x14, 0x02, 0x5B, 0x0B, 0xD8, 0xFC, 0xB7,
-	0x16, 0xD6, 0x3E, 0x81, 0x4E, 0x04, 0x04, 0x80, 0x89, 0x85, 0xB4, 0xF9,
-	0x4F, 0x04, 0x73, 0xF8, 0x3A, 0x02, 0xE3, 0x5E, 0x85, 0xB1, 0xF9, 0xAF,
-	0xA3, 0xAD, 0x15, 0x02, 0x29, 0x04, 0x04, 0x80, 0x09, 0x65, 0xB6, 0xF9,
-	0x4F, 0xC0, 0x72, 0x68, 0x69, 0x01, 0x9B, 0x7F, 0x69, 0x71, 0xFD, 0x11,
-	0x68, 0x5C, 0x40, 0x00, 0x18, 0x59, 0x40, 0x9B, 0xFF, 0x48, 0x28, 0x87,
-	0xED, 0x21, 0x70, 0x23, 0xDE, 0xEA, 0xF7, 0xD1, 0x1E, 0x1D, 0xEB, 0x93,
-	0x00, 0x81, 0x76, 0x05, 0x04, 0x80, 0x11, 0xB5, 0xB3, 0xF9, 0x8F, 0x40,
-	0x72, 0xC8, 0x5E, 0x02, 0x36, 0xFF, 0xBD, 0xE4, 0xF5, 0x4B, 0xA0, 0x71,
-	0x01, 0x01, 0xE0, 0x48, 0x01, 0x6D, 0xFE, 0x8D, 0xAF, 0xF0, 0x0B, 0x86,
-	0x3F, 0xEE, 0x25, 0xF5, 0xEA, 0xE7, 0x6E, 0xF3, 0xAF, 0xBE, 0x44, 0x06,
-	0x48, 0xA0, 0x5E, 0x01, 0x01, 0xE0, 0x92, 0xDA, 0xD8, 0xFC, 0xEB, 0x5D,
-	0xB8, 0xF5, 0x8C, 0x6C, 0xB7, 0x28, 0x61, 0xF3, 0xAF, 0x67, 0x11, 0x18,
-	0x09, 0x81, 0x26, 0x05, 0x04, 0x80, 0x8B, 0x9E, 0x21, 0x3E, 0x7C, 0xF8,
-	0x5E, 0xFC, 0xD3, 0xED, 0x26, 0xAB, 0x6A, 0xD0, 0xBD, 0x0B, 0xD8, 0xFC,
-	0x7B, 0xAF, 0xB0, 0xF9, 0x11, 0x28, 0x20, 0x20, 0x00, 0x9C, 0x83, 0x1C,
-	0xCF, 0xFC, 0x6D, 0xFE, 0x05, 0x16, 0x9F, 0x2E, 0x66, 0x09, 0xD8, 0xFC,
-	0x67, 0xB1, 0x39, 0x89, 0x00, 0x81, 0x27, 0x05, 0x04, 0x80, 0x27, 0x44,
-	0x6C, 0xFE, 0x7E, 0x49, 0x2A, 0x16, 0xB8, 0x15, 0x77, 0xFB, 0x7F, 0x50,
-	0xF1, 0xF8, 0x0C, 0x8D, 0x00, 0x81, 0x86, 0x04, 0x04, 0x80, 0x33, 0xC5,
-	0xB2, 0xF9, 0x37, 0xB4, 0x72, 0xF3, 0x0D, 0xD5, 0xE6, 0x9F, 0xAF, 0xE6,
-	0x66, 0x4C, 0x60, 0x53, 0x01, 0x01, 0xE0, 0xC0, 0x6B, 0xF3, 0xDF, 0x74,
-	0x9D, 0xA5, 0x69, 0xFC, 0xFB, 0x98, 0xE9, 0xB3, 0xEB, 0xCF, 0xD6, 0xE6,
-	0xBF, 0xBE, 0xA9, 0x16, 0x09, 0xA4, 0x17, 0x10, 0x00, 0x62, 0x09, 0xD8,
-	0xFC, 0xD3, 0xFF, 0x1E, 0xD4, 0x0C, 0x60, 0xF3, 0xAF, 0xB9, 0x3A, 0xC6,
-	0x46, 0xA0, 0x61, 0x81, 0xF4, 0x01, 0xC0, 0xE6, 0xDF, 0xF0, 0xEA, 0xED,
-	0x7F, 0xE8, 0x36, 0xFF, 0xFE, 0x6B, 0x6C, 0x86, 0x04, 0x76, 0x13, 0x48,
-	0x1D, 0x00, 0x62, 0xF3, 0xBF, 0x16, 0xF2, 0x9F, 0xEF, 0xA6, 0xBF, 0x67,
-	0xC7, 0x1B, 0x5D, 0xAB, 0xDE, 0x73, 0x4A, 0x9D, 0xF5, 0x6D, 0xF3, 0xEF,
-	0xAC, 0xA0, 0xA6, 0x43, 0xA0, 0x36, 0x81, 0xB4, 0x01, 0x20, 0xF5, 0xE6,
-	0x5F, 0xDB, 0x2A, 0x34, 0x9E, 0x27, 0x05, 0x6C, 0xFE, 0xD6, 0x04, 0x01,
-	0x02, 0x9B, 0x0B, 0xA4, 0x0C, 0x00, 0x36, 0xFF, 0xCD, 0xD7, 0x95, 0x0E,
-	0xE6, 0x0B, 0xDC, 0x8D, 0xB7, 0xFA, 0xBD, 0x3B, 0xFF, 0x74, 0x67, 0x12,
-	0x20, 0x40, 0x60, 0x9C, 0x40, 0xBA, 0x00, 0xF0, 0xA7, 0xCD, 0x7F, 0xB7,
-	0x8F, 0x70, 0x1D, 0x57, 0x19, 0x47, 0x65, 0x14, 0xB0, 0xF9, 0x67, 0xAC,
-	0xBA, 0x39, 0x13, 0xD8, 0x49, 0x20, 0x55, 0x00, 0xF0, 0xCC, 0x7F, 0xA7,
-	0x55, 0xA6, 0xDB, 0x31, 0x02, 0x36, 0xFF, 0x31, 0x4A, 0x8E, 0x21, 0x40,
-	0x60, 0x35, 0x81, 0x34, 0x01, 0xC0, 0xE6, 0xBF, 0xDA, 0x9A, 0xD1, 0xD0,
-	0xFA, 0x02, 0x36, 0xFF, 0xF5, 0x4D, 0xB5, 0x48, 0x80, 0xC0, 0x11, 0x81,
-	0x14, 0x01, 0xC0, 0xE6, 0xEF, 0xF7, 0xA0, 0x62, 0x01, 0x9B, 0x7F, 0xC5,
-	0xC5, 0x31, 0x34, 0x02, 0x3D, 0x0B, 0x74, 0x1F, 0x00, 0x6C, 0xFE, 0x3D,
-	0x2F, 0xDF, 0xE6, 0xE7, 0x76, 0x37, 0x66, 0xF0, 0xD3, 0xB8, 0xE9, 0xEF,
-	0xBB, 0xE6, 0x67, 0x62, 0x02, 0x04, 0x08, 0x34, 0x27, 0xD0, 0x75, 0x00,
-	0x88, 0xCD, 0xFF, 0xD5, 0xA8, 0xC8, 0xD7, 0xCD, 0x55, 0x65, 0xCE, 0x80,
-	0xDD, 0xD3, 0x38, 0x47, 0x6D, 0xCF, 0x73, 0xEE, 0x45, 0xE7, 0x6F, 0xDA,
-	0xFC, 0xF7, 0x2C, 0x81, 0xBE, 0x09, 0xE4, 0x16, 0xE8, 0x36, 0x00, 0xA4,
-	0xDA, 0xFC, 0x73, 0xAF, 0xE1, 0x16, 0x67, 0x6F, 0xF3, 0x6F, 0xB1, 0x6A,
-	0xC6, 0x4C, 0xA0, 0x33, 0x81, 0x2E, 0x03, 0x80, 0xCD, 0xBF, 0xB3, 0x55,
-	0xDA, 0xD7, 0x74, 0x6C, 0xFE, 0x7D, 0xD5, 0xD3, 0x6C, 0x08, 0x34, 0x2B,
-	0xD0, 0x5D, 0x00, 0xB0, 0xF9, 0x37, 0xBB, 0x16, 0x33, 0x0C, 0xDC, 0xE6,
-	0x9F, 0xA1, 0xCA, 0xE6, 0x48, 0xA0, 0x11, 0x81, 0xAE, 0x02, 0x80, 0xCD,
-	0xBF, 0x91, 0x55, 0x97, 0x73, 0x98, 0x36, 0xFF, 0x9C, 0x75, 0x37, 0x6B,
-	0x02, 0xD5, 0x0A, 0x74, 0x13, 0x00, 0x6C, 0xFE, 0xD5, 0xAE, 0x31, 0x03,
-	0xBB, 0x72, 0xC5, 0xE6, 0x6F, 0x15, 0x10, 0x20, 0x50, 0x9D, 0x40, 0x17,
-	0x01, 0xC0, 0xE6, 0x5F, 0xDD, 0xBA, 0x32, 0xA0, 0x3F, 0x09, 0xD8, 0xFC,
-	0xAD, 0x06, 0x02, 0x04, 0xAA, 0x14, 0x68, 0x3E, 0x00, 0x1C, 0x36, 0xFF,
-	0xCF, 0x42, 0xF7, 0x85, 0x2A, 0x85, 0x0D, 0x2A, 0xB3, 0xC0, 0x83, 0x98,
-	0xFC, 0x2B, 0xDE, 0xEA, 0x97, 0x79, 0x09, 0x98, 0x3B, 0x81, 0x7A, 0x05,
-	0x9A, 0x0E, 0x00, 0xB1, 0xF9, 0xBF, 0x14, 0xB4, 0x5F, 0xD9, 0xFC, 0xEB,
-	0x5D, 0x60, 0x89, 0x47, 0x36, 0x6C, 0xFE, 0xAF, 0xC5, 0xE6, 0xFF, 0x6D,
-	0x62, 0x03, 0x53, 0x27, 0x40, 0xA0, 0x62, 0x81, 0x66, 0x03, 0x40, 0x91,
-	0xCD, 0xDF, 0x87, 0xEB, 0xEC, 0xB0, 0x74, 0xBB, 0x40, 0xB7, 0xF9, 0xEF,
-	0xB0, 0x72, 0x74, 0x49, 0x80, 0xC0, 0x34, 0x81, 0x26, 0x03, 0x40, 0x91,
-	0xCD, 0x7F, 0x9A, 0xA3, 0xA3, 0x09, 0x9C, 0x0A, 0xD8, 0xFC, 0xAD, 0x05,
-	0x02, 0x04, 0x9A, 0x10, 0x68, 0x2E, 0x00, 0xF4, 0xB7, 0xF9, 0x7F, 0x1F,
-	0x0B, 0xE5, 0xD9, 0x26, 0x16, 0x8B, 0x41, 0x1E, 0x15, 0xB0, 0xF9, 0x1F,
-	0x25, 0x72, 0x00, 0x01, 0x02, 0xB5, 0x08, 0x34, 0x15, 0x00, 0xFA, 0xDB,
-	0xFC, 0x6B, 0x59, 0x06, 0xC6, 0xB1, 0x82, 0x80, 0xCD, 0x7F, 0x05, 0x44,
-	0x4D, 0x10, 0x20, 0x50, 0x4E, 0xA0, 0x99, 0x00, 0x60, 0xF3, 0x2F, 0xB7,
-	0x28, 0xF4, 0x34, 0x59, 0xC0, 0xE6, 0x3F, 0x99, 0xCC, 0x09, 0x04, 0x08,
-	0xEC, 0x2D, 0xD0, 0x44, 0x00, 0xB0, 0xF9, 0xEF, 0xBD, 0x4C, 0xF4, 0x7F,
-	0x89, 0x80, 0xCD, 0xDF, 0xF2, 0x20, 0x40, 0xA0, 0x49, 0x81, 0xEA, 0x03,
-	0x40, 0x6C, 0xFE, 0xCF, 0x85, 0xEC, 0x37, 0xF1, 0xF0, 0x3E, 0xFF, 0x26,
-	0x97, 0x58, 0xF7, 0x83, 0x7E, 0xD9, 0x5B, 0xFD, 0xBA, 0xAF, 0xB1, 0x09,
-	0x12, 0xE8, 0x52, 0xA0, 0xEA, 0x00, 0x70, 0xD8, 0xFC, 0xBF, 0x0C, 0xF9,
-	0xD7, 0xBB, 0xD4, 0x37, 0xA9, 0xD6, 0x05, 0x6C, 0xFE, 0xAD, 0x57, 0xD0,
-	0xF8, 0x09, 0x24, 0x16, 0xA8, 0x36, 0x00, 0xD8, 0xFC, 0x13, 0xAF, 0xCA,
-	0x36, 0xA6, 0x7E, 0x35, 0x9E, 0xF9, 0xDF, 0x6F, 0x63, 0xA8, 0x46, 0x49,
-	0x80, 0x00, 0x81, 0xA7, 0x05, 0xAA, 0x0C, 0x00, 0x36, 0x7F, 0x4B, 0xB5,
-	0x72, 0x01, 0x9B, 0x7F, 0xE5, 0x05, 0x32, 0x3C, 0x02, 0x04, 0x8E, 0x0B,
-	0x54, 0x17, 0x00, 0x6C, 0xFE, 0xC7, 0x8B, 0xE6, 0x88, 0x5D, 0x05, 0x6C,
-	0xFE, 0xBB, 0xF2, 0xEB, 0xBC, 0x45, 0x81, 0xC3, 0xDF, 0xF5, 0xB1, 0x43,
-	0xFF, 0xC1, 0xD8, 0x03, 0xCF, 0x1C, 0x37, 0xE7, 0x9C, 0xD3, 0xD3, 0x7F,
-	0x18, 0xFF, 0xE3, 0x9F, 0xE3, 0x71, 0xFA, 0x73, 0xF8, 0xFF, 0xFF, 0xE1,
-	0xF0, 0xB8, 0xD2, 0xF3, 0x77, 0x79, 0x54, 0x15, 0x00, 0x6C, 0xFE, 0x33,
-	0x96, 0xBD, 0x53, 0x4A, 0x0A, 0xBC, 0x15, 0x9D, 0xFD, 0xF2, 0x89, 0x0E,
-	0xE7, 0xFC, 0xE1, 0x99, 0x73, 0xCE, 0xD0, 0xED, 0xD9, 0x3F, 0x54, 0x4B,
-	0xE7, 0x3D, 0xDC, 0x54, 0x3B, 0xBC, 0x83, 0xE1, 0xEC, 0xCF, 0xA5, 0x6D,
-	0x0E, 0xDF, 0xCD, 0x31, 0x7C, 0xF7, 0xC1, 0xD9, 0x9F, 0x4B, 0xDB, 0x3C,
-	0x3D, 0xFF, 0xC7, 0xF1, 0x3F, 0x7E, 0x13, 0x8F, 0xF3, 0x7E, 0x2E, 0xED,
-	0xE3, 0x27, 0xD1, 0xC0, 0xAF, 0x0F, 0x8D, 0x9C, 0xFE, 0xEF, 0xE1, 0xE7,
-	0xD2, 0xFF, 0x7E, 0x14, 0x0D, 0xFC, 0x36, 0x1E, 0x67, 0x7F, 0x2E, 0x69,
-	0x73, 0xAD, 0x76, 0xD6, 0xAC, 0xF9, 0x92, 0xF9, 0xB4, 0x76, 0xEE, 0xF0,
-	0xCD, 0x9E, 0x7F, 0x7F, 0x58, 0x87, 0xC3, 0x3A, 0xFF, 0xC7, 0x61, 0xDD,
-	0xB4, 0x1C, 0x10, 0xAA, 0x09, 0x00, 0x36, 0xFF, 0xD6, 0x7E, 0x17, 0x2E,
-	0x1F, 0xAF, 0xCF, 0x37, 0xEC, 0xAB, 0x9E, 0x66, 0x43, 0x80, 0xC0, 0x85,
-	0x02, 0x43, 0x30, 0xB8, 0x1D, 0x8F, 0x7F, 0x88, 0xC7, 0x2F, 0x5B, 0x0A,
-	0x04, 0x55, 0x04, 0x00, 0x9B, 0xBF, 0x5F, 0x2D, 0x02, 0x04, 0x08, 0x10,
-	0xE8, 0x44, 0xE0, 0x34, 0x10, 0xDC, 0xA9, 0xFD, 0x2D, 0xC2, 0xB5, 0x04,
-	0x80, 0x5F, 0x45, 0xE1, 0xAB, 0x78, 0xAB, 0x9F, 0x67, 0xAE, 0x9D, 0xFC,
-	0x0A, 0x9A, 0x06, 0x01, 0x02, 0x04, 0xF6, 0x17, 0xB8, 0x1B, 0x43, 0xF8,
-	0x9B, 0x78, 0xFC, 0x6D, 0x8D, 0x57, 0x06, 0x76, 0x0D, 0x00, 0x87, 0x67,
-	0xFE, 0xBF, 0x08, 0x9C, 0x77, 0xF6, 0xAF, 0x93, 0x11, 0x10, 0x20, 0x40,
-	0xA0, 0x0F, 0x01, 0x4F, 0x64, 0xAA, 0xAC, 0xE3, 0xAD, 0x18, 0xD5, 0xFF,
-	0xA8, 0xE9, 0xED, 0xC3, 0xBB, 0x05, 0x80, 0x2A, 0x37, 0xFF, 0x2E, 0xBE,
-	0x8A, 0xBE, 0xCA, 0x85, 0x6F, 0x50, 0x04, 0x08, 0x10, 0x20, 0xF0, 0x47,
-	0x81, 0xE1, 0xAA, 0xC0, 0xCF, 0x6B, 0x08, 0x02, 0x7B, 0x06, 0x80, 0x4F,
-	0x3C, 0xF3, 0xF7, 0xFB, 0x40, 0x80, 0xC0, 0x31, 0x01, 0xCF, 0x66, 0x8F,
-	0x09, 0xF9, 0xF7, 0x46, 0x05, 0x86, 0x20, 0xF0, 0xD7, 0x11, 0x04, 0xBE,
-	0xD8, 0x6B, 0xFC, 0xBB, 0x04, 0x80, 0x78, 0xF6, 0x6F, 0xF3, 0xDF, 0xAB,
-	0xE2, 0xFA, 0x25, 0x40, 0x80, 0x00, 0x81, 0x9A, 0x04, 0x86, 0x20, 0xF0,
-	0xB3, 0x3D, 0x6E, 0x18, 0x2C, 0x1E, 0x00, 0x4A, 0x6E, 0xFE, 0xB5, 0x5C,
-	0xD1, 0xF7, 0x0C, 0xA6, 0xA6, 0xDF, 0x35, 0x63, 0x21, 0x40, 0x80, 0x40,
-	0x95, 0x02, 0x37, 0x22, 0x04, 0x7C, 0x54, 0x72, 0x64, 0x45, 0x03, 0x40,
-	0xC9, 0xCD, 0xBF, 0x24, 0xA2, 0xBE, 0x08, 0xAC, 0x21, 0x50, 0x4B, 0x60,
-	0x5D, 0x63, 0x2E, 0xDA, 0x20, 0x40, 0x60, 0x96, 0xC0, 0xF0, 0xE1, 0x5C,
-	0xD7, 0x4B, 0xBD, 0x2C, 0x50, 0x2C, 0x00, 0xD8, 0xFC, 0x67, 0x2D, 0x06,
-	0x27, 0x11, 0x20, 0x40, 0x80, 0xC0, 0x85, 0x02, 0xDD, 0x5E, 0x5F, 0x2D,
-	0x72, 0x35, 0xA0, 0x48, 0x00, 0x88, 0xCD, 0xFF, 0xE3, 0xA8, 0xDF, 0xFB,
-	0x56, 0x31, 0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x30, 0x4A, 0x60, 0xF8,
-	0x40, 0xA1, 0xB7, 0xB7, 0xBC, 0x37, 0x60, 0xF3, 0x00, 0x60, 0xF3, 0x1F,
-	0x55, 0x68, 0x07, 0x11, 0x20, 0x40, 0x80, 0x00, 0x81, 0xF3, 0x04, 0xDE,
-	0xDA, 0xEA, 0x25, 0x81, 0x4D, 0x03, 0x80, 0xCD, 0xDF, 0x6A, 0x26, 0x40,
-	0x80, 0x40, 0x01, 0x01, 0x37, 0x90, 0x14, 0x40, 0xDE, 0xB5, 0x8B, 0x4D,
-	0x5E, 0x12, 0xD8, 0x2C, 0x00, 0xD8, 0xFC, 0x77, 0x5D, 0x2C, 0x3A, 0x27,
-	0x40, 0x80, 0x00, 0x81, 0xBE, 0x04, 0x6E, 0xC5, 0x95, 0x80, 0x0F, 0xD6,
-	0x9C, 0xD2, 0x26, 0x01, 0xC0, 0xE6, 0xBF, 0x66, 0x89, 0xB4, 0x45, 0x80,
-	0x00, 0x01, 0x02, 0x04, 0x4E, 0x04, 0x86, 0xCF, 0x0C, 0xF8, 0xE9, 0x5A,
-	0xDF, 0x2B, 0xB0, 0x7A, 0x00, 0xB0, 0xF9, 0x5B, 0xA6, 0x04, 0x08, 0x10,
-	0x58, 0x43, 0xA0, 0xDB, 0x3B, 0xDC, 0xD7, 0xC0, 0xC9, 0xDC, 0xC6, 0x70,
-	0x73, 0xE0, 0x9B, 0x6B, 0x84, 0x80, 0x55, 0x03, 0x80, 0xCD, 0x3F, 0xF3,
-	0x9A, 0x34, 0x77, 0x02, 0x04, 0x96, 0x08, 0x78, 0x19, 0x7F, 0x89, 0x5E,
-	0xBA, 0x73, 0x57, 0x09, 0x01, 0xAB, 0x05, 0x80, 0xD8, 0xFC, 0x3F, 0x8C,
-	0x12, 0xDC, 0x4C, 0x57, 0x06, 0x13, 0x26, 0x40, 0x80, 0x40, 0x09, 0x01,
-	0x17, 0x04, 0x4A, 0x28, 0xB7, 0xD4, 0xC7, 0xE2, 0x10, 0xB0, 0x4A, 0x00,
-	0xB0, 0xF9, 0xB7, 0xB4, 0x66, 0x8C, 0x95, 0x00, 0x01, 0x02, 0x04, 0x3A,
-	0x11, 0xB8, 0x1B, 0x2F, 0x05, 0xBC, 0x3B, 0x77, 0x2E, 0x8B, 0x03, 0x80,
-	0xCD, 0x7F, 0x2E, 0xBD, 0xF3, 0x08, 0x6C, 0x2C, 0xE0, 0x9A, 0xF2, 0xC6,
-	0xC0, 0x9A, 0x27, 0x50, 0x85, 0xC0, 0xEC, 0x77, 0x07, 0x2C, 0x0A, 0x00,
-	0xB1, 0xF9, 0xBF, 0x17, 0xD3, 0xBF, 0x5D, 0x05, 0xC1, 0x4E, 0x83, 0x70,
-	0x55, 0x6E, 0x27, 0xF8, 0xE2, 0xDD, 0xAA, 0x74, 0x71, 0x72, 0x1D, 0x12,
-	0x20, 0x30, 0x56, 0x60, 0xD6, 0xE7, 0x04, 0xCC, 0x0E, 0x00, 0xB1, 0xF9,
-	0x5F, 0x8B, 0x91, 0x7D, 0x3E, 0x76, 0x74, 0x8E, 0x23, 0x40, 0x80, 0x00,
-	0x01, 0x02, 0x04, 0x36, 0x13, 0x98, 0xFC, 0x89, 0x81, 0xB3, 0x02, 0x40,
-	0x6C, 0xFE, 0xAF, 0xC6, 0x14, 0xBE, 0xDE, 0x6C, 0x1A, 0x1A, 0x5E, 0x4F,
-	0xC0, 0x65, 0xE0, 0xF5, 0x2C, 0xB5, 0x44, 0x80, 0x00, 0x81, 0x7A, 0x05,
-	0x86, 0x6F, 0x12, 0x7C, 0x6D, 0xCA, 0x77, 0x07, 0x4C, 0x0E, 0x00, 0xB1,
-	0xF9, 0x3F, 0x17, 0x9D, 0x7C, 0x13, 0x8F, 0x17, 0xEA, 0x75, 0x30, 0x32,
-	0x02, 0x04, 0x08, 0x24, 0x13, 0x10, 0xF6, 0x93, 0x15, 0xFC, 0xDC, 0xE9,
-	0xDE, 0x8B, 0x00, 0xF0, 0xC6, 0x58, 0x88, 0x39, 0x01, 0xE0, 0x93, 0x68,
-	0xFC, 0x9D, 0xB1, 0x1D, 0x38, 0x8E, 0x00, 0x81, 0x42, 0x02, 0x87, 0xDB,
-	0x14, 0xEC, 0x03, 0x85, 0xBC, 0x75, 0x43, 0xA0, 0x4E, 0x81, 0xD1, 0xF7,
-	0x03, 0x4C, 0x0A, 0x00, 0xEE, 0xF8, 0xAF, 0xB3, 0xDA, 0x46, 0x45, 0x80,
-	0x00, 0x01, 0x02, 0x04, 0xCE, 0x08, 0x5C, 0x8D, 0x2B, 0x01, 0xF7, 0x8F,
-	0x89, 0x8C, 0x0E, 0x00, 0x5E, 0xF7, 0x3F, 0x46, 0xE9, 0xDF, 0x09, 0xAC,
-	0x28, 0xE0, 0x69, 0xFC, 0x8A, 0x98, 0x9A, 0x22, 0x90, 0x4E, 0x60, 0xD4,
-	0x4B, 0x01, 0xA3, 0x02, 0x80, 0xD7, 0xFD, 0xD3, 0x2D, 0x1E, 0x13, 0x26,
-	0x90, 0x5B, 0x40, 0x00, 0xCB, 0x5D, 0xFF, 0x3E, 0x66, 0x7F, 0x3D, 0xAE,
-	0x02, 0xDC, 0xB9, 0x6C, 0x2A, 0x63, 0x03, 0xC0, 0xC7, 0xD1, 0xC8, 0xFB,
-	0x7D, 0x98, 0x98, 0xC5, 0x95, 0x2B, 0xDE, 0xD3, 0x6E, 0x15, 0x10, 0x20,
-	0x40, 0x20, 0x81, 0xC0, 0xF3, 0x97, 0x7D, 0x69, 0xD0, 0xD1, 0x00, 0xE0,
-	0xD2, 0x7F, 0x82, 0x25, 0x62, 0x8A, 0x04, 0x08, 0x10, 0xA8, 0x5C, 0xC0,
-	0x45, 0x99, 0x59, 0x05, 0xBA, 0xF4, 0x53, 0x02, 0xC7, 0x04, 0x80, 0x5F,
-	0x45, 0xB7, 0xAF, 0xCF, 0xEA, 0xDA, 0x49, 0x8B, 0x04, 0x3C, 0x4F, 0x5F,
-	0xC4, 0xE7, 0x64, 0x02, 0x04, 0x08, 0x10, 0xB8, 0x72, 0xE5, 0xE5, 0x8B,
-	0x3E, 0x1B, 0xE0, 0xD2, 0x00, 0xE0, 0xA3, 0x7E, 0xAD, 0x1D, 0x02, 0x04,
-	0xCE, 0x13, 0xF0, 0x6C, 0xCC, 0xBA, 0x20, 0xD0, 0x8C, 0xC0, 0x85, 0x57,
-	0x01, 0x2E, 0x0C, 0x00, 0x5D, 0xDF, 0xF8, 0xE7, 0xA9, 0x75, 0x33, 0x2B,
-	0xD7, 0x40, 0x09, 0x10, 0x20, 0x40, 0x60, 0xBE, 0xC0, 0x61, 0xBB, 0x3B,
-	0xF7, 0x2A, 0xC0, 0x65, 0x01, 0xE0, 0xC3, 0xE8, 0xF2, 0xE6, 0xFC, 0x6E,
-	0x9D, 0x49, 0x80, 0x00, 0x01, 0x02, 0x04, 0x08, 0x54, 0x20, 0x70, 0xEE,
-	0x55, 0x80, 0xCB, 0x02, 0xC0, 0xEF, 0x63, 0xD0, 0x3E, 0xEE, 0xB7, 0x82,
-	0xCA, 0xF5, 0x34, 0x04, 0x17, 0x5F, 0x7A, 0xAA, 0xA6, 0xB9, 0x10, 0x20,
-	0xD0, 0x90, 0xC0, 0x53, 0x57, 0x01, 0xCE, 0x0D, 0x00, 0x5E, 0xFB, 0x6F,
-	0xA8, 0xA4, 0x86, 0x4A, 0x80, 0x00, 0x01, 0x02, 0x04, 0x8E, 0x0B, 0x3C,
-	0xF5, 0x11, 0xC1, 0x17, 0x05, 0x00, 0xCF, 0xFE, 0x8F, 0x63, 0x36, 0x7E,
-	0x84, 0xE7, 0xE2, 0x8D, 0x17, 0x70, 0xFB, 0xE1, 0xBB, 0xD3, 0x6F, 0x7B,
-	0xE3, 0x42, 0x3D, 0xF8, 0x6D, 0x2F, 0x04, 0x5D, 0x77, 0x37, 0x0F, 0xE2,
-	0xDD, 0x00, 0x2F, 0x9E, 0x1D, 0xE2, 0x53, 0x01, 0x20, 0x9E, 0xFD, 0x5F,
-	0x8B, 0x03, 0x3E, 0xAF, 0x7B, 0x1E, 0x46, 0x47, 0x80, 0x00, 0x01, 0x02,
-	0x04, 0x08, 0x4C, 0x14, 0x78, 0xEC, 0x3B, 0x02, 0xCE, 0x0B, 0x00, 0x9B,
-	0x7C, 0xDB, 0x9F, 0x04, 0x3A, 0xB1, 0x4C, 0x0E, 0x27, 0x40, 0x80, 0x00,
-	0x01, 0x02, 0xEB, 0x0A, 0x3C, 0x76, 0x33, 0xE0, 0x63, 0x01, 0x20, 0x9E,
-	0xFD, 0xBF, 0x14, 0x7D, 0xFD, 0x6E, 0xDD, 0xFE, 0xB4, 0x46, 0x80, 0x00,
-	0x01, 0x02, 0x04, 0x08, 0x54, 0x22, 0xF0, 0xE8, 0xE3, 0x81, 0x9F, 0x0C,
-	0x00, 0xDE, 0xFA, 0x57, 0x49, 0x85, 0x0C, 0x83, 0xC0, 0xDE, 0x02, 0x6E,
-	0x01, 0xD8, 0xBB, 0x02, 0xFA, 0x27, 0xB0, 0x89, 0xC0, 0x5B, 0x71, 0x2F,
-	0xC0, 0x17, 0x43, 0xCB, 0x4F, 0x06, 0x80, 0x47, 0x1F, 0xFB, 0xEB, 0x92,
-	0xFD, 0x26, 0xF0, 0x1A, 0x25, 0x40, 0x80, 0x00, 0x01, 0x02, 0x7B, 0x0A,
-	0x3C, 0x7A, 0x19, 0xE0, 0x51, 0x00, 0x70, 0xF9, 0x7F, 0xCF, 0x7A, 0xE8,
-	0x9B, 0x00, 0x81, 0x2E, 0x05, 0x5C, 0x46, 0xE9, 0xB2, 0xAC, 0x8D, 0x4F,
-	0xEA, 0x5E, 0x5C, 0x01, 0x78, 0xE3, 0xB1, 0x2B, 0x00, 0x11, 0x00, 0x8A,
-	0x5E, 0xFE, 0xF7, 0x7B, 0xD1, 0xF8, 0x12, 0x32, 0x7C, 0x02, 0x04, 0x08,
-	0x10, 0x68, 0x55, 0xE0, 0xE4, 0x43, 0x81, 0xCE, 0x5E, 0x01, 0xF0, 0xAD,
-	0x7F, 0xAD, 0x96, 0xB2, 0xC5, 0x71, 0x7B, 0x8D, 0xA9, 0xC5, 0xAA, 0x19,
-	0x33, 0x01, 0x02, 0x7D, 0x08, 0x5C, 0x8F, 0x00, 0x70, 0xE7, 0x24, 0x00,
-	0x1C, 0xBE, 0xF8, 0xE7, 0x5F, 0xFA, 0x98, 0x97, 0x59, 0x10, 0x20, 0x40,
-	0x80, 0x00, 0x81, 0xE5, 0x02, 0x1D, 0x5F, 0xA9, 0x3E, 0xB9, 0x0F, 0xE0,
-	0x34, 0x00, 0x5C, 0x0B, 0x2A, 0x1F, 0xFE, 0xB3, 0x7C, 0xBD, 0x68, 0x81,
-	0x00, 0x01, 0x02, 0x04, 0x08, 0xD4, 0x2E, 0x70, 0x72, 0x1F, 0xC0, 0x69,
-	0x00, 0x28, 0xFA, 0xFA, 0x7F, 0x39, 0x99, 0x8E, 0xF3, 0x5B, 0x39, 0xC4,
-	0x4E, 0x7B, 0xF2, 0x1A, 0x44, 0xA7, 0x85, 0x35, 0x2D, 0x02, 0x04, 0x46,
-	0x08, 0x44, 0x00, 0x78, 0xE6, 0x34, 0x00, 0x6C, 0xF2, 0xE9, 0x7F, 0x23,
-	0xC6, 0xE0, 0x10, 0x02, 0x04, 0x08, 0x10, 0x20, 0x10, 0x02, 0x9E, 0xB0,
-	0x6D, 0xBF, 0x0C, 0x1E, 0x7B, 0xE2, 0xF3, 0xF2, 0x69, 0x00, 0x18, 0xE4,
-	0xFD, 0x47, 0x80, 0x40, 0xEB, 0x02, 0xFE, 0x86, 0xB6, 0x5E, 0x41, 0xE3,
-	0x27, 0x50, 0x4A, 0xE0, 0xAD, 0x67, 0xBC, 0xFF, 0xBF, 0x94, 0x75, 0xD2,
-	0x7E, 0x5C, 0x69, 0x4F, 0x5A, 0x78, 0xD3, 0x5E, 0x5F, 0xE0, 0xB2, 0x74,
-	0x27, 0xF9, 0xAD, 0xEF, 0xDD, 0x7D, 0x8B, 0x37, 0x86, 0x00, 0x70, 0x2D,
-	0xA6, 0xE9, 0x06, 0xC0, 0xEE, 0x6B, 0x3D, 0x75, 0x82, 0xFE, 0xA0, 0x4C,
-	0x15, 0x73, 0x3C, 0x01, 0x02, 0x04, 0x1A, 0x12, 0xB8, 0x35, 0x04, 0x80,
-	0xF7, 0x62, 0xC0, 0xB7, 0x1B, 0x1A, 0xB4, 0xA1, 0x12, 0x20, 0x40, 0x80,
-	0x00, 0x01, 0x02, 0xCB, 0x04, 0xEE, 0x0E, 0x01, 0xE0, 0xE3, 0x68, 0xE3,
-	0xFD, 0x65, 0xED, 0xF4, 0x74, 0xB6, 0x6B, 0xD6, 0x3D, 0x55, 0xD3, 0x5C,
-	0x08, 0x10, 0x20, 0x40, 0xE0, 0x5C, 0x81, 0x7B, 0x43, 0x00, 0xF0, 0x0E,
-	0x00, 0xAB, 0x83, 0x00, 0x01, 0x02, 0x04, 0x08, 0xE4, 0x12, 0x38, 0x09,
-	0x00, 0x3E, 0x02, 0x38, 0x57, 0xD1, 0xCD, 0x96, 0x00, 0x01, 0x02, 0x04,
-	0x08, 0x3C, 0x10, 0x00, 0x2C, 0x02, 0x02, 0x04, 0x08, 0x10, 0x20, 0x90,
-	0x50, 0x60, 0x08, 0x00, 0xBF, 0x8F, 0x79, 0xBF, 0x90, 0x70, 0xEE, 0xA6,
-	0x4C, 0x80, 0x00, 0x01, 0x02, 0x04, 0xD2, 0x0A, 0x0C, 0x01, 0xC0, 0x87,
-	0x00, 0xA5, 0x2D, 0xFF, 0x82, 0x89, 0xBB, 0x57, 0x72, 0x01, 0x9E, 0x53,
-	0x7B, 0x10, 0xF0, 0x2B, 0xD0, 0x43, 0x15, 0x73, 0xCF, 0xA1, 0x99, 0x00,
-	0xE0, 0x97, 0xAD, 0x82, 0x85, 0xEA, 0xA3, 0x01, 0x2A, 0x28, 0x82, 0x21,
-	0x10, 0x20, 0x40, 0x60, 0x1D, 0x81, 0x66, 0x02, 0xC0, 0x3A, 0xD3, 0xD5,
-	0x0A, 0x01, 0x02, 0x04, 0x08, 0x10, 0x48, 0x26, 0x70, 0xFE, 0x93, 0xB7,
-	0x93, 0x9B, 0x00, 0xBD, 0x04, 0x90, 0x6C, 0x2D, 0x98, 0x2E, 0x01, 0x02,
-	0xAD, 0x0A, 0xB8, 0x16, 0xDA, 0x6A, 0xE5, 0x2A, 0x1C, 0xB7, 0x00, 0x50,
-	0x61, 0x51, 0x0C, 0x89, 0x00, 0x81, 0xDA, 0x04, 0xEC, 0xBB, 0xB5, 0x55,
-	0xC4, 0x78, 0x96, 0x0B, 0x9C, 0x7C, 0x0E, 0x40, 0x45, 0xEF, 0x02, 0xF0,
-	0x5B, 0xB6, 0xBC, 0xA6, 0x5A, 0x20, 0x40, 0x80, 0x40, 0x9B, 0x02, 0x76,
-	0x80, 0xA2, 0x75, 0xAB, 0x2D, 0x00, 0x14, 0x9D, 0xBC, 0xCE, 0x08, 0x10,
-	0x20, 0x40, 0x80, 0x40, 0x56, 0x81, 0x93, 0xEF, 0x02, 0xF0, 0x49, 0x80,
-	0x59, 0xCB, 0x6F, 0xDE, 0x04, 0x08, 0x10, 0x20, 0x90, 0x55, 0xE0, 0xE4,
-	0xEB, 0x80, 0x7D, 0x17, 0x40, 0xD6, 0xF2, 0x9B, 0x37, 0x01, 0x02, 0x04,
-	0x08, 0x64, 0x15, 0xB8, 0xEE, 0xDB, 0x00, 0xB3, 0x96, 0xDE, 0xBC, 0x09,
-	0x10, 0x20, 0x40, 0x20, 0xB3, 0xC0, 0xD5, 0x21, 0x00, 0x7C, 0x18, 0x02,
-	0x37, 0x33, 0x2B, 0x98, 0x3B, 0x01, 0x02, 0x04, 0x08, 0x10, 0x48, 0x26,
-	0xF0, 0xFC, 0x10, 0x00, 0xAE, 0xC5, 0xA4, 0x3F, 0xDF, 0x62, 0xE2, 0xEE,
-	0xE8, 0xDC, 0x42, 0x55, 0x9B, 0x04, 0x08, 0x10, 0x20, 0x40, 0x60, 0x99,
-	0xC0, 0x33, 0xC3, 0x7F, 0x11, 0x00, 0x5E, 0x8A, 0x66, 0x7E, 0xB7, 0xAC,
-	0x29, 0x67, 0x13, 0x20, 0x40, 0x80, 0x00, 0x01, 0x02, 0xEB, 0x08, 0x6C,
-	0xFE, 0xB9, 0xEB, 0x77, 0x63, 0xFB, 0x7F, 0xF7, 0x99, 0x61, 0xB0, 0x3E,
-	0x0D, 0x70, 0x9D, 0x92, 0x69, 0x85, 0x00, 0x01, 0x02, 0x04, 0xDA, 0x17,
-	0xD8, 0x7C, 0xFB, 0xDD, 0x9F, 0xE8, 0x46, 0x04, 0x80, 0x8F, 0x4E, 0x03,
-	0x80, 0xB7, 0x02, 0xEE, 0x5F, 0x10, 0x23, 0x38, 0x26, 0x50, 0xE4, 0x35,
-	0xA5, 0x22, 0x9D, 0x1C, 0x9B, 0xA9, 0x7F, 0x27, 0x40, 0xE0, 0x09, 0x81,
-	0x04, 0x9B, 0x72, 0xC9, 0x9A, 0x5F, 0x8D, 0x00, 0x70, 0xFF, 0x34, 0x00,
-	0x7C, 0x1C, 0x3D, 0xBF, 0x5F, 0xB2, 0x77, 0x7D, 0x11, 0x20, 0xD0, 0xB7,
-	0x80, 0x28, 0xD5, 0x77, 0x7D, 0xCD, 0xAE, 0x5D, 0x81, 0xE1, 0xE5, 0xFF,
-	0x61, 0xF4, 0xA7, 0x01, 0xE0, 0xBD, 0xF8, 0xDF, 0xB7, 0xDB, 0x9D, 0x8E,
-	0x91, 0x13, 0x20, 0x70, 0x22, 0xE0, 0x69, 0x52, 0xDB, 0x0B, 0x41, 0xFD,
-	0xDA, 0xAE, 0x5F, 0x1B, 0xA3, 0x3F, 0x79, 0xFD, 0xFF, 0x6C, 0x00, 0x78,
-	0x2E, 0xFE, 0x8F, 0x7F, 0x69, 0x63, 0xEC, 0x46, 0x79, 0x4C, 0xC0, 0x33,
-	0xAF, 0x63, 0x42, 0xFE, 0x9D, 0x00, 0x01, 0x02, 0x69, 0x05, 0x4E, 0x5E,
-	0xFF, 0x7F, 0x14, 0x00, 0x4E, 0x9E, 0x38, 0x54, 0xF5, 0xA5, 0x40, 0x69,
-	0x0B, 0x63, 0xE2, 0x04, 0x08, 0x10, 0x20, 0x40, 0x60, 0x4B, 0x81, 0x97,
-	0x23, 0x00, 0x7C, 0xFB, 0x64, 0x00, 0x70, 0x1F, 0xC0, 0x96, 0xE4, 0xDA,
-	0x26, 0x40, 0x80, 0x00, 0x01, 0x02, 0xFB, 0x0A, 0xDC, 0x8B, 0xCD, 0xFF,
-	0x8D, 0xD3, 0x21, 0x9C, 0xDC, 0x03, 0x70, 0xB8, 0x02, 0x70, 0x2D, 0x7E,
-	0x6E, 0xF2, 0x81, 0x40, 0xFB, 0xCE, 0x57, 0xEF, 0x04, 0x08, 0xD4, 0x21,
-	0xE0, 0xC5, 0xA9, 0x3A, 0xEA, 0x60, 0x14, 0x89, 0x05, 0xAE, 0x47, 0x00,
-	0xB8, 0xF3, 0x54, 0x00, 0x38, 0x84, 0x80, 0xDF, 0xC7, 0xCF, 0x17, 0x12,
-	0xE3, 0x98, 0x3A, 0x01, 0x02, 0x04, 0x08, 0x10, 0xE8, 0x55, 0xE0, 0xF9,
-	0x08, 0x00, 0xDF, 0x5D, 0x14, 0x00, 0xBC, 0x0C, 0xD0, 0x6B, 0xD9, 0xCD,
-	0x8B, 0x00, 0x01, 0x02, 0x04, 0xCA, 0x08, 0xD4, 0x79, 0xB1, 0xEB, 0xD1,
-	0xDD, 0xFF, 0x17, 0x05, 0x80, 0x57, 0xE3, 0x1F, 0xBE, 0x2E, 0x23, 0xA4,
-	0x17, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0xA0, 0x90, 0xC0, 0x5B, 0xF1,
-	0xEC, 0xFF, 0x8B, 0xB3, 0x7D, 0x3D, 0xBA, 0x07, 0xE0, 0xF4, 0xFF, 0xE9,
-	0xDD, 0x00, 0x85, 0x4A, 0xA1, 0x1B, 0x02, 0x04, 0x08, 0x10, 0x20, 0x50,
-	0x46, 0xE0, 0xB1, 0x9B, 0xFF, 0xCE, 0xBD, 0x02, 0x30, 0xFC, 0x3F, 0xB3,
-	0x7F, 0x3D, 0xB0, 0xCF, 0xE1, 0x28, 0xB3, 0x1A, 0xF5, 0x42, 0x80, 0x00,
-	0x01, 0x02, 0xC5, 0x04, 0x9E, 0x7A, 0xF6, 0x3F, 0xF4, 0x7C, 0xDE, 0x15,
-	0x00, 0x1F, 0x0A, 0x54, 0xAC, 0x26, 0x3A, 0x22, 0x40, 0x80, 0x00, 0x01,
-	0x02, 0x9B, 0x0A, 0x3C, 0x88, 0x4B, 0xFF, 0x2F, 0x9E, 0xD7, 0xC3, 0x53,
-	0x01, 0xE0, 0x70, 0x15, 0x20, 0xC9, 0xCD, 0x80, 0x9E, 0xEF, 0x6F, 0xBA,
-	0xEC, 0x34, 0x9E, 0x56, 0xC0, 0x6F, 0x56, 0xDA, 0xD2, 0x9B, 0x78, 0x7D,
-	0x02, 0x8F, 0xBD, 0xF5, 0xEF, 0xEC, 0xF0, 0x2E, 0x0A, 0x00, 0x2F, 0xC5,
-	0x41, 0xBF, 0xAB, 0x6F, 0x1E, 0x46, 0x44, 0x80, 0x40, 0x79, 0x01, 0xDB,
-	0xF9, 0x28, 0x73, 0x4C, 0xA3, 0x98, 0x1C, 0x54, 0x54, 0xE0, 0xC2, 0x67,
-	0xFF, 0xE7, 0xBE, 0x04, 0x70, 0x3A, 0xB4, 0xB8, 0x17, 0x20, 0xC9, 0x55,
-	0x80, 0xA2, 0xC5, 0xD0, 0xD9, 0x06, 0x02, 0x75, 0xBE, 0xE3, 0x66, 0x83,
-	0x89, 0x6A, 0x92, 0x00, 0x01, 0x02, 0xD3, 0x04, 0xCE, 0x7D, 0xED, 0xFF,
-	0xB4, 0x89, 0x73, 0xAF, 0x00, 0x1C, 0x5E, 0x06, 0x70, 0x15, 0x60, 0x1A,
-	0xB4, 0xA3, 0x09, 0x10, 0x20, 0x40, 0x80, 0x40, 0x2D, 0x02, 0x4F, 0xBD,
-	0xEF, 0xFF, 0xC9, 0x81, 0x5D, 0x18, 0x00, 0x0E, 0x21, 0xE0, 0xC3, 0xF8,
-	0x79, 0xB3, 0x96, 0xD9, 0x18, 0x07, 0x01, 0x02, 0x04, 0x08, 0x10, 0x20,
-	0x30, 0x4A, 0xE0, 0xD1, 0x97, 0xFE, 0x5C, 0x74, 0xF4, 0xB1, 0x00, 0x30,
-	0xBC, 0x23, 0xE0, 0x9B, 0x78, 0xF8, 0x78, 0xE0, 0x51, 0xDE, 0x0E, 0x22,
-	0x40, 0x80, 0x00, 0x01, 0x02, 0xBB, 0x0B, 0x3C, 0xFA, 0xCA, 0xDF, 0xCB,
-	0x46, 0x72, 0x69, 0x00, 0x38, 0x5C, 0x05, 0x78, 0x2F, 0x7E, 0xDE, 0xDE,
-	0x7D, 0x3A, 0x06, 0x40, 0x80, 0x00, 0x01, 0x02, 0x04, 0x08, 0x1C, 0x13,
-	0x38, 0xF7, 0x43, 0x7F, 0xCE, 0x3B, 0xE9, 0x68, 0x00, 0x38, 0x84, 0x80,
-	0x5F, 0xC5, 0xCF, 0xD7, 0x8F, 0xF5, 0x9A, 0xEB, 0xDF, 0xDD, 0xF2, 0x9B,
-	0xAB, 0xDE, 0x66, 0x4B, 0x80, 0x00, 0x81, 0x26, 0x04, 0x8E, 0x5E, 0xFA,
-	0x3F, 0x9D, 0xC5, 0xD8, 0x00, 0xE0, 0x3B, 0x02, 0x9A, 0xA8, 0x7B, 0x1D,
-	0x83, 0x14, 0x8D, 0xEA, 0xA8, 0xC3, 0x85, 0xA3, 0xF0, 0xB6, 0x89, 0xCA,
-	0x0B, 0x64, 0x78, 0x04, 0x66, 0x0B, 0x5C, 0xF8, 0x9E, 0xFF, 0xD9, 0x57,
-	0x00, 0xCE, 0xBE, 0x14, 0xD0, 0xF6, 0xDF, 0x0E, 0x5B, 0xD3, 0xEC, 0x65,
-	0xE5, 0x44, 0x02, 0x04, 0xC6, 0x09, 0xF8, 0x33, 0x33, 0xCE, 0xC9, 0x51,
-	0x4F, 0x08, 0x2C, 0x5E, 0x38, 0xB7, 0xE2, 0x13, 0xFF, 0x3E, 0x98, 0xC2,
-	0x3A, 0xEA, 0x0A, 0xC0, 0x69, 0x83, 0xF1, 0xD9, 0x00, 0x9F, 0xC4, 0xFF,
-	0x7E, 0x67, 0x4A, 0x07, 0x8E, 0x25, 0x40, 0x80, 0x00, 0x01, 0x02, 0x04,
-	0x36, 0x15, 0x78, 0x10, 0xAD, 0xBF, 0x12, 0x01, 0xE0, 0xBB, 0x29, 0xBD,
-	0x4C, 0x0D, 0x00, 0xDE, 0x15, 0x30, 0x45, 0xD7, 0xB1, 0x04, 0x08, 0x10,
-	0x20, 0x40, 0x60, 0x5B, 0x81, 0x61, 0xF3, 0x7F, 0x2D, 0x36, 0xFF, 0x6F,
-	0xA7, 0x76, 0x33, 0x29, 0x00, 0x0C, 0x8D, 0xC7, 0x55, 0x80, 0x6B, 0xF1,
-	0xE3, 0xF3, 0xA9, 0x1D, 0x39, 0x9E, 0x00, 0x01, 0x02, 0xCD, 0x08, 0xB4,
-	0xFD, 0x5A, 0x67, 0x33, 0xCC, 0x06, 0xBA, 0x8A, 0xC0, 0xD5, 0xD8, 0xFC,
-	0xEF, 0xCF, 0x69, 0x69, 0x72, 0x00, 0x38, 0x84, 0x00, 0x6F, 0x0D, 0x9C,
-	0xA3, 0xED, 0x1C, 0x02, 0x04, 0x08, 0x10, 0x20, 0xB0, 0x9E, 0xC0, 0xA5,
-	0x1F, 0xF5, 0x7B, 0xAC, 0x9B, 0x59, 0x01, 0xE0, 0x10, 0x02, 0x7C, 0x4A,
-	0xE0, 0x31, 0x5D, 0xFF, 0x4E, 0x60, 0x17, 0x01, 0x4F, 0x5F, 0x77, 0x61,
-	0xBF, 0xAC, 0xD3, 0xC5, 0xF7, 0x77, 0x55, 0x37, 0x23, 0x03, 0xDA, 0x5F,
-	0x60, 0xD2, 0x1D, 0xFF, 0xE7, 0x0D, 0x77, 0x76, 0x00, 0x38, 0x84, 0x00,
-	0x5F, 0x18, 0xB4, 0xFF, 0x22, 0x30, 0x02, 0x02, 0x04, 0x08, 0x10, 0xC8,
-	0x25, 0xB0, 0x78, 0xF3, 0x1F, 0xB8, 0x16, 0x05, 0x80, 0x43, 0x08, 0xF0,
-	0xCE, 0x80, 0x5C, 0x0B, 0xCF, 0x6C, 0x09, 0x10, 0x20, 0x40, 0x60, 0x3F,
-	0x81, 0x45, 0x97, 0xFD, 0xCF, 0x0E, 0x7B, 0x8D, 0x00, 0x30, 0xBC, 0x33,
-	0xE0, 0xCB, 0x78, 0xF8, 0xA4, 0xC0, 0xFD, 0x16, 0x84, 0x9E, 0x09, 0x10,
-	0x20, 0x40, 0xA0, 0x7F, 0x81, 0xD5, 0x36, 0xFF, 0x55, 0xAE, 0x00, 0x1C,
-	0xAE, 0x02, 0x08, 0x01, 0xFD, 0x2F, 0x3C, 0x33, 0x24, 0x40, 0x80, 0x00,
-	0x81, 0xFD, 0x04, 0x66, 0xDF, 0xED, 0x7F, 0xD1, 0x90, 0x17, 0x5F, 0x01,
-	0x38, 0x6D, 0x38, 0xDE, 0x1E, 0x28, 0x04, 0xEC, 0xB7, 0x30, 0xF4, 0x4C,
-	0x80, 0x00, 0x81, 0xF2, 0x02, 0x6E, 0x6E, 0x2C, 0x61, 0x7E, 0x2F, 0x3A,
-	0x79, 0x7B, 0xCE, 0xFB, 0xFC, 0x8F, 0x0D, 0x6E, 0xB5, 0x00, 0x50, 0xF5,
-	0x95, 0x00, 0x37, 0x45, 0x1F, 0x5B, 0x07, 0xFE, 0x9D, 0x00, 0x01, 0x02,
-	0x04, 0xEA, 0x13, 0x98, 0xFC, 0xF1, 0xBE, 0x53, 0xA6, 0xB0, 0x6A, 0x00,
-	0x38, 0x84, 0x80, 0x97, 0xE2, 0xE7, 0xA7, 0xF1, 0x70, 0x4F, 0xC0, 0x94,
-	0x4A, 0x38, 0x96, 0x00, 0x01, 0x02, 0x04, 0x08, 0xFC, 0x49, 0x60, 0xD5,
-	0xD7, 0xFB, 0xCF, 0x83, 0x5D, 0x3D, 0x00, 0x9C, 0xB9, 0x12, 0xF0, 0x4D,
-	0xFC, 0xEF, 0x17, 0x54, 0x93, 0x00, 0x01, 0x02, 0x04, 0x08, 0x10, 0x18,
-	0x2D, 0x70, 0x37, 0x8E, 0xFC, 0xD9, 0x16, 0x97, 0xFC, 0x9F, 0x1C, 0xC1,
-	0x26, 0x01, 0x40, 0x08, 0x18, 0x5D, 0x68, 0x07, 0x12, 0x20, 0x40, 0x80,
-	0x00, 0x81, 0x41, 0x60, 0xF8, 0x4C, 0xFF, 0x0F, 0x62, 0xE3, 0xBF, 0x53,
-	0x8A, 0x63, 0xB3, 0x00, 0x70, 0x08, 0x01, 0xC3, 0xCB, 0x01, 0x5F, 0xB9,
-	0x12, 0x50, 0xAA, 0x9C, 0xFA, 0x21, 0x40, 0x80, 0x00, 0x81, 0x06, 0x05,
-	0x6E, 0xC5, 0x98, 0x7F, 0x3E, 0xF5, 0xDB, 0xFC, 0x96, 0xCE, 0x73, 0xD3,
-	0x00, 0xB0, 0x69, 0x08, 0x70, 0x63, 0xDF, 0xD2, 0xDA, 0x3B, 0x9F, 0x00,
-	0x01, 0x02, 0x04, 0xF6, 0x15, 0x18, 0x2E, 0xF7, 0x0F, 0x1B, 0xFF, 0xAC,
-	0x2F, 0xF3, 0x59, 0x3A, 0xF4, 0xCD, 0x03, 0xC0, 0xA6, 0x21, 0x60, 0xE9,
-	0xEC, 0x9D, 0x5F, 0x5E, 0xC0, 0xDB, 0x86, 0xCA, 0x9B, 0xEB, 0x91, 0x00,
-	0x81, 0xDA, 0x04, 0x76, 0xDD, 0xF8, 0x4F, 0x31, 0x8A, 0x04, 0x00, 0x21,
-	0xA0, 0xB6, 0xB5, 0x67, 0x3C, 0x04, 0x08, 0xEC, 0x21, 0x20, 0xFF, 0xEE,
-	0xA1, 0x5E, 0x55, 0x9F, 0x55, 0x6C, 0xFC, 0xC5, 0x03, 0x80, 0x10, 0x50,
-	0xD5, 0x22, 0x34, 0x18, 0x02, 0x04, 0x08, 0x10, 0x28, 0x23, 0x30, 0xDC,
-	0xDC, 0xF7, 0x57, 0xF1, 0xB8, 0x53, 0xE2, 0xCE, 0xFE, 0x29, 0x53, 0x2A,
-	0x76, 0x05, 0xE0, 0x74, 0x50, 0xF1, 0x89, 0x81, 0x6E, 0x0C, 0x9C, 0x52,
-	0x21, 0xC7, 0x12, 0x20, 0x40, 0x80, 0xC0, 0x86, 0x02, 0x9B, 0xDD, 0x50,
-	0x36, 0xDC, 0xD8, 0xF7, 0x69, 0x6C, 0xFA, 0x5F, 0x6C, 0x38, 0xF8, 0x45,
-	0x4D, 0x17, 0x0F, 0x00, 0x87, 0x2B, 0x01, 0xAF, 0xC6, 0xCF, 0xCF, 0xE2,
-	0x91, 0xF8, 0x73, 0x02, 0x36, 0x5B, 0x74, 0x8B, 0x16, 0x44, 0x73, 0x27,
-	0xBB, 0xA6, 0xDA, 0x5C, 0xC9, 0x0C, 0x98, 0x40, 0xA7, 0x02, 0xC3, 0x47,
-	0xF6, 0xDE, 0x8E, 0xC7, 0x3F, 0xD4, 0xBC, 0xE9, 0x9F, 0xB5, 0xDF, 0x25,
-	0x00, 0x08, 0x01, 0x9D, 0x2E, 0x7F, 0xD3, 0x22, 0x40, 0x80, 0x40, 0x0E,
-	0x81, 0xE1, 0xB2, 0xFE, 0xFF, 0x8A, 0xC7, 0xDF, 0x0D, 0x1B, 0x7E, 0x3C,
-	0x7E, 0x59, 0xFA, 0x2D, 0x7C, 0x6B, 0x30, 0xEF, 0x16, 0x00, 0xCE, 0x84,
-	0x80, 0xAF, 0xD7, 0x98, 0x88, 0x36, 0x08, 0x10, 0x20, 0x40, 0xA0, 0x39,
-	0x81, 0x61, 0x23, 0x1D, 0xAE, 0x04, 0x0F, 0x3F, 0xE7, 0xFE, 0xF7, 0xDB,
-	0x38, 0xF1, 0x47, 0xF1, 0x18, 0x7E, 0x2E, 0xFD, 0xEF, 0x6C, 0x1B, 0xBF,
-	0x3E, 0x34, 0xF6, 0x9B, 0xF8, 0xF9, 0xED, 0x61, 0x8C, 0xFF, 0x54, 0xDB,
-	0xEB, 0xF8, 0x4B, 0x26, 0xBC, 0x6B, 0x00, 0x10, 0x02, 0x96, 0x94, 0xAE,
-	0x9D, 0x73, 0x3B, 0x7D, 0xB1, 0xA3, 0xB6, 0x3F, 0x5C, 0xC3, 0x82, 0x58,
-	0xEB, 0x0F, 0xE1, 0xF0, 0x87, 0xEF, 0x27, 0xF1, 0x38, 0xEF, 0xE7, 0x88,
-	0x85, 0xF7, 0xFF, 0xE2, 0x98, 0x3F, 0xBB, 0xE8, 0xB8, 0xE1, 0x8F, 0xE9,
-	0x8F, 0xE3, 0x71, 0xDE, 0xCF, 0x11, 0x6D, 0x5F, 0x7A, 0xC8, 0xF0, 0x47,
-	0x7A, 0xB8, 0xC7, 0xE8, 0xBC, 0x9F, 0x4B, 0xDB, 0x3E, 0x5B, 0xEF, 0xA5,
-	0x1B, 0xD6, 0x30, 0x96, 0x7F, 0x8E, 0xC7, 0x0F, 0x0F, 0x3F, 0xE7, 0x8C,
-	0xED, 0x0F, 0x33, 0x4E, 0x1A, 0x75, 0x4E, 0x8B, 0xCF, 0x64, 0x67, 0x58,
-	0x38, 0x25, 0x04, 0x76, 0x0F, 0x00, 0x42, 0x80, 0x75, 0x58, 0xB9, 0xC0,
-	0xF0, 0xBA, 0xDE, 0x9B, 0xFE, 0x28, 0x56, 0x5E, 0x25, 0xC3, 0x23, 0x40,
-	0x60, 0xBA, 0x8D, 0xEC, 0xD4, 0x00, 0x00, 0x11, 0x85, 0x49, 0x44, 0x41,
-	0x54, 0xB2, 0x40, 0x15, 0x01, 0x40, 0x08, 0x98, 0x5C, 0x37, 0x27, 0x94,
-	0x15, 0x10, 0x02, 0xCA, 0x7A, 0xEB, 0x8D, 0x00, 0x81, 0x02, 0x02, 0xD5,
-	0x04, 0x00, 0x21, 0xA0, 0x40, 0xB5, 0x75, 0xB1, 0x44, 0x40, 0x08, 0x58,
-	0xA2, 0xE7, 0x5C, 0x02, 0x04, 0xAA, 0x13, 0xA8, 0x2A, 0x00, 0x08, 0x01,
-	0xD5, 0xAD, 0x0F, 0x03, 0x7A, 0x5C, 0x40, 0x08, 0xB0, 0x22, 0x08, 0x10,
-	0xE8, 0x46, 0xA0, 0xBA, 0x00, 0x70, 0x08, 0x01, 0xD7, 0xE2, 0xE7, 0xE7,
-	0xDD, 0x28, 0x9B, 0x48, 0x4F, 0x02, 0xC3, 0x47, 0x79, 0xFE, 0xD4, 0x3D,
-	0x01, 0x3D, 0x95, 0xD4, 0x5C, 0x08, 0xE4, 0x14, 0xA8, 0x32, 0x00, 0x08,
-	0x01, 0x39, 0x17, 0x63, 0x8D, 0xB3, 0xBE, 0xE0, 0x1D, 0x0C, 0x77, 0x23,
-	0x00, 0xBC, 0x5B, 0xE3, 0x78, 0x8D, 0x89, 0x00, 0x01, 0x02, 0x63, 0x05,
-	0xAA, 0x0D, 0x00, 0x42, 0xC0, 0xD8, 0x12, 0x3A, 0x6E, 0x27, 0x01, 0x21,
-	0x60, 0x27, 0x78, 0xDD, 0x12, 0x20, 0xB0, 0x8E, 0x40, 0xD5, 0x01, 0x40,
-	0x08, 0x58, 0xA7, 0xC8, 0x5A, 0xD9, 0x4C, 0x40, 0x08, 0xD8, 0x8C, 0x56,
-	0xC3, 0x04, 0x08, 0x6C, 0x2D, 0x50, 0x7D, 0x00, 0x10, 0x02, 0xB6, 0x5E,
-	0x02, 0xDA, 0x5F, 0x28, 0x20, 0x04, 0x2C, 0x04, 0x74, 0x3A, 0x01, 0x02,
-	0xFB, 0x08, 0x34, 0x11, 0x00, 0x9A, 0x09, 0x01, 0x9D, 0x7E, 0xE4, 0xDD,
-	0x3E, 0x4B, 0xB3, 0xA9, 0x5E, 0x85, 0x80, 0xA6, 0xCA, 0x65, 0xB0, 0x04,
-	0x08, 0x0C, 0x02, 0xCD, 0x04, 0x80, 0x66, 0x42, 0x80, 0x75, 0x95, 0x55,
-	0xE0, 0x56, 0xDC, 0x18, 0xF8, 0x41, 0xD6, 0xC9, 0x9B, 0x37, 0x01, 0x02,
-	0xED, 0x09, 0x34, 0x15, 0x00, 0x84, 0x80, 0xF6, 0x16, 0x58, 0xB2, 0x11,
-	0x0B, 0x01, 0xC9, 0x0A, 0x6E, 0xBA, 0x04, 0x5A, 0x16, 0x68, 0x2E, 0x00,
-	0x1C, 0x42, 0xC0, 0x7B, 0xF1, 0x73, 0xF8, 0xDE, 0x65, 0xFF, 0x11, 0xA8,
-	0x4D, 0x40, 0x08, 0xA8, 0xAD, 0x22, 0xC6, 0x43, 0x80, 0xC0, 0xB9, 0x02,
-	0x4D, 0x06, 0x00, 0x21, 0xC0, 0x6A, 0xAE, 0x5C, 0x40, 0x08, 0xA8, 0xBC,
-	0x40, 0x86, 0x47, 0x80, 0x40, 0x63, 0xF7, 0x00, 0x3C, 0x59, 0xB0, 0x87,
-	0x0F, 0x1F, 0xBA, 0x12, 0x60, 0x15, 0xD7, 0x2A, 0x20, 0x04, 0xD4, 0x5A,
-	0x19, 0xE3, 0x22, 0x40, 0xE0, 0x44, 0xA0, 0xD9, 0x2B, 0x00, 0xA7, 0xF5,
-	0x5B, 0x14, 0x02, 0xDC, 0xB5, 0xEF, 0xD7, 0x60, 0x5B, 0x01, 0x21, 0x60,
-	0x5B, 0x5F, 0xAD, 0x13, 0x20, 0xB0, 0x40, 0xA0, 0xF9, 0x00, 0xE0, 0xE5,
-	0x80, 0x05, 0xD5, 0x77, 0x6A, 0x09, 0x81, 0x1B, 0xF1, 0xEE, 0x80, 0x8F,
-	0x4A, 0x74, 0xA4, 0x0F, 0x02, 0x04, 0x08, 0x4C, 0x11, 0xE8, 0x22, 0x00,
-	0x08, 0x01, 0x53, 0x4A, 0xEE, 0xD8, 0x1D, 0x04, 0x84, 0x80, 0x1D, 0xD0,
-	0x75, 0x49, 0x80, 0xC0, 0xE5, 0x02, 0xDD, 0x04, 0x00, 0x21, 0xC0, 0x52,
-	0xAF, 0x5C, 0x40, 0x08, 0xA8, 0xBC, 0x40, 0x86, 0x47, 0x20, 0x9B, 0x40,
-	0x57, 0x01, 0xE0, 0x10, 0x02, 0x3E, 0x8C, 0x9F, 0x37, 0xB3, 0x15, 0xD2,
-	0x7C, 0x9B, 0x10, 0x10, 0x02, 0x9A, 0x28, 0x93, 0x41, 0x12, 0xC8, 0x21,
-	0xD0, 0x5D, 0x00, 0x10, 0x02, 0x72, 0x2C, 0xDC, 0x86, 0x67, 0x29, 0x04,
-	0x34, 0x5C, 0x3C, 0x43, 0x27, 0xD0, 0x93, 0x40, 0x97, 0x01, 0x40, 0x08,
-	0xE8, 0x69, 0x89, 0x76, 0x39, 0x17, 0x21, 0xA0, 0xCB, 0xB2, 0x9A, 0x14,
-	0x81, 0xB6, 0x04, 0xBA, 0x0D, 0x00, 0x42, 0x40, 0x5B, 0x0B, 0x31, 0xE1,
-	0x68, 0xAF, 0xC7, 0xBB, 0x03, 0xEE, 0x24, 0x9C, 0xB7, 0x29, 0x13, 0x20,
-	0x50, 0x89, 0x40, 0xD7, 0x01, 0x40, 0x08, 0xA8, 0x64, 0x95, 0x19, 0xC6,
-	0x45, 0x02, 0x42, 0x80, 0xB5, 0x41, 0x80, 0xC0, 0x6E, 0x02, 0xDD, 0x07,
-	0x00, 0x21, 0x60, 0xB7, 0xB5, 0xA5, 0xE3, 0x71, 0x02, 0x42, 0xC0, 0x38,
-	0x27, 0x47, 0x11, 0x20, 0xB0, 0xB2, 0x40, 0x8A, 0x00, 0x70, 0x08, 0x01,
-	0x1F, 0xC7, 0xCF, 0xF7, 0x57, 0xF6, 0xD3, 0x1C, 0x81, 0x35, 0x04, 0x84,
-	0x80, 0x35, 0x14, 0xB5, 0x41, 0x80, 0xC0, 0x24, 0x81, 0x34, 0x01, 0x40,
-	0x08, 0x98, 0xB4, 0x2E, 0x1C, 0x5C, 0x5E, 0x40, 0x08, 0x28, 0x6F, 0xAE,
-	0x47, 0x02, 0xA9, 0x05, 0x52, 0x05, 0x00, 0x21, 0x20, 0xF5, 0x5A, 0x6F,
-	0x61, 0xF2, 0x42, 0x40, 0x0B, 0x55, 0x32, 0x46, 0x02, 0x9D, 0x08, 0xA4,
-	0x0B, 0x00, 0x42, 0x40, 0x27, 0x2B, 0xB7, 0xDF, 0x69, 0x08, 0x01, 0xFD,
-	0xD6, 0xD6, 0xCC, 0x08, 0x54, 0x25, 0x90, 0x32, 0x00, 0x64, 0x0F, 0x01,
-	0xBE, 0x04, 0xB1, 0xD4, 0xEF, 0xE0, 0x6C, 0xE9, 0xB7, 0xE2, 0x2D, 0x82,
-	0x5F, 0x94, 0x1A, 0xA5, 0x7E, 0x08, 0x10, 0xC8, 0x29, 0x90, 0x36, 0x00,
-	0x64, 0x0F, 0x01, 0x39, 0x97, 0x7B, 0x53, 0xB3, 0x16, 0x02, 0x9A, 0x2A,
-	0x97, 0xC1, 0x12, 0x68, 0x4F, 0x20, 0x75, 0x00, 0x10, 0x02, 0xDA, 0x5B,
-	0xB0, 0xC9, 0x46, 0x2C, 0x04, 0x24, 0x2B, 0xB8, 0xE9, 0x12, 0x28, 0x29,
-	0x90, 0x3E, 0x00, 0x1C, 0x42, 0xC0, 0x27, 0xF1, 0xF3, 0x9D, 0x92, 0xF0,
-	0xFA, 0x22, 0x30, 0x52, 0x40, 0x08, 0x18, 0x09, 0xE5, 0x30, 0x02, 0x04,
-	0xA6, 0x09, 0x08, 0x00, 0x07, 0xAF, 0x87, 0x0F, 0x1F, 0x0A, 0x01, 0xD3,
-	0xD6, 0x8E, 0xA3, 0xCB, 0x09, 0x08, 0x01, 0xE5, 0xAC, 0xF5, 0x44, 0x20,
-	0x8D, 0x80, 0x00, 0x70, 0xA6, 0xD4, 0x42, 0x40, 0x9A, 0x75, 0xDF, 0xE2,
-	0x44, 0x85, 0x80, 0x16, 0xAB, 0x66, 0xCC, 0x04, 0x2A, 0x16, 0x10, 0x00,
-	0x9E, 0x28, 0x8E, 0x10, 0x70, 0xD1, 0x6A, 0x7D, 0x18, 0xFF, 0x60, 0xB9,
-	0xEC, 0xFC, 0xBB, 0x2C, 0x04, 0xEC, 0x5C, 0x00, 0xDD, 0x13, 0xE8, 0x49,
-	0xC0, 0x5F, 0xF4, 0x73, 0xAA, 0x29, 0x04, 0xF4, 0xB4, 0xC4, 0xBB, 0x9B,
-	0xCB, 0xD5, 0x78, 0x8B, 0xE0, 0xFD, 0xEE, 0x66, 0x65, 0x42, 0x04, 0x08,
-	0x14, 0x17, 0x10, 0x00, 0xCE, 0x0F, 0x00, 0xCF, 0xC5, 0xFF, 0xFB, 0x17,
-	0xF1, 0xB8, 0xFC, 0xC6, 0xC0, 0xD9, 0x6F, 0xF3, 0x2E, 0x5E, 0xE7, 0x47,
-	0x1D, 0x7A, 0x1E, 0xBF, 0x9F, 0xFD, 0x8A, 0x3D, 0x0B, 0x01, 0x2B, 0x62,
-	0x6A, 0x8A, 0x40, 0x56, 0x01, 0x01, 0xE0, 0x82, 0xCA, 0xC7, 0x55, 0x80,
-	0x71, 0x21, 0x20, 0xEB, 0xCA, 0x91, 0x24, 0xF6, 0xAE, 0xBC, 0x10, 0xB0,
-	0x77, 0x05, 0xF4, 0x4F, 0xA0, 0x71, 0x01, 0x01, 0xE0, 0x92, 0x02, 0x0A,
-	0x01, 0x8D, 0xAF, 0xEE, 0xFE, 0x87, 0x2F, 0x04, 0xF4, 0x5F, 0x63, 0x33,
-	0x24, 0xB0, 0x99, 0x80, 0x00, 0x70, 0x84, 0xF6, 0x10, 0x02, 0xBE, 0x8C,
-	0xC3, 0x5E, 0xDF, 0xAC, 0x0A, 0x1A, 0x26, 0x30, 0x5F, 0x40, 0x08, 0x98,
-	0x6F, 0xE7, 0x4C, 0x02, 0xA9, 0x05, 0x04, 0x80, 0x11, 0xE5, 0x17, 0x02,
-	0x46, 0x20, 0x39, 0x64, 0x4F, 0x01, 0x21, 0x60, 0x4F, 0x7D, 0x7D, 0x13,
-	0x68, 0x54, 0x40, 0x00, 0x18, 0x59, 0x38, 0x21, 0x60, 0x24, 0x94, 0xC3,
-	0xF6, 0x10, 0x78, 0x10, 0x9D, 0xFE, 0x85, 0x77, 0x07, 0xEC, 0x41, 0xAF,
-	0x4F, 0x02, 0xED, 0x0A, 0x08, 0x00, 0x13, 0x6A, 0x27, 0x04, 0x4C, 0xC0,
-	0x72, 0x68, 0x69, 0x81, 0x21, 0x04, 0xBC, 0x16, 0x21, 0xE0, 0xDB, 0xD2,
-	0x1D, 0xEB, 0x8F, 0x00, 0x81, 0x36, 0x05, 0x04, 0x80, 0x89, 0x75, 0x13,
-	0x02, 0x26, 0x82, 0x39, 0xBC, 0xA4, 0x80, 0x10, 0x50, 0x52, 0x5B, 0x5F,
-	0x04, 0x1A, 0x17, 0x10, 0x00, 0x66, 0x14, 0x50, 0x08, 0x98, 0x81, 0xE6,
-	0x94, 0x52, 0x02, 0x42, 0x40, 0x29, 0x69, 0xFD, 0x10, 0x68, 0x5C, 0x40,
-	0x00, 0x98, 0x59, 0xC0, 0x08, 0x01, 0x2F, 0xC5, 0xA9, 0x9F, 0xC6, 0xC3,
-	0xBB, 0x03, 0x66, 0x1A, 0x16, 0x3D, 0xAD, 0xC1, 0x0F, 0x6D, 0x5A, 0xE0,
-	0x23, 0x04, 0x2C, 0xC0, 0x73, 0x2A, 0x81, 0x2C, 0x02, 0x02, 0xC0, 0x82,
-	0x4A, 0x1F, 0xAE, 0x04, 0x7C, 0x13, 0x4D, 0xBC, 0xB0, 0xA0, 0x19, 0xA7,
-	0x12, 0xD8, 0x42, 0x40, 0x08, 0xD8, 0x42, 0x55, 0x9B, 0x04, 0x3A, 0x12,
-	0x10, 0x00, 0x16, 0x16, 0xF3, 0x70, 0x25, 0xE0, 0x2B, 0x21, 0x60, 0x21,
-	0xA4, 0xD3, 0xB7, 0x10, 0x10, 0x02, 0xB6, 0x50, 0xD5, 0x26, 0x81, 0x4E,
-	0x04, 0x04, 0x80, 0x15, 0x0A, 0xE9, 0x4A, 0xC0, 0x0A, 0x88, 0x9A, 0xD8,
-	0x4A, 0x40, 0x08, 0xD8, 0x4A, 0x56, 0xBB, 0x04, 0x1A, 0x17, 0x10, 0x00,
-	0x56, 0x2A, 0xA0, 0x2B, 0x01, 0x2B, 0x41, 0x6A, 0x66, 0x0B, 0x81, 0x7B,
-	0xD1, 0xE8, 0x9B, 0xF1, 0x16, 0xC1, 0xEF, 0xB6, 0x68, 0x5C, 0x9B, 0x04,
-	0x08, 0xB4, 0x29, 0x20, 0x00, 0xAC, 0x58, 0x37, 0x21, 0x60, 0x45, 0x4C,
-	0x4D, 0xAD, 0x2D, 0x30, 0x5C, 0x09, 0x78, 0x45, 0x08, 0x58, 0x9B, 0x55,
-	0x7B, 0x04, 0xDA, 0x15, 0x10, 0x00, 0x56, 0xAE, 0x5D, 0x93, 0x21, 0xC0,
-	0x37, 0xFB, 0xAD, 0xBC, 0x0A, 0xAA, 0x6D, 0xCE, 0x95, 0x80, 0x6A, 0x4B,
-	0x63, 0x60, 0x04, 0xCA, 0x0B, 0x08, 0x00, 0x1B, 0x98, 0x37, 0x19, 0x02,
-	0x36, 0x70, 0xD0, 0x64, 0x95, 0x02, 0x42, 0x40, 0x95, 0x65, 0x31, 0x28,
-	0x02, 0xE5, 0x05, 0x04, 0x80, 0x8D, 0xCC, 0x85, 0x80, 0x8D, 0x60, 0x35,
-	0xBB, 0x86, 0x80, 0x10, 0xB0, 0x86, 0xA2, 0x36, 0x08, 0x34, 0x2E, 0x20,
-	0x00, 0x6C, 0x58, 0xC0, 0x08, 0x01, 0xAF, 0x46, 0xF3, 0x9F, 0xC5, 0xC3,
-	0xE7, 0x04, 0x6C, 0xE8, 0xAC, 0xE9, 0x59, 0x02, 0x42, 0xC0, 0x2C, 0x36,
-	0x27, 0x11, 0xE8, 0x47, 0x40, 0x00, 0xD8, 0xB8, 0x96, 0x4F, 0x86, 0x80,
-	0x5C, 0x1F, 0x48, 0xB7, 0x31, 0xAE, 0xE6, 0x97, 0x0A, 0x08, 0x01, 0x4B,
-	0x05, 0x9D, 0x4F, 0xA0, 0x61, 0x01, 0x01, 0xA0, 0x40, 0xF1, 0x0E, 0x21,
-	0xE0, 0xEB, 0x02, 0x5D, 0xE9, 0x82, 0xC0, 0x54, 0x01, 0x21, 0x60, 0xAA,
-	0x98, 0xE3, 0x09, 0x74, 0x22, 0x20, 0x00, 0x14, 0x2A, 0xA4, 0x10, 0x50,
-	0x08, 0x5A, 0x37, 0x73, 0x04, 0xEE, 0xC6, 0x49, 0x3F, 0xF5, 0x16, 0xC1,
-	0x39, 0x74, 0xCE, 0x21, 0xD0, 0xAE, 0x80, 0x00, 0x50, 0xB0, 0x76, 0x42,
-	0x40, 0x41, 0x6C, 0x5D, 0x4D, 0x15, 0xB8, 0x1B, 0x01, 0xE0, 0xDD, 0xA9,
-	0x27, 0x39, 0x9E, 0x00, 0x81, 0x76, 0x05, 0x04, 0x80, 0xC2, 0xB5, 0x13,
-	0x02, 0x0A, 0x83, 0xEB, 0x6E, 0x8A, 0x80, 0x10, 0x30, 0x45, 0xCB, 0xB1,
-	0x04, 0x1A, 0x17, 0x10, 0x00, 0x76, 0x28, 0xA0, 0x10, 0xB0, 0x03, 0xBA,
-	0x2E, 0xC7, 0x0A, 0x08, 0x01, 0x63, 0xA5, 0x1C, 0x47, 0xA0, 0x71, 0x01,
-	0x01, 0x60, 0xA7, 0x02, 0x0A, 0x01, 0x3B, 0xC1, 0xEB, 0x76, 0x8C, 0x80,
-	0x10, 0x30, 0x46, 0xC9, 0x31, 0x04, 0x1A, 0x17, 0x10, 0x00, 0x76, 0x2C,
-	0x60, 0x84, 0x80, 0x6B, 0xD1, 0xFD, 0xE7, 0x3B, 0x0E, 0x41, 0xD7, 0x95,
-	0x0B, 0xEC, 0xF8, 0x29, 0xCD, 0x42, 0x40, 0xE5, 0x6B, 0xC3, 0xF0, 0x08,
-	0x2C, 0x15, 0x10, 0x00, 0x96, 0x0A, 0x2E, 0x3C, 0x7F, 0x72, 0x08, 0xD8,
-	0x71, 0x47, 0x58, 0x38, 0xD5, 0xB2, 0xA7, 0x73, 0x5A, 0xC3, 0xFB, 0x56,
-	0xDC, 0x18, 0xF8, 0xC1, 0x1A, 0x0D, 0x69, 0x83, 0x00, 0x81, 0xFA, 0x04,
-	0x04, 0x80, 0x0A, 0x6A, 0x32, 0x39, 0x04, 0x54, 0x30, 0x66, 0x43, 0x48,
-	0x23, 0x70, 0x23, 0x42, 0xC0, 0x47, 0x69, 0x66, 0x6B, 0xA2, 0x04, 0x12,
-	0x09, 0x08, 0x00, 0x95, 0x14, 0x5B, 0x08, 0xA8, 0xA4, 0x10, 0x86, 0x71,
-	0x9E, 0xC0, 0xF5, 0x08, 0x01, 0x77, 0xD0, 0x10, 0x20, 0xD0, 0x97, 0x80,
-	0x00, 0x50, 0x51, 0x3D, 0x85, 0x80, 0x8A, 0x8A, 0x61, 0x28, 0x4F, 0x0A,
-	0xBC, 0x15, 0x21, 0xE0, 0x0B, 0x2C, 0x04, 0x08, 0xF4, 0x23, 0x20, 0x00,
-	0x54, 0x56, 0x4B, 0x21, 0xA0, 0xB2, 0x82, 0x18, 0xCE, 0x59, 0x81, 0xAB,
-	0x11, 0x02, 0xEE, 0x23, 0x21, 0x40, 0xA0, 0x0F, 0x01, 0x01, 0xA0, 0xC2,
-	0x3A, 0x0A, 0x01, 0x15, 0x16, 0x65, 0xC2, 0x90, 0x3A, 0xFE, 0xC2, 0xA7,
-	0x07, 0xC1, 0xF0, 0x8A, 0x8F, 0x0C, 0x9E, 0xB0, 0x18, 0x1C, 0x4A, 0xA0,
-	0x62, 0x01, 0x01, 0xA0, 0xD2, 0xE2, 0x08, 0x01, 0x95, 0x16, 0xC6, 0xB0,
-	0xBC, 0x33, 0xC0, 0x1A, 0x20, 0xD0, 0x89, 0x80, 0x00, 0x50, 0x71, 0x21,
-	0x23, 0x04, 0xBC, 0x17, 0xC3, 0xBB, 0x5D, 0xF1, 0x10, 0x0D, 0x2D, 0xA7,
-	0x80, 0xFB, 0x01, 0x72, 0xD6, 0xDD, 0xAC, 0x3B, 0x13, 0x10, 0x00, 0x2A,
-	0x2F, 0xA8, 0x10, 0x50, 0x79, 0x81, 0xF2, 0x0E, 0xEF, 0xE5, 0x78, 0x29,
-	0xE0, 0xDB, 0xBC, 0xD3, 0x37, 0x73, 0x02, 0xED, 0x0B, 0x08, 0x00, 0x0D,
-	0xD4, 0x50, 0x08, 0xA8, 0xAC, 0x48, 0x1D, 0xBF, 0xC8, 0x3F, 0x41, 0xDA,
-	0x27, 0x05, 0x4E, 0xC0, 0x72, 0x28, 0x81, 0x1A, 0x05, 0x04, 0x80, 0x1A,
-	0xAB, 0x72, 0xCE, 0x98, 0x84, 0x80, 0x46, 0x0A, 0x95, 0x6B, 0x98, 0x5E,
-	0x0A, 0xC8, 0x55, 0x6F, 0xB3, 0xED, 0x4C, 0x40, 0x00, 0x68, 0xA8, 0xA0,
-	0x42, 0x40, 0x43, 0xC5, 0xCA, 0x31, 0x54, 0xEF, 0x0A, 0xC8, 0x51, 0x67,
-	0xB3, 0xEC, 0x54, 0x40, 0x00, 0x68, 0xAC, 0xB0, 0x42, 0x40, 0x63, 0x05,
-	0xEB, 0x7F, 0xB8, 0x3E, 0x2A, 0xB8, 0xFF, 0x1A, 0x9B, 0x61, 0xA7, 0x02,
-	0x02, 0x40, 0x83, 0x85, 0x15, 0x02, 0x1A, 0x2C, 0x5A, 0xDF, 0x43, 0x76,
-	0x43, 0x60, 0xDF, 0xF5, 0x35, 0xBB, 0x4E, 0x05, 0x04, 0x80, 0x46, 0x0B,
-	0x1B, 0x21, 0xE0, 0xC3, 0x18, 0xFA, 0xCD, 0x46, 0x87, 0x6F, 0xD8, 0xDD,
-	0x08, 0x9C, 0x7C, 0xED, 0xA2, 0xCF, 0x06, 0xE8, 0xA6, 0x9E, 0x26, 0x92,
-	0x49, 0x40, 0x00, 0x68, 0xB8, 0xDA, 0x42, 0x40, 0xC3, 0xC5, 0xEB, 0x6F,
-	0xE8, 0xAE, 0x02, 0xF4, 0x57, 0x53, 0x33, 0xEA, 0x5C, 0x40, 0x00, 0x68,
-	0xBC, 0xC0, 0x42, 0x40, 0xE3, 0x05, 0xEC, 0x67, 0xF8, 0xAE, 0x02, 0xF4,
-	0x53, 0x4B, 0x33, 0x49, 0x22, 0x20, 0x00, 0x74, 0x50, 0x68, 0x21, 0xA0,
-	0x83, 0x22, 0xF6, 0x31, 0x85, 0xE7, 0x7D, 0x4F, 0x40, 0x1F, 0x85, 0x34,
-	0x8B, 0x1C, 0x02, 0x02, 0x40, 0x27, 0x75, 0x16, 0x02, 0xB6, 0x28, 0xE4,
-	0xC9, 0xEB, 0xDB, 0x5B, 0x34, 0xDC, 0x6B, 0x9B, 0xDE, 0x11, 0xD0, 0x6B,
-	0x65, 0xCD, 0xAB, 0x4B, 0x01, 0x7F, 0xDD, 0x3A, 0x2A, 0xAB, 0x10, 0xD0,
-	0x51, 0x31, 0xDB, 0x9C, 0xCA, 0x83, 0xB8, 0x02, 0xF0, 0x62, 0x9B, 0x43,
-	0x37, 0x6A, 0x02, 0xF9, 0x04, 0x04, 0x80, 0xCE, 0x6A, 0x1E, 0x21, 0xE0,
-	0xE3, 0x98, 0xD2, 0xFB, 0x9D, 0x4D, 0xCB, 0x74, 0xDA, 0x11, 0xF0, 0xE9,
-	0x80, 0xED, 0xD4, 0xCA, 0x48, 0x93, 0x0B, 0x08, 0x00, 0x1D, 0x2E, 0x00,
-	0x21, 0xA0, 0xC3, 0xA2, 0xB6, 0x33, 0x25, 0x37, 0x03, 0xB6, 0x53, 0x2B,
-	0x23, 0x4D, 0x2E, 0x20, 0x00, 0x74, 0xBA, 0x00, 0x84, 0x80, 0x4E, 0x0B,
-	0xDB, 0xC0, 0xB4, 0xE2, 0x65, 0x00, 0x7F, 0x57, 0x1A, 0xA8, 0x93, 0x21,
-	0x12, 0xF0, 0x8B, 0xDA, 0xF1, 0x1A, 0x10, 0x02, 0x3A, 0x2E, 0x6E, 0xDD,
-	0x53, 0xF3, 0x32, 0x40, 0xDD, 0xF5, 0x31, 0x3A, 0x02, 0x27, 0x02, 0x02,
-	0x40, 0xE7, 0x0B, 0x41, 0x08, 0xE8, 0xBC, 0xC0, 0x75, 0x4E, 0xCF, 0xCB,
-	0x00, 0x75, 0xD6, 0xC5, 0xA8, 0x08, 0x3C, 0x26, 0x20, 0x00, 0x24, 0x58,
-	0x10, 0xCD, 0x84, 0x00, 0xEF, 0xBA, 0xEB, 0x66, 0x35, 0x7A, 0x19, 0xA0,
-	0x9B, 0x52, 0x9A, 0x48, 0xC7, 0x02, 0x02, 0x40, 0xC7, 0xC5, 0x3D, 0x3B,
-	0xB5, 0x66, 0x42, 0x40, 0x92, 0x7A, 0x24, 0x98, 0xE6, 0xD5, 0x08, 0x01,
-	0xF7, 0x13, 0xCC, 0xD3, 0x14, 0x09, 0x34, 0x2B, 0x20, 0x00, 0x34, 0x5B,
-	0xBA, 0x69, 0x03, 0x8F, 0x00, 0xF0, 0x5C, 0x9C, 0xF1, 0x5F, 0xE3, 0xE1,
-	0x2D, 0x82, 0xD3, 0xE8, 0x1C, 0x3D, 0x4F, 0xE0, 0x7A, 0x04, 0x80, 0x3B,
-	0xF3, 0x4E, 0x75, 0x16, 0x01, 0x02, 0x25, 0x04, 0x04, 0x80, 0x12, 0xCA,
-	0x15, 0xF5, 0x11, 0x41, 0xE0, 0x93, 0x18, 0xCE, 0x3B, 0x15, 0x0D, 0xC9,
-	0x50, 0xFA, 0x14, 0xB8, 0x1B, 0x01, 0xE0, 0xDD, 0x3E, 0xA7, 0x66, 0x56,
-	0x04, 0xFA, 0x10, 0x10, 0x00, 0xFA, 0xA8, 0xE3, 0xA4, 0x59, 0x08, 0x01,
-	0x93, 0xB8, 0x1C, 0x3C, 0x4F, 0xC0, 0xA7, 0x02, 0xCE, 0x73, 0x73, 0x16,
-	0x81, 0x62, 0x02, 0x02, 0x40, 0x31, 0xEA, 0xBA, 0x3A, 0x12, 0x02, 0xEA,
-	0xAA, 0x47, 0xA7, 0xA3, 0xF1, 0x15, 0xC1, 0x9D, 0x16, 0xD6, 0xB4, 0xFA,
-	0x10, 0x10, 0x00, 0xFA, 0xA8, 0xE3, 0xAC, 0x59, 0x08, 0x01, 0xB3, 0xD8,
-	0x9C, 0x34, 0x5E, 0xC0, 0xE7, 0x01, 0x8C, 0xB7, 0x72, 0x24, 0x81, 0xE2,
-	0x02, 0x02, 0x40, 0x71, 0xF2, 0xBA, 0x3A, 0x14, 0x02, 0xEA, 0xAA, 0x47,
-	0x67, 0xA3, 0x71, 0x23, 0x60, 0x67, 0x05, 0x35, 0x9D, 0xBE, 0x04, 0x04,
-	0x80, 0xBE, 0xEA, 0x39, 0x79, 0x36, 0x87, 0x77, 0x07, 0xFC, 0x22, 0x4E,
-	0x74, 0x63, 0xE0, 0x64, 0x3D, 0x27, 0x1C, 0x11, 0xF0, 0x81, 0x40, 0x96,
-	0x08, 0x81, 0x8A, 0x05, 0x04, 0x80, 0x8A, 0x8B, 0x53, 0x6A, 0x68, 0x42,
-	0xC0, 0x14, 0x69, 0x9F, 0x56, 0x34, 0x41, 0xCB, 0x3B, 0x01, 0x26, 0x60,
-	0x39, 0x94, 0x40, 0x69, 0x01, 0x01, 0xA0, 0xB4, 0x78, 0xA5, 0xFD, 0x1D,
-	0x42, 0xC0, 0x97, 0x31, 0xBC, 0xD7, 0x2B, 0x1D, 0xA2, 0x61, 0xB5, 0x27,
-	0x70, 0x2F, 0xDE, 0x0A, 0xF8, 0x46, 0x7B, 0xC3, 0x36, 0x62, 0x02, 0x39,
-	0x04, 0x04, 0x80, 0x1C, 0x75, 0x1E, 0x35, 0x4B, 0x21, 0x60, 0x14, 0x93,
-	0x83, 0x26, 0x08, 0xF8, 0x48, 0xE0, 0x09, 0x58, 0x0E, 0x25, 0x50, 0x58,
-	0x40, 0x00, 0x28, 0x0C, 0x5E, 0x7B, 0x77, 0x42, 0x40, 0xED, 0x15, 0x6A,
-	0x6B, 0x7C, 0x02, 0x40, 0x5B, 0xF5, 0x32, 0xDA, 0x5C, 0x02, 0x02, 0x40,
-	0xAE, 0x7A, 0x8F, 0x9A, 0xAD, 0x10, 0x30, 0x8A, 0xC9, 0x41, 0x23, 0x04,
-	0x04, 0x80, 0x11, 0x48, 0x0E, 0x21, 0xB0, 0x93, 0x80, 0x00, 0xB0, 0x13,
-	0x7C, 0xED, 0xDD, 0x0A, 0x01, 0xB5, 0x57, 0xA8, 0x99, 0xF1, 0x3D, 0x1F,
-	0x21, 0xE0, 0xBB, 0x66, 0x46, 0x6B, 0xA0, 0x04, 0x12, 0x09, 0x08, 0x00,
-	0x89, 0x8A, 0x3D, 0x75, 0xAA, 0x42, 0xC0, 0x54, 0x31, 0xC7, 0x9F, 0x23,
-	0xE0, 0xD3, 0x00, 0x2D, 0x0B, 0x02, 0x95, 0x0A, 0x08, 0x00, 0x95, 0x16,
-	0xA6, 0x96, 0x61, 0x45, 0x08, 0x78, 0x29, 0xC6, 0xF2, 0x69, 0x3C, 0xBC,
-	0x3B, 0xA0, 0x96, 0xA2, 0xB4, 0x35, 0x0E, 0x01, 0xA0, 0xAD, 0x7A, 0x19,
-	0x6D, 0x22, 0x01, 0x01, 0x20, 0x51, 0xB1, 0xE7, 0x4E, 0xF5, 0x70, 0x25,
-	0xE0, 0x9B, 0x38, 0xFF, 0x85, 0xB9, 0x6D, 0x38, 0x2F, 0xAD, 0x80, 0x00,
-	0x90, 0xB6, 0xF4, 0x26, 0x5E, 0xBB, 0x80, 0x00, 0x50, 0x7B, 0x85, 0x2A,
-	0x19, 0x9F, 0x10, 0x50, 0x49, 0x21, 0xDA, 0x1B, 0x86, 0x00, 0xD0, 0x5E,
-	0xCD, 0x8C, 0x38, 0x89, 0x80, 0x00, 0x90, 0xA4, 0xD0, 0x6B, 0x4C, 0xF3,
-	0xF0, 0x72, 0xC0, 0x57, 0xAE, 0x04, 0xAC, 0xA1, 0x99, 0xA3, 0x0D, 0xEF,
-	0x02, 0xC8, 0x51, 0x67, 0xB3, 0x6C, 0x53, 0x40, 0x00, 0x68, 0xB3, 0x6E,
-	0xBB, 0x8D, 0x5A, 0x08, 0xD8, 0x8D, 0xBE, 0xC9, 0x8E, 0x05, 0x80, 0x26,
-	0xCB, 0x66, 0xD0, 0x49, 0x04, 0x04, 0x80, 0x24, 0x85, 0x5E, 0x73, 0x9A,
-	0x42, 0xC0, 0x9A, 0x9A, 0xB5, 0xB4, 0xF5, 0x7D, 0x0C, 0xE4, 0xD9, 0xD5,
-	0x07, 0x23, 0x00, 0xAC, 0x4E, 0xAA, 0x41, 0x02, 0xAB, 0x09, 0x08, 0x00,
-	0xAB, 0x51, 0xE6, 0x6A, 0x48, 0x08, 0xC8, 0x55, 0xEF, 0x99, 0xB3, 0x7D,
-	0x10, 0x01, 0xE0, 0xC5, 0x99, 0xE7, 0x3A, 0x8D, 0x00, 0x81, 0x8D, 0x05,
-	0x04, 0x80, 0x8D, 0x81, 0x7B, 0x6E, 0x5E, 0x08, 0xE8, 0xB9, 0xBA, 0xAB,
-	0xCC, 0xCD, 0x97, 0x01, 0xAD, 0xC2, 0xA8, 0x11, 0x02, 0xDB, 0x08, 0x08,
-	0x00, 0xDB, 0xB8, 0xA6, 0x69, 0x55, 0x08, 0x48, 0x53, 0xEA, 0x39, 0x13,
-	0xBD, 0x15, 0x57, 0x00, 0x3E, 0x98, 0x73, 0xA2, 0x73, 0x08, 0x10, 0xD8,
-	0x5E, 0x40, 0x00, 0xD8, 0xDE, 0xB8, 0xFB, 0x1E, 0x22, 0x04, 0xBC, 0x1A,
-	0x93, 0xFC, 0x2C, 0x1E, 0x3E, 0x27, 0xA0, 0xFB, 0x6A, 0x4F, 0x9A, 0xE0,
-	0x8D, 0x08, 0x00, 0x1F, 0x4D, 0x3A, 0xC3, 0xC1, 0x04, 0x08, 0x14, 0x13,
-	0x10, 0x00, 0x8A, 0x51, 0xF7, 0xDD, 0xD1, 0x21, 0x04, 0x7C, 0xDD, 0xF7,
-	0x2C, 0xCD, 0x6E, 0xA2, 0xC0, 0x5B, 0x11, 0x00, 0xBE, 0x98, 0x78, 0x8E,
-	0xC3, 0x09, 0x10, 0x28, 0x24, 0x20, 0x00, 0x14, 0x82, 0xCE, 0xD0, 0x8D,
-	0x10, 0x90, 0xA1, 0xCA, 0x93, 0xE6, 0xE8, 0x43, 0x80, 0x26, 0x71, 0x39,
-	0x98, 0x40, 0x59, 0x01, 0x01, 0xA0, 0xAC, 0x77, 0xF7, 0xBD, 0x65, 0x0F,
-	0x01, 0xDB, 0xBC, 0x99, 0xAE, 0xCD, 0x65, 0xE3, 0x2D, 0x80, 0x6D, 0xD6,
-	0xCD, 0xA8, 0xF3, 0x08, 0x08, 0x00, 0x79, 0x6A, 0x5D, 0x6C, 0xA6, 0xD9,
-	0x43, 0x40, 0x31, 0xE8, 0xBA, 0x3B, 0xF2, 0x0E, 0x80, 0xBA, 0xEB, 0x63,
-	0x74, 0x04, 0xAE, 0x08, 0x00, 0x16, 0xC1, 0x26, 0x02, 0x42, 0xC0, 0x26,
-	0xAC, 0x2D, 0x35, 0xEA, 0x06, 0xC0, 0x96, 0xAA, 0x65, 0xAC, 0x29, 0x05,
-	0x04, 0x80, 0x94, 0x65, 0x2F, 0x33, 0x69, 0x21, 0xA0, 0x8C, 0x73, 0xA5,
-	0xBD, 0xB8, 0x01, 0xB0, 0xD2, 0xC2, 0x18, 0x16, 0x81, 0x53, 0x01, 0x01,
-	0xC0, 0x5A, 0xD8, 0x54, 0x40, 0x08, 0xD8, 0x94, 0xB7, 0xDA, 0xC6, 0xBD,
-	0xFE, 0x5F, 0x6D, 0x69, 0x0C, 0x8C, 0xC0, 0x23, 0x01, 0x01, 0xC0, 0x62,
-	0xD8, 0x5C, 0x20, 0x42, 0xC0, 0xB5, 0xE8, 0xE4, 0xF3, 0xCD, 0x3B, 0xD2,
-	0x41, 0x2D, 0x02, 0x77, 0x23, 0x00, 0xBC, 0x5B, 0xCB, 0x60, 0x8C, 0x83,
-	0x00, 0x81, 0xF3, 0x05, 0x04, 0x00, 0x2B, 0xA3, 0x88, 0x80, 0x10, 0x50,
-	0x84, 0xB9, 0x96, 0x4E, 0xBC, 0xFE, 0x5F, 0x4B, 0x25, 0x8C, 0x83, 0xC0,
-	0x25, 0x02, 0x02, 0x80, 0xE5, 0x51, 0x4C, 0x40, 0x08, 0x28, 0x46, 0xBD,
-	0x77, 0x47, 0xCF, 0xC7, 0x15, 0x80, 0xEF, 0xF6, 0x1E, 0x84, 0xFE, 0x09,
-	0x10, 0xB8, 0x5C, 0x40, 0x00, 0xB0, 0x42, 0x8A, 0x0A, 0x08, 0x01, 0x45,
-	0xB9, 0xF7, 0xE8, 0xCC, 0xE5, 0xFF, 0x3D, 0xD4, 0xF5, 0x49, 0x60, 0x86,
-	0x80, 0x00, 0x30, 0x03, 0xCD, 0x29, 0xCB, 0x04, 0x84, 0x80, 0x65, 0x7E,
-	0x95, 0x9F, 0x7D, 0x3D, 0x9E, 0xFD, 0xDF, 0xA9, 0x7C, 0x8C, 0x86, 0x47,
-	0x80, 0x40, 0x08, 0x08, 0x00, 0x96, 0xC1, 0x2E, 0x02, 0x42, 0xC0, 0x2E,
-	0xEC, 0x25, 0x3A, 0x75, 0xF9, 0xBF, 0x84, 0xB2, 0x3E, 0x08, 0xAC, 0x20,
-	0x20, 0x00, 0xAC, 0x80, 0xA8, 0x89, 0x79, 0x02, 0x75, 0x85, 0x80, 0x87,
-	0x05, 0xF3, 0x70, 0xC9, 0xBE, 0x2E, 0xAE, 0xCD, 0x06, 0x1F, 0x5B, 0xEC,
-	0xEB, 0x7F, 0xE7, 0xFD, 0x2A, 0x38, 0x8B, 0xC0, 0x2E, 0x02, 0x02, 0xC0,
-	0x2E, 0xEC, 0x3A, 0x1D, 0x04, 0x22, 0x00, 0x3C, 0x17, 0x3F, 0xFE, 0x3C,
-	0x1E, 0xDE, 0x22, 0xD8, 0xC7, 0x92, 0xB8, 0x1A, 0x97, 0xFF, 0xEF, 0xF7,
-	0x31, 0x15, 0xB3, 0x20, 0xD0, 0xBF, 0x80, 0x00, 0xD0, 0x7F, 0x8D, 0xAB,
-	0x9F, 0x61, 0x04, 0x81, 0xF7, 0x62, 0x90, 0xB7, 0xAB, 0x1F, 0xA8, 0x01,
-	0x5E, 0x26, 0xE0, 0xE6, 0x3F, 0xEB, 0x83, 0x40, 0x63, 0x02, 0x02, 0x40,
-	0x63, 0x05, 0xEB, 0x75, 0xB8, 0x42, 0x40, 0xF3, 0x95, 0xF5, 0xEC, 0xBF,
-	0xF9, 0x12, 0x9A, 0x40, 0x36, 0x01, 0x01, 0x20, 0x5B, 0xC5, 0x2B, 0x9E,
-	0xAF, 0x10, 0x50, 0x71, 0x71, 0x2E, 0x1F, 0x9A, 0x67, 0xFF, 0xCD, 0x96,
-	0xCE, 0xC0, 0x33, 0x0B, 0x08, 0x00, 0x99, 0xAB, 0x5F, 0xE1, 0xDC, 0x85,
-	0x80, 0x0A, 0x8B, 0x72, 0x7C, 0x48, 0xBE, 0xF8, 0xE7, 0xB8, 0x91, 0x23,
-	0x08, 0x54, 0x27, 0x20, 0x00, 0x54, 0x57, 0x12, 0x03, 0x12, 0x02, 0x9A,
-	0x5A, 0x03, 0x9E, 0xFD, 0x37, 0x55, 0x2E, 0x83, 0x25, 0xF0, 0x27, 0x01,
-	0x01, 0xC0, 0x6A, 0xA8, 0x52, 0x40, 0x08, 0xA8, 0xB2, 0x2C, 0xE7, 0x0D,
-	0xEA, 0xE5, 0xB8, 0xF3, 0xFF, 0xDB, 0x66, 0x46, 0x6B, 0xA0, 0x04, 0x08,
-	0x3C, 0x12, 0x10, 0x00, 0x2C, 0x86, 0x6A, 0x05, 0x84, 0x80, 0x6A, 0x4B,
-	0x13, 0xEF, 0xE1, 0x8C, 0xB1, 0x3D, 0x73, 0xC5, 0x97, 0xFE, 0x54, 0x5C,
-	0x22, 0x43, 0x23, 0x70, 0x4C, 0x40, 0x00, 0x38, 0x26, 0xE4, 0xDF, 0x77,
-	0x15, 0x88, 0x10, 0xF0, 0x61, 0x0C, 0xE0, 0xE6, 0xAE, 0x83, 0xD0, 0xF9,
-	0x79, 0x02, 0x0F, 0xE2, 0x99, 0xFF, 0x8B, 0x68, 0x08, 0x10, 0x68, 0x57,
-	0x40, 0x00, 0x68, 0xB7, 0x76, 0x69, 0x46, 0x2E, 0x04, 0x54, 0x59, 0x6A,
-	0x37, 0xFE, 0x55, 0x59, 0x16, 0x83, 0x22, 0x30, 0x5E, 0x40, 0x00, 0x18,
-	0x6F, 0xE5, 0xC8, 0x1D, 0x05, 0x84, 0x80, 0x1D, 0xF1, 0x9F, 0xEE, 0xDA,
-	0x47, 0xFE, 0x56, 0x55, 0x0E, 0x83, 0x21, 0x30, 0x4F, 0x40, 0x00, 0x98,
-	0xE7, 0xE6, 0xAC, 0x1D, 0x04, 0x84, 0x80, 0x1D, 0xD0, 0x9F, 0xEE, 0xF2,
-	0x5E, 0x5C, 0xFA, 0x7F, 0xA3, 0x8A, 0x91, 0x18, 0x04, 0x01, 0x02, 0x8B,
-	0x04, 0x04, 0x80, 0x45, 0x7C, 0x4E, 0x2E, 0x2D, 0x20, 0x04, 0x94, 0x16,
-	0x7F, 0xAA, 0x3F, 0x77, 0xFD, 0xEF, 0x5E, 0x02, 0x03, 0x20, 0xB0, 0x8E,
-	0x80, 0x00, 0xB0, 0x8E, 0xA3, 0x56, 0x0A, 0x0A, 0x8C, 0x0F, 0x01, 0x75,
-	0x7C, 0xEB, 0x5E, 0x41, 0x9A, 0xAD, 0xBB, 0xBA, 0x1E, 0xCF, 0xFE, 0xEF,
-	0x6C, 0xDD, 0x89, 0xF6, 0x09, 0x10, 0x28, 0x23, 0x20, 0x00, 0x94, 0x71,
-	0xD6, 0xCB, 0xCA, 0x02, 0x11, 0x02, 0x3E, 0x8E, 0x26, 0xDF, 0x5F, 0xB9,
-	0x59, 0xCD, 0x5D, 0x2C, 0xE0, 0x75, 0x7F, 0xAB, 0x83, 0x40, 0x67, 0x02,
-	0x02, 0x40, 0x67, 0x05, 0xCD, 0x34, 0x1D, 0x21, 0xA0, 0x58, 0xB5, 0x7D,
-	0xDA, 0x5F, 0x31, 0x6A, 0x1D, 0x11, 0x28, 0x27, 0x20, 0x00, 0x94, 0xB3,
-	0xD6, 0xD3, 0x06, 0x02, 0x42, 0xC0, 0x78, 0xD4, 0xEF, 0xE3, 0xD0, 0x67,
-	0xC7, 0x1F, 0x7E, 0x7A, 0xA4, 0x9B, 0xFE, 0xA6, 0x9B, 0x39, 0x83, 0x40,
-	0x13, 0x02, 0x02, 0x40, 0x13, 0x65, 0x32, 0xC8, 0xCB, 0x04, 0x84, 0x80,
-	0xCD, 0xD6, 0xC7, 0xBD, 0x68, 0xF9, 0xCD, 0x78, 0xDD, 0xFF, 0xBB, 0xCD,
-	0x7A, 0xD0, 0x30, 0x01, 0x02, 0xBB, 0x09, 0x08, 0x00, 0xBB, 0xD1, 0xEB,
-	0x78, 0x4D, 0x01, 0x21, 0x60, 0x4D, 0xCD, 0x93, 0xB6, 0x1E, 0xC4, 0xE3,
-	0x15, 0x9B, 0xFF, 0xEA, 0xAE, 0x1A, 0x24, 0x50, 0x8D, 0x80, 0x00, 0x50,
-	0x4D, 0x29, 0x0C, 0x64, 0xA9, 0xC0, 0xF8, 0x77, 0x07, 0x2C, 0xED, 0xA9,
-	0xFB, 0xF3, 0x87, 0x67, 0xFE, 0x6F, 0xFB, 0x92, 0x9F, 0xEE, 0xEB, 0x6C,
-	0x82, 0xC9, 0x05, 0x04, 0x80, 0xE4, 0x0B, 0xA0, 0xB7, 0xE9, 0xFB, 0x02,
-	0xA1, 0xC5, 0x15, 0xBD, 0x1B, 0x2D, 0xFC, 0xD4, 0x33, 0xFF, 0xC5, 0x8E,
-	0x1A, 0x20, 0x50, 0xBD, 0x80, 0x00, 0x50, 0x7D, 0x89, 0x0C, 0x70, 0xAA,
-	0x80, 0x10, 0x30, 0x55, 0xEC, 0xD1, 0xF1, 0xDE, 0xEA, 0x37, 0x9B, 0xCE,
-	0x89, 0x04, 0xDA, 0x13, 0x10, 0x00, 0xDA, 0xAB, 0x99, 0x11, 0x8F, 0x10,
-	0x88, 0x10, 0x70, 0x2D, 0x0E, 0xFB, 0x7C, 0xC4, 0xA1, 0x0E, 0xF9, 0xA3,
-	0x80, 0xCD, 0xDF, 0x4A, 0x20, 0x90, 0x4C, 0x40, 0x00, 0x48, 0x56, 0xF0,
-	0x4C, 0xD3, 0x8D, 0x10, 0xF0, 0x52, 0xCC, 0xF7, 0xD3, 0x78, 0xBC, 0x9E,
-	0x69, 0xDE, 0x33, 0xE6, 0xEA, 0x13, 0xFE, 0x66, 0xA0, 0x39, 0x85, 0x40,
-	0xEB, 0x02, 0x02, 0x40, 0xEB, 0x15, 0x34, 0xFE, 0xA3, 0x02, 0xDE, 0x21,
-	0x70, 0x21, 0x91, 0x9B, 0xFD, 0x8E, 0xAE, 0x1E, 0x07, 0x10, 0xE8, 0x57,
-	0x40, 0x00, 0xE8, 0xB7, 0xB6, 0x66, 0x76, 0x46, 0xC0, 0x4B, 0x02, 0x4F,
-	0x2D, 0x07, 0x97, 0xFC, 0xFD, 0x86, 0x10, 0x48, 0x2E, 0x20, 0x00, 0x24,
-	0x5F, 0x00, 0x99, 0xA6, 0x7F, 0x78, 0x49, 0xE0, 0x2F, 0x63, 0xCE, 0x99,
-	0xBF, 0x43, 0x60, 0x78, 0x7F, 0xFF, 0x70, 0xC9, 0xFF, 0x8B, 0x4C, 0xB5,
-	0x37, 0x57, 0x02, 0x04, 0x9E, 0x16, 0x10, 0x00, 0xAC, 0x8A, 0x74, 0x02,
-	0x87, 0xAB, 0x01, 0xB7, 0x63, 0xE2, 0x2F, 0x24, 0x9B, 0xFC, 0x8D, 0x98,
-	0xEF, 0x7F, 0xF7, 0x16, 0xBF, 0x64, 0x55, 0x37, 0x5D, 0x02, 0x17, 0x08,
-	0x08, 0x00, 0x96, 0x46, 0x5A, 0x81, 0x44, 0x1F, 0x1C, 0x74, 0x2B, 0x8A,
-	0xFC, 0x57, 0x3E, 0xD8, 0x27, 0xED, 0x52, 0x37, 0x71, 0x02, 0xE7, 0x0A,
-	0x08, 0x00, 0x16, 0x46, 0x6A, 0x81, 0xCE, 0x5F, 0x16, 0x18, 0x6E, 0xF2,
-	0xFB, 0x8F, 0xB1, 0xF1, 0xDF, 0x4F, 0x5D, 0x64, 0x93, 0x27, 0x40, 0x40,
-	0x00, 0xB0, 0x06, 0x08, 0x5C, 0x24, 0x10, 0x41, 0xE0, 0xB9, 0xF8, 0xB7,
-	0xFF, 0x1C, 0x8F, 0x9B, 0x1D, 0x28, 0x0D, 0x9F, 0xE6, 0xF7, 0x73, 0x1B,
-	0x7F, 0x07, 0x95, 0x34, 0x05, 0x02, 0x1B, 0x0A, 0xB8, 0x02, 0xB0, 0x21,
-	0xAE, 0xA6, 0xDB, 0x13, 0x38, 0x13, 0x04, 0xAE, 0xC7, 0xE8, 0x5B, 0xFB,
-	0xFC, 0x00, 0x97, 0xFA, 0xDB, 0x5B, 0x72, 0x46, 0x4C, 0x60, 0x37, 0x01,
-	0x01, 0x60, 0x37, 0x7A, 0x1D, 0xD7, 0x2E, 0x10, 0x61, 0xE0, 0xD5, 0x18,
-	0xE3, 0x7F, 0x8A, 0xC7, 0x7B, 0xF1, 0xA8, 0xF5, 0x86, 0xC1, 0xE1, 0xD9,
-	0xFE, 0xDF, 0xC4, 0xE3, 0x6F, 0xDD, 0xDC, 0x57, 0xFB, 0x8A, 0x32, 0x3E,
-	0x02, 0x75, 0x09, 0x08, 0x00, 0x75, 0xD5, 0xC3, 0x68, 0x2A, 0x15, 0x38,
-	0xBC, 0x73, 0xE0, 0xED, 0x4A, 0xC2, 0x80, 0x4D, 0xBF, 0xD2, 0x75, 0x62,
-	0x58, 0x04, 0x5A, 0x12, 0x10, 0x00, 0x5A, 0xAA, 0x96, 0xB1, 0x56, 0x21,
-	0x70, 0xB8, 0x71, 0xF0, 0xDF, 0xC7, 0x60, 0xFE, 0x4D, 0xA1, 0x40, 0x30,
-	0x6C, 0xF8, 0x7F, 0x17, 0x8F, 0xFF, 0xE9, 0x75, 0xFD, 0x2A, 0x96, 0x80,
-	0x41, 0x10, 0xE8, 0x42, 0x40, 0x00, 0xE8, 0xA2, 0x8C, 0x26, 0xB1, 0xA7,
-	0xC0, 0xE1, 0xBE, 0x81, 0x9F, 0xC4, 0x18, 0xFE, 0x55, 0x3C, 0x86, 0xEF,
-	0x1F, 0xF8, 0x77, 0xF1, 0xF8, 0xD1, 0xE1, 0x31, 0xF6, 0xA5, 0x83, 0xE1,
-	0x8E, 0xFD, 0xDF, 0xC6, 0xE3, 0xD7, 0xF1, 0xF8, 0xDF, 0xF1, 0x18, 0x3E,
-	0xB0, 0xE7, 0x9F, 0xBC, 0x75, 0x6F, 0xCF, 0xCA, 0xEA, 0x9B, 0x40, 0xDF,
-	0x02, 0x02, 0x40, 0xDF, 0xF5, 0x35, 0xBB, 0x4A, 0x04, 0x0E, 0x21, 0xE1,
-	0x07, 0x87, 0xE1, 0xFC, 0x61, 0xF8, 0xE9, 0x35, 0xFB, 0x4A, 0x8A, 0x63,
-	0x18, 0x04, 0x92, 0x0A, 0x08, 0x00, 0x49, 0x0B, 0x6F, 0xDA, 0x04, 0x08,
-	0x10, 0x20, 0x90, 0x5B, 0x40, 0x00, 0xC8, 0x5D, 0x7F, 0xB3, 0x27, 0x40,
-	0x80, 0x00, 0x81, 0xA4, 0x02, 0x02, 0x40, 0xD2, 0xC2, 0x9B, 0x36, 0x01,
-	0x02, 0x04, 0x08, 0xE4, 0x16, 0x10, 0x00, 0x72, 0xD7, 0xDF, 0xEC, 0x09,
-	0x10, 0x20, 0x40, 0x20, 0xA9, 0x80, 0x00, 0x90, 0xB4, 0xF0, 0xA6, 0x4D,
-	0x80, 0x00, 0x01, 0x02, 0xB9, 0x05, 0x04, 0x80, 0xDC, 0xF5, 0x37, 0x7B,
-	0x02, 0x04, 0x08, 0x10, 0x48, 0x2A, 0x20, 0x00, 0x24, 0x2D, 0xBC, 0x69,
-	0x13, 0x20, 0x40, 0x80, 0x40, 0x6E, 0x01, 0x01, 0x20, 0x77, 0xFD, 0xCD,
-	0x9E, 0x00, 0x01, 0x02, 0x04, 0x92, 0x0A, 0x08, 0x00, 0x49, 0x0B, 0x6F,
-	0xDA, 0x04, 0x08, 0x10, 0x20, 0x90, 0x5B, 0x40, 0x00, 0xC8, 0x5D, 0x7F,
-	0xB3, 0x27, 0x40, 0x80, 0x00, 0x81, 0xA4, 0x02, 0x02, 0x40, 0xD2, 0xC2,
-	0x9B, 0x36, 0x01, 0x02, 0x04, 0x08, 0xE4, 0x16, 0x10, 0x00, 0x72, 0xD7,
-	0xDF, 0xEC, 0x09, 0x10, 0x20, 0x40, 0x20, 0xA9, 0x80, 0x00, 0x90, 0xB4,
-	0xF0, 0xA6, 0x4D, 0x80, 0x00, 0x01, 0x02, 0xB9, 0x05, 0x04, 0x80, 0xDC,
-	0xF5, 0x37, 0x7B, 0x02, 0x04, 0x08, 0x10, 0x48, 0x2A, 0x20, 0x00, 0x24,
-	0x2D, 0xBC, 0x69, 0x13, 0x20, 0x40, 0x80, 0x40, 0x6E, 0x01, 0x01, 0x20,
-	0x77, 0xFD, 0xCD, 0x9E, 0x00, 0x01, 0x02, 0x04, 0x92, 0x0A, 0x08, 0x00,
-	0x49, 0x0B, 0x6F, 0xDA, 0x04, 0x08, 0x10, 0x20, 0x90, 0x5B, 0x40, 0x00,
-	0xC8, 0x5D, 0x7F, 0xB3, 0x27, 0x40, 0x80, 0x00, 0x81, 0xA4, 0x02, 0x02,
-	0x40, 0xD2, 0xC2, 0x9B, 0x36, 0x01, 0x02, 0x04, 0x08, 0xE4, 0x16, 0x10,
-	0x00, 0x72, 0xD7, 0xDF, 0xEC, 0x09, 0x10, 0x20, 0x40, 0x20, 0xA9, 0x80,
-	0x00, 0x90, 0xB4, 0xF0, 0xA6, 0x4D, 0x80, 0x00, 0x01, 0x02, 0xB9, 0x05,
-	0x04, 0x80, 0xDC, 0xF5, 0x37, 0x7B, 0x02, 0x04, 0x08, 0x10, 0x48, 0x2A,
-	0x20, 0x00, 0x24, 0x2D, 0xBC, 0x69, 0x13, 0x20, 0x40, 0x80, 0x40, 0x6E,
-	0x01, 0x01, 0x20, 0x77, 0xFD, 0xCD, 0x9E, 0x00, 0x01, 0x02, 0x04, 0x92,
-	0x0A, 0x08, 0x00, 0x49, 0x0B, 0x6F, 0xDA, 0x04, 0x08, 0x10, 0x20, 0x90,
-	0x5B, 0x40, 0x00, 0xC8, 0x5D, 0x7F, 0xB3, 0x27, 0x40, 0x80, 0x00, 0x81,
-	0xA4, 0x02, 0x02, 0x40, 0xD2, 0xC2, 0x9B, 0x36, 0x01, 0x02, 0x04, 0x08,
-	0xE4, 0x16, 0x10, 0x00, 0x72, 0xD7, 0xDF, 0xEC, 0x09, 0x10, 0x20, 0x40,
-	0x20, 0xA9, 0x80, 0x00, 0x90, 0xB4, 0xF0, 0xA6, 0x4D, 0x80, 0x00, 0x01,
-	0x02, 0xB9, 0x05, 0x04, 0x80, 0xDC, 0xF5, 0x37, 0x7B, 0x02, 0x04, 0x08,
-	0x10, 0x48, 0x2A, 0xF0, 0xFF, 0x01, 0x8F, 0x16, 0x17, 0xEC, 0x9B, 0x53,
-	0x72, 0xD1, 0x00, 0x00, 0x00, 0x00, 0x49, 0x45, 0x4E, 0x44, 0xAE, 0x42,
-	0x60, 0x82
-};
@@ -1,244 +0,0 @@
-
-inline unsigned char g_BackIcon[2886] = {
-	0x89, 0x50, 0x4E, 0x47, 0x0D, 0x0A, 0x1A, 0x0A, 0x00, 0x00, 0x00, 0x0D,
-	0x49, 0x48, 0x44, 0x52, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80,
-	0x08, 0x06, 0x00, 0x00, 0x00, 0xC3, 0x3E, 0x61, 0xCB, 0x00, 0x00, 0x0B,
-	0x0D, 0x49, 0x44, 0x41, 0x54, 0x78, 0x5E, 0xED, 0x9D, 0x79, 0xA8, 0x55,
-	0x45, 0x1C, 0xC7, 0xCF, 0x55, 0x8B, 0x88, 0x88, 0x88, 0x88, 0x08, 0x89,
-	0xC8, 0xE8, 0x8F, 0x88, 0x08, 0xAC, 0x9E, 0x84, 0xED, 0x65, 0xCB, 0x2B,
-	0x2D, 0x6C, 0x93, 0x16, 0xDB, 0xCD, 0x2C, 0x45, 0xB2, 0x34, 0x97, 0xD2,
-	0xDC, 0xDA, 0x08, 0xB5, 0xB2, 0xBD, 0xD4, 0x0A, 0x6D, 0x2F, 0x2B, 0xC3,
-	0x56, 0xAD, 0xA0, 0x92, 0x10, 0x83, 0x08, 0xA9, 0x88, 0x88, 0xF0, 0x8F,
-	0xFE, 0x08, 0x91, 0x88, 0x28, 0x7D, 0xAF, 0xEF, 0xD7, 0x37, 0xEA, 0xBD,
-	0xF7, 0xDD, 0x7B, 0xEE, 0x9C, 0x39, 0xBF, 0x7B, 0x67, 0x1D, 0x18, 0x0E,
-	0xEF, 0xBE, 0x99, 0xDF, 0x39, 0xE7, 0xF7, 0xFD, 0x9C, 0x39, 0xCB, 0xCC,
-	0xFC, 0xA6, 0x92, 0xA5, 0xD4, 0x56, 0x0F, 0xF4, 0xF6, 0xF6, 0x0E, 0xC3,
-	0x0E, 0xC6, 0x23, 0x9F, 0x82, 0x3C, 0x18, 0x79, 0x1B, 0xF2, 0x26, 0xE4,
-	0x95, 0xC8, 0xCB, 0x2A, 0x95, 0xCA, 0xF6, 0xB6, 0x1E, 0x40, 0x0B, 0xE3,
-	0x15, 0x9B, 0x3B, 0x0F, 0x79, 0xDF, 0x10, 0x7E, 0xEF, 0x2C, 0xEB, 0x79,
-	0x26, 0xCB, 0x06, 0x5C, 0x93, 0x73, 0x9E, 0x9B, 0xF1, 0xBF, 0xD1, 0x80,
-	0xE0, 0x07, 0x5B, 0xBE, 0x48, 0x00, 0xB4, 0xC1, 0xF3, 0x10, 0x7F, 0x1F,
-	0x98, 0x7D, 0x17, 0xF9, 0x2C, 0x0D, 0xF3, 0x5B, 0x51, 0xA6, 0x0B, 0x10,
-	0xFC, 0xA8, 0x51, 0x56, 0xBC, 0x48, 0x02, 0x40, 0xD8, 0xA5, 0x7D, 0x57,
-	0x7E, 0xF6, 0xBE, 0xA6, 0xF8, 0xBB, 0xF6, 0xCE, 0x5B, 0xC2, 0x50, 0x40,
-	0xD0, 0x23, 0x7C, 0x38, 0x2D, 0xCD, 0x25, 0x00, 0x5A, 0xBA, 0x48, 0xBF,
-	0x80, 0x12, 0xFF, 0x2D, 0xD4, 0x38, 0x5F, 0xBF, 0xD6, 0xEE, 0x92, 0xA3,
-	0x00, 0xC0, 0x6A, 0x83, 0x7A, 0xA5, 0xAA, 0x24, 0x00, 0x4A, 0xB9, 0x6F,
-	0x4F, 0x65, 0x88, 0x3F, 0x08, 0x7F, 0xBD, 0x81, 0x3C, 0xB2, 0xC6, 0x24,
-	0xAF, 0xE9, 0x01, 0x5A, 0x3B, 0x59, 0x01, 0x00, 0xC6, 0x6A, 0x95, 0x14,
-	0x2C, 0x94, 0x00, 0x10, 0x70, 0xA6, 0x12, 0xFF, 0x35, 0x98, 0xBA, 0xA8,
-	0x84, 0xB9, 0x0D, 0x00, 0xA0, 0xAB, 0x44, 0x7D, 0xA3, 0xAA, 0x09, 0x00,
-	0x23, 0xB7, 0xF5, 0xBB, 0xF2, 0x5F, 0xC6, 0x2F, 0x97, 0x95, 0x34, 0xB5,
-	0x11, 0x00, 0x0C, 0x2D, 0x69, 0xA3, 0x70, 0xF5, 0x04, 0x40, 0x61, 0x97,
-	0x35, 0x11, 0x5F, 0xBF, 0xA9, 0x6F, 0xB6, 0xC7, 0x35, 0x00, 0xA0, 0xBB,
-	0xC4, 0xE1, 0x18, 0x55, 0x4D, 0x00, 0x18, 0xB9, 0x2D, 0xCB, 0xD0, 0xEC,
-	0xF3, 0xCE, 0xFE, 0x1C, 0xF2, 0xB5, 0x45, 0x4C, 0xE4, 0x70, 0x32, 0x09,
-	0x00, 0x2C, 0x29, 0x62, 0x4B, 0xA2, 0x6C, 0x02, 0xC0, 0xC0, 0x8B, 0x4A,
-	0xFC, 0xA7, 0x50, 0xF5, 0x46, 0x83, 0xEA, 0x8D, 0xAA, 0xFC, 0x89, 0x1F,
-	0x87, 0x00, 0x00, 0x7E, 0x13, 0xE8, 0x68, 0x4A, 0x00, 0x18, 0xB8, 0x1B,
-	0x00, 0x3C, 0x81, 0x6A, 0xB7, 0x18, 0x54, 0x6D, 0x56, 0x65, 0x0C, 0xC4,
-	0x5F, 0x25, 0x68, 0x4F, 0xDB, 0x54, 0x02, 0x40, 0xDB, 0x55, 0x7D, 0x05,
-	0x21, 0xFE, 0x62, 0x6C, 0x26, 0x16, 0xAB, 0xD6, 0x8B, 0xE2, 0x4D, 0x5D,
-	0x3D, 0x0B, 0xE2, 0xCF, 0x2B, 0x66, 0x4F, 0xAE, 0x74, 0x02, 0xA0, 0x80,
-	0x2F, 0x21, 0xFE, 0x03, 0x28, 0x7E, 0x57, 0x81, 0x2A, 0x2D, 0x8A, 0xF6,
-	0x2C, 0xA8, 0x54, 0x06, 0xCE, 0x90, 0xB3, 0x57, 0xDC, 0x52, 0x02, 0x40,
-	0xD3, 0x67, 0x10, 0x7F, 0x3E, 0x8A, 0x4E, 0xD7, 0x2C, 0x9E, 0x5B, 0x4C,
-	0x3D, 0x08, 0xDE, 0x8F, 0x2B, 0xFF, 0x6E, 0x09, 0x7B, 0x65, 0x6C, 0x24,
-	0x00, 0x34, 0xBC, 0x07, 0xF1, 0x67, 0xA2, 0xD8, 0x5C, 0x8D, 0xA2, 0xBA,
-	0x45, 0x1E, 0x81, 0xF8, 0x77, 0xE8, 0x16, 0x6E, 0x67, 0xB9, 0x04, 0x40,
-	0x0B, 0xEF, 0x42, 0xFC, 0x69, 0x28, 0xB2, 0x50, 0x50, 0x84, 0xA5, 0x10,
-	0x7F, 0x82, 0xA0, 0xBD, 0x52, 0xA6, 0x12, 0x00, 0x39, 0xEE, 0x83, 0xF8,
-	0x53, 0xF0, 0xEF, 0x87, 0xFA, 0x8A, 0xE4, 0x3E, 0xC8, 0xE9, 0x8A, 0xF0,
-	0x2C, 0x0A, 0x8E, 0xB3, 0xD1, 0xEB, 0xD7, 0xEC, 0x00, 0x13, 0x00, 0x4D,
-	0x3C, 0x03, 0xF1, 0xF9, 0xA4, 0xCF, 0x27, 0x7E, 0xA9, 0xB4, 0x0C, 0x86,
-	0x6E, 0x70, 0x49, 0x7C, 0x9E, 0x58, 0x02, 0xA0, 0x81, 0xBC, 0x10, 0xFF,
-	0x36, 0xFC, 0xFC, 0xA8, 0x94, 0xF2, 0xB0, 0xB3, 0x2A, 0x9B, 0x93, 0x5D,
-	0x5D, 0x99, 0x6D, 0x77, 0xF8, 0x57, 0xA3, 0xF3, 0x49, 0x00, 0xD4, 0x79,
-	0x05, 0xE2, 0xDF, 0x8C, 0x9F, 0xF8, 0x95, 0x4F, 0x2A, 0xBD, 0x0A, 0x43,
-	0x57, 0xDA, 0x1E, 0xFB, 0x97, 0x6E, 0x01, 0x1A, 0x72, 0x42, 0x7C, 0x8E,
-	0xDF, 0x5B, 0x5E, 0x53, 0x74, 0x07, 0xFE, 0x1A, 0xA8, 0x51, 0xB9, 0xAA,
-	0x48, 0xD5, 0xF7, 0xFE, 0xB7, 0xF1, 0xF3, 0xA5, 0xAE, 0x8A, 0x9F, 0x6E,
-	0x01, 0x55, 0xA2, 0x41, 0xFC, 0xAB, 0x94, 0xF8, 0x7A, 0xC3, 0x37, 0x5A,
-	0x33, 0xC1, 0xD1, 0x3D, 0x1C, 0xF0, 0x69, 0x75, 0xD4, 0x6F, 0xAB, 0xC3,
-	0x4C, 0xB7, 0x00, 0x78, 0x08, 0xE2, 0x5F, 0x82, 0x0D, 0x87, 0x69, 0x73,
-	0x54, 0x8F, 0x44, 0x5A, 0x03, 0x23, 0x17, 0x43, 0xFC, 0x7F, 0x25, 0x8C,
-	0xB5, 0xD3, 0x46, 0xF4, 0x00, 0x40, 0x7C, 0x8E, 0xE2, 0x79, 0x05, 0x99,
-	0x83, 0x39, 0x25, 0xD2, 0xC7, 0x30, 0xD2, 0xED, 0x83, 0xF8, 0xD1, 0xDF,
-	0x02, 0x20, 0x3E, 0x07, 0x6F, 0x72, 0x10, 0xA7, 0x94, 0xF8, 0x9F, 0x2A,
-	0xF1, 0xFF, 0x91, 0x20, 0xA9, 0x13, 0x36, 0xA2, 0x6D, 0x01, 0x20, 0xFE,
-	0x08, 0x38, 0x98, 0x63, 0xF7, 0xA5, 0xC4, 0xFF, 0x1C, 0xB6, 0xCE, 0xC3,
-	0x95, 0xFF, 0x77, 0x27, 0x84, 0x93, 0xDA, 0x47, 0x94, 0x00, 0x40, 0x7C,
-	0x4E, 0xD8, 0xA0, 0xF8, 0x9C, 0xC0, 0x21, 0x91, 0xBE, 0x86, 0x91, 0xB3,
-	0x21, 0xFE, 0x5F, 0x12, 0xC6, 0x3A, 0x69, 0x23, 0x3A, 0x00, 0x20, 0x3E,
-	0xE7, 0xE8, 0x7D, 0x80, 0xBC, 0xAF, 0x90, 0xA3, 0xBF, 0x85, 0x9D, 0x33,
-	0x21, 0x3E, 0xE7, 0xFC, 0x79, 0x97, 0xA2, 0x02, 0x00, 0xE2, 0x0F, 0x87,
-	0x42, 0x6B, 0x4D, 0xC5, 0x6F, 0xD0, 0x1B, 0xB0, 0x51, 0x89, 0xDF, 0xF1,
-	0xA1, 0x5C, 0x52, 0xA4, 0x45, 0x03, 0x80, 0x9A, 0xA5, 0xFB, 0x11, 0x1C,
-	0xB7, 0x9F, 0x90, 0xF3, 0xBE, 0x87, 0x9D, 0x53, 0x71, 0xE5, 0x73, 0x3C,
-	0x9F, 0xB7, 0x29, 0x0A, 0x00, 0x20, 0xFE, 0x89, 0x50, 0xE8, 0x93, 0xC6,
-	0xE2, 0x1B, 0xF5, 0xF2, 0x71, 0x36, 0xEF, 0xE9, 0x10, 0xFF, 0x0F, 0x6F,
-	0x95, 0x57, 0x07, 0x1E, 0x3C, 0x00, 0x10, 0xFF, 0x38, 0x9C, 0xEB, 0x67,
-	0xC8, 0x07, 0x08, 0x89, 0xC5, 0x59, 0xBC, 0x27, 0x87, 0x20, 0x3E, 0xFD,
-	0x11, 0x34, 0x00, 0x4A, 0x7C, 0x5E, 0xF9, 0x07, 0x0A, 0x8A, 0xCF, 0x2B,
-	0x7F, 0x8B, 0x90, 0x3D, 0xEB, 0x66, 0x82, 0x05, 0x00, 0xE2, 0x1F, 0xAD,
-	0xAE, 0xFC, 0x83, 0x85, 0xBC, 0xFC, 0x8B, 0xBA, 0xE7, 0xFF, 0x2E, 0x64,
-	0xCF, 0x09, 0x33, 0x41, 0x02, 0x00, 0xF1, 0x8F, 0x82, 0x77, 0xD7, 0x23,
-	0x1F, 0x22, 0xE4, 0xE5, 0xDF, 0x54, 0xB3, 0xCF, 0x6D, 0x50, 0x29, 0x38,
-	0x00, 0x20, 0xFE, 0x11, 0x50, 0xE8, 0x0B, 0xE4, 0x43, 0x73, 0x95, 0xCA,
-	0x99, 0xA3, 0x55, 0xF7, 0x2F, 0x8A, 0xCE, 0x66, 0x9F, 0x2D, 0x40, 0x70,
-	0x29, 0x28, 0x00, 0x20, 0xFE, 0xE1, 0xEA, 0xCA, 0x3F, 0x4C, 0x62, 0x0C,
-	0x1F, 0xFA, 0x85, 0xB7, 0x00, 0x06, 0x8A, 0x6F, 0x25, 0x7C, 0x4B, 0x27,
-	0x68, 0x0B, 0x06, 0x00, 0x88, 0x0F, 0xD1, 0x77, 0x3E, 0xED, 0xB3, 0x05,
-	0x90, 0x48, 0x7C, 0xC5, 0xE3, 0xD3, 0x7E, 0xB0, 0xE2, 0xD3, 0x49, 0x41,
-	0x00, 0x00, 0xF1, 0xD9, 0xDC, 0xF3, 0x9E, 0x7F, 0xA4, 0x84, 0xF2, 0xB0,
-	0xC1, 0x8F, 0x3B, 0xFC, 0xC8, 0xC3, 0x8F, 0x3D, 0x41, 0x27, 0xEF, 0x01,
-	0x50, 0xE2, 0xF3, 0xCA, 0xE7, 0x83, 0x9F, 0x44, 0xA2, 0xF8, 0xFC, 0xB6,
-	0xCF, 0xC0, 0x4D, 0xC1, 0x27, 0xAF, 0x01, 0x80, 0xF8, 0x7C, 0xC5, 0xA3,
-	0xF8, 0x7C, 0xE5, 0x93, 0x48, 0xDB, 0xF6, 0xC2, 0x3D, 0x7F, 0x7B, 0xA5,
-	0xC2, 0x6F, 0xFC, 0x51, 0x24, 0x6F, 0x01, 0x68, 0x83, 0xF8, 0xEC, 0xCA,
-	0x65, 0x97, 0x2E, 0xBB, 0x76, 0xA3, 0x49, 0x5E, 0x02, 0x00, 0xF1, 0xF9,
-	0x65, 0x8F, 0x5F, 0xF8, 0xF8, 0x99, 0x57, 0x22, 0x71, 0x10, 0x07, 0x9B,
-	0xFD, 0xA8, 0xC4, 0xA7, 0xE3, 0xBC, 0x03, 0x00, 0xE2, 0xF3, 0x9B, 0x3E,
-	0x7B, 0xF5, 0x8E, 0x37, 0x52, 0xBE, 0x7F, 0xDF, 0x0F, 0xC5, 0xE7, 0x48,
-	0x1E, 0x8E, 0xE8, 0x89, 0x2E, 0x79, 0x05, 0x00, 0xC4, 0xDF, 0x5F, 0x89,
-	0xCF, 0xDE, 0x3D, 0x89, 0xC4, 0xB1, 0x7B, 0x14, 0x7F, 0x9D, 0x84, 0x31,
-	0x1F, 0x6D, 0x78, 0x03, 0x00, 0xC4, 0xE7, 0x08, 0x1E, 0x5E, 0xF9, 0x27,
-	0x21, 0x08, 0x33, 0x36, 0xA5, 0x87, 0xEF, 0x53, 0xFC, 0x0B, 0x21, 0x3E,
-	0x47, 0xF1, 0x46, 0x9B, 0xBC, 0x00, 0x00, 0xE2, 0x73, 0xEC, 0x1E, 0x87,
-	0x71, 0x9D, 0xA6, 0xAD, 0x54, 0x7E, 0x37, 0x3F, 0xC7, 0xEB, 0x73, 0xDC,
-	0x3E, 0xC7, 0xEF, 0x47, 0x9D, 0x9C, 0x07, 0x40, 0x89, 0xAF, 0x1B, 0x79,
-	0x5B, 0x47, 0x4C, 0x8A, 0xCF, 0xE9, 0x5A, 0x1D, 0x8F, 0xCB, 0xAB, 0x73,
-	0x70, 0x9D, 0x2E, 0xE3, 0x34, 0x00, 0x10, 0x9F, 0x43, 0xB6, 0xDF, 0x41,
-	0x3E, 0x57, 0xC8, 0x31, 0x9C, 0xA6, 0x75, 0x39, 0xC4, 0x7F, 0x53, 0xC8,
-	0x9E, 0xF7, 0x66, 0x9C, 0x05, 0x00, 0xE2, 0x73, 0x9A, 0x16, 0x27, 0x6D,
-	0x5C, 0x20, 0xE4, 0x65, 0x3E, 0x38, 0x70, 0x96, 0xAE, 0x95, 0x70, 0x6C,
-	0x42, 0xE7, 0x20, 0x6E, 0xC6, 0x49, 0x00, 0x94, 0xF8, 0x65, 0x83, 0x2F,
-	0x57, 0x3B, 0x8B, 0xE2, 0x5F, 0x07, 0xF1, 0x57, 0x88, 0x7B, 0xD0, 0x73,
-	0x83, 0xCE, 0x01, 0xA0, 0xC4, 0xE7, 0x44, 0x4D, 0x4E, 0xD8, 0x44, 0x12,
-	0x79, 0xE2, 0x67, 0x64, 0x8E, 0xE7, 0x3D, 0xD7, 0xAA, 0x2D, 0x87, 0xEF,
-	0x14, 0x00, 0x4A, 0x7C, 0x89, 0xC8, 0xDB, 0xD5, 0xCE, 0x9A, 0x00, 0xF1,
-	0x97, 0xB6, 0xC5, 0x7B, 0x01, 0x18, 0x75, 0x06, 0x00, 0x88, 0xCF, 0x17,
-	0xFB, 0xE5, 0xC8, 0x9C, 0xA7, 0x2F, 0x95, 0x6E, 0x87, 0xF8, 0x8F, 0x49,
-	0x19, 0x0B, 0xD1, 0x8E, 0x13, 0x00, 0x28, 0xF1, 0xB1, 0xC2, 0x56, 0x76,
-	0x7D, 0x51, 0x27, 0xE7, 0xBC, 0xEE, 0xDF, 0x09, 0xF1, 0x1F, 0x2E, 0x6A,
-	0x2F, 0xB6, 0xF2, 0xD6, 0x01, 0x50, 0xE2, 0x33, 0xF8, 0x32, 0x63, 0xF3,
-	0xC8, 0xA4, 0x81, 0xD9, 0xD4, 0x4A, 0x4F, 0xE5, 0x41, 0x19, 0x63, 0x61,
-	0x5B, 0x71, 0x01, 0x00, 0x46, 0xE3, 0x62, 0x54, 0x2E, 0xA9, 0x64, 0x35,
-	0xF8, 0xB2, 0xD4, 0x49, 0x74, 0xCA, 0x8E, 0x55, 0x00, 0x70, 0xF5, 0x33,
-	0x08, 0x23, 0x83, 0x31, 0x9A, 0xA7, 0xDA, 0x7B, 0xC0, 0x3C, 0x34, 0xFB,
-	0xB3, 0xCC, 0x8D, 0xC5, 0x57, 0xD3, 0x1A, 0x00, 0x10, 0xFF, 0x56, 0xB8,
-	0xFB, 0x71, 0x41, 0x97, 0x3B, 0x11, 0x7C, 0x59, 0xF0, 0x7C, 0x3A, 0x62,
-	0xCA, 0x0A, 0x00, 0x6A, 0x34, 0xCF, 0x4F, 0x38, 0x43, 0x76, 0xEF, 0x4A,
-	0x24, 0x67, 0x82, 0x2F, 0x4B, 0x9C, 0x4C, 0x27, 0x6D, 0xD8, 0x02, 0xA0,
-	0x2A, 0x06, 0x6F, 0x89, 0xD3, 0xED, 0xFB, 0x46, 0xE4, 0x54, 0xF0, 0xE5,
-	0x12, 0x67, 0x63, 0xA5, 0xAA, 0x2D, 0x00, 0xD8, 0xB5, 0xDB, 0xB2, 0x83,
-	0x67, 0xD7, 0xED, 0x3D, 0xE7, 0x55, 0xCF, 0xB9, 0xE0, 0xCB, 0x56, 0x54,
-	0x2C, 0xB1, 0x53, 0x5B, 0x00, 0x7C, 0x87, 0x63, 0x3E, 0xB6, 0xE8, 0x71,
-	0xD7, 0x81, 0xF0, 0x3A, 0xEA, 0xB3, 0x67, 0xAF, 0xE3, 0xEB, 0xED, 0x16,
-	0x3D, 0x6E, 0x97, 0xCB, 0xDB, 0x02, 0xE0, 0x2B, 0x38, 0x65, 0x58, 0x49,
-	0xC7, 0x70, 0x8A, 0x36, 0x27, 0x6F, 0xFC, 0x5C, 0xD2, 0x4E, 0xD4, 0xD5,
-	0x6D, 0x01, 0xC0, 0xAF, 0x7E, 0x12, 0x4B, 0xAE, 0x71, 0xE2, 0x26, 0x21,
-	0xF8, 0x35, 0x6A, 0x15, 0x4B, 0x9C, 0xBC, 0x2D, 0x00, 0x18, 0xA0, 0x91,
-	0x4B, 0xAC, 0x0B, 0xA4, 0x01, 0x98, 0xB5, 0xDB, 0x43, 0x08, 0x82, 0x9A,
-	0xB7, 0x2F, 0xE0, 0x18, 0x2D, 0x13, 0x56, 0x00, 0xE0, 0x91, 0xE1, 0x55,
-	0x50, 0xE2, 0x36, 0xB0, 0xEB, 0x24, 0x39, 0x81, 0x33, 0xA8, 0xC8, 0x1D,
-	0x5A, 0xEA, 0x09, 0x14, 0xB2, 0x09, 0x00, 0x67, 0xF3, 0x7E, 0x83, 0x2C,
-	0x15, 0xC4, 0x21, 0x98, 0xC0, 0x4D, 0x02, 0xBA, 0x6A, 0x9B, 0xB0, 0x06,
-	0x80, 0x6A, 0x05, 0x8E, 0xC1, 0x96, 0x73, 0xFB, 0x0E, 0xEA, 0x7F, 0xC4,
-	0x46, 0xD1, 0xBB, 0x82, 0x08, 0xDD, 0xA6, 0xAD, 0x9E, 0x40, 0x41, 0xAB,
-	0x00, 0x28, 0x08, 0x9A, 0x46, 0xF1, 0x32, 0x1C, 0x0B, 0xE4, 0x7D, 0xF0,
-	0x46, 0x01, 0x5D, 0xB5, 0x4D, 0x58, 0x07, 0x40, 0x41, 0x90, 0x13, 0xC7,
-	0x4F, 0xFB, 0x5C, 0xAA, 0x0B, 0x6E, 0xC0, 0x1F, 0x9C, 0xEB, 0xE7, 0x5D,
-	0xEC, 0x5E, 0xA3, 0xB3, 0x2D, 0x51, 0xC9, 0x09, 0x00, 0x14, 0x04, 0xFC,
-	0x2E, 0xC0, 0x09, 0x9F, 0x52, 0x31, 0x7C, 0xBD, 0x8C, 0xDE, 0x5D, 0x42,
-	0x4B, 0xA3, 0xAA, 0xCE, 0x00, 0xA0, 0x20, 0x90, 0x0E, 0xE4, 0xCC, 0x69,
-	0x5F, 0x9C, 0xFE, 0xE5, 0x4D, 0xFC, 0x7E, 0x23, 0x15, 0x4B, 0x54, 0x72,
-	0x0A, 0x00, 0x05, 0x81, 0x74, 0x28, 0x77, 0x6F, 0x96, 0x6F, 0x29, 0xA1,
-	0xA3, 0x71, 0x55, 0xE7, 0x00, 0x50, 0x10, 0x48, 0xAF, 0xE4, 0xE1, 0xFC,
-	0xEA, 0x5D, 0xC6, 0x0A, 0x96, 0xAC, 0xE8, 0x24, 0x00, 0x0A, 0x82, 0x91,
-	0xD8, 0x72, 0x72, 0x88, 0xD4, 0x8A, 0x1E, 0xEC, 0x3C, 0x1A, 0x83, 0xDB,
-	0x81, 0xD3, 0xAB, 0x78, 0x95, 0xD4, 0xB3, 0x70, 0x75, 0x67, 0x01, 0x50,
-	0x10, 0x5C, 0x81, 0xED, 0x8B, 0xC8, 0x52, 0xAB, 0x79, 0x71, 0x11, 0x47,
-	0x42, 0x90, 0x7A, 0x10, 0x15, 0x2A, 0x4E, 0x03, 0xA0, 0x20, 0xE8, 0xBF,
-	0x98, 0x63, 0x61, 0xCE, 0x6B, 0x2A, 0x70, 0x86, 0xD0, 0x4D, 0x09, 0x82,
-	0x3E, 0x9F, 0x38, 0x0F, 0x80, 0x82, 0x40, 0x7A, 0x39, 0xD7, 0xA7, 0x01,
-	0xC0, 0xB8, 0x72, 0x1C, 0x85, 0x51, 0xDB, 0x0B, 0x00, 0x14, 0x04, 0x7A,
-	0x0B, 0x3A, 0xE7, 0x7D, 0x3E, 0xAC, 0xFD, 0xDF, 0x22, 0x40, 0x30, 0x39,
-	0x0C, 0x19, 0xCD, 0xCF, 0xC2, 0x1B, 0x00, 0x76, 0x42, 0x30, 0xA8, 0x77,
-	0x4A, 0xF6, 0x5F, 0xC6, 0xA1, 0xE4, 0x52, 0x69, 0x01, 0x20, 0x98, 0x21,
-	0x65, 0xCC, 0x47, 0x3B, 0x5E, 0x01, 0xA0, 0x5A, 0x82, 0xE9, 0xD8, 0xCE,
-	0x2F, 0xE3, 0xEC, 0xBA, 0x46, 0xE2, 0x5E, 0x40, 0x70, 0x5F, 0x19, 0x7B,
-	0x3E, 0xD7, 0xF5, 0x0E, 0x00, 0x05, 0xC1, 0x5C, 0x6C, 0x67, 0x0A, 0x3A,
-	0x7E, 0x2A, 0x20, 0x88, 0x72, 0x2A, 0x99, 0x97, 0x00, 0x28, 0x08, 0x16,
-	0x62, 0x3B, 0x2D, 0x1F, 0x82, 0x46, 0x0F, 0x04, 0x4D, 0xBB, 0x99, 0x27,
-	0x03, 0x82, 0x45, 0x82, 0x50, 0x79, 0x61, 0xCA, 0x5B, 0x00, 0x14, 0x04,
-	0x8B, 0xB1, 0x9D, 0x28, 0xE8, 0xE9, 0xE8, 0x62, 0x09, 0xF8, 0x0E, 0x00,
-	0x63, 0x0A, 0xEC, 0x9E, 0x59, 0x6C, 0x38, 0x7E, 0xA0, 0x9E, 0x1F, 0x86,
-	0x92, 0x59, 0x26, 0x08, 0x95, 0xD3, 0xA6, 0xBC, 0x06, 0x40, 0xB5, 0x02,
-	0x84, 0xE0, 0x05, 0x64, 0x7E, 0x30, 0xD2, 0x4C, 0xB9, 0xA3, 0x8D, 0xC8,
-	0xD1, 0x58, 0x40, 0xF0, 0x92, 0xA6, 0x31, 0xAF, 0x8B, 0x79, 0x0F, 0x80,
-	0x82, 0x80, 0x9F, 0x8A, 0x25, 0x43, 0xCB, 0x44, 0x13, 0x4E, 0x2E, 0x08,
-	0x00, 0xAA, 0x20, 0x90, 0x8C, 0x2C, 0xC6, 0x80, 0x92, 0xA3, 0xD1, 0x12,
-	0xBC, 0xE7, 0xF5, 0x25, 0xDE, 0xE2, 0xE0, 0x83, 0x01, 0xA0, 0x0A, 0x02,
-	0xC9, 0xD8, 0x82, 0x84, 0x80, 0x03, 0x4A, 0x3E, 0x0C, 0x15, 0x82, 0xA0,
-	0x00, 0x50, 0x10, 0xB0, 0xFB, 0x98, 0xA1, 0x65, 0x47, 0x08, 0x89, 0x16,
-	0x74, 0x44, 0xF1, 0xE0, 0x00, 0x50, 0x10, 0x30, 0xB8, 0x34, 0x67, 0x1E,
-	0x9D, 0x21, 0x04, 0x01, 0xD7, 0x14, 0x38, 0x07, 0x2D, 0xC1, 0x97, 0x42,
-	0xF6, 0x9C, 0x31, 0x13, 0x24, 0x00, 0x0A, 0x02, 0x0E, 0x2E, 0x5D, 0x8B,
-	0x3C, 0x5C, 0xC8, 0xDB, 0x41, 0x2E, 0x29, 0x13, 0x2C, 0x00, 0x0A, 0x02,
-	0x46, 0x20, 0xE1, 0x48, 0x63, 0xB3, 0xD5, 0x45, 0xFA, 0x93, 0xB3, 0x0D,
-	0x3F, 0x71, 0x0A, 0x5A, 0x30, 0x8B, 0x4A, 0x05, 0x0D, 0x80, 0x82, 0x80,
-	0x4B, 0xCC, 0x70, 0xF6, 0x91, 0xF6, 0xFA, 0x42, 0x2D, 0x3E, 0x28, 0x05,
-	0xB5, 0xAC, 0x5C, 0xF0, 0x00, 0x28, 0x08, 0xEA, 0x96, 0x97, 0x33, 0x9A,
-	0x76, 0x56, 0xDD, 0x1E, 0x70, 0x55, 0x51, 0xCE, 0x48, 0xDE, 0x2C, 0x74,
-	0x7B, 0xB1, 0x66, 0x26, 0x0A, 0x00, 0xAA, 0x20, 0xE0, 0xA2, 0xD2, 0x52,
-	0x0B, 0x4C, 0x06, 0x11, 0xA0, 0x22, 0x1A, 0x00, 0x14, 0x04, 0xD2, 0x4B,
-	0xCC, 0x7A, 0x1F, 0xA0, 0x22, 0x2A, 0x00, 0x14, 0x04, 0xD2, 0x8B, 0x4C,
-	0x73, 0x59, 0x79, 0x6F, 0x03, 0x54, 0x44, 0x07, 0x80, 0x82, 0x80, 0x2B,
-	0x8C, 0xF3, 0xC1, 0x90, 0x30, 0x48, 0x24, 0x6F, 0x03, 0x54, 0x44, 0x09,
-	0x80, 0x82, 0x80, 0xCF, 0x02, 0xEB, 0x91, 0xF3, 0x03, 0x54, 0xE8, 0xF7,
-	0x31, 0x7B, 0x19, 0xA0, 0x22, 0x5A, 0x00, 0x14, 0x04, 0x39, 0x01, 0x2A,
-	0x8C, 0x1A, 0x06, 0xEF, 0x02, 0x54, 0x44, 0x0D, 0x80, 0x82, 0xA0, 0x69,
-	0x80, 0x0A, 0x23, 0x04, 0xB2, 0xCC, 0xAB, 0x00, 0x15, 0xD1, 0x03, 0xA0,
-	0x20, 0x88, 0x36, 0x40, 0x45, 0x02, 0x40, 0x5D, 0xE6, 0x88, 0x5A, 0xA6,
-	0x17, 0xA0, 0x42, 0xFF, 0x99, 0x60, 0x1D, 0x4C, 0x77, 0xE3, 0x63, 0x11,
-	0x3B, 0x92, 0x9C, 0x4D, 0x09, 0x80, 0x2A, 0x69, 0x00, 0x41, 0x74, 0x01,
-	0x2A, 0x12, 0x00, 0x75, 0xD7, 0x26, 0x20, 0x88, 0x2A, 0x40, 0x45, 0x02,
-	0xA0, 0x41, 0xE3, 0x0C, 0x08, 0x18, 0xC9, 0x9C, 0x4B, 0xD6, 0x1A, 0xC4,
-	0x26, 0x68, 0x78, 0x8F, 0x70, 0x36, 0x40, 0x45, 0x02, 0xA0, 0xC9, 0xDD,
-	0x19, 0x10, 0xC8, 0x07, 0xA8, 0x98, 0x8D, 0xD8, 0x04, 0x73, 0xDC, 0x0A,
-	0x50, 0x91, 0x00, 0xC8, 0x79, 0x3C, 0x03, 0x04, 0xD2, 0x01, 0x2A, 0xB8,
-	0x6E, 0x31, 0xD7, 0x2F, 0x76, 0x26, 0x40, 0x45, 0x02, 0xA0, 0xC5, 0xF3,
-	0x39, 0x20, 0x10, 0x08, 0x50, 0x51, 0xD3, 0xFD, 0xEC, 0x54, 0x80, 0x8A,
-	0x04, 0x80, 0xC6, 0x0B, 0x1A, 0x16, 0x35, 0x45, 0x30, 0x89, 0x1D, 0x4F,
-	0x6A, 0x14, 0xD5, 0x2D, 0xF2, 0x24, 0x5A, 0x81, 0xF1, 0xBA, 0x85, 0xDB,
-	0x59, 0x2E, 0x01, 0xA0, 0xE9, 0x5D, 0xB4, 0x04, 0x7A, 0x01, 0x2A, 0x34,
-	0xED, 0xA1, 0x98, 0x13, 0x0B, 0x5D, 0x25, 0x00, 0xF4, 0x05, 0x63, 0x88,
-	0x7B, 0x99, 0xC5, 0xAE, 0xF6, 0xEC, 0xD3, 0x7A, 0x80, 0x8A, 0x04, 0x40,
-	0x01, 0x00, 0xD4, 0x67, 0xE3, 0xD2, 0x01, 0x2A, 0xEA, 0x76, 0x69, 0x75,
-	0xA5, 0xD3, 0x04, 0x40, 0x41, 0x00, 0x14, 0x04, 0x73, 0xB0, 0xBD, 0xC7,
-	0xA0, 0x6A, 0xB3, 0x2A, 0x0C, 0x5D, 0xC7, 0x37, 0x84, 0x8E, 0xA7, 0x04,
-	0x80, 0xA1, 0xCB, 0x71, 0x3B, 0x68, 0x12, 0xA0, 0x42, 0xBF, 0xB3, 0xA0,
-	0x6A, 0xD7, 0x1C, 0x69, 0x3C, 0x04, 0x10, 0x6C, 0x35, 0x3C, 0x1C, 0xE3,
-	0x6A, 0x09, 0x00, 0x63, 0xD7, 0xED, 0x5C, 0xF6, 0x46, 0x32, 0x40, 0xC5,
-	0x24, 0x00, 0xB0, 0xA4, 0xC4, 0xE1, 0x18, 0x55, 0x4D, 0x00, 0x18, 0xB9,
-	0xAD, 0xAF, 0x12, 0x00, 0xA8, 0x09, 0x50, 0x51, 0xC2, 0x14, 0xAB, 0xAE,
-	0x01, 0x00, 0xDD, 0x25, 0x6D, 0x14, 0xAE, 0x9E, 0x00, 0x28, 0xEC, 0xB2,
-	0xDA, 0x0A, 0x0A, 0x82, 0x82, 0x01, 0x2A, 0x1A, 0xEE, 0x74, 0x23, 0x00,
-	0x18, 0x5A, 0xF2, 0x70, 0x0A, 0x57, 0x4F, 0x00, 0x14, 0x76, 0x59, 0xFF,
-	0x0A, 0x80, 0x40, 0x22, 0x40, 0xC5, 0x06, 0x00, 0xD0, 0x25, 0x70, 0x38,
-	0x85, 0x4C, 0x24, 0x00, 0x0A, 0xB9, 0xAB, 0x79, 0x61, 0x05, 0x41, 0x99,
-	0x00, 0x15, 0x2B, 0x00, 0xC0, 0x58, 0xA1, 0xC3, 0xD1, 0x36, 0x93, 0x00,
-	0xD0, 0x76, 0x55, 0xEB, 0x82, 0x0A, 0x02, 0xD3, 0x00, 0x15, 0xA3, 0x00,
-	0xC0, 0xEA, 0xD6, 0x7B, 0x91, 0x2D, 0x91, 0x00, 0x90, 0xF5, 0x27, 0x1F,
-	0x0C, 0x39, 0x86, 0x80, 0x63, 0x09, 0x5A, 0xAE, 0x8E, 0x5E, 0xB5, 0x6B,
-	0x0E, 0x24, 0x3D, 0xC1, 0x46, 0x2F, 0x61, 0x02, 0x40, 0x18, 0x00, 0xF5,
-	0x76, 0xC0, 0x00, 0x15, 0x8C, 0x52, 0xC2, 0xD1, 0x45, 0xAD, 0x12, 0xDF,
-	0xFD, 0xBB, 0x20, 0x3E, 0x27, 0x97, 0x74, 0x3C, 0x25, 0x00, 0xDA, 0xE4,
-	0x72, 0xD5, 0x12, 0x70, 0x91, 0xEC, 0xBC, 0xF0, 0x75, 0x9C, 0x5D, 0xCC,
-	0x40, 0x54, 0x9C, 0x54, 0x62, 0x25, 0x25, 0x00, 0xDA, 0xEC, 0x76, 0x35,
-	0xDA, 0x98, 0x5D, 0xBF, 0x1C, 0x70, 0x3A, 0x18, 0x99, 0x41, 0x26, 0x36,
-	0x21, 0xAF, 0x44, 0x5E, 0x66, 0x7B, 0x09, 0x9B, 0xFF, 0x01, 0x58, 0x3A,
-	0x0A, 0xAE, 0x35, 0xA8, 0x89, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x49, 0x45,
-	0x4E, 0x44, 0xAE, 0x42, 0x60, 0x82
-};
@@ -1,311 +0,0 @@
-
-inline unsigned char g_DownloadIcon[3696] = {
-	0x89, 0x50, 0x4E, 0x47, 0x0D, 0x0A, 0x1A, 0x0A, 0x00, 0x00, 0x00, 0x0D,
-	0x49, 0x48, 0x44, 0x52, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80,
-	0x08, 0x06, 0x00, 0x00, 0x00, 0xC3, 0x3E, 0x61, 0xCB, 0x00, 0x00, 0x0E,
-	0x37, 0x49, 0x44, 0x41, 0x54, 0x78, 0x5E, 0xED, 0x5D, 0x09, 0xCC, 0x1D,
-	0x55, 0x15, 0x7E, 0xAF, 0x15, 0x69, 0x8C, 0x1A, 0x17, 0x62, 0x8C, 0xA2,
-	0x16, 0x23, 0x88, 0x89, 0xC6, 0x35, 0xC4, 0x82, 0xB1, 0x28, 0x02, 0x2A,
-	0x51, 0x40, 0xAD, 0x7B, 0x08, 0x1A, 0x15, 0x71, 0x01, 0xB1, 0x2A, 0xA0,
-	0x54, 0x22, 0x8B, 0x02, 0x2A, 0x42, 0x50, 0x94, 0xC5, 0x50, 0x02, 0x6A,
-	0xDD, 0x42, 0xDD, 0x62, 0x62, 0x14, 0x71, 0x09, 0x41, 0x62, 0x8C, 0x1A,
-	0x11, 0xC5, 0x2A, 0x75, 0x2B, 0x58, 0x49, 0xD5, 0x8A, 0x58, 0xA1, 0xFD,
-	0x9F, 0xDF, 0x37, 0xFF, 0xCC, 0x7B, 0xF3, 0x66, 0xEE, 0xCC, 0x3D, 0x77,
-	0x99, 0x3B, 0xF7, 0xBD, 0x77, 0x6F, 0x72, 0xF3, 0xB7, 0xFF, 0x7F, 0xCE,
-	0xB9, 0x67, 0xF9, 0xE6, 0xDC, 0x3B, 0x77, 0x9B, 0xE1, 0x20, 0x95, 0x85,
-	0xF6, 0xC0, 0x70, 0x91, 0xAC, 0x1F, 0x8D, 0x46, 0xF7, 0x83, 0xBD, 0xAF,
-	0x44, 0x7D, 0x39, 0xEA, 0xD3, 0x50, 0x1F, 0x81, 0xBA, 0x1D, 0xF5, 0x97,
-	0xA8, 0xD7, 0xA1, 0x6E, 0x1A, 0x0E, 0x87, 0xF7, 0x2E, 0x92, 0x4F, 0x16,
-	0x06, 0x00, 0x08, 0xFE, 0xB3, 0x10, 0xD8, 0x6B, 0x50, 0x0F, 0x6C, 0x09,
-	0xF0, 0x6D, 0xF8, 0xDB, 0x1B, 0x00, 0x82, 0x1B, 0x17, 0x05, 0x04, 0x0B,
-	0x01, 0x00, 0x04, 0xFF, 0x08, 0x04, 0xF4, 0x6B, 0xA8, 0xAB, 0x04, 0x81,
-	0xDD, 0x05, 0x9A, 0x75, 0x00, 0xC1, 0x37, 0x05, 0xB4, 0x33, 0x4F, 0x32,
-	0xF7, 0x00, 0x40, 0xF0, 0x57, 0x23, 0x4A, 0xBF, 0x40, 0x7D, 0xB0, 0x41,
-	0xB4, 0xEE, 0x06, 0xED, 0x33, 0x01, 0x02, 0x66, 0x84, 0xB9, 0x2E, 0x0B,
-	0x00, 0x80, 0x3D, 0x5F, 0x1C, 0x0C, 0x56, 0xB0, 0xDF, 0x1F, 0x97, 0x11,
-	0xFE, 0x25, 0x30, 0x7C, 0x33, 0x00, 0x70, 0xEC, 0x5C, 0x47, 0x5F, 0xE6,
-	0x87, 0xD9, 0x75, 0x01, 0x9E, 0xFE, 0x7D, 0xA0, 0xFD, 0x1D, 0xA8, 0x1C,
-	0xFC, 0xD9, 0x94, 0x47, 0x03, 0x04, 0xDB, 0x6C, 0x18, 0x67, 0x85, 0x47,
-	0xF0, 0x20, 0xCC, 0x8A, 0x29, 0x75, 0x3D, 0x01, 0x80, 0x57, 0xE3, 0xB7,
-	0x5F, 0x50, 0x59, 0xB0, 0x84, 0x5F, 0xAE, 0xC8, 0xFF, 0x50, 0xFE, 0x77,
-	0x85, 0x96, 0x03, 0xC2, 0x8D, 0xB3, 0xEB, 0x01, 0xBD, 0xE6, 0xF3, 0x0E,
-	0x80, 0xD3, 0xE0, 0x82, 0x8F, 0xE8, 0xDD, 0xD0, 0x48, 0x71, 0x16, 0x00,
-	0x70, 0xA6, 0x03, 0x7F, 0xF4, 0xAC, 0xF3, 0x0E, 0x80, 0xB3, 0x11, 0x81,
-	0x33, 0x1A, 0xA3, 0xA0, 0x1F, 0x0C, 0x5C, 0x04, 0x00, 0x9C, 0x12, 0x7D,
-	0x14, 0x1D, 0x14, 0x9C, 0x6B, 0x00, 0xEC, 0x19, 0x8D, 0xCE, 0x45, 0x9A,
-	0x7F, 0x7F, 0xDD, 0x3F, 0x2D, 0x49, 0x7F, 0x9A, 0x38, 0x01, 0xC0, 0x01,
-	0x5C, 0xBD, 0xB3, 0x62, 0x0C, 0x70, 0x3E, 0x94, 0x78, 0x9F, 0x91, 0x22,
-	0xD3, 0xD8, 0xB8, 0x10, 0x19, 0x60, 0xBD, 0x11, 0xFF, 0x8C, 0x11, 0xCF,
-	0x75, 0x06, 0xB0, 0x02, 0xC0, 0x74, 0x00, 0x2F, 0x00, 0x00, 0x4E, 0x9D,
-	0xB1, 0x98, 0x1A, 0xA9, 0x3B, 0xD7, 0x00, 0x58, 0x89, 0x0C, 0xB0, 0xDB,
-	0x34, 0x03, 0x24, 0x00, 0x18, 0x01, 0x28, 0x6A, 0x62, 0x75, 0x06, 0xD0,
-	0x8F, 0xFC, 0x26, 0x46, 0x2D, 0x21, 0x03, 0xAC, 0x4C, 0x19, 0x20, 0xEA,
-	0x28, 0xB7, 0x28, 0x97, 0xBA, 0x00, 0x7D, 0xE4, 0xE6, 0xBA, 0x0B, 0xC8,
-	0x00, 0x30, 0xC2, 0x20, 0xD0, 0xDE, 0xCA, 0x34, 0x06, 0xD0, 0x63, 0x28,
-	0x5E, 0x0A, 0x00, 0xE0, 0xA3, 0xD0, 0xEE, 0x3D, 0x0E, 0x1A, 0x26, 0x00,
-	0x38, 0x38, 0xAF, 0x77, 0x56, 0x00, 0xE0, 0xE3, 0x50, 0xE2, 0xDD, 0x7A,
-	0x45, 0x54, 0xE3, 0x82, 0xEC, 0x77, 0x09, 0x00, 0x7A, 0xE7, 0xC5, 0x4B,
-	0x01, 0x00, 0x7C, 0x02, 0xDA, 0xBD, 0xCB, 0x48, 0x43, 0xC4, 0x7D, 0x84,
-	0x2E, 0x23, 0xEF, 0x35, 0xCE, 0xC1, 0x6B, 0xE0, 0x06, 0x23, 0xFE, 0x19,
-	0x23, 0xB6, 0xEF, 0x1D, 0x67, 0xC0, 0x50, 0x2B, 0x00, 0x4C, 0xDB, 0x95,
-	0x00, 0x30, 0x03, 0x71, 0x6E, 0x54, 0x31, 0x01, 0x40, 0x1F, 0xBD, 0x94,
-	0x01, 0xF0, 0x9A, 0xD0, 0xB2, 0x3D, 0x24, 0x65, 0x00, 0x3D, 0x86, 0xE2,
-	0xA5, 0xC8, 0x32, 0xC0, 0x12, 0xC6, 0x00, 0xC5, 0xC2, 0xBF, 0xB9, 0xAA,
-	0x09, 0x00, 0xE6, 0x3E, 0x8B, 0x87, 0x23, 0x03, 0xC0, 0x08, 0x00, 0x50,
-	0xE5, 0x39, 0xED, 0x82, 0x60, 0x96, 0x19, 0x12, 0x00, 0xE2, 0x09, 0xA7,
-	0xB9, 0x26, 0x00, 0xC0, 0xC5, 0xE0, 0x3A, 0xC9, 0x9C, 0x73, 0xCC, 0x91,
-	0x36, 0x84, 0x38, 0x38, 0xAF, 0x77, 0x56, 0x0F, 0x00, 0x38, 0x13, 0xAF,
-	0x81, 0x67, 0xF5, 0x6E, 0x48, 0x87, 0x0A, 0xCC, 0xFB, 0x20, 0xF0, 0x53,
-	0xF0, 0xDD, 0xDB, 0x26, 0xFE, 0x33, 0x59, 0x08, 0xCA, 0xB8, 0x12, 0x00,
-	0x3A, 0x04, 0x5F, 0xE7, 0xA2, 0x91, 0x01, 0x2A, 0x00, 0x30, 0x6E, 0x32,
-	0x01, 0xC0, 0xD8, 0x65, 0x11, 0x31, 0x24, 0x00, 0xE8, 0x83, 0xB1, 0x60,
-	0x5D, 0x40, 0xC5, 0x21, 0xFA, 0x1E, 0x21, 0x65, 0x00, 0x3D, 0x86, 0xE2,
-	0xA5, 0x90, 0x67, 0x80, 0xC6, 0x77, 0xC2, 0x04, 0x80, 0x78, 0xC3, 0xAB,
-	0xD7, 0x4C, 0x0E, 0x80, 0x46, 0x59, 0x09, 0x00, 0x7A, 0x37, 0xC7, 0x4B,
-	0xD1, 0x0A, 0x00, 0xED, 0x44, 0x50, 0x7A, 0x0B, 0x88, 0x37, 0xB2, 0x42,
-	0xCD, 0x00, 0x80, 0xCB, 0x40, 0xFA, 0x16, 0x15, 0xB9, 0x2C, 0xFE, 0xE9,
-	0x35, 0x50, 0xE8, 0xEA, 0x38, 0xC9, 0xDA, 0x00, 0x30, 0xD1, 0xB8, 0x15,
-	0x0A, 0xA9, 0x0B, 0x88, 0x33, 0xB4, 0x32, 0xAD, 0x00, 0x80, 0x2B, 0x40,
-	0xF9, 0x26, 0x1D, 0x75, 0x0B, 0x04, 0x12, 0x00, 0x74, 0xCE, 0x8B, 0xF9,
-	0xEF, 0x12, 0x00, 0x68, 0xBA, 0x82, 0x0D, 0x98, 0x0A, 0x3E, 0x27, 0x66,
-	0x1B, 0x5D, 0x75, 0x9B, 0xF7, 0x79, 0x00, 0x51, 0x06, 0x68, 0x71, 0x62,
-	0x02, 0x80, 0x2B, 0xC2, 0xFA, 0xE4, 0x6F, 0xCF, 0x00, 0xFA, 0x59, 0x20,
-	0xE8, 0x9E, 0x00, 0xD0, 0x67, 0x00, 0x5D, 0xDB, 0x56, 0x03, 0x40, 0x9D,
-	0xF4, 0x1B, 0xBA, 0x82, 0x0F, 0xA0, 0x0B, 0xF8, 0xB0, 0xAB, 0x1E, 0x31,
-	0xF3, 0xA7, 0x2E, 0xA0, 0x35, 0x3A, 0x2B, 0x4F, 0x1F, 0x0E, 0x97, 0xCE,
-	0x8B, 0x39, 0x80, 0xAE, 0xBA, 0xCD, 0x3B, 0x00, 0x3E, 0x0B, 0x07, 0xBD,
-	0xD1, 0xC1, 0x49, 0x00, 0xC0, 0x30, 0x01, 0xC0, 0xC1, 0x81, 0xBD, 0xB2,
-	0xA2, 0x0B, 0xB8, 0x0A, 0x0A, 0x1C, 0xEF, 0xA0, 0x44, 0x02, 0x80, 0x83,
-	0xF3, 0x7A, 0x67, 0x05, 0x00, 0xAE, 0x86, 0x12, 0xC7, 0xD5, 0x14, 0x11,
-	0x4E, 0x03, 0x82, 0xEF, 0x54, 0x64, 0x80, 0x0B, 0x7A, 0x37, 0xA4, 0x43,
-	0x05, 0xE6, 0xBD, 0x0B, 0x50, 0x03, 0x40, 0xE3, 0xD0, 0x12, 0x3E, 0xDE,
-	0x0B, 0x00, 0x7C, 0xAC, 0x43, 0xFF, 0xF7, 0x2E, 0x3A, 0x01, 0x60, 0x2A,
-	0x04, 0xB5, 0xD4, 0x90, 0x00, 0xD0, 0x3B, 0x44, 0x1D, 0x14, 0xA8, 0x77,
-	0x01, 0xA2, 0x77, 0xFF, 0x72, 0x8B, 0x5E, 0x01, 0x00, 0x7D, 0x1E, 0x00,
-	0xE1, 0x07, 0xA1, 0xF2, 0x96, 0x72, 0x5E, 0x47, 0x7B, 0x1B, 0x32, 0xCC,
-	0x16, 0x07, 0x13, 0x9D, 0x59, 0x7B, 0xC9, 0x00, 0xF9, 0x0D, 0x9E, 0xEC,
-	0x9B, 0x8F, 0x44, 0x7D, 0x3C, 0x2A, 0x8F, 0x6E, 0xF0, 0xDA, 0xF6, 0x1B,
-	0x50, 0xAF, 0x86, 0x53, 0x7E, 0xE3, 0x6C, 0x19, 0x04, 0x4C, 0x01, 0x40,
-	0xDE, 0xEF, 0x4F, 0x9A, 0xDE, 0x3D, 0x58, 0x3F, 0xDC, 0x6B, 0x78, 0xA1,
-	0xAB, 0x2E, 0xD0, 0x83, 0x37, 0x94, 0xF3, 0xBE, 0xC1, 0x63, 0x50, 0x27,
-	0x17, 0x56, 0x2F, 0xE3, 0x91, 0xB6, 0xF2, 0x18, 0xFB, 0x46, 0xD8, 0x4D,
-	0x2D, 0x83, 0x96, 0xE0, 0x00, 0x80, 0x33, 0xB8, 0x4B, 0xF7, 0x5C, 0xD4,
-	0x87, 0x34, 0x58, 0x4A, 0x27, 0x5C, 0x8E, 0x7A, 0x0A, 0x1C, 0xC2, 0x9B,
-	0xBB, 0xAD, 0x4B, 0xE3, 0x20, 0x50, 0x2E, 0x91, 0x3A, 0x5C, 0x24, 0x27,
-	0xAF, 0x53, 0x42, 0x07, 0xBE, 0x86, 0x72, 0x73, 0xAA, 0xEE, 0xA6, 0xF2,
-	0xEB, 0x41, 0xC3, 0x5B, 0xCA, 0x77, 0xB8, 0xB4, 0x67, 0xCA, 0x1B, 0x14,
-	0x00, 0x70, 0xC6, 0x25, 0x50, 0xF0, 0x1D, 0x42, 0x25, 0x7F, 0x0A, 0xBA,
-	0x17, 0xC1, 0x21, 0x77, 0x09, 0xE9, 0x6B, 0x64, 0x68, 0xEF, 0x73, 0xF8,
-	0xE5, 0x6B, 0x6D, 0xF9, 0x73, 0x10, 0x5A, 0x03, 0x00, 0xED, 0xF3, 0x72,
-	0x0A, 0x3E, 0xDD, 0xD2, 0xF2, 0x33, 0x10, 0x1E, 0xE2, 0x0A, 0x7C, 0x69,
-	0x63, 0xA4, 0x0B, 0x06, 0x00, 0x38, 0xE3, 0xAD, 0x68, 0xEF, 0xD3, 0x85,
-	0x72, 0xCB, 0xD9, 0x4F, 0x9B, 0x97, 0xF9, 0x25, 0x8F, 0xC3, 0x6C, 0x41,
-	0xD0, 0x27, 0x00, 0xD0, 0x36, 0x2F, 0xA8, 0x64, 0xA6, 0x33, 0x2D, 0x41,
-	0x2F, 0xA7, 0x0C, 0x02, 0x00, 0x38, 0x83, 0xE9, 0xFE, 0x76, 0xD4, 0xA6,
-	0xB4, 0xDF, 0xE6, 0xA4, 0x5F, 0xE1, 0x8F, 0xCF, 0xB3, 0x01, 0x41, 0x5F,
-	0x00, 0x40, 0xBB, 0xBC, 0x9E, 0x96, 0xD7, 0xD4, 0xDA, 0x14, 0x7E, 0xB2,
-	0x66, 0xBF, 0x50, 0xB7, 0x94, 0x87, 0x02, 0xC0, 0x49, 0x78, 0xD6, 0x2F,
-	0x36, 0x3F, 0xA4, 0x3B, 0xCE, 0x10, 0xBF, 0xCE, 0x33, 0xC1, 0x9D, 0x26,
-	0x1E, 0xAD, 0x03, 0xA0, 0xED, 0x2D, 0x40, 0xF9, 0x37, 0xE3, 0x31, 0x00,
-	0xDA, 0xFC, 0x20, 0x74, 0xFC, 0x90, 0x4E, 0x4F, 0xCD, 0xFB, 0xC8, 0xDB,
-	0x01, 0x80, 0x4B, 0x75, 0x32, 0x7C, 0xFC, 0x3D, 0x14, 0x00, 0xBE, 0x0D,
-	0x65, 0x5F, 0x68, 0xA6, 0x70, 0xAD, 0x7B, 0xE0, 0x68, 0x99, 0x99, 0x40,
-	0x0C, 0x02, 0x0F, 0x19, 0xE0, 0x9D, 0x68, 0xEF, 0x93, 0x52, 0xBD, 0xD1,
-	0x1E, 0x03, 0x4F, 0x00, 0xB8, 0x96, 0xCF, 0xA3, 0xDD, 0xD7, 0xB9, 0x0A,
-	0x91, 0xF0, 0x87, 0x02, 0xC0, 0xAD, 0x50, 0xA6, 0xED, 0x63, 0x4D, 0x12,
-	0x5D, 0x49, 0x63, 0x04, 0x82, 0x90, 0x00, 0x40, 0x5B, 0xEC, 0xEF, 0xD1,
-	0xEF, 0x1B, 0xCF, 0x35, 0xA8, 0x6C, 0xBF, 0x1E, 0x00, 0x38, 0x4C, 0xEA,
-	0x14, 0x17, 0xBA, 0x50, 0x00, 0xF8, 0x3D, 0x94, 0xE4, 0xFB, 0xBE, 0x8F,
-	0x22, 0x06, 0x01, 0x82, 0xC2, 0x8F, 0x45, 0xF0, 0xA3, 0x11, 0xB6, 0x45,
-	0x94, 0x01, 0xD0, 0x0E, 0xBF, 0x49, 0xC0, 0x6F, 0x13, 0xF8, 0x2A, 0x5F,
-	0x07, 0x00, 0x8E, 0xF6, 0x25, 0xAC, 0x4D, 0x4E, 0x28, 0x00, 0xFC, 0x00,
-	0x4A, 0x3C, 0xD7, 0xC9, 0xA0, 0xE9, 0x1E, 0x81, 0x1F, 0x73, 0x62, 0x77,
-	0xD0, 0xFA, 0x39, 0x17, 0x04, 0x06, 0xDF, 0x0B, 0xCA, 0xBE, 0x13, 0x68,
-	0x5B, 0xB4, 0x00, 0x40, 0x1B, 0xD9, 0x5D, 0x84, 0x5E, 0x9E, 0xFB, 0x89,
-	0x96, 0xC1, 0xAE, 0xA7, 0x0B, 0x05, 0x00, 0xD1, 0xC0, 0x48, 0x1B, 0x25,
-	0x43, 0x10, 0x20, 0x38, 0x5F, 0x86, 0xCC, 0x57, 0x68, 0xE5, 0x36, 0x13,
-	0xB4, 0x02, 0x00, 0xF2, 0x85, 0xF7, 0x10, 0x1A, 0x6B, 0xB0, 0x06, 0xE0,
-	0xBE, 0xC9, 0x98, 0xCB, 0x82, 0x21, 0x14, 0x00, 0x9E, 0x00, 0xDD, 0x38,
-	0x0E, 0x30, 0xFE, 0x78, 0x93, 0xE6, 0xC9, 0x6A, 0xCD, 0x04, 0x1E, 0x00,
-	0xD0, 0x38, 0x1A, 0x37, 0x9C, 0xD4, 0x32, 0x09, 0xCD, 0x0F, 0x11, 0xFC,
-	0xB5, 0x26, 0x0C, 0x2E, 0xB4, 0x41, 0x00, 0x40, 0x05, 0xE1, 0x30, 0xD7,
-	0xEB, 0x5A, 0x9A, 0xEC, 0x24, 0x08, 0x38, 0x59, 0xF4, 0x97, 0x2A, 0x81,
-	0x07, 0x00, 0x9C, 0x08, 0xB9, 0x9F, 0x51, 0xC8, 0x6D, 0xB9, 0x77, 0x40,
-	0x3B, 0xB9, 0xD5, 0x16, 0x2F, 0x2E, 0x10, 0xF1, 0xE9, 0xE7, 0xDC, 0x47,
-	0x90, 0x12, 0x12, 0x00, 0xF7, 0x87, 0x45, 0xDF, 0x43, 0x7D, 0x4E, 0x07,
-	0x96, 0xFD, 0x01, 0x32, 0x39, 0x26, 0xF8, 0x53, 0x59, 0xB6, 0x0B, 0x00,
-	0xF2, 0x30, 0x9E, 0x00, 0x99, 0x5C, 0x97, 0x18, 0x17, 0xC8, 0x5C, 0x3E,
-	0x6E, 0xE6, 0x14, 0x67, 0xA5, 0x07, 0xB8, 0xEE, 0x71, 0x34, 0xDA, 0xFB,
-	0x4E, 0x07, 0xFE, 0x69, 0x14, 0x19, 0x0C, 0x00, 0x79, 0x16, 0xE0, 0x4C,
-	0x20, 0xE7, 0x04, 0x9E, 0xDD, 0x81, 0x91, 0x35, 0x10, 0xB8, 0x00, 0x20,
-	0xD7, 0x6F, 0x0A, 0x00, 0xE3, 0xE0, 0x57, 0x94, 0xF7, 0x80, 0x85, 0x5E,
-	0x82, 0x4F, 0x33, 0x82, 0x02, 0x20, 0x07, 0x01, 0x3F, 0xE1, 0x4A, 0x10,
-	0x1C, 0xAC, 0x03, 0x81, 0xC5, 0xC8, 0x9A, 0x20, 0x60, 0x77, 0xB0, 0x35,
-	0x6F, 0xEB, 0xAB, 0xF8, 0xF9, 0xB2, 0xA6, 0x76, 0x04, 0x81, 0x1B, 0x03,
-	0x00, 0xC1, 0x77, 0xDD, 0x60, 0x3A, 0x56, 0xA3, 0xD2, 0x2E, 0x83, 0xFF,
-	0x12, 0xE8, 0xFC, 0x5D, 0x9D, 0x3F, 0xBA, 0xF8, 0x7B, 0x70, 0x00, 0xE4,
-	0x81, 0x79, 0x20, 0x7E, 0x7E, 0x0B, 0xD5, 0xED, 0xD5, 0x50, 0xED, 0x11,
-	0x06, 0x9F, 0xDD, 0xC1, 0x56, 0x04, 0x8D, 0x1F, 0x8C, 0x7E, 0xA9, 0x83,
-	0xE3, 0x4E, 0x00, 0xEF, 0x95, 0xA8, 0xDC, 0x5C, 0x5A, 0xDF, 0x5B, 0x28,
-	0x12, 0xDC, 0x0A, 0xE3, 0x7B, 0x20, 0x82, 0x69, 0xBF, 0x97, 0xE0, 0xF7,
-	0x92, 0x01, 0x0A, 0x9F, 0x21, 0x38, 0xDC, 0x1D, 0x43, 0x10, 0x1C, 0xDA,
-	0xEE, 0x47, 0x8B, 0x3C, 0x30, 0x18, 0x10, 0x04, 0x9C, 0x49, 0xE3, 0x6D,
-	0xE1, 0x13, 0x00, 0x98, 0x8B, 0x3A, 0x11, 0xFC, 0x87, 0xA0, 0xBE, 0x5E,
-	0x14, 0xEB, 0x0C, 0xDD, 0xA8, 0x7C, 0xAC, 0xF4, 0x6D, 0x31, 0xF8, 0x47,
-	0x21, 0xF8, 0x37, 0x88, 0x65, 0x77, 0x40, 0xD8, 0x4B, 0x06, 0xA8, 0x80,
-	0xE0, 0x1B, 0xF8, 0xFF, 0xF3, 0x7D, 0xD8, 0x56, 0x49, 0xAD, 0x7C, 0x2B,
-	0xE0, 0x2E, 0xA3, 0x67, 0x38, 0xC8, 0xE6, 0x44, 0xD3, 0xA3, 0x3A, 0x00,
-	0x68, 0x14, 0xC1, 0xEF, 0x35, 0x03, 0x4C, 0x83, 0x80, 0xA9, 0x7A, 0xF8,
-	0x02, 0x87, 0x40, 0x95, 0x58, 0xF5, 0x8F, 0x9E, 0xB6, 0x1D, 0xC1, 0xE0,
-	0x40, 0x2B, 0xA3, 0x99, 0x80, 0xAF, 0x7A, 0xDC, 0xE8, 0xF2, 0x63, 0x07,
-	0x19, 0xDE, 0x58, 0x7B, 0xCD, 0x00, 0x25, 0x10, 0x70, 0xBB, 0x14, 0xFB,
-	0xEB, 0x23, 0xBC, 0x59, 0x16, 0xA7, 0x20, 0x06, 0xFF, 0x48, 0x04, 0xFF,
-	0xC6, 0x58, 0xD4, 0x8B, 0x02, 0x00, 0x74, 0x06, 0xC6, 0x04, 0x04, 0x01,
-	0x47, 0xED, 0x2F, 0x8E, 0xC5, 0x39, 0x46, 0xA9, 0xBF, 0x92, 0x78, 0x14,
-	0x79, 0x68, 0x67, 0xFE, 0xE4, 0x47, 0x13, 0xFC, 0x28, 0xBA, 0x80, 0xB2,
-	0x93, 0x01, 0x02, 0x4E, 0x16, 0x5D, 0xA7, 0x06, 0x81, 0x69, 0x5E, 0xB6,
-	0xED, 0x0A, 0x6C, 0xF9, 0x5A, 0xE1, 0xC2, 0xE0, 0x1F, 0x8E, 0x27, 0xFF,
-	0xE6, 0xD8, 0xC0, 0x1D, 0x4D, 0x06, 0x28, 0x75, 0x07, 0x04, 0x01, 0x17,
-	0x71, 0x5C, 0x5E, 0xDF, 0x62, 0xF2, 0xF3, 0x3F, 0xF3, 0xE0, 0x73, 0x93,
-	0x6B, 0x74, 0x25, 0x3A, 0x00, 0xE4, 0xDD, 0x01, 0x41, 0xC0, 0xA5, 0x5C,
-	0xEE, 0xA3, 0x9F, 0xE5, 0x12, 0x75, 0xF0, 0xA3, 0xEB, 0x02, 0x14, 0xDD,
-	0x41, 0x07, 0x20, 0xE8, 0x24, 0xC5, 0xAB, 0x40, 0xCA, 0xFD, 0xFD, 0x9C,
-	0x95, 0xFC, 0x79, 0xCC, 0x08, 0x8E, 0x32, 0x03, 0x94, 0xBA, 0x03, 0x2E,
-	0x1F, 0x73, 0x57, 0x8F, 0xC1, 0x9A, 0xBE, 0xE9, 0x58, 0xA1, 0x93, 0xF0,
-	0xF0, 0x2C, 0x03, 0x83, 0xCF, 0x6D, 0xED, 0x51, 0x97, 0xA8, 0x01, 0x90,
-	0x77, 0x07, 0x16, 0x20, 0xE8, 0xD5, 0xE7, 0x9C, 0x7C, 0xE2, 0x80, 0x2F,
-	0xFA, 0xE0, 0x47, 0xDD, 0x05, 0x54, 0xBA, 0x03, 0x82, 0x80, 0xA7, 0x7C,
-	0xB4, 0xDB, 0xBB, 0x44, 0xCF, 0xBF, 0x88, 0xC8, 0x0A, 0x44, 0x0C, 0x3E,
-	0x9F, 0xFC, 0x60, 0xEB, 0xF9, 0x56, 0x5A, 0x96, 0x98, 0xA2, 0xCF, 0x00,
-	0xA5, 0xEE, 0x80, 0xC7, 0x0A, 0xAE, 0x41, 0x55, 0x1C, 0xF5, 0x0A, 0xD6,
-	0xAF, 0xB7, 0xF9, 0x9B, 0xD3, 0xC6, 0x0C, 0xBE, 0x97, 0x83, 0xAD, 0xAE,
-	0x81, 0x95, 0xF2, 0xCF, 0x0C, 0x00, 0xF2, 0xEE, 0x80, 0x20, 0xE0, 0xA5,
-	0x0F, 0xF2, 0xC5, 0x99, 0x92, 0x27, 0xF4, 0x0F, 0xBE, 0x35, 0x90, 0x18,
-	0x7C, 0xAE, 0x40, 0x72, 0x77, 0xD2, 0x4C, 0x95, 0x46, 0x00, 0x60, 0x52,
-	0x86, 0x69, 0x77, 0x1F, 0xD4, 0x55, 0x83, 0x27, 0x0F, 0xB6, 0x0D, 0x6F,
-	0x19, 0xF2, 0xC8, 0x52, 0xEF, 0x05, 0x7A, 0x11, 0x04, 0x5C, 0x9B, 0x3F,
-	0xBE, 0xA6, 0x8C, 0x75, 0xFC, 0x9C, 0xCC, 0xE2, 0xA2, 0xD3, 0x5A, 0x04,
-	0x9F, 0x7B, 0x11, 0xA2, 0x29, 0xA3, 0x2F, 0x61, 0x52, 0x6D, 0xDD, 0xE0,
-	0x91, 0x50, 0x68, 0x37, 0xEA, 0x76, 0xE8, 0xC7, 0x9F, 0xB5, 0x52, 0x03,
-	0x00, 0x1C, 0x7C, 0x28, 0xA8, 0x4E, 0x46, 0xE5, 0xBC, 0x3C, 0x97, 0x6C,
-	0x59, 0xF8, 0xF0, 0x70, 0x97, 0x2A, 0xD7, 0xC5, 0x79, 0x8E, 0x5D, 0x29,
-	0x2C, 0xA4, 0xF5, 0xD0, 0xD3, 0xF5, 0x16, 0x50, 0x1F, 0xEA, 0x46, 0x17,
-	0x7C, 0xF8, 0x85, 0xE7, 0x20, 0xDE, 0x8C, 0xCA, 0xBD, 0x16, 0xC5, 0x26,
-	0x5C, 0x3E, 0xBC, 0x3C, 0x7E, 0x7E, 0x19, 0x62, 0xB7, 0xB9, 0x6C, 0xF8,
-	0x18, 0x00, 0xF9, 0xFA, 0x3C, 0x9F, 0xAC, 0xC9, 0x41, 0x0A, 0x75, 0xCE,
-	0xE4, 0x00, 0xE7, 0x58, 0x08, 0xEA, 0xF5, 0x66, 0x0B, 0x1A, 0xD1, 0xB4,
-	0x45, 0x4B, 0x1B, 0x59, 0x7D, 0x5F, 0xA0, 0x15, 0x01, 0x82, 0xAD, 0xA8,
-	0xD9, 0xC6, 0x13, 0x09, 0x71, 0xD7, 0x34, 0xF0, 0x05, 0x97, 0xAD, 0xB9,
-	0x96, 0xA2, 0xDE, 0x6E, 0x37, 0xB1, 0x99, 0x7B, 0x0E, 0x5F, 0x03, 0xBD,
-	0xB3, 0x7B, 0x08, 0x32, 0x00, 0xE4, 0x73, 0xF0, 0xCA, 0x0D, 0x9B, 0x0D,
-	0xBE, 0x22, 0x33, 0x77, 0xAF, 0xF6, 0xDE, 0xE7, 0x41, 0x77, 0x1E, 0x39,
-	0xE7, 0xD1, 0xF3, 0x90, 0x25, 0xB6, 0xE0, 0x33, 0xD5, 0xFF, 0x04, 0xF5,
-	0xB1, 0x42, 0x27, 0xF0, 0xB0, 0x2D, 0xE3, 0xB7, 0xB3, 0x00, 0x40, 0xFD,
-	0xE2, 0x86, 0xAC, 0x3F, 0x9D, 0xEE, 0x54, 0x2B, 0x60, 0xA0, 0x90, 0xA7,
-	0x43, 0x48, 0xEF, 0x63, 0x03, 0xE5, 0x1E, 0xFD, 0xB2, 0xEA, 0xA2, 0xB1,
-	0x81, 0x88, 0x88, 0xFE, 0x55, 0xEE, 0x40, 0x16, 0x3A, 0xBE, 0x13, 0x32,
-	0xD8, 0xFF, 0x23, 0x08, 0x36, 0xDD, 0x6D, 0xFD, 0x15, 0xC4, 0x6E, 0xDD,
-	0x10, 0xCC, 0x07, 0x80, 0xF9, 0x16, 0xD4, 0xD6, 0x43, 0x1B, 0x0D, 0xEE,
-	0xA9, 0x6D, 0x9B, 0xEE, 0xC4, 0x42, 0x81, 0x50, 0xE3, 0x53, 0x3A, 0x76,
-	0xDD, 0xC0, 0x96, 0x7F, 0xE0, 0x55, 0xEF, 0x61, 0x95, 0xED, 0xE7, 0x02,
-	0xF5, 0x3A, 0x23, 0x81, 0xDD, 0x5C, 0x2F, 0xE1, 0x0A, 0xAA, 0xA0, 0xD4,
-	0xA2, 0xB8, 0x86, 0x00, 0x70, 0x39, 0xD2, 0x7C, 0x13, 0x50, 0xB4, 0x46,
-	0xD0, 0x72, 0x10, 0x92, 0xE2, 0x9C, 0xDE, 0xB8, 0x31, 0xA3, 0x20, 0x2F,
-	0x13, 0x57, 0x59, 0x4A, 0xFF, 0x17, 0x9D, 0x47, 0x0C, 0x62, 0x68, 0xA9,
-	0x11, 0xD8, 0xCC, 0xE0, 0x1F, 0x63, 0x64, 0xEA, 0x84, 0xFF, 0x4A, 0x02,
-	0xC0, 0xF5, 0xE0, 0xE6, 0x83, 0x00, 0x02, 0xEE, 0x74, 0x89, 0xA2, 0xC0,
-	0x1E, 0xDF, 0x27, 0x75, 0x69, 0x57, 0x94, 0xC1, 0xA7, 0x62, 0xB0, 0x17,
-	0x49, 0xC9, 0xEA, 0xE6, 0x15, 0xB2, 0x6F, 0x21, 0x00, 0xF4, 0x47, 0xB7,
-	0xDB, 0xE1, 0xB5, 0x7F, 0x0C, 0x6F, 0x04, 0x65, 0xF4, 0xC1, 0xA6, 0xFC,
-	0xAC, 0xBE, 0x19, 0x26, 0x1B, 0xCC, 0x14, 0x1F, 0x47, 0x37, 0x6B, 0xCD,
-	0x9D, 0x1A, 0x76, 0x72, 0x7B, 0xFD, 0xBF, 0x1D, 0x24, 0xDD, 0x43, 0x00,
-	0xFC, 0x15, 0x02, 0x34, 0x3B, 0x5F, 0x5B, 0x9B, 0x78, 0x6A, 0x8C, 0x0B,
-	0x1F, 0x8E, 0x5D, 0x5B, 0x61, 0x70, 0xB4, 0xC1, 0xCF, 0x9F, 0x7E, 0x4E,
-	0xD4, 0xFD, 0xDD, 0x01, 0x00, 0x18, 0xE7, 0xDB, 0x02, 0x60, 0x32, 0x9E,
-	0x78, 0x4A, 0xAC, 0x8B, 0x1F, 0xB0, 0x4D, 0x7D, 0x59, 0x93, 0x6C, 0xC0,
-	0x6F, 0x75, 0x2F, 0x91, 0x4B, 0x30, 0x4C, 0x79, 0x61, 0x9F, 0x02, 0x00,
-	0x66, 0xA3, 0x01, 0x0D, 0x00, 0x9A, 0x85, 0x95, 0xFE, 0x12, 0x2D, 0x00,
-	0xF2, 0xA7, 0xE4, 0x8C, 0xC1, 0xD2, 0xD2, 0xD9, 0x83, 0x15, 0x46, 0x57,
-	0x54, 0x59, 0xDF, 0x4C, 0x66, 0x1A, 0x44, 0x17, 0x7A, 0x35, 0x00, 0xCC,
-	0x24, 0x12, 0x00, 0x7F, 0x03, 0x0B, 0xEF, 0xAE, 0xB5, 0x2D, 0x51, 0x03,
-	0x20, 0x07, 0x01, 0x2F, 0x6C, 0x3C, 0x1F, 0x55, 0x82, 0x02, 0xE7, 0x0B,
-	0x2A, 0x6D, 0x1D, 0x69, 0xCA, 0x37, 0x06, 0x80, 0xD9, 0x43, 0x3F, 0xD5,
-	0x0C, 0x01, 0xC0, 0x3E, 0x84, 0xA9, 0xC4, 0xB6, 0x44, 0x0F, 0x80, 0x1C,
-	0x04, 0xDC, 0x6E, 0xCE, 0x59, 0xC3, 0xA6, 0xD9, 0x32, 0xAE, 0x6F, 0xF0,
-	0x2E, 0x80, 0xF5, 0x31, 0x4C, 0x6E, 0x49, 0x82, 0x81, 0xD8, 0x71, 0x06,
-	0xF0, 0x8E, 0x09, 0x6D, 0x13, 0x12, 0x9A, 0x11, 0x22, 0x03, 0x80, 0xB2,
-	0xCF, 0x1C, 0xFF, 0xF2, 0x49, 0xB3, 0xB2, 0x06, 0x9E, 0x4F, 0x79, 0x73,
-	0x7B, 0xD9, 0x51, 0xA8, 0xBC, 0xB4, 0x8A, 0x8B, 0x5D, 0xBC, 0x76, 0xEE,
-	0xFB, 0xA8, 0x9B, 0x62, 0x99, 0xD7, 0x97, 0x04, 0x3F, 0x07, 0x35, 0x07,
-	0xEF, 0x1C, 0xC4, 0x5B, 0x97, 0x29, 0x00, 0x58, 0x66, 0x92, 0x27, 0xC6,
-	0xB0, 0x26, 0x60, 0xED, 0x81, 0x19, 0x66, 0x04, 0xA0, 0xF7, 0x85, 0xFA,
-	0x7F, 0x76, 0x30, 0x61, 0xB7, 0x3E, 0x03, 0xE8, 0x47, 0xCC, 0x09, 0x00,
-	0x0E, 0x11, 0x70, 0x61, 0x0D, 0x03, 0x00, 0xBD, 0x86, 0x09, 0x00, 0x7A,
-	0x1F, 0x75, 0x42, 0xE1, 0x0B, 0x00, 0xFF, 0x82, 0x76, 0xBC, 0xB5, 0xC3,
-	0xB6, 0x24, 0x00, 0xD8, 0x7A, 0xCE, 0x91, 0xCF, 0x03, 0x00, 0xEE, 0x65,
-	0x17, 0x90, 0x00, 0xE0, 0x18, 0x88, 0xBE, 0xD8, 0x7B, 0x03, 0x40, 0x65,
-	0x58, 0x10, 0xDD, 0x5A, 0x40, 0x5F, 0x01, 0x09, 0xDD, 0x2E, 0x00, 0xC0,
-	0x57, 0xDA, 0x3F, 0x3A, 0xB4, 0xEB, 0x25, 0x03, 0x24, 0x00, 0x38, 0x44,
-	0xC0, 0x85, 0x15, 0x00, 0x58, 0x0D, 0xFE, 0xDB, 0x1D, 0x64, 0xEC, 0x62,
-	0x17, 0xC0, 0xD5, 0x24, 0xAE, 0x2A, 0xC9, 0x4A, 0xFD, 0xAD, 0x60, 0xBF,
-	0x59, 0x7B, 0x7F, 0x96, 0x19, 0x1A, 0x3F, 0xD5, 0x18, 0x00, 0x96, 0xEF,
-	0xEF, 0xB0, 0x30, 0x5B, 0x0D, 0xFC, 0x0F, 0xFE, 0x51, 0xEC, 0xFE, 0xB5,
-	0xB1, 0x3A, 0x01, 0xC0, 0xC6, 0x6B, 0x1E, 0x78, 0x1A, 0x33, 0x80, 0xFE,
-	0xD5, 0xBD, 0x68, 0x3D, 0x01, 0xC0, 0x43, 0x1C, 0x7A, 0x13, 0xE1, 0xA1,
-	0x0B, 0x48, 0x00, 0xE8, 0x2D, 0x7A, 0x1E, 0x1A, 0xF6, 0x00, 0x80, 0xBB,
-	0xD9, 0x05, 0xFC, 0x17, 0xBA, 0xE8, 0xBE, 0x69, 0x37, 0x56, 0x57, 0x91,
-	0x5D, 0x52, 0x17, 0xE0, 0x21, 0x98, 0x36, 0x22, 0x10, 0x3B, 0xDE, 0xC2,
-	0xFE, 0x3B, 0x29, 0xAF, 0x62, 0xA8, 0xB0, 0x93, 0x00, 0xF8, 0x1F, 0x04,
-	0xF0, 0x46, 0x0E, 0xDB, 0xF2, 0x38, 0x0C, 0x02, 0xA7, 0x2E, 0x69, 0xB6,
-	0x15, 0x94, 0xF8, 0xCC, 0x3C, 0x60, 0x0A, 0x00, 0x85, 0x74, 0x0B, 0x00,
-	0xD4, 0x61, 0xF4, 0x18, 0x00, 0xA0, 0x76, 0x55, 0xBB, 0x99, 0x29, 0x89,
-	0xDA, 0xC6, 0x03, 0x00, 0x00, 0xB7, 0xF4, 0xFF, 0xB6, 0xE0, 0xCD, 0x42,
-	0x23, 0x1F, 0x00, 0x92, 0xCD, 0x02, 0x00, 0x75, 0x4D, 0x13, 0x00, 0x6C,
-	0xA2, 0xE7, 0x81, 0xA7, 0x0A, 0x00, 0x0B, 0x91, 0x19, 0x00, 0xEE, 0x03,
-	0xA3, 0xF1, 0x97, 0x3C, 0x26, 0x8D, 0x3D, 0x1C, 0x00, 0xD8, 0x91, 0x32,
-	0x80, 0x85, 0xF7, 0x5D, 0x59, 0x46, 0xBB, 0x90, 0x01, 0xF6, 0x9E, 0x64,
-	0x80, 0x4C, 0x9E, 0xD9, 0x9C, 0xC0, 0x0E, 0x0F, 0x00, 0x18, 0xAC, 0x45,
-	0xB3, 0xE5, 0x6F, 0xF9, 0x51, 0x85, 0xB2, 0x2A, 0xB6, 0x27, 0x89, 0x0B,
-	0x39, 0x83, 0x01, 0x77, 0xBE, 0x3F, 0x74, 0x2C, 0xD3, 0xD5, 0x6F, 0x72,
-	0x7E, 0xCE, 0x8E, 0xF0, 0x56, 0x5F, 0x69, 0x99, 0xD0, 0xAB, 0xB6, 0x9E,
-	0x49, 0xB6, 0xA3, 0x55, 0x5B, 0x2A, 0x78, 0xAA, 0xBC, 0xF9, 0xFF, 0xF7,
-	0xC2, 0xA6, 0x96, 0xFB, 0x78, 0xF5, 0xBE, 0x6D, 0xB9, 0xAB, 0x19, 0x00,
-	0x66, 0x48, 0xB2, 0x55, 0xA0, 0x5F, 0x3E, 0x9D, 0x8D, 0xBA, 0xBF, 0xF7,
-	0xAB, 0xBD, 0x8F, 0xD6, 0x33, 0x00, 0x70, 0xD8, 0x30, 0xD7, 0x65, 0xFE,
-	0xE3, 0x98, 0x87, 0xCF, 0x6C, 0x00, 0x48, 0xA6, 0x36, 0x00, 0x04, 0x72,
-	0x9B, 0xB9, 0xD2, 0x73, 0x0D, 0xD6, 0xC0, 0xC6, 0x2D, 0x46, 0x06, 0xE8,
-	0xD6, 0xA9, 0x7D, 0x23, 0xD8, 0xE9, 0x41, 0xDD, 0x1E, 0x49, 0x17, 0x50,
-	0x35, 0xC2, 0xBF, 0x53, 0x8D, 0xDC, 0x24, 0x69, 0x5E, 0x42, 0xD3, 0x2D,
-	0xF2, 0xDA, 0xA5, 0xCB, 0xF4, 0xBB, 0x33, 0x12, 0x00, 0xB8, 0x7B, 0xAA,
-	0x6C, 0xAF, 0x51, 0xB0, 0xDD, 0x9B, 0xF6, 0x2A, 0xA1, 0xA6, 0x7B, 0x27,
-	0xC6, 0x8C, 0x85, 0x6E, 0x33, 0x07, 0x40, 0xFB, 0x19, 0x01, 0xAF, 0xCE,
-	0x48, 0xC2, 0x3A, 0xF7, 0x80, 0x05, 0x00, 0x3A, 0xD7, 0xA9, 0xA3, 0x06,
-	0x44, 0x29, 0x71, 0x09, 0xDF, 0x7A, 0x5A, 0xD1, 0xD1, 0xB7, 0xF4, 0x44,
-	0x0A, 0xE8, 0x8D, 0x17, 0x89, 0x11, 0x11, 0xB1, 0xAD, 0x0C, 0x00, 0x2E,
-	0x17, 0x0C, 0xE8, 0x15, 0x8E, 0x80, 0x42, 0xE5, 0x0E, 0xEF, 0x99, 0x55,
-	0xEC, 0x73, 0x33, 0x87, 0xD8, 0x8B, 0x6D, 0xE3, 0x1C, 0x5B, 0x7F, 0x33,
-	0x01, 0xC0, 0xDB, 0xA5, 0x0E, 0x32, 0x53, 0x6B, 0x4E, 0xA9, 0x0B, 0x9F,
-	0xF1, 0x27, 0x6B, 0xCB, 0xCA, 0x8A, 0x7D, 0x60, 0xEC, 0x7D, 0xD7, 0x41,
-	0x9B, 0x1B, 0x5D, 0xEF, 0x08, 0xB2, 0xB7, 0x46, 0xC4, 0xA9, 0x31, 0x59,
-	0xE8, 0x11, 0x21, 0x99, 0x5E, 0x23, 0x6F, 0x82, 0xF4, 0x4D, 0x19, 0x51,
-	0xD8, 0xEB, 0xF5, 0x2A, 0x02, 0x60, 0x35, 0x1A, 0xBB, 0x15, 0x32, 0x56,
-	0x85, 0xB9, 0x38, 0xB8, 0x25, 0xF9, 0x7A, 0xCF, 0xCB, 0x46, 0x6E, 0x8C,
-	0x84, 0xD8, 0x3E, 0x9A, 0x86, 0x06, 0x70, 0x01, 0x6F, 0xFF, 0xE2, 0x9E,
-	0x40, 0xF5, 0x4D, 0x1A, 0x86, 0x12, 0x13, 0xB9, 0xD0, 0x03, 0xC1, 0x81,
-	0xAE, 0x6C, 0x90, 0xB7, 0xBD, 0x6E, 0x2E, 0x5F, 0x15, 0xCB, 0xFB, 0xF8,
-	0x15, 0x57, 0xB1, 0x0B, 0x8D, 0x2A, 0xC8, 0x8A, 0xB6, 0x2C, 0x8C, 0x0C,
-	0x86, 0xFD, 0x42, 0x57, 0xC7, 0x06, 0x9B, 0x4C, 0x9C, 0xFC, 0xBE, 0xA1,
-	0x81, 0x9C, 0xC0, 0xC2, 0x45, 0xB9, 0xE6, 0x8E, 0x8A, 0x0F, 0x06, 0xA7,
-	0x23, 0xF8, 0xE7, 0x51, 0xD8, 0x54, 0xD6, 0x47, 0x77, 0x70, 0x1A, 0x7E,
-	0xB7, 0x01, 0xD5, 0x65, 0x9B, 0xB8, 0x21, 0x62, 0x62, 0x26, 0x5F, 0x0E,
-	0x11, 0xDD, 0x5D, 0x73, 0x56, 0x14, 0x6A, 0xEF, 0x81, 0x16, 0x2B, 0x4D,
-	0x34, 0xE1, 0x07, 0x2D, 0x4E, 0x46, 0xF0, 0x37, 0x15, 0x4C, 0xAA, 0xDB,
-	0xC2, 0x79, 0xE9, 0xC0, 0x71, 0xA8, 0x87, 0xA3, 0xAE, 0x46, 0xCD, 0x0F,
-	0x8E, 0xD6, 0x50, 0x57, 0x5D, 0xAB, 0x96, 0xAC, 0x77, 0x9B, 0x6E, 0x3C,
-	0xA1, 0x4C, 0x89, 0xDC, 0x66, 0x27, 0x90, 0x7B, 0xB2, 0xB3, 0xC0, 0xC4,
-	0x59, 0xBE, 0x68, 0x4D, 0xF7, 0x43, 0x50, 0x5B, 0x89, 0xC6, 0x05, 0x0D,
-	0xE5, 0xB7, 0x59, 0xC9, 0xEF, 0x17, 0xF1, 0x62, 0x6F, 0x7E, 0xA8, 0xFB,
-	0xDA, 0xEA, 0x9D, 0x8E, 0x61, 0xC6, 0x7D, 0xBE, 0x5C, 0x99, 0xE4, 0x78,
-	0xF7, 0xC0, 0xFF, 0x01, 0xB6, 0x8B, 0x29, 0x3B, 0x6C, 0xB5, 0x88, 0x83,
-	0x00, 0x00, 0x00, 0x00, 0x49, 0x45, 0x4E, 0x44, 0xAE, 0x42, 0x60, 0x82
-};
@@ -1,1715 +0,0 @@
-
-unsigned char g_InfinityIcon[20535] = {
-	0x89, 0x50, 0x4E, 0x47, 0x0D, 0x0A, 0x1A, 0x0A, 0x00, 0x00, 0x00, 0x0D,
-	0x49, 0x48, 0x44, 0x52, 0x00, 0x00, 0x01, 0x68, 0x00, 0x00, 0x01, 0x68,
-	0x08, 0x06, 0x00, 0x00, 0x00, 0x7A, 0xE5, 0x61, 0xD5, 0x00, 0x00, 0x20,
-	0x00, 0x49, 0x44, 0x41, 0x54, 0x78, 0x5E, 0xED, 0x5D, 0x07, 0x98, 0x15,
-	0x45, 0xD6, 0x1D, 0x14, 0x23, 0xE6, 0x0C, 0x88, 0x82, 0x11, 0x8C, 0x60,
-	0x42, 0x44, 0x4C, 0x98, 0x33, 0x8A, 0x8B, 0x88, 0x8A, 0x39, 0x60, 0xC4,
-	0x1C, 0x00, 0x13, 0x8A, 0x61, 0x15, 0x44, 0x50, 0x17, 0x17, 0x56, 0x11,
-	0x45, 0xD4, 0x35, 0xE7, 0x2C, 0xAB, 0x62, 0x42, 0x0C, 0x08, 0x66, 0xCC,
-	0x61, 0xD5, 0x55, 0x74, 0x55, 0x44, 0xC2, 0x7F, 0xCE, 0xDB, 0x39, 0x6C,
-	0xFD, 0x6F, 0x67, 0xA6, 0xBB, 0xE7, 0xBD, 0xE9, 0xE9, 0x99, 0x3E, 0xFD,
-	0x7D, 0xF3, 0xCD, 0xCC, 0x7B, 0xD5, 0x5D, 0xD5, 0xA7, 0x6E, 0x9D, 0xBA,
-	0x75, 0xEB, 0xDE, 0x5B, 0x4D, 0x2A, 0x7C, 0x19, 0x01, 0x23, 0x60, 0x04,
-	0x8C, 0x40, 0x26, 0x11, 0x68, 0x92, 0xC9, 0x56, 0xB9, 0x51, 0x46, 0xC0,
-	0x08, 0x18, 0x01, 0x23, 0x50, 0x61, 0x82, 0xB6, 0x10, 0x18, 0x01, 0x23,
-	0x60, 0x04, 0x32, 0x8A, 0x80, 0x09, 0x3A, 0xA3, 0x1D, 0xE3, 0x66, 0x19,
-	0x01, 0x23, 0x60, 0x04, 0x4C, 0xD0, 0x96, 0x01, 0x23, 0x60, 0x04, 0x8C,
-	0x40, 0x46, 0x11, 0x30, 0x41, 0x67, 0xB4, 0x63, 0xDC, 0x2C, 0x23, 0x60,
-	0x04, 0x8C, 0x80, 0x09, 0xDA, 0x32, 0x60, 0x04, 0x8C, 0x80, 0x11, 0xC8,
-	0x28, 0x02, 0x26, 0xE8, 0x8C, 0x76, 0x8C, 0x9B, 0x65, 0x04, 0x8C, 0x80,
-	0x11, 0x30, 0x41, 0x5B, 0x06, 0x8C, 0x80, 0x11, 0x30, 0x02, 0x19, 0x45,
-	0xC0, 0x04, 0x9D, 0xD1, 0x8E, 0x71, 0xB3, 0x8C, 0x80, 0x11, 0x30, 0x02,
-	0x26, 0x68, 0xCB, 0x80, 0x11, 0x30, 0x02, 0x46, 0x20, 0xA3, 0x08, 0x98,
-	0xA0, 0x33, 0xDA, 0x31, 0x6E, 0x96, 0x11, 0x30, 0x02, 0x46, 0xC0, 0x04,
-	0x6D, 0x19, 0x30, 0x02, 0x46, 0xC0, 0x08, 0x64, 0x14, 0x01, 0x13, 0x74,
-	0x46, 0x3B, 0xC6, 0xCD, 0x32, 0x02, 0x46, 0xC0, 0x08, 0x98, 0xA0, 0x2D,
-	0x03, 0x46, 0xC0, 0x08, 0x18, 0x81, 0x8C, 0x22, 0x60, 0x82, 0xCE, 0x68,
-	0xC7, 0xB8, 0x59, 0x46, 0xC0, 0x08, 0x18, 0x01, 0x13, 0xB4, 0x65, 0xC0,
-	0x08, 0x18, 0x01, 0x23, 0x90, 0x51, 0x04, 0x4C, 0xD0, 0x19, 0xED, 0x18,
-	0x37, 0xCB, 0x08, 0x18, 0x01, 0x23, 0x60, 0x82, 0xB6, 0x0C, 0x18, 0x01,
-	0x23, 0x60, 0x04, 0x32, 0x8A, 0x80, 0x09, 0x3A, 0xA3, 0x1D, 0xE3, 0x66,
-	0x19, 0x01, 0x23, 0x60, 0x04, 0x4C, 0xD0, 0x96, 0x01, 0x23, 0x60, 0x04,
-	0x8C, 0x40, 0x46, 0x11, 0x30, 0x41, 0x67, 0xB4, 0x63, 0xDC, 0x2C, 0x23,
-	0x60, 0x04, 0x8C, 0x80, 0x09, 0xDA, 0x32, 0x60, 0x04, 0x8C, 0x80, 0x11,
-	0xC8, 0x28, 0x02, 0x26, 0xE8, 0x8C, 0x76, 0x8C, 0x9B, 0x65, 0x04, 0x8C,
-	0x80, 0x11, 0x30, 0x41, 0x5B, 0x06, 0x8C, 0x80, 0x11, 0x30, 0x02, 0x19,
-	0x45, 0xC0, 0x04, 0x9D, 0xD1, 0x8E, 0x71, 0xB3, 0x8C, 0x80, 0x11, 0x30,
-	0x02, 0x26, 0x68, 0xCB, 0x80, 0x11, 0x30, 0x02, 0x46, 0x20, 0xA3, 0x08,
-	0x98, 0xA0, 0x33, 0xDA, 0x31, 0x6E, 0x96, 0x11, 0x30, 0x02, 0x46, 0xC0,
-	0x04, 0x6D, 0x19, 0x30, 0x02, 0x46, 0xC0, 0x08, 0x64, 0x14, 0x01, 0x13,
-	0x74, 0x46, 0x3B, 0xC6, 0xCD, 0x32, 0x02, 0x46, 0xC0, 0x08, 0x98, 0xA0,
-	0x2D, 0x03, 0x46, 0xC0, 0x08, 0x18, 0x81, 0x8C, 0x22, 0x60, 0x82, 0xCE,
-	0x68, 0xC7, 0xB8, 0x59, 0x46, 0xC0, 0x08, 0x18, 0x01, 0x13, 0xB4, 0x65,
-	0xC0, 0x08, 0x18, 0x01, 0x23, 0x90, 0x51, 0x04, 0x4C, 0xD0, 0x19, 0xED,
-	0x18, 0x37, 0xCB, 0x08, 0x18, 0x01, 0x23, 0x60, 0x82, 0xB6, 0x0C, 0x18,
-	0x01, 0x23, 0x60, 0x04, 0x32, 0x8A, 0x80, 0x09, 0x3A, 0xA3, 0x1D, 0xE3,
-	0x66, 0x19, 0x01, 0x23, 0x60, 0x04, 0x4C, 0xD0, 0x96, 0x01, 0x23, 0x60,
-	0x04, 0x8C, 0x40, 0x46, 0x11, 0x30, 0x41, 0x67, 0xB4, 0x63, 0xDC, 0x2C,
-	0x23, 0x60, 0x04, 0x8C, 0x80, 0x09, 0xDA, 0x32, 0x60, 0x04, 0x8C, 0x80,
-	0x11, 0xC8, 0x28, 0x02, 0x26, 0xE8, 0x8C, 0x76, 0x8C, 0x9B, 0x65, 0x04,
-	0x8C, 0x80, 0x11, 0x30, 0x41, 0x5B, 0x06, 0x8C, 0x80, 0x11, 0x30, 0x02,
-	0x19, 0x45, 0xC0, 0x04, 0x9D, 0xD1, 0x8E, 0x71, 0xB3, 0x8C, 0x80, 0x11,
-	0x30, 0x02, 0x26, 0x68, 0xCB, 0x80, 0x11, 0x30, 0x02, 0x46, 0x20, 0xA3,
-	0x08, 0x98, 0xA0, 0x33, 0xDA, 0x31, 0x6E, 0x96, 0x11, 0x30, 0x02, 0x46,
-	0xC0, 0x04, 0x6D, 0x19, 0x30, 0x02, 0x46, 0xC0, 0x08, 0x64, 0x14, 0x01,
-	0x13, 0x74, 0x46, 0x3B, 0xC6, 0xCD, 0x32, 0x02, 0x46, 0xC0, 0x08, 0x98,
-	0xA0, 0x2D, 0x03, 0x46, 0xC0, 0x08, 0x18, 0x81, 0x8C, 0x22, 0x60, 0x82,
-	0xCE, 0x68, 0xC7, 0xB8, 0x59, 0x46, 0xC0, 0x08, 0x18, 0x01, 0x13, 0xB4,
-	0x65, 0xC0, 0x08, 0x18, 0x01, 0x23, 0x90, 0x51, 0x04, 0x4C, 0xD0, 0x19,
-	0xED, 0x18, 0x37, 0xCB, 0x08, 0x18, 0x01, 0x23, 0x60, 0x82, 0xB6, 0x0C,
-	0x18, 0x01, 0x23, 0x60, 0x04, 0x32, 0x8A, 0x80, 0x09, 0x3A, 0xA3, 0x1D,
-	0xE3, 0x66, 0x19, 0x01, 0x23, 0x60, 0x04, 0x4C, 0xD0, 0x96, 0x01, 0x23,
-	0x60, 0x04, 0x8C, 0x40, 0x46, 0x11, 0x30, 0x41, 0x67, 0xB4, 0x63, 0xDC,
-	0x2C, 0x23, 0x60, 0x04, 0x8C, 0x80, 0x09, 0xDA, 0x32, 0x60, 0x04, 0x8C,
-	0x80, 0x11, 0xC8, 0x28, 0x02, 0x26, 0xE8, 0x8C, 0x76, 0x8C, 0x9B, 0x65,
-	0x04, 0x8C, 0x80, 0x11, 0x30, 0x41, 0x5B, 0x06, 0x8C, 0x80, 0x11, 0x30,
-	0x02, 0x19, 0x45, 0xC0, 0x04, 0x9D, 0xD1, 0x8E, 0x71, 0xB3, 0x8C, 0x80,
-	0x11, 0x30, 0x02, 0x26, 0x68, 0xCB, 0x80, 0x11, 0x30, 0x02, 0x46, 0x20,
-	0xA3, 0x08, 0x98, 0xA0, 0x33, 0xDA, 0x31, 0x6E, 0x96, 0x11, 0x30, 0x02,
-	0x46, 0xC0, 0x04, 0x6D, 0x19, 0x30, 0x02, 0x46, 0xC0, 0x08, 0x64, 0x14,
-	0x01, 0x13, 0x74, 0x46, 0x3B, 0xC6, 0xCD, 0x32, 0x02, 0x46, 0xC0, 0x08,
-	0x98, 0xA0, 0x2D, 0x03, 0x46, 0xC0, 0x08, 0x18, 0x81, 0x8C, 0x22, 0x60,
-	0x82, 0xCE, 0x68, 0xC7, 0xB8, 0x59, 0x46, 0xC0, 0x08, 0x18, 0x01, 0x13,
-	0xB4, 0x65, 0xC0, 0x08, 0x18, 0x01, 0x23, 0x90, 0x51, 0x04, 0x4C, 0xD0,
-	0x19, 0xED, 0x18, 0x37, 0xCB, 0x08, 0x18, 0x01, 0x23, 0x60, 0x82, 0xB6,
-	0x0C, 0x18, 0x01, 0x23, 0x60, 0x04, 0x32, 0x8A, 0x80, 0x09, 0x3A, 0xA3,
-	0x1D, 0xE3, 0x66, 0x19, 0x01, 0x23, 0x60, 0x04, 0x4C, 0xD0, 0x96, 0x01,
-	0x23, 0x60, 0x04, 0x8C, 0x40, 0x46, 0x11, 0x30, 0x41, 0x67, 0xB4, 0x63,
-	0xDC, 0x2C, 0x23, 0x60, 0x04, 0x8C, 0x80, 0x09, 0xDA, 0x32, 0x60, 0x04,
-	0x8C, 0x80, 0x11, 0xC8, 0x28, 0x02, 0x26, 0xE8, 0x8C, 0x76, 0x8C, 0x9B,
-	0x65, 0x04, 0x8C, 0x80, 0x11, 0x30, 0x41, 0x5B, 0x06, 0x8C, 0x80, 0x11,
-	0x30, 0x02, 0x19, 0x45, 0xC0, 0x04, 0x9D, 0xD1, 0x8E, 0x71, 0xB3, 0x8C,
-	0x80, 0x11, 0x30, 0x02, 0x26, 0x68, 0xCB, 0x80, 0x11, 0x30, 0x02, 0x46,
-	0x20, 0xA3, 0x08, 0x98, 0xA0, 0x33, 0xDA, 0x31, 0x6E, 0x96, 0x11, 0x30,
-	0x02, 0x46, 0xC0, 0x04, 0x6D, 0x19, 0x30, 0x02, 0x46, 0xC0, 0x08, 0x64,
-	0x14, 0x01, 0x13, 0x74, 0x46, 0x3B, 0xC6, 0xCD, 0x32, 0x02, 0x46, 0xC0,
-	0x08, 0x98, 0xA0, 0x2D, 0x03, 0x46, 0xC0, 0x08, 0x18, 0x81, 0x8C, 0x22,
-	0x60, 0x82, 0xCE, 0x68, 0xC7, 0xB8, 0x59, 0x46, 0xC0, 0x08, 0x18, 0x01,
-	0x13, 0xB4, 0x65, 0xC0, 0x08, 0x18, 0x01, 0x23, 0x90, 0x51, 0x04, 0x4C,
-	0xD0, 0x19, 0xED, 0x18, 0x37, 0xCB, 0x08, 0x18, 0x01, 0x23, 0x60, 0x82,
-	0xB6, 0x0C, 0x18, 0x01, 0x23, 0x60, 0x04, 0x32, 0x8A, 0x80, 0x09, 0x3A,
-	0xA3, 0x1D, 0xE3, 0x66, 0x19, 0x01, 0x23, 0x60, 0x04, 0x4C, 0xD0, 0x96,
-	0x01, 0x23, 0x60, 0x04, 0x8C, 0x40, 0x46, 0x11, 0x30, 0x41, 0x67, 0xB4,
-	0x63, 0xDC, 0x2C, 0x23, 0x60, 0x04, 0x8C, 0x80, 0x09, 0xDA, 0x32, 0x60,
-	0x04, 0x8C, 0x80, 0x11, 0xC8, 0x28, 0x02, 0x26, 0xE8, 0x8C, 0x76, 0x8C,
-	0x9B, 0x65, 0x04, 0x8C, 0x80, 0x11, 0x30, 0x41, 0x5B, 0x06, 0x8C, 0x80,
-	0x11, 0x30, 0x02, 0x19, 0x45, 0xC0, 0x04, 0x9D, 0xD1, 0x8E, 0x71, 0xB3,
-	0x8C, 0x80, 0x11, 0x30, 0x02, 0x26, 0x68, 0xCB, 0x80, 0x11, 0x30, 0x02,
-	0x46, 0x20, 0xA3, 0x08, 0x98, 0xA0, 0x33, 0xDA, 0x31, 0x6E, 0x96, 0x11,
-	0x30, 0x02, 0x46, 0xC0, 0x04, 0x6D, 0x19, 0x30, 0x02, 0x46, 0xC0, 0x08,
-	0x64, 0x14, 0x01, 0x13, 0x74, 0x46, 0x3B, 0xC6, 0xCD, 0x32, 0x02, 0x46,
-	0xC0, 0x08, 0x98, 0xA0, 0x2D, 0x03, 0x46, 0xC0, 0x08, 0x18, 0x81, 0x8C,
-	0x22, 0x60, 0x82, 0xCE, 0x68, 0xC7, 0xB8, 0x59, 0x46, 0xC0, 0x08, 0x18,
-	0x01, 0x13, 0xB4, 0x65, 0xC0, 0x08, 0x18, 0x01, 0x23, 0x90, 0x51, 0x04,
-	0x4C, 0xD0, 0x19, 0xED, 0x18, 0x37, 0xCB, 0x08, 0x18, 0x01, 0x23, 0x60,
-	0x82, 0xB6, 0x0C, 0x18, 0x01, 0x23, 0x60, 0x04, 0x32, 0x8A, 0x80, 0x09,
-	0x3A, 0xA3, 0x1D, 0xE3, 0x66, 0x19, 0x01, 0x23, 0x60, 0x04, 0x4C, 0xD0,
-	0x96, 0x01, 0x23, 0x60, 0x04, 0x8C, 0x40, 0x46, 0x11, 0x30, 0x41, 0x67,
-	0xB4, 0x63, 0xDC, 0x2C, 0x23, 0x60, 0x04, 0x8C, 0x80, 0x09, 0xDA, 0x32,
-	0x60, 0x04, 0x8C, 0x80, 0x11, 0xC8, 0x28, 0x02, 0x26, 0xE8, 0x8C, 0x76,
-	0x8C, 0x9B, 0x65, 0x04, 0x8C, 0x80, 0x11, 0x30, 0x41, 0x5B, 0x06, 0x8C,
-	0x80, 0x11, 0x30, 0x02, 0x19, 0x45, 0xC0, 0x04, 0x9D, 0xD1, 0x8E, 0x71,
-	0xB3, 0x8C, 0x80, 0x11, 0x30, 0x02, 0x26, 0x68, 0xCB, 0x80, 0x11, 0x30,
-	0x02, 0x46, 0x20, 0xA3, 0x08, 0x98, 0xA0, 0x33, 0xDA, 0x31, 0x6E, 0x96,
-	0x11, 0x30, 0x02, 0x46, 0xC0, 0x04, 0x6D, 0x19, 0x30, 0x02, 0x46, 0xC0,
-	0x08, 0x64, 0x14, 0x01, 0x13, 0x74, 0x46, 0x3B, 0xC6, 0xCD, 0x32, 0x02,
-	0x46, 0xC0, 0x08, 0x98, 0xA0, 0x2D, 0x03, 0x46, 0xC0, 0x08, 0x18, 0x81,
-	0x8C, 0x22, 0x60, 0x82, 0xCE, 0x68, 0xC7, 0xB8, 0x59, 0x46, 0xC0, 0x08,
-	0x18, 0x01, 0x13, 0xB4, 0x65, 0xC0, 0x08, 0x18, 0x01, 0x23, 0x90, 0x51,
-	0x04, 0x4C, 0xD0, 0x19, 0xED, 0x18, 0x37, 0xCB, 0x08, 0x18, 0x01, 0x23,
-	0x60, 0x82, 0xB6, 0x0C, 0x18, 0x01, 0x23, 0x60, 0x04, 0x32, 0x8A, 0x80,
-	0x09, 0x3A, 0xA3, 0x1D, 0xE3, 0x66, 0x19, 0x01, 0x23, 0x60, 0x04, 0x4C,
-	0xD0, 0x96, 0x01, 0x23, 0x60, 0x04, 0x8C, 0x40, 0x46, 0x11, 0x30, 0x41,
-	0x67, 0xB4, 0x63, 0xDC, 0x2C, 0x23, 0x60, 0x04, 0x8C, 0x80, 0x09, 0xDA,
-	0x32, 0x60, 0x04, 0x8C, 0x80, 0x11, 0xC8, 0x28, 0x02, 0x26, 0xE8, 0x8C,
-	0x76, 0x8C, 0x9B, 0x65, 0x04, 0x8C, 0x80, 0x11, 0x30, 0x41, 0x5B, 0x06,
-	0x8C, 0x80, 0x11, 0x30, 0x02, 0x19, 0x45, 0xC0, 0x04, 0x9D, 0xD1, 0x8E,
-	0x71, 0xB3, 0x8C, 0x80, 0x11, 0x30, 0x02, 0x26, 0x68, 0xCB, 0x80, 0x11,
-	0x30, 0x02, 0x46, 0x20, 0xA3, 0x08, 0x98, 0xA0, 0x33, 0xDA, 0x31, 0x6E,
-	0x96, 0x11, 0x30, 0x02, 0x46, 0xC0, 0x04, 0x6D, 0x19, 0x30, 0x02, 0x46,
-	0xC0, 0x08, 0x64, 0x14, 0x01, 0x13, 0x74, 0x46, 0x3B, 0xC6, 0xCD, 0x32,
-	0x02, 0x46, 0xC0, 0x08, 0x98, 0xA0, 0x33, 0x2A, 0x03, 0x73, 0xE7, 0xCE,
-	0x2D, 0xF4, 0xCD, 0x9A, 0x6B, 0xAE, 0xD9, 0x72, 0x79, 0x5C, 0xAD, 0x5A,
-	0xB5, 0x5A, 0xB9, 0x45, 0x8B, 0x16, 0xAD, 0xF1, 0xBB, 0xE5, 0x0A, 0x2B,
-	0xAC, 0xD0, 0x7C, 0x99, 0x65, 0x96, 0x59, 0x76, 0x89, 0x25, 0x96, 0x68,
-	0xF6, 0xC7, 0x1F, 0x7F, 0xCC, 0x59, 0x78, 0xE1, 0x85, 0xE7, 0x6F, 0xDA,
-	0xB4, 0xE9, 0x82, 0x4D, 0x9A, 0x34, 0x99, 0xF3, 0xE3, 0x8F, 0x3F, 0x4E,
-	0xFF, 0xE8, 0xA3, 0x8F, 0xA6, 0xE1, 0xE7, 0xDD, 0xCF, 0x71, 0x4D, 0x9C,
-	0x38, 0x71, 0xFC, 0x4A, 0x2B, 0xAD, 0xF4, 0xCB, 0x33, 0xCF, 0x3C, 0x33,
-	0x23, 0xA3, 0xAF, 0xEA, 0x66, 0x25, 0x44, 0x00, 0xB2, 0x31, 0x5F, 0xDB,
-	0xB6, 0x6D, 0x9B, 0xB1, 0xFF, 0x37, 0xD8, 0x60, 0x83, 0x6D, 0x20, 0x0B,
-	0x2B, 0xB6, 0x6E, 0xDD, 0x7A, 0xB5, 0x55, 0x56, 0x59, 0xA5, 0xCD, 0x72,
-	0xCB, 0x2D, 0xB7, 0xCC, 0x02, 0x0B, 0x2C, 0xD0, 0x74, 0xE6, 0x7F, 0xAE,
-	0xDF, 0x21, 0x13, 0xF3, 0xFD, 0x82, 0xEB, 0x5F, 0xFF, 0xFA, 0xD7, 0xF7,
-	0xDF, 0xE0, 0xFA, 0xEC, 0xB3, 0xCF, 0xBE, 0xC0, 0xF5, 0x09, 0x44, 0xE3,
-	0xB3, 0x59, 0xB3, 0x66, 0x7D, 0xF7, 0xCA, 0x2B, 0xAF, 0x7C, 0xC6, 0xE7,
-	0x51, 0x76, 0x12, 0x36, 0xC3, 0xC5, 0x53, 0x40, 0xC0, 0x04, 0x9D, 0x02,
-	0xC8, 0x49, 0xAA, 0xE8, 0xD2, 0xA5, 0xCB, 0x3A, 0xEB, 0xAF, 0xBF, 0x7E,
-	0xE7, 0x8D, 0x37, 0xDE, 0x78, 0x8B, 0x36, 0xB8, 0x30, 0x00, 0x37, 0x00,
-	0x01, 0x2F, 0xBA, 0x10, 0x2E, 0x90, 0x70, 0xE1, 0x51, 0x73, 0xE6, 0xCC,
-	0xA9, 0xC0, 0xA0, 0xAA, 0xC0, 0xA0, 0xAA, 0x98, 0x6F, 0xBE, 0xF9, 0x0A,
-	0xFF, 0xCF, 0x9E, 0x3D, 0xBB, 0xF0, 0xFF, 0xFC, 0xF3, 0xCF, 0x5F, 0xF8,
-	0xCD, 0xEF, 0xF9, 0x39, 0xFF, 0x9F, 0x36, 0x6D, 0xDA, 0xE7, 0xCF, 0x3F,
-	0xFF, 0xFC, 0x53, 0x4F, 0x3E, 0xF9, 0xE4, 0xA3, 0x6F, 0xBD, 0xF5, 0xD6,
-	0x73, 0x20, 0xED, 0x4F, 0x93, 0xB4, 0xC9, 0x65, 0xEB, 0x1F, 0x81, 0x35,
-	0xD6, 0x58, 0x63, 0xA1, 0xA5, 0x97, 0x5E, 0x7A, 0x8D, 0x8D, 0x36, 0xDA,
-	0x68, 0x33, 0x5C, 0x5B, 0x75, 0xC6, 0xB5, 0xF6, 0xDA, 0x6B, 0xAF, 0x81,
-	0x96, 0x35, 0x61, 0x5F, 0xF3, 0x47, 0x17, 0xFB, 0x9F, 0x3F, 0x92, 0x15,
-	0xFE, 0x2E, 0xFE, 0x6C, 0xC6, 0x8C, 0x19, 0xBF, 0xE3, 0xE7, 0xD7, 0x49,
-	0x93, 0x26, 0xBD, 0xF1, 0xE9, 0xA7, 0x9F, 0x4E, 0x7B, 0xF5, 0xD5, 0x57,
-	0x27, 0x80, 0xAC, 0x5F, 0xC0, 0xCF, 0xDB, 0xF5, 0xFF, 0xB6, 0x6E, 0xC1,
-	0xBC, 0xBE, 0x34, 0x14, 0xF5, 0x8B, 0x00, 0x34, 0xA1, 0x65, 0xC1, 0xC1,
-	0x5B, 0x74, 0xED, 0xDA, 0x75, 0xCF, 0xAD, 0x70, 0x81, 0x93, 0x5B, 0x83,
-	0x8B, 0x17, 0x54, 0xAB, 0xC2, 0x81, 0x57, 0x55, 0x4B, 0x35, 0x10, 0x6B,
-	0x7A, 0x0B, 0x12, 0x35, 0x89, 0x9C, 0x17, 0xB4, 0xA6, 0xD9, 0x18, 0x8C,
-	0x2F, 0xDE, 0x73, 0xCF, 0x3D, 0xE3, 0x40, 0xD8, 0x8F, 0xE1, 0xEF, 0x77,
-	0xEB, 0x17, 0x01, 0xD7, 0x5E, 0x1D, 0x02, 0xE7, 0x9F, 0x7F, 0x7E, 0xD3,
-	0xFB, 0xEF, 0xBF, 0xBF, 0x05, 0x64, 0x63, 0xEF, 0xFD, 0xF6, 0xDB, 0xEF,
-	0xC0, 0x0D, 0x37, 0xDC, 0x70, 0x3D, 0x68, 0xC7, 0x8B, 0x70, 0x32, 0xD6,
-	0xA5, 0x7E, 0x15, 0x09, 0xC7, 0x41, 0x33, 0x94, 0x29, 0x4D, 0xE2, 0xBC,
-	0x0F, 0xCF, 0x9D, 0xF9, 0xC1, 0x07, 0x1F, 0x7C, 0xFC, 0xEC, 0xB3, 0xCF,
-	0x3E, 0xF3, 0xC8, 0x23, 0x8F, 0xDC, 0x0D, 0xE2, 0x1E, 0x8F, 0xC9, 0xFC,
-	0xD7, 0x38, 0xCF, 0x74, 0x99, 0xBA, 0x41, 0xC0, 0x1A, 0x74, 0xDD, 0xE0,
-	0x5A, 0xE3, 0x53, 0x39, 0xF0, 0x5E, 0x7F, 0xFD, 0xF5, 0x1D, 0x76, 0xDE,
-	0x79, 0xE7, 0xDD, 0x76, 0xDD, 0x75, 0xD7, 0x7D, 0x17, 0x5D, 0x74, 0xD1,
-	0xA5, 0x17, 0x5B, 0x6C, 0xB1, 0x85, 0x16, 0x5C, 0x70, 0xC1, 0x82, 0x26,
-	0xA4, 0x01, 0xC8, 0xC1, 0x17, 0x0E, 0xC0, 0xDA, 0x12, 0x34, 0x9F, 0x89,
-	0xE5, 0x6E, 0xE1, 0xD9, 0x7C, 0x1E, 0x49, 0x1D, 0xA6, 0x11, 0x7E, 0xF6,
-	0x0B, 0x34, 0xEB, 0xC7, 0xFE, 0xFA, 0xD7, 0xBF, 0xDE, 0x00, 0xC2, 0x7E,
-	0xB8, 0x1E, 0xA0, 0x70, 0x95, 0xD5, 0x20, 0x00, 0xB9, 0xD8, 0xEA, 0xA8,
-	0xA3, 0x8E, 0x3A, 0x0D, 0x73, 0xF6, 0xD6, 0x8B, 0x2F, 0xBE, 0xF8, 0x12,
-	0x5C, 0x3D, 0x55, 0xF6, 0x59, 0x05, 0x48, 0xBA, 0x82, 0xB2, 0xC2, 0xAB,
-	0x58, 0x73, 0x8E, 0x03, 0x68, 0x78, 0x8F, 0xB4, 0x6F, 0xAD, 0xC6, 0xF4,
-	0xCC, 0x9F, 0x7E, 0xFA, 0xE9, 0x37, 0x58, 0x46, 0x7E, 0x78, 0xFC, 0xF1,
-	0xC7, 0x1F, 0xBE, 0xE5, 0x96, 0x5B, 0xFE, 0xB6, 0xD4, 0x52, 0x4B, 0xBD,
-	0x78, 0xC7, 0x1D, 0x77, 0xFC, 0x77, 0x66, 0x88, 0x53, 0x91, 0xCB, 0x94,
-	0x8C, 0x80, 0x09, 0xBA, 0x64, 0x08, 0xE3, 0x3F, 0x00, 0x66, 0x8B, 0x45,
-	0xDB, 0xB7, 0x6F, 0xBF, 0xDF, 0xE1, 0x87, 0x1F, 0x7E, 0x1C, 0xFE, 0xDE,
-	0x94, 0xE6, 0x07, 0xFE, 0xF0, 0xE2, 0xE0, 0xA3, 0x36, 0x23, 0x33, 0x85,
-	0x3E, 0x2F, 0x55, 0x83, 0xFE, 0xED, 0xB7, 0xDF, 0x2A, 0xA0, 0x91, 0xCF,
-	0x23, 0x7A, 0x3D, 0x4F, 0x9A, 0x37, 0x96, 0xB9, 0x15, 0x30, 0xA1, 0x54,
-	0x7C, 0xF2, 0xC9, 0x27, 0xEF, 0x0C, 0x1F, 0x3E, 0xFC, 0xFA, 0x2B, 0xAE,
-	0xB8, 0xE2, 0xEA, 0xF8, 0x6F, 0xE4, 0x92, 0xE5, 0x44, 0x80, 0x66, 0x8C,
-	0x1E, 0x3D, 0x7A, 0x1C, 0x77, 0xE2, 0x89, 0x27, 0x9E, 0x81, 0x6D, 0x87,
-	0x15, 0xD9, 0x77, 0x98, 0xBC, 0xE7, 0x55, 0xC1, 0x89, 0x5B, 0x13, 0x2C,
-	0xFB, 0x91, 0xDF, 0x2F, 0xB2, 0xC8, 0x22, 0xF3, 0xBE, 0x8F, 0xB3, 0x9A,
-	0x2A, 0x26, 0x75, 0x29, 0x04, 0x92, 0x3F, 0x3E, 0x9F, 0x13, 0x00, 0x27,
-	0x04, 0x3E, 0x0F, 0x2B, 0x2E, 0xFE, 0x9E, 0x83, 0x89, 0xFC, 0xD9, 0x91,
-	0x23, 0x47, 0x5E, 0x8B, 0x3A, 0xEF, 0x03, 0x51, 0xCF, 0x2C, 0xE7, 0x7B,
-	0xFB, 0x59, 0xD5, 0x23, 0x60, 0x82, 0x4E, 0x41, 0x3A, 0x36, 0xDD, 0x74,
-	0xD3, 0x56, 0x3B, 0xEE, 0xB8, 0xE3, 0x41, 0xBD, 0x7A, 0xF5, 0x3A, 0xA2,
-	0x5D, 0xBB, 0x76, 0x6D, 0x44, 0xC8, 0xFC, 0xFD, 0xEB, 0xAF, 0xBF, 0x16,
-	0x06, 0x02, 0x07, 0x04, 0x07, 0x06, 0x7F, 0x34, 0x88, 0x38, 0x20, 0x65,
-	0x77, 0xAE, 0x6D, 0x33, 0x65, 0xAB, 0x96, 0x4D, 0x5A, 0xF6, 0x6B, 0x0E,
-	0x48, 0x0E, 0x3E, 0xFE, 0x2C, 0xBB, 0xEC, 0xB2, 0x05, 0x0D, 0x9B, 0x5A,
-	0xD9, 0xEF, 0xBF, 0xFF, 0xFE, 0xDB, 0x90, 0x21, 0x43, 0xAE, 0xC4, 0x20,
-	0xBC, 0x10, 0xCB, 0xDB, 0x3F, 0x6A, 0x5B, 0xAF, 0xEF, 0x8B, 0x8F, 0x00,
-	0x26, 0xEB, 0xE6, 0x30, 0x63, 0xEC, 0xD7, 0xBD, 0x7B, 0xF7, 0xA3, 0x21,
-	0x2B, 0xEB, 0xF0, 0xCE, 0x1F, 0x7E, 0xF8, 0xA1, 0x02, 0x9A, 0x73, 0x05,
-	0xB4, 0xD8, 0x42, 0xBF, 0x48, 0x2E, 0x34, 0x81, 0xB3, 0x8C, 0x26, 0x74,
-	0xD5, 0x54, 0x1B, 0x82, 0xE6, 0xBD, 0xC5, 0xF7, 0x51, 0xEE, 0xF8, 0x6C,
-	0xFE, 0x50, 0x3E, 0x9A, 0x35, 0x6B, 0x36, 0xEF, 0x65, 0x30, 0x91, 0x7F,
-	0x3D, 0x6A, 0xD4, 0xA8, 0x61, 0x77, 0xDF, 0x7D, 0xF7, 0xB5, 0xD8, 0xCF,
-	0xF8, 0x21, 0xFE, 0x5B, 0xBA, 0x64, 0x6D, 0x10, 0x30, 0x41, 0xD7, 0x06,
-	0xB5, 0x18, 0xF7, 0x68, 0x67, 0xFC, 0xE2, 0x8B, 0x2F, 0x3E, 0x77, 0xA7,
-	0x9D, 0x76, 0xEA, 0x85, 0x41, 0xD8, 0x8E, 0xB7, 0x61, 0x37, 0xBD, 0x30,
-	0xD8, 0xA8, 0x19, 0x91, 0x34, 0xAB, 0x22, 0x60, 0x91, 0x29, 0xCB, 0x4B,
-	0x93, 0x8E, 0x51, 0x65, 0xB5, 0x45, 0x38, 0xD0, 0x64, 0xE2, 0x90, 0x76,
-	0xA4, 0xC2, 0x1C, 0x80, 0xDF, 0x7F, 0xFF, 0x7D, 0x05, 0x96, 0xB0, 0x05,
-	0x22, 0x20, 0x21, 0xC0, 0xDC, 0x52, 0xF1, 0xE1, 0x87, 0x1F, 0x7E, 0x36,
-	0x74, 0xE8, 0xD0, 0xF3, 0xB0, 0x69, 0x74, 0xEF, 0xB7, 0xDF, 0x7E, 0xFB,
-	0x0B, 0x6C, 0x93, 0xBF, 0x97, 0xD2, 0x06, 0xDF, 0xFB, 0xFF, 0x11, 0x80,
-	0x4D, 0x79, 0xC1, 0xDB, 0x6F, 0xBF, 0x7D, 0xD6, 0xD5, 0x57, 0x5F, 0x7D,
-	0xE9, 0x0E, 0x3B, 0xEC, 0xD0, 0x63, 0x9D, 0x75, 0xD6, 0x59, 0x85, 0x25,
-	0xA8, 0x15, 0x93, 0x20, 0x49, 0x8A, 0xC5, 0xC4, 0xA9, 0x09, 0x95, 0x9F,
-	0xB3, 0x1F, 0xA9, 0xED, 0x96, 0x6A, 0xE2, 0x90, 0x82, 0xA0, 0xD5, 0x5C,
-	0x55, 0x66, 0xB5, 0x7F, 0xFF, 0xFB, 0xDF, 0x05, 0x39, 0x64, 0x9D, 0xDA,
-	0x84, 0x9E, 0x3C, 0x79, 0xF2, 0x07, 0xE3, 0xC6, 0x8D, 0x1B, 0xF6, 0xEE,
-	0xBB, 0xEF, 0x5E, 0x87, 0x66, 0xCF, 0xB6, 0xF9, 0xA3, 0x6E, 0x24, 0xDC,
-	0x04, 0x5D, 0x37, 0xB8, 0x56, 0x1C, 0x7C, 0xF0, 0xC1, 0xDD, 0xFB, 0xF7,
-	0xEF, 0x3F, 0x08, 0xCB, 0xD6, 0x35, 0x42, 0x2F, 0x8B, 0x90, 0x90, 0xF9,
-	0x39, 0x35, 0xD9, 0x70, 0x87, 0x5D, 0x76, 0xE2, 0x52, 0x35, 0x67, 0xBD,
-	0x16, 0x34, 0xE2, 0x79, 0x83, 0x99, 0x9F, 0x69, 0x49, 0xAB, 0xC1, 0xCE,
-	0x89, 0x42, 0x9E, 0x20, 0xFC, 0x9E, 0x7F, 0x73, 0x40, 0xF2, 0x7B, 0x92,
-	0x36, 0xC8, 0xF9, 0xEB, 0x41, 0x83, 0x06, 0xF5, 0x1B, 0x3C, 0x78, 0xF0,
-	0xC8, 0x3A, 0x82, 0x2A, 0x97, 0x8F, 0x85, 0x7D, 0xB9, 0xF7, 0xC9, 0x27,
-	0x9F, 0x7C, 0x2E, 0x4C, 0x19, 0x6B, 0xC2, 0x35, 0xAE, 0x82, 0xA6, 0x26,
-	0x11, 0xA0, 0xF6, 0x20, 0xA6, 0x4F, 0x9F, 0x5E, 0x30, 0x3F, 0xC9, 0x3E,
-	0x1C, 0x9A, 0xC4, 0xD8, 0x3F, 0x94, 0x9D, 0x52, 0x4D, 0x1C, 0xE1, 0x24,
-	0x10, 0xDA, 0xA3, 0x25, 0x2B, 0xFA, 0x4C, 0xF2, 0x28, 0xB9, 0x91, 0xE2,
-	0xF0, 0xE5, 0x97, 0x5F, 0x7E, 0x05, 0x25, 0xE4, 0x94, 0x1B, 0x6E, 0xB8,
-	0xE1, 0xB6, 0x5C, 0x76, 0x64, 0x1D, 0xBF, 0xB4, 0x09, 0xBA, 0xCC, 0x00,
-	0xEF, 0xB6, 0xDB, 0x6E, 0x5D, 0x4E, 0x39, 0xE5, 0x94, 0x0B, 0xE0, 0x2E,
-	0xB7, 0x2D, 0x07, 0x9C, 0xEC, 0x86, 0xFC, 0x2D, 0x32, 0xA6, 0xA6, 0x4A,
-	0x72, 0xE6, 0xA0, 0xA4, 0xB6, 0x5A, 0x7C, 0x69, 0x79, 0xC9, 0xCF, 0xCB,
-	0x45, 0xD4, 0x7C, 0x16, 0xDB, 0x10, 0xBA, 0xE3, 0x91, 0x8C, 0x7F, 0xFE,
-	0xF9, 0xE7, 0xC2, 0x52, 0x9A, 0x44, 0x4E, 0x62, 0x26, 0x61, 0x73, 0xD0,
-	0x6B, 0xF9, 0x4C, 0xCD, 0x1B, 0x36, 0xEC, 0xB9, 0xD8, 0xD4, 0x7C, 0x13,
-	0x44, 0x7D, 0x0E, 0xB4, 0xBE, 0x87, 0xCA, 0x0C, 0x59, 0xAE, 0x1E, 0x07,
-	0x33, 0x46, 0xD7, 0x33, 0xCE, 0x38, 0xE3, 0x22, 0x98, 0x32, 0x3A, 0x61,
-	0x23, 0xAE, 0x02, 0xBE, 0xCC, 0x85, 0xF7, 0x67, 0x3F, 0xB0, 0x3F, 0x28,
-	0x1B, 0x94, 0x93, 0xD0, 0xDC, 0xC5, 0xEF, 0x49, 0x8C, 0x5A, 0x71, 0x15,
-	0x93, 0xAA, 0x00, 0xAC, 0x8D, 0x89, 0x83, 0x1A, 0xBB, 0xB4, 0x66, 0x92,
-	0x6E, 0x68, 0xE3, 0x66, 0x7D, 0xF0, 0xAB, 0xAF, 0x80, 0x9F, 0x75, 0x41,
-	0x3E, 0x58, 0x96, 0x93, 0x36, 0x65, 0x88, 0x9A, 0x37, 0xE5, 0x86, 0x17,
-	0x65, 0xE4, 0xE9, 0xA7, 0x9F, 0x7E, 0xE2, 0xAA, 0xAB, 0xAE, 0x3A, 0xEB,
-	0xB1, 0xC7, 0x1E, 0x9B, 0x98, 0xAB, 0x0E, 0xAD, 0xE3, 0x97, 0x35, 0x41,
-	0x97, 0x11, 0xE0, 0x73, 0xCE, 0x39, 0xE7, 0xCC, 0xA3, 0x8F, 0x3E, 0xBA,
-	0x2F, 0x02, 0x06, 0x56, 0xA4, 0xD0, 0x52, 0xA8, 0xB9, 0x41, 0x27, 0xCD,
-	0x27, 0xF4, 0x57, 0x95, 0xAF, 0xB2, 0xB4, 0x57, 0x2D, 0x55, 0xCB, 0x61,
-	0xD2, 0xA8, 0x8A, 0xF0, 0x8B, 0x9F, 0xCF, 0x41, 0xC6, 0x36, 0x52, 0x43,
-	0x93, 0xFD, 0x59, 0x9B, 0x42, 0x2C, 0xCB, 0x76, 0x90, 0x14, 0x48, 0x18,
-	0x22, 0x71, 0x2A, 0xE0, 0x58, 0xD6, 0xDE, 0x3E, 0x6C, 0xD8, 0xB0, 0x01,
-	0xCF, 0x3D, 0xF7, 0xDC, 0x7B, 0x65, 0x84, 0xAE, 0xD1, 0x3F, 0x6A, 0xF3,
-	0xCD, 0x37, 0x6F, 0x7D, 0xC2, 0x09, 0x27, 0x5C, 0x08, 0xD3, 0xC6, 0x01,
-	0x20, 0xDF, 0xF9, 0x39, 0x39, 0x73, 0xF2, 0x25, 0xB6, 0x24, 0xBD, 0x90,
-	0x5C, 0x65, 0x03, 0x26, 0x49, 0xD3, 0xE4, 0x24, 0xB2, 0x96, 0xCC, 0x54,
-	0x6E, 0xDC, 0xCD, 0x23, 0xD3, 0x52, 0x08, 0x9A, 0xF7, 0x56, 0x47, 0xF8,
-	0xD2, 0xA2, 0xD9, 0x06, 0xCA, 0xB1, 0x26, 0x0F, 0xCA, 0x2C, 0xE5, 0x83,
-	0x84, 0xCD, 0xCF, 0xF8, 0x9B, 0x8A, 0xC6, 0x77, 0xDF, 0x7D, 0x37, 0xFD,
-	0xFA, 0xEB, 0xAF, 0xBF, 0x8C, 0x2B, 0xC7, 0x46, 0xDF, 0xA1, 0x29, 0xBD,
-	0xA0, 0x09, 0xBA, 0x0C, 0x40, 0x6F, 0xB9, 0xE5, 0x96, 0x6B, 0x81, 0x98,
-	0xCF, 0xC5, 0x0E, 0xFC, 0xC1, 0x1C, 0x4C, 0x24, 0x3C, 0x5E, 0x72, 0x9B,
-	0xAB, 0xA9, 0x8A, 0x28, 0xAD, 0xA7, 0xD8, 0xEB, 0x42, 0x83, 0x46, 0x76,
-	0xEA, 0xD0, 0x0E, 0x19, 0xBA, 0x4A, 0x95, 0xE1, 0xB5, 0x0A, 0x8F, 0x90,
-	0x97, 0x87, 0xCC, 0x31, 0x1C, 0xA8, 0x30, 0x7B, 0x7C, 0xFF, 0x97, 0xBF,
-	0xFC, 0x65, 0xF0, 0x4D, 0x37, 0xDD, 0xF4, 0x67, 0xDB, 0xA6, 0xA3, 0x91,
-	0x86, 0x09, 0xA0, 0x3F, 0xE4, 0xE3, 0x64, 0x6C, 0xC6, 0x2E, 0x43, 0xED,
-	0x58, 0x1E, 0x12, 0xA1, 0x7F, 0x7A, 0x75, 0x4F, 0xD1, 0x26, 0x6F, 0x4D,
-	0xB5, 0x54, 0x65, 0x9A, 0x08, 0xCD, 0x66, 0xD1, 0x2D, 0x2C, 0xAD, 0x84,
-	0x26, 0x1B, 0xAD, 0xF6, 0xC6, 0x8C, 0x19, 0x73, 0x0B, 0x4C, 0x1E, 0x17,
-	0x8C, 0x1F, 0x3F, 0xFE, 0xFD, 0xD2, 0x9E, 0xEC, 0xBB, 0x4D, 0xD0, 0x25,
-	0xCA, 0x40, 0xCF, 0x9E, 0x3D, 0xF7, 0x38, 0xFD, 0xF4, 0xD3, 0xAF, 0xEA,
-	0xD0, 0xA1, 0xC3, 0x1A, 0xB4, 0x19, 0x72, 0x00, 0xD2, 0xA6, 0x18, 0x7A,
-	0x4F, 0x94, 0x42, 0xD0, 0xBA, 0x57, 0x84, 0xAC, 0xE7, 0x6A, 0x00, 0x86,
-	0x04, 0x2F, 0xD3, 0x88, 0xCA, 0xC4, 0xF1, 0xA3, 0x8E, 0x7A, 0x7D, 0xAD,
-	0x02, 0xF8, 0x6C, 0xFE, 0x2D, 0x9B, 0x28, 0x36, 0x16, 0x7F, 0xC7, 0x46,
-	0xE2, 0xE4, 0x01, 0x03, 0x06, 0xF4, 0xC5, 0x32, 0xFD, 0x05, 0x6F, 0x12,
-	0xFD, 0x2F, 0x92, 0x9D, 0x3A, 0x75, 0xEA, 0x00, 0xDB, 0xFD, 0x75, 0xF0,
-	0xDC, 0xD9, 0x18, 0x18, 0x35, 0x95, 0x89, 0x89, 0x93, 0x38, 0xFB, 0x8D,
-	0xFF, 0x97, 0xBA, 0x62, 0x62, 0x9F, 0xF0, 0xD2, 0x2A, 0x4D, 0xF2, 0x20,
-	0xD2, 0xD6, 0x0A, 0x4D, 0xDE, 0x3B, 0x2C, 0x2B, 0x0D, 0x38, 0xAA, 0xEF,
-	0xE3, 0x7E, 0x2F, 0x8D, 0x9E, 0x9B, 0xCD, 0xD4, 0xA4, 0x69, 0x26, 0x7B,
-	0xF3, 0xCD, 0x37, 0x3F, 0xB9, 0xE4, 0x92, 0x4B, 0x8E, 0xC7, 0x8A, 0xEB,
-	0x81, 0xB8, 0xCF, 0x71, 0xB9, 0xFF, 0x45, 0xC0, 0x04, 0x5D, 0x82, 0x54,
-	0x5C, 0x79, 0xE5, 0x95, 0x97, 0x61, 0xD9, 0x7A, 0x06, 0x05, 0x94, 0x42,
-	0x4F, 0xED, 0x52, 0x97, 0x06, 0x44, 0xA9, 0x81, 0x26, 0xD5, 0x69, 0x50,
-	0x1C, 0xDC, 0xFC, 0x8E, 0xDA, 0x7A, 0xB1, 0xBD, 0x52, 0x5A, 0x76, 0x94,
-	0x76, 0x9E, 0xE4, 0xD5, 0xB5, 0xD1, 0x29, 0x1B, 0x36, 0x57, 0x07, 0x7C,
-	0x3E, 0x6C, 0x91, 0xBF, 0xC0, 0xDB, 0x63, 0x08, 0x88, 0x02, 0xF1, 0x37,
-	0xE7, 0xCF, 0x4A, 0xF2, 0xCC, 0xC6, 0x5C, 0xF6, 0xA2, 0x8B, 0x2E, 0x3A,
-	0xBB, 0x4F, 0x9F, 0x3E, 0x67, 0xC1, 0x7E, 0x5B, 0x30, 0x32, 0x73, 0xE2,
-	0x26, 0x76, 0xF2, 0xBE, 0xE0, 0x67, 0xA5, 0xF6, 0x4F, 0xB1, 0x6C, 0x84,
-	0x26, 0xB4, 0xD0, 0x13, 0x48, 0xAE, 0x79, 0xC5, 0xF5, 0xC5, 0xD1, 0xE0,
-	0xA3, 0xFA, 0x88, 0x13, 0x84, 0x64, 0x41, 0x65, 0xA9, 0x51, 0xB3, 0x7E,
-	0x4E, 0xE6, 0x97, 0x5F, 0x7E, 0xF9, 0xC0, 0xB3, 0xCE, 0x3A, 0xAB, 0x7F,
-	0xD4, 0x73, 0xFC, 0x7D, 0xD5, 0x08, 0x98, 0xA0, 0x6B, 0x29, 0x19, 0xD7,
-	0xE0, 0xEA, 0xDD, 0xBB, 0xF7, 0xD1, 0xD8, 0x28, 0x59, 0x80, 0x3E, 0xAB,
-	0x5C, 0xDE, 0x71, 0xD3, 0x84, 0x1B, 0x6D, 0x1C, 0x84, 0x24, 0x6B, 0x2D,
-	0x67, 0x4B, 0xD1, 0xA0, 0xB5, 0x89, 0x13, 0x6E, 0xE0, 0x14, 0x0F, 0x34,
-	0x0D, 0x4C, 0x99, 0x43, 0x42, 0xD7, 0xAB, 0x52, 0x37, 0x19, 0xF9, 0x2C,
-	0x4D, 0x40, 0xD2, 0xF6, 0x38, 0x29, 0x68, 0xF3, 0x53, 0x93, 0x12, 0x34,
-	0xA6, 0x77, 0xE1, 0x95, 0xD0, 0x03, 0x9B, 0x45, 0x6F, 0xD4, 0x12, 0xD2,
-	0x46, 0x71, 0x1B, 0x73, 0xA9, 0x40, 0x73, 0xBC, 0x01, 0x66, 0xAF, 0x2D,
-	0xF8, 0x42, 0x24, 0x2B, 0x5E, 0xEC, 0x87, 0x30, 0x97, 0x8A, 0x7C, 0xDC,
-	0x6B, 0x43, 0xD2, 0x61, 0xFF, 0x86, 0xC1, 0x2B, 0x55, 0x01, 0x58, 0x95,
-	0x97, 0x86, 0x26, 0x5B, 0xFE, 0x26, 0x89, 0x96, 0x22, 0x9F, 0xBA, 0x97,
-	0xB6, 0x74, 0x5E, 0x1C, 0x03, 0x94, 0x0F, 0xDA, 0xAD, 0x91, 0x3B, 0x84,
-	0x36, 0xF6, 0xD9, 0x30, 0x79, 0x8C, 0xC0, 0x64, 0xD5, 0xA7, 0x51, 0x74,
-	0x70, 0xCA, 0x2F, 0x61, 0x82, 0xAE, 0x05, 0xE0, 0x58, 0xB6, 0xDD, 0x89,
-	0xDD, 0xF8, 0x7D, 0x29, 0xE0, 0x5F, 0x7F, 0xFD, 0x75, 0xC5, 0xCA, 0x2B,
-	0xAF, 0x5C, 0x78, 0x0A, 0x77, 0xB6, 0x39, 0x08, 0xB5, 0x71, 0x42, 0x6F,
-	0x88, 0x70, 0x30, 0x45, 0x0D, 0xA0, 0x9A, 0x9A, 0xA2, 0xA0, 0x01, 0xB9,
-	0xE1, 0xC9, 0x7C, 0xC1, 0x01, 0x18, 0xFA, 0x39, 0x2B, 0xE0, 0xA5, 0x16,
-	0xAF, 0x55, 0xE5, 0x2D, 0x7C, 0x36, 0xAF, 0x70, 0x12, 0x50, 0x60, 0x0D,
-	0x3F, 0xE7, 0xF7, 0xF2, 0x46, 0x40, 0x9B, 0xE6, 0xC2, 0xE4, 0x71, 0x0A,
-	0xB4, 0xC7, 0x21, 0xE5, 0xAA, 0xBF, 0x21, 0x3D, 0xA7, 0x5F, 0xBF, 0x7E,
-	0x27, 0xE1, 0xDD, 0x07, 0x03, 0x93, 0x26, 0xFF, 0xFC, 0xE7, 0x3F, 0x2B,
-	0x90, 0x45, 0x70, 0x5E, 0xF3, 0x85, 0x63, 0xF1, 0xFB, 0x44, 0xAD, 0xB0,
-	0x8A, 0xCB, 0x17, 0x4F, 0xC2, 0xBA, 0x9F, 0x9F, 0xCB, 0x84, 0x22, 0x6F,
-	0x0F, 0xCA, 0x82, 0x34, 0x69, 0x6D, 0x3C, 0xAA, 0xEF, 0xCA, 0x15, 0xA9,
-	0xAA, 0x09, 0x9C, 0x4A, 0x09, 0xFF, 0xA6, 0x99, 0x6F, 0xC9, 0x25, 0x97,
-	0x2C, 0xAC, 0x0E, 0x38, 0x36, 0x18, 0x04, 0xC5, 0xEF, 0xC6, 0x8E, 0x1D,
-	0x7B, 0xDB, 0x01, 0x07, 0x1C, 0xD0, 0xB3, 0x21, 0xF5, 0x67, 0x16, 0xDA,
-	0x6A, 0x82, 0x4E, 0xD8, 0x0B, 0x77, 0xDE, 0x79, 0xE7, 0x3D, 0xFB, 0xEE,
-	0xBB, 0xEF, 0x5E, 0xD4, 0x8E, 0x79, 0x51, 0xF8, 0xA8, 0x61, 0x6A, 0x27,
-	0x5B, 0x1A, 0x0B, 0xB5, 0x88, 0x38, 0xB6, 0xBE, 0x28, 0x0D, 0x8A, 0xDA,
-	0x39, 0x9F, 0x23, 0xE2, 0x57, 0x44, 0x19, 0xEB, 0x96, 0xB9, 0x21, 0xB4,
-	0x39, 0xEB, 0x75, 0x58, 0x3F, 0xDB, 0x18, 0x46, 0x81, 0x25, 0x7C, 0xD5,
-	0x42, 0xF1, 0x70, 0x19, 0xCC, 0x77, 0xE4, 0xBB, 0x86, 0xDA, 0xA0, 0xDE,
-	0x91, 0x6D, 0x11, 0x06, 0x48, 0xB4, 0xF3, 0xD0, 0x65, 0x97, 0x5D, 0xD6,
-	0x03, 0x29, 0x4E, 0xFF, 0x5D, 0x9B, 0x3A, 0x1B, 0xDA, 0x3D, 0x0C, 0xD1,
-	0x86, 0x67, 0xCB, 0x38, 0x04, 0x9C, 0xEC, 0x25, 0x7B, 0x2C, 0xFB, 0x49,
-	0x9B, 0x67, 0x32, 0x77, 0xA9, 0xBF, 0xE4, 0xBB, 0x5C, 0x1B, 0x13, 0x43,
-	0xB1, 0x19, 0x83, 0xF5, 0xF1, 0x62, 0x9F, 0x88, 0x74, 0xC3, 0xCF, 0x8A,
-	0xCD, 0x20, 0x94, 0x09, 0x45, 0x91, 0xB2, 0x7E, 0xB9, 0xF9, 0x55, 0x87,
-	0x79, 0xD4, 0x04, 0xA2, 0x49, 0x41, 0xB9, 0x41, 0xF8, 0x9C, 0x70, 0x23,
-	0x94, 0xFF, 0xC3, 0xBB, 0xA3, 0xB0, 0x2F, 0x83, 0xE8, 0xC3, 0x07, 0xF7,
-	0xD9, 0x67, 0x9F, 0xDD, 0x1B, 0x5A, 0xFF, 0xD6, 0x67, 0x7B, 0x4D, 0xD0,
-	0x09, 0xD0, 0x87, 0x8F, 0xE7, 0xB3, 0x18, 0x84, 0x5B, 0x51, 0x63, 0xE4,
-	0x52, 0x4E, 0x7E, 0xCD, 0xFC, 0xAD, 0x9C, 0x09, 0xD4, 0x1A, 0xB8, 0xB4,
-	0xE3, 0xD2, 0x9F, 0xDA, 0x44, 0xD4, 0x00, 0x88, 0x22, 0x68, 0x35, 0x4F,
-	0x7E, 0xC9, 0x28, 0x3F, 0x07, 0x03, 0x70, 0x16, 0xB4, 0xF5, 0x19, 0x20,
-	0xE1, 0x19, 0x18, 0x80, 0x9C, 0x29, 0xF0, 0x71, 0x13, 0xA6, 0x9D, 0x9C,
-	0x1F, 0xC4, 0xB0, 0x00, 0xEA, 0x5E, 0x0C, 0x3F, 0x0B, 0x44, 0x0D, 0xAE,
-	0x38, 0xAF, 0x2E, 0x92, 0x51, 0x04, 0x59, 0x78, 0x8F, 0x82, 0x25, 0xA4,
-	0xB5, 0x73, 0xB0, 0x02, 0x9B, 0xB9, 0x78, 0xFF, 0x26, 0xC8, 0x37, 0xFC,
-	0x05, 0xDC, 0x0E, 0x8F, 0x42, 0x66, 0xB4, 0x09, 0xC8, 0x8A, 0xD6, 0x28,
-	0x43, 0x82, 0xB1, 0x72, 0x5A, 0x04, 0xEE, 0x73, 0x1D, 0x91, 0xC3, 0x64,
-	0x2C, 0x02, 0x4E, 0x56, 0xE2, 0x64, 0x4A, 0x97, 0x39, 0xF9, 0x97, 0x53,
-	0x06, 0xB4, 0x21, 0x58, 0xDC, 0x8F, 0xFC, 0x5F, 0x9B, 0xAE, 0x71, 0xFA,
-	0x81, 0x65, 0x42, 0xED, 0x59, 0x7F, 0xB3, 0x5F, 0x2A, 0xA3, 0x44, 0x67,
-	0xB0, 0x5E, 0x3C, 0xF3, 0x77, 0x4C, 0x94, 0xBF, 0x50, 0x46, 0xF0, 0xDD,
-	0x42, 0x74, 0xE9, 0xA3, 0x48, 0x40, 0x3E, 0x17, 0xC5, 0xF7, 0x4C, 0x69,
-	0x58, 0x48, 0x4F, 0x2A, 0xB9, 0xAB, 0x4E, 0xB3, 0x57, 0x9B, 0xA2, 0x64,
-	0x88, 0x1B, 0x83, 0xD4, 0x92, 0xF9, 0x4C, 0xAE, 0x1A, 0x56, 0x5C, 0x71,
-	0xC5, 0xC2, 0xDF, 0x7C, 0x37, 0xCA, 0x05, 0x65, 0x82, 0x38, 0xD0, 0x9F,
-	0x9A, 0xD8, 0x3C, 0xFC, 0xF0, 0xC3, 0x8F, 0x23, 0x11, 0xD4, 0x8E, 0x71,
-	0xDF, 0x39, 0xEF, 0xE5, 0x4C, 0xD0, 0x31, 0x25, 0x00, 0x4B, 0xB4, 0x71,
-	0x7F, 0xC2, 0x45, 0x81, 0x93, 0x67, 0x43, 0xA8, 0xCD, 0x92, 0xC8, 0x28,
-	0x88, 0x14, 0x7C, 0xFE, 0x4D, 0x73, 0x07, 0x1D, 0xFC, 0x4B, 0x35, 0x71,
-	0x30, 0xEB, 0x3A, 0xF2, 0x39, 0x7F, 0x0D, 0x1B, 0xEF, 0x44, 0x04, 0x8B,
-	0xBC, 0x02, 0xB7, 0xB6, 0xA9, 0x5F, 0x7D, 0xF5, 0xD5, 0xA7, 0xA8, 0xE3,
-	0x5B, 0x0C, 0x8E, 0x9F, 0x10, 0xB1, 0xF8, 0xCB, 0x79, 0xE7, 0x9D, 0x37,
-	0x9B, 0xFC, 0xCC, 0xF0, 0x61, 0x24, 0x64, 0x5F, 0x7D, 0xDD, 0x75, 0xD7,
-	0xED, 0x8C, 0x2C, 0x68, 0xDB, 0x21, 0x7C, 0x78, 0xFD, 0x4D, 0x36, 0xD9,
-	0x64, 0xBD, 0x98, 0xAF, 0x58, 0x65, 0xB1, 0xE2, 0xCD, 0x26, 0x69, 0xD5,
-	0xFC, 0x2D, 0xB7, 0x3E, 0x69, 0x51, 0x1C, 0xEC, 0xD2, 0x0E, 0xF9, 0xFE,
-	0xE0, 0x84, 0xB9, 0x08, 0xDA, 0x39, 0x1E, 0x29, 0x33, 0x47, 0x36, 0x36,
-	0x77, 0xBC, 0x6D, 0xB6, 0xD9, 0x66, 0x61, 0x78, 0xEE, 0x1C, 0x81, 0xE0,
-	0x8C, 0xA1, 0x90, 0x87, 0x26, 0xEC, 0x7B, 0x45, 0x00, 0x16, 0xBB, 0x3B,
-	0xCA, 0x86, 0x4F, 0xB2, 0x23, 0x99, 0xF2, 0x7B, 0x99, 0x04, 0xE2, 0x4E,
-	0xD0, 0x55, 0x11, 0x34, 0x9E, 0x37, 0x1B, 0x32, 0x31, 0x19, 0x3F, 0xAF,
-	0xBD, 0xFC, 0xF2, 0xCB, 0xE3, 0xDF, 0x7F, 0xFF, 0xFD, 0xD7, 0xD0, 0x86,
-	0xF7, 0x74, 0x38, 0x03, 0xE4, 0x61, 0xFE, 0x09, 0x13, 0x26, 0x2C, 0x88,
-	0x14, 0xB6, 0x8B, 0xA1, 0x6F, 0x56, 0x68, 0xD9, 0xB2, 0xE5, 0xAA, 0x38,
-	0x00, 0x82, 0xF9, 0xC6, 0x37, 0xE1, 0x0F, 0x92, 0xFC, 0xB7, 0x80, 0x0D,
-	0xFA, 0xBF, 0xD9, 0x96, 0xAA, 0x90, 0x80, 0x28, 0x82, 0xE6, 0x2D, 0x24,
-	0x5F, 0x2A, 0x2C, 0xD2, 0xE0, 0xE5, 0x9A, 0x19, 0x6A, 0xF2, 0x94, 0x0D,
-	0x05, 0xBD, 0xFC, 0xFD, 0xEF, 0x7F, 0x7F, 0x18, 0x2B, 0x8E, 0x7D, 0x7C,
-	0x88, 0x44, 0xF4, 0xC8, 0x34, 0x41, 0x47, 0x63, 0x54, 0x01, 0x7F, 0xDF,
-	0xD1, 0xB0, 0x9F, 0x1D, 0xA4, 0x0D, 0x19, 0x0E, 0x2E, 0x91, 0x74, 0x5C,
-	0x02, 0x56, 0x24, 0x18, 0xAB, 0x93, 0x1F, 0xAC, 0x06, 0x9D, 0x08, 0x8E,
-	0x83, 0x01, 0xCF, 0x9E, 0x8B, 0x8D, 0xC6, 0x5F, 0xA0, 0x79, 0x3E, 0xFB,
-	0xE0, 0x83, 0x0F, 0x3E, 0x30, 0x75, 0xEA, 0xD4, 0x1B, 0x4B, 0x11, 0x64,
-	0x10, 0xC9, 0x26, 0x7B, 0xEC, 0xB1, 0xC7, 0x7E, 0x98, 0x5B, 0xF6, 0x87,
-	0xC6, 0x57, 0xC8, 0xF7, 0xA0, 0x4D, 0x22, 0x69, 0xFE, 0x22, 0x61, 0x7E,
-	0xAE, 0x49, 0x87, 0x44, 0x12, 0x86, 0x16, 0xC7, 0x80, 0xA9, 0xDA, 0x22,
-	0xB7, 0xDD, 0x76, 0xDB, 0xED, 0xF0, 0xF0, 0xE8, 0x8B, 0xBC, 0x0D, 0x5F,
-	0x96, 0xF2, 0x9C, 0xAC, 0xDC, 0x0B, 0xF7, 0xB9, 0x65, 0xCE, 0x3C, 0xF3,
-	0xCC, 0x11, 0x7B, 0xED, 0xB5, 0xD7, 0xBE, 0x71, 0xFB, 0xBF, 0xBA, 0xB6,
-	0xCB, 0xCC, 0x21, 0x12, 0xE7, 0xF3, 0xA4, 0x15, 0x17, 0x07, 0x86, 0x54,
-	0x3E, 0x63, 0x36, 0x56, 0x24, 0x9F, 0x20, 0x3D, 0xEC, 0xFD, 0x8F, 0x3E,
-	0xFA, 0xE8, 0x5D, 0x0F, 0x3D, 0xF4, 0xD0, 0xF8, 0xDA, 0xE2, 0xB2, 0xDA,
-	0x6A, 0xAB, 0x2D, 0xB9, 0xFB, 0xEE, 0xBB, 0xF7, 0xD8, 0x7E, 0xFB, 0xED,
-	0x77, 0xC5, 0x84, 0xBE, 0x2D, 0x6C, 0xC7, 0x4B, 0x48, 0x16, 0xC3, 0xE0,
-	0xAA, 0xD0, 0x1D, 0x90, 0x66, 0x2C, 0x5E, 0x9C, 0x90, 0x64, 0xEB, 0x8E,
-	0xAA, 0x5F, 0x63, 0x85, 0xCF, 0x21, 0x79, 0xF3, 0xD9, 0x88, 0x48, 0xBD,
-	0x19, 0x9B, 0xEC, 0x07, 0x47, 0xDD, 0x9B, 0xF7, 0xEF, 0x4D, 0xD0, 0x11,
-	0x12, 0x00, 0x0D, 0x69, 0x10, 0x06, 0x62, 0x1F, 0x08, 0xF3, 0x12, 0x72,
-	0x69, 0x93, 0x96, 0x5C, 0x49, 0xA8, 0x35, 0x3E, 0x81, 0x4B, 0x40, 0xDA,
-	0xDF, 0x64, 0x93, 0x26, 0x39, 0xD3, 0x26, 0x47, 0x33, 0x09, 0x34, 0x9B,
-	0x82, 0xC0, 0x4A, 0xEB, 0x44, 0x74, 0xDE, 0xF3, 0xA3, 0x47, 0x8F, 0x1E,
-	0x05, 0x4F, 0x88, 0xFB, 0xA1, 0x71, 0x7E, 0x5B, 0x4E, 0xE1, 0xA4, 0x36,
-	0x85, 0x76, 0xEF, 0x7D, 0xD8, 0x61, 0x87, 0x1D, 0xB3, 0xDD, 0x76, 0xDB,
-	0x6D, 0x2F, 0x1B, 0x29, 0xCD, 0x30, 0xD4, 0xF4, 0x65, 0xC2, 0x50, 0x40,
-	0x8A, 0x34, 0xBC, 0x52, 0xBD, 0x40, 0xF8, 0x0E, 0x7C, 0x47, 0x4C, 0x3A,
-	0x3F, 0x9C, 0x74, 0xD2, 0x49, 0x87, 0xDE, 0x7A, 0xEB, 0xAD, 0xF7, 0x96,
-	0xF3, 0xBD, 0xD2, 0x7E, 0x16, 0x6C, 0xA8, 0xDB, 0x22, 0xED, 0xE6, 0x9D,
-	0x20, 0x28, 0x1E, 0x2D, 0x15, 0xE9, 0xC7, 0x1C, 0x47, 0x43, 0x0E, 0x09,
-	0xB0, 0x72, 0xE5, 0x51, 0x20, 0x3F, 0x99, 0xD2, 0x2A, 0x4D, 0x17, 0x33,
-	0x71, 0xC0, 0xC2, 0x53, 0x90, 0x8F, 0x1B, 0x30, 0xE1, 0xDD, 0x43, 0x53,
-	0x57, 0x39, 0xDF, 0x9D, 0x64, 0x0D, 0xD3, 0x43, 0xF7, 0xFD, 0xF7, 0xDF,
-	0xFF, 0xC8, 0x2D, 0xB6, 0xD8, 0xA2, 0xA3, 0x64, 0x9C, 0xEF, 0xC8, 0x76,
-	0x50, 0x46, 0xE9, 0xF1, 0x11, 0xDA, 0xCD, 0x65, 0xDE, 0xA8, 0xA9, 0x1D,
-	0x7C, 0x8F, 0xCA, 0x74, 0x01, 0x85, 0x62, 0x8A, 0x5A, 0xC5, 0x91, 0x6C,
-	0x3F, 0x83, 0xA4, 0x87, 0x9E, 0x7D, 0xF6, 0xD9, 0xFD, 0xCA, 0xF9, 0x1E,
-	0x8D, 0xED, 0x59, 0x26, 0xE8, 0x1A, 0x7A, 0xF4, 0xA0, 0x83, 0x0E, 0xDA,
-	0x07, 0x11, 0x73, 0x77, 0x42, 0x38, 0x0B, 0x38, 0x29, 0xF1, 0x10, 0x85,
-	0x97, 0x1A, 0x4F, 0x55, 0x76, 0xD9, 0xE2, 0xC7, 0xB1, 0xAC, 0x84, 0x92,
-	0xAE, 0x47, 0x7C, 0x06, 0x09, 0x31, 0xB8, 0xE6, 0xC2, 0x0D, 0xE9, 0x56,
-	0xD4, 0x73, 0x0D, 0x08, 0xFA, 0xA5, 0xBA, 0x16, 0x30, 0xD8, 0x08, 0x9B,
-	0xE1, 0xD8, 0xA4, 0x8E, 0x87, 0x1E, 0x7A, 0xE8, 0xB1, 0x20, 0xED, 0x7D,
-	0x51, 0x5F, 0x13, 0x6D, 0xFC, 0x91, 0x1C, 0xA4, 0x55, 0xF3, 0x33, 0x0E,
-	0xCE, 0x52, 0x09, 0x5A, 0xCB, 0x5D, 0x4C, 0x04, 0x73, 0x80, 0xD7, 0x4C,
-	0x2C, 0x6D, 0xAF, 0xC0, 0xA0, 0x1C, 0x50, 0xD7, 0xEF, 0x59, 0x17, 0xCF,
-	0x87, 0xFB, 0x5C, 0x3F, 0xE4, 0x6A, 0x3E, 0x1B, 0xFD, 0xD9, 0x14, 0x76,
-	0xF6, 0x05, 0xE9, 0x52, 0x19, 0xB5, 0x09, 0x1B, 0x45, 0xD0, 0xD2, 0x9C,
-	0xF9, 0x2C, 0x06, 0x79, 0x54, 0x92, 0x71, 0x21, 0x04, 0x9C, 0x13, 0x3B,
-	0xAE, 0xB9, 0x98, 0xD4, 0xC6, 0x62, 0x15, 0x37, 0x1C, 0x1A, 0xF3, 0x04,
-	0x9A, 0xB2, 0xEA, 0xE2, 0xDD, 0xC2, 0x67, 0x62, 0x02, 0xDF, 0x0C, 0x13,
-	0xF9, 0xB1, 0x48, 0x8F, 0xDB, 0x9B, 0xF2, 0xC1, 0xEF, 0xD8, 0x4E, 0x66,
-	0x62, 0x64, 0x1B, 0x15, 0x82, 0x4E, 0x9B, 0x72, 0x9C, 0x4B, 0xB9, 0x45,
-	0x58, 0x36, 0xFC, 0x1B, 0x32, 0xF1, 0x07, 0xF0, 0x3C, 0x00, 0x93, 0xCE,
-	0x9D, 0x71, 0x9E, 0x93, 0xC7, 0x32, 0x26, 0xE8, 0x6A, 0x7A, 0x1D, 0xB6,
-	0xDB, 0xB5, 0xEF, 0xBA, 0xEB, 0xAE, 0xA7, 0x70, 0x48, 0x6B, 0x0B, 0xB9,
-	0x28, 0x29, 0x2A, 0x8B, 0xB7, 0x84, 0x66, 0x8A, 0x9A, 0x04, 0x47, 0x66,
-	0x11, 0x96, 0xE1, 0x60, 0xA5, 0x36, 0x22, 0x3F, 0x69, 0x6C, 0x3A, 0x3E,
-	0xF4, 0xE7, 0x3F, 0xFF, 0xF9, 0x7C, 0x94, 0x99, 0x9A, 0xB6, 0xC7, 0x03,
-	0xED, 0xD5, 0x58, 0x2A, 0xAF, 0x8A, 0x60, 0x9B, 0x3B, 0x90, 0xB8, 0x67,
-	0x43, 0x4E, 0x36, 0x6C, 0x2B, 0x97, 0xD5, 0x22, 0x0D, 0xB6, 0x39, 0x8E,
-	0x0D, 0xB2, 0xA6, 0xF7, 0xA7, 0xC6, 0xC5, 0x89, 0x89, 0x9B, 0xA8, 0x24,
-	0x21, 0x3C, 0x7F, 0x36, 0x3C, 0x61, 0x6E, 0x81, 0xED, 0x9C, 0x83, 0xBF,
-	0xC1, 0x5C, 0xD0, 0xF6, 0x6E, 0x83, 0x86, 0xD9, 0x43, 0x69, 0x62, 0xF9,
-	0x4E, 0xB4, 0xBB, 0x96, 0x6A, 0xE2, 0xD0, 0xE4, 0x48, 0x20, 0x38, 0x79,
-	0xD3, 0x4E, 0xCB, 0x8D, 0x36, 0x9A, 0x12, 0x60, 0xE5, 0x7A, 0x0C, 0xFB,
-	0x0B, 0xC7, 0xC0, 0xBE, 0x3C, 0x2D, 0x6D, 0xA0, 0xB8, 0x01, 0x0A, 0x7B,
-	0xF5, 0x5A, 0x70, 0x1B, 0x1C, 0x86, 0x54, 0xB9, 0x5B, 0x4A, 0x36, 0x28,
-	0xBB, 0x6C, 0x5B, 0x92, 0xC9, 0x5B, 0x1B, 0x91, 0x94, 0x7F, 0x99, 0x50,
-	0xE4, 0x75, 0x02, 0x19, 0xFC, 0x06, 0x29, 0x12, 0x36, 0x7F, 0xF1, 0xC5,
-	0x17, 0x3F, 0x4E, 0xFB, 0x1D, 0x1B, 0x42, 0x7D, 0x26, 0xE8, 0x6A, 0x7A,
-	0x09, 0x47, 0xFD, 0xFC, 0x03, 0xB6, 0xB9, 0x2D, 0x39, 0x80, 0xB4, 0x13,
-	0x2D, 0x4D, 0x42, 0x04, 0x1D, 0x0E, 0xAE, 0x9A, 0x3A, 0x9B, 0xC4, 0xC4,
-	0x25, 0x22, 0x77, 0xF9, 0xA9, 0x15, 0x81, 0xA4, 0x7F, 0x41, 0x78, 0xF8,
-	0x71, 0x23, 0x46, 0x8C, 0xB8, 0x29, 0x0B, 0x42, 0x72, 0xC4, 0x11, 0x47,
-	0x1C, 0x8C, 0x04, 0x37, 0xE7, 0x61, 0x50, 0xAE, 0x86, 0x83, 0x9F, 0x0B,
-	0x6D, 0xE4, 0x00, 0x94, 0x56, 0x57, 0xAE, 0x36, 0xCA, 0x4F, 0x96, 0x58,
-	0x80, 0x74, 0x5E, 0x40, 0xCA, 0xCD, 0x3D, 0xDF, 0x79, 0xE7, 0x9D, 0xEF,
-	0xCB, 0xF5, 0xFC, 0xBA, 0x78, 0x0E, 0x26, 0xAF, 0x95, 0x70, 0x80, 0xC1,
-	0xC3, 0x38, 0xA0, 0xB5, 0x3D, 0x4F, 0xC9, 0x06, 0x36, 0xF4, 0x8C, 0x98,
-	0x97, 0xF9, 0x2F, 0x4A, 0x43, 0x8E, 0xFA, 0x5E, 0x26, 0x03, 0x7A, 0x40,
-	0xD0, 0xE3, 0x87, 0x66, 0x04, 0x60, 0xF3, 0x3A, 0xA2, 0x33, 0x2F, 0xE6,
-	0x36, 0x04, 0xBC, 0x61, 0xFE, 0x63, 0xF4, 0xAD, 0xC7, 0xEB, 0xF8, 0xE3,
-	0x8F, 0xEF, 0x83, 0xF6, 0x0C, 0xA3, 0xA7, 0x10, 0xDA, 0x53, 0xF0, 0xFB,
-	0x97, 0xEB, 0x60, 0x54, 0xA8, 0xBA, 0xC6, 0x88, 0x26, 0x32, 0xE2, 0xC1,
-	0xBF, 0xA9, 0x49, 0xCB, 0xCE, 0x7D, 0xDF, 0x7D, 0xF7, 0x3D, 0x08, 0x33,
-	0xA2, 0xDD, 0xEF, 0xAA, 0xE8, 0x63, 0x13, 0x74, 0x15, 0xA0, 0x9C, 0x7B,
-	0xEE, 0xB9, 0xA7, 0x0C, 0x1C, 0x38, 0xF0, 0x4A, 0x2E, 0xE9, 0xE8, 0x32,
-	0x17, 0xDA, 0xDD, 0xF8, 0xB7, 0x84, 0x52, 0xF6, 0xC2, 0x9A, 0xC6, 0x8E,
-	0x36, 0x48, 0x24, 0xA8, 0xC8, 0x59, 0x71, 0x37, 0x4D, 0x0B, 0x69, 0x2C,
-	0x55, 0x93, 0x8E, 0x69, 0xB8, 0xC5, 0xF5, 0x45, 0xB0, 0xC5, 0x40, 0x10,
-	0xD0, 0xA2, 0xD4, 0xE4, 0x2A, 0x97, 0xD8, 0x49, 0x1F, 0xF3, 0xFF, 0xCA,
-	0x0B, 0x23, 0xFE, 0x26, 0x76, 0x4A, 0xAF, 0xCA, 0x43, 0x00, 0x50, 0xC7,
-	0x3F, 0xB1, 0xC4, 0x3D, 0x18, 0xAE, 0x6A, 0x2F, 0x66, 0x31, 0x4C, 0x1C,
-	0x1B, 0x67, 0x1D, 0x70, 0x5E, 0xE3, 0x9D, 0x70, 0xA1, 0x6B, 0x03, 0xF2,
-	0x6C, 0xC2, 0xD5, 0x04, 0x4D, 0x36, 0xFC, 0xCD, 0x95, 0x46, 0x39, 0x4C,
-	0x1C, 0x8A, 0x34, 0x24, 0x31, 0x43, 0xDE, 0x7E, 0x80, 0xFF, 0xF8, 0x00,
-	0x84, 0x47, 0x0F, 0x2B, 0x09, 0xF4, 0x3A, 0xBA, 0x19, 0x66, 0x96, 0x5B,
-	0xB1, 0xF2, 0xE9, 0x29, 0x33, 0x45, 0x1C, 0xF9, 0x0F, 0x4D, 0x1A, 0xC5,
-	0x7E, 0xDF, 0xFC, 0x9F, 0xCF, 0xA0, 0x4C, 0x40, 0xEE, 0x4E, 0x45, 0x52,
-	0xA9, 0xAB, 0xEA, 0xA8, 0xE9, 0x0D, 0xF6, 0xB1, 0x26, 0xE8, 0xA2, 0xAE,
-	0xDB, 0x76, 0xDB, 0x6D, 0x37, 0xC4, 0xCE, 0xF8, 0xEB, 0xDC, 0xA5, 0xA6,
-	0x39, 0x82, 0x51, 0x51, 0x8A, 0xD2, 0x12, 0x39, 0x8B, 0xA0, 0x43, 0xE1,
-	0xAB, 0x4E, 0x02, 0x94, 0x88, 0x9D, 0xFE, 0xA9, 0x20, 0xC0, 0x33, 0x70,
-	0x82, 0xC6, 0xD0, 0x2C, 0x4B, 0x0B, 0xC8, 0xB2, 0xDD, 0xA9, 0xA7, 0x9E,
-	0x7A, 0xC1, 0xDE, 0x7B, 0xEF, 0xBD, 0x1F, 0xDF, 0x37, 0x0C, 0x40, 0xA8,
-	0x6D, 0xBB, 0x15, 0xB8, 0x20, 0x17, 0x33, 0xFE, 0xE6, 0x32, 0x19, 0xC4,
-	0x57, 0x01, 0x8D, 0xFD, 0x6B, 0x90, 0xF4, 0xB1, 0x30, 0x21, 0xDC, 0x53,
-	0xDB, 0xE7, 0xD7, 0xC5, 0x7D, 0x58, 0x76, 0xEF, 0x85, 0x7D, 0x81, 0x31,
-	0xE8, 0xFF, 0xC5, 0x90, 0x94, 0xBE, 0x62, 0x85, 0x15, 0x56, 0x98, 0xE7,
-	0x56, 0x28, 0x13, 0x10, 0xF1, 0x89, 0xB2, 0xD1, 0xC7, 0xD1, 0xA0, 0x39,
-	0x59, 0x63, 0x22, 0x18, 0x01, 0xFB, 0xFC, 0x65, 0x70, 0xA7, 0x4C, 0xDD,
-	0x9C, 0x91, 0x04, 0x3F, 0x10, 0x29, 0x1C, 0x58, 0xCE, 0xEC, 0x87, 0x31,
-	0xB0, 0x58, 0x78, 0x58, 0x40, 0x75, 0xCF, 0x28, 0xF6, 0xB9, 0xD6, 0xDE,
-	0x0D, 0xC7, 0x90, 0xA2, 0x63, 0x2B, 0xBD, 0x55, 0xE6, 0xE2, 0xE4, 0xA1,
-	0xF5, 0xB1, 0x41, 0xFE, 0x76, 0x92, 0xF6, 0x34, 0xF6, 0xB2, 0x26, 0xE8,
-	0xA2, 0x1E, 0xC6, 0xE1, 0x98, 0xAF, 0x60, 0x17, 0x7B, 0x13, 0x05, 0x1D,
-	0x50, 0xC0, 0x94, 0xD2, 0x53, 0x7F, 0xC7, 0x5D, 0xDE, 0xE9, 0xD1, 0x53,
-	0xA6, 0x4C, 0xF9, 0x18, 0x1A, 0xE2, 0x49, 0xD0, 0x9E, 0xEF, 0x6B, 0x28,
-	0x02, 0x75, 0xE4, 0x91, 0x47, 0x1E, 0x06, 0xB3, 0xC7, 0x45, 0xB4, 0xC1,
-	0x97, 0xDA, 0x66, 0xB9, 0xF5, 0x15, 0xFB, 0xFE, 0x72, 0x85, 0x42, 0x9B,
-	0x2E, 0x26, 0xC3, 0x39, 0xD0, 0x9E, 0xCE, 0x41, 0x7D, 0x97, 0x95, 0x5A,
-	0x57, 0x39, 0xEE, 0xBF, 0xF0, 0xC2, 0x0B, 0x4F, 0x43, 0x5B, 0x2E, 0x47,
-	0x7F, 0x37, 0xE1, 0xE4, 0x22, 0xBB, 0x3C, 0xC9, 0x38, 0x3C, 0xA1, 0x26,
-	0xDC, 0x5F, 0xA8, 0xAE, 0xDE, 0x28, 0x82, 0xC6, 0xB9, 0x7E, 0xEF, 0x20,
-	0x35, 0xE7, 0x20, 0xA4, 0x76, 0x19, 0x5D, 0x8E, 0xB6, 0xA7, 0xF1, 0x0C,
-	0x6C, 0x9E, 0xEF, 0x07, 0xDB, 0xF8, 0x95, 0xAB, 0xAF, 0xBE, 0x7A, 0xAB,
-	0xA8, 0xFA, 0x64, 0xCE, 0x50, 0xC0, 0x0E, 0xF1, 0x54, 0xF4, 0xA9, 0x34,
-	0xEA, 0x2F, 0xBE, 0xF8, 0xA2, 0x02, 0x3E, 0xDA, 0xB4, 0xB9, 0x3F, 0x07,
-	0xB7, 0xD0, 0x2E, 0x51, 0xCF, 0xCC, 0xD3, 0xF7, 0x26, 0xE8, 0xA0, 0xB7,
-	0x4F, 0x3B, 0xED, 0xB4, 0x13, 0x79, 0xAA, 0xB5, 0x7C, 0x35, 0xC3, 0x40,
-	0x94, 0x9A, 0x84, 0x42, 0xAE, 0x69, 0x4A, 0x1C, 0xA4, 0x90, 0x68, 0x6E,
-	0x22, 0xBD, 0xFA, 0xEA, 0xAB, 0x6F, 0x21, 0x9B, 0xD7, 0xE1, 0x70, 0x91,
-	0x7A, 0xA5, 0xA1, 0x09, 0x16, 0x09, 0x0A, 0x1B, 0x7A, 0xB7, 0x62, 0x55,
-	0xD1, 0x0D, 0xD1, 0x62, 0x0B, 0x85, 0x2B, 0x06, 0x6A, 0x42, 0x8A, 0x6E,
-	0x94, 0x37, 0x8B, 0x26, 0x30, 0xBE, 0x67, 0xB1, 0x7B, 0x55, 0x75, 0xEF,
-	0x2E, 0xD3, 0x0F, 0xC9, 0x0E, 0x76, 0xCE, 0x4B, 0xE1, 0xD6, 0x78, 0x61,
-	0x7D, 0xDA, 0x5D, 0xD1, 0x86, 0x6B, 0x90, 0xA1, 0xF0, 0x78, 0xB6, 0x97,
-	0xCB, 0xEF, 0x28, 0x2D, 0x51, 0x24, 0x43, 0x22, 0xD6, 0x66, 0x58, 0x98,
-	0x1F, 0x43, 0xA1, 0xDF, 0xD2, 0x18, 0x89, 0x61, 0xA5, 0x39, 0x63, 0x06,
-	0xB4, 0xC5, 0xBB, 0x91, 0xD3, 0xE5, 0x80, 0x86, 0x26, 0x17, 0x6C, 0x2F,
-	0xCD, 0x3F, 0x98, 0x54, 0xC6, 0x6E, 0xB0, 0xC1, 0x06, 0x6B, 0x23, 0xED,
-	0x6C, 0x05, 0xC8, 0x7A, 0x5E, 0x8A, 0x5D, 0x69, 0xC9, 0xA1, 0x39, 0xB0,
-	0x26, 0x0D, 0x9B, 0xE5, 0xB8, 0xAA, 0x22, 0xD6, 0x34, 0x2F, 0xC2, 0x5B,
-	0x66, 0x70, 0x43, 0xC4, 0xA4, 0x2E, 0xDA, 0x6C, 0x82, 0xAE, 0x44, 0xB5,
-	0x7D, 0xFB, 0xF6, 0x4B, 0xC1, 0xBF, 0x74, 0x12, 0x36, 0x40, 0x5A, 0x53,
-	0x50, 0xE4, 0xEE, 0x14, 0xA6, 0x10, 0xAD, 0xAA, 0x03, 0x64, 0xFE, 0xA0,
-	0x6F, 0x33, 0x93, 0xE3, 0x90, 0xDC, 0xE9, 0x22, 0xC5, 0xE5, 0x3B, 0x82,
-	0x09, 0x1E, 0xC3, 0x72, 0xB0, 0xD7, 0x7B, 0xEF, 0xBD, 0xF7, 0x5D, 0x5D,
-	0x74, 0x5E, 0x5A, 0xCF, 0x44, 0x22, 0xB2, 0x43, 0x60, 0xF6, 0x18, 0x08,
-	0x5F, 0xD9, 0x96, 0x5A, 0xB2, 0x8A, 0x58, 0xC3, 0x00, 0x8B, 0xD0, 0xDB,
-	0x85, 0xDA, 0x66, 0x1C, 0x0F, 0x10, 0xD9, 0x31, 0xE1, 0x53, 0x3B, 0x0B,
-	0x93, 0x40, 0x53, 0xE4, 0x6B, 0xB8, 0x0D, 0xBE, 0xC6, 0xA9, 0x27, 0xD5,
-	0xA1, 0x57, 0x0B, 0x7E, 0xEE, 0xC0, 0xCF, 0x9E, 0x88, 0xDC, 0x9C, 0xD5,
-	0xBC, 0x79, 0xF3, 0xA6, 0x24, 0xD2, 0x28, 0x2F, 0x0D, 0x7E, 0xAF, 0x32,
-	0x7C, 0x5F, 0x11, 0x75, 0xB8, 0xB9, 0xCC, 0xBF, 0x43, 0xEF, 0x98, 0x8F,
-	0x3F, 0xFE, 0xF8, 0x53, 0xD8, 0x99, 0xFB, 0xC3, 0x84, 0xD2, 0x60, 0xB4,
-	0xE6, 0xAA, 0x64, 0x0D, 0xE4, 0xBC, 0x02, 0xC8, 0x74, 0x1C, 0x8E, 0x79,
-	0xDB, 0x46, 0x59, 0x1C, 0xD9, 0xEF, 0xD8, 0x5F, 0x28, 0x98, 0x84, 0xE2,
-	0xF4, 0xBF, 0x7C, 0xC0, 0xB5, 0x81, 0x8C, 0x71, 0xF4, 0x29, 0xFA, 0x60,
-	0x43, 0x44, 0x47, 0xFE, 0x98, 0x96, 0x7C, 0x67, 0xB9, 0x1E, 0x13, 0x74,
-	0x65, 0xEF, 0x40, 0x73, 0xBB, 0xA8, 0x6F, 0xDF, 0xBE, 0xFD, 0xA4, 0x19,
-	0x72, 0x40, 0x69, 0x83, 0xAF, 0xA6, 0x0E, 0x94, 0x8F, 0xB3, 0x96, 0xF1,
-	0x2C, 0x4B, 0xCD, 0x9B, 0x3E, 0xCD, 0x08, 0x73, 0x3E, 0x06, 0xA7, 0x62,
-	0xBF, 0x9E, 0x65, 0x01, 0x88, 0xDB, 0x36, 0x68, 0x4C, 0xED, 0x70, 0x96,
-	0xDE, 0xB5, 0x3B, 0xEF, 0xBC, 0xF3, 0x36, 0xC4, 0x85, 0xA6, 0x89, 0xAA,
-	0x7C, 0xC1, 0x15, 0x31, 0xA9, 0xF4, 0xA8, 0x71, 0x9E, 0xCF, 0x01, 0xCD,
-	0x09, 0x8D, 0x13, 0x1B, 0xFD, 0x8A, 0xE1, 0xC5, 0x30, 0x09, 0xBE, 0xD2,
-	0x5B, 0xA5, 0xE9, 0x7A, 0x88, 0x3A, 0x5F, 0x83, 0xC7, 0x46, 0x07, 0x25,
-	0xF6, 0x21, 0x61, 0xC4, 0xF1, 0xD2, 0x11, 0x21, 0x8B, 0x68, 0x8A, 0x49,
-	0x89, 0x58, 0xE9, 0x78, 0x28, 0x4E, 0xF6, 0x70, 0xAD, 0x7C, 0xEC, 0x82,
-	0x0B, 0x2E, 0x38, 0x11, 0x2B, 0xAB, 0x77, 0xE3, 0x60, 0x93, 0xF5, 0x32,
-	0x58, 0x5D, 0xAD, 0x0D, 0x92, 0xBE, 0xB3, 0x63, 0xC7, 0x8E, 0xEB, 0x11,
-	0x0B, 0x12, 0x35, 0xDF, 0x93, 0x38, 0x68, 0xC2, 0xAA, 0xE9, 0x1D, 0x24,
-	0x43, 0xFC, 0x4D, 0xAC, 0xB8, 0x61, 0x88, 0xE7, 0x5D, 0x00, 0x4D, 0xFA,
-	0xFC, 0xAC, 0xBF, 0x7B, 0x1A, 0xED, 0x33, 0x41, 0x03, 0x65, 0x68, 0x86,
-	0xAB, 0x20, 0xA4, 0x7A, 0x2A, 0xC8, 0x76, 0x51, 0x0A, 0x08, 0xB5, 0x3A,
-	0x9D, 0x25, 0x18, 0xA7, 0x13, 0x8A, 0x43, 0x61, 0x21, 0x6C, 0xD3, 0xBB,
-	0x76, 0xED, 0xBA, 0x3E, 0xC8, 0xF9, 0xB3, 0x38, 0xF7, 0x37, 0xA4, 0x32,
-	0x30, 0x01, 0x5C, 0xC9, 0x73, 0x17, 0xB1, 0x81, 0x3A, 0x0B, 0x5E, 0x1E,
-	0x0B, 0x70, 0x60, 0xF1, 0xD2, 0x80, 0xD4, 0xBB, 0x28, 0x7C, 0x3C, 0xCA,
-	0x0D, 0x8B, 0xFE, 0xC4, 0x0A, 0xF6, 0xE0, 0x24, 0x47, 0x37, 0x3F, 0xAE,
-	0x44, 0xA0, 0x51, 0x7F, 0x85, 0xF0, 0xF4, 0x6D, 0x61, 0x06, 0xA8, 0x53,
-	0x22, 0x83, 0xCD, 0xB3, 0xF5, 0xDF, 0xFE, 0xF6, 0xB7, 0x67, 0x90, 0x97,
-	0x62, 0x55, 0xD9, 0x97, 0x49, 0x32, 0x74, 0x79, 0x93, 0x09, 0xA7, 0xA6,
-	0xFE, 0x09, 0xB5, 0x67, 0x96, 0xD3, 0x8A, 0x8A, 0x64, 0xA5, 0x77, 0x47,
-	0xEE, 0x94, 0x99, 0x08, 0xEA, 0x68, 0x82, 0xF3, 0xFA, 0x86, 0x60, 0xD2,
-	0x3E, 0xA3, 0x21, 0xF5, 0x77, 0x9C, 0xB6, 0x6E, 0xB6, 0xD9, 0x66, 0x6B,
-	0xDD, 0x7B, 0xEF, 0xBD, 0x8F, 0x23, 0x00, 0x6B, 0x15, 0x6D, 0x2A, 0x6B,
-	0x62, 0x8A, 0xDA, 0x44, 0x25, 0x5E, 0x2C, 0xCB, 0xDF, 0x5C, 0xB9, 0x52,
-	0xE1, 0x01, 0xEE, 0xBF, 0x22, 0x9F, 0xF6, 0x1A, 0x13, 0x27, 0x4E, 0xFC,
-	0x2A, 0x4E, 0xFD, 0x8D, 0xB9, 0x8C, 0x09, 0x1A, 0xBD, 0xCB, 0xF3, 0xF5,
-	0xE0, 0x93, 0x7B, 0x72, 0x98, 0xB9, 0x2D, 0xB4, 0xA7, 0x46, 0x09, 0x00,
-	0xBD, 0x3D, 0x2A, 0x03, 0x31, 0x66, 0x63, 0x20, 0xCE, 0x87, 0xA4, 0xED,
-	0x6B, 0x40, 0x83, 0xFE, 0x28, 0xEA, 0xBE, 0x86, 0xFA, 0x3D, 0xC2, 0x81,
-	0xBB, 0x5E, 0x7A, 0xE9, 0xA5, 0x37, 0x61, 0x63, 0xA7, 0x25, 0x07, 0xA0,
-	0x76, 0xE3, 0xE5, 0xD5, 0xA0, 0x41, 0x19, 0xC7, 0xCB, 0x85, 0x18, 0x28,
-	0xD1, 0x54, 0x88, 0x39, 0xFD, 0x82, 0x61, 0xC3, 0xFF, 0x11, 0xDE, 0x24,
-	0xDB, 0xD7, 0xD5, 0x49, 0xD1, 0xBB, 0xEC, 0xB2, 0x4B, 0x67, 0xF8, 0xA2,
-	0xDF, 0x01, 0x73, 0x46, 0x73, 0x91, 0xA9, 0x6C, 0xCA, 0x20, 0xD5, 0x0A,
-	0x7C, 0x1C, 0x69, 0xE2, 0x50, 0xDB, 0xA5, 0x39, 0xCB, 0xCC, 0x23, 0xD3,
-	0x07, 0x89, 0x1A, 0x36, 0xF5, 0xCF, 0xB1, 0x22, 0x38, 0x14, 0x9E, 0x2A,
-	0x4F, 0x34, 0xD4, 0x3E, 0x8F, 0x6A, 0x37, 0x12, 0x47, 0xAD, 0x8A, 0x55,
-	0xC1, 0xFB, 0x20, 0xD8, 0x05, 0xB4, 0x9A, 0xD4, 0xA9, 0xDF, 0x51, 0xF7,
-	0xCA, 0xCB, 0x47, 0x72, 0x44, 0xE5, 0x08, 0xE1, 0xF4, 0x57, 0xC1, 0x3F,
-	0xFF, 0xD4, 0xA8, 0x7B, 0x1B, 0xFB, 0xF7, 0xB9, 0x27, 0x68, 0x2C, 0x6B,
-	0x5B, 0x3D, 0xF1, 0xC4, 0x13, 0x53, 0x40, 0x2A, 0x8B, 0xE9, 0x74, 0x09,
-	0x79, 0x6D, 0xC4, 0x49, 0x07, 0x49, 0x6D, 0x8B, 0xE4, 0xAC, 0x9C, 0x1A,
-	0x70, 0xEA, 0x3F, 0xEA, 0xDA, 0x6B, 0xAF, 0xBD, 0xA1, 0xB1, 0x0B, 0xCE,
-	0x5A, 0x6B, 0xAD, 0xB5, 0x1C, 0x7C, 0x76, 0xFF, 0x82, 0xF4, 0xAB, 0xFB,
-	0x48, 0x03, 0xA6, 0xF6, 0x43, 0x8D, 0x9A, 0x9A, 0x90, 0x02, 0x12, 0xA2,
-	0xBC, 0x18, 0x48, 0x68, 0x95, 0x11, 0x86, 0xF3, 0x8E, 0x83, 0x0A, 0xCD,
-	0x04, 0xD0, 0xA4, 0xBF, 0x85, 0xEF, 0x6D, 0xF7, 0x52, 0x92, 0x02, 0x55,
-	0xD5, 0x17, 0x87, 0x1C, 0x72, 0xC8, 0x01, 0xD8, 0xBC, 0xBD, 0x02, 0x01,
-	0x28, 0x05, 0x2F, 0x15, 0x7A, 0xED, 0xB0, 0xDD, 0xD4, 0x00, 0x59, 0x3F,
-	0x09, 0x9A, 0x7E, 0xE0, 0x71, 0x34, 0x40, 0x96, 0xE7, 0x7B, 0x6B, 0x42,
-	0xD2, 0x3D, 0x9C, 0xB8, 0x31, 0xB9, 0xDC, 0x01, 0x8F, 0x90, 0x63, 0xB3,
-	0x1E, 0x90, 0x53, 0x0E, 0x79, 0x05, 0xA1, 0xF6, 0x80, 0x47, 0xCA, 0x6D,
-	0xF4, 0xCE, 0x61, 0x3A, 0x83, 0x38, 0x26, 0xA2, 0xD0, 0x37, 0x5A, 0x1B,
-	0xCB, 0x95, 0xC7, 0x83, 0x4D, 0x47, 0x34, 0xEF, 0x9A, 0xE5, 0xCE, 0x49,
-	0x53, 0x8E, 0xF7, 0x4C, 0xF3, 0x19, 0xB9, 0x27, 0x68, 0x90, 0xCC, 0x40,
-	0x2C, 0x3B, 0xCF, 0xA5, 0x06, 0x25, 0x42, 0x26, 0xD1, 0x70, 0x90, 0xF1,
-	0x77, 0xD4, 0x91, 0x40, 0x1C, 0xD8, 0x0C, 0x66, 0x61, 0x59, 0x6C, 0x70,
-	0xDD, 0x0C, 0xED, 0x32, 0x57, 0x19, 0xBA, 0x70, 0x28, 0xEA, 0x10, 0xB8,
-	0x25, 0xEE, 0xCA, 0xC1, 0xA4, 0x74, 0x9A, 0x71, 0x37, 0x08, 0x45, 0x8C,
-	0xC4, 0x2F, 0x3C, 0xDB, 0x8E, 0x66, 0x0F, 0xF6, 0x87, 0x0E, 0x06, 0x00,
-	0x89, 0xFF, 0x8A, 0x44, 0x4B, 0x7D, 0x90, 0x77, 0xB9, 0x2C, 0x91, 0x97,
-	0xD8, 0xF4, 0xEC, 0x05, 0xDF, 0xEB, 0xCB, 0x49, 0xCE, 0xB4, 0x39, 0xB3,
-	0x7E, 0x6D, 0xE4, 0xB1, 0x6E, 0xBE, 0x07, 0x27, 0x5D, 0xB5, 0xA9, 0xA6,
-	0x01, 0xA9, 0x09, 0x88, 0x13, 0x34, 0x9F, 0xC1, 0xC9, 0x8A, 0xA4, 0x83,
-	0x4D, 0xAE, 0x77, 0x60, 0xD7, 0x7E, 0x3A, 0x6F, 0x47, 0x3D, 0x8D, 0x1A,
-	0x35, 0xEA, 0x2F, 0x70, 0xC3, 0x3B, 0x8A, 0x7D, 0x47, 0x6F, 0xA6, 0x28,
-	0x2F, 0x18, 0xA5, 0x68, 0x55, 0x66, 0x3C, 0x9A, 0x17, 0x95, 0x84, 0x0A,
-	0x69, 0x08, 0xFA, 0x63, 0xDF, 0x63, 0x60, 0x9A, 0x84, 0x98, 0xB5, 0xBA,
-	0x72, 0x4F, 0xD0, 0x5C, 0x7E, 0xC2, 0xEE, 0xDC, 0x92, 0x01, 0x29, 0x5A,
-	0x6E, 0xF3, 0x77, 0x9C, 0x4C, 0x65, 0xEA, 0x4C, 0x0E, 0x64, 0x3C, 0xE6,
-	0x33, 0x78, 0x1F, 0x6C, 0x9D, 0xF5, 0x40, 0x83, 0xBA, 0x10, 0x40, 0x9C,
-	0x45, 0x78, 0x1C, 0x7E, 0x2E, 0x58, 0x75, 0xD5, 0x55, 0x97, 0xD5, 0x80,
-	0x23, 0xC1, 0xC6, 0x31, 0x71, 0x70, 0x60, 0x86, 0x89, 0xEE, 0x99, 0x5D,
-	0x8F, 0x24, 0xC7, 0x01, 0x4E, 0xD2, 0x23, 0xB6, 0xEC, 0x1B, 0x10, 0xE9,
-	0x4F, 0x70, 0x81, 0x3C, 0xB7, 0xD4, 0x28, 0x3B, 0xAE, 0x98, 0xB0, 0x09,
-	0x75, 0x3B, 0xC2, 0xF8, 0x37, 0x47, 0xFE, 0xE4, 0x0A, 0xE4, 0x9B, 0x98,
-	0x07, 0x89, 0x42, 0xDB, 0x49, 0xB0, 0xC5, 0xA6, 0x8B, 0xEA, 0x70, 0xD3,
-	0x7E, 0x45, 0x68, 0x73, 0x86, 0xDB, 0xD9, 0xE7, 0xB0, 0xD5, 0x5F, 0x84,
-	0x9F, 0x11, 0x75, 0x81, 0x77, 0x96, 0x9F, 0x09, 0x9B, 0xFE, 0x52, 0xF0,
-	0xF7, 0x7F, 0x1F, 0x6D, 0xC4, 0x02, 0xA4, 0x90, 0xEC, 0x29, 0xF2, 0x22,
-	0x86, 0x5C, 0xB9, 0x50, 0xC9, 0xD1, 0xC1, 0x17, 0xEC, 0x77, 0x6C, 0x1E,
-	0x4F, 0x83, 0x1F, 0xFE, 0x6A, 0x91, 0x0F, 0x68, 0xC4, 0x05, 0x72, 0x4D,
-	0xD0, 0x87, 0x1F, 0x7E, 0xF8, 0xFE, 0x88, 0xE0, 0x1A, 0x5B, 0x53, 0xFF,
-	0x6A, 0xA3, 0x88, 0x83, 0x97, 0x36, 0x35, 0xF9, 0xBA, 0x4A, 0x73, 0x22,
-	0xB9, 0x70, 0x39, 0x87, 0x44, 0x3A, 0x5D, 0x71, 0x5A, 0xC4, 0x53, 0x8D,
-	0x58, 0x56, 0x6A, 0x7C, 0x35, 0x12, 0x1E, 0x5C, 0x0A, 0x87, 0x20, 0x13,
-	0x5A, 0x47, 0xB9, 0x98, 0x51, 0x7B, 0x12, 0x49, 0x87, 0x1B, 0xA9, 0xFA,
-	0x2C, 0xCE, 0x12, 0x98, 0x95, 0xCA, 0xCB, 0x03, 0x03, 0x78, 0x0E, 0x34,
-	0xAA, 0x3E, 0xD0, 0x78, 0x47, 0xD6, 0x26, 0x34, 0x1C, 0x93, 0xC1, 0x7C,
-	0xD0, 0xEE, 0x7A, 0xDE, 0x7C, 0xF3, 0xCD, 0x63, 0xA8, 0xDD, 0x91, 0x14,
-	0xA2, 0x36, 0x31, 0x59, 0x7F, 0x18, 0x0D, 0xC7, 0xFF, 0x75, 0x5A, 0x88,
-	0xBC, 0x14, 0x94, 0xB1, 0x8F, 0xDF, 0xC1, 0xDF, 0x7D, 0x02, 0x02, 0x5D,
-	0x0E, 0x1F, 0x3F, 0x7E, 0xFC, 0xD4, 0xBC, 0xCA, 0x42, 0xB7, 0x6E, 0xDD,
-	0x76, 0x46, 0xA2, 0xB1, 0x87, 0x99, 0x2E, 0x40, 0x91, 0xB8, 0xC4, 0x4A,
-	0xE7, 0x15, 0xAA, 0xDF, 0x8B, 0x43, 0xBF, 0xAB, 0xC2, 0x0B, 0x01, 0x53,
-	0xBD, 0x31, 0x46, 0x1B, 0xB4, 0x3B, 0x62, 0x29, 0x72, 0x90, 0x5B, 0x82,
-	0x66, 0x10, 0x06, 0xEC, 0x83, 0x8F, 0xEE, 0xB8, 0xE3, 0x8E, 0x3B, 0xD4,
-	0x04, 0xA0, 0x84, 0x29, 0x4C, 0x35, 0x5A, 0x9C, 0x6E, 0x14, 0x03, 0x9E,
-	0x39, 0x0A, 0x7A, 0x95, 0xD2, 0x11, 0x8D, 0xE1, 0x5E, 0x9C, 0xCD, 0xB7,
-	0x3C, 0x5C, 0xC8, 0xAE, 0xC7, 0xE1, 0x06, 0xFB, 0x90, 0xD4, 0x68, 0x2E,
-	0xA0, 0x57, 0x0C, 0x37, 0xFC, 0xA8, 0x4D, 0x11, 0x37, 0x99, 0x14, 0xA8,
-	0x21, 0x6B, 0xC0, 0xD6, 0xF4, 0xEE, 0x22, 0x76, 0xE5, 0x1E, 0xE6, 0xFF,
-	0x20, 0xE7, 0xD3, 0x98, 0x2B, 0xA5, 0x36, 0x98, 0x81, 0x38, 0xEE, 0x80,
-	0xDD, 0xBC, 0x3B, 0x4D, 0x57, 0xEC, 0xD3, 0xA8, 0x74, 0xA1, 0xA1, 0x97,
-	0x09, 0x8F, 0x33, 0xD3, 0x41, 0xB0, 0x72, 0xC7, 0x93, 0x9B, 0x25, 0xDB,
-	0x82, 0x8D, 0xAD, 0x9B, 0x30, 0xE9, 0x1F, 0x56, 0xEE, 0x5C, 0xCD, 0xB5,
-	0x79, 0xCF, 0xFA, 0xBC, 0x87, 0x13, 0xE1, 0x8D, 0x37, 0xDE, 0x38, 0x0A,
-	0x76, 0xFE, 0xDE, 0x72, 0x57, 0x0C, 0x0F, 0xB9, 0x08, 0x31, 0x8B, 0x6A,
-	0x27, 0xF6, 0x1E, 0x9E, 0x80, 0x9F, 0x75, 0x8D, 0x63, 0x34, 0xEA, 0x19,
-	0x0D, 0xF9, 0xFB, 0xDC, 0x12, 0x34, 0x9C, 0xEC, 0xDB, 0xBC, 0xF1, 0xC6,
-	0x1B, 0x91, 0x9E, 0x16, 0xD2, 0xF6, 0x8A, 0x43, 0x56, 0x65, 0x5F, 0xC3,
-	0x20, 0x9F, 0xB1, 0xE7, 0x9E, 0x7B, 0x6E, 0x03, 0xB2, 0xAF, 0xF3, 0x5C,
-	0xCE, 0x0D, 0x41, 0xD0, 0x78, 0x30, 0x00, 0xD2, 0x53, 0x9E, 0x4F, 0x9F,
-	0x72, 0x6A, 0xA8, 0xF4, 0x6D, 0xE6, 0xCA, 0x83, 0x83, 0x92, 0x4B, 0x59,
-	0xE5, 0x10, 0xA6, 0x3B, 0x1D, 0xD3, 0x6A, 0x46, 0x5D, 0x21, 0x41, 0x0A,
-	0x73, 0x6A, 0xAC, 0xD8, 0x8C, 0xBA, 0x0C, 0xE1, 0xE1, 0x17, 0xE1, 0x39,
-	0xBF, 0x44, 0x3D, 0x23, 0xFC, 0x1E, 0x6E, 0x7B, 0x8F, 0x20, 0x28, 0x69,
-	0x27, 0x4E, 0x1C, 0x51, 0x1B, 0x80, 0xBA, 0x2F, 0x24, 0xE6, 0x30, 0xC3,
-	0x9F, 0x36, 0xC3, 0xD8, 0x1E, 0xD8, 0x4B, 0xCF, 0x43, 0x9E, 0x8A, 0x0B,
-	0x93, 0xB4, 0xA5, 0x31, 0x97, 0x85, 0x9B, 0xE9, 0xA6, 0x20, 0xD7, 0x7F,
-	0x40, 0x06, 0x16, 0xD2, 0x8A, 0x23, 0x49, 0x92, 0x31, 0x61, 0x83, 0x7B,
-	0xFF, 0xE8, 0xDC, 0xB9, 0x33, 0x5D, 0xEE, 0x3E, 0x6D, 0xCC, 0x78, 0x55,
-	0xF7, 0x6E, 0xB9, 0x25, 0x68, 0x6C, 0x3A, 0x9D, 0x88, 0x34, 0x92, 0x57,
-	0x47, 0x75, 0xBA, 0xFC, 0x5C, 0xA9, 0xFD, 0x69, 0x59, 0xCC, 0x7B, 0x14,
-	0x9A, 0xCA, 0x13, 0x2E, 0x70, 0x74, 0xCF, 0x51, 0x51, 0xCF, 0xC9, 0xDB,
-	0xF7, 0x48, 0x36, 0xB4, 0x1F, 0xFC, 0x7E, 0x6F, 0x02, 0x21, 0x17, 0xCE,
-	0xBC, 0x0B, 0x37, 0x01, 0xA5, 0x41, 0x15, 0x9B, 0x0E, 0xAA, 0xC3, 0x88,
-	0xDE, 0x10, 0xF4, 0x4B, 0x0E, 0xA3, 0x34, 0x49, 0xF6, 0x24, 0x69, 0x98,
-	0x13, 0x2E, 0x01, 0x51, 0xFE, 0x14, 0x17, 0x5F, 0x66, 0x4D, 0x43, 0x8E,
-	0xE3, 0x3F, 0x87, 0x27, 0xDC, 0xC4, 0x59, 0x41, 0xB1, 0x8C, 0x64, 0x81,
-	0x72, 0x10, 0x1C, 0x12, 0xFC, 0x2F, 0x44, 0x59, 0x1E, 0xD6, 0xD0, 0x4F,
-	0x8A, 0x3D, 0x95, 0xA7, 0x0D, 0x00, 0x00, 0x20, 0x00, 0x49, 0x44, 0x41,
-	0x54, 0x89, 0x8B, 0x5F, 0xDC, 0x72, 0x5C, 0xA1, 0x42, 0x8B, 0xBE, 0x0E,
-	0x5A, 0xF4, 0xD1, 0xCA, 0x01, 0xCD, 0x09, 0x9B, 0x18, 0xB2, 0xEF, 0xB8,
-	0x72, 0x89, 0x63, 0xE2, 0x62, 0x19, 0x98, 0xB5, 0x4E, 0xC0, 0x66, 0x74,
-	0x26, 0x33, 0xFC, 0xC5, 0xC5, 0xA3, 0xB6, 0xE5, 0x72, 0x4B, 0xD0, 0xFF,
-	0xC0, 0x05, 0x4D, 0x6A, 0x4B, 0xA5, 0xBF, 0xAC, 0x09, 0x40, 0xE5, 0xAE,
-	0x0D, 0xF3, 0x46, 0x50, 0xFB, 0x82, 0x76, 0xF8, 0x33, 0x22, 0xEB, 0x36,
-	0xC2, 0xC1, 0x9C, 0x1F, 0xD4, 0xB6, 0x03, 0x1A, 0xEB, 0x7D, 0x0C, 0x9D,
-	0x46, 0x48, 0xF3, 0x9A, 0x48, 0x51, 0xF9, 0x20, 0x02, 0x81, 0x56, 0xA5,
-	0x6F, 0x2B, 0x71, 0x54, 0xF2, 0x21, 0x79, 0xC9, 0xC4, 0xC9, 0x96, 0x17,
-	0x6E, 0x36, 0x86, 0x39, 0x3E, 0xF8, 0x37, 0x32, 0xC0, 0x0D, 0xC7, 0x66,
-	0xDC, 0x39, 0x70, 0xC7, 0x8A, 0x45, 0xD2, 0xF0, 0x51, 0x5F, 0x07, 0x9A,
-	0xDD, 0x6B, 0xE8, 0xF7, 0x85, 0x64, 0xA6, 0xA8, 0xA9, 0x0F, 0x64, 0x5F,
-	0x66, 0x5D, 0x4A, 0x54, 0xCF, 0xF2, 0x95, 0xFE, 0xCD, 0x5F, 0xF7, 0xEC,
-	0xD9, 0x73, 0x37, 0x24, 0x9B, 0x7F, 0xAD, 0xB1, 0xF6, 0x63, 0x29, 0xEF,
-	0x85, 0x95, 0xD4, 0xEA, 0x8F, 0x3C, 0xF2, 0xC8, 0xEB, 0x30, 0x6F, 0x2D,
-	0x56, 0xBC, 0x12, 0xD5, 0x79, 0x8B, 0x51, 0xF9, 0x6E, 0xB8, 0x02, 0x83,
-	0x7F, 0xF5, 0x0B, 0xD8, 0xDB, 0xE8, 0x5C, 0x4A, 0x5B, 0x1A, 0xEA, 0xBD,
-	0xB9, 0x24, 0x68, 0x9E, 0x16, 0xF1, 0xF6, 0xDB, 0x6F, 0x7F, 0x85, 0x4D,
-	0xAC, 0x25, 0xA3, 0x04, 0x44, 0xDA, 0x9F, 0x92, 0x8B, 0xEB, 0x54, 0x08,
-	0xFE, 0x8F, 0xA4, 0xFE, 0x4F, 0xC1, 0x86, 0xDD, 0xB5, 0xA1, 0x76, 0x7E,
-	0x1A, 0xED, 0x46, 0x30, 0x48, 0x87, 0xE3, 0x8E, 0x3B, 0x6E, 0x28, 0xEC,
-	0x88, 0x5B, 0x86, 0x1A, 0x53, 0x1C, 0xFB, 0x33, 0xDB, 0x17, 0xBA, 0x6A,
-	0x15, 0x2F, 0x95, 0xA5, 0xD1, 0xE2, 0x54, 0x9A, 0xAB, 0x41, 0xD2, 0x67,
-	0xC7, 0x4D, 0xB2, 0x84, 0x20, 0x9B, 0x7E, 0x38, 0x30, 0xE1, 0xA2, 0x38,
-	0xB9, 0x22, 0xD8, 0x06, 0xB9, 0x52, 0x86, 0x78, 0xC1, 0x54, 0x32, 0x11,
-	0xA9, 0x63, 0x4F, 0x44, 0x04, 0xDD, 0x0B, 0x69, 0xE0, 0xD8, 0x50, 0xEB,
-	0x40, 0x3E, 0x9A, 0xBB, 0x91, 0x8C, 0x7F, 0x6F, 0x05, 0xEE, 0x84, 0x98,
-	0x87, 0x1B, 0xC7, 0xD5, 0xBD, 0x1F, 0xEF, 0xC3, 0x66, 0xE3, 0x74, 0x6C,
-	0x0C, 0x2F, 0x93, 0x47, 0xDB, 0x7E, 0x2E, 0x09, 0x1A, 0x64, 0xB1, 0x13,
-	0x36, 0x8B, 0x1E, 0xC4, 0x2C, 0x3E, 0x7F, 0x94, 0xE0, 0x53, 0x88, 0x44,
-	0x04, 0x8A, 0x9A, 0xAB, 0x14, 0xB6, 0xDF, 0xB1, 0x21, 0xD4, 0x1B, 0x26,
-	0x8E, 0x71, 0x51, 0xCF, 0xC8, 0xFB, 0xF7, 0xB4, 0xF7, 0x23, 0x3D, 0xE5,
-	0x15, 0x20, 0xEB, 0xC2, 0x29, 0xD8, 0x0A, 0x64, 0x89, 0xE3, 0x27, 0x4B,
-	0xEC, 0xA8, 0xC5, 0xCA, 0x05, 0x8B, 0x7D, 0xA0, 0xA0, 0x10, 0x6A, 0xE5,
-	0x0A, 0x29, 0x86, 0x8F, 0xF4, 0x95, 0x88, 0x08, 0xBD, 0x00, 0x27, 0x87,
-	0xFF, 0x1C, 0x85, 0x37, 0xB5, 0x7B, 0xD8, 0x48, 0x07, 0xC3, 0x43, 0xA0,
-	0x4F, 0x14, 0x49, 0x4B, 0x83, 0xA6, 0x06, 0xA8, 0x60, 0xA4, 0x07, 0x70,
-	0xC1, 0xDD, 0xEF, 0x74, 0xAC, 0x9C, 0xDE, 0x89, 0xAA, 0x2B, 0xEF, 0xDF,
-	0x33, 0xAF, 0x36, 0xFA, 0xE6, 0x56, 0x24, 0xC2, 0x5A, 0x34, 0xC9, 0xE6,
-	0x60, 0x88, 0x1B, 0xBD, 0x3D, 0xB0, 0x52, 0xD9, 0xA1, 0x31, 0x47, 0x62,
-	0x56, 0x27, 0x27, 0xB9, 0x23, 0x68, 0xEE, 0x30, 0x63, 0x43, 0xE7, 0x52,
-	0x44, 0x3D, 0x9D, 0xCE, 0xCD, 0xAB, 0xA8, 0x01, 0x1A, 0x26, 0x43, 0x52,
-	0x86, 0x3B, 0x6A, 0xD1, 0xD0, 0x00, 0xBF, 0x46, 0xC6, 0xAE, 0xE6, 0x79,
-	0x1F, 0x80, 0x71, 0xDF, 0x7F, 0xFD, 0xF5, 0xD7, 0x5F, 0x1A, 0x91, 0x7B,
-	0x57, 0x23, 0x90, 0xE7, 0x20, 0x79, 0xC1, 0xC4, 0x59, 0xBD, 0xF0, 0xF9,
-	0xA1, 0x3B, 0x16, 0xED, 0x97, 0xF4, 0xC0, 0x60, 0x5F, 0xC8, 0xE7, 0x5A,
-	0x27, 0x93, 0xC3, 0xDC, 0x31, 0x0C, 0xDE, 0x1E, 0x7D, 0xE3, 0xBA, 0xE0,
-	0x41, 0x0B, 0x7E, 0x06, 0x7E, 0xBB, 0x5B, 0xD7, 0xF4, 0x0E, 0xA1, 0x5B,
-	0x25, 0x49, 0x1A, 0x24, 0x31, 0x12, 0x61, 0xDB, 0x27, 0xC4, 0xD5, 0xD6,
-	0xE3, 0xE2, 0xD3, 0x58, 0xCB, 0xA1, 0x2F, 0x9A, 0xC2, 0xAB, 0xE7, 0x5D,
-	0xF8, 0x9B, 0xAF, 0x16, 0xE6, 0xB8, 0x89, 0x4B, 0xD6, 0x4A, 0xD7, 0xCA,
-	0x3C, 0x26, 0x88, 0xD2, 0xED, 0xDB, 0x58, 0x71, 0x32, 0x41, 0x07, 0x08,
-	0xBC, 0xF6, 0xDA, 0x6B, 0x53, 0xE1, 0x12, 0xD6, 0x96, 0xF6, 0xE7, 0xA8,
-	0x50, 0x64, 0x11, 0x84, 0xB2, 0x96, 0xF1, 0x37, 0xC9, 0x01, 0xCB, 0xDB,
-	0x21, 0x08, 0xCE, 0xC8, 0x9D, 0xC0, 0x94, 0x3A, 0x40, 0x06, 0x0D, 0x1A,
-	0x74, 0x29, 0x3C, 0x3C, 0x4E, 0x87, 0xF6, 0x3B, 0x9F, 0x88, 0x57, 0x44,
-	0xAB, 0x5C, 0xC9, 0xAC, 0x23, 0x4E, 0x90, 0x0B, 0xCB, 0x69, 0x99, 0x4C,
-	0x6D, 0x1C, 0x93, 0xEF, 0x6C, 0xF8, 0xCC, 0x0E, 0x43, 0x1E, 0x94, 0x33,
-	0x10, 0x2C, 0x31, 0x33, 0x4E, 0x5B, 0x5F, 0x7A, 0xE9, 0xA5, 0x09, 0x98,
-	0x3C, 0x36, 0x27, 0xE9, 0xD3, 0x63, 0x44, 0x1B, 0x59, 0xD4, 0xF4, 0xF9,
-	0xB7, 0x8E, 0x64, 0xE2, 0x79, 0x84, 0x7C, 0x36, 0xCC, 0x35, 0xA7, 0xC5,
-	0x79, 0xAE, 0xCB, 0xFC, 0x17, 0x01, 0x44, 0xEB, 0x5E, 0x0E, 0x93, 0xD2,
-	0xE9, 0xE1, 0x18, 0xD2, 0xB8, 0x8A, 0xF2, 0x43, 0x67, 0x3F, 0x60, 0x13,
-	0xF8, 0x0F, 0x06, 0xAD, 0xB4, 0x6B, 0xD7, 0x6E, 0xED, 0xBC, 0xE1, 0x9A,
-	0x3B, 0x0D, 0x1A, 0x1A, 0xD3, 0x62, 0x08, 0x47, 0x7D, 0xAF, 0x45, 0x8B,
-	0x16, 0xCD, 0xA3, 0x72, 0x3D, 0x4B, 0x18, 0xE4, 0x6D, 0x10, 0x1E, 0xD1,
-	0x83, 0xDD, 0xE9, 0x1E, 0xD8, 0x00, 0xBB, 0x3D, 0x6F, 0x02, 0x53, 0x8E,
-	0xF7, 0x45, 0x6E, 0x8A, 0xB3, 0xE0, 0x4D, 0x31, 0x88, 0xB8, 0x72, 0x13,
-	0x88, 0x81, 0x3E, 0x5A, 0xC9, 0xD0, 0x8C, 0x20, 0x72, 0x8C, 0x1A, 0xBC,
-	0x6A, 0x8B, 0xC8, 0x5C, 0x49, 0x7A, 0xE0, 0x97, 0x7E, 0xED, 0x61, 0x87,
-	0x1D, 0x76, 0x42, 0x5C, 0x9B, 0x25, 0x0F, 0x25, 0x80, 0x9D, 0xB4, 0xA7,
-	0xD2, 0xA8, 0x6A, 0x9F, 0x81, 0xCF, 0xAF, 0x8C, 0x88, 0xFC, 0x03, 0x6D,
-	0x3E, 0x09, 0x44, 0x73, 0x5D, 0x39, 0xDE, 0x3F, 0x6F, 0xCF, 0x40, 0x56,
-	0xC2, 0x7D, 0xD1, 0x27, 0x77, 0xF2, 0xBD, 0xC3, 0x93, 0x55, 0xE2, 0xAE,
-	0xA0, 0x38, 0x71, 0xC2, 0x93, 0xE7, 0x3B, 0x8C, 0xD9, 0xE5, 0xF3, 0x86,
-	0x5D, 0xEE, 0x08, 0x1A, 0x41, 0x0A, 0x9B, 0x20, 0x31, 0xFF, 0xB3, 0x20,
-	0x85, 0x45, 0xE3, 0xB8, 0x79, 0x29, 0x92, 0x50, 0x9A, 0x36, 0x35, 0x2A,
-	0x10, 0xC2, 0x8F, 0x1B, 0x6D, 0xB4, 0x51, 0xEB, 0x8F, 0x3E, 0xFA, 0x68,
-	0x7A, 0xDE, 0x04, 0xA6, 0x5C, 0xEF, 0x0B, 0x82, 0x3E, 0x09, 0xDA, 0xE8,
-	0x20, 0x04, 0x7E, 0x14, 0xDC, 0xF0, 0x78, 0x29, 0xE4, 0x57, 0x76, 0xE6,
-	0x30, 0x7C, 0xBA, 0xBA, 0x7A, 0xE5, 0x19, 0x42, 0x0D, 0x58, 0xB9, 0x53,
-	0x48, 0xF2, 0x08, 0xE7, 0xEE, 0x0F, 0x6F, 0x8D, 0xCB, 0xE0, 0x3F, 0xFB,
-	0x47, 0x54, 0x9B, 0xE1, 0x6D, 0xB0, 0x00, 0x72, 0x66, 0x0C, 0x07, 0xA9,
-	0x1F, 0x49, 0x97, 0x3E, 0xFA, 0x3A, 0x83, 0x0C, 0xB8, 0x41, 0x39, 0x17,
-	0xCF, 0xFC, 0x01, 0xE9, 0x55, 0x0F, 0x1B, 0x37, 0x6E, 0xDC, 0xBD, 0x51,
-	0xCF, 0xF1, 0xF7, 0x55, 0x23, 0x40, 0xA5, 0x08, 0xA6, 0x21, 0x6E, 0xCA,
-	0x63, 0xD1, 0xBA, 0x58, 0xA1, 0x50, 0x5C, 0x13, 0x87, 0x9E, 0x88, 0xF2,
-	0x33, 0xF1, 0x9C, 0x0D, 0xF3, 0x66, 0xF7, 0xCF, 0x1D, 0x41, 0x1F, 0x7A,
-	0xE8, 0xA1, 0x07, 0x22, 0xDB, 0xDC, 0xCD, 0x1C, 0xD0, 0x71, 0x76, 0x91,
-	0x75, 0x62, 0x08, 0x05, 0x45, 0xA7, 0x3A, 0x63, 0xD0, 0x3F, 0x87, 0x7C,
-	0xB5, 0x3E, 0x3B, 0xAD, 0x44, 0x46, 0x3A, 0xF6, 0xD8, 0x63, 0x0F, 0x85,
-	0x1F, 0xF3, 0x35, 0x70, 0xC3, 0x6A, 0xC6, 0x89, 0x50, 0xBE, 0xD2, 0xD4,
-	0x5A, 0x39, 0x80, 0xE5, 0x39, 0x53, 0x53, 0x35, 0xD2, 0x9E, 0xE5, 0x0A,
-	0xA9, 0xD0, 0x7B, 0x92, 0x3B, 0x34, 0xDE, 0x4B, 0x60, 0xF7, 0x3E, 0x37,
-	0x6E, 0x33, 0x11, 0x70, 0xB4, 0x03, 0x7E, 0xFE, 0x84, 0x4C, 0x7D, 0x1B,
-	0x62, 0x49, 0xFD, 0x2F, 0x78, 0xFA, 0x4C, 0xC4, 0x39, 0x79, 0xE3, 0x10,
-	0xBE, 0xFD, 0x66, 0xDC, 0x67, 0xB8, 0x5C, 0xD5, 0x08, 0xC0, 0xDE, 0xFF,
-	0x5C, 0xA7, 0x4E, 0x9D, 0x3A, 0x6B, 0xD5, 0x1A, 0xD7, 0x84, 0x15, 0x2A,
-	0x51, 0xB0, 0x65, 0x77, 0x1B, 0x3B, 0x76, 0x6C, 0xA6, 0x0E, 0x17, 0xAE,
-	0xEB, 0xFE, 0xCE, 0x1D, 0x41, 0xC3, 0x06, 0x7A, 0x1E, 0xB2, 0xD7, 0x9D,
-	0x4F, 0x2D, 0x8D, 0x04, 0x1D, 0xB5, 0xCC, 0x62, 0x19, 0xD9, 0xCE, 0x78,
-	0x0F, 0x05, 0x0B, 0xA7, 0xAF, 0x0C, 0xC4, 0xC0, 0xEF, 0x5F, 0xD7, 0x9D,
-	0x93, 0x87, 0xE7, 0x63, 0xF9, 0xBB, 0x3D, 0x4C, 0x45, 0xF7, 0x82, 0x8C,
-	0x17, 0xD5, 0x12, 0x58, 0x79, 0xB9, 0x8B, 0x0F, 0x01, 0xA8, 0x0A, 0x0F,
-	0x9D, 0xC8, 0xC1, 0xEF, 0x64, 0x9A, 0x60, 0x9F, 0xD1, 0x7E, 0x4C, 0xD2,
-	0x47, 0x7F, 0x5F, 0x02, 0x6D, 0x3D, 0x36, 0x49, 0xF3, 0x39, 0xD4, 0xA8,
-	0xE3, 0x68, 0xDE, 0x79, 0xE8, 0x9F, 0x72, 0xBD, 0x23, 0xA2, 0x3E, 0x2F,
-	0xE4, 0x98, 0x09, 0xDD, 0xED, 0x94, 0x41, 0xB0, 0xA6, 0x3A, 0xE4, 0x41,
-	0xC5, 0x32, 0xE8, 0xC7, 0xD3, 0xB0, 0x32, 0xAA, 0x55, 0x88, 0x7F, 0xB9,
-	0xDE, 0x23, 0xED, 0xE7, 0xE4, 0x8E, 0xA0, 0xC7, 0x8C, 0x19, 0x73, 0x23,
-	0xDC, 0xAC, 0x7A, 0xCB, 0x64, 0x11, 0x45, 0xD0, 0xEC, 0x10, 0x0E, 0x74,
-	0x0A, 0x8A, 0x34, 0xBB, 0x03, 0x0F, 0x3C, 0x70, 0x77, 0x6C, 0x42, 0x3D,
-	0x98, 0x76, 0x67, 0x35, 0xD6, 0xFA, 0x78, 0xB6, 0x1D, 0xC2, 0xEE, 0xBF,
-	0x80, 0xAD, 0xB1, 0xA9, 0xCE, 0x83, 0xE4, 0xBB, 0xC6, 0xD1, 0xB2, 0xD8,
-	0x37, 0xF2, 0x53, 0xD6, 0x64, 0x4A, 0x62, 0x67, 0xA2, 0x1E, 0xDA, 0xB6,
-	0x61, 0xAE, 0xF8, 0x0D, 0x5E, 0x3B, 0x83, 0xE1, 0x4D, 0x90, 0x88, 0xA4,
-	0x1B, 0x2B, 0xD6, 0xF5, 0xF5, 0x5E, 0x70, 0xB7, 0xDB, 0x05, 0xDA, 0xEF,
-	0x83, 0xE8, 0xAF, 0x26, 0xEC, 0x33, 0x8E, 0xBB, 0x38, 0xFD, 0x2B, 0x39,
-	0x60, 0x9F, 0xE2, 0xE4, 0x9B, 0xEB, 0xE1, 0x1A, 0x79, 0x6C, 0x7D, 0xBD,
-	0x43, 0x7D, 0xD4, 0x9B, 0x3B, 0x82, 0x46, 0x70, 0xC9, 0x13, 0x88, 0x4A,
-	0xEA, 0xCA, 0xC1, 0xAC, 0xE3, 0xDF, 0xA3, 0x80, 0x0F, 0x07, 0x3E, 0xEC,
-	0xA4, 0x33, 0xB6, 0xDE, 0x7A, 0xEB, 0x4D, 0x11, 0xDD, 0x34, 0x39, 0xEA,
-	0x3E, 0x7F, 0x1F, 0x1F, 0x01, 0x90, 0x74, 0xB3, 0x49, 0x93, 0x26, 0xFD,
-	0xF8, 0xE5, 0x97, 0x5F, 0xCE, 0x41, 0x20, 0xD1, 0x82, 0x49, 0x6C, 0x94,
-	0x3A, 0x78, 0x96, 0x03, 0x9F, 0x1B, 0x4A, 0x3A, 0xC9, 0x83, 0xEE, 0x77,
-	0xB4, 0x79, 0x72, 0x62, 0xC5, 0xAA, 0x29, 0xB7, 0xE1, 0xC2, 0xF1, 0x7B,
-	0xA1, 0xEE, 0x4A, 0xC2, 0xBC, 0xD1, 0x16, 0xD9, 0x1E, 0x5F, 0x46, 0x76,
-	0xBB, 0xC5, 0x15, 0xB0, 0x14, 0x67, 0x0F, 0x88, 0x65, 0x74, 0x36, 0xE8,
-	0xA3, 0x8F, 0x3E, 0xFA, 0x24, 0x7C, 0xE9, 0xB7, 0xAF, 0xBB, 0x56, 0x66,
-	0xEF, 0xC9, 0xB9, 0x23, 0x68, 0x9C, 0x13, 0x38, 0x11, 0xC9, 0xE5, 0x37,
-	0x12, 0x41, 0xC7, 0x71, 0xB3, 0x23, 0x59, 0x70, 0xC6, 0xA7, 0xB0, 0x70,
-	0x37, 0x19, 0x04, 0xBD, 0x59, 0x1E, 0xF3, 0x3E, 0xD7, 0xB5, 0xF8, 0x62,
-	0x13, 0x68, 0x8D, 0xFB, 0xEE, 0xBB, 0xEF, 0x55, 0x46, 0x78, 0xD2, 0xBB,
-	0x83, 0xE4, 0x1A, 0xB5, 0xC2, 0x21, 0x21, 0xEB, 0x44, 0x1B, 0x9A, 0x35,
-	0xD8, 0x9F, 0xF2, 0x95, 0x96, 0x49, 0xAA, 0xF2, 0x30, 0x86, 0xDF, 0x10,
-	0x2C, 0x73, 0x26, 0x72, 0x4A, 0x5F, 0x53, 0xD7, 0xEF, 0xE1, 0xE7, 0xFF,
-	0x2F, 0x02, 0x30, 0x1B, 0xAD, 0x82, 0xA8, 0xCB, 0x7F, 0xE0, 0x94, 0xB4,
-	0x55, 0xA8, 0x39, 0xF3, 0x8A, 0xEA, 0x5B, 0x96, 0xE1, 0x38, 0x95, 0x77,
-	0x0D, 0xC6, 0xEE, 0xDB, 0x38, 0xFF, 0x70, 0xBD, 0x3C, 0xE1, 0x9B, 0x3B,
-	0x82, 0xFE, 0x14, 0x17, 0x4E, 0x90, 0x6E, 0xA5, 0x53, 0x3F, 0x42, 0x82,
-	0xAE, 0x8E, 0xAC, 0xA9, 0x99, 0xC9, 0x9B, 0x03, 0xC9, 0xD8, 0xA7, 0xE1,
-	0x24, 0x8E, 0x5C, 0x27, 0x11, 0xAF, 0xCB, 0x01, 0xC2, 0x53, 0xA2, 0x11,
-	0x11, 0xF8, 0x38, 0xF2, 0x77, 0xB4, 0x52, 0xE4, 0x1E, 0x57, 0x3A, 0x61,
-	0x16, 0x39, 0x9D, 0x61, 0xC7, 0xC1, 0x1B, 0x95, 0x91, 0x8E, 0x93, 0x2A,
-	0x53, 0x95, 0x32, 0xDD, 0x29, 0x48, 0x7F, 0x16, 0xD2, 0xA1, 0x1E, 0x07,
-	0x93, 0x47, 0xEE, 0x12, 0xE9, 0xD7, 0x65, 0x9F, 0xC5, 0x7D, 0x36, 0xC6,
-	0xCE, 0x7B, 0x6D, 0xDA, 0xB4, 0x59, 0x53, 0xFE, 0xEF, 0x71, 0x94, 0x23,
-	0x95, 0xA5, 0xD6, 0x8D, 0xD5, 0xD5, 0x57, 0x38, 0x14, 0xA2, 0x70, 0x44,
-	0x59, 0x5E, 0xAE, 0xDC, 0x11, 0x34, 0xCE, 0x9A, 0xFB, 0x1A, 0x83, 0x75,
-	0x45, 0x09, 0x47, 0x18, 0x49, 0x58, 0x9D, 0xC0, 0x70, 0x90, 0x8B, 0xA0,
-	0xDF, 0x7A, 0xEB, 0xAD, 0xC9, 0x48, 0xB2, 0xB4, 0x7E, 0x5E, 0x04, 0xA4,
-	0x3E, 0xDE, 0x13, 0x9A, 0xF4, 0xCA, 0xC8, 0xAD, 0xFC, 0x22, 0x48, 0xBA,
-	0x25, 0x73, 0x49, 0x63, 0x42, 0x9D, 0xB7, 0x01, 0x48, 0xD2, 0xA6, 0xC6,
-	0x2C, 0x2D, 0x39, 0x8E, 0xAF, 0x34, 0x07, 0x37, 0x09, 0x9E, 0xA9, 0x4E,
-	0x41, 0xEE, 0x73, 0x91, 0xCD, 0xEE, 0x14, 0xFC, 0x0C, 0xA9, 0x8F, 0x77,
-	0xCB, 0x73, 0x9D, 0x58, 0x75, 0xBE, 0x85, 0xA0, 0xA0, 0xF5, 0xE2, 0x98,
-	0x36, 0x84, 0x93, 0x08, 0x9A, 0xBF, 0x11, 0xBD, 0xF9, 0x0D, 0x08, 0x7A,
-	0xA5, 0x3C, 0x61, 0x98, 0x2B, 0x82, 0x46, 0xFE, 0xE1, 0x66, 0x53, 0xA6,
-	0x4C, 0xF9, 0x14, 0x9B, 0x47, 0xCB, 0x88, 0x74, 0xE3, 0x12, 0xB4, 0x76,
-	0x93, 0x5F, 0x78, 0xE1, 0x85, 0xE7, 0x91, 0x11, 0x6D, 0xCB, 0x3C, 0x09,
-	0x49, 0x7D, 0xBC, 0x2B, 0x93, 0xFF, 0x23, 0x13, 0xDA, 0xC4, 0xD5, 0x57,
-	0x5F, 0xBD, 0x15, 0xA3, 0x04, 0x75, 0x46, 0xA1, 0xB4, 0x69, 0x6E, 0x26,
-	0x6A, 0xB3, 0xA9, 0xA6, 0xF6, 0x85, 0xA7, 0x78, 0xD0, 0x1C, 0xC2, 0x13,
-	0x3E, 0x40, 0xEE, 0xB3, 0x90, 0x60, 0xE9, 0x62, 0x98, 0x3C, 0xCE, 0xAF,
-	0x8F, 0x77, 0xCB, 0x6B, 0x9D, 0xCF, 0x3F, 0xFF, 0xFC, 0x0B, 0x38, 0xBF,
-	0xB2, 0x53, 0x92, 0xF7, 0x17, 0x41, 0x73, 0xFC, 0x41, 0xB9, 0xFA, 0x16,
-	0x26, 0x92, 0x15, 0x92, 0xDC, 0xDF, 0xD0, 0xCB, 0xE6, 0x8A, 0xA0, 0xA1,
-	0x89, 0x2D, 0x86, 0x64, 0x3A, 0x9F, 0x30, 0x33, 0x96, 0xEC, 0x5B, 0x51,
-	0x04, 0x1D, 0x6A, 0xCF, 0xD4, 0xB0, 0x91, 0x98, 0xFF, 0x09, 0xA4, 0x18,
-	0xCD, 0xED, 0x09, 0x0F, 0x69, 0x0A, 0x3C, 0x83, 0x8A, 0xB0, 0x73, 0xFF,
-	0x08, 0xE6, 0xD3, 0x65, 0x49, 0xC8, 0x58, 0xE2, 0x16, 0x02, 0x48, 0xA8,
-	0x11, 0xF3, 0x27, 0xEA, 0x40, 0x5F, 0xB5, 0x55, 0x5E, 0x1E, 0x1C, 0xEC,
-	0xD4, 0xC8, 0x79, 0x2A, 0x0A, 0x3E, 0x9B, 0x81, 0xFC, 0x0E, 0x83, 0xCE,
-	0x39, 0xE7, 0x1C, 0x27, 0xD9, 0x4F, 0xA9, 0x53, 0xB1, 0xC9, 0xF7, 0x38,
-	0xFA, 0x74, 0x7B, 0x8E, 0x23, 0x29, 0x3C, 0x51, 0x66, 0x8E, 0x30, 0x56,
-	0x01, 0x04, 0xFD, 0x1D, 0xF2, 0xB8, 0xAF, 0x04, 0x0F, 0xAA, 0xD9, 0x29,
-	0x35, 0xB9, 0xDE, 0xAB, 0xC9, 0x15, 0x41, 0x33, 0x8B, 0x19, 0xF2, 0xE9,
-	0x7C, 0x8E, 0x24, 0x47, 0x85, 0x90, 0xD1, 0xD0, 0xC7, 0x92, 0xFF, 0x57,
-	0x25, 0x2C, 0xC5, 0x9A, 0x36, 0xBD, 0x40, 0x76, 0xDA, 0x69, 0x27, 0x13,
-	0x74, 0x4A, 0xA2, 0x0B, 0x9B, 0xF4, 0xC6, 0x38, 0x2D, 0xFD, 0x71, 0x10,
-	0xF2, 0xD2, 0xC8, 0x88, 0x56, 0xB0, 0x27, 0xD3, 0x54, 0x41, 0x8D, 0x3A,
-	0x4E, 0xA0, 0x11, 0x9B, 0x19, 0x9E, 0x19, 0x28, 0x72, 0xA7, 0xED, 0x1A,
-	0xFD, 0x3D, 0x77, 0xC0, 0x80, 0x01, 0xE7, 0x62, 0x73, 0xF1, 0x8A, 0xB8,
-	0x09, 0x96, 0x52, 0x7A, 0xED, 0x46, 0x59, 0x0D, 0x08, 0xFA, 0x31, 0x10,
-	0xF4, 0x0E, 0xA5, 0x10, 0xF4, 0x88, 0x11, 0x23, 0x9A, 0xE7, 0xA9, 0xAF,
-	0x72, 0x45, 0xD0, 0x94, 0x7A, 0x1C, 0x5F, 0xF4, 0x15, 0x34, 0xE9, 0x95,
-	0xA4, 0x39, 0x87, 0x24, 0x5D, 0x93, 0x0D, 0x5A, 0xDF, 0xC1, 0xC4, 0x31,
-	0x01, 0x47, 0xF0, 0x6C, 0xD1, 0x28, 0x47, 0x50, 0x46, 0x5F, 0x6A, 0xAB,
-	0xAD, 0xB6, 0x6A, 0x87, 0xBC, 0xC2, 0x13, 0x60, 0x9E, 0x28, 0x1C, 0xBD,
-	0xCE, 0x5D, 0x7D, 0x6A, 0xD4, 0x71, 0x5C, 0xF1, 0x64, 0xE2, 0x60, 0x3F,
-	0x2B, 0xBD, 0xA9, 0xB2, 0xE9, 0x91, 0xA4, 0xF9, 0x39, 0xEC, 0xD1, 0x17,
-	0x21, 0xD2, 0xED, 0x92, 0x67, 0x9E, 0x79, 0x66, 0x46, 0x46, 0x21, 0x68,
-	0x14, 0xCD, 0xC2, 0x19, 0x19, 0xCF, 0x23, 0x02, 0x37, 0xD1, 0xD8, 0x09,
-	0x73, 0x88, 0x63, 0xEC, 0x7E, 0x7B, 0xE2, 0x89, 0x27, 0x36, 0xB7, 0x06,
-	0xDD, 0x28, 0xC4, 0xA1, 0xEA, 0x97, 0x40, 0x27, 0x7F, 0x89, 0x4D, 0xC2,
-	0xE6, 0x3A, 0x91, 0x39, 0x2E, 0x41, 0x4B, 0xC3, 0x9E, 0x3C, 0x79, 0xF2,
-	0x3B, 0xD8, 0xE8, 0x68, 0xD7, 0x88, 0x21, 0xCA, 0xE4, 0xAB, 0x81, 0xA4,
-	0x3B, 0x40, 0x93, 0x1E, 0x8F, 0xFE, 0x5A, 0x8C, 0xC7, 0x5F, 0xD1, 0x45,
-	0x2B, 0xF4, 0xEC, 0xA8, 0xA9, 0xD1, 0x74, 0xD9, 0x63, 0x7F, 0xF3, 0x98,
-	0xA5, 0x30, 0xE8, 0x88, 0x83, 0x9F, 0xFD, 0xCF, 0x67, 0xC1, 0x26, 0xFD,
-	0x67, 0x66, 0x5C, 0xCB, 0xE4, 0xCB, 0x37, 0x92, 0x46, 0x61, 0x93, 0xF0,
-	0x4D, 0x8C, 0x9D, 0xF5, 0x93, 0x6C, 0x12, 0x86, 0x91, 0xA2, 0x30, 0x71,
-	0xFC, 0x13, 0x26, 0xAE, 0x95, 0xB8, 0xF2, 0x69, 0x24, 0x90, 0x44, 0xBE,
-	0x46, 0xEE, 0x34, 0x68, 0x1C, 0x32, 0x5A, 0x20, 0xE8, 0xAA, 0xB4, 0xE5,
-	0xEA, 0x4C, 0x1C, 0x22, 0x71, 0x0E, 0x72, 0xB8, 0x0A, 0x7D, 0x86, 0x0D,
-	0xAC, 0x55, 0x22, 0x91, 0x75, 0x81, 0xB2, 0x23, 0xB0, 0xEB, 0xAE, 0xBB,
-	0x76, 0x44, 0xE6, 0xB9, 0x67, 0xA0, 0x3D, 0x2F, 0xCC, 0xE3, 0xAA, 0x68,
-	0xF2, 0x88, 0xB2, 0x61, 0x86, 0xC9, 0xAE, 0xF8, 0xB7, 0x8E, 0xDC, 0xE2,
-	0x7D, 0xD4, 0xC4, 0xF9, 0x99, 0xFC, 0xA7, 0x91, 0x71, 0xED, 0xB6, 0x07,
-	0x1F, 0x7C, 0xB0, 0x77, 0xDC, 0x54, 0xA5, 0x65, 0x7F, 0xC1, 0x46, 0xFE,
-	0x40, 0x24, 0x17, 0x7B, 0xA7, 0x75, 0xEB, 0xD6, 0x6B, 0x27, 0x71, 0xB3,
-	0x13, 0x41, 0xF3, 0x1E, 0xEC, 0x41, 0x7C, 0xB3, 0xCA, 0x2A, 0xAB, 0xD8,
-	0x8B, 0xA3, 0x31, 0xCB, 0xC9, 0xEB, 0xAF, 0xBF, 0xFE, 0xDA, 0x86, 0x1B,
-	0x6E, 0xD8, 0x81, 0xA4, 0x1B, 0xC7, 0x8F, 0x96, 0x58, 0x28, 0x69, 0x38,
-	0xED, 0x9E, 0x70, 0xA3, 0xFE, 0xBC, 0x7B, 0xF7, 0xEE, 0x5B, 0xC0, 0x69,
-	0xFE, 0xB3, 0xC6, 0x8C, 0x53, 0x56, 0xDF, 0x6D, 0xEF, 0xBD, 0xF7, 0xDE,
-	0xF1, 0xEF, 0x7F, 0xFF, 0xFB, 0x7D, 0x98, 0x2C, 0x17, 0xA2, 0x06, 0x4D,
-	0xED, 0x57, 0x04, 0x2B, 0x8D, 0x3A, 0xCE, 0x61, 0xA4, 0x7A, 0x3F, 0xF9,
-	0xB8, 0xCB, 0x23, 0x04, 0x59, 0xEB, 0xEE, 0x46, 0xDE, 0x88, 0x63, 0xB1,
-	0x52, 0xFA, 0x26, 0xAB, 0x18, 0x34, 0xC4, 0x76, 0x21, 0x3A, 0x74, 0x19,
-	0xE4, 0x37, 0x79, 0x0B, 0xFB, 0x3F, 0x05, 0x3F, 0xE6, 0xB8, 0xAB, 0x1F,
-	0x11, 0x34, 0x27, 0x54, 0x8C, 0xDD, 0xF7, 0x3B, 0x74, 0xE8, 0xB0, 0x56,
-	0x43, 0x7C, 0xFF, 0xDA, 0xB6, 0x39, 0x77, 0x1A, 0xF4, 0x13, 0x4F, 0x3C,
-	0xF1, 0x38, 0x22, 0x01, 0x0B, 0x3B, 0xC9, 0xBC, 0xA2, 0xFC, 0x68, 0xB5,
-	0x1C, 0xD3, 0xA0, 0xE7, 0x09, 0xD2, 0xD8, 0x24, 0xDC, 0x0C, 0xA1, 0xDE,
-	0xEF, 0xD6, 0x16, 0x74, 0xDF, 0x57, 0x1A, 0x02, 0x7B, 0xEC, 0xB1, 0xC7,
-	0x76, 0x48, 0x19, 0xFB, 0x30, 0xFC, 0xA1, 0x17, 0xE4, 0x93, 0xE8, 0x13,
-	0xAD, 0xCC, 0x77, 0x0A, 0x5C, 0x81, 0x29, 0xAB, 0x10, 0x9C, 0x12, 0x15,
-	0xC8, 0x42, 0x8D, 0x9A, 0xB2, 0xC0, 0x72, 0x58, 0x5D, 0x55, 0x80, 0x40,
-	0x2A, 0x60, 0x8B, 0x7E, 0x09, 0xD6, 0x8E, 0xED, 0x40, 0x28, 0xBF, 0x96,
-	0xD6, 0x52, 0xDF, 0x2D, 0x04, 0x36, 0xDD, 0x74, 0xD3, 0x56, 0xE3, 0xC7,
-	0x8F, 0x7F, 0x0F, 0x93, 0xE9, 0xC2, 0x5C, 0x89, 0xC6, 0x9D, 0x44, 0x95,
-	0x66, 0x81, 0xE3, 0x10, 0x99, 0x05, 0x27, 0xE0, 0xA8, 0xB2, 0x44, 0x36,
-	0xEC, 0x86, 0xDE, 0x03, 0xB9, 0x23, 0x68, 0xB8, 0x6D, 0x8D, 0x44, 0x06,
-	0xB5, 0xC3, 0x98, 0xF6, 0x50, 0x76, 0xE8, 0x9A, 0x3A, 0x51, 0x09, 0x5D,
-	0x34, 0x93, 0x53, 0x60, 0xE0, 0x0D, 0xB2, 0x13, 0x36, 0xAD, 0x1E, 0x6B,
-	0xE8, 0x9D, 0xDF, 0x90, 0xDB, 0x8F, 0x63, 0xA7, 0x8E, 0x86, 0xCB, 0xD5,
-	0x95, 0xF4, 0x6D, 0x0F, 0xCF, 0x36, 0xA4, 0xC7, 0x86, 0x32, 0xD9, 0xC9,
-	0xEF, 0xB9, 0xA6, 0xF7, 0x64, 0xBF, 0xF2, 0xD2, 0x99, 0x87, 0xFC, 0x4D,
-	0x32, 0x98, 0x3A, 0x75, 0xEA, 0x1B, 0x78, 0x7E, 0x4F, 0x90, 0xCA, 0xD4,
-	0x86, 0x8C, 0x53, 0x56, 0xDA, 0xBE, 0xFB, 0xEE, 0xBB, 0x6F, 0x73, 0xFF,
-	0xFD, 0xF7, 0x3F, 0x85, 0xFE, 0x69, 0xC2, 0xFE, 0x89, 0x4B, 0xD2, 0xCA,
-	0x7E, 0x57, 0x79, 0xDC, 0xD8, 0xAD, 0x07, 0x1F, 0x7C, 0x70, 0xAF, 0xAC,
-	0xBC, 0x53, 0x1A, 0xED, 0xC8, 0x1D, 0x41, 0x63, 0xC3, 0xFE, 0x5C, 0x24,
-	0xCE, 0x19, 0xA8, 0x83, 0x4B, 0xA3, 0x40, 0xE6, 0x80, 0x95, 0x16, 0x26,
-	0xAD, 0x1B, 0x07, 0x86, 0x9E, 0x87, 0xD4, 0x89, 0xF6, 0x9F, 0x8D, 0x02,
-	0x2F, 0xE6, 0xF7, 0x98, 0xF0, 0xE6, 0xAF, 0xCD, 0xCE, 0x3C, 0xCE, 0xA8,
-	0x3B, 0x1C, 0x39, 0x9F, 0xAF, 0x05, 0xC9, 0x2E, 0xC8, 0xBC, 0x1D, 0x3A,
-	0x9E, 0x8A, 0x83, 0x9A, 0xE4, 0xAC, 0xE4, 0xF0, 0x51, 0xCD, 0x50, 0x54,
-	0x22, 0xEF, 0xE3, 0xD2, 0xBB, 0xD2, 0x59, 0xA4, 0x02, 0x7B, 0x5A, 0xEF,
-	0x43, 0x93, 0x3E, 0x04, 0xBE, 0xEF, 0x3E, 0xB9, 0x3B, 0x0A, 0xC4, 0x88,
-	0xEF, 0x99, 0xF2, 0x15, 0x63, 0x6F, 0x20, 0x27, 0x53, 0x2A, 0x47, 0xF2,
-	0xA4, 0x89, 0xCA, 0xC7, 0xA1, 0x15, 0x2C, 0xC7, 0x21, 0xF2, 0xA8, 0x0C,
-	0xC4, 0x73, 0x72, 0x95, 0xE6, 0x37, 0x77, 0x04, 0x8D, 0x19, 0xF8, 0x40,
-	0xE4, 0x7A, 0xB8, 0x11, 0x41, 0x0E, 0x91, 0x27, 0x7A, 0x53, 0xE6, 0x28,
-	0x20, 0xDA, 0x58, 0xE2, 0xFF, 0xD4, 0xD0, 0x70, 0x8E, 0x1D, 0x0F, 0x1B,
-	0xDD, 0xB6, 0x44, 0x99, 0xCD, 0xFD, 0xED, 0x30, 0x15, 0x6D, 0xD4, 0xAB,
-	0x57, 0xAF, 0xE3, 0xB0, 0xF1, 0xB3, 0x01, 0x42, 0x78, 0x5B, 0x62, 0x97,
-	0x7E, 0x1A, 0x42, 0xBC, 0xAF, 0xC7, 0xCF, 0xCD, 0x71, 0xC1, 0xC1, 0xC9,
-	0xEA, 0x7B, 0xE3, 0xAC, 0xC0, 0xBF, 0x23, 0xBD, 0xE8, 0x7C, 0xF4, 0x8F,
-	0xA6, 0x5B, 0x1D, 0xBD, 0x3C, 0xE4, 0x82, 0x17, 0xB5, 0x89, 0xC8, 0x7A,
-	0xB4, 0x69, 0x45, 0x6F, 0x0F, 0x65, 0xC2, 0x53, 0x50, 0x0C, 0xCC, 0x1E,
-	0xFF, 0xA4, 0x49, 0x85, 0x89, 0x7A, 0xE2, 0xB6, 0xC9, 0xE5, 0xFE, 0x17,
-	0x01, 0x1C, 0x7A, 0xF0, 0x14, 0x7C, 0xDA, 0xB7, 0xD5, 0xBE, 0x4F, 0xDC,
-	0x64, 0x65, 0xEA, 0x1B, 0x8E, 0x41, 0xB8, 0xD8, 0x1D, 0x8A, 0xE0, 0xA2,
-	0x1B, 0xF3, 0x84, 0x6F, 0xEE, 0x08, 0x1A, 0x7E, 0x98, 0x1D, 0x91, 0x31,
-	0xED, 0x49, 0x44, 0x13, 0x36, 0x8B, 0xEB, 0xEE, 0xA3, 0x74, 0x87, 0x14,
-	0x0C, 0x6A, 0x66, 0xD0, 0xB8, 0x7E, 0x44, 0xB8, 0xF7, 0x2A, 0x88, 0x4A,
-	0xFC, 0x39, 0x4F, 0xC2, 0x52, 0xCE, 0x77, 0xC5, 0xE9, 0xDE, 0xDD, 0x70,
-	0xF0, 0xC1, 0x08, 0x78, 0x62, 0x2C, 0xC7, 0x25, 0x2F, 0x4E, 0x30, 0x29,
-	0xE4, 0x6F, 0xA6, 0x2D, 0x19, 0x59, 0xCF, 0x1E, 0xC2, 0x77, 0xA7, 0xC5,
-	0x35, 0x2F, 0x1C, 0x74, 0xD0, 0x41, 0xBB, 0x8E, 0x1E, 0x3D, 0xFA, 0x01,
-	0x90, 0x74, 0x93, 0xCA, 0x7C, 0x1B, 0x05, 0x0D, 0x8D, 0x3F, 0x51, 0x7B,
-	0x0C, 0x32, 0x61, 0x29, 0x98, 0x85, 0xBF, 0xA9, 0xE5, 0x41, 0x3E, 0x18,
-	0x5A, 0x5C, 0x88, 0x3A, 0x44, 0xFF, 0xCF, 0xC6, 0xC4, 0xBE, 0x1F, 0xB4,
-	0xFC, 0xBB, 0xCB, 0x89, 0x41, 0x5E, 0x9E, 0xD5, 0xB6, 0x6D, 0xDB, 0x65,
-	0x61, 0x3F, 0xFE, 0x00, 0x7D, 0xB3, 0x94, 0x92, 0x94, 0xC5, 0xF1, 0x61,
-	0x0F, 0x27, 0x4F, 0x8C, 0xBB, 0xDF, 0x71, 0x6E, 0xE4, 0xB6, 0x20, 0xFA,
-	0x09, 0x79, 0xC1, 0x8D, 0xEF, 0x99, 0x3B, 0x82, 0x46, 0xA2, 0xA3, 0xA5,
-	0x40, 0x00, 0x53, 0x60, 0xBB, 0x6C, 0xAE, 0xDD, 0xFF, 0xA8, 0x0E, 0x0F,
-	0xF3, 0xD7, 0xCA, 0xA3, 0x03, 0xA4, 0xB0, 0x0F, 0x36, 0xAA, 0x3C, 0x60,
-	0xA3, 0xC0, 0xAB, 0xE2, 0x7B, 0x2C, 0x53, 0xCF, 0x44, 0x56, 0xB9, 0x41,
-	0xB0, 0x43, 0x16, 0xE4, 0x2F, 0x8C, 0xF4, 0x53, 0x60, 0x09, 0xC8, 0x79,
-	0xD2, 0x09, 0x27, 0x9C, 0xD0, 0x05, 0x66, 0x86, 0x5F, 0xE2, 0x54, 0x81,
-	0xCD, 0xA3, 0x4D, 0x91, 0x6F, 0xF8, 0x25, 0x2C, 0x99, 0x9B, 0xD0, 0x64,
-	0xC1, 0xA5, 0x73, 0x65, 0xB4, 0x60, 0x8D, 0xB7, 0x2B, 0xDF, 0x30, 0xCB,
-	0xCB, 0x9C, 0x25, 0x53, 0x07, 0x27, 0x0C, 0xD9, 0xA8, 0xF1, 0xAC, 0xB9,
-	0xC8, 0xDD, 0xD1, 0x1F, 0x47, 0x74, 0x5D, 0x1C, 0xA7, 0x3D, 0x2E, 0xF3,
-	0x5F, 0x04, 0x70, 0xC0, 0xF2, 0x01, 0x88, 0x00, 0xBC, 0x25, 0xDC, 0x98,
-	0x0F, 0x57, 0xA5, 0x35, 0x61, 0xA5, 0x15, 0x2C, 0x26, 0xF0, 0xEF, 0xD0,
-	0xC7, 0xAB, 0xE5, 0x4D, 0x29, 0xCA, 0x1D, 0x41, 0x53, 0x18, 0x90, 0x91,
-	0x6E, 0x2A, 0x96, 0xD4, 0x6D, 0x69, 0xA3, 0x8C, 0x5A, 0x02, 0x87, 0xBB,
-	0xC8, 0x14, 0x16, 0xD9, 0xA3, 0x11, 0xD7, 0x70, 0x05, 0xEC, 0x93, 0x67,
-	0x78, 0x20, 0xC6, 0x47, 0x00, 0xF8, 0x35, 0x19, 0x3E, 0x7C, 0xF8, 0x35,
-	0x30, 0x4B, 0x1C, 0x43, 0x13, 0x13, 0xC9, 0x58, 0xC7, 0x5A, 0x31, 0x88,
-	0x84, 0x58, 0x2B, 0x57, 0x30, 0xB1, 0x7E, 0xEF, 0xBD, 0xF7, 0xDE, 0xC6,
-	0x84, 0x1A, 0x3B, 0xFF, 0x2F, 0x4E, 0xBA, 0xD9, 0x66, 0xC8, 0x90, 0x21,
-	0xF7, 0x43, 0x2B, 0x5F, 0x8C, 0xCF, 0x8A, 0x93, 0x4C, 0x49, 0x93, 0x2F,
-	0x27, 0x09, 0xCA, 0x82, 0xCE, 0xCC, 0x0B, 0x73, 0x45, 0x68, 0xA5, 0xC5,
-	0x43, 0x64, 0xAF, 0xBB, 0xEE, 0xBA, 0x2B, 0xB0, 0x87, 0x71, 0x56, 0x9E,
-	0x82, 0x25, 0xE2, 0xF7, 0x70, 0xD5, 0x25, 0xB1, 0x1A, 0xBA, 0xBA, 0x6F,
-	0xDF, 0xBE, 0x27, 0xF2, 0x5B, 0x79, 0xCD, 0x10, 0xEB, 0x38, 0x9B, 0xF4,
-	0xBC, 0x87, 0xFB, 0x02, 0x9F, 0x7D, 0xF6, 0xD9, 0xB4, 0x75, 0xD6, 0x59,
-	0x27, 0x77, 0x69, 0x7E, 0x73, 0x47, 0xD0, 0xDC, 0x90, 0x82, 0x99, 0xE3,
-	0xCA, 0x63, 0x8E, 0x39, 0xE6, 0x24, 0x76, 0x7E, 0xB8, 0x49, 0x51, 0x53,
-	0x2E, 0x0E, 0x96, 0xD5, 0x91, 0x57, 0xBC, 0xE7, 0x63, 0x5C, 0x48, 0x87,
-	0xD9, 0xA6, 0x54, 0xE1, 0xCD, 0xCB, 0xFD, 0x3C, 0xD9, 0x19, 0x66, 0x8D,
-	0xAB, 0x8E, 0x3A, 0xEA, 0xA8, 0x23, 0x89, 0x33, 0x8F, 0xA4, 0xA2, 0x39,
-	0x22, 0xEA, 0x82, 0xBD, 0xFF, 0x35, 0x9C, 0xFE, 0xDD, 0x25, 0xAE, 0xCB,
-	0x5B, 0xB7, 0x6E, 0xDD, 0xB6, 0xBB, 0xE6, 0x9A, 0x6B, 0x6E, 0x6A, 0xDE,
-	0xBC, 0xF9, 0xCA, 0x32, 0x73, 0xD0, 0x44, 0x45, 0x22, 0xD6, 0xC6, 0x30,
-	0x3F, 0xA7, 0xBD, 0x99, 0x93, 0x42, 0x98, 0x2C, 0xAB, 0xAA, 0xB6, 0x48,
-	0xBB, 0xE7, 0x69, 0xDF, 0xB4, 0x4F, 0xF3, 0x5E, 0xD8, 0x41, 0xFF, 0x0A,
-	0xF9, 0x39, 0x1A, 0x7F, 0xCF, 0x89, 0x6A, 0xBF, 0xBF, 0xAF, 0xA0, 0xFB,
-	0xE2, 0xE7, 0xD8, 0x78, 0x6D, 0x49, 0xEC, 0xB8, 0x6A, 0x95, 0xC9, 0x50,
-	0xF6, 0xE5, 0x9A, 0x30, 0x92, 0x9F, 0x3A, 0x30, 0x1F, 0x86, 0x15, 0xD5,
-	0x09, 0x79, 0xC3, 0x33, 0x77, 0x04, 0xCD, 0x0E, 0xC6, 0xC9, 0xCD, 0xBB,
-	0xC1, 0x9E, 0x78, 0x0F, 0x84, 0xA5, 0x69, 0x9C, 0x50, 0x6F, 0x09, 0x45,
-	0xB8, 0x61, 0x08, 0x82, 0xF9, 0xFD, 0xE8, 0xA3, 0x8F, 0xDE, 0x1F, 0xC7,
-	0xC9, 0xE7, 0xEA, 0x94, 0xE1, 0xDA, 0x0C, 0x10, 0x9C, 0x92, 0xBD, 0x1C,
-	0x76, 0xE0, 0x47, 0x22, 0x12, 0x70, 0x4F, 0xF8, 0x91, 0x17, 0x6C, 0xCD,
-	0x5C, 0x89, 0xC4, 0x21, 0x69, 0x96, 0xF9, 0xE2, 0x8B, 0x2F, 0xDE, 0x58,
-	0x6F, 0xBD, 0xF5, 0xDA, 0xC7, 0xAD, 0x1B, 0x13, 0xF0, 0x5A, 0x70, 0xE9,
-	0x7A, 0x1E, 0xA4, 0xB0, 0x9C, 0x4E, 0xF9, 0x96, 0x46, 0x2D, 0x0D, 0x8E,
-	0x44, 0xC1, 0xBF, 0xA3, 0x32, 0xE2, 0xB1, 0xCF, 0xF5, 0x0C, 0xD6, 0xAF,
-	0x8D, 0x44, 0xA4, 0xCE, 0x7C, 0x1D, 0x2B, 0x81, 0xAD, 0xF2, 0xB6, 0xE4,
-	0x8E, 0xDB, 0x07, 0x2A, 0x07, 0x97, 0xD6, 0x3D, 0x70, 0x28, 0xF0, 0x58,
-	0x28, 0x35, 0xCD, 0x74, 0x98, 0xAF, 0x56, 0x2D, 0x71, 0x08, 0x9A, 0xCF,
-	0x41, 0xF9, 0x59, 0x50, 0xAC, 0x76, 0xCB, 0xA3, 0x6B, 0x6B, 0x2E, 0x09,
-	0x1A, 0x27, 0xA2, 0x2C, 0x8E, 0xC4, 0x2D, 0x1F, 0x21, 0x69, 0xD2, 0x72,
-	0x49, 0x08, 0x3A, 0x5C, 0x36, 0xF3, 0x3E, 0x90, 0xC0, 0x7D, 0xD8, 0xB8,
-	0xD8, 0x2B, 0xA9, 0xD0, 0xE6, 0xA9, 0x3C, 0x72, 0x68, 0xAC, 0x0F, 0x7B,
-	0xF3, 0x08, 0x68, 0xD0, 0x9B, 0x87, 0xB9, 0x7D, 0x49, 0xBC, 0xDC, 0x88,
-	0x8B, 0x7B, 0xDD, 0x8A, 0x0B, 0x1E, 0x1F, 0xB1, 0x7D, 0x60, 0x99, 0x60,
-	0x09, 0xDE, 0x3A, 0xF7, 0x60, 0x83, 0x6A, 0x2D, 0xDA, 0x96, 0x75, 0x34,
-	0x16, 0x4D, 0x18, 0xD4, 0xE0, 0x48, 0xBA, 0xDC, 0x00, 0x8C, 0x73, 0x31,
-	0x45, 0x29, 0x03, 0x58, 0x44, 0xD0, 0x3C, 0x30, 0x80, 0xAB, 0x29, 0x78,
-	0x76, 0x4C, 0x39, 0xF7, 0xDC, 0x73, 0x7B, 0x21, 0xC3, 0xE1, 0xEB, 0x71,
-	0x9E, 0x93, 0xC7, 0x32, 0xD8, 0xEF, 0xB9, 0x0B, 0x0A, 0x51, 0x37, 0xBE,
-	0x3B, 0x27, 0x44, 0xE2, 0x16, 0xAE, 0x54, 0xA3, 0x4C, 0x8C, 0x94, 0x19,
-	0x4C, 0xEA, 0xDF, 0x62, 0xAC, 0xE6, 0x2A, 0x0F, 0xB4, 0x64, 0x25, 0x97,
-	0x04, 0xCD, 0x97, 0x7F, 0xEA, 0xA9, 0xA7, 0x9E, 0x45, 0x56, 0xBA, 0xAD,
-	0xE2, 0x98, 0x38, 0xE4, 0xB3, 0xC9, 0xFB, 0xB4, 0x24, 0xAE, 0x3C, 0x39,
-	0xFA, 0x17, 0x38, 0xE0, 0x77, 0x84, 0x36, 0x65, 0x17, 0xAC, 0x22, 0xF6,
-	0xA1, 0xBD, 0x19, 0x11, 0x9B, 0xED, 0x71, 0xBC, 0xD4, 0x68, 0x9C, 0x01,
-	0x59, 0xB0, 0x23, 0x8B, 0x24, 0x95, 0xB0, 0x28, 0x2A, 0xCA, 0x8F, 0xF7,
-	0xD0, 0xFE, 0x48, 0x2D, 0x97, 0x36, 0x5F, 0x62, 0x8D, 0x24, 0xFE, 0xAF,
-	0xC4, 0x25, 0x3A, 0x9C, 0x83, 0xB7, 0x3A, 0xB4, 0xB7, 0xFB, 0x91, 0x60,
-	0xA7, 0x1D, 0x27, 0x03, 0x12, 0x33, 0xFB, 0x4D, 0x89, 0x96, 0x48, 0xB4,
-	0x51, 0x26, 0x8E, 0x70, 0x39, 0x4E, 0x52, 0x67, 0xFE, 0x0F, 0x12, 0x3E,
-	0xEF, 0x63, 0xFB, 0x91, 0x9B, 0xE5, 0x4B, 0x84, 0x86, 0x9F, 0x89, 0x00,
-	0xA8, 0x31, 0x71, 0xDB, 0x95, 0x97, 0x72, 0x9B, 0x6F, 0xBE, 0x79, 0x6B,
-	0xE4, 0x36, 0x79, 0x13, 0xD8, 0x2F, 0xCE, 0x77, 0x0E, 0xFB, 0x3D, 0xCC,
-	0x91, 0x52, 0x13, 0x1E, 0xEC, 0x7F, 0x44, 0xED, 0x3E, 0x07, 0x0F, 0xBD,
-	0x2E, 0x79, 0xC1, 0x2D, 0x7C, 0xCF, 0x5C, 0x12, 0x34, 0xC8, 0x63, 0x3E,
-	0x6C, 0xF4, 0xF4, 0xC1, 0xE6, 0xC5, 0x35, 0x51, 0x1A, 0xB4, 0x36, 0x88,
-	0x68, 0x8B, 0xE4, 0xC0, 0xA6, 0x06, 0x40, 0xE1, 0xA2, 0x36, 0xCD, 0xFF,
-	0xE1, 0x83, 0x9B, 0xBB, 0xA3, 0xE0, 0xE3, 0x0C, 0x14, 0x28, 0xBB, 0xDD,
-	0xAE, 0xBD, 0xF6, 0xDA, 0x9B, 0xE1, 0x93, 0xDC, 0x4C, 0x66, 0x8D, 0x90,
-	0xA4, 0x95, 0xCB, 0x39, 0x4A, 0x83, 0x0A, 0x42, 0xEC, 0xE7, 0x3E, 0xF4,
-	0xD0, 0x43, 0x37, 0xC3, 0x7B, 0xA6, 0x77, 0x9C, 0xFA, 0x55, 0x86, 0xE6,
-	0x15, 0x68, 0xB8, 0xAF, 0xC0, 0xD7, 0xBA, 0x35, 0x73, 0x49, 0x33, 0x08,
-	0x45, 0xC9, 0xFE, 0x39, 0x61, 0xD0, 0x0E, 0x5D, 0xD3, 0x15, 0xE6, 0x82,
-	0x08, 0x23, 0x16, 0x8B, 0x4C, 0x1F, 0xB3, 0x41, 0xD2, 0xE7, 0xC3, 0x3B,
-	0x65, 0x60, 0x92, 0xB6, 0x35, 0xF6, 0xB2, 0x58, 0xC1, 0x0C, 0xC6, 0x9E,
-	0xC3, 0xC9, 0xA1, 0xBD, 0x5F, 0xC4, 0xAC, 0x71, 0x15, 0xD5, 0xFF, 0x2C,
-	0x7F, 0xC6, 0x19, 0x67, 0x9C, 0x82, 0x89, 0x7E, 0x70, 0x63, 0xC7, 0xAB,
-	0xAA, 0xF7, 0xCB, 0x25, 0x41, 0x13, 0x08, 0xE6, 0x06, 0x40, 0x6E, 0xE7,
-	0x8F, 0x40, 0xB8, 0x4D, 0xE7, 0x2D, 0x27, 0x2A, 0xF3, 0x73, 0x84, 0x40,
-	0x05, 0x3B, 0xF8, 0x85, 0x4D, 0x26, 0x69, 0x02, 0xCA, 0x49, 0x0C, 0x97,
-	0xAE, 0x19, 0x48, 0xE0, 0xD3, 0x05, 0x24, 0xF0, 0x6A, 0x1E, 0x05, 0xA8,
-	0xAA, 0x77, 0x86, 0x2B, 0x5A, 0x3F, 0x78, 0xB8, 0x5C, 0x00, 0xCD, 0x77,
-	0x3E, 0xD9, 0x6C, 0x49, 0xC8, 0x24, 0x38, 0x7A, 0xCE, 0x10, 0x53, 0x66,
-	0xA3, 0xE3, 0x59, 0x83, 0x71, 0x2E, 0x12, 0x2B, 0x83, 0x4F, 0xE0, 0x7D,
-	0xF3, 0xE6, 0xA5, 0x97, 0x5E, 0xBA, 0x69, 0xD2, 0x6C, 0x73, 0xD4, 0xE6,
-	0xB1, 0xCA, 0x79, 0x0D, 0x2B, 0xA6, 0xF6, 0xF4, 0xB7, 0x66, 0xBD, 0xEC,
-	0x3F, 0xB6, 0x89, 0x5A, 0x74, 0xD4, 0x45, 0x22, 0x67, 0xDF, 0x53, 0x6B,
-	0x26, 0x61, 0xA8, 0x3D, 0x34, 0x97, 0x70, 0xD9, 0xCE, 0xCF, 0xA0, 0x4D,
-	0xCF, 0x41, 0x36, 0xBC, 0x9B, 0x71, 0x20, 0xC4, 0x91, 0xD8, 0xD0, 0xFC,
-	0xCF, 0xB1, 0xD5, 0x39, 0xBE, 0x80, 0xF5, 0xBA, 0x98, 0x50, 0x5F, 0xE2,
-	0x04, 0xCD, 0x95, 0x07, 0x37, 0x84, 0x45, 0xC6, 0xA1, 0xDB, 0x6A, 0x14,
-	0x41, 0xD3, 0xFE, 0x0C, 0x4D, 0xBC, 0x2D, 0x30, 0xFD, 0x30, 0x8F, 0x70,
-	0xE6, 0x96, 0xA0, 0xD9, 0xD9, 0x10, 0xA0, 0xFB, 0x71, 0x7C, 0xD5, 0xEE,
-	0x35, 0x11, 0xB4, 0xEC, 0xA6, 0xDA, 0xCD, 0xD7, 0x89, 0xD2, 0xF2, 0x87,
-	0xE6, 0x32, 0x77, 0xCC, 0x98, 0x31, 0xA3, 0xB1, 0xD4, 0x3D, 0x3C, 0x4F,
-	0x27, 0x3D, 0x54, 0x35, 0x58, 0x60, 0x52, 0x58, 0x14, 0xF9, 0x2B, 0x46,
-	0x41, 0xCB, 0xED, 0xC1, 0xEF, 0x49, 0x64, 0x34, 0x09, 0xF0, 0x92, 0x59,
-	0x80, 0x78, 0xF2, 0x0A, 0x77, 0xF3, 0x6B, 0x1A, 0x78, 0x24, 0x78, 0x62,
-	0x4D, 0xCD, 0x17, 0x49, 0x8C, 0x1E, 0x87, 0x2F, 0xEC, 0x8E, 0xB5, 0x19,
-	0xA8, 0x48, 0x11, 0xBB, 0x10, 0xC8, 0xFD, 0xEE, 0x7D, 0xF7, 0xDD, 0x77,
-	0x17, 0x1C, 0x3E, 0x3A, 0x0B, 0x66, 0x8F, 0xA6, 0x51, 0xE6, 0x0D, 0xB5,
-	0x9B, 0x6D, 0xA5, 0x6F, 0x35, 0x7F, 0x94, 0xE2, 0x94, 0xE4, 0xCE, 0x4B,
-	0x59, 0x11, 0xB9, 0x9A, 0xE2, 0xF3, 0x26, 0x4C, 0x98, 0xF0, 0x36, 0x4E,
-	0x69, 0xD9, 0x0F, 0x49, 0xB9, 0x72, 0x9B, 0xC3, 0x03, 0xE3, 0xA0, 0x29,
-	0xF0, 0x1D, 0x76, 0xE4, 0x91, 0x47, 0x1E, 0xCD, 0xBE, 0x53, 0x9E, 0x13,
-	0xAD, 0x9A, 0xB4, 0x12, 0x89, 0x93, 0x30, 0x09, 0xA7, 0xB0, 0xE4, 0xFA,
-	0x88, 0xB9, 0x5C, 0x13, 0x34, 0x04, 0xE8, 0x4F, 0x58, 0x86, 0x8D, 0xAB,
-	0x89, 0xA0, 0x25, 0x54, 0x8A, 0x7C, 0xA2, 0x4D, 0x8C, 0xCB, 0x62, 0xCE,
-	0xFC, 0xFC, 0x8E, 0xDA, 0x15, 0xB5, 0x3B, 0xD8, 0x47, 0xB7, 0x83, 0xBD,
-	0xED, 0xE9, 0xDA, 0x90, 0x47, 0x63, 0xB8, 0x07, 0xE4, 0xDC, 0x16, 0x04,
-	0x38, 0x6C, 0xFB, 0xED, 0xB7, 0xEF, 0x4A, 0x5C, 0x38, 0xF8, 0xE4, 0x53,
-	0x1C, 0x86, 0x50, 0x6B, 0x70, 0xC6, 0xB5, 0x41, 0x86, 0x66, 0x05, 0x78,
-	0x59, 0x1D, 0x01, 0x0D, 0x75, 0x64, 0x6D, 0xF1, 0xC2, 0x46, 0xE5, 0xC2,
-	0x98, 0x3C, 0x86, 0x1E, 0x7A, 0xE8, 0xA1, 0x47, 0x6A, 0xC2, 0x88, 0xCA,
-	0x05, 0xC1, 0xBA, 0x34, 0xA9, 0x90, 0x80, 0x45, 0xCC, 0xF2, 0xE1, 0x95,
-	0x5C, 0xE8, 0x28, 0x2D, 0xDA, 0xCB, 0x31, 0x01, 0x7C, 0x0A, 0xF3, 0xD9,
-	0x15, 0x83, 0x07, 0x0F, 0x1E, 0x56, 0xDB, 0xB6, 0x36, 0xE4, 0xFB, 0x20,
-	0x03, 0x5B, 0x62, 0x45, 0xF9, 0x0C, 0xFA, 0x6E, 0x7E, 0x05, 0x0C, 0xF1,
-	0x7D, 0xA8, 0xE4, 0x50, 0x26, 0x28, 0x0F, 0x1C, 0x33, 0x61, 0x80, 0x52,
-	0x75, 0xEF, 0x0B, 0x4F, 0x99, 0x03, 0x47, 0x8D, 0x1A, 0x75, 0x4B, 0x43,
-	0xC6, 0xA3, 0x94, 0xB6, 0xE7, 0x9A, 0xA0, 0x41, 0x2A, 0x0B, 0x20, 0xFA,
-	0xEC, 0x63, 0x10, 0x6E, 0x0B, 0x2E, 0x75, 0x39, 0x10, 0xB9, 0xF4, 0xA5,
-	0x56, 0x1C, 0x27, 0x0A, 0x4D, 0xC0, 0xF3, 0x9E, 0x4F, 0x3E, 0xF9, 0x64,
-	0x1A, 0x1C, 0x3A, 0x36, 0x7D, 0xE7, 0x9D, 0x77, 0xBE, 0x2F, 0xA5, 0x43,
-	0x1A, 0xE2, 0xBD, 0x7D, 0xFA, 0xF4, 0x39, 0x04, 0xBE, 0xCA, 0xFD, 0xDA,
-	0xB5, 0x6B, 0xB7, 0xBA, 0x6C, 0xFA, 0x71, 0xB4, 0x53, 0xBD, 0x2B, 0xCD,
-	0x0E, 0x4C, 0x0D, 0xCA, 0x49, 0x4F, 0xC9, 0x74, 0x64, 0x5A, 0x42, 0x80,
-	0x42, 0x05, 0x82, 0x8A, 0x2A, 0xDE, 0x7E, 0xFB, 0xED, 0xA9, 0xCC, 0x05,
-	0xFD, 0xC1, 0x07, 0x1F, 0x7C, 0x5E, 0x0A, 0x46, 0x24, 0x69, 0xAC, 0x9A,
-	0xCE, 0x40, 0xE0, 0xC4, 0x05, 0xD4, 0x8C, 0x59, 0x0F, 0x89, 0x82, 0x26,
-	0x0C, 0x69, 0xC3, 0xFC, 0x4D, 0x62, 0x89, 0x7B, 0xE6, 0x21, 0x35, 0x6B,
-	0xCA, 0x8F, 0x22, 0x10, 0xE9, 0x2F, 0x0D, 0x92, 0x9E, 0x8E, 0xBC, 0xD5,
-	0xD7, 0x9F, 0x7C, 0xF2, 0xC9, 0x67, 0x95, 0xD2, 0xDE, 0x86, 0x76, 0x2F,
-	0x0E, 0x4C, 0x59, 0x1A, 0xEE, 0x70, 0x2F, 0x21, 0x52, 0x77, 0x4D, 0x2A,
-	0x32, 0xE1, 0x1E, 0x4F, 0x55, 0xEF, 0x22, 0xFC, 0xC3, 0x53, 0xDB, 0x29,
-	0x07, 0x54, 0x7C, 0xE0, 0x3D, 0x33, 0xED, 0xCC, 0x33, 0xCF, 0x5C, 0xB3,
-	0x36, 0x89, 0xB4, 0x1A, 0x1A, 0x6E, 0xD5, 0xB5, 0x37, 0xD7, 0x04, 0x4D,
-	0xDB, 0x24, 0x36, 0x1F, 0xCE, 0xC7, 0x20, 0x1A, 0xA0, 0x13, 0x36, 0x74,
-	0xD6, 0x1D, 0x05, 0x26, 0x8E, 0x9F, 0x6C, 0xB8, 0x01, 0x86, 0x28, 0xB6,
-	0x3F, 0x63, 0xE0, 0xE7, 0xEA, 0xD8, 0x24, 0x06, 0x10, 0xC0, 0x9E, 0xBF,
-	0x0B, 0x22, 0xFE, 0x56, 0x23, 0x29, 0x87, 0xF9, 0x95, 0xE3, 0x10, 0x9C,
-	0x42, 0xBB, 0xA9, 0x81, 0xF2, 0x5E, 0x3E, 0x43, 0x21, 0xF8, 0x32, 0x91,
-	0xBC, 0xF6, 0xDA, 0x6B, 0x1F, 0xDE, 0x78, 0xE3, 0x8D, 0x17, 0x22, 0x00,
-	0x65, 0x74, 0x39, 0x06, 0x1E, 0x97, 0xE0, 0x58, 0x09, 0x1D, 0x8E, 0x8D,
-	0xBD, 0xE1, 0xA8, 0x6B, 0x7E, 0xD6, 0xCD, 0xBC, 0x1B, 0xAD, 0x5A, 0xB5,
-	0x2A, 0x3C, 0x5E, 0x66, 0xAD, 0x38, 0xED, 0x97, 0x66, 0x48, 0xCD, 0x99,
-	0xE5, 0xA9, 0x1D, 0x2A, 0x00, 0x07, 0xB1, 0x4C, 0x3F, 0x21, 0x64, 0xFD,
-	0x41, 0xC8, 0xD8, 0xC9, 0x08, 0x59, 0xFF, 0x67, 0x39, 0xDA, 0x9E, 0xF5,
-	0x67, 0x60, 0x63, 0xF8, 0x72, 0x04, 0xF1, 0x9C, 0xCE, 0xF1, 0x24, 0xDB,
-	0x73, 0x4D, 0x6D, 0x56, 0x28, 0x3D, 0x89, 0x9A, 0xFD, 0xCE, 0x80, 0x20,
-	0xEE, 0x53, 0x50, 0x0E, 0x2E, 0xB9, 0xE4, 0x92, 0x8B, 0xE0, 0xC6, 0x38,
-	0x20, 0xEB, 0xEF, 0x5C, 0x97, 0xED, 0xCB, 0x35, 0x41, 0x13, 0x58, 0x6E,
-	0x16, 0xC2, 0x5E, 0xF8, 0x06, 0x08, 0x79, 0x69, 0x6A, 0x41, 0xDA, 0xB4,
-	0xA0, 0xC0, 0x50, 0x78, 0xA2, 0x96, 0xC0, 0xD2, 0xBA, 0xA8, 0x71, 0x83,
-	0x60, 0xFE, 0xC0, 0x32, 0xBC, 0x37, 0xCC, 0x26, 0x63, 0xEB, 0xB2, 0xD3,
-	0xB2, 0xF0, 0x6C, 0x68, 0xA2, 0x4B, 0x61, 0x87, 0xFE, 0xAF, 0xB0, 0xE9,
-	0xEE, 0xCB, 0x81, 0xC5, 0x4B, 0x1B, 0x66, 0x22, 0x58, 0x69, 0xC1, 0x51,
-	0xED, 0xA5, 0xD9, 0x88, 0xF8, 0x29, 0x4F, 0x30, 0x9F, 0xC3, 0xCF, 0xE8,
-	0x1A, 0x37, 0x65, 0xCA, 0x94, 0x4F, 0xB1, 0xE9, 0xD8, 0x17, 0x79, 0x4F,
-	0xEE, 0x29, 0x77, 0xE4, 0x1E, 0x12, 0x20, 0xED, 0x0E, 0x37, 0xBC, 0xFB,
-	0xA0, 0xA5, 0xFF, 0x0C, 0x72, 0x5E, 0x42, 0x2E, 0x75, 0xCA, 0xB4, 0x16,
-	0x27, 0x65, 0x69, 0xB1, 0x9C, 0xF0, 0x19, 0x8A, 0x98, 0xD3, 0x7B, 0xE3,
-	0x24, 0x90, 0xA9, 0x90, 0x8B, 0x83, 0x9E, 0x7B, 0xEE, 0xB9, 0x89, 0x51,
-	0x58, 0x34, 0xE4, 0xEF, 0xB1, 0x92, 0xEA, 0x09, 0x25, 0x65, 0x34, 0xC6,
-	0x4C, 0x53, 0x25, 0xA1, 0x8A, 0xD2, 0xA0, 0xF9, 0xBE, 0x1A, 0x73, 0xC4,
-	0x9D, 0x26, 0xA3, 0xCA, 0x8C, 0x77, 0xFF, 0x46, 0xC0, 0xD1, 0xBA, 0xD8,
-	0x1C, 0xFC, 0xB4, 0x21, 0x63, 0x52, 0x6A, 0xDB, 0x73, 0x4F, 0xD0, 0x04,
-	0x10, 0xB3, 0xFE, 0x15, 0xC7, 0x1E, 0x7B, 0xEC, 0x69, 0x32, 0x6F, 0x50,
-	0x60, 0x28, 0x58, 0x51, 0x99, 0xD0, 0x04, 0x3E, 0x85, 0x91, 0xDA, 0x02,
-	0x97, 0xE9, 0xD0, 0x00, 0xA6, 0xF7, 0xEC, 0xD9, 0xB3, 0x3D, 0xFC, 0x75,
-	0x3F, 0x2E, 0xB5, 0x73, 0xB2, 0x7A, 0xFF, 0x3E, 0xFB, 0xEC, 0xD3, 0x79,
-	0xD0, 0xA0, 0x41, 0x37, 0xB7, 0xC1, 0x25, 0x1F, 0x71, 0x4E, 0x66, 0xD4,
-	0x7A, 0xA8, 0x49, 0xCA, 0xBC, 0x11, 0x47, 0x03, 0x65, 0x19, 0x45, 0x98,
-	0x29, 0xD9, 0x3E, 0xEF, 0xE7, 0xE9, 0x26, 0x20, 0xC8, 0x0F, 0xE1, 0x0E,
-	0x79, 0x28, 0x82, 0x1D, 0xFE, 0x51, 0x57, 0x58, 0xF0, 0x5D, 0x6E, 0xB8,
-	0xE1, 0x86, 0x87, 0xB0, 0x1C, 0x5F, 0x82, 0xF5, 0x52, 0x06, 0x94, 0x47,
-	0x3A, 0xEE, 0x04, 0x13, 0x1E, 0x44, 0xCB, 0x76, 0x92, 0x64, 0xF8, 0x23,
-	0x93, 0x4D, 0xE5, 0xC6, 0xE2, 0x5C, 0x98, 0x81, 0x8E, 0x86, 0xAC, 0xDD,
-	0x50, 0x57, 0xEF, 0x52, 0x9F, 0xCF, 0xC5, 0x84, 0xDD, 0x1A, 0x9B, 0xEE,
-	0x6F, 0x81, 0x9C, 0x17, 0xE3, 0xE4, 0x4A, 0x5B, 0xB3, 0xBC, 0x9E, 0xA2,
-	0xDA, 0xA5, 0xCD, 0xC2, 0xD0, 0xD3, 0x07, 0xEE, 0xAB, 0xD7, 0x60, 0x8F,
-	0xA8, 0x90, 0xBF, 0x23, 0xCF, 0x97, 0x09, 0x1A, 0xBD, 0xBF, 0xFA, 0xEA,
-	0xAB, 0xB7, 0x82, 0xA6, 0x36, 0x05, 0x04, 0x51, 0x38, 0x31, 0x9A, 0x9A,
-	0x93, 0x7C, 0x9E, 0xA3, 0x48, 0x9A, 0xE4, 0xAC, 0x3C, 0x0F, 0x14, 0x30,
-	0xE4, 0x11, 0xFE, 0xB2, 0x65, 0xCB, 0x96, 0xCD, 0x37, 0xDB, 0x6C, 0xB3,
-	0x85, 0x1A, 0xA3, 0xBB, 0x15, 0x34, 0x24, 0x2E, 0x61, 0x4F, 0xA4, 0x69,
-	0x07, 0xF9, 0x2E, 0x16, 0xE2, 0xFB, 0x93, 0xC8, 0x14, 0xB8, 0xA1, 0xC1,
-	0x44, 0x4C, 0x74, 0x20, 0x6B, 0x4D, 0x03, 0x4C, 0xD1, 0x65, 0x24, 0x34,
-	0x92, 0xBB, 0xC2, 0xBF, 0x61, 0x97, 0xFE, 0x1A, 0x11, 0x68, 0x9D, 0x5E,
-	0x7C, 0xF1, 0xC5, 0x3A, 0x9F, 0xE8, 0xB0, 0xA9, 0xB5, 0x3E, 0x36, 0xF4,
-	0x6E, 0x47, 0x6E, 0x95, 0xB6, 0x5C, 0x45, 0xF1, 0xDD, 0x78, 0x31, 0x24,
-	0x3D, 0xEE, 0xC5, 0xC9, 0x85, 0xFD, 0x2F, 0xBF, 0x6A, 0x69, 0xE1, 0xB4,
-	0x4F, 0x73, 0x65, 0xC0, 0xEF, 0x61, 0x9B, 0x9E, 0x0B, 0xFB, 0xEC, 0x7D,
-	0x08, 0x8A, 0xFC, 0x53, 0x52, 0x57, 0xC1, 0xB8, 0xED, 0xA8, 0x8F, 0x72,
-	0xCC, 0x6F, 0x83, 0x94, 0x07, 0x7F, 0x60, 0x1F, 0xE6, 0x1B, 0xEC, 0x17,
-	0x14, 0xC2, 0x33, 0xB9, 0x97, 0xC0, 0xB1, 0xA3, 0xD5, 0x55, 0x75, 0xED,
-	0xD2, 0xE6, 0xAA, 0xB0, 0xA3, 0x89, 0x08, 0x63, 0xEF, 0xDF, 0x48, 0x8C,
-	0xB4, 0xC6, 0xB4, 0x69, 0xD3, 0x72, 0x7F, 0x2E, 0xA4, 0x09, 0x1A, 0x92,
-	0x43, 0x5B, 0x34, 0xBC, 0x03, 0x2E, 0xC0, 0x09, 0x1D, 0xFD, 0x83, 0xF4,
-	0x92, 0x05, 0x21, 0x8B, 0xD2, 0x02, 0xB4, 0x94, 0x93, 0xE7, 0x02, 0x97,
-	0xEA, 0x14, 0x4C, 0xF8, 0xEC, 0xBE, 0x8B, 0x04, 0xE3, 0xDD, 0xE1, 0x1A,
-	0x36, 0xB9, 0x3E, 0x06, 0x4D, 0xB9, 0xEB, 0xC4, 0x72, 0x73, 0xB5, 0x53,
-	0x4F, 0x3D, 0x75, 0x18, 0xBC, 0x55, 0x76, 0xA9, 0xF4, 0xFB, 0x2D, 0x90,
-	0x69, 0x31, 0x89, 0x29, 0x88, 0x87, 0x18, 0xC4, 0xDD, 0x28, 0xA4, 0xDD,
-	0x91, 0x13, 0xA3, 0x0E, 0x12, 0x05, 0x29, 0xBF, 0x84, 0x3C, 0x27, 0x5D,
-	0xE3, 0xA6, 0x1A, 0x2D, 0xC7, 0xBB, 0x72, 0x73, 0x0B, 0x99, 0xEA, 0x1E,
-	0xC2, 0x81, 0xC2, 0x9B, 0x81, 0x54, 0xE6, 0x23, 0xB1, 0x84, 0xDE, 0x27,
-	0xD5, 0xD5, 0x11, 0x7A, 0x22, 0x70, 0x92, 0xD1, 0xD9, 0x88, 0xA1, 0xF6,
-	0x2D, 0x0D, 0x9B, 0xF2, 0xC4, 0x49, 0x08, 0x07, 0x0F, 0xBF, 0x0F, 0x59,
-	0x3B, 0x12, 0x1B, 0xD4, 0xCF, 0x96, 0xA3, 0xED, 0xF5, 0xF9, 0x0C, 0x68,
-	0xCE, 0x6B, 0x20, 0xB3, 0xE3, 0xFD, 0xF4, 0xE2, 0xE1, 0xD8, 0xD1, 0x6A,
-	0x48, 0x2B, 0xAB, 0xA8, 0x68, 0x51, 0xE1, 0x17, 0x62, 0x77, 0xF5, 0xD5,
-	0x57, 0x5F, 0x8A, 0x7D, 0xA1, 0xB3, 0xEB, 0xF3, 0xBD, 0xB2, 0x52, 0xB7,
-	0x09, 0xBA, 0xB2, 0x27, 0xE0, 0x27, 0xBB, 0x3C, 0xCC, 0x12, 0x13, 0x61,
-	0x8B, 0x6C, 0xA5, 0x59, 0x3F, 0x8E, 0x9F, 0x26, 0x6F, 0xA7, 0x70, 0x91,
-	0x64, 0x68, 0xE2, 0x20, 0x61, 0xF3, 0x6F, 0x2E, 0x6B, 0x61, 0xDB, 0x7E,
-	0x1E, 0x1B, 0x51, 0xC7, 0x34, 0x74, 0x92, 0x86, 0xAB, 0xD3, 0x01, 0x30,
-	0x35, 0x9C, 0xB7, 0xE6, 0x9A, 0x6B, 0xAE, 0x25, 0xD3, 0x0F, 0x4D, 0x01,
-	0xD4, 0x36, 0x39, 0x20, 0x43, 0x1B, 0xA2, 0xBE, 0x8F, 0x5A, 0x79, 0x68,
-	0x00, 0xE8, 0x7E, 0x2C, 0x3C, 0x66, 0xE2, 0xE4, 0xE7, 0x05, 0x99, 0x14,
-	0x1F, 0xC7, 0x58, 0xF5, 0xA8, 0xAF, 0xD5, 0x07, 0x36, 0x23, 0xFF, 0xD6,
-	0xBB, 0x77, 0xEF, 0x43, 0xE2, 0x0E, 0xD0, 0x30, 0xC2, 0x54, 0xF7, 0xC8,
-	0x16, 0xCF, 0xFF, 0x35, 0xE1, 0xEB, 0x0C, 0x4C, 0x69, 0xD6, 0x28, 0xF3,
-	0xEB, 0xD0, 0xA1, 0x43, 0xAF, 0x87, 0xE6, 0x79, 0x56, 0x7D, 0xBD, 0x6B,
-	0xDC, 0x77, 0xAC, 0xAE, 0xDC, 0x06, 0x1B, 0x6C, 0xD0, 0x0C, 0x7D, 0x75,
-	0x2F, 0xBC, 0x62, 0xBA, 0xD2, 0x13, 0x47, 0x3E, 0xE2, 0x9C, 0xD8, 0x38,
-	0x86, 0xA2, 0x12, 0x51, 0xF1, 0xB9, 0xA1, 0xAD, 0x9A, 0x58, 0xC2, 0xFB,
-	0xE5, 0x2B, 0x28, 0x01, 0x1B, 0x20, 0xD5, 0xEC, 0x77, 0xA5, 0xB6, 0xAF,
-	0x31, 0xDC, 0x6F, 0x82, 0x0E, 0x7A, 0x11, 0x21, 0xA5, 0xC7, 0x43, 0xE0,
-	0xAE, 0xD1, 0x29, 0xD1, 0xF2, 0xE3, 0xAD, 0xA9, 0xA3, 0xA5, 0x01, 0x84,
-	0x99, 0xB9, 0x68, 0x22, 0xA1, 0xE0, 0x71, 0x37, 0x1F, 0xDA, 0xE0, 0x5B,
-	0x70, 0x15, 0xEA, 0x85, 0xDD, 0xFC, 0xB7, 0x1A, 0xA2, 0xC0, 0xF0, 0x90,
-	0x5D, 0x1C, 0xF9, 0xB4, 0x1F, 0x06, 0xDF, 0xE2, 0xB2, 0x33, 0x2B, 0xA2,
-	0x4E, 0xEF, 0x5C, 0x95, 0xA6, 0x4C, 0x22, 0x12, 0x89, 0xD7, 0xF4, 0xDE,
-	0xA1, 0x8B, 0x1A, 0xCC, 0x27, 0x57, 0xE2, 0xB4, 0x9B, 0x7E, 0x98, 0xD0,
-	0x66, 0xD4, 0x17, 0x56, 0x58, 0xAE, 0x2F, 0x08, 0x6D, 0xFA, 0x14, 0xAC,
-	0x7E, 0x06, 0xC0, 0x24, 0xB1, 0x48, 0x9C, 0x55, 0x00, 0x35, 0x63, 0x4E,
-	0x52, 0x22, 0xA4, 0xE2, 0x2C, 0x6D, 0x22, 0x21, 0xB9, 0x71, 0x6A, 0x55,
-	0xC6, 0x89, 0x7D, 0xD2, 0xA4, 0x49, 0x6F, 0x0E, 0x1C, 0x38, 0xF0, 0x98,
-	0x07, 0x1E, 0x78, 0xA0, 0x41, 0x9D, 0x14, 0xB2, 0xCB, 0x2E, 0xBB, 0x74,
-	0xC6, 0x58, 0x19, 0x09, 0xAC, 0xD6, 0xA6, 0x49, 0x88, 0x76, 0x7B, 0x9A,
-	0x05, 0x89, 0x43, 0x71, 0x70, 0x57, 0x4D, 0x7D, 0xA9, 0x4D, 0x56, 0x99,
-	0x09, 0xCF, 0x39, 0xE7, 0x9C, 0x53, 0xB1, 0xBF, 0x71, 0x55, 0x7D, 0xF5,
-	0x7F, 0xD6, 0xEA, 0x35, 0x41, 0x17, 0xF5, 0x08, 0xB4, 0x99, 0x57, 0x3B,
-	0x74, 0xE8, 0xB0, 0xB1, 0x6C, 0xA3, 0x0A, 0x48, 0x20, 0xE1, 0x50, 0x98,
-	0xB4, 0x64, 0xD3, 0xA0, 0x8B, 0xEA, 0x50, 0xDE, 0x03, 0xDF, 0xDD, 0x8F,
-	0x41, 0xD2, 0x47, 0xDD, 0x7D, 0xF7, 0xDD, 0x8F, 0x47, 0x95, 0xCF, 0xCA,
-	0xF7, 0xD0, 0x9A, 0xF7, 0x23, 0x49, 0x41, 0x4B, 0x8A, 0x9D, 0x30, 0xBF,
-	0xAA, 0xB6, 0x87, 0xE4, 0x24, 0x3B, 0xB3, 0xCA, 0x89, 0x9C, 0x39, 0xA0,
-	0xE1, 0xFA, 0x76, 0x36, 0x0E, 0x15, 0xBD, 0x34, 0x2B, 0xEF, 0x0F, 0x3B,
-	0xFB, 0x9F, 0x90, 0x85, 0xEF, 0x3A, 0x90, 0xF4, 0x32, 0x24, 0x54, 0x05,
-	0xA8, 0x88, 0x80, 0xA2, 0x96, 0xEE, 0x71, 0xDF, 0xA3, 0xD2, 0x34, 0x36,
-	0x13, 0xE6, 0x95, 0xA1, 0x0D, 0xC5, 0x45, 0x13, 0x29, 0x44, 0x77, 0x85,
-	0xFB, 0xDB, 0x10, 0xC8, 0xC6, 0x9A, 0x71, 0xDE, 0xB3, 0xAA, 0xC3, 0x10,
-	0x42, 0x22, 0x97, 0x3B, 0x1E, 0x92, 0x22, 0x4D, 0xC0, 0xDE, 0xCD, 0x16,
-	0x71, 0x9E, 0x99, 0x97, 0x32, 0x26, 0xE8, 0xA2, 0x9E, 0x46, 0x28, 0xF1,
-	0x3A, 0x38, 0xC5, 0xF9, 0x0D, 0x10, 0x73, 0x53, 0xFA, 0xE1, 0xD2, 0xC6,
-	0xAA, 0xA8, 0x41, 0x99, 0x3C, 0xB4, 0x7C, 0x8F, 0xB3, 0xCB, 0x2F, 0x3B,
-	0x36, 0xFC, 0x7D, 0x7F, 0xC6, 0xAE, 0xF4, 0x81, 0x58, 0xC2, 0xDF, 0x97,
-	0x65, 0xE1, 0xA2, 0xA9, 0xA7, 0x7F, 0xFF, 0xFE, 0x17, 0xC3, 0x05, 0xED,
-	0xC8, 0x72, 0xB4, 0x33, 0xB4, 0xD1, 0x6B, 0xA0, 0x6A, 0x23, 0x8E, 0xD8,
-	0x22, 0x18, 0xE1, 0x1B, 0x4C, 0x04, 0x47, 0x8C, 0x1B, 0x37, 0xEE, 0x81,
-	0x72, 0xD4, 0x57, 0xCE, 0x67, 0xEC, 0xB0, 0xC3, 0x0E, 0xED, 0xE1, 0x4D,
-	0x70, 0x17, 0x56, 0x0F, 0x6D, 0xB8, 0xF9, 0x17, 0x4E, 0xCA, 0xB2, 0x9B,
-	0x97, 0xA3, 0x3E, 0xFA, 0x82, 0xE3, 0xF9, 0xB3, 0xDE, 0x78, 0xE3, 0x8D,
-	0xC9, 0x38, 0x31, 0xFE, 0x2C, 0x98, 0x3D, 0x1E, 0x2D, 0xC7, 0x73, 0xEB,
-	0xE2, 0x19, 0x30, 0x75, 0x1D, 0x8B, 0x89, 0xEB, 0x52, 0xAC, 0x2E, 0x97,
-	0x20, 0x1E, 0x51, 0xB9, 0x4C, 0x64, 0xD2, 0x91, 0x67, 0x94, 0x14, 0x1D,
-	0xED, 0x51, 0x70, 0xB5, 0xC9, 0x95, 0x07, 0x26, 0xE9, 0x59, 0xD0, 0xCA,
-	0x37, 0xC4, 0x99, 0x83, 0x53, 0xEA, 0xA2, 0xDD, 0x0D, 0xF5, 0x99, 0x26,
-	0xE8, 0x2A, 0x7A, 0x0E, 0x0E, 0xF2, 0xA7, 0x9D, 0x7D, 0xF6, 0xD9, 0x57,
-	0xE8, 0x84, 0x68, 0xD9, 0x58, 0x75, 0xBA, 0x43, 0x52, 0x2D, 0x9A, 0x82,
-	0x0C, 0xA2, 0x9E, 0x85, 0x41, 0xD8, 0x14, 0x76, 0xE9, 0x47, 0x60, 0xB3,
-	0xDB, 0x25, 0x6B, 0x02, 0xC3, 0xE0, 0x0D, 0x68, 0xB4, 0x7D, 0xA0, 0xC5,
-	0xF5, 0x47, 0x9E, 0xE4, 0xE5, 0xB8, 0x01, 0xC8, 0xF7, 0x4D, 0xE2, 0xC9,
-	0x50, 0xD5, 0x3B, 0x69, 0x12, 0xE3, 0x40, 0x24, 0x6E, 0x32, 0x1B, 0xF1,
-	0xF9, 0xD8, 0x14, 0xFC, 0x14, 0x93, 0x56, 0x2F, 0xD8, 0xFE, 0x9F, 0xCB,
-	0x1A, 0x1E, 0x6A, 0x4F, 0xA7, 0x4E, 0x9D, 0xD6, 0xC0, 0x61, 0x03, 0x63,
-	0xB0, 0xAA, 0xEA, 0xA8, 0xC9, 0x96, 0x4B, 0x79, 0xFE, 0xC4, 0x09, 0x55,
-	0x8E, 0x7A, 0x2F, 0x6A, 0x8F, 0xF4, 0xF7, 0x96, 0x2D, 0x9E, 0x2B, 0xB6,
-	0xB1, 0x63, 0xC7, 0xDE, 0x86, 0x3A, 0xCF, 0x82, 0xF9, 0xE3, 0x93, 0xA8,
-	0xFB, 0xD3, 0xFC, 0x1E, 0x3E, 0xE3, 0xB7, 0x62, 0xE2, 0xEE, 0x19, 0x4E,
-	0xBA, 0x51, 0x7B, 0x0D, 0xE1, 0x81, 0xCB, 0xA1, 0x42, 0x23, 0x17, 0x4C,
-	0xBD, 0x3F, 0x94, 0x82, 0xD3, 0x60, 0xEA, 0xB9, 0x32, 0xCD, 0xF7, 0x69,
-	0x08, 0x75, 0x99, 0xA0, 0xAB, 0xE9, 0x25, 0x84, 0xE9, 0xDE, 0x07, 0x1F,
-	0xD9, 0x3D, 0xE4, 0x2E, 0xA6, 0xD3, 0x88, 0xE5, 0x78, 0x1F, 0x77, 0x97,
-	0x9A, 0x8F, 0xFF, 0xFA, 0xEB, 0xAF, 0x0B, 0x1B, 0x88, 0x0A, 0x6B, 0xC5,
-	0xEF, 0xE9, 0xB0, 0x77, 0x9F, 0x8A, 0x80, 0x96, 0x5A, 0xE7, 0x95, 0x28,
-	0xA7, 0x70, 0xD1, 0x9E, 0x48, 0x73, 0x06, 0x26, 0x8E, 0x1D, 0x15, 0xAE,
-	0x1C, 0xE7, 0xBC, 0xC6, 0xB8, 0x6D, 0x08, 0xF3, 0x6F, 0x80, 0x98, 0xE7,
-	0x72, 0x03, 0x09, 0x5E, 0x8D, 0x13, 0x41, 0xCE, 0xBB, 0x35, 0x94, 0x08,
-	0xBB, 0x91, 0x23, 0x47, 0x8E, 0x3A, 0xEC, 0xB0, 0xC3, 0x0E, 0xD5, 0x3B,
-	0xC7, 0xF1, 0xF1, 0x8E, 0x8B, 0x0F, 0x7D, 0xBE, 0x29, 0x1F, 0x24, 0x3B,
-	0x69, 0xE6, 0xF0, 0xF4, 0xF8, 0x0A, 0xF2, 0x71, 0x25, 0x94, 0x85, 0x7A,
-	0x27, 0x2D, 0x98, 0x7B, 0x7A, 0x41, 0xB3, 0x1F, 0x0E, 0x73, 0xCF, 0x92,
-	0x72, 0x83, 0x8C, 0x7B, 0x64, 0x58, 0xE8, 0xE3, 0x4C, 0x3C, 0x44, 0xE8,
-	0x24, 0x6E, 0xD9, 0xAC, 0x71, 0xE2, 0xF7, 0x8B, 0xC8, 0xF7, 0xDC, 0x29,
-	0x2E, 0x5E, 0x79, 0x2A, 0x67, 0x82, 0xAE, 0xA6, 0xB7, 0x79, 0x54, 0x3C,
-	0x1C, 0xEF, 0x27, 0xB7, 0x6E, 0xDD, 0x7A, 0xA5, 0x20, 0xA5, 0x64, 0x41,
-	0x0B, 0x0C, 0x49, 0x3A, 0x4A, 0x58, 0xA4, 0x21, 0xB0, 0x9C, 0xA2, 0x0E,
-	0xF9, 0x3C, 0x08, 0xE8, 0x1C, 0x2C, 0x69, 0x5F, 0x86, 0xDD, 0xF5, 0x14,
-	0x68, 0xAE, 0xEF, 0x22, 0x0B, 0xDA, 0x7F, 0x9C, 0x6F, 0x53, 0xBC, 0x98,
-	0xD0, 0x1E, 0x2E, 0x52, 0x23, 0x71, 0xFA, 0x48, 0x67, 0x9A, 0x74, 0xD8,
-	0x56, 0xE6, 0x91, 0xE0, 0x3B, 0x52, 0xE3, 0xE5, 0x60, 0x8A, 0xB3, 0x13,
-	0x1F, 0xD5, 0xE4, 0xF0, 0x3C, 0x3F, 0xBC, 0xF7, 0x6C, 0x04, 0x9E, 0xDC,
-	0xD1, 0xA3, 0x47, 0x8F, 0x9E, 0x51, 0xF7, 0x65, 0xED, 0x7B, 0x4C, 0x62,
-	0xC7, 0xC0, 0x05, 0xEC, 0x3A, 0xF6, 0x23, 0x49, 0x35, 0xEE, 0x89, 0x2C,
-	0x35, 0xBD, 0x87, 0x92, 0x2D, 0xB1, 0x0C, 0x35, 0xF2, 0x4A, 0x7F, 0xE9,
-	0x79, 0x44, 0x86, 0x53, 0x5B, 0xDE, 0xC6, 0xE4, 0x70, 0x29, 0xC8, 0x3A,
-	0xF5, 0x03, 0x01, 0xB0, 0x6A, 0x58, 0x15, 0xC4, 0x7C, 0x2D, 0xC8, 0x73,
-	0x57, 0xEE, 0x17, 0x50, 0x6E, 0xB9, 0xA2, 0x0A, 0xF7, 0x67, 0xE2, 0xF4,
-	0x11, 0xF1, 0x92, 0xAB, 0xA1, 0x4C, 0x1D, 0xFC, 0x4D, 0xF9, 0xC2, 0xFE,
-	0x0C, 0x57, 0x51, 0x5D, 0xB1, 0x31, 0xFC, 0x41, 0x9C, 0x67, 0xE5, 0xAD,
-	0x8C, 0x09, 0xBA, 0x86, 0x1E, 0x47, 0xD6, 0xB3, 0xEE, 0x10, 0xD0, 0xD1,
-	0xD0, 0x6E, 0x0A, 0x89, 0xA0, 0xC3, 0xC1, 0x14, 0x77, 0x93, 0x90, 0xF7,
-	0x51, 0x38, 0x45, 0x7E, 0xD4, 0xBC, 0x2A, 0x4F, 0x08, 0x99, 0x57, 0x33,
-	0xEC, 0xD2, 0x77, 0x62, 0x10, 0x0E, 0x45, 0x6A, 0xC5, 0x3A, 0x8B, 0x98,
-	0x53, 0x65, 0x4C, 0x09, 0x8A, 0x44, 0x36, 0x9B, 0x20, 0xAB, 0xDB, 0x91,
-	0x38, 0xC4, 0x95, 0x47, 0x48, 0x35, 0x61, 0xDB, 0xE8, 0x87, 0xAC, 0xFC,
-	0x23, 0x5C, 0x66, 0x47, 0x2D, 0x5D, 0xE3, 0x0E, 0x14, 0x69, 0x9A, 0xD8,
-	0xE9, 0x9F, 0x8D, 0x3A, 0x66, 0xC1, 0x53, 0xE3, 0x22, 0xE4, 0x8A, 0xBE,
-	0x38, 0xEE, 0xFD, 0x59, 0x2B, 0xB7, 0xD3, 0x4E, 0x3B, 0x75, 0x81, 0xEB,
-	0xE4, 0x50, 0xE0, 0x18, 0xFB, 0x8C, 0xC4, 0xA8, 0x77, 0x08, 0xF3, 0x97,
-	0xA8, 0x2C, 0x49, 0x4D, 0x89, 0xA3, 0xD8, 0x17, 0x2F, 0xBF, 0xFC, 0xF2,
-	0xFB, 0xC8, 0x7B, 0x72, 0x1E, 0xBC, 0x6A, 0xEA, 0x34, 0x8D, 0x00, 0x93,
-	0x49, 0xC1, 0xAE, 0xBC, 0x19, 0xE4, 0xE3, 0x18, 0xC8, 0xC7, 0xFE, 0x8C,
-	0x11, 0x90, 0x89, 0x4F, 0xEE, 0x73, 0x0A, 0xBC, 0x89, 0x8A, 0x11, 0x90,
-	0xEC, 0xF3, 0x37, 0x65, 0x8A, 0xEF, 0xC4, 0x31, 0x24, 0x33, 0x17, 0x4C,
-	0x5C, 0xBF, 0x33, 0xA3, 0x24, 0xC2, 0xF8, 0x33, 0xBD, 0x2F, 0x13, 0xD5,
-	0x7F, 0x75, 0xF9, 0xBD, 0x09, 0x3A, 0x02, 0x5D, 0xB8, 0xFC, 0x0C, 0x3C,
-	0xE0, 0x80, 0x03, 0xFA, 0xE2, 0x44, 0x8E, 0x45, 0x8B, 0xB5, 0x1D, 0xE5,
-	0x8E, 0xA8, 0xE9, 0x11, 0x1C, 0x7C, 0xD4, 0x3E, 0x98, 0xCF, 0x58, 0x64,
-	0xC5, 0x81, 0xC7, 0x67, 0x51, 0x53, 0x25, 0x79, 0x53, 0x6B, 0xA5, 0xF0,
-	0xE2, 0x9C, 0xC4, 0x09, 0xB0, 0x3F, 0xFE, 0x15, 0x76, 0xEA, 0xFB, 0xA1,
-	0x59, 0x7C, 0x5B, 0xCE, 0x8E, 0xE7, 0x40, 0xC3, 0x78, 0xDB, 0x13, 0x93,
-	0xCE, 0xB1, 0x88, 0x9C, 0xDB, 0x16, 0x83, 0x7E, 0x41, 0x2E, 0x3F, 0xA9,
-	0xB1, 0x29, 0xB4, 0x99, 0x36, 0x77, 0x0E, 0x1E, 0x4E, 0x20, 0x6C, 0x33,
-	0xBF, 0x27, 0x71, 0x97, 0x72, 0x69, 0xB5, 0x81, 0xE7, 0xFD, 0xC4, 0x09,
-	0x0F, 0x93, 0x51, 0x83, 0xF1, 0x64, 0xA9, 0xEE, 0xBD, 0x79, 0xDE, 0x21,
-	0x52, 0x03, 0x9C, 0x0F, 0x3C, 0xFF, 0x54, 0x0A, 0x36, 0xBA, 0x57, 0x66,
-	0x00, 0x4D, 0xE4, 0xDC, 0x78, 0x23, 0xF9, 0xB1, 0x6F, 0x48, 0xCE, 0x94,
-	0x97, 0xCA, 0xEC, 0x8A, 0x33, 0xA0, 0x51, 0x4F, 0xBA, 0xE5, 0x96, 0x5B,
-	0xFE, 0x02, 0xB3, 0xC0, 0x5D, 0xE5, 0x3C, 0xB0, 0x96, 0x3E, 0xCD, 0x1D,
-	0x3B, 0x76, 0xDC, 0x03, 0x1E, 0x1A, 0x47, 0x6C, 0xB7, 0xDD, 0x76, 0x5B,
-	0x73, 0x45, 0x25, 0x77, 0x39, 0x24, 0x7D, 0x2A, 0xC8, 0x08, 0xCD, 0x30,
-	0x94, 0x5B, 0xF6, 0xA9, 0xD2, 0x86, 0x52, 0x76, 0x6B, 0xBA, 0x42, 0xEF,
-	0x27, 0x05, 0x73, 0xF1, 0x5E, 0x3C, 0x73, 0x3A, 0x36, 0x86, 0xAF, 0x39,
-	0xEB, 0xAC, 0xB3, 0xFA, 0x97, 0x03, 0xC3, 0xC6, 0xFA, 0x0C, 0x13, 0x74,
-	0x8C, 0x9E, 0x45, 0x68, 0xEE, 0x58, 0xF8, 0xC7, 0xEE, 0x2F, 0x82, 0xE6,
-	0x60, 0x09, 0x37, 0x3F, 0x6A, 0x7A, 0x84, 0x72, 0x09, 0x53, 0x38, 0x69,
-	0x73, 0x53, 0x8E, 0x06, 0xFE, 0xAD, 0x65, 0x9F, 0xB2, 0xC0, 0xF1, 0xFF,
-	0xCA, 0x70, 0xE7, 0xE9, 0xD8, 0xCD, 0x7E, 0x12, 0x26, 0x96, 0xBB, 0x30,
-	0x20, 0x1F, 0x82, 0x9D, 0x76, 0x7A, 0x6D, 0x13, 0x05, 0xED, 0xB8, 0xE3,
-	0x8E, 0x1D, 0xBB, 0x75, 0xEB, 0xD6, 0x73, 0xB7, 0xDD, 0x76, 0xDB, 0x13,
-	0x31, 0x38, 0x2B, 0xA3, 0xAD, 0x0B, 0xB0, 0x2D, 0x1A, 0x7C, 0x24, 0x00,
-	0xFA, 0xB1, 0x92, 0x14, 0x58, 0xB7, 0x36, 0x72, 0xE2, 0x78, 0xA8, 0xC4,
-	0x80, 0xAE, 0x50, 0x04, 0xF6, 0xFC, 0xB1, 0xC8, 0xE8, 0x76, 0x7C, 0x7D,
-	0x98, 0x71, 0xE2, 0xB6, 0x31, 0x69, 0x39, 0x26, 0x8B, 0xEA, 0xD2, 0xA5,
-	0xCB, 0x21, 0x48, 0xE4, 0x44, 0x9F, 0xDD, 0x5A, 0x8F, 0x23, 0xC9, 0x54,
-	0x55, 0x1B, 0xD0, 0x22, 0x67, 0x25, 0xF1, 0xD2, 0x04, 0x8F, 0xB2, 0x73,
-	0xE0, 0x0E, 0xFA, 0x1A, 0x4E, 0x04, 0x7A, 0x12, 0xA1, 0xE3, 0xE7, 0xD7,
-	0xC6, 0x6F, 0x9C, 0x13, 0x36, 0x4C, 0x18, 0x4B, 0xE2, 0xB4, 0x92, 0x3D,
-	0xB0, 0x2A, 0xD8, 0x1B, 0x1E, 0x2B, 0xBB, 0x60, 0x13, 0x7B, 0x61, 0x3C,
-	0xBA, 0x09, 0xDB, 0x22, 0xAD, 0x9E, 0xDA, 0xB3, 0x34, 0xDE, 0xD0, 0x03,
-	0x23, 0xEA, 0x24, 0x94, 0x10, 0x4F, 0x1D, 0x1B, 0xC6, 0x09, 0x87, 0x72,
-	0x45, 0x39, 0xC3, 0x24, 0xC3, 0x0D, 0xC7, 0xD8, 0x87, 0x00, 0x27, 0xED,
-	0x9F, 0xC6, 0x52, 0xBE, 0xD6, 0x82, 0xD5, 0x58, 0x00, 0x88, 0xFB, 0x1E,
-	0x98, 0xED, 0xEF, 0x86, 0x76, 0xB1, 0x37, 0x6D, 0xB3, 0xBC, 0xC2, 0xCC,
-	0x77, 0xFC, 0x9F, 0xCB, 0x3F, 0x6D, 0xAC, 0x51, 0xC0, 0xF9, 0x3F, 0xB5,
-	0xE6, 0xA8, 0x4B, 0x1A, 0x66, 0x75, 0xE5, 0xB0, 0x29, 0x33, 0x1D, 0xAE,
-	0x68, 0xDF, 0x23, 0xCF, 0x34, 0x52, 0x22, 0xBF, 0x3D, 0x11, 0x3F, 0x6F,
-	0x61, 0x03, 0xE9, 0x13, 0x68, 0x55, 0xDF, 0x62, 0x10, 0xCD, 0x00, 0xB9,
-	0xCF, 0x44, 0xB6, 0xB4, 0x1F, 0x79, 0x3F, 0xB5, 0x20, 0xB4, 0x61, 0xCD,
-	0x8D, 0x36, 0xDA, 0x68, 0x63, 0xF8, 0x93, 0x6E, 0xB7, 0xDE, 0x7A, 0xEB,
-	0x6D, 0x84, 0x41, 0xC8, 0xE8, 0xBF, 0xF9, 0xAA, 0x7B, 0x7E, 0x58, 0xBF,
-	0x06, 0x5D, 0xF1, 0xE0, 0xD3, 0xC0, 0x94, 0x4F, 0x78, 0x68, 0x83, 0x67,
-	0xD9, 0xD0, 0x26, 0x29, 0x62, 0xAF, 0x8C, 0xB0, 0x9B, 0x05, 0x73, 0xC6,
-	0x49, 0x48, 0x5E, 0x7F, 0x7D, 0x6D, 0x27, 0x98, 0x28, 0xFC, 0xEA, 0xFB,
-	0x7B, 0x68, 0xD1, 0x5D, 0x11, 0x5C, 0x31, 0x02, 0x01, 0x1B, 0xAB, 0x71,
-	0xD2, 0xAE, 0xCC, 0x51, 0x52, 0x68, 0x56, 0x98, 0xDB, 0x9A, 0x24, 0xA5,
-	0x2C, 0x7F, 0x6A, 0x73, 0x71, 0x40, 0x4B, 0x6D, 0xDE, 0x05, 0xCF, 0x9D,
-	0x89, 0xBD, 0x8C, 0x29, 0x3C, 0x6D, 0x06, 0x2B, 0xB0, 0x27, 0xA7, 0x4E,
-	0x9D, 0x3A, 0x51, 0x51, 0x78, 0xCC, 0x91, 0xF1, 0xFE, 0xFB, 0xEF, 0x2F,
-	0x0E, 0x65, 0x60, 0x71, 0x90, 0xE2, 0xF2, 0xC8, 0x11, 0xB3, 0x32, 0xF2,
-	0xCE, 0xB4, 0x45, 0x38, 0x3B, 0xE5, 0x62, 0x63, 0xAC, 0x0A, 0x5B, 0xE2,
-	0xBB, 0xFF, 0x9C, 0xE3, 0x56, 0xCD, 0x15, 0x87, 0x88, 0x69, 0x22, 0xA3,
-	0xAC, 0x2B, 0xA8, 0x47, 0x9B, 0xC2, 0xF2, 0x1D, 0x97, 0x02, 0xC2, 0x2A,
-	0xF8, 0xCE, 0xDC, 0x83, 0x28, 0xD7, 0xEA, 0xA3, 0x36, 0x98, 0x35, 0xA4,
-	0x7B, 0x4C, 0xD0, 0x09, 0x7A, 0x0B, 0x51, 0x6E, 0x8F, 0x21, 0xAA, 0x6E,
-	0x07, 0x1D, 0x3E, 0x2A, 0x0D, 0x58, 0x5A, 0x01, 0x1F, 0x15, 0x1E, 0xF3,
-	0xA4, 0x5C, 0xC7, 0x35, 0x55, 0x11, 0x45, 0xD0, 0xA1, 0x8B, 0x5F, 0x25,
-	0x51, 0xFE, 0x8E, 0x7B, 0x66, 0xF1, 0x73, 0x0A, 0x3E, 0x26, 0x0C, 0xF0,
-	0xC2, 0xEF, 0x33, 0xF9, 0x1C, 0x10, 0xC0, 0x22, 0x18, 0x30, 0xC2, 0x96,
-	0x31, 0x00, 0x00, 0x0F, 0xE6, 0x49, 0x44, 0x41, 0x54, 0x88, 0x0B, 0xE2,
-	0x73, 0x9E, 0x64, 0xC1, 0xDF, 0xB1, 0x12, 0xA6, 0xAB, 0x7D, 0x55, 0x11,
-	0x34, 0x89, 0x56, 0x1E, 0x2C, 0xC5, 0x51, 0x75, 0x5A, 0x9A, 0xCB, 0xDD,
-	0x8C, 0xBF, 0x39, 0x31, 0x31, 0xE4, 0x17, 0x13, 0xCB, 0x0F, 0xC8, 0xA7,
-	0xD0, 0x13, 0x84, 0xF0, 0x64, 0x63, 0x3F, 0x0A, 0x0C, 0xF6, 0xE8, 0xE5,
-	0xB0, 0x81, 0x38, 0x94, 0x2E, 0x68, 0xC4, 0x92, 0xE6, 0x21, 0x62, 0xC1,
-	0x0D, 0xB5, 0xD0, 0x15, 0x4F, 0x4B, 0x7C, 0xE2, 0xA8, 0xD5, 0x54, 0x54,
-	0x32, 0xA1, 0x04, 0xE2, 0x59, 0x28, 0x0A, 0x39, 0x98, 0x8D, 0x4D, 0xD9,
-	0x9F, 0x51, 0xEF, 0xAF, 0xE8, 0x9F, 0xD9, 0x78, 0x7E, 0xE1, 0x82, 0x76,
-	0xBC, 0x28, 0xFA, 0x71, 0x01, 0xC8, 0x6C, 0x61, 0xB2, 0x56, 0x5F, 0xC6,
-	0x95, 0xBF, 0xEA, 0xDA, 0x11, 0x1E, 0x5F, 0x45, 0xD9, 0xC7, 0xFE, 0x46,
-	0xA1, 0xA8, 0xBC, 0x34, 0x88, 0x05, 0x7D, 0xC8, 0xE9, 0xFD, 0x41, 0x05,
-	0x06, 0x9A, 0xFF, 0x0B, 0x70, 0x5D, 0xEC, 0x9C, 0xF4, 0xBD, 0xF2, 0x5A,
-	0xDE, 0x04, 0x9D, 0xB0, 0xE7, 0xA1, 0x49, 0xDF, 0x09, 0x4D, 0x7A, 0xDF,
-	0xD0, 0x33, 0x81, 0x03, 0x8F, 0x9A, 0x35, 0x97, 0x82, 0x5A, 0x0E, 0x52,
-	0xAB, 0x8C, 0x73, 0x2A, 0x4B, 0xD4, 0x00, 0x91, 0x37, 0x45, 0x78, 0x74,
-	0x50, 0xE5, 0x40, 0x9C, 0x67, 0x8E, 0xD0, 0x72, 0x54, 0xB9, 0xAB, 0x15,
-	0x52, 0xCC, 0xDF, 0x51, 0x81, 0x04, 0x51, 0x1A, 0x74, 0x68, 0xEA, 0xD0,
-	0x41, 0xAB, 0x3A, 0xFD, 0x42, 0xDF, 0x85, 0x27, 0x9D, 0x63, 0xE0, 0xCF,
-	0x7D, 0xEA, 0xA9, 0xA7, 0x1E, 0x80, 0x7B, 0xD8, 0x01, 0xD0, 0xEA, 0xFE,
-	0x9D, 0x10, 0xDE, 0x06, 0x5D, 0x1C, 0xAE, 0x93, 0x27, 0x62, 0x03, 0x71,
-	0x08, 0xFA, 0xBD, 0x09, 0x13, 0x3F, 0x91, 0x9C, 0x56, 0x58, 0x61, 0x85,
-	0x82, 0x6C, 0x90, 0xC8, 0x48, 0xD8, 0x22, 0x46, 0x4E, 0x6E, 0xF2, 0x64,
-	0x28, 0xE5, 0xA5, 0x59, 0x87, 0x08, 0x57, 0x19, 0x18, 0xC3, 0x15, 0x4E,
-	0xB1, 0xC7, 0x85, 0x3C, 0x89, 0xA4, 0xDD, 0x46, 0x4D, 0x10, 0x71, 0x34,
-	0xE8, 0xD0, 0xDC, 0xA7, 0xB1, 0x40, 0x33, 0x86, 0x4E, 0xAC, 0xE1, 0x58,
-	0xE1, 0xB8, 0x80, 0xDD, 0xFC, 0x3E, 0xB8, 0x72, 0xEE, 0x55, 0xCA, 0xFB,
-	0xE6, 0xED, 0x5E, 0x13, 0x74, 0x2D, 0x7A, 0x1C, 0xF6, 0xB3, 0x5B, 0xB0,
-	0x71, 0x78, 0x00, 0x6F, 0x45, 0x72, 0x97, 0x0A, 0x24, 0xF9, 0x29, 0x3C,
-	0x45, 0xA7, 0x3F, 0xF3, 0x6F, 0x0E, 0x8C, 0x38, 0xB9, 0x3C, 0x6A, 0x51,
-	0x7D, 0x81, 0x98, 0xF5, 0x43, 0x72, 0xA4, 0x1D, 0x93, 0xF5, 0xC9, 0xFB,
-	0x42, 0xDA, 0x35, 0xBF, 0x8B, 0x9A, 0x00, 0xE2, 0x10, 0x74, 0x71, 0x1B,
-	0xC3, 0x41, 0xCB, 0x01, 0xC9, 0x01, 0x58, 0xB9, 0xC4, 0x9D, 0x0B, 0x62,
-	0x3E, 0x15, 0x61, 0xC0, 0x83, 0x6B, 0xF3, 0x5E, 0x8D, 0xE1, 0x1E, 0x6C,
-	0xC0, 0xB6, 0xC3, 0xD9, 0x8C, 0xB7, 0x40, 0xAB, 0xEE, 0xC0, 0xF7, 0xE1,
-	0xE9, 0xE5, 0x22, 0x66, 0x9D, 0x1A, 0x53, 0x3C, 0xD9, 0x96, 0xE3, 0xBD,
-	0xD9, 0x8F, 0xB2, 0x63, 0x87, 0x04, 0x4D, 0x25, 0x81, 0x7D, 0xA4, 0x7D,
-	0x07, 0x4D, 0x0A, 0x9A, 0xCC, 0xA3, 0xE4, 0x23, 0x0E, 0x41, 0x2B, 0x61,
-	0x14, 0xE5, 0x4F, 0xC7, 0x87, 0xF1, 0x9D, 0xBE, 0xF8, 0xE2, 0x8B, 0x0A,
-	0x98, 0x55, 0x0A, 0xB2, 0x89, 0x60, 0xA4, 0xBB, 0x90, 0x3E, 0x76, 0xDF,
-	0x72, 0xBC, 0x6B, 0x9E, 0x9E, 0x61, 0x82, 0xAE, 0x65, 0x6F, 0x23, 0xC9,
-	0xFB, 0x75, 0xB0, 0xF1, 0x1D, 0x43, 0x62, 0xE2, 0xD2, 0x8E, 0x1A, 0x03,
-	0x97, 0x72, 0xD4, 0x26, 0x78, 0x91, 0x9C, 0x43, 0xAF, 0x8F, 0x5A, 0x56,
-	0x33, 0xEF, 0x79, 0xD2, 0x92, 0x38, 0x08, 0x64, 0x0B, 0xE6, 0x67, 0x22,
-	0xEA, 0x62, 0x53, 0x08, 0xFF, 0x8F, 0x93, 0x2F, 0x22, 0x8A, 0xA0, 0x39,
-	0xE8, 0xB5, 0xC9, 0x23, 0xD7, 0xBB, 0xF0, 0x78, 0x2A, 0xBE, 0x27, 0xFF,
-	0xC7, 0x86, 0xD5, 0x04, 0x10, 0xF3, 0x81, 0x38, 0x35, 0xE4, 0xA3, 0xDA,
-	0xBE, 0x6B, 0x63, 0xBA, 0x0F, 0xDE, 0x3F, 0x97, 0x40, 0xA3, 0x3E, 0x5B,
-	0xFD, 0xA2, 0x09, 0x54, 0x7D, 0x42, 0xDC, 0xA9, 0x55, 0x47, 0xAD, 0x70,
-	0xA2, 0x30, 0xA1, 0xBC, 0x85, 0x32, 0xC1, 0xFA, 0xA2, 0x48, 0x55, 0xA6,
-	0x16, 0xFE, 0x8E, 0x72, 0x95, 0x8B, 0x7A, 0x96, 0x4C, 0x1C, 0x8A, 0x15,
-	0xA0, 0x3C, 0xF0, 0x33, 0xAD, 0x18, 0x70, 0x94, 0xD8, 0xCF, 0x90, 0x8D,
-	0x07, 0xBA, 0x77, 0xEF, 0x5E, 0x50, 0x68, 0x7C, 0x25, 0x43, 0xC0, 0x04,
-	0x9D, 0x0C, 0xAF, 0xFF, 0x57, 0x1A, 0x3E, 0xD2, 0x17, 0x9D, 0x76, 0xDA,
-	0x69, 0xFD, 0x28, 0x8C, 0xBC, 0x74, 0xF0, 0xAC, 0x84, 0x9A, 0x83, 0x30,
-	0x4E, 0x36, 0xB4, 0x24, 0x4D, 0x08, 0x97, 0xA8, 0xB2, 0x81, 0x2B, 0xF4,
-	0x58, 0xCF, 0x09, 0xCD, 0x12, 0x51, 0x1A, 0x52, 0x14, 0x41, 0x87, 0xCF,
-	0x54, 0x54, 0xA5, 0x6C, 0xA8, 0xFC, 0x0E, 0x93, 0xD3, 0xCF, 0xF0, 0xE1,
-	0x1E, 0x84, 0x64, 0x50, 0x83, 0x92, 0xBC, 0x47, 0x1E, 0xCA, 0x62, 0x23,
-	0x6C, 0x37, 0xD8, 0xDF, 0xAF, 0x84, 0x5D, 0x76, 0x6D, 0xBA, 0x2B, 0x86,
-	0xDE, 0x3A, 0xE5, 0x5E, 0x5D, 0xB1, 0x1F, 0x49, 0x92, 0xBC, 0x94, 0x93,
-	0x9A, 0x7F, 0x73, 0x4F, 0x40, 0x26, 0x29, 0x45, 0xEE, 0x85, 0x7D, 0x1A,
-	0xD5, 0x0F, 0x71, 0x08, 0xBA, 0xD8, 0xAF, 0x9F, 0x93, 0x06, 0x65, 0x13,
-	0xF5, 0xCD, 0x41, 0x20, 0xD4, 0xF9, 0x48, 0x9B, 0x70, 0x51, 0x54, 0x3D,
-	0xFE, 0xBE, 0x6A, 0x04, 0x4C, 0xD0, 0x25, 0x4A, 0x06, 0x1C, 0xFA, 0x77,
-	0x45, 0x22, 0xFB, 0x1B, 0xB0, 0x33, 0xDE, 0x82, 0x1A, 0x33, 0x97, 0x78,
-	0x1C, 0x8C, 0x61, 0x92, 0x98, 0x52, 0xAA, 0x90, 0xAD, 0x90, 0xCF, 0xA8,
-	0x4A, 0x73, 0xD6, 0x46, 0x60, 0xB8, 0xC4, 0x65, 0x59, 0x0D, 0xAC, 0x28,
-	0x2D, 0x3A, 0x8A, 0xA0, 0xC3, 0x9C, 0xD8, 0xA1, 0xAD, 0x11, 0x3B, 0xF7,
-	0x7F, 0xC0, 0x57, 0xFB, 0xF5, 0x93, 0x4E, 0x3A, 0xE9, 0x60, 0xB8, 0xCF,
-	0xBD, 0x53, 0xCA, 0x3B, 0x36, 0xE6, 0x7B, 0x99, 0xBE, 0x14, 0x91, 0x78,
-	0x57, 0x23, 0x20, 0xE3, 0x18, 0xF6, 0x05, 0x09, 0x93, 0xBF, 0xA9, 0xB9,
-	0xD2, 0x24, 0xA6, 0x13, 0x58, 0x6A, 0x8B, 0x01, 0x6D, 0xDD, 0x24, 0xC8,
-	0xE2, 0x7E, 0xA6, 0xDC, 0x50, 0x1E, 0xA5, 0x21, 0x6B, 0xA5, 0x25, 0xD9,
-	0x08, 0x95, 0x88, 0x9A, 0xEA, 0x8E, 0x22, 0xE8, 0xF0, 0x5E, 0x9A, 0x73,
-	0xD8, 0x16, 0x6E, 0x06, 0xE2, 0xC0, 0x8A, 0x8F, 0x90, 0x4F, 0xE4, 0x84,
-	0x9B, 0x6F, 0xBE, 0xF9, 0xA1, 0xDA, 0xBE, 0x9B, 0xEF, 0x2B, 0xC1, 0x7F,
-	0xD3, 0xE0, 0xFD, 0x17, 0x01, 0xEC, 0x4A, 0xB7, 0xC5, 0x79, 0x73, 0x17,
-	0xF4, 0xEA, 0xD5, 0xAB, 0x10, 0xB8, 0x20, 0x0D, 0x22, 0x6A, 0xF9, 0x18,
-	0x17, 0x43, 0x6A, 0x23, 0x61, 0xBA, 0x4B, 0x11, 0xB5, 0xC2, 0x66, 0x65,
-	0x7B, 0x94, 0xF6, 0x24, 0xAD, 0x5D, 0x93, 0x44, 0x4D, 0xF5, 0x44, 0x11,
-	0x74, 0x55, 0xE9, 0x42, 0x99, 0x81, 0x6E, 0xF8, 0xF0, 0xE1, 0x57, 0xC2,
-	0x07, 0xF8, 0x8A, 0xB8, 0xEF, 0x90, 0xF7, 0x72, 0xF0, 0x47, 0xDF, 0x02,
-	0x2E, 0x87, 0x97, 0xC0, 0x46, 0xBD, 0x35, 0x31, 0x0F, 0x23, 0xEA, 0x4A,
-	0xC1, 0x46, 0xAE, 0x7A, 0x7A, 0x66, 0xA5, 0x37, 0xCF, 0xFF, 0x78, 0x69,
-	0x84, 0x44, 0x1B, 0xEE, 0x61, 0x44, 0xAD, 0xF0, 0xE2, 0x10, 0x74, 0x71,
-	0xFE, 0xF4, 0x31, 0x63, 0xC6, 0xDC, 0x84, 0xD0, 0xF4, 0x4B, 0x60, 0xEE,
-	0x7A, 0xAF, 0x94, 0x77, 0xF3, 0xBD, 0x26, 0xE8, 0xB2, 0xCA, 0x40, 0xBF,
-	0x7E, 0xFD, 0xFA, 0x62, 0xA9, 0x7F, 0x09, 0x34, 0x88, 0x85, 0xE9, 0x0F,
-	0xCB, 0xCD, 0xA1, 0xD0, 0x15, 0x8F, 0xDA, 0x28, 0x35, 0x0C, 0x6A, 0xD9,
-	0x1C, 0x18, 0xDA, 0x41, 0x17, 0xC1, 0x6A, 0x73, 0x2F, 0xD4, 0x6E, 0xE2,
-	0x0C, 0x90, 0x9A, 0x5E, 0x42, 0xDE, 0x02, 0xC5, 0xDA, 0x77, 0x58, 0x47,
-	0x78, 0x7A, 0x35, 0x07, 0x1B, 0x27, 0x16, 0x7E, 0x2F, 0x1B, 0xBA, 0x34,
-	0x3D, 0x3C, 0x6B, 0x16, 0x22, 0x1D, 0xC7, 0x8E, 0x1A, 0x35, 0x6A, 0x00,
-	0x3C, 0x34, 0x3E, 0x2E, 0x2B, 0x78, 0x39, 0x78, 0x18, 0x8F, 0xD5, 0xC2,
-	0x81, 0xC2, 0xC7, 0x21, 0xD7, 0xF6, 0xA9, 0xF0, 0xEE, 0x58, 0x8A, 0xF8,
-	0xF2, 0x92, 0xB7, 0x43, 0x18, 0xB4, 0x52, 0x7C, 0xD8, 0x81, 0x02, 0x9E,
-	0xE2, 0xD8, 0x98, 0x6B, 0x03, 0x65, 0x75, 0xA6, 0x30, 0xD6, 0xA7, 0x04,
-	0x49, 0x7C, 0x2E, 0x35, 0x76, 0xB6, 0x57, 0xD9, 0xFC, 0xF8, 0x37, 0x65,
-	0x86, 0x5A, 0x33, 0x5D, 0x2B, 0x47, 0x8C, 0x18, 0x71, 0x15, 0xA2, 0x03,
-	0x07, 0xD6, 0xA6, 0x0D, 0xBE, 0xE7, 0x7F, 0x11, 0xB0, 0x89, 0xA3, 0xCC,
-	0x52, 0x81, 0xE3, 0x7A, 0x3A, 0x41, 0x53, 0xBA, 0x0C, 0x67, 0xF8, 0x75,
-	0x91, 0xCD, 0x91, 0xC2, 0xCC, 0x01, 0xC0, 0x41, 0xA7, 0xE4, 0x43, 0xB2,
-	0x13, 0x73, 0xE0, 0x15, 0x0F, 0xBA, 0xAA, 0xB4, 0xDA, 0x52, 0x9A, 0x29,
-	0xBB, 0x35, 0x9F, 0x11, 0x12, 0xB5, 0xB4, 0x7D, 0xB6, 0x89, 0x6D, 0xE3,
-	0xC4, 0xC1, 0x4D, 0x4F, 0x92, 0x3A, 0x49, 0x99, 0x61, 0xBC, 0xB4, 0xAF,
-	0x73, 0x19, 0x8E, 0x60, 0x88, 0xD7, 0xE1, 0xA1, 0x91, 0xE9, 0x5C, 0xC5,
-	0xA5, 0x60, 0x94, 0xE6, 0xBD, 0x0C, 0x15, 0x87, 0xCF, 0xF4, 0x29, 0xC8,
-	0x8E, 0x77, 0x84, 0xB0, 0x26, 0xC1, 0x85, 0x69, 0x6C, 0xA5, 0x09, 0x57,
-	0x25, 0x1F, 0x6C, 0xAB, 0xB4, 0xE0, 0x28, 0x0D, 0x38, 0xEA, 0xBD, 0x34,
-	0x81, 0x4B, 0x06, 0xB5, 0x2A, 0x93, 0xD7, 0x07, 0x27, 0x8D, 0x30, 0x15,
-	0x00, 0xE5, 0x23, 0x8C, 0x7A, 0x94, 0x06, 0x8F, 0x09, 0xFB, 0x89, 0xF3,
-	0xCE, 0x3B, 0xEF, 0x0C, 0x9C, 0x1C, 0x34, 0x29, 0xAA, 0x4E, 0x7F, 0x1F,
-	0x1F, 0x01, 0x13, 0x74, 0x7C, 0xAC, 0x12, 0x95, 0x84, 0x6D, 0x7A, 0x1F,
-	0xE4, 0xB7, 0x1D, 0x06, 0x4D, 0xA9, 0x39, 0x07, 0x9E, 0x42, 0xBC, 0xA9,
-	0x71, 0x28, 0x29, 0x91, 0x3E, 0x0F, 0x23, 0xF4, 0x44, 0xDC, 0x71, 0x7C,
-	0xA8, 0xE3, 0x34, 0x28, 0x1C, 0x80, 0x61, 0x70, 0x82, 0x32, 0xA7, 0xB1,
-	0x3D, 0x3A, 0x2F, 0x4F, 0xDF, 0xF3, 0x3B, 0x7E, 0x4E, 0x72, 0x86, 0xAB,
-	0xD4, 0x27, 0x88, 0x04, 0x1C, 0x80, 0x25, 0xEB, 0xE8, 0x38, 0xF5, 0xB9,
-	0x4C, 0x3C, 0x04, 0xB0, 0x71, 0xD8, 0x0C, 0x11, 0x9F, 0xED, 0x21, 0x23,
-	0xD7, 0xE0, 0x77, 0xC1, 0x25, 0x0F, 0xA7, 0x62, 0x17, 0x72, 0x43, 0x73,
-	0x0F, 0x43, 0x5E, 0x11, 0xA1, 0x39, 0x2B, 0x94, 0x13, 0x91, 0x74, 0xA9,
-	0x04, 0xAD, 0xD6, 0x86, 0xDE, 0x40, 0xE1, 0xAA, 0x8D, 0xF2, 0xC3, 0xC9,
-	0x5B, 0x07, 0x16, 0x50, 0x8E, 0xA9, 0x31, 0x33, 0x18, 0x89, 0xDF, 0x41,
-	0x3E, 0x3E, 0xC6, 0x46, 0xE8, 0xE9, 0xA3, 0x47, 0x8F, 0xBE, 0x33, 0xDE,
-	0x9B, 0xBB, 0x54, 0x12, 0x04, 0x4C, 0xD0, 0x49, 0xD0, 0xAA, 0x45, 0x59,
-	0x92, 0x1B, 0xF2, 0x2D, 0x1F, 0x8D, 0xF4, 0xA5, 0x2D, 0x78, 0x3B, 0x7D,
-	0x86, 0x15, 0x26, 0x2E, 0x93, 0x46, 0xF1, 0x63, 0x43, 0x1B, 0x61, 0xA9,
-	0x59, 0xE5, 0xA4, 0x8D, 0x4B, 0x8B, 0xAE, 0xCA, 0xFD, 0x4E, 0xF5, 0xC9,
-	0x4B, 0x83, 0x1A, 0x35, 0xED, 0xCC, 0x88, 0x9C, 0xE4, 0x01, 0xAE, 0x27,
-	0x63, 0x33, 0xF0, 0x3F, 0xBE, 0x83, 0xBE, 0xEA, 0x04, 0x01, 0xB8, 0xD4,
-	0xEF, 0xC5, 0x43, 0x79, 0xE9, 0x3B, 0xAD, 0xFD, 0x06, 0xF9, 0x29, 0x57,
-	0x55, 0x61, 0xB8, 0x21, 0x5C, 0x53, 0xB9, 0x38, 0x8D, 0xE5, 0x4A, 0x29,
-	0xF4, 0x9B, 0xAF, 0xEA, 0x34, 0x76, 0x4E, 0xD4, 0x52, 0x2C, 0x34, 0x31,
-	0xE0, 0x90, 0xDF, 0xEF, 0x91, 0xF8, 0x6A, 0x30, 0x0E, 0x78, 0x68, 0xB0,
-	0x99, 0x09, 0xE3, 0xE0, 0x53, 0xDF, 0x65, 0x4C, 0xD0, 0x29, 0xF4, 0x00,
-	0x3C, 0x3C, 0x5A, 0x22, 0x44, 0xFC, 0x40, 0xE4, 0x40, 0x3E, 0x7A, 0x9D,
-	0x75, 0xD6, 0x69, 0xC3, 0x01, 0xA1, 0x84, 0xE7, 0xB4, 0xE9, 0x51, 0x0B,
-	0xA2, 0xC6, 0x1C, 0x0E, 0x82, 0x30, 0xF3, 0x57, 0x29, 0x4D, 0x2C, 0xF6,
-	0xC5, 0x96, 0x66, 0xA6, 0x65, 0xAA, 0xBC, 0x09, 0x38, 0xE8, 0xB1, 0x94,
-	0x9D, 0xCB, 0xBC, 0x1F, 0x38, 0xD9, 0x7A, 0x18, 0x52, 0x9F, 0x5E, 0x56,
-	0x9B, 0x24, 0x3C, 0xA5, 0xB4, 0x35, 0xAF, 0xF7, 0x02, 0xFB, 0x26, 0x98,
-	0xC0, 0x9B, 0xE3, 0xB8, 0xB5, 0x3D, 0x40, 0x78, 0xE7, 0xE0, 0xD8, 0xB1,
-	0x55, 0x98, 0x26, 0x40, 0xB6, 0x69, 0x4D, 0xB2, 0x72, 0x97, 0x8B, 0xF2,
-	0xCC, 0x29, 0x15, 0x47, 0x4D, 0x12, 0x9A, 0xD4, 0x95, 0x59, 0x8F, 0x13,
-	0xF7, 0x47, 0x1F, 0x7D, 0xF4, 0x31, 0xB3, 0xE9, 0x21, 0x5A, 0xF4, 0x7A,
-	0xC8, 0x47, 0x21, 0x07, 0x8C, 0xAF, 0xBA, 0x43, 0xC0, 0x04, 0x5D, 0x77,
-	0xD8, 0xFE, 0xCF, 0x93, 0x11, 0x71, 0xB8, 0x08, 0x7C, 0x63, 0x8F, 0x84,
-	0xED, 0xF1, 0x98, 0xB5, 0xD7, 0x5E, 0xBB, 0x9D, 0x12, 0xE8, 0x48, 0x2B,
-	0xD1, 0x86, 0x62, 0x68, 0x0F, 0x2C, 0x75, 0x93, 0x50, 0xE6, 0x0A, 0xB9,
-	0xE3, 0x15, 0xEF, 0xE6, 0x83, 0x90, 0x0B, 0xF9, 0x13, 0x40, 0x08, 0x3F,
-	0x22, 0xB8, 0x62, 0x00, 0x32, 0xCF, 0x8D, 0xB0, 0xC6, 0x9C, 0xA2, 0x50,
-	0x14, 0x55, 0xC5, 0x7C, 0xCC, 0x48, 0x7A, 0x75, 0x70, 0xEF, 0xDE, 0xBD,
-	0xFB, 0xC0, 0xF4, 0xB1, 0x61, 0x55, 0xAB, 0x2B, 0x7E, 0x56, 0xAA, 0x5C,
-	0xE8, 0xB9, 0x0A, 0x44, 0xE2, 0xC4, 0x4D, 0x42, 0xE6, 0x24, 0x10, 0x2A,
-	0x0A, 0x95, 0x13, 0xFC, 0x1C, 0x1C, 0xBF, 0x35, 0x09, 0x2E, 0x73, 0xC3,
-	0x07, 0x0F, 0x1E, 0xFC, 0xB7, 0xFA, 0x43, 0x27, 0x7F, 0x35, 0x9B, 0xA0,
-	0xEB, 0xA9, 0xCF, 0xA1, 0x2D, 0x75, 0x82, 0x46, 0x7D, 0x30, 0xDC, 0xAE,
-	0xF6, 0x86, 0xC9, 0x63, 0x09, 0x6C, 0xBE, 0x2C, 0x5A, 0x8E, 0xD3, 0x4B,
-	0xAA, 0x5B, 0x12, 0x73, 0x99, 0xAA, 0xF0, 0x73, 0x79, 0x92, 0xC0, 0xDC,
-	0xF2, 0x2B, 0xB2, 0xE3, 0x4D, 0x42, 0xC0, 0x4D, 0x1F, 0x84, 0xE2, 0xBE,
-	0x59, 0x4F, 0x50, 0xB8, 0xDA, 0x6A, 0x10, 0x80, 0x0F, 0x75, 0x37, 0x04,
-	0x42, 0x9D, 0x07, 0xBB, 0xF4, 0x4A, 0xCB, 0x2F, 0xBF, 0xFC, 0x8A, 0xDC,
-	0xA0, 0x23, 0x31, 0x93, 0x54, 0x49, 0x9C, 0x71, 0x72, 0xAD, 0xD4, 0x06,
-	0x5C, 0x2A, 0x0E, 0x90, 0x8D, 0x9F, 0xB0, 0xCA, 0xFB, 0x15, 0x9A, 0xF2,
-	0xC3, 0x88, 0x9A, 0xBD, 0xDC, 0xBE, 0xEE, 0xB5, 0x41, 0xB2, 0xF4, 0x7B,
-	0x4C, 0xD0, 0xA5, 0x63, 0x58, 0xD2, 0x13, 0xB0, 0x9C, 0x5D, 0xA2, 0x7D,
-	0xFB, 0xF6, 0x5B, 0x21, 0x89, 0x4C, 0x77, 0xEC, 0xEE, 0x77, 0x59, 0x75,
-	0xD5, 0x55, 0x57, 0x66, 0xF6, 0x31, 0x69, 0xD3, 0xA5, 0xDA, 0xA0, 0x39,
-	0x90, 0xC3, 0x08, 0x32, 0x0C, 0xBA, 0x9F, 0x90, 0x5F, 0xFA, 0x4D, 0xD8,
-	0x97, 0xC7, 0x21, 0xD7, 0xF4, 0xE3, 0x4F, 0x3F, 0xFD, 0xF4, 0xBB, 0x25,
-	0xBD, 0x80, 0x6F, 0xAE, 0x73, 0x04, 0x10, 0xE8, 0xB2, 0x21, 0xF2, 0x35,
-	0xFF, 0x09, 0x3F, 0xBB, 0x62, 0xE5, 0xB5, 0x3A, 0xBC, 0x6B, 0x0A, 0x59,
-	0xF2, 0xC3, 0x88, 0xD1, 0xDA, 0x36, 0x22, 0x0C, 0xA8, 0xC2, 0xDF, 0x33,
-	0x61, 0xC2, 0x98, 0x86, 0xA4, 0x46, 0xCF, 0x22, 0x17, 0xF9, 0x9D, 0x08,
-	0x36, 0x19, 0xEF, 0xD5, 0x54, 0x6D, 0x91, 0x2D, 0xCF, 0x7D, 0x26, 0xE8,
-	0xF2, 0xE0, 0x58, 0x96, 0xA7, 0x30, 0x7F, 0x2F, 0x72, 0x3D, 0xAF, 0x8B,
-	0x5C, 0xCE, 0x9D, 0xB1, 0x61, 0xD4, 0xB9, 0x4D, 0x9B, 0x36, 0xAB, 0xC1,
-	0x36, 0xB9, 0x06, 0x34, 0xDE, 0x85, 0x61, 0x1F, 0x6E, 0x06, 0x33, 0x45,
-	0x21, 0x55, 0x64, 0x18, 0x15, 0xC6, 0x8F, 0x94, 0x0C, 0x47, 0x1B, 0x80,
-	0xC1, 0xF2, 0x77, 0x2E, 0xCB, 0x7F, 0xF8, 0xE1, 0x87, 0x9F, 0x3F, 0xFF,
-	0xFC, 0xF3, 0xCF, 0x22, 0x70, 0xE0, 0xB1, 0xC9, 0x93, 0x27, 0x43, 0x19,
-	0x9A, 0xE0, 0xF3, 0xDF, 0xCA, 0xD2, 0x63, 0xE9, 0x3F, 0x04, 0x72, 0xD1,
-	0x76, 0xEB, 0xAD, 0xB7, 0xDE, 0x19, 0x2B, 0xAF, 0x3D, 0x60, 0x02, 0x59,
-	0x17, 0xDE, 0x14, 0x4B, 0x62, 0x12, 0x5F, 0x00, 0x7D, 0x3E, 0xBF, 0x5A,
-	0xA3, 0x4D, 0x44, 0xFE, 0xAE, 0xC6, 0x5E, 0x3D, 0x17, 0x2B, 0xAA, 0x5F,
-	0xE1, 0x9D, 0xF1, 0x1B, 0x48, 0xF8, 0x3D, 0x9C, 0x6E, 0xF2, 0xE1, 0x8B,
-	0x2F, 0xBE, 0xF8, 0x3C, 0xFE, 0x46, 0x4A, 0xE9, 0x7F, 0x4C, 0x49, 0xFF,
-	0xAD, 0x5C, 0x63, 0x75, 0x08, 0x98, 0xA0, 0x33, 0x2E, 0x1B, 0x38, 0xB5,
-	0x63, 0x79, 0x68, 0xD3, 0x2B, 0xC0, 0x7E, 0xDD, 0xA6, 0x45, 0x8B, 0x16,
-	0xAD, 0xF1, 0xBB, 0x15, 0x96, 0xBB, 0xCD, 0x71, 0xFC, 0xD0, 0x72, 0x70,
-	0x7D, 0x6A, 0x86, 0x0D, 0x9C, 0x05, 0xA0, 0x70, 0xCF, 0x0F, 0xA2, 0x6E,
-	0x0A, 0x6D, 0x79, 0xD6, 0xB7, 0xDF, 0x7E, 0xFB, 0x1D, 0xB4, 0x1E, 0x9C,
-	0x86, 0xF4, 0xEE, 0xDB, 0x38, 0x4D, 0xFC, 0x63, 0xB8, 0x41, 0x4D, 0xC2,
-	0x67, 0xBF, 0x58, 0x13, 0xCA, 0x78, 0x47, 0x27, 0x6C, 0x1E, 0xC8, 0x77,
-	0x3E, 0x9C, 0x90, 0xB3, 0x10, 0x34, 0xEA, 0xF5, 0x90, 0x78, 0x7F, 0xB5,
-	0xB5, 0xD6, 0x5A, 0x6B, 0xFD, 0x75, 0xD7, 0x5D, 0x77, 0x3D, 0xC8, 0xC8,
-	0x4A, 0x9C, 0xD0, 0x31, 0x69, 0xCF, 0x02, 0x01, 0xFF, 0x81, 0x3D, 0x88,
-	0x99, 0xD8, 0x88, 0xFE, 0x05, 0x61, 0xD8, 0xDF, 0x21, 0x6F, 0xCA, 0x97,
-	0x50, 0x00, 0x90, 0x80, 0xF1, 0xF3, 0x69, 0xF0, 0xC2, 0xF8, 0x18, 0xDF,
-	0x7D, 0x83, 0xFC, 0xCC, 0xDF, 0x25, 0xAC, 0xDA, 0xC5, 0x53, 0x44, 0xC0,
-	0x04, 0x9D, 0x22, 0xD8, 0xAE, 0xCA, 0x08, 0x18, 0x01, 0x23, 0x90, 0x04,
-	0x01, 0x13, 0x74, 0x12, 0xB4, 0x5C, 0xD6, 0x08, 0x18, 0x01, 0x23, 0x90,
-	0x22, 0x02, 0x26, 0xE8, 0x14, 0xC1, 0x76, 0x55, 0x46, 0xC0, 0x08, 0x18,
-	0x81, 0x24, 0x08, 0x98, 0xA0, 0x93, 0xA0, 0xE5, 0xB2, 0x46, 0xC0, 0x08,
-	0x18, 0x81, 0x14, 0x11, 0x30, 0x41, 0xA7, 0x08, 0xB6, 0xAB, 0x32, 0x02,
-	0x46, 0xC0, 0x08, 0x24, 0x41, 0xC0, 0x04, 0x9D, 0x04, 0x2D, 0x97, 0x35,
-	0x02, 0x46, 0xC0, 0x08, 0xA4, 0x88, 0x80, 0x09, 0x3A, 0x45, 0xB0, 0x5D,
-	0x95, 0x11, 0x30, 0x02, 0x46, 0x20, 0x09, 0x02, 0x26, 0xE8, 0x24, 0x68,
-	0xB9, 0xAC, 0x11, 0x30, 0x02, 0x46, 0x20, 0x45, 0x04, 0x4C, 0xD0, 0x29,
-	0x82, 0xED, 0xAA, 0x8C, 0x80, 0x11, 0x30, 0x02, 0x49, 0x10, 0x30, 0x41,
-	0x27, 0x41, 0xCB, 0x65, 0x8D, 0x80, 0x11, 0x30, 0x02, 0x29, 0x22, 0x60,
-	0x82, 0x4E, 0x11, 0x6C, 0x57, 0x65, 0x04, 0x8C, 0x80, 0x11, 0x48, 0x82,
-	0x80, 0x09, 0x3A, 0x09, 0x5A, 0x2E, 0x6B, 0x04, 0x8C, 0x80, 0x11, 0x48,
-	0x11, 0x01, 0x13, 0x74, 0x8A, 0x60, 0xBB, 0x2A, 0x23, 0x60, 0x04, 0x8C,
-	0x40, 0x12, 0x04, 0x4C, 0xD0, 0x49, 0xD0, 0x72, 0x59, 0x23, 0x60, 0x04,
-	0x8C, 0x40, 0x8A, 0x08, 0x98, 0xA0, 0x53, 0x04, 0xDB, 0x55, 0x19, 0x01,
-	0x23, 0x60, 0x04, 0x92, 0x20, 0x60, 0x82, 0x4E, 0x82, 0x96, 0xCB, 0x1A,
-	0x01, 0x23, 0x60, 0x04, 0x52, 0x44, 0xC0, 0x04, 0x9D, 0x22, 0xD8, 0xAE,
-	0xCA, 0x08, 0x18, 0x01, 0x23, 0x90, 0x04, 0x01, 0x13, 0x74, 0x12, 0xB4,
-	0x5C, 0xD6, 0x08, 0x18, 0x01, 0x23, 0x90, 0x22, 0x02, 0x26, 0xE8, 0x14,
-	0xC1, 0x76, 0x55, 0x46, 0xC0, 0x08, 0x18, 0x81, 0x24, 0x08, 0x98, 0xA0,
-	0x93, 0xA0, 0xE5, 0xB2, 0x46, 0xC0, 0x08, 0x18, 0x81, 0x14, 0x11, 0x30,
-	0x41, 0xA7, 0x08, 0xB6, 0xAB, 0x32, 0x02, 0x46, 0xC0, 0x08, 0x24, 0x41,
-	0xC0, 0x04, 0x9D, 0x04, 0x2D, 0x97, 0x35, 0x02, 0x46, 0xC0, 0x08, 0xA4,
-	0x88, 0x80, 0x09, 0x3A, 0x45, 0xB0, 0x5D, 0x95, 0x11, 0x30, 0x02, 0x46,
-	0x20, 0x09, 0x02, 0x26, 0xE8, 0x24, 0x68, 0xB9, 0xAC, 0x11, 0x30, 0x02,
-	0x46, 0x20, 0x45, 0x04, 0x4C, 0xD0, 0x29, 0x82, 0xED, 0xAA, 0x8C, 0x80,
-	0x11, 0x30, 0x02, 0x49, 0x10, 0x30, 0x41, 0x27, 0x41, 0xCB, 0x65, 0x8D,
-	0x80, 0x11, 0x30, 0x02, 0x29, 0x22, 0x60, 0x82, 0x4E, 0x11, 0x6C, 0x57,
-	0x65, 0x04, 0x8C, 0x80, 0x11, 0x48, 0x82, 0x80, 0x09, 0x3A, 0x09, 0x5A,
-	0x2E, 0x6B, 0x04, 0x8C, 0x80, 0x11, 0x48, 0x11, 0x01, 0x13, 0x74, 0x8A,
-	0x60, 0xBB, 0x2A, 0x23, 0x60, 0x04, 0x8C, 0x40, 0x12, 0x04, 0x4C, 0xD0,
-	0x49, 0xD0, 0x72, 0x59, 0x23, 0x60, 0x04, 0x8C, 0x40, 0x8A, 0x08, 0x98,
-	0xA0, 0x53, 0x04, 0xDB, 0x55, 0x19, 0x01, 0x23, 0x60, 0x04, 0x92, 0x20,
-	0x60, 0x82, 0x4E, 0x82, 0x96, 0xCB, 0x1A, 0x01, 0x23, 0x60, 0x04, 0x52,
-	0x44, 0xC0, 0x04, 0x9D, 0x22, 0xD8, 0xAE, 0xCA, 0x08, 0x18, 0x01, 0x23,
-	0x90, 0x04, 0x01, 0x13, 0x74, 0x12, 0xB4, 0x5C, 0xD6, 0x08, 0x18, 0x01,
-	0x23, 0x90, 0x22, 0x02, 0x26, 0xE8, 0x14, 0xC1, 0x76, 0x55, 0x46, 0xC0,
-	0x08, 0x18, 0x81, 0x24, 0x08, 0x98, 0xA0, 0x93, 0xA0, 0xE5, 0xB2, 0x46,
-	0xC0, 0x08, 0x18, 0x81, 0x14, 0x11, 0x30, 0x41, 0xA7, 0x08, 0xB6, 0xAB,
-	0x32, 0x02, 0x46, 0xC0, 0x08, 0x24, 0x41, 0xC0, 0x04, 0x9D, 0x04, 0x2D,
-	0x97, 0x35, 0x02, 0x46, 0xC0, 0x08, 0xA4, 0x88, 0x80, 0x09, 0x3A, 0x45,
-	0xB0, 0x5D, 0x95, 0x11, 0x30, 0x02, 0x46, 0x20, 0x09, 0x02, 0x26, 0xE8,
-	0x24, 0x68, 0xB9, 0xAC, 0x11, 0x30, 0x02, 0x46, 0x20, 0x45, 0x04, 0x4C,
-	0xD0, 0x29, 0x82, 0xED, 0xAA, 0x8C, 0x80, 0x11, 0x30, 0x02, 0x49, 0x10,
-	0x30, 0x41, 0x27, 0x41, 0xCB, 0x65, 0x8D, 0x80, 0x11, 0x30, 0x02, 0x29,
-	0x22, 0x60, 0x82, 0x4E, 0x11, 0x6C, 0x57, 0x65, 0x04, 0x8C, 0x80, 0x11,
-	0x48, 0x82, 0x80, 0x09, 0x3A, 0x09, 0x5A, 0x2E, 0x6B, 0x04, 0x8C, 0x80,
-	0x11, 0x48, 0x11, 0x01, 0x13, 0x74, 0x8A, 0x60, 0xBB, 0x2A, 0x23, 0x60,
-	0x04, 0x8C, 0x40, 0x12, 0x04, 0x4C, 0xD0, 0x49, 0xD0, 0x72, 0x59, 0x23,
-	0x60, 0x04, 0x8C, 0x40, 0x8A, 0x08, 0x98, 0xA0, 0x53, 0x04, 0xDB, 0x55,
-	0x19, 0x01, 0x23, 0x60, 0x04, 0x92, 0x20, 0x60, 0x82, 0x4E, 0x82, 0x96,
-	0xCB, 0x1A, 0x01, 0x23, 0x60, 0x04, 0x52, 0x44, 0xC0, 0x04, 0x9D, 0x22,
-	0xD8, 0xAE, 0xCA, 0x08, 0x18, 0x01, 0x23, 0x90, 0x04, 0x01, 0x13, 0x74,
-	0x12, 0xB4, 0x5C, 0xD6, 0x08, 0x18, 0x01, 0x23, 0x90, 0x22, 0x02, 0x26,
-	0xE8, 0x14, 0xC1, 0x76, 0x55, 0x46, 0xC0, 0x08, 0x18, 0x81, 0x24, 0x08,
-	0x98, 0xA0, 0x93, 0xA0, 0xE5, 0xB2, 0x46, 0xC0, 0x08, 0x18, 0x81, 0x14,
-	0x11, 0x30, 0x41, 0xA7, 0x08, 0xB6, 0xAB, 0x32, 0x02, 0x46, 0xC0, 0x08,
-	0x24, 0x41, 0xC0, 0x04, 0x9D, 0x04, 0x2D, 0x97, 0x35, 0x02, 0x46, 0xC0,
-	0x08, 0xA4, 0x88, 0x80, 0x09, 0x3A, 0x45, 0xB0, 0x5D, 0x95, 0x11, 0x30,
-	0x02, 0x46, 0x20, 0x09, 0x02, 0x26, 0xE8, 0x24, 0x68, 0xB9, 0xAC, 0x11,
-	0x30, 0x02, 0x46, 0x20, 0x45, 0x04, 0x4C, 0xD0, 0x29, 0x82, 0xED, 0xAA,
-	0x8C, 0x80, 0x11, 0x30, 0x02, 0x49, 0x10, 0x30, 0x41, 0x27, 0x41, 0xCB,
-	0x65, 0x8D, 0x80, 0x11, 0x30, 0x02, 0x29, 0x22, 0x60, 0x82, 0x4E, 0x11,
-	0x6C, 0x57, 0x65, 0x04, 0x8C, 0x80, 0x11, 0x48, 0x82, 0x80, 0x09, 0x3A,
-	0x09, 0x5A, 0x2E, 0x6B, 0x04, 0x8C, 0x80, 0x11, 0x48, 0x11, 0x01, 0x13,
-	0x74, 0x8A, 0x60, 0xBB, 0x2A, 0x23, 0x60, 0x04, 0x8C, 0x40, 0x12, 0x04,
-	0x4C, 0xD0, 0x49, 0xD0, 0x72, 0x59, 0x23, 0x60, 0x04, 0x8C, 0x40, 0x8A,
-	0x08, 0x98, 0xA0, 0x53, 0x04, 0xDB, 0x55, 0x19, 0x01, 0x23, 0x60, 0x04,
-	0x92, 0x20, 0x60, 0x82, 0x4E, 0x82, 0x96, 0xCB, 0x1A, 0x01, 0x23, 0x60,
-	0x04, 0x52, 0x44, 0xC0, 0x04, 0x9D, 0x22, 0xD8, 0xAE, 0xCA, 0x08, 0x18,
-	0x01, 0x23, 0x90, 0x04, 0x01, 0x13, 0x74, 0x12, 0xB4, 0x5C, 0xD6, 0x08,
-	0x18, 0x01, 0x23, 0x90, 0x22, 0x02, 0x26, 0xE8, 0x14, 0xC1, 0x76, 0x55,
-	0x46, 0xC0, 0x08, 0x18, 0x81, 0x24, 0x08, 0x98, 0xA0, 0x93, 0xA0, 0xE5,
-	0xB2, 0x46, 0xC0, 0x08, 0x18, 0x81, 0x14, 0x11, 0x30, 0x41, 0xA7, 0x08,
-	0xB6, 0xAB, 0x32, 0x02, 0x46, 0xC0, 0x08, 0x24, 0x41, 0xC0, 0x04, 0x9D,
-	0x04, 0x2D, 0x97, 0x35, 0x02, 0x46, 0xC0, 0x08, 0xA4, 0x88, 0x80, 0x09,
-	0x3A, 0x45, 0xB0, 0x5D, 0x95, 0x11, 0x30, 0x02, 0x46, 0x20, 0x09, 0x02,
-	0x26, 0xE8, 0x24, 0x68, 0xB9, 0xAC, 0x11, 0x30, 0x02, 0x46, 0x20, 0x45,
-	0x04, 0x4C, 0xD0, 0x29, 0x82, 0xED, 0xAA, 0x8C, 0x80, 0x11, 0x30, 0x02,
-	0x49, 0x10, 0x30, 0x41, 0x27, 0x41, 0xCB, 0x65, 0x8D, 0x80, 0x11, 0x30,
-	0x02, 0x29, 0x22, 0x60, 0x82, 0x4E, 0x11, 0x6C, 0x57, 0x65, 0x04, 0x8C,
-	0x80, 0x11, 0x48, 0x82, 0x80, 0x09, 0x3A, 0x09, 0x5A, 0x2E, 0x6B, 0x04,
-	0x8C, 0x80, 0x11, 0x48, 0x11, 0x01, 0x13, 0x74, 0x8A, 0x60, 0xBB, 0x2A,
-	0x23, 0x60, 0x04, 0x8C, 0x40, 0x12, 0x04, 0x4C, 0xD0, 0x49, 0xD0, 0x72,
-	0x59, 0x23, 0x60, 0x04, 0x8C, 0x40, 0x8A, 0x08, 0x98, 0xA0, 0x53, 0x04,
-	0xDB, 0x55, 0x19, 0x01, 0x23, 0x60, 0x04, 0x92, 0x20, 0x60, 0x82, 0x4E,
-	0x82, 0x96, 0xCB, 0x1A, 0x01, 0x23, 0x60, 0x04, 0x52, 0x44, 0xC0, 0x04,
-	0x9D, 0x22, 0xD8, 0xAE, 0xCA, 0x08, 0x18, 0x01, 0x23, 0x90, 0x04, 0x01,
-	0x13, 0x74, 0x12, 0xB4, 0x5C, 0xD6, 0x08, 0x18, 0x01, 0x23, 0x90, 0x22,
-	0x02, 0x26, 0xE8, 0x14, 0xC1, 0x76, 0x55, 0x46, 0xC0, 0x08, 0x18, 0x81,
-	0x24, 0x08, 0x98, 0xA0, 0x93, 0xA0, 0xE5, 0xB2, 0x46, 0xC0, 0x08, 0x18,
-	0x81, 0x14, 0x11, 0x30, 0x41, 0xA7, 0x08, 0xB6, 0xAB, 0x32, 0x02, 0x46,
-	0xC0, 0x08, 0x24, 0x41, 0xC0, 0x04, 0x9D, 0x04, 0x2D, 0x97, 0x35, 0x02,
-	0x46, 0xC0, 0x08, 0xA4, 0x88, 0x80, 0x09, 0x3A, 0x45, 0xB0, 0x5D, 0x95,
-	0x11, 0x30, 0x02, 0x46, 0x20, 0x09, 0x02, 0x26, 0xE8, 0x24, 0x68, 0xB9,
-	0xAC, 0x11, 0x30, 0x02, 0x46, 0x20, 0x45, 0x04, 0x4C, 0xD0, 0x29, 0x82,
-	0xED, 0xAA, 0x8C, 0x80, 0x11, 0x30, 0x02, 0x49, 0x10, 0x30, 0x41, 0x27,
-	0x41, 0xCB, 0x65, 0x8D, 0x80, 0x11, 0x30, 0x02, 0x29, 0x22, 0x60, 0x82,
-	0x4E, 0x11, 0x6C, 0x57, 0x65, 0x04, 0x8C, 0x80, 0x11, 0x48, 0x82, 0x80,
-	0x09, 0x3A, 0x09, 0x5A, 0x2E, 0x6B, 0x04, 0x8C, 0x80, 0x11, 0x48, 0x11,
-	0x01, 0x13, 0x74, 0x8A, 0x60, 0xBB, 0x2A, 0x23, 0x60, 0x04, 0x8C, 0x40,
-	0x12, 0x04, 0x4C, 0xD0, 0x49, 0xD0, 0x72, 0x59, 0x23, 0x60, 0x04, 0x8C,
-	0x40, 0x8A, 0x08, 0x98, 0xA0, 0x53, 0x04, 0xDB, 0x55, 0x19, 0x01, 0x23,
-	0x60, 0x04, 0x92, 0x20, 0x60, 0x82, 0x4E, 0x82, 0x96, 0xCB, 0x1A, 0x01,
-	0x23, 0x60, 0x04, 0x52, 0x44, 0xC0, 0x04, 0x9D, 0x22, 0xD8, 0xAE, 0xCA,
-	0x08, 0x18, 0x01, 0x23, 0x90, 0x04, 0x01, 0x13, 0x74, 0x12, 0xB4, 0x5C,
-	0xD6, 0x08, 0x18, 0x01, 0x23, 0x90, 0x22, 0x02, 0x26, 0xE8, 0x14, 0xC1,
-	0x76, 0x55, 0x46, 0xC0, 0x08, 0x18, 0x81, 0x24, 0x08, 0x98, 0xA0, 0x93,
-	0xA0, 0xE5, 0xB2, 0x46, 0xC0, 0x08, 0x18, 0x81, 0x14, 0x11, 0x30, 0x41,
-	0xA7, 0x08, 0xB6, 0xAB, 0x32, 0x02, 0x46, 0xC0, 0x08, 0x24, 0x41, 0xC0,
-	0x04, 0x9D, 0x04, 0x2D, 0x97, 0x35, 0x02, 0x46, 0xC0, 0x08, 0xA4, 0x88,
-	0x80, 0x09, 0x3A, 0x45, 0xB0, 0x5D, 0x95, 0x11, 0x30, 0x02, 0x46, 0x20,
-	0x09, 0x02, 0x26, 0xE8, 0x24, 0x68, 0xB9, 0xAC, 0x11, 0x30, 0x02, 0x46,
-	0x20, 0x45, 0x04, 0x4C, 0xD0, 0x29, 0x82, 0xED, 0xAA, 0x8C, 0x80, 0x11,
-	0x30, 0x02, 0x49, 0x10, 0x30, 0x41, 0x27, 0x41, 0xCB, 0x65, 0x8D, 0x80,
-	0x11, 0x30, 0x02, 0x29, 0x22, 0x60, 0x82, 0x4E, 0x11, 0x6C, 0x57, 0x65,
-	0x04, 0x8C, 0x80, 0x11, 0x48, 0x82, 0x80, 0x09, 0x3A, 0x09, 0x5A, 0x2E,
-	0x6B, 0x04, 0x8C, 0x80, 0x11, 0x48, 0x11, 0x01, 0x13, 0x74, 0x8A, 0x60,
-	0xBB, 0x2A, 0x23, 0x60, 0x04, 0x8C, 0x40, 0x12, 0x04, 0x4C, 0xD0, 0x49,
-	0xD0, 0x72, 0x59, 0x23, 0x60, 0x04, 0x8C, 0x40, 0x8A, 0x08, 0x98, 0xA0,
-	0x53, 0x04, 0xDB, 0x55, 0x19, 0x01, 0x23, 0x60, 0x04, 0x92, 0x20, 0x60,
-	0x82, 0x4E, 0x82, 0x96, 0xCB, 0x1A, 0x01, 0x23, 0x60, 0x04, 0x52, 0x44,
-	0xC0, 0x04, 0x9D, 0x22, 0xD8, 0xAE, 0xCA, 0x08, 0x18, 0x01, 0x23, 0x90,
-	0x04, 0x01, 0x13, 0x74, 0x12, 0xB4, 0x5C, 0xD6, 0x08, 0x18, 0x01, 0x23,
-	0x90, 0x22, 0x02, 0x26, 0xE8, 0x14, 0xC1, 0x76, 0x55, 0x46, 0xC0, 0x08,
-	0x18, 0x81, 0x24, 0x08, 0x98, 0xA0, 0x93, 0xA0, 0xE5, 0xB2, 0x46, 0xC0,
-	0x08, 0x18, 0x81, 0x14, 0x11, 0x30, 0x41, 0xA7, 0x08, 0xB6, 0xAB, 0x32,
-	0x02, 0x46, 0xC0, 0x08, 0x24, 0x41, 0xC0, 0x04, 0x9D, 0x04, 0x2D, 0x97,
-	0x35, 0x02, 0x46, 0xC0, 0x08, 0xA4, 0x88, 0x80, 0x09, 0x3A, 0x45, 0xB0,
-	0x5D, 0x95, 0x11, 0x30, 0x02, 0x46, 0x20, 0x09, 0x02, 0x26, 0xE8, 0x24,
-	0x68, 0xB9, 0xAC, 0x11, 0x30, 0x02, 0x46, 0x20, 0x45, 0x04, 0x4C, 0xD0,
-	0x29, 0x82, 0xED, 0xAA, 0x8C, 0x80, 0x11, 0x30, 0x02, 0x49, 0x10, 0x30,
-	0x41, 0x27, 0x41, 0xCB, 0x65, 0x8D, 0x80, 0x11, 0x30, 0x02, 0x29, 0x22,
-	0x60, 0x82, 0x4E, 0x11, 0x6C, 0x57, 0x65, 0x04, 0x8C, 0x80, 0x11, 0x48,
-	0x82, 0x80, 0x09, 0x3A, 0x09, 0x5A, 0x2E, 0x6B, 0x04, 0x8C, 0x80, 0x11,
-	0x48, 0x11, 0x01, 0x13, 0x74, 0x8A, 0x60, 0xBB, 0x2A, 0x23, 0x60, 0x04,
-	0x8C, 0x40, 0x12, 0x04, 0x4C, 0xD0, 0x49, 0xD0, 0x72, 0x59, 0x23, 0x60,
-	0x04, 0x8C, 0x40, 0x8A, 0x08, 0xFC, 0x1F, 0x86, 0x6B, 0xF4, 0xC1, 0x85,
-	0xB4, 0xE5, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x49, 0x45, 0x4E, 0x44, 0xAE,
-	0x42, 0x60, 0x82
-};
@@ -1,270 +0,0 @@
-
-inline unsigned char g_SettingIcon[3204] = {
-	0x89, 0x50, 0x4E, 0x47, 0x0D, 0x0A, 0x1A, 0x0A, 0x00, 0x00, 0x00, 0x0D,
-	0x49, 0x48, 0x44, 0x52, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80,
-	0x08, 0x06, 0x00, 0x00, 0x00, 0xC3, 0x3E, 0x61, 0xCB, 0x00, 0x00, 0x0C,
-	0x4B, 0x49, 0x44, 0x41, 0x54, 0x78, 0x5E, 0xED, 0x5D, 0x7B, 0xEC, 0x5C,
-	0x43, 0x14, 0xDE, 0x6D, 0xC5, 0x5B, 0x89, 0xA8, 0x88, 0x48, 0x13, 0x0D,
-	0xE2, 0x9D, 0x12, 0x51, 0xAF, 0xA2, 0x88, 0x78, 0xC5, 0x33, 0x15, 0x94,
-	0x94, 0xC4, 0x3B, 0x11, 0x41, 0xBC, 0xE2, 0x95, 0xD2, 0x44, 0x34, 0xC4,
-	0x3B, 0x48, 0x7F, 0x34, 0xA8, 0x77, 0x11, 0xEF, 0xA6, 0xA8, 0x47, 0x5B,
-	0x41, 0xA4, 0x84, 0x16, 0x41, 0xFA, 0x87, 0x88, 0x08, 0x22, 0x0D, 0xF5,
-	0xD6, 0xAE, 0xEF, 0xDB, 0xBD, 0xBB, 0xBF, 0x7D, 0xDC, 0xBD, 0x77, 0x1E,
-	0x67, 0x66, 0xEF, 0x9D, 0x9D, 0x49, 0xCE, 0x6F, 0xF7, 0xB7, 0x3B, 0x73,
-	0xCE, 0xCC, 0x77, 0xBE, 0x99, 0x9D, 0x3B, 0x77, 0xE6, 0xDC, 0x6A, 0x65,
-	0x88, 0x52, 0xAD, 0x56, 0xDB, 0x13, 0xCD, 0x3D, 0x1C, 0x32, 0x19, 0xB2,
-	0x23, 0x64, 0x6B, 0xC8, 0xC6, 0x90, 0xB5, 0x90, 0x55, 0x90, 0xEF, 0x20,
-	0xCB, 0x21, 0x4B, 0x21, 0xAF, 0x56, 0xAB, 0xD5, 0x6F, 0x43, 0x87, 0xA7,
-	0x1A, 0x7A, 0x03, 0xE1, 0xF4, 0x71, 0x68, 0xE3, 0xD9, 0x90, 0xF3, 0x20,
-	0x3B, 0x68, 0xB6, 0x77, 0x09, 0xF2, 0xDF, 0x0D, 0x99, 0x0F, 0x32, 0x90,
-	0x24, 0xC1, 0xA5, 0x60, 0x09, 0x00, 0xC7, 0x8F, 0x81, 0xB7, 0xCE, 0x87,
-	0xCC, 0x84, 0x6C, 0xA1, 0xE7, 0x39, 0xFA, 0x9A, 0xC5, 0x9B, 0xAF, 0x95,
-	0xCF, 0xF1, 0xCF, 0x25, 0x20, 0xC1, 0x42, 0x3D, 0x3D, 0xC5, 0xCF, 0x1D,
-	0x24, 0x01, 0xE0, 0xFC, 0x09, 0x80, 0xFE, 0x09, 0xC8, 0x7E, 0xC2, 0x2E,
-	0x18, 0x81, 0xBE, 0x8B, 0x41, 0x84, 0x3F, 0x84, 0xF5, 0x0E, 0x4C, 0x5D,
-	0x70, 0x04, 0x80, 0xF3, 0xE9, 0xF4, 0x17, 0xB4, 0x7B, 0x7D, 0x0D, 0x25,
-	0x94, 0xD0, 0x58, 0xFB, 0x09, 0x46, 0x87, 0xA3, 0x41, 0x82, 0xEF, 0x07,
-	0xE6, 0x35, 0x41, 0xC3, 0x4A, 0x4D, 0x16, 0xB4, 0xE7, 0x54, 0x15, 0x9C,
-	0x7F, 0x30, 0x0C, 0xBC, 0x02, 0xD9, 0x50, 0xCC, 0x50, 0x3A, 0x31, 0xBE,
-	0x81, 0xFE, 0xA9, 0x20, 0x01, 0x27, 0x8D, 0xA5, 0x4E, 0xC1, 0x10, 0x00,
-	0xCE, 0xDF, 0x1D, 0x9E, 0x58, 0x0C, 0xE1, 0xA4, 0xAF, 0x95, 0x52, 0xFD,
-	0xD7, 0xAF, 0xB7, 0x77, 0x7F, 0x9E, 0x96, 0x6F, 0xF4, 0x33, 0x5E, 0x2D,
-	0xEC, 0x0F, 0x12, 0xFC, 0x5A, 0x66, 0x06, 0x04, 0x41, 0x80, 0x64, 0xA6,
-	0xFF, 0x31, 0x1C, 0x31, 0xD1, 0xB3, 0x33, 0x78, 0x75, 0x30, 0xCD, 0xB3,
-	0x4D, 0x51, 0x73, 0xA1, 0x10, 0x60, 0x0E, 0x50, 0xE1, 0xA5, 0xDE, 0xE8,
-	0xBC, 0xBD, 0x09, 0x53, 0x6B, 0x22, 0x2F, 0x8A, 0x5B, 0xBB, 0xB2, 0xE9,
-	0x20, 0xC1, 0xE3, 0xCE, 0xB4, 0x3B, 0x56, 0x5C, 0x7A, 0x02, 0xA0, 0xF7,
-	0xEF, 0x05, 0x8C, 0x3E, 0x80, 0xF0, 0xBA, 0x0D, 0x04, 0xA8, 0xE1, 0x8D,
-	0x5C, 0xB3, 0x14, 0xE6, 0x86, 0x3F, 0xC0, 0xEC, 0xF6, 0x20, 0xC1, 0x6A,
-	0xC7, 0xBE, 0x72, 0xA2, 0xBE, 0x8E, 0x54, 0x6D, 0x55, 0x6D, 0x62, 0x65,
-	0xD3, 0xCA, 0xE9, 0x78, 0x3B, 0xDE, 0xC8, 0xCA, 0x1A, 0x94, 0x1A, 0xDB,
-	0x5E, 0xB2, 0xE7, 0x03, 0x35, 0xB5, 0x66, 0xBD, 0xF5, 0x40, 0x28, 0xE7,
-	0xEF, 0xBF, 0xE7, 0xD4, 0x51, 0xD9, 0x05, 0x30, 0xCE, 0x89, 0xA1, 0xA7,
-	0x64, 0x88, 0xEF, 0x68, 0xED, 0x7E, 0xC2, 0xDB, 0x79, 0x20, 0xED, 0xCA,
-	0x2A, 0x7A, 0xD0, 0x24, 0xFC, 0xC3, 0xC9, 0x13, 0x97, 0x44, 0x65, 0x92,
-	0x42, 0xB7, 0x91, 0x31, 0x94, 0xA2, 0xC5, 0x8C, 0x44, 0xCE, 0xAA, 0xA3,
-	0xAB, 0x58, 0xA6, 0xFA, 0x4A, 0x0E, 0xE0, 0x88, 0x35, 0x85, 0x04, 0x68,
-	0xFD, 0x7E, 0xA6, 0x55, 0x56, 0xAB, 0x42, 0x4A, 0x76, 0x75, 0x21, 0x89,
-	0xF9, 0x9D, 0x20, 0xD0, 0xF0, 0xD5, 0x08, 0x09, 0xF0, 0x14, 0xDE, 0x9E,
-	0xEC, 0xC4, 0x48, 0x54, 0x5A, 0x74, 0x04, 0x9E, 0xF6, 0x4A, 0x80, 0xEC,
-	0x01, 0x42, 0x6B, 0xAC, 0x49, 0x80, 0x55, 0x2D, 0xA3, 0x9A, 0x4F, 0xD0,
-	0x5F, 0x85, 0x1D, 0x0D, 0x3B, 0xB0, 0xF0, 0x4B, 0x00, 0x41, 0x78, 0x7B,
-	0x54, 0x35, 0xF1, 0xB6, 0xC1, 0x5D, 0x96, 0x26, 0xB2, 0xDA, 0x1C, 0x61,
-	0xE7, 0x87, 0x00, 0x36, 0x4E, 0x71, 0xD4, 0xF0, 0x62, 0xAA, 0xCD, 0xE4,
-	0x4C, 0x82, 0x62, 0xF3, 0xA6, 0x74, 0xFD, 0xA2, 0xD7, 0x3A, 0x35, 0x08,
-	0x00, 0xD5, 0x27, 0xCB, 0x5D, 0x39, 0x5B, 0x57, 0xAA, 0x38, 0x0A, 0x00,
-	0xCC, 0x5A, 0x00, 0x33, 0x26, 0x5C, 0x06, 0xE7, 0x8C, 0x00, 0xD6, 0x6C,
-	0xF3, 0x87, 0x5C, 0x29, 0x06, 0xDC, 0xE2, 0x50, 0xBB, 0x59, 0x93, 0x2C,
-	0x02, 0xC8, 0x3B, 0x2F, 0x57, 0x23, 0x33, 0x30, 0xC5, 0xE1, 0xC8, 0x17,
-	0x55, 0x54, 0xE6, 0x00, 0xB9, 0x6E, 0xF3, 0x55, 0x59, 0x2C, 0xF2, 0xDA,
-	0x72, 0x43, 0x60, 0x9C, 0xB0, 0xAF, 0x84, 0x37, 0xBC, 0x3A, 0x0D, 0x35,
-	0x2A, 0xDE, 0x55, 0x7D, 0x15, 0x02, 0xA4, 0xA9, 0x19, 0x50, 0x1B, 0x04,
-	0x28, 0x20, 0xA1, 0xA2, 0xA5, 0x43, 0x84, 0x0C, 0x29, 0x4A, 0x44, 0xF4,
-	0x2A, 0xF9, 0x48, 0x9F, 0x00, 0x4A, 0x6A, 0xC5, 0x33, 0xA9, 0x20, 0x22,
-	0xD0, 0xBB, 0x7B, 0xEF, 0x25, 0x8A, 0xB7, 0xA4, 0x60, 0x0A, 0x0D, 0x08,
-	0x20, 0x81, 0xB3, 0x34, 0x0A, 0x2A, 0xFC, 0x90, 0xB6, 0xE9, 0x42, 0x5F,
-	0x82, 0xAD, 0x56, 0x73, 0xEA, 0x65, 0x8C, 0x9D, 0x52, 0x27, 0xC0, 0x2D,
-	0x50, 0x71, 0x85, 0x8B, 0xF6, 0xE8, 0xEA, 0xD4, 0x6A, 0xB8, 0xAE, 0xF2,
-	0xE0, 0xF3, 0x1B, 0x91, 0x60, 0x36, 0x09, 0xB0, 0x39, 0xB0, 0x79, 0x0D,
-	0xB2, 0xB7, 0x2A, 0x46, 0x2D, 0x47, 0x45, 0x8F, 0xA9, 0x42, 0xD6, 0x91,
-	0x4F, 0xDD, 0x55, 0x4E, 0x01, 0xFE, 0x10, 0x95, 0x3A, 0xB2, 0xB1, 0x1F,
-	0xA0, 0xB1, 0x87, 0x9E, 0xA7, 0x66, 0xB6, 0x4C, 0x6F, 0x11, 0x6F, 0xF6,
-	0xAF, 0xA9, 0xDF, 0xF2, 0xE7, 0x9D, 0xE8, 0xFC, 0xA4, 0x9E, 0xB3, 0xA1,
-	0xEB, 0x6F, 0xC8, 0x7A, 0xF9, 0x6A, 0xD3, 0x73, 0x4C, 0xC7, 0xC7, 0xA7,
-	0x35, 0xBE, 0x52, 0x87, 0x36, 0xDF, 0x98, 0x16, 0xF8, 0x57, 0x43, 0xDF,
-	0xA7, 0xF9, 0x3A, 0x7D, 0xE7, 0x48, 0xC7, 0x75, 0xA3, 0x4A, 0xE5, 0xC7,
-	0xDF, 0x2B, 0x95, 0x65, 0x3C, 0xEC, 0x52, 0xFA, 0x2B, 0x6E, 0x90, 0x97,
-	0xA4, 0xFD, 0x1A, 0xD2, 0xB1, 0x19, 0xB4, 0x17, 0xEA, 0x1C, 0x87, 0xF6,
-	0x7C, 0xAD, 0x4C, 0x00, 0xF6, 0xA4, 0x7D, 0xCB, 0x7A, 0x72, 0xA8, 0xF4,
-	0x04, 0x48, 0x46, 0xB0, 0x0B, 0x71, 0x69, 0x76, 0x6F, 0xE6, 0x02, 0x92,
-	0xE4, 0xE0, 0x30, 0xCA, 0xAE, 0x7F, 0xF0, 0x76, 0x32, 0x9C, 0x8F, 0xB3,
-	0x02, 0xE5, 0x4C, 0x41, 0x10, 0x20, 0x21, 0xC1, 0x4B, 0x78, 0x3D, 0x26,
-	0xDB, 0x0D, 0x39, 0x2C, 0xC8, 0xF9, 0x3A, 0x65, 0x4C, 0xB8, 0x1C, 0xCE,
-	0xBF, 0xB5, 0x9C, 0xAE, 0x6F, 0xD4, 0x3A, 0x24, 0x02, 0xF0, 0x27, 0x80,
-	0x5B, 0xDB, 0xB4, 0xF7, 0x07, 0x1A, 0x0E, 0x0E, 0x8F, 0xC0, 0xF9, 0x33,
-	0xCA, 0xEC, 0xFC, 0xA0, 0x08, 0x90, 0x8C, 0x02, 0x5B, 0xE1, 0xF5, 0x4D,
-	0xC8, 0xCE, 0xBA, 0x8E, 0xE9, 0x26, 0xC1, 0x68, 0x6F, 0x4F, 0x9D, 0x0B,
-	0x3C, 0x0D, 0xFD, 0xDC, 0x0E, 0xFE, 0x9F, 0xAE, 0x9D, 0xA2, 0xE5, 0x0F,
-	0x66, 0x04, 0x68, 0x02, 0x9B, 0x5C, 0xD6, 0x3E, 0x83, 0xFF, 0x0F, 0x71,
-	0x04, 0xF6, 0x1D, 0xD0, 0x7B, 0x59, 0x59, 0x27, 0x7D, 0xDD, 0x98, 0x04,
-	0x47, 0x80, 0x64, 0x24, 0x58, 0x07, 0xAF, 0x57, 0x41, 0xAE, 0x83, 0xAC,
-	0x2B, 0x44, 0x84, 0x1F, 0xA1, 0xE7, 0x02, 0x38, 0xFE, 0x39, 0x21, 0x7D,
-	0x85, 0x50, 0x13, 0x24, 0x01, 0xDA, 0x46, 0x03, 0x46, 0x01, 0xB9, 0x19,
-	0x72, 0x2C, 0xC4, 0x74, 0x0F, 0xCD, 0x5F, 0x28, 0x7B, 0x3F, 0xE4, 0x26,
-	0x38, 0xFF, 0x97, 0x42, 0x78, 0x4D, 0xB0, 0x12, 0x41, 0x13, 0xA0, 0x8D,
-	0x08, 0x9C, 0x13, 0x30, 0x42, 0x08, 0x77, 0x3F, 0x73, 0x9E, 0xA0, 0x92,
-	0x18, 0x14, 0xE2, 0x31, 0xC8, 0x08, 0x1C, 0xCF, 0xDE, 0x1F, 0x64, 0x1A,
-	0x0A, 0x02, 0xB4, 0x11, 0x81, 0xA3, 0xC0, 0xAE, 0x90, 0x7D, 0x20, 0x3B,
-	0x25, 0x64, 0xE0, 0xD5, 0x03, 0xE7, 0x80, 0x8C, 0x11, 0xC4, 0x98, 0x40,
-	0x2B, 0x20, 0x4B, 0x86, 0x21, 0x3E, 0x10, 0x71, 0x19, 0x2A, 0x02, 0x04,
-	0xD9, 0x85, 0x2D, 0x1B, 0x15, 0x09, 0x60, 0x09, 0x60, 0xD9, 0x8B, 0x47,
-	0x02, 0x94, 0xDD, 0x83, 0x96, 0xF5, 0x8F, 0x04, 0xB0, 0x04, 0xB0, 0xEC,
-	0xC5, 0x23, 0x01, 0xCA, 0xEE, 0x41, 0xCB, 0xFA, 0x47, 0x02, 0x58, 0x02,
-	0x58, 0xF6, 0xE2, 0x91, 0x00, 0x65, 0xF7, 0xA0, 0x65, 0xFD, 0x23, 0x01,
-	0x2C, 0x01, 0x2C, 0x7B, 0xF1, 0x48, 0x80, 0xB2, 0x7B, 0xD0, 0xB2, 0xFE,
-	0x91, 0x00, 0x96, 0x00, 0x66, 0x15, 0xC7, 0x9D, 0x49, 0x86, 0xDD, 0xE1,
-	0xAA, 0x23, 0x57, 0x1F, 0xB7, 0x85, 0x6C, 0x06, 0xE1, 0x8D, 0x2A, 0x86,
-	0x9A, 0x65, 0x70, 0xA9, 0x2F, 0x20, 0x1F, 0x61, 0xD5, 0xF1, 0x2B, 0x87,
-	0xD5, 0xC8, 0x54, 0x1D, 0x09, 0x20, 0x8C, 0x3C, 0x9C, 0xBE, 0x3E, 0x54,
-	0xF2, 0x9E, 0xC3, 0x19, 0x10, 0x06, 0xB0, 0x52, 0xB9, 0x1B, 0xC9, 0x25,
-	0xE8, 0xF9, 0x90, 0x39, 0x20, 0xC3, 0x97, 0xC2, 0x55, 0x8A, 0x04, 0xF0,
-	0x01, 0x28, 0x1C, 0x4F, 0x47, 0x5F, 0x08, 0xB9, 0x12, 0xA2, 0x7A, 0xC3,
-	0xA9, 0xBB, 0x6A, 0xBC, 0x27, 0xF1, 0x22, 0xE4, 0x6A, 0x5F, 0x44, 0x88,
-	0x23, 0x80, 0x00, 0x3B, 0x92, 0x58, 0x85, 0x0F, 0x43, 0x95, 0xF6, 0x4E,
-	0xA4, 0x3E, 0xE6, 0xB9, 0xD9, 0x74, 0x36, 0x64, 0xA6, 0xEB, 0x5D, 0x47,
-	0x91, 0x00, 0x96, 0x04, 0x80, 0xF3, 0xCF, 0x85, 0x0A, 0x3E, 0x54, 0x42,
-	0x65, 0xA8, 0xD7, 0xB5, 0xC6, 0x07, 0x56, 0x9C, 0xE4, 0xF2, 0x76, 0x74,
-	0x24, 0x80, 0xAE, 0x4B, 0xDA, 0xF2, 0xC3, 0xF9, 0x33, 0xF1, 0xEF, 0xF5,
-	0x16, 0x2A, 0x54, 0xCE, 0xB2, 0x30, 0x00, 0xE5, 0xA1, 0xAE, 0x6E, 0x4F,
-	0x47, 0x02, 0x18, 0x7A, 0x0F, 0xCE, 0xE7, 0x79, 0x4A, 0x9E, 0xAB, 0xF4,
-	0x91, 0x48, 0x02, 0x1E, 0x3E, 0xF9, 0x59, 0xDA, 0x58, 0x24, 0x80, 0x01,
-	0xA2, 0x70, 0x3E, 0xB7, 0x98, 0x3D, 0x0F, 0x31, 0xDD, 0x66, 0x66, 0x60,
-	0xB5, 0xF2, 0x6E, 0x32, 0x12, 0x88, 0xEE, 0x44, 0x8E, 0x04, 0xD0, 0x74,
-	0x05, 0x9C, 0xCF, 0x19, 0xFE, 0x67, 0x10, 0xE5, 0xE7, 0x10, 0x29, 0x1F,
-	0x32, 0xCB, 0xAF, 0xCB, 0x75, 0x18, 0x05, 0x66, 0xE5, 0x67, 0x53, 0xCF,
-	0x11, 0x09, 0xA0, 0x8E, 0x55, 0x3D, 0x27, 0x08, 0xF0, 0x28, 0x5E, 0x18,
-	0x58, 0xBB, 0x2B, 0x09, 0xBA, 0xB9, 0xBF, 0x6E, 0x5E, 0x1D, 0xEC, 0x02,
-	0x12, 0x88, 0x05, 0xA6, 0x6E, 0x11, 0x00, 0x0D, 0xE3, 0x23, 0xD5, 0x94,
-	0x59, 0xAD, 0x89, 0x9B, 0xC3, 0xEC, 0x7F, 0x42, 0xF7, 0x06, 0xA3, 0xFA,
-	0xB9, 0xCE, 0x26, 0x3A, 0x48, 0x76, 0x54, 0x9D, 0xCF, 0x19, 0x64, 0x68,
-	0xDD, 0xC6, 0xD0, 0xEF, 0xD2, 0xE7, 0x7D, 0x10, 0x83, 0xE1, 0x17, 0xB1,
-	0x58, 0x60, 0x3B, 0xF7, 0xF8, 0xB9, 0xB9, 0xFA, 0xC8, 0xF8, 0x00, 0xDC,
-	0x14, 0xF9, 0x2C, 0xE4, 0xB0, 0x5C, 0x2F, 0x39, 0x6A, 0x70, 0xDE, 0xD1,
-	0xAC, 0xD6, 0xF7, 0x79, 0x19, 0xEB, 0x0D, 0x50, 0xCA, 0x94, 0xDB, 0xD4,
-	0x22, 0x64, 0x70, 0x04, 0x77, 0xB3, 0x69, 0x8B, 0xF0, 0xE6, 0x04, 0x12,
-	0xE0, 0x26, 0xBC, 0xB9, 0x36, 0xBB, 0xC1, 0x8E, 0xAB, 0x52, 0x04, 0xB4,
-	0x87, 0xB3, 0x0E, 0xB3, 0xF4, 0x83, 0x45, 0xD7, 0xB9, 0x10, 0x4E, 0x2F,
-	0x1B, 0x4E, 0xBF, 0xB7, 0x5A, 0x6D, 0x10, 0x24, 0xAA, 0xA8, 0x88, 0x0D,
-	0x33, 0x27, 0xCD, 0x07, 0x68, 0x79, 0x02, 0x98, 0xD7, 0x25, 0x83, 0x59,
-	0x4E, 0x94, 0x16, 0x95, 0xC9, 0x5E, 0xEB, 0x25, 0x4F, 0x00, 0xAF, 0xD5,
-	0x77, 0x64, 0xCC, 0x19, 0xDF, 0xA4, 0x14, 0xCB, 0x8D, 0x76, 0x7E, 0x08,
-	0x60, 0xDB, 0x6E, 0xDB, 0xF2, 0x8E, 0x78, 0xE2, 0x58, 0x2D, 0x5B, 0x4D,
-	0x71, 0xBA, 0xD8, 0xD8, 0x24, 0x40, 0x0D, 0x1B, 0x18, 0x4A, 0xB8, 0x26,
-	0x54, 0x14, 0x66, 0xC8, 0xF5, 0x48, 0xC7, 0xA4, 0xEA, 0x51, 0xAF, 0x3F,
-	0x02, 0x98, 0x63, 0x6E, 0x5E, 0xD2, 0x37, 0x2A, 0x43, 0x64, 0x4F, 0x9F,
-	0x00, 0xC5, 0x07, 0xA7, 0xB7, 0x3B, 0xF6, 0xA3, 0x9E, 0x74, 0xC7, 0x95,
-	0xD6, 0xD7, 0x1F, 0x6B, 0xB1, 0xCE, 0x54, 0x5C, 0x02, 0xF8, 0x03, 0xD3,
-	0x2F, 0xA5, 0xDB, 0x5D, 0x97, 0xE9, 0xC6, 0x76, 0x00, 0xDC, 0x81, 0x61,
-	0x4B, 0x00, 0x77, 0x35, 0xF3, 0xEB, 0x16, 0x1D, 0x6B, 0x62, 0xBD, 0x4F,
-	0xC7, 0x68, 0x6F, 0x5E, 0x99, 0x6A, 0xD8, 0x12, 0xA0, 0xBB, 0x5E, 0x32,
-	0xB5, 0xB2, 0x43, 0x46, 0xAA, 0xB4, 0x20, 0xB9, 0x33, 0x55, 0x09, 0xDA,
-	0xD1, 0x6F, 0x7A, 0x9D, 0x00, 0x73, 0x51, 0xEE, 0x4C, 0xFD, 0xB2, 0x83,
-	0x29, 0x31, 0x50, 0xB8, 0xF2, 0x9A, 0x3C, 0x30, 0xFE, 0x1B, 0x1B, 0x7E,
-	0x88, 0x04, 0xE0, 0xC1, 0x85, 0xB7, 0x20, 0xDC, 0xCF, 0x6E, 0x71, 0x8B,
-	0x53, 0xA3, 0x12, 0x1A, 0x59, 0xF3, 0x30, 0x8F, 0xDF, 0x1B, 0x23, 0xC0,
-	0xE0, 0x57, 0x53, 0xEB, 0x17, 0xFF, 0x20, 0x01, 0x4F, 0xAE, 0x9C, 0x05,
-	0x19, 0xCC, 0x7E, 0x00, 0x07, 0xDD, 0xDA, 0x81, 0x4A, 0x42, 0xC5, 0xC0,
-	0xD4, 0x47, 0xB4, 0x43, 0x2E, 0xC2, 0x65, 0x3D, 0x25, 0xDF, 0xC1, 0x3E,
-	0x6F, 0xE5, 0xDA, 0x24, 0xEE, 0x2D, 0x9C, 0x8B, 0x3D, 0x01, 0xCB, 0x4B,
-	0xB8, 0xFA, 0x63, 0xD3, 0x6E, 0xBB, 0xB2, 0xE8, 0x28, 0xDC, 0x6E, 0xC2,
-	0x20, 0x52, 0xDC, 0x3C, 0x33, 0xA8, 0x74, 0x2A, 0x1C, 0xF7, 0xA4, 0x94,
-	0xF1, 0x48, 0x00, 0x4D, 0x24, 0x41, 0x02, 0x8E, 0x00, 0x7C, 0xC0, 0x86,
-	0x79, 0x32, 0x1F, 0x9E, 0xDE, 0x86, 0xF3, 0xA7, 0x9A, 0x1B, 0xEE, 0x2D,
-	0x19, 0x09, 0x60, 0x80, 0x26, 0x48, 0xF0, 0x00, 0x8A, 0xF1, 0x40, 0x88,
-	0xDB, 0xD4, 0x49, 0x94, 0x5F, 0x61, 0x6C, 0x0F, 0x10, 0x60, 0xA5, 0xA4,
-	0xD1, 0x48, 0x00, 0x03, 0x34, 0x93, 0x03, 0xA0, 0xEF, 0xA0, 0xA8, 0xF2,
-	0x63, 0x76, 0x0C, 0xCC, 0xB4, 0x17, 0x21, 0x15, 0x8E, 0x83, 0xF3, 0x5F,
-	0xB6, 0xD4, 0xD3, 0x53, 0x3C, 0x12, 0xC0, 0x10, 0x51, 0x90, 0x80, 0x13,
-	0x66, 0x92, 0x40, 0xEA, 0x3C, 0x60, 0xBF, 0x9A, 0xD0, 0xF9, 0xE7, 0xC1,
-	0xF9, 0x23, 0x86, 0x55, 0xCD, 0x2C, 0x16, 0x09, 0x60, 0x81, 0x6A, 0x42,
-	0x02, 0x3E, 0xA8, 0x82, 0x97, 0xD2, 0x2E, 0x12, 0x2F, 0xD5, 0xCE, 0x81,
-	0xF3, 0xE7, 0xB9, 0x50, 0x4E, 0x9D, 0x91, 0x00, 0x96, 0xC8, 0x26, 0x3F,
-	0x07, 0xB7, 0x41, 0x0D, 0x8F, 0x86, 0x0B, 0xA4, 0xD6, 0x0F, 0xFF, 0xCA,
-	0x7F, 0x2B, 0x95, 0x53, 0xD7, 0xAD, 0x56, 0xF9, 0x4C, 0x22, 0x67, 0x29,
-	0x12, 0x40, 0x08, 0x5A, 0x10, 0x81, 0xCF, 0x27, 0xB8, 0x13, 0xC2, 0x35,
-	0x15, 0x9B, 0xC4, 0xC3, 0x1F, 0x77, 0x41, 0x78, 0x34, 0x7C, 0xB5, 0x8D,
-	0x22, 0x95, 0xB2, 0x91, 0x00, 0x2A, 0x28, 0x29, 0xE6, 0x49, 0x1E, 0xBF,
-	0xC7, 0xE8, 0x20, 0x17, 0x43, 0x74, 0x7F, 0x16, 0x18, 0x8A, 0xFE, 0x11,
-	0xC8, 0xED, 0xAE, 0x4E, 0x02, 0xA7, 0x35, 0x23, 0x12, 0x40, 0xD1, 0xB9,
-	0xBA, 0xD9, 0x40, 0x86, 0xED, 0x50, 0xE6, 0x28, 0xC8, 0x14, 0x08, 0x9F,
-	0x63, 0x34, 0x01, 0xD2, 0x58, 0x6E, 0x6F, 0x9C, 0x5E, 0xE1, 0x6A, 0x1C,
-	0x63, 0x03, 0x7D, 0x04, 0x79, 0x1D, 0xF2, 0x06, 0x1C, 0xCF, 0xDE, 0xEF,
-	0x35, 0x45, 0x02, 0x78, 0x84, 0x1B, 0xA4, 0xD8, 0x10, 0xE6, 0xEA, 0x41,
-	0xA2, 0x5C, 0x47, 0xFE, 0x50, 0x6D, 0x56, 0x24, 0x80, 0x2A, 0x52, 0x81,
-	0xE6, 0x8B, 0x04, 0x08, 0xD4, 0xB1, 0xAA, 0xCD, 0x8A, 0x04, 0x50, 0x45,
-	0x2A, 0xD0, 0x7C, 0x91, 0x00, 0x81, 0x3A, 0x56, 0xB5, 0x59, 0x91, 0x00,
-	0xAA, 0x48, 0x05, 0x9A, 0x2F, 0x12, 0x20, 0x50, 0xC7, 0xAA, 0x36, 0x2B,
-	0x12, 0x40, 0x15, 0xA9, 0x40, 0xF3, 0x0D, 0x8C, 0x00, 0x49, 0x64, 0x92,
-	0x03, 0x80, 0xEB, 0x24, 0xC8, 0xB6, 0x10, 0xDE, 0x5D, 0x63, 0xB0, 0x45,
-	0xDE, 0x00, 0xE1, 0x73, 0xFA, 0xBE, 0x86, 0x2C, 0x83, 0xBC, 0x8F, 0x6B,
-	0x66, 0x7E, 0x16, 0x93, 0x03, 0x04, 0xBC, 0x12, 0x20, 0x89, 0xA7, 0xCB,
-	0xA5, 0xD2, 0x19, 0x90, 0x83, 0x21, 0x5C, 0x14, 0xC9, 0x4B, 0x88, 0xAC,
-	0x3D, 0x76, 0x41, 0xA5, 0xB2, 0xE6, 0x41, 0x64, 0x5C, 0x10, 0xCA, 0x33,
-	0x7B, 0xF3, 0x1A, 0xED, 0xEB, 0x7B, 0x2F, 0x04, 0x48, 0xD6, 0xC8, 0xCF,
-	0x46, 0xA3, 0xF8, 0x2C, 0xDF, 0x6D, 0x1A, 0x8D, 0xD3, 0xDB, 0x09, 0x99,
-	0x00, 0xB2, 0x1C, 0xAF, 0x0C, 0xA4, 0x2C, 0xBE, 0x31, 0xC2, 0x17, 0xE0,
-	0x45, 0xB3, 0xE3, 0x9C, 0x00, 0x70, 0x3E, 0x9F, 0xDF, 0xFB, 0x30, 0xA4,
-	0x6D, 0xF7, 0x8C, 0xF9, 0xA6, 0xB8, 0x04, 0x40, 0x44, 0xD4, 0x5E, 0x8D,
-	0xFB, 0xE4, 0x9B, 0x04, 0xFB, 0x48, 0x57, 0x5F, 0x44, 0x71, 0x4A, 0x00,
-	0x38, 0xFF, 0xC4, 0xC4, 0xF9, 0x7C, 0x70, 0x82, 0x56, 0xAA, 0x61, 0x84,
-	0xA8, 0x66, 0x6F, 0x57, 0xF8, 0x1E, 0x0A, 0xB9, 0x4D, 0x8A, 0x37, 0x53,
-	0x62, 0x32, 0x44, 0xC0, 0x19, 0x01, 0xE0, 0x7C, 0x0E, 0xF9, 0x0F, 0x60,
-	0xA0, 0x1F, 0x23, 0x63, 0x24, 0xF5, 0x27, 0x83, 0xF7, 0xCB, 0x49, 0x02,
-	0xDB, 0x7D, 0xF2, 0x86, 0xF0, 0x95, 0xBF, 0x98, 0x8C, 0x6F, 0xBA, 0x70,
-	0x80, 0xF3, 0x4F, 0xC1, 0x47, 0x7C, 0xF2, 0xB6, 0x42, 0x78, 0x0B, 0xEB,
-	0x9F, 0x03, 0x3E, 0x7E, 0x65, 0x2A, 0x48, 0xE0, 0x74, 0xE7, 0x4C, 0xF9,
-	0x5D, 0x9D, 0xDE, 0x02, 0x71, 0x02, 0xC0, 0xF9, 0x7B, 0xC2, 0xD4, 0x52,
-	0x48, 0xF3, 0xDE, 0xB7, 0x00, 0x76, 0x29, 0xBD, 0xBF, 0xF3, 0x23, 0x3E,
-	0x7F, 0x87, 0x5B, 0xA6, 0xF9, 0x1A, 0x93, 0x06, 0x02, 0xA2, 0x04, 0x48,
-	0xF6, 0xC7, 0x7D, 0x0C, 0xFB, 0x9C, 0xF8, 0xF9, 0x4E, 0xAF, 0x82, 0x00,
-	0x47, 0xFB, 0x36, 0x5A, 0x76, 0x7B, 0xD2, 0x04, 0xB8, 0x1E, 0x80, 0xCC,
-	0x1C, 0x20, 0x28, 0xD3, 0x40, 0x02, 0x3E, 0x7C, 0x29, 0x26, 0x45, 0x04,
-	0xEA, 0x04, 0x48, 0xAE, 0xD3, 0x39, 0x74, 0xF3, 0xF0, 0x63, 0x4F, 0x6A,
-	0x8F, 0xBF, 0x9C, 0x11, 0x8B, 0x99, 0x5F, 0xF1, 0x77, 0x5F, 0x7B, 0xC6,
-	0xAF, 0x58, 0x57, 0x95, 0x6C, 0xD8, 0x62, 0xB5, 0xCE, 0xA5, 0x88, 0x16,
-	0xCD, 0x1F, 0x88, 0xEC, 0x34, 0x16, 0x5F, 0xAF, 0xC9, 0xCB, 0x14, 0xEC,
-	0xF7, 0xBC, 0x7C, 0x5E, 0xC6, 0x45, 0x35, 0x1E, 0x0F, 0xDF, 0x1C, 0xFF,
-	0xF0, 0xAC, 0x9B, 0xAF, 0x53, 0x2E, 0xA5, 0x44, 0xD5, 0x68, 0xD9, 0xAA,
-	0xD8, 0x2D, 0xE5, 0xA4, 0xF9, 0x48, 0x12, 0x80, 0xA1, 0xC7, 0xF9, 0xF8,
-	0x13, 0xCB, 0xA4, 0x0F, 0x91, 0xF5, 0xFC, 0xDF, 0xB2, 0xC6, 0xAD, 0xE2,
-	0xBA, 0x55, 0xD7, 0xCD, 0xAF, 0x50, 0x4F, 0x07, 0x2A, 0x15, 0xAC, 0x56,
-	0x66, 0xB7, 0x05, 0x8B, 0x76, 0xE7, 0x0E, 0x71, 0xCD, 0x79, 0x68, 0x89,
-	0x1B, 0x54, 0xC1, 0x52, 0x31, 0x4F, 0x5A, 0xDD, 0xF2, 0xDA, 0x93, 0xA3,
-	0xDA, 0x42, 0x65, 0x56, 0x8C, 0x20, 0x8D, 0x5A, 0x69, 0x64, 0x55, 0x84,
-	0xA9, 0x34, 0xD9, 0x4A, 0xDE, 0x74, 0xE9, 0x20, 0x51, 0x05, 0xF2, 0x5B,
-	0x9A, 0x67, 0x38, 0xE9, 0xE3, 0xE4, 0xAF, 0x99, 0xB4, 0xBD, 0x67, 0x3B,
-	0xB4, 0xD8, 0x96, 0x17, 0xC7, 0xD7, 0x0F, 0x01, 0xEC, 0x9B, 0x6D, 0xAF,
-	0x21, 0x17, 0xBA, 0x3E, 0x26, 0x3C, 0x58, 0x46, 0xD5, 0xB4, 0x99, 0xD8,
-	0x68, 0x8E, 0x7D, 0xE5, 0xFC, 0x10, 0x20, 0x17, 0xFC, 0xB2, 0x66, 0x30,
-	0xF4, 0x9B, 0x9B, 0xE6, 0x66, 0xB0, 0xA1, 0x7F, 0x3D, 0x23, 0x01, 0x94,
-	0x9C, 0x61, 0xDF, 0xD3, 0x94, 0xCC, 0x0C, 0x20, 0x93, 0x2F, 0x02, 0x74,
-	0x22, 0xE8, 0xB6, 0xE3, 0x84, 0xEB, 0x2D, 0x07, 0x04, 0xF1, 0x45, 0x00,
-	0xF3, 0x9F, 0x39, 0x07, 0x8D, 0xB6, 0x54, 0xE9, 0x96, 0xBE, 0xE9, 0x95,
-	0x6B, 0x2E, 0x6C, 0x8A, 0xAE, 0xDC, 0xD3, 0xD4, 0x28, 0x01, 0xFC, 0xF6,
-	0x9B, 0x41, 0x80, 0x68, 0xE9, 0xF7, 0xA4, 0xB8, 0x0F, 0x9C, 0x3A, 0xD1,
-	0x71, 0x8A, 0x95, 0xC7, 0x11, 0xC0, 0x07, 0x72, 0x32, 0x3E, 0x1E, 0x98,
-	0x16, 0xA7, 0xAE, 0x4E, 0x6F, 0x95, 0x0E, 0x01, 0x1A, 0xD5, 0x1B, 0x40,
-	0x25, 0x07, 0xE6, 0x10, 0x1B, 0xC3, 0x25, 0xC1, 0xA9, 0x4E, 0x80, 0x39,
-	0x68, 0x28, 0xB7, 0x6F, 0x29, 0xA5, 0xF4, 0x8E, 0x5C, 0xB0, 0xEE, 0x5D,
-	0x12, 0xF4, 0x95, 0x00, 0x77, 0x9B, 0x69, 0x84, 0x04, 0xE0, 0xC1, 0x8C,
-	0xC5, 0x10, 0x67, 0xB7, 0x71, 0x0B, 0x46, 0x0F, 0x59, 0x48, 0xCB, 0xDB,
-	0x38, 0xEE, 0xA7, 0x9C, 0xD2, 0xDC, 0x0F, 0x30, 0x11, 0xFF, 0xF0, 0x89,
-	0xD8, 0xE3, 0x2D, 0xD0, 0xE1, 0xA9, 0x1E, 0x8E, 0x24, 0x0A, 0xFB, 0x00,
-	0x2D, 0xAC, 0x64, 0x17, 0x65, 0x34, 0x4D, 0xC6, 0xD9, 0x71, 0x97, 0x3C,
-	0x3B, 0xBC, 0xB1, 0x7A, 0xDD, 0xBD, 0x86, 0x6D, 0xD1, 0xBC, 0x46, 0xFD,
-	0x7F, 0xC2, 0xDF, 0x79, 0x8C, 0x3A, 0x2A, 0x7A, 0x5D, 0x81, 0xD1, 0x84,
-	0x4F, 0xD6, 0xE6, 0xC9, 0x9F, 0x94, 0xA4, 0x39, 0x2E, 0x6B, 0x66, 0x4F,
-	0x0C, 0xDE, 0x80, 0x46, 0xDD, 0x68, 0x01, 0xCF, 0xD0, 0x15, 0x95, 0x26,
-	0xC0, 0x04, 0x10, 0x6C, 0x05, 0x86, 0x00, 0x67, 0x3F, 0x27, 0x19, 0x1E,
-	0xFA, 0x06, 0xDF, 0xED, 0x16, 0xCF, 0x11, 0xEA, 0x71, 0x58, 0x94, 0x00,
-	0x34, 0x8D, 0x51, 0xE0, 0x4C, 0xBC, 0xCC, 0x55, 0xA9, 0x86, 0xE0, 0x68,
-	0xFA, 0x1F, 0xEC, 0x1D, 0x04, 0xE7, 0xBF, 0xA7, 0x62, 0x37, 0xE6, 0x19,
-	0x45, 0x40, 0x9C, 0x00, 0x09, 0x09, 0xEE, 0xC3, 0xEB, 0xF9, 0x1E, 0x81,
-	0xBE, 0x08, 0xCE, 0xBF, 0xC7, 0xA3, 0xBD, 0x60, 0x4C, 0xB9, 0x22, 0x40,
-	0x73, 0x83, 0x68, 0x9F, 0xF9, 0x80, 0x19, 0x7E, 0x7D, 0x46, 0x8C, 0x59,
-	0x70, 0x3E, 0x0F, 0x9D, 0xC6, 0x64, 0x80, 0x80, 0x13, 0x02, 0x24, 0xA3,
-	0x00, 0x49, 0x70, 0x2F, 0xC4, 0x55, 0x5C, 0x7D, 0xF2, 0xE1, 0x4A, 0x38,
-	0xFF, 0x56, 0x83, 0x76, 0xC7, 0x22, 0x09, 0x02, 0xCE, 0x08, 0xD0, 0x44,
-	0x38, 0x39, 0x23, 0xC8, 0x18, 0xBA, 0x0C, 0x92, 0x28, 0x95, 0x78, 0x02,
-	0x68, 0x06, 0x9C, 0xBF, 0x50, 0x4A, 0xE1, 0xB0, 0xEA, 0x71, 0x4E, 0x80,
-	0x64, 0x34, 0xE0, 0x3A, 0x03, 0x23, 0x6A, 0x1F, 0x6F, 0x09, 0x34, 0x27,
-	0x7B, 0x8C, 0x9B, 0x7F, 0x0D, 0x9C, 0xCF, 0xD8, 0xBA, 0x31, 0x59, 0x22,
-	0xE0, 0x85, 0x00, 0x6D, 0xA3, 0xC1, 0x5E, 0x78, 0x7F, 0x09, 0x84, 0xC7,
-	0xC6, 0x75, 0xCE, 0x0E, 0xAE, 0x42, 0xFE, 0x79, 0x95, 0x71, 0x95, 0x3B,
-	0xAB, 0xBF, 0x55, 0x79, 0xB9, 0x17, 0x93, 0x10, 0x02, 0x5E, 0x09, 0xD0,
-	0x46, 0x84, 0x71, 0x78, 0x7F, 0x38, 0xE4, 0x20, 0x08, 0x97, 0xA2, 0x39,
-	0x42, 0x30, 0x46, 0x10, 0xE7, 0x0D, 0x8C, 0x07, 0xC4, 0x40, 0xCA, 0x74,
-	0x34, 0xCF, 0xFE, 0xBF, 0x05, 0x59, 0x34, 0x88, 0x40, 0xCA, 0x42, 0x18,
-	0x17, 0x5A, 0xCD, 0xFF, 0x11, 0x1A, 0x76, 0x22, 0xBA, 0x29, 0xA5, 0xE8,
-	0x00, 0x00, 0x00, 0x00, 0x49, 0x45, 0x4E, 0x44, 0xAE, 0x42, 0x60, 0x82
-};
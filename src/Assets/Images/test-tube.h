@@ -1,562 +0,0 @@
-/* C:\Users\Cameron\Downloads\test-tube-svgrepo-com.png (3/30/2025 5:37:30 PM)
-   StartOffset(h): 00000000, EndOffset(h): 00001A13, Length(h): 00001A14 */
-
-inline unsigned char g_TestTubeIcon[6676] = {
-	0x89, 0x50, 0x4E, 0x47, 0x0D, 0x0A, 0x1A, 0x0A, 0x00, 0x00, 0x00, 0x0D,
-	0x49, 0x48, 0x44, 0x52, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00,
-	0x08, 0x06, 0x00, 0x00, 0x00, 0x5C, 0x72, 0xA8, 0x66, 0x00, 0x00, 0x19,
-	0xDB, 0x49, 0x44, 0x41, 0x54, 0x78, 0x5E, 0xED, 0x9D, 0x0F, 0xF0, 0x65,
-	0x65, 0x5D, 0xC6, 0xFD, 0x39, 0x5A, 0xD6, 0xE8, 0x8C, 0x8C, 0x56, 0x3A,
-	0x59, 0xB3, 0xCD, 0xE0, 0xA4, 0x25, 0x0D, 0x24, 0x15, 0x0A, 0xD6, 0x32,
-	0x8E, 0x7F, 0x30, 0x0D, 0x88, 0x7F, 0x12, 0x32, 0xED, 0x96, 0x96, 0x1A,
-	0x08, 0x6B, 0x6D, 0xC8, 0x00, 0x2E, 0x05, 0x0C, 0x82, 0xA9, 0x10, 0x1A,
-	0x99, 0x16, 0xBF, 0x26, 0x34, 0x0C, 0x10, 0x2A, 0x4C, 0x14, 0x67, 0xDC,
-	0x12, 0x94, 0x49, 0xCC, 0x2D, 0xA9, 0xB6, 0x91, 0x92, 0x69, 0x70, 0x5C,
-	0x27, 0x9C, 0x98, 0xC9, 0x29, 0x1A, 0x19, 0xB7, 0xE7, 0x81, 0xF3, 0xA3,
-	0x1F, 0x3F, 0xEE, 0xDD, 0xFB, 0x7D, 0xCE, 0x7D, 0xEE, 0xFD, 0xDD, 0xFB,
-	0x9E, 0xE7, 0xCC, 0x1C, 0x97, 0x75, 0x9F, 0xF7, 0x7B, 0xCE, 0xF9, 0xBC,
-	0xEF, 0x79, 0xEE, 0xF7, 0x7D, 0xCF, 0x7B, 0xDE, 0xB3, 0xF2, 0x84, 0x6C,
-	0x8F, 0x23, 0xB0, 0x7F, 0xFF, 0xFE, 0x2D, 0xF8, 0x3F, 0xB7, 0x62, 0xFF,
-	0x29, 0xEC, 0x4F, 0xC7, 0xFE, 0x2C, 0xEC, 0xCF, 0xC1, 0xFE, 0xCC, 0xEE,
-	0xEF, 0xA1, 0xB6, 0xD8, 0x04, 0xF6, 0xE1, 0xF4, 0xEE, 0xC3, 0xBE, 0xF6,
-	0xE7, 0x57, 0xF1, 0xDF, 0x77, 0x62, 0xDF, 0xBD, 0xB2, 0xB2, 0xF2, 0xD0,
-	0x62, 0x9F, 0xFA, 0x7C, 0xCF, 0x6E, 0x65, 0xBE, 0x87, 0x5B, 0xDC, 0xA3,
-	0xE1, 0xA6, 0x3F, 0x14, 0x67, 0x77, 0x56, 0x77, 0xE3, 0xD3, 0x00, 0xB2,
-	0xB5, 0x47, 0xE0, 0x01, 0x5C, 0xD2, 0x2D, 0xD8, 0x3F, 0xC6, 0x3F, 0x61,
-	0x06, 0xDF, 0x6C, 0xEF, 0x12, 0xB5, 0x2B, 0x1A, 0xB4, 0x01, 0xE0, 0xA6,
-	0xE7, 0x2F, 0xFB, 0x71, 0xDD, 0xFE, 0x0A, 0x0D, 0x5D, 0xD4, 0x4B, 0x4E,
-	0xE0, 0x9F, 0x71, 0xFE, 0x1F, 0xE6, 0x0E, 0x23, 0xF8, 0xB7, 0x25, 0xBF,
-	0x96, 0xDE, 0xA7, 0x3F, 0x58, 0x03, 0xC0, 0xCD, 0xFF, 0x3C, 0x50, 0xBB,
-	0x06, 0xFB, 0x11, 0xBD, 0xE9, 0xCD, 0xB9, 0xE0, 0x7E, 0x1C, 0x6F, 0xB0,
-	0x15, 0x36, 0x3B, 0xD6, 0xF7, 0x20, 0xF4, 0x6F, 0xC1, 0x04, 0xAE, 0x9D,
-	0xDD, 0x21, 0x16, 0x37, 0xF2, 0xE0, 0xDA, 0x13, 0x6E, 0xFC, 0x27, 0xA1,
-	0x3A, 0xCE, 0xC6, 0x7E, 0x11, 0xF6, 0xA7, 0x2C, 0x6E, 0xD5, 0xE4, 0xCC,
-	0xE6, 0x4C, 0x60, 0x37, 0x8E, 0x77, 0x2A, 0x8C, 0x80, 0xE3, 0x06, 0x83,
-	0xD9, 0x06, 0x65, 0x00, 0x5D, 0xCA, 0xFF, 0x97, 0xA8, 0xDD, 0xC3, 0x07,
-	0x53, 0xC3, 0xB9, 0x50, 0x85, 0x00, 0xB3, 0x81, 0xD7, 0xC0, 0x04, 0xF6,
-	0x2A, 0x85, 0x96, 0x59, 0x3B, 0x18, 0x03, 0xC0, 0xCD, 0xFF, 0x4A, 0x54,
-	0xD4, 0x05, 0xD8, 0x5F, 0xBC, 0xCC, 0x15, 0x96, 0x73, 0x9F, 0x39, 0x81,
-	0x2F, 0xE1, 0x08, 0x97, 0x0F, 0xA5, 0x4B, 0x30, 0x08, 0x03, 0xE8, 0x7E,
-	0xF9, 0x3F, 0x8D, 0x8A, 0x65, 0xBF, 0x3F, 0x5B, 0x08, 0x4C, 0x22, 0xC0,
-	0x47, 0x85, 0xC7, 0xC0, 0x04, 0x3E, 0x35, 0x49, 0xB8, 0xEC, 0xFF, 0xDE,
-	0xBC, 0x01, 0xE0, 0xE6, 0xE7, 0x20, 0xDF, 0x95, 0xD8, 0x7F, 0x72, 0xD9,
-	0x2B, 0x2B, 0xE7, 0x3F, 0x57, 0x02, 0x7F, 0x8B, 0xA3, 0x9D, 0x05, 0x13,
-	0xE0, 0xFC, 0x81, 0x66, 0xB7, 0xA6, 0x0D, 0x00, 0x37, 0xFF, 0xF7, 0x74,
-	0x37, 0xFF, 0xA9, 0xCD, 0xD6, 0x60, 0x2E, 0x6C, 0x96, 0x04, 0xAE, 0x43,
-	0xF0, 0xB3, 0x61, 0x02, 0x5F, 0x9F, 0xE5, 0x41, 0x36, 0x33, 0x76, 0xEB,
-	0x06, 0xF0, 0x46, 0xC0, 0xBD, 0x7A, 0x0A, 0xC0, 0x9C, 0x38, 0xC2, 0x34,
-	0xF0, 0xEF, 0xB1, 0x73, 0x66, 0x19, 0xFF, 0xCE, 0x3D, 0xDB, 0x62, 0x13,
-	0xE0, 0xFC, 0x0E, 0xEE, 0xCF, 0xC0, 0xBE, 0x15, 0xFB, 0x51, 0x53, 0x9C,
-	0xEE, 0x15, 0x30, 0x80, 0x1D, 0x53, 0x94, 0x5F, 0xE8, 0xA2, 0xCD, 0x1A,
-	0x00, 0x7E, 0xFD, 0x0F, 0x06, 0x79, 0x4E, 0xF6, 0xE0, 0x63, 0x3F, 0x75,
-	0xE3, 0x68, 0xF0, 0x4E, 0xEC, 0x9C, 0x2D, 0x96, 0xA9, 0xA3, 0x2A, 0xBD,
-	0x05, 0xD3, 0xA3, 0x2D, 0x70, 0x1A, 0xF7, 0xEB, 0xB0, 0x9F, 0x83, 0x9D,
-	0x53, 0xBB, 0xD5, 0xED, 0x30, 0xB4, 0x83, 0x3D, 0x6A, 0xA1, 0x65, 0xD0,
-	0xB7, 0x6C, 0x00, 0x9C, 0xE4, 0xB3, 0x4D, 0xAC, 0x04, 0xFE, 0xCA, 0xF3,
-	0x49, 0xC1, 0xB5, 0xB9, 0xF1, 0x45, 0x72, 0x4B, 0x20, 0x87, 0x11, 0xF0,
-	0xE6, 0xE7, 0xFC, 0x8F, 0x33, 0xC4, 0xD3, 0xBD, 0x19, 0xED, 0xE1, 0x78,
-	0xB1, 0xCC, 0x52, 0xC8, 0x9B, 0x34, 0x80, 0x9E, 0xBF, 0xFE, 0x37, 0xA0,
-	0xC6, 0x4E, 0x47, 0x45, 0x3F, 0xB8, 0x14, 0x35, 0x97, 0x93, 0xEC, 0x4D,
-	0x00, 0xED, 0x83, 0xD9, 0x00, 0x7F, 0x20, 0x94, 0xEC, 0xB0, 0xC9, 0x2C,
-	0xA0, 0x55, 0x03, 0xF8, 0x00, 0x2A, 0xF7, 0xF5, 0x42, 0x0B, 0xB9, 0x19,
-	0xDA, 0x93, 0xF2, 0xAB, 0x2F, 0x10, 0x5B, 0x72, 0x29, 0x4C, 0x60, 0x2B,
-	0x2E, 0xE1, 0x36, 0xC1, 0x04, 0x9A, 0xCC, 0x02, 0x9A, 0x33, 0x80, 0x6E,
-	0xAA, 0xEF, 0x7F, 0xA0, 0x62, 0xAB, 0x7D, 0xBD, 0xDB, 0xA1, 0xE5, 0x33,
-	0xDF, 0xC1, 0xBF, 0x19, 0xB6, 0xE4, 0xF7, 0xB4, 0x7C, 0xFA, 0x68, 0x2B,
-	0x6F, 0x43, 0xA1, 0x4B, 0x85, 0x82, 0x07, 0xA1, 0x9D, 0x34, 0x35, 0x08,
-	0xDC, 0xA2, 0x01, 0x70, 0xC4, 0xF7, 0x33, 0xC5, 0x4A, 0xBD, 0x1B, 0xBA,
-	0x17, 0xE5, 0xE6, 0x2F, 0xD2, 0x6A, 0x50, 0x06, 0x13, 0x60, 0x5B, 0xA9,
-	0x3E, 0x25, 0x38, 0x1E, 0x6D, 0x85, 0xD9, 0x62, 0x33, 0x5B, 0x8B, 0x06,
-	0xF0, 0x3E, 0xD4, 0xCE, 0x9B, 0x0B, 0x35, 0xC4, 0xD1, 0xFD, 0xD7, 0xA2,
-	0x42, 0x6F, 0x2C, 0x68, 0x23, 0x69, 0x94, 0x00, 0x0C, 0xE0, 0x14, 0x5C,
-	0x1A, 0x9F, 0xF7, 0x57, 0xB6, 0x4B, 0xD0, 0x5E, 0xCE, 0xAF, 0x08, 0x97,
-	0x45, 0xD3, 0xA2, 0x01, 0x7C, 0x11, 0xF0, 0xB9, 0xB8, 0xC7, 0xA4, 0xED,
-	0x6E, 0x54, 0xE6, 0x21, 0x93, 0x44, 0xF9, 0xF7, 0xF6, 0x09, 0x08, 0x59,
-	0xC0, 0x1E, 0xB4, 0x99, 0xC3, 0x5A, 0x22, 0xD2, 0xA2, 0x01, 0xFC, 0x17,
-	0x2A, 0xE8, 0xA9, 0x85, 0x4A, 0xBA, 0x18, 0x95, 0xC9, 0x47, 0x7E, 0xD9,
-	0x06, 0x4E, 0x00, 0x06, 0xC0, 0xD7, 0xC3, 0xDF, 0x53, 0xC4, 0xD0, 0xD4,
-	0x38, 0x40, 0x53, 0x06, 0xD0, 0x0D, 0x00, 0x7E, 0xAB, 0x58, 0x91, 0x2F,
-	0x81, 0x01, 0x70, 0x00, 0x30, 0xDB, 0xC0, 0x09, 0x74, 0xCB, 0xC1, 0x31,
-	0x73, 0xAC, 0x6C, 0xCF, 0x45, 0xBB, 0xE1, 0x44, 0xB1, 0x26, 0xB6, 0xD6,
-	0x0C, 0x60, 0x0B, 0x6A, 0xE5, 0x2B, 0xC5, 0x9A, 0xF9, 0x21, 0x54, 0xE4,
-	0xBD, 0x45, 0x6D, 0x64, 0x8D, 0x13, 0x80, 0x09, 0x70, 0xC1, 0xA5, 0xCA,
-	0x76, 0x34, 0xDA, 0xCD, 0xEE, 0x8A, 0x70, 0x19, 0x34, 0xAD, 0x19, 0x00,
-	0xDF, 0xF9, 0xFF, 0x78, 0x01, 0xFC, 0x37, 0x50, 0x89, 0x5C, 0xE1, 0x37,
-	0x5B, 0x08, 0x3C, 0x01, 0xF7, 0xFE, 0x77, 0x00, 0x03, 0x1F, 0x03, 0x3F,
-	0xB9, 0x80, 0xE3, 0x48, 0xB4, 0x9D, 0xCF, 0x16, 0x74, 0x4B, 0x21, 0x69,
-	0xCD, 0x00, 0xB6, 0x82, 0x3A, 0xDF, 0xFB, 0x9F, 0xB4, 0x3D, 0x84, 0x4A,
-	0xAC, 0x54, 0xF6, 0xA4, 0x38, 0xF9, 0xF7, 0x46, 0x08, 0xC0, 0x04, 0x98,
-	0x39, 0x6E, 0x29, 0x5C, 0x0E, 0x97, 0x0D, 0xAB, 0x3E, 0x35, 0x28, 0x84,
-	0xDB, 0x5C, 0x49, 0x6B, 0x06, 0xC0, 0x77, 0xFF, 0x3F, 0x57, 0x44, 0xDA,
-	0xD4, 0x60, 0x4E, 0xF1, 0x9A, 0x23, 0x1B, 0x43, 0x00, 0x06, 0x50, 0x1D,
-	0x3C, 0xE6, 0x74, 0xF1, 0x66, 0x16, 0x10, 0x6D, 0xCD, 0x00, 0x5E, 0x80,
-	0xFA, 0xE5, 0x92, 0x4E, 0x95, 0xED, 0x50, 0x54, 0x24, 0x5F, 0xF3, 0xCD,
-	0x36, 0x70, 0x02, 0xB8, 0xF9, 0xB9, 0x4C, 0xDC, 0x1D, 0x45, 0x0C, 0x4D,
-	0xBD, 0x13, 0xD0, 0x94, 0x01, 0xB0, 0x02, 0x51, 0x99, 0x9C, 0x06, 0x5C,
-	0xE9, 0xDF, 0x37, 0xE5, 0xE4, 0xC5, 0xC6, 0x1B, 0xD9, 0x08, 0x02, 0x68,
-	0x33, 0x27, 0xE2, 0xFF, 0xBE, 0xBE, 0x08, 0xA7, 0xA9, 0xCC, 0xB1, 0x45,
-	0x03, 0x60, 0x17, 0xA0, 0xB2, 0xD6, 0x3F, 0x3F, 0x08, 0x71, 0x5A, 0xB1,
-	0xD2, 0x23, 0x6B, 0x98, 0x00, 0x0C, 0x80, 0xD3, 0x7B, 0x8F, 0x2D, 0x5C,
-	0xE2, 0xE7, 0xD1, 0x66, 0x9A, 0x5A, 0x5A, 0xAE, 0x45, 0x03, 0x50, 0xDE,
-	0x04, 0xCC, 0xA3, 0xC0, 0x42, 0xAB, 0x6F, 0x59, 0xD2, 0x2D, 0x18, 0xCB,
-	0x01, 0xC0, 0xCA, 0x37, 0x22, 0xF8, 0x6D, 0xC1, 0xA3, 0x5B, 0xE2, 0xD1,
-	0xA2, 0x01, 0xFC, 0x2A, 0x2A, 0xE8, 0xF7, 0x8B, 0x95, 0x74, 0x25, 0x2A,
-	0x94, 0xB3, 0xC0, 0xB2, 0x0D, 0x90, 0x40, 0xB7, 0x40, 0xC8, 0xFB, 0x71,
-	0xE9, 0x27, 0x17, 0x2F, 0xFF, 0x0C, 0xB4, 0x17, 0xBE, 0x6B, 0xD2, 0xCC,
-	0xD6, 0xA2, 0x01, 0xD0, 0xC9, 0xBF, 0x86, 0xBD, 0xFA, 0x3A, 0x30, 0x5F,
-	0x05, 0xBE, 0xB5, 0x99, 0x1A, 0xCD, 0x85, 0x94, 0x09, 0x88, 0x7D, 0x7F,
-	0xBE, 0x3C, 0xC6, 0x8C, 0x91, 0xAB, 0x46, 0x35, 0xB3, 0x35, 0x67, 0x00,
-	0xAC, 0x19, 0x54, 0x2C, 0x17, 0x02, 0xE5, 0x82, 0xA0, 0x95, 0xED, 0x5E,
-	0x88, 0xF8, 0x4A, 0xF0, 0xA0, 0x3E, 0x09, 0x55, 0x01, 0xD3, 0xB2, 0x06,
-	0x6D, 0x84, 0xAF, 0x00, 0x73, 0xD2, 0x58, 0xE5, 0xBD, 0x11, 0xA2, 0xB8,
-	0x15, 0x6D, 0xE4, 0x98, 0xD6, 0x98, 0xB4, 0x6A, 0x00, 0xCA, 0x9A, 0x00,
-	0xAC, 0x53, 0x7E, 0x0A, 0x8A, 0x53, 0x3C, 0x63, 0x02, 0xAD, 0xB5, 0xF0,
-	0x11, 0xD7, 0xD3, 0xAD, 0x06, 0xC4, 0x4F, 0xC4, 0x55, 0x6F, 0x7E, 0x46,
-	0x69, 0x6A, 0x02, 0xD0, 0x1A, 0x96, 0x26, 0x0D, 0xA0, 0xCB, 0x02, 0xB8,
-	0x22, 0xB0, 0xF2, 0x25, 0x20, 0x9A, 0xC0, 0x76, 0x98, 0x40, 0xD3, 0x1F,
-	0x82, 0x18, 0xC0, 0xFD, 0x3D, 0xF6, 0x12, 0xBB, 0x97, 0xC5, 0xB8, 0x0A,
-	0xD0, 0x2E, 0xEC, 0xCA, 0x7A, 0x80, 0x6C, 0x1B, 0x87, 0xA0, 0x6D, 0x34,
-	0xB7, 0x42, 0x74, 0xCB, 0x06, 0xB0, 0x15, 0x95, 0x56, 0x99, 0x16, 0xBC,
-	0xB1, 0xC1, 0x70, 0x00, 0xF1, 0x5C, 0x54, 0x76, 0x53, 0x4B, 0x3F, 0x0D,
-	0xF9, 0xC6, 0xEF, 0x7E, 0x10, 0x8E, 0xEB, 0x6E, 0xFC, 0xCA, 0x5A, 0x11,
-	0x1B, 0x71, 0xBD, 0x0C, 0xED, 0xA1, 0xC9, 0xCF, 0x84, 0x35, 0x6B, 0x00,
-	0x5D, 0xA5, 0x5F, 0x85, 0x3F, 0xD5, 0x25, 0xA0, 0x59, 0x94, 0x2B, 0x03,
-	0x73, 0x60, 0x90, 0xAB, 0x05, 0xF1, 0x95, 0xE1, 0xFB, 0x5A, 0x74, 0xFF,
-	0x96, 0x4D, 0xA1, 0x7B, 0xBC, 0xC7, 0x9B, 0xFD, 0xA5, 0xD8, 0x79, 0xF3,
-	0xF3, 0x3B, 0x11, 0x7D, 0xB6, 0xEB, 0x50, 0xF7, 0xCD, 0x7E, 0x59, 0xAA,
-	0x75, 0x03, 0x60, 0x1F, 0x8F, 0x5D, 0x01, 0x7E, 0x18, 0x62, 0xDA, 0x8D,
-	0xE3, 0x03, 0xCA, 0x92, 0xE1, 0x77, 0xB6, 0xDC, 0x70, 0xA6, 0x85, 0xA9,
-	0x94, 0xC7, 0xCD, 0xFC, 0x4E, 0xE8, 0x39, 0x5B, 0xAF, 0xB2, 0x31, 0xB5,
-	0x77, 0xD4, 0x37, 0x8F, 0xC5, 0x37, 0x04, 0x9F, 0xDF, 0xDA, 0xC8, 0xFF,
-	0x7A, 0x88, 0x4D, 0x1B, 0x00, 0x2F, 0x14, 0x8D, 0xE7, 0xD5, 0xF8, 0x83,
-	0x03, 0x3E, 0xF3, 0xDE, 0x9A, 0x9B, 0x34, 0x32, 0x6F, 0x80, 0x6B, 0xC7,
-	0x43, 0x1D, 0xF6, 0xF9, 0xC8, 0xCB, 0xB4, 0xA7, 0xCB, 0xFE, 0x3E, 0x53,
-	0xFF, 0xDD, 0xD3, 0x06, 0x5A, 0xE4, 0xF2, 0xCD, 0x1B, 0x40, 0x67, 0x02,
-	0xFC, 0xCC, 0x17, 0x97, 0xFF, 0x7A, 0xDA, 0x1C, 0x2B, 0xA3, 0xC9, 0x75,
-	0xE4, 0xE7, 0xC8, 0xEF, 0xD1, 0x43, 0xC1, 0x00, 0x6E, 0xC2, 0x5F, 0x98,
-	0xC6, 0xCF, 0x6B, 0xFB, 0x57, 0x1C, 0xE8, 0xFC, 0x96, 0x5E, 0xFB, 0x1D,
-	0x07, 0x6E, 0x10, 0x06, 0xD0, 0x99, 0x00, 0x67, 0xFC, 0xBD, 0x1D, 0xFB,
-	0x41, 0x73, 0x6A, 0x45, 0x31, 0x00, 0x13, 0xE8, 0x39, 0x1B, 0x00, 0xBB,
-	0x7A, 0xE7, 0xE1, 0xE6, 0xFF, 0x23, 0xD3, 0xE9, 0x2F, 0x74, 0x98, 0xC1,
-	0x18, 0x40, 0x67, 0x02, 0x1C, 0x10, 0x64, 0x26, 0xF0, 0xBD, 0x73, 0xA8,
-	0x95, 0x18, 0x80, 0x09, 0xF2, 0x1C, 0x0D, 0x80, 0xAF, 0x04, 0x5F, 0x85,
-	0x9B, 0xFF, 0x23, 0xA6, 0x53, 0x5F, 0xF8, 0x30, 0x83, 0x32, 0x80, 0xCE,
-	0x04, 0x98, 0x4A, 0xF2, 0x85, 0xA1, 0xCA, 0x2B, 0xC3, 0xD3, 0x54, 0x60,
-	0xC6, 0x00, 0xA6, 0xA1, 0xB7, 0xAE, 0xEC, 0x9C, 0xC6, 0x00, 0xF8, 0xF5,
-	0x5F, 0x7E, 0x1E, 0xAE, 0x99, 0x05, 0x3F, 0x2B, 0xF8, 0x07, 0x67, 0x00,
-	0x9D, 0x09, 0xF0, 0xE6, 0xE7, 0xC8, 0xF2, 0xB6, 0x0A, 0xA4, 0x9E, 0x9A,
-	0x18, 0x40, 0x4F, 0x70, 0x1B, 0x8B, 0xCD, 0xD8, 0x00, 0x38, 0xD8, 0xC7,
-	0xB9, 0x1F, 0x3B, 0x71, 0xF3, 0x2B, 0x4F, 0x79, 0x4C, 0x57, 0xB7, 0xB9,
-	0x61, 0x06, 0x69, 0x00, 0x6B, 0xC8, 0xD1, 0xB0, 0x4E, 0xC2, 0x7F, 0xFF,
-	0x12, 0x76, 0x2E, 0x26, 0xEA, 0xDE, 0xD2, 0x05, 0x30, 0x11, 0x9D, 0x51,
-	0x17, 0xE0, 0xCB, 0x38, 0x3D, 0x2E, 0x02, 0x72, 0x3D, 0x6E, 0x7C, 0xFE,
-	0xFA, 0x0F, 0x72, 0x1B, 0xB4, 0x01, 0x74, 0xD9, 0x00, 0xDF, 0x1E, 0xE4,
-	0x33, 0xE6, 0x13, 0x3A, 0x23, 0xA8, 0xBC, 0x17, 0x5E, 0x69, 0x2C, 0xC9,
-	0x00, 0x2A, 0x94, 0x0A, 0x1A, 0x73, 0x06, 0x70, 0x3F, 0x0E, 0xC9, 0x05,
-	0x40, 0x2E, 0x1B, 0x5A, 0xBA, 0x3F, 0x0A, 0xF5, 0xE0, 0x0D, 0x60, 0x3D,
-	0x14, 0x34, 0x34, 0x76, 0x0D, 0x38, 0x46, 0xC0, 0xEF, 0xC5, 0xF1, 0x3D,
-	0x82, 0x69, 0x26, 0x94, 0xC4, 0x00, 0x0A, 0x37, 0x77, 0x45, 0x32, 0xA5,
-	0x01, 0x30, 0xC5, 0xBF, 0x0B, 0x3B, 0x67, 0x76, 0x7E, 0x22, 0xEF, 0x7A,
-	0x3C, 0x96, 0x78, 0x0C, 0x60, 0x42, 0x0B, 0x44, 0xE3, 0xDB, 0xD2, 0x19,
-	0x01, 0xCD, 0x80, 0xD9, 0x01, 0x97, 0x8E, 0xAA, 0x3C, 0x93, 0x8E, 0x01,
-	0x54, 0xEE, 0xEE, 0x82, 0x46, 0x30, 0x00, 0x4E, 0xDB, 0xE6, 0x02, 0x1F,
-	0x7C, 0x67, 0x9F, 0x8F, 0xF3, 0xEE, 0xC7, 0x0D, 0xCF, 0x5F, 0xFC, 0x6C,
-	0x63, 0x08, 0xC4, 0x00, 0xC4, 0xA6, 0x81, 0xC6, 0xC8, 0x6F, 0xC8, 0x55,
-	0x56, 0x11, 0xCA, 0x18, 0x80, 0xC8, 0x76, 0x9C, 0x5C, 0x18, 0x03, 0xB8,
-	0x02, 0x37, 0xFC, 0x0E, 0xD3, 0x61, 0x07, 0x11, 0x26, 0x06, 0x20, 0x56,
-	0x73, 0x0C, 0x40, 0x04, 0x66, 0x90, 0xC7, 0x00, 0x0C, 0x10, 0x93, 0x01,
-	0x78, 0x20, 0xC6, 0x00, 0x3C, 0x1C, 0x95, 0x28, 0x31, 0x00, 0x85, 0x96,
-	0xA6, 0x4D, 0x06, 0xA0, 0xF1, 0xE2, 0xCB, 0x45, 0xE9, 0x02, 0x88, 0xCC,
-	0xA6, 0x95, 0xC7, 0x00, 0xA6, 0x25, 0x38, 0xBE, 0x7C, 0x0C, 0x40, 0x64,
-	0x1B, 0x03, 0x10, 0x81, 0x19, 0xE4, 0x31, 0x00, 0x03, 0xC4, 0x74, 0x01,
-	0x3C, 0x10, 0x63, 0x00, 0x1E, 0x8E, 0x4A, 0x94, 0x18, 0x80, 0x42, 0x4B,
-	0xD3, 0x26, 0x03, 0xD0, 0x78, 0xA5, 0x0B, 0x20, 0xF2, 0x72, 0xC8, 0x63,
-	0x00, 0x0E, 0x8A, 0xA3, 0x63, 0xC4, 0x00, 0x44, 0xB6, 0xC9, 0x00, 0x44,
-	0x60, 0x06, 0x79, 0x0C, 0xC0, 0x00, 0x31, 0x5D, 0x00, 0x0F, 0xC4, 0x18,
-	0x80, 0x87, 0xA3, 0x12, 0x25, 0x06, 0xA0, 0xD0, 0xD2, 0xB4, 0xC9, 0x00,
-	0x34, 0x5E, 0xE9, 0x02, 0x88, 0xBC, 0x1C, 0xF2, 0x18, 0x80, 0x83, 0x62,
-	0xBA, 0x00, 0x16, 0x8A, 0xC9, 0x00, 0x2C, 0x18, 0xA5, 0x20, 0x31, 0x00,
-	0x09, 0x97, 0x24, 0x4E, 0x06, 0x20, 0xE1, 0x7A, 0x78, 0x91, 0xD1, 0xCC,
-	0x03, 0x10, 0x99, 0x4D, 0x2B, 0x8F, 0x01, 0x4C, 0x4B, 0x70, 0x7C, 0xF9,
-	0x18, 0x80, 0xC8, 0x36, 0x06, 0x20, 0x02, 0x33, 0xC8, 0x63, 0x00, 0x06,
-	0x88, 0x19, 0x04, 0xF4, 0x40, 0x8C, 0x01, 0x78, 0x38, 0x2A, 0x51, 0x1E,
-	0x6B, 0x00, 0xFB, 0x51, 0x74, 0xEC, 0xEF, 0x56, 0x5E, 0x06, 0x52, 0xC0,
-	0x1E, 0x88, 0xA4, 0x18, 0x67, 0x30, 0xF2, 0xC7, 0x18, 0xC0, 0xB7, 0x71,
-	0xD9, 0x4F, 0x1C, 0x7B, 0xE9, 0x79, 0x1B, 0xD0, 0xD4, 0x2A, 0x92, 0x01,
-	0x98, 0x40, 0x8E, 0x08, 0x93, 0x2E, 0x80, 0xC8, 0x36, 0x19, 0x80, 0x08,
-	0xCC, 0x20, 0x8F, 0x01, 0x18, 0x20, 0xA6, 0x0B, 0xE0, 0x81, 0x18, 0x03,
-	0xF0, 0x70, 0x54, 0xA2, 0xC4, 0x00, 0x14, 0x5A, 0x9A, 0x36, 0x19, 0x80,
-	0xC6, 0x2B, 0x4F, 0x01, 0x44, 0x5E, 0x0E, 0x79, 0x0C, 0xC0, 0x41, 0x71,
-	0x74, 0x8C, 0x18, 0x80, 0xC8, 0x36, 0x19, 0x80, 0x08, 0xCC, 0x20, 0x8F,
-	0x01, 0x18, 0x20, 0xA6, 0x0B, 0xE0, 0x81, 0x18, 0x03, 0xF0, 0x70, 0x54,
-	0xA2, 0xC4, 0x00, 0x14, 0x5A, 0x9A, 0x36, 0x19, 0x80, 0xC6, 0x2B, 0x5D,
-	0x00, 0x91, 0x97, 0x43, 0x1E, 0x03, 0x70, 0x50, 0x4C, 0x17, 0xC0, 0x42,
-	0x31, 0x19, 0x80, 0x05, 0xA3, 0x14, 0x24, 0x06, 0x20, 0xE1, 0x92, 0xC4,
-	0xC9, 0x00, 0x24, 0x5C, 0x99, 0x0A, 0x2C, 0xE2, 0xB2, 0xC8, 0x63, 0x00,
-	0x16, 0x8C, 0x23, 0x83, 0xC4, 0x00, 0x44, 0xB6, 0xC9, 0x00, 0x44, 0x60,
-	0x06, 0x79, 0x0C, 0xC0, 0x00, 0x31, 0x83, 0x80, 0x1E, 0x88, 0x31, 0x00,
-	0x0F, 0x47, 0x25, 0x4A, 0x0C, 0x40, 0xA1, 0xA5, 0x69, 0x93, 0x01, 0x68,
-	0xBC, 0x32, 0x08, 0x28, 0xF2, 0x72, 0xC8, 0x63, 0x00, 0x0E, 0x8A, 0x19,
-	0x04, 0xB4, 0x50, 0x4C, 0x06, 0x60, 0xC1, 0x28, 0x05, 0x89, 0x01, 0x48,
-	0xB8, 0x24, 0x71, 0x32, 0x00, 0x09, 0x57, 0x06, 0x01, 0x45, 0x5C, 0x16,
-	0x79, 0x0C, 0xC0, 0x82, 0x31, 0x83, 0x80, 0x0E, 0x8C, 0xC9, 0x00, 0x1C,
-	0x14, 0xB5, 0x18, 0x31, 0x00, 0x8D, 0x97, 0xA2, 0x4E, 0x06, 0xA0, 0xD0,
-	0x82, 0x36, 0x06, 0x20, 0x02, 0x33, 0xC8, 0x63, 0x00, 0x06, 0x88, 0x79,
-	0x0A, 0xE0, 0x81, 0x18, 0x03, 0xF0, 0x70, 0x54, 0xA2, 0xC4, 0x00, 0x14,
-	0x5A, 0x9A, 0x36, 0x19, 0x80, 0xC6, 0x2B, 0x19, 0x80, 0xC8, 0xCB, 0x21,
-	0x8F, 0x01, 0x38, 0x28, 0xE6, 0x29, 0x80, 0x85, 0x62, 0x32, 0x00, 0x0B,
-	0x46, 0x29, 0x48, 0x0C, 0x40, 0xC2, 0x25, 0x89, 0x93, 0x01, 0x48, 0xB8,
-	0x32, 0x06, 0x20, 0xE2, 0xB2, 0xC8, 0x63, 0x00, 0x16, 0x8C, 0x79, 0x0A,
-	0xE0, 0xC0, 0x98, 0x0C, 0xC0, 0x41, 0x51, 0x8B, 0x11, 0x03, 0xD0, 0x78,
-	0x29, 0xEA, 0x64, 0x00, 0x0A, 0xAD, 0x3C, 0x05, 0x10, 0x69, 0x79, 0xE4,
-	0x31, 0x00, 0x0F, 0xC7, 0x51, 0x51, 0x62, 0x00, 0x22, 0xDB, 0x64, 0x00,
-	0x22, 0x30, 0x83, 0x3C, 0x06, 0x60, 0x80, 0x38, 0x26, 0x44, 0x0C, 0x40,
-	0x64, 0x1B, 0x03, 0x10, 0x81, 0x19, 0xE4, 0x31, 0x00, 0x03, 0xC4, 0x18,
-	0x80, 0x07, 0x62, 0x0C, 0xC0, 0xC3, 0x51, 0x89, 0x12, 0x03, 0x50, 0x68,
-	0x69, 0xDA, 0x64, 0x00, 0x1A, 0xAF, 0xCC, 0x03, 0x10, 0x79, 0x39, 0xE4,
-	0x31, 0x00, 0x07, 0xC5, 0xD1, 0x31, 0x62, 0x00, 0x22, 0xDB, 0x64, 0x00,
-	0x22, 0x30, 0x83, 0x3C, 0x06, 0x60, 0x80, 0x98, 0x2E, 0x80, 0x07, 0x62,
-	0x0C, 0xC0, 0xC3, 0x51, 0x89, 0x12, 0x03, 0x50, 0x68, 0x69, 0xDA, 0x64,
-	0x00, 0x1A, 0xAF, 0x74, 0x01, 0x44, 0x5E, 0x0E, 0x79, 0x0C, 0xC0, 0x41,
-	0x31, 0x5D, 0x00, 0x0B, 0xC5, 0x64, 0x00, 0x16, 0x8C, 0x52, 0x90, 0xC7,
-	0x19, 0xC0, 0xF8, 0x8F, 0xB2, 0xE6, 0xEB, 0xC0, 0x12, 0xD9, 0x03, 0x7C,
-	0x67, 0x59, 0x8C, 0x33, 0x18, 0x79, 0x0C, 0x60, 0xFE, 0x55, 0x3D, 0x3E,
-	0x03, 0x78, 0x9C, 0x13, 0xC4, 0x00, 0xC4, 0xEA, 0x49, 0x17, 0x40, 0x04,
-	0x16, 0x03, 0x10, 0x81, 0x19, 0xE4, 0xE9, 0x02, 0x18, 0x20, 0x66, 0x10,
-	0xD0, 0x03, 0x31, 0x06, 0xE0, 0xE1, 0xA8, 0x44, 0x89, 0x01, 0x28, 0xB4,
-	0x34, 0x6D, 0x32, 0x00, 0x8D, 0x57, 0x06, 0x01, 0x45, 0x5E, 0x0E, 0x79,
-	0x0C, 0xC0, 0x41, 0x31, 0x83, 0x80, 0x16, 0x8A, 0xC9, 0x00, 0x2C, 0x18,
-	0xA5, 0x20, 0x31, 0x00, 0x09, 0x97, 0x24, 0x4E, 0x06, 0x20, 0xE1, 0xCA,
-	0x7A, 0x00, 0x22, 0x2E, 0x8B, 0x3C, 0x06, 0x60, 0xC1, 0x38, 0x32, 0x48,
-	0x0C, 0x40, 0x64, 0x9B, 0x0C, 0x40, 0x04, 0x66, 0x90, 0xC7, 0x00, 0x0C,
-	0x10, 0x33, 0x08, 0xE8, 0x81, 0x18, 0x03, 0xF0, 0x70, 0x54, 0xA2, 0xC4,
-	0x00, 0x14, 0x5A, 0x9A, 0x36, 0x19, 0x80, 0xC6, 0x8B, 0x83, 0x80, 0xBB,
-	0x50, 0xE4, 0xC2, 0xFD, 0xF8, 0x9F, 0x09, 0xF0, 0x1E, 0x84, 0x64, 0x9F,
-	0x18, 0xDE, 0x21, 0xDF, 0xB9, 0xB2, 0xB2, 0x72, 0x83, 0x23, 0xD0, 0xA2,
-	0xC4, 0x00, 0xF3, 0x6B, 0x70, 0x2E, 0xDB, 0x0A, 0xE7, 0xB3, 0x8A, 0x6B,
-	0xDF, 0x5E, 0xD0, 0x45, 0xD2, 0x11, 0x88, 0x01, 0x88, 0x4D, 0x41, 0xC8,
-	0x00, 0xC4, 0xC8, 0x36, 0xF9, 0x76, 0xDC, 0x04, 0xAB, 0xB6, 0x68, 0x0B,
-	0x10, 0x28, 0x19, 0xC0, 0xEC, 0x2A, 0x21, 0x06, 0x20, 0xB2, 0x8D, 0x01,
-	0x88, 0xC0, 0x0C, 0xF2, 0x18, 0x80, 0x01, 0x62, 0xC6, 0x00, 0x3C, 0x10,
-	0x63, 0x00, 0x1E, 0x8E, 0x4A, 0x94, 0x18, 0x80, 0x42, 0x4B, 0xD3, 0x26,
-	0x03, 0xD0, 0x78, 0x29, 0x13, 0x81, 0xC4, 0xC8, 0x36, 0x79, 0xBA, 0x00,
-	0x36, 0x94, 0xED, 0x07, 0x8A, 0x01, 0x88, 0x75, 0x9C, 0x0C, 0x40, 0x04,
-	0x66, 0x90, 0x27, 0x03, 0x30, 0x40, 0x4C, 0x17, 0xC0, 0x03, 0x31, 0x06,
-	0xE0, 0xE1, 0xA8, 0x44, 0x89, 0x01, 0x28, 0xB4, 0x34, 0x6D, 0x32, 0x00,
-	0x8D, 0x57, 0xBA, 0x00, 0x22, 0x2F, 0x87, 0x3C, 0x06, 0xE0, 0xA0, 0x38,
-	0x3A, 0x46, 0x0C, 0x40, 0x64, 0x9B, 0x0C, 0x40, 0x04, 0x66, 0x90, 0xC7,
-	0x00, 0x0C, 0x10, 0xD3, 0x05, 0xF0, 0x40, 0x8C, 0x01, 0x78, 0x38, 0x2A,
-	0x51, 0x62, 0x00, 0x0A, 0x2D, 0x4D, 0x9B, 0x0C, 0x40, 0xE3, 0xF5, 0xE8,
-	0x4C, 0xC0, 0x42, 0xB1, 0xBD, 0xD0, 0x5C, 0x56, 0xD0, 0xB9, 0x25, 0xB7,
-	0x63, 0x22, 0xD0, 0x3D, 0xEE, 0xA0, 0x9B, 0x19, 0x2F, 0x33, 0x01, 0x67,
-	0x47, 0x3F, 0x06, 0x20, 0xB2, 0x15, 0x32, 0x80, 0x9B, 0x71, 0x23, 0x1E,
-	0x2F, 0x86, 0x8F, 0x7C, 0x04, 0x81, 0x64, 0x00, 0xB3, 0x6B, 0x16, 0x31,
-	0x00, 0x91, 0x6D, 0x0C, 0x40, 0x04, 0x66, 0x90, 0xC7, 0x00, 0x0C, 0x10,
-	0x33, 0x06, 0xE0, 0x81, 0x18, 0x03, 0xF0, 0x70, 0x54, 0xA2, 0xC4, 0x00,
-	0x14, 0x5A, 0x9A, 0x36, 0x19, 0x80, 0xC6, 0x4B, 0x79, 0x0C, 0x98, 0x2E,
-	0x80, 0xC8, 0x76, 0x9C, 0x3C, 0x06, 0x60, 0x02, 0x39, 0x22, 0x4C, 0x0C,
-	0x40, 0x64, 0x9B, 0x0C, 0x40, 0x04, 0x66, 0x90, 0xC7, 0x00, 0x0C, 0x10,
-	0xD3, 0x05, 0xF0, 0x40, 0x8C, 0x01, 0x78, 0x38, 0x2A, 0x51, 0x62, 0x00,
-	0x0A, 0x2D, 0x4D, 0x9B, 0x0C, 0x40, 0xE3, 0x95, 0x2E, 0x80, 0xC8, 0xCB,
-	0x21, 0x8F, 0x01, 0x38, 0x28, 0x8E, 0x8E, 0x11, 0x03, 0x10, 0xD9, 0x26,
-	0x03, 0x10, 0x81, 0x19, 0xE4, 0x31, 0x00, 0x03, 0xC4, 0x74, 0x01, 0x3C,
-	0x10, 0x63, 0x00, 0x1E, 0x8E, 0x4A, 0x94, 0x18, 0x80, 0x42, 0x4B, 0xD3,
-	0x26, 0x03, 0xD0, 0x78, 0xA5, 0x0B, 0x20, 0xF2, 0x72, 0xC8, 0x63, 0x00,
-	0x0E, 0x8A, 0xE9, 0x02, 0x58, 0x28, 0x26, 0x03, 0xB0, 0x60, 0x94, 0x82,
-	0xC4, 0x00, 0x24, 0x5C, 0x92, 0x38, 0x19, 0x80, 0x84, 0x2B, 0x1F, 0x06,
-	0x11, 0x71, 0x59, 0xE4, 0x31, 0x00, 0x0B, 0xC6, 0x91, 0x41, 0x62, 0x00,
-	0x22, 0xDB, 0x64, 0x00, 0x22, 0x30, 0x83, 0x3C, 0x06, 0x60, 0x80, 0x98,
-	0x41, 0x40, 0x0F, 0xC4, 0x18, 0x80, 0x87, 0xA3, 0x12, 0x25, 0x06, 0xA0,
-	0xD0, 0xD2, 0xB4, 0xC9, 0x00, 0x34, 0x5E, 0x19, 0x04, 0x14, 0x79, 0x39,
-	0xE4, 0x31, 0x00, 0x07, 0xC5, 0x0C, 0x02, 0x5A, 0x28, 0x26, 0x03, 0xB0,
-	0x60, 0x94, 0x82, 0xC4, 0x00, 0x24, 0x5C, 0x92, 0x38, 0x19, 0x80, 0x84,
-	0x2B, 0x83, 0x80, 0x22, 0x2E, 0x8B, 0x3C, 0x06, 0x60, 0xC1, 0x98, 0x41,
-	0x40, 0x07, 0xC6, 0x64, 0x00, 0x0E, 0x8A, 0x5A, 0x8C, 0x18, 0x80, 0xC6,
-	0x4B, 0x51, 0x27, 0x03, 0x50, 0x68, 0x41, 0x1B, 0x03, 0x10, 0x81, 0x19,
-	0xE4, 0x31, 0x00, 0x03, 0xC4, 0x3C, 0x05, 0xF0, 0x40, 0x8C, 0x01, 0x78,
-	0x38, 0x2A, 0x51, 0x62, 0x00, 0x0A, 0x2D, 0x4D, 0x9B, 0x0C, 0x40, 0xE3,
-	0x95, 0x0C, 0x40, 0xE4, 0xE5, 0x90, 0xC7, 0x00, 0x1C, 0x14, 0xF3, 0x14,
-	0xC0, 0x42, 0x31, 0x19, 0x80, 0x05, 0xA3, 0x14, 0x24, 0x06, 0x20, 0xE1,
-	0x92, 0xC4, 0xC9, 0x00, 0x24, 0x5C, 0x19, 0x03, 0x10, 0x71, 0x59, 0xE4,
-	0x31, 0x00, 0x0B, 0xC6, 0x3C, 0x05, 0x70, 0x60, 0x44, 0x63, 0xDC, 0x85,
-	0x38, 0x17, 0x16, 0x62, 0xE5, 0xBB, 0x00, 0x05, 0x48, 0x15, 0x09, 0x98,
-	0x5F, 0x03, 0xDD, 0xB6, 0x82, 0x76, 0x15, 0x4B, 0xB1, 0x6F, 0x2F, 0xE8,
-	0x22, 0xE9, 0x08, 0x24, 0x03, 0x10, 0x9B, 0x82, 0xD0, 0x05, 0x10, 0x23,
-	0x8F, 0x97, 0xEF, 0xC7, 0x3F, 0x09, 0x15, 0x95, 0xCF, 0x83, 0xDB, 0xC8,
-	0xB7, 0x1F, 0x48, 0x68, 0x57, 0xED, 0xC3, 0xA8, 0x5C, 0xE1, 0x66, 0x18,
-	0x40, 0xE5, 0xBC, 0xD6, 0x69, 0x62, 0x00, 0x22, 0xB0, 0x21, 0xCB, 0x63,
-	0x00, 0x62, 0xED, 0xC7, 0x00, 0x44, 0x60, 0x06, 0x79, 0xC6, 0x00, 0x0C,
-	0x10, 0xC7, 0x84, 0x88, 0x01, 0x88, 0x6C, 0x63, 0x00, 0x22, 0x30, 0x83,
-	0x3C, 0x06, 0x60, 0x80, 0x18, 0x03, 0xF0, 0x40, 0x8C, 0x01, 0x78, 0x38,
-	0x2A, 0x51, 0x62, 0x00, 0x0A, 0x2D, 0x4D, 0x9B, 0x0C, 0x40, 0xE3, 0xA5,
-	0x4C, 0x04, 0x12, 0x23, 0xDB, 0xE4, 0x19, 0x03, 0xB0, 0xA1, 0x6C, 0x3F,
-	0x50, 0x0C, 0x40, 0xAC, 0xE3, 0x64, 0x00, 0x22, 0x30, 0x83, 0x3C, 0x19,
-	0x80, 0x01, 0x62, 0xBA, 0x00, 0x1E, 0x88, 0x31, 0x00, 0x0F, 0x47, 0x25,
-	0x4A, 0x0C, 0x40, 0xA1, 0xA5, 0x69, 0x93, 0x01, 0x68, 0xBC, 0xD2, 0x05,
-	0x10, 0x79, 0x39, 0xE4, 0x31, 0x00, 0x07, 0xC5, 0xD1, 0x31, 0x62, 0x00,
-	0x22, 0x5B, 0x61, 0x26, 0xE0, 0x83, 0x08, 0xBD, 0x4F, 0x0C, 0xEF, 0x90,
-	0xEF, 0xC4, 0x6C, 0xB8, 0x1B, 0x1C, 0x81, 0x16, 0x25, 0x46, 0x66, 0x02,
-	0xCE, 0xAE, 0x26, 0x62, 0x00, 0x22, 0x5B, 0xA1, 0x0B, 0x90, 0xCF, 0x83,
-	0x8B, 0x6C, 0xC7, 0xC9, 0x93, 0x01, 0x98, 0x40, 0x8E, 0x08, 0x13, 0x03,
-	0x10, 0xD9, 0xC6, 0x00, 0x44, 0x60, 0x06, 0xF9, 0x38, 0x03, 0x18, 0x31,
-	0x45, 0xFA, 0x0A, 0x64, 0x3F, 0x3B, 0x0C, 0x87, 0x1C, 0x4C, 0x88, 0x18,
-	0x80, 0x58, 0xD5, 0x31, 0x00, 0x11, 0x98, 0x41, 0x9E, 0x0C, 0xC0, 0x00,
-	0x31, 0x4F, 0x01, 0x3C, 0x10, 0x63, 0x00, 0x1E, 0x8E, 0x4A, 0x94, 0x18,
-	0x80, 0x42, 0x4B, 0xD3, 0x26, 0x03, 0xD0, 0x78, 0x29, 0x4F, 0x01, 0x32,
-	0x06, 0x20, 0xB2, 0xCD, 0x18, 0x80, 0x09, 0x98, 0x10, 0x26, 0x06, 0x20,
-	0xC0, 0xA2, 0x34, 0x19, 0x80, 0x08, 0xCC, 0x20, 0x4F, 0x06, 0x60, 0x80,
-	0x98, 0x2E, 0x80, 0x07, 0x62, 0x0C, 0xC0, 0xC3, 0x51, 0x89, 0x12, 0x03,
-	0x50, 0x68, 0x69, 0xDA, 0x64, 0x00, 0x1A, 0xAF, 0x64, 0x00, 0x22, 0x2F,
-	0x87, 0x3C, 0x06, 0xE0, 0xA0, 0x38, 0x3A, 0x46, 0x0C, 0x40, 0x64, 0x9B,
-	0x0C, 0x40, 0x04, 0x66, 0x90, 0xC7, 0x00, 0x0C, 0x10, 0xD3, 0x05, 0xF0,
-	0x40, 0x8C, 0x01, 0x78, 0x38, 0x2A, 0x51, 0x62, 0x00, 0x0A, 0x2D, 0x4D,
-	0x9B, 0x0C, 0x40, 0xE3, 0x95, 0x2E, 0x80, 0xC8, 0xCB, 0x21, 0x8F, 0x01,
-	0x38, 0x28, 0xA6, 0x0B, 0x60, 0xA1, 0x98, 0x0C, 0xC0, 0x82, 0x51, 0x0A,
-	0x12, 0x03, 0x90, 0x70, 0x49, 0xE2, 0x64, 0x00, 0x12, 0xAE, 0x3C, 0x06,
-	0x14, 0x71, 0x59, 0xE4, 0x31, 0x00, 0x0B, 0xC6, 0x91, 0x41, 0x62, 0x00,
-	0x22, 0xDB, 0x64, 0x00, 0x22, 0x30, 0x83, 0x3C, 0x06, 0x60, 0x80, 0x98,
-	0x41, 0x40, 0x0F, 0xC4, 0x18, 0x80, 0x87, 0xA3, 0x12, 0x25, 0x06, 0xA0,
-	0xD0, 0xD2, 0xB4, 0xC9, 0x00, 0x34, 0x5E, 0x19, 0x04, 0x14, 0x79, 0x39,
-	0xE4, 0x31, 0x00, 0x07, 0xC5, 0x0C, 0x02, 0x5A, 0x28, 0x26, 0x03, 0xB0,
-	0x60, 0x94, 0x82, 0xC4, 0x00, 0x24, 0x5C, 0x92, 0x38, 0x19, 0x80, 0x84,
-	0x2B, 0x83, 0x80, 0x22, 0x2E, 0x8B, 0x3C, 0x06, 0x60, 0xC1, 0x98, 0x41,
-	0x40, 0x07, 0xC6, 0x64, 0x00, 0x0E, 0x8A, 0x5A, 0x8C, 0x18, 0x80, 0xC6,
-	0x4B, 0x51, 0x27, 0x03, 0x50, 0x68, 0x41, 0x1B, 0x03, 0x10, 0x81, 0x19,
-	0xE4, 0x31, 0x00, 0x03, 0xC4, 0x3C, 0x05, 0xF0, 0x40, 0x7C, 0xAC, 0x01,
-	0x7C, 0x1B, 0x41, 0x9F, 0x38, 0x2E, 0x70, 0xD6, 0x03, 0xF0, 0x20, 0xA7,
-	0xE9, 0xDE, 0x84, 0x50, 0xC7, 0x15, 0xC2, 0x65, 0x49, 0xB0, 0x02, 0xA4,
-	0xF5, 0x92, 0x64, 0x00, 0x22, 0xB0, 0x64, 0x00, 0x22, 0x30, 0x83, 0x3C,
-	0x06, 0x60, 0x80, 0x98, 0x0C, 0xC0, 0x03, 0x31, 0x06, 0xE0, 0xE1, 0xA8,
-	0x44, 0x89, 0x01, 0x28, 0xB4, 0x34, 0x6D, 0x32, 0x00, 0x8D, 0x57, 0xC6,
-	0x00, 0x44, 0x5E, 0x0E, 0x79, 0x0C, 0xC0, 0x41, 0x71, 0x74, 0x8C, 0x18,
-	0x80, 0xC8, 0x56, 0xC8, 0x00, 0xC4, 0xC8, 0x36, 0x79, 0x3E, 0x0E, 0x6A,
-	0x43, 0xD9, 0x7E, 0xA0, 0x18, 0x80, 0x58, 0xC7, 0x31, 0x00, 0x11, 0x98,
-	0x41, 0x9E, 0x0C, 0xC0, 0x00, 0x31, 0x63, 0x00, 0x1E, 0x88, 0x31, 0x00,
-	0x0F, 0x47, 0x25, 0x4A, 0x0C, 0x40, 0xA1, 0xA5, 0x69, 0x93, 0x01, 0x68,
-	0xBC, 0x94, 0x31, 0x00, 0x31, 0xB2, 0x4D, 0x9E, 0x2E, 0x80, 0x0D, 0x65,
-	0xFB, 0x81, 0x62, 0x00, 0x62, 0x1D, 0x27, 0x03, 0x10, 0x81, 0x19, 0xE4,
-	0xC9, 0x00, 0x0C, 0x10, 0xD3, 0x05, 0xF0, 0x40, 0x8C, 0x01, 0x78, 0x38,
-	0x2A, 0x51, 0x62, 0x00, 0x0A, 0x2D, 0x4D, 0x9B, 0x0C, 0x40, 0xE3, 0x95,
-	0x2E, 0x80, 0xC8, 0xCB, 0x21, 0x8F, 0x01, 0x38, 0x28, 0x8E, 0x8E, 0x11,
-	0x03, 0x10, 0xD9, 0x26, 0x03, 0x10, 0x81, 0x19, 0xE4, 0x31, 0x00, 0x03,
-	0xC4, 0x74, 0x01, 0x3C, 0x10, 0x63, 0x00, 0x1E, 0x8E, 0x4A, 0x94, 0x18,
-	0x80, 0x42, 0x4B, 0xD3, 0x26, 0x03, 0xD0, 0x78, 0xF9, 0xBB, 0x00, 0x07,
-	0x7C, 0x9F, 0x48, 0x3C, 0xB9, 0x47, 0xE4, 0x79, 0x0A, 0xD0, 0x0B, 0xDB,
-	0x30, 0x0B, 0xC5, 0x00, 0xC4, 0x7A, 0xC7, 0xAF, 0xD1, 0x2E, 0x14, 0xB9,
-	0xB0, 0x50, 0x6C, 0x0F, 0x34, 0x3B, 0x0A, 0x3A, 0xB7, 0x64, 0xEF, 0xCA,
-	0xCA, 0xCA, 0x3E, 0x77, 0xD0, 0xCD, 0x8C, 0x07, 0xE6, 0xD7, 0xE0, 0xF8,
-	0xDB, 0x0A, 0xE7, 0xB0, 0x8A, 0x6B, 0xDF, 0x5E, 0xD0, 0x45, 0xD2, 0x11,
-	0x88, 0x01, 0x88, 0x4D, 0x41, 0xE8, 0x02, 0xE4, 0x75, 0x60, 0x91, 0xED,
-	0x38, 0x79, 0xBA, 0x00, 0x26, 0x90, 0x23, 0xC2, 0xC4, 0x00, 0x44, 0xB6,
-	0x31, 0x00, 0x11, 0x98, 0x41, 0x1E, 0x03, 0x30, 0x40, 0x1C, 0x13, 0x22,
-	0x06, 0x20, 0xB2, 0x8D, 0x01, 0x88, 0xC0, 0x0C, 0xF2, 0x18, 0x80, 0x01,
-	0x62, 0x0C, 0xC0, 0x03, 0x31, 0x06, 0xE0, 0xE1, 0xA8, 0x44, 0x89, 0x01,
-	0x28, 0xB4, 0x34, 0x6D, 0x32, 0x00, 0x8D, 0x97, 0xF2, 0x14, 0x20, 0x63,
-	0x00, 0x22, 0xDB, 0x8C, 0x01, 0x98, 0x80, 0x09, 0x61, 0x62, 0x00, 0x02,
-	0x2C, 0x4A, 0x93, 0x01, 0x88, 0xC0, 0x0C, 0xF2, 0x64, 0x00, 0x06, 0x88,
-	0xE9, 0x02, 0x78, 0x20, 0xC6, 0x00, 0x3C, 0x1C, 0x95, 0x28, 0x31, 0x00,
-	0x85, 0x96, 0xA6, 0x4D, 0x06, 0xA0, 0xF1, 0x4A, 0x06, 0x20, 0xF2, 0x72,
-	0xC8, 0x63, 0x00, 0x0E, 0x8A, 0xA3, 0x63, 0xC4, 0x00, 0x44, 0xB6, 0xC9,
-	0x00, 0x44, 0x60, 0x06, 0x79, 0x0C, 0xC0, 0x00, 0x31, 0x5D, 0x00, 0x0F,
-	0xC4, 0x18, 0x80, 0x87, 0xA3, 0x12, 0x25, 0x06, 0xA0, 0xD0, 0xD2, 0xB4,
-	0xC9, 0x00, 0x34, 0x5E, 0xE9, 0x02, 0x88, 0xBC, 0x1C, 0xF2, 0x18, 0x80,
-	0x83, 0x62, 0xBA, 0x00, 0x16, 0x8A, 0xC9, 0x00, 0x2C, 0x18, 0xA5, 0x20,
-	0x31, 0x00, 0x09, 0x97, 0x24, 0x4E, 0x06, 0x20, 0xE1, 0xCA, 0x63, 0x40,
-	0x11, 0x97, 0x45, 0x1E, 0x03, 0xB0, 0x60, 0x1C, 0x19, 0x24, 0x06, 0x20,
-	0xB2, 0x4D, 0x06, 0x20, 0x02, 0x33, 0xC8, 0x63, 0x00, 0x06, 0x88, 0x19,
-	0x04, 0xF4, 0x40, 0x8C, 0x01, 0x78, 0x38, 0x2A, 0x51, 0x62, 0x00, 0x0A,
-	0x2D, 0x4D, 0x9B, 0x0C, 0x40, 0xE3, 0x95, 0x41, 0x40, 0x91, 0x97, 0x43,
-	0x1E, 0x03, 0x70, 0x50, 0xCC, 0x20, 0xA0, 0x85, 0x62, 0x32, 0x00, 0x0B,
-	0x46, 0x29, 0x48, 0x0C, 0x40, 0xC2, 0x25, 0x89, 0x93, 0x01, 0x48, 0xB8,
-	0x32, 0x08, 0x28, 0xE2, 0xB2, 0xC8, 0x63, 0x00, 0x16, 0x8C, 0x19, 0x04,
-	0x74, 0x60, 0x4C, 0x06, 0xE0, 0xA0, 0xA8, 0xC5, 0x88, 0x01, 0x68, 0xBC,
-	0x14, 0x75, 0x32, 0x00, 0x85, 0x16, 0xB4, 0x31, 0x00, 0x11, 0x98, 0x41,
-	0x1E, 0x03, 0x30, 0x40, 0xCC, 0x53, 0x00, 0x0F, 0xC4, 0x18, 0x80, 0x87,
-	0xA3, 0x12, 0x25, 0x06, 0xA0, 0xD0, 0xD2, 0xB4, 0xC9, 0x00, 0x34, 0x5E,
-	0xC9, 0x00, 0x44, 0x5E, 0x0E, 0x79, 0x0C, 0xC0, 0x41, 0x31, 0x4F, 0x01,
-	0x2C, 0x14, 0x93, 0x01, 0x58, 0x30, 0x4A, 0x41, 0x62, 0x00, 0x12, 0x2E,
-	0x49, 0x9C, 0x0C, 0x40, 0xC2, 0x95, 0x31, 0x00, 0x11, 0x97, 0x45, 0x1E,
-	0x03, 0xB0, 0x60, 0xCC, 0x53, 0x00, 0x07, 0xC6, 0x64, 0x00, 0x0E, 0x8A,
-	0x5A, 0x8C, 0x18, 0x80, 0xC6, 0x4B, 0x51, 0x27, 0x03, 0x50, 0x68, 0x3D,
-	0xF2, 0x14, 0xA0, 0xFA, 0x65, 0xA0, 0xDD, 0xF8, 0x4A, 0xCD, 0xD1, 0x62,
-	0xF8, 0xC8, 0x47, 0x10, 0x00, 0xF3, 0x7C, 0x19, 0x68, 0x46, 0x2D, 0x23,
-	0x06, 0x20, 0x82, 0x45, 0x63, 0xFC, 0x6D, 0x14, 0xB9, 0xA0, 0x50, 0xEC,
-	0x93, 0x30, 0x80, 0x57, 0x14, 0x74, 0x91, 0x4C, 0x20, 0x00, 0xE6, 0x9F,
-	0x80, 0xE4, 0xE5, 0x05, 0x50, 0x17, 0x81, 0xF9, 0xDB, 0x0B, 0xBA, 0x48,
-	0x3A, 0x02, 0x31, 0x00, 0xB1, 0x29, 0xA0, 0x31, 0x9E, 0x83, 0x22, 0xEF,
-	0x28, 0x14, 0xBB, 0x03, 0x8D, 0xF1, 0xA8, 0x82, 0x2E, 0x92, 0xC9, 0x06,
-	0x70, 0x3B, 0x24, 0x47, 0x16, 0x40, 0x9D, 0x03, 0xE6, 0x97, 0x17, 0x74,
-	0x91, 0xC4, 0x00, 0xFA, 0xB5, 0x01, 0x18, 0xC0, 0x19, 0x28, 0x79, 0x55,
-	0xA1, 0xF4, 0x1E, 0x34, 0xC6, 0xC3, 0x0A, 0xBA, 0x48, 0x26, 0x1B, 0xC0,
-	0x17, 0x21, 0x39, 0xB4, 0x00, 0xEA, 0x0C, 0x30, 0x7F, 0x5F, 0x41, 0x17,
-	0x49, 0x0C, 0xA0, 0x5F, 0x1B, 0x80, 0x01, 0x1C, 0x87, 0x92, 0x37, 0x15,
-	0x4A, 0xEF, 0x43, 0x63, 0x7C, 0x76, 0x41, 0x17, 0xC9, 0x64, 0x03, 0xF8,
-	0x1C, 0x24, 0x47, 0x14, 0x40, 0x9D, 0x09, 0xE6, 0xEF, 0x2D, 0xE8, 0x22,
-	0x89, 0x01, 0xF4, 0x6B, 0x03, 0x30, 0x80, 0xAD, 0x28, 0xF9, 0xE9, 0x62,
-	0xE9, 0xA7, 0xA1, 0x41, 0x7E, 0xB3, 0xA8, 0x8D, 0x6C, 0x0C, 0x01, 0x30,
-	0xFF, 0x4F, 0xFC, 0xD3, 0xD3, 0x0B, 0x80, 0xB6, 0x83, 0xF7, 0x6A, 0x41,
-	0x17, 0x49, 0x0C, 0xA0, 0x5F, 0x1B, 0x40, 0x63, 0x7C, 0x31, 0x4A, 0xDE,
-	0x51, 0x2C, 0x7D, 0x38, 0x1A, 0xE4, 0x17, 0x8A, 0xDA, 0xC8, 0x46, 0x10,
-	0x00, 0xEF, 0x17, 0xE2, 0xFF, 0xBE, 0xAB, 0x08, 0xE7, 0x48, 0xF0, 0xFE,
-	0x6C, 0x51, 0x1B, 0x19, 0x08, 0x64, 0x10, 0x50, 0x6C, 0x06, 0x68, 0x90,
-	0xDF, 0x87, 0x22, 0xF7, 0x60, 0x7F, 0x6A, 0xA1, 0xE8, 0xC9, 0x68, 0x90,
-	0xD7, 0x17, 0x74, 0x91, 0x8C, 0xFF, 0xF5, 0x3F, 0x09, 0xFF, 0xF4, 0x67,
-	0x05, 0x40, 0xCC, 0xB4, 0x0E, 0x06, 0xEF, 0xAF, 0x17, 0xB4, 0x91, 0x24,
-	0x03, 0xE8, 0xDF, 0x06, 0x60, 0x02, 0xD5, 0x41, 0xA9, 0x8B, 0xD1, 0x20,
-	0x2B, 0x8F, 0x0C, 0xFB, 0x9F, 0x4C, 0xE3, 0x25, 0xC1, 0xFA, 0x8D, 0xB8,
-	0xC4, 0xAB, 0x0B, 0x97, 0xF9, 0x00, 0x58, 0x1F, 0x54, 0xD0, 0x45, 0xB2,
-	0x8E, 0x40, 0x32, 0x80, 0x1E, 0xCD, 0x01, 0x8D, 0xF2, 0x46, 0x14, 0xFB,
-	0xF9, 0x42, 0xD1, 0x8F, 0xA0, 0x51, 0xBE, 0xB6, 0xA0, 0x8B, 0x64, 0x7C,
-	0x06, 0x70, 0x1D, 0xFE, 0xE9, 0x94, 0x02, 0xA0, 0x8F, 0x82, 0xF5, 0x09,
-	0x05, 0x5D, 0x24, 0x31, 0x80, 0xE9, 0xDA, 0x80, 0x30, 0x1B, 0xF0, 0x41,
-	0x1C, 0xE9, 0x20, 0x34, 0x4C, 0xFE, 0x99, 0xAD, 0x07, 0x01, 0xB0, 0xFE,
-	0x0A, 0x8A, 0x6D, 0x29, 0x14, 0x5D, 0x05, 0xE7, 0xED, 0x05, 0x5D, 0x24,
-	0x31, 0x80, 0xE9, 0xDA, 0x00, 0x1A, 0xE5, 0xEB, 0x10, 0xE1, 0x4F, 0x8A,
-	0x51, 0x5E, 0x85, 0x86, 0xF9, 0xF1, 0xA2, 0x36, 0xB2, 0x75, 0x04, 0xC0,
-	0xF9, 0x18, 0xFC, 0xF5, 0xAF, 0x8A, 0x50, 0x4E, 0x07, 0xE7, 0x6B, 0x8B,
-	0xDA, 0xC8, 0x3A, 0x02, 0xE9, 0x02, 0xF4, 0x68, 0x0A, 0x68, 0x98, 0x1C,
-	0x00, 0xE4, 0xA3, 0xA9, 0x27, 0x15, 0x8A, 0xBF, 0x03, 0x0D, 0xF3, 0xDC,
-	0x82, 0x2E, 0x92, 0x0D, 0x04, 0x84, 0xFE, 0x3F, 0x4B, 0x3E, 0x1F, 0x9C,
-	0xF7, 0x06, 0xA2, 0x46, 0x20, 0x06, 0xA0, 0xF1, 0x7A, 0x54, 0x8D, 0xC6,
-	0xF9, 0xD7, 0xF8, 0xCB, 0x4F, 0x17, 0x8A, 0x73, 0xCE, 0xC0, 0xCB, 0xD1,
-	0x38, 0x1F, 0x2A, 0x68, 0x23, 0xE9, 0x08, 0x80, 0x2F, 0xCD, 0xF5, 0x36,
-	0xEC, 0x5B, 0x0B, 0x50, 0xFE, 0x06, 0x7C, 0x7F, 0xA6, 0xA0, 0x8B, 0x64,
-	0x03, 0x81, 0x18, 0x40, 0xCF, 0x26, 0x81, 0x06, 0xFA, 0x2E, 0x14, 0x7D,
-	0x6B, 0xB1, 0xF8, 0x31, 0x68, 0xA0, 0xB7, 0x16, 0xB5, 0x91, 0x81, 0x00,
-	0xF8, 0xBE, 0x12, 0x7F, 0x54, 0xBB, 0x4E, 0xEF, 0x06, 0xDF, 0x5F, 0x0F,
-	0x38, 0x9D, 0x40, 0x0C, 0x40, 0x67, 0xF6, 0x70, 0x09, 0xB1, 0x81, 0x7E,
-	0x10, 0x0D, 0xF4, 0x0D, 0x3D, 0x0F, 0x35, 0xC8, 0x62, 0xE0, 0x7B, 0x3E,
-	0x2E, 0xFC, 0xA2, 0xE2, 0xC5, 0xBF, 0x01, 0x7C, 0x3F, 0x58, 0xD4, 0x46,
-	0xB6, 0x8E, 0x40, 0x0C, 0xA0, 0x67, 0x73, 0xE8, 0x52, 0xD4, 0xAF, 0xA1,
-	0xF8, 0x33, 0x0B, 0x21, 0x38, 0x49, 0xE5, 0x07, 0xD0, 0x48, 0x1F, 0x28,
-	0x68, 0x07, 0x2F, 0xE9, 0xD8, 0x7E, 0x19, 0x20, 0xB6, 0x14, 0x60, 0xB0,
-	0x6B, 0xF5, 0x6C, 0xB0, 0xBD, 0xBF, 0xA0, 0x8D, 0x64, 0x03, 0x81, 0x18,
-	0xC0, 0x14, 0x4D, 0x02, 0x0D, 0x95, 0x6F, 0x05, 0xF2, 0xED, 0xC0, 0xCA,
-	0x76, 0x01, 0x1A, 0xE9, 0xC5, 0x15, 0xE1, 0xD0, 0x35, 0xE2, 0xAF, 0xFF,
-	0x7B, 0xC1, 0xF5, 0xCC, 0xA1, 0x33, 0xEB, 0x7B, 0xFD, 0x31, 0x80, 0xBE,
-	0xE4, 0x1E, 0xE9, 0x06, 0xFC, 0x1C, 0xFE, 0xF8, 0xF3, 0x62, 0x88, 0x7F,
-	0x82, 0xEE, 0x34, 0x34, 0xD6, 0x3D, 0x45, 0xFD, 0x20, 0x65, 0x60, 0xCA,
-	0xD7, 0x7E, 0x3F, 0x84, 0xFD, 0x47, 0x8A, 0x00, 0x8E, 0x05, 0xD3, 0xBF,
-	0x28, 0x6A, 0x23, 0x4B, 0x06, 0xE0, 0x6B, 0x03, 0x68, 0xAC, 0xDF, 0x8D,
-	0x68, 0x9F, 0xC4, 0x5E, 0x59, 0xAC, 0x82, 0x07, 0xBE, 0x1C, 0x8D, 0x95,
-	0x0B, 0x8A, 0x64, 0x1B, 0x43, 0x00, 0x4C, 0x2F, 0xC3, 0x3F, 0xFD, 0x66,
-	0x11, 0x10, 0x5F, 0xCA, 0xE2, 0x13, 0x96, 0xFF, 0x2E, 0xEA, 0x23, 0x8B,
-	0x01, 0x78, 0xDB, 0x00, 0x1A, 0xEC, 0xDB, 0x10, 0xF1, 0xD2, 0x62, 0x54,
-	0xF6, 0x57, 0xF9, 0xBC, 0x9A, 0x2F, 0x13, 0x65, 0xDB, 0x40, 0x00, 0x2C,
-	0xF9, 0xCA, 0x2F, 0x67, 0xFE, 0x55, 0x5E, 0xFD, 0x65, 0xE9, 0xA4, 0xFF,
-	0x53, 0xB6, 0xA2, 0x74, 0x01, 0xA6, 0x04, 0x88, 0x46, 0xFB, 0x02, 0x84,
-	0xB8, 0x01, 0xFB, 0x0F, 0x17, 0x43, 0x5D, 0x0D, 0x03, 0x78, 0x73, 0x51,
-	0x3B, 0x28, 0x19, 0x58, 0xFE, 0x1E, 0x2E, 0xF8, 0x4D, 0xC5, 0x8B, 0xFE,
-	0x17, 0xE8, 0x4E, 0x04, 0xCB, 0xBB, 0x8B, 0xFA, 0xC8, 0x46, 0x10, 0x88,
-	0x01, 0x18, 0x9A, 0x05, 0x1A, 0x2E, 0x07, 0xF7, 0xCE, 0x2B, 0x86, 0xE2,
-	0x93, 0x00, 0x8E, 0x05, 0x54, 0xA7, 0xB8, 0x16, 0xC3, 0x2E, 0xB7, 0x0C,
-	0x0C, 0x5F, 0x85, 0x2B, 0x60, 0xDF, 0xBF, 0xFA, 0xEB, 0x7F, 0x09, 0x18,
-	0xF2, 0x51, 0x61, 0xB6, 0x29, 0x08, 0xC4, 0x00, 0xA6, 0x80, 0xB7, 0x56,
-	0xB4, 0x47, 0xEA, 0xCA, 0x45, 0x2E, 0x8F, 0xCE, 0xEC, 0xC0, 0xFF, 0x87,
-	0x0F, 0x86, 0x7F, 0x8A, 0xBF, 0x55, 0xDF, 0x9C, 0x4C, 0x57, 0xCA, 0xD0,
-	0x6E, 0x19, 0x22, 0x06, 0x60, 0x02, 0x29, 0x0E, 0x5E, 0xF1, 0xA8, 0xF9,
-	0x05, 0xEB, 0xD8, 0x8B, 0x19, 0x14, 0x4B, 0x65, 0x30, 0xD5, 0xD4, 0x6E,
-	0x63, 0x00, 0x26, 0x90, 0x68, 0xC4, 0x3F, 0x8E, 0x50, 0xFC, 0x80, 0xC5,
-	0x8F, 0x15, 0x43, 0xFE, 0x2F, 0x74, 0x3B, 0x91, 0x05, 0x54, 0x56, 0x18,
-	0x2E, 0x86, 0x5C, 0x3E, 0x19, 0xB8, 0xF1, 0x19, 0xFE, 0x3B, 0xB1, 0x7F,
-	0x67, 0xF1, 0xEC, 0xFF, 0x01, 0xBA, 0xED, 0xE0, 0xF6, 0x77, 0x45, 0x7D,
-	0x64, 0x07, 0x20, 0x10, 0x03, 0x30, 0x36, 0x0F, 0x34, 0xE6, 0x1D, 0x08,
-	0xF7, 0xEE, 0x47, 0xBB, 0x06, 0x93, 0x53, 0xAC, 0x7F, 0xEF, 0x4C, 0xA0,
-	0xB2, 0xE4, 0x95, 0xF1, 0x4C, 0x17, 0x23, 0x14, 0x78, 0x9D, 0xDC, 0xDD,
-	0xFC, 0x3F, 0x28, 0x9C, 0xD1, 0x5B, 0x71, 0xF3, 0xBF, 0x47, 0xD0, 0x47,
-	0x1A, 0x03, 0x98, 0x4F, 0x1B, 0x40, 0x83, 0xE6, 0x92, 0x54, 0xCC, 0x02,
-	0x8E, 0x15, 0x8E, 0xF8, 0xF9, 0xCE, 0x04, 0xF8, 0x76, 0xE1, 0x60, 0x36,
-	0xB0, 0xE2, 0xDB, 0x7B, 0xFC, 0xE5, 0xFF, 0x09, 0xE1, 0xA2, 0x39, 0xE9,
-	0x8A, 0xBF, 0xFE, 0x7C, 0x15, 0x3B, 0x9B, 0x81, 0x40, 0x32, 0x00, 0x03,
-	0xC4, 0xF5, 0x21, 0xD0, 0xB0, 0xF9, 0xDD, 0x00, 0x9A, 0x40, 0x75, 0x34,
-	0x9B, 0xC5, 0x6F, 0xE9, 0x4C, 0x60, 0x10, 0xEF, 0xB3, 0x83, 0xD1, 0xF3,
-	0xBA, 0x9B, 0xFF, 0xD5, 0x02, 0x7E, 0x3E, 0x3D, 0xE1, 0xCD, 0x7F, 0xB3,
-	0x50, 0x26, 0xD2, 0x09, 0x04, 0x62, 0x00, 0x33, 0x68, 0x22, 0x68, 0xE0,
-	0x4C, 0x51, 0xCF, 0x16, 0x43, 0xD3, 0x04, 0x8E, 0x1F, 0xC2, 0x93, 0x01,
-	0xF0, 0xE1, 0x22, 0x9F, 0x5C, 0xEC, 0x53, 0xD9, 0xAE, 0x03, 0x9B, 0x53,
-	0x95, 0x02, 0xD1, 0x4E, 0x26, 0x10, 0x03, 0x98, 0xCC, 0x48, 0x56, 0xA0,
-	0x81, 0x7F, 0x3F, 0x0A, 0xFD, 0x2E, 0xF6, 0xCA, 0xC2, 0xA1, 0xEB, 0xE3,
-	0x73, 0x2C, 0xE0, 0x77, 0xD0, 0xD0, 0xD9, 0x2D, 0x68, 0x6E, 0x03, 0x17,
-	0xA6, 0xFB, 0xBF, 0x81, 0x9D, 0x7D, 0x7F, 0x65, 0xFB, 0x28, 0xC4, 0x6F,
-	0x01, 0x97, 0xAF, 0x2A, 0x85, 0xA2, 0x9D, 0x4C, 0x20, 0x06, 0x30, 0x99,
-	0x51, 0x2F, 0x05, 0x1A, 0xFB, 0x56, 0x14, 0xBC, 0x12, 0x7B, 0xF5, 0xA9,
-	0xC0, 0xDA, 0x71, 0x38, 0x16, 0x40, 0x13, 0x60, 0x46, 0xD0, 0xCC, 0x06,
-	0x1E, 0x4C, 0xF7, 0x79, 0xF3, 0xAB, 0x2B, 0xF7, 0x70, 0xD4, 0xFF, 0x2C,
-	0xF0, 0xD8, 0xDD, 0x0C, 0x8C, 0x05, 0xBA, 0x90, 0x18, 0xC0, 0x0C, 0x2B,
-	0x03, 0x8D, 0xFE, 0xF5, 0x08, 0xCF, 0x4C, 0xE0, 0xBB, 0xC4, 0xC3, 0x70,
-	0x2C, 0x80, 0x26, 0xF0, 0x87, 0x62, 0xB9, 0x85, 0x94, 0x83, 0xC3, 0x2F,
-	0x77, 0x37, 0x3F, 0xFB, 0xFE, 0xCA, 0xF6, 0x3F, 0x10, 0xF3, 0x97, 0x3F,
-	0x8B, 0x7D, 0x28, 0xD4, 0x04, 0x6D, 0x0C, 0x40, 0x80, 0xD5, 0x47, 0x8A,
-	0xC6, 0xCF, 0x17, 0x85, 0xF8, 0xC2, 0x90, 0xBA, 0x71, 0xB6, 0x1B, 0xD7,
-	0x10, 0xA8, 0x7C, 0x8A, 0x5C, 0x8D, 0x3D, 0x37, 0x3D, 0xAE, 0x9F, 0x2B,
-	0x28, 0x7F, 0x00, 0xFB, 0x53, 0x7A, 0x1C, 0xF4, 0x5A, 0x5C, 0xFF, 0xE9,
-	0x3D, 0xCA, 0xA5, 0x48, 0x91, 0x40, 0x0C, 0xA0, 0x08, 0x6A, 0x1A, 0x59,
-	0xCF, 0x41, 0xAF, 0xB5, 0x43, 0xAE, 0xE2, 0x3F, 0xDE, 0x84, 0x1B, 0x61,
-	0xA9, 0xBE, 0x2D, 0x80, 0x6B, 0xE6, 0xA2, 0x9E, 0xBB, 0xB0, 0xF7, 0x9D,
-	0xAF, 0x3F, 0x98, 0x41, 0xD1, 0x69, 0xDA, 0xD6, 0xB4, 0x65, 0x63, 0x00,
-	0xD3, 0x12, 0x2C, 0x94, 0xC7, 0xCD, 0xC0, 0x65, 0xC3, 0x2E, 0xC1, 0xFE,
-	0x2B, 0x05, 0xF9, 0x28, 0x09, 0x3F, 0x45, 0xC6, 0xB9, 0xF2, 0x1F, 0x5E,
-	0xF4, 0x81, 0xB0, 0x6E, 0x00, 0xF4, 0x17, 0x70, 0xAE, 0x1C, 0xB1, 0x3F,
-	0xAC, 0xE7, 0xF5, 0xFE, 0x01, 0xCA, 0x9D, 0x87, 0x6B, 0xCD, 0x32, 0x5F,
-	0x3D, 0x01, 0x56, 0x8B, 0xC5, 0x00, 0xAA, 0xA4, 0xA6, 0xD4, 0x75, 0xBF,
-	0x88, 0x5C, 0x22, 0xFC, 0xA8, 0x29, 0x42, 0x71, 0x1D, 0x81, 0x73, 0x71,
-	0x63, 0xF0, 0xF5, 0xE3, 0x85, 0xDB, 0xBA, 0x81, 0x4F, 0x3E, 0x02, 0xE5,
-	0xAA, 0x3E, 0x7D, 0x37, 0x8E, 0x7F, 0xBC, 0x08, 0xD7, 0x98, 0xF5, 0x13,
-	0xFB, 0x12, 0x14, 0xCA, 0xC5, 0x00, 0x04, 0x58, 0xD3, 0x4A, 0x71, 0x83,
-	0x3C, 0x97, 0x37, 0x30, 0xF6, 0x69, 0x3F, 0x61, 0xF5, 0x31, 0x66, 0x03,
-	0xCC, 0x0A, 0x70, 0xA3, 0xEC, 0x9F, 0xF6, 0xBC, 0xA6, 0x29, 0x8F, 0x6B,
-	0x62, 0x1B, 0xE2, 0xAF, 0x3D, 0x7F, 0xF5, 0x7F, 0x76, 0x9A, 0x58, 0x28,
-	0xCB, 0x09, 0x54, 0x97, 0xE2, 0x9A, 0xB8, 0x20, 0x68, 0xB6, 0x39, 0x10,
-	0x88, 0x01, 0xCC, 0x01, 0xF2, 0xFA, 0x43, 0x74, 0x99, 0x00, 0x3F, 0x2B,
-	0x56, 0x7D, 0xF5, 0xF5, 0x40, 0x67, 0xC8, 0x7E, 0xF2, 0xBB, 0x36, 0xEB,
-	0x11, 0x19, 0xAE, 0xE5, 0x70, 0x1C, 0xFF, 0xD7, 0xB0, 0x6F, 0x33, 0x60,
-	0xDC, 0x8D, 0x18, 0xAF, 0xC1, 0xB5, 0x70, 0x05, 0xE5, 0x6C, 0x73, 0x22,
-	0x10, 0x03, 0x98, 0x13, 0xE8, 0x8D, 0x87, 0xE9, 0x39, 0x5B, 0x70, 0xDC,
-	0xD9, 0xDE, 0x87, 0x7F, 0x58, 0xC5, 0xFE, 0x21, 0xDC, 0x40, 0x33, 0x9D,
-	0x4E, 0x8C, 0xF3, 0x7E, 0x4E, 0x77, 0xC3, 0x9F, 0x86, 0x3F, 0xD5, 0xC7,
-	0x7A, 0xE3, 0xCE, 0x9F, 0x5D, 0x9A, 0x53, 0x87, 0x30, 0x0B, 0x72, 0x93,
-	0x9A, 0xDB, 0xD8, 0xC3, 0xC6, 0x00, 0x36, 0xB1, 0x46, 0x70, 0x33, 0x71,
-	0xBA, 0x30, 0x5F, 0x88, 0xA9, 0x7C, 0x63, 0xB0, 0x7A, 0xA6, 0xF7, 0x42,
-	0xC8, 0xAF, 0x10, 0x71, 0x42, 0xD1, 0xAD, 0xD3, 0xF6, 0xA5, 0x71, 0x8E,
-	0xFC, 0x0E, 0xE2, 0x56, 0xEC, 0x2F, 0xC5, 0xCE, 0xAF, 0xF5, 0xB8, 0x6E,
-	0xFA, 0xB5, 0xEB, 0xE1, 0x63, 0x4E, 0x3E, 0xEE, 0xCC, 0xA7, 0xD3, 0xAA,
-	0x35, 0x6C, 0xD4, 0xC5, 0x00, 0x8C, 0x30, 0xFB, 0x84, 0xEA, 0xD2, 0xE8,
-	0xEB, 0x51, 0x76, 0x4B, 0x9F, 0xF2, 0x85, 0x32, 0xCC, 0x0E, 0xB8, 0x6E,
-	0x1E, 0x07, 0x10, 0xB9, 0x8E, 0x1E, 0x53, 0xEC, 0x7D, 0xD8, 0x37, 0x3E,
-	0x56, 0xA4, 0x09, 0xF1, 0xD7, 0x9D, 0xCF, 0xEB, 0xB9, 0xBE, 0xE1, 0xC1,
-	0xDD, 0xCD, 0xCE, 0x3F, 0x67, 0xB1, 0x71, 0x84, 0x9F, 0x5F, 0xF4, 0xCD,
-	0x27, 0xD3, 0x66, 0x41, 0xB7, 0x18, 0x33, 0x06, 0x50, 0x04, 0x35, 0x4B,
-	0x19, 0x4C, 0xE0, 0x47, 0x11, 0xFF, 0x2D, 0xD8, 0xFB, 0x3E, 0x26, 0x9C,
-	0xE5, 0xE9, 0xCD, 0x22, 0xF6, 0xFB, 0x11, 0xF4, 0x2A, 0xDC, 0xFC, 0xFF,
-	0x38, 0x8B, 0xE0, 0x89, 0x59, 0x27, 0x10, 0x03, 0xA8, 0xB3, 0x9A, 0xB9,
-	0x12, 0x46, 0xC0, 0x37, 0xE4, 0x38, 0x73, 0x50, 0x79, 0x95, 0x78, 0xE6,
-	0xE7, 0x65, 0x3C, 0x00, 0xB3, 0x0E, 0xCE, 0x87, 0xE0, 0x27, 0xD3, 0x93,
-	0xF2, 0x1B, 0xC1, 0xF6, 0x0D, 0x15, 0x03, 0xE8, 0x4B, 0x6E, 0x46, 0xE5,
-	0x60, 0x02, 0x87, 0x20, 0xF4, 0x36, 0xEC, 0xBF, 0x88, 0xFD, 0x19, 0x33,
-	0x3A, 0xCC, 0xBC, 0xC3, 0x7E, 0x03, 0x07, 0x5C, 0xC5, 0xFE, 0xC7, 0xB8,
-	0xF1, 0xBF, 0x34, 0xEF, 0x83, 0xE7, 0x78, 0xE3, 0x09, 0xC4, 0x00, 0x16,
-	0xB4, 0x75, 0xC0, 0x08, 0x8E, 0x60, 0x9A, 0x8C, 0x9D, 0x8F, 0xDA, 0x96,
-	0x79, 0xE3, 0xD8, 0xC3, 0x99, 0xE9, 0xEB, 0x2F, 0x66, 0x15, 0xC6, 0x00,
-	0x16, 0xB3, 0x5E, 0x1E, 0x3E, 0xAB, 0x6E, 0xCE, 0xC0, 0x09, 0xF8, 0xCF,
-	0x13, 0xB1, 0xF3, 0xCF, 0x65, 0xA9, 0x2F, 0x4E, 0x4E, 0xBA, 0x11, 0x3B,
-	0x1F, 0xEF, 0xDD, 0x98, 0x74, 0x7F, 0x71, 0x1B, 0xD9, 0xB2, 0x34, 0xA8,
-	0xC5, 0x25, 0x38, 0xA7, 0x33, 0x83, 0x19, 0xD0, 0x00, 0xD6, 0xCC, 0xE0,
-	0xC9, 0x73, 0x3A, 0xAC, 0x7A, 0x98, 0x6F, 0xAD, 0xBB, 0xE9, 0x69, 0x00,
-	0xD9, 0x16, 0x9C, 0x40, 0x0C, 0x60, 0xC1, 0x2B, 0x68, 0xE3, 0xE9, 0xC1,
-	0x08, 0x5E, 0x82, 0xFF, 0xEF, 0x65, 0xDD, 0xCE, 0x6E, 0xC2, 0x22, 0x6C,
-	0x77, 0xE2, 0x24, 0x6E, 0xE3, 0x8E, 0x5F, 0xFB, 0xCF, 0x2C, 0xC2, 0x09,
-	0xE5, 0x1C, 0x6A, 0x04, 0x62, 0x00, 0x35, 0x4E, 0x0B, 0xA7, 0xEA, 0xBA,
-	0x07, 0x9C, 0x98, 0x73, 0x0A, 0x76, 0xAE, 0xB6, 0x33, 0xEF, 0x27, 0x07,
-	0x9C, 0x4F, 0xF0, 0x29, 0xEC, 0xFC, 0x9C, 0xD7, 0x2D, 0xCB, 0xF6, 0xBA,
-	0xF2, 0xC2, 0x55, 0xE8, 0x26, 0x9D, 0x50, 0x0C, 0x60, 0x93, 0xC0, 0x3B,
-	0x0F, 0xDB, 0x99, 0x01, 0x07, 0x0B, 0x5F, 0x88, 0x7D, 0xED, 0x4F, 0x3E,
-	0x4D, 0x70, 0x6E, 0x1C, 0xBD, 0xBF, 0x0B, 0xFB, 0x17, 0xD6, 0xFE, 0x4C,
-	0xDF, 0xDE, 0x89, 0x77, 0x73, 0x62, 0xC5, 0x00, 0x36, 0x87, 0xFB, 0xCC,
-	0x8F, 0x0A, 0x53, 0xD8, 0x82, 0x83, 0xF0, 0xCB, 0xC5, 0x9C, 0xC9, 0xC7,
-	0x99, 0x7D, 0x7C, 0x45, 0xF7, 0x59, 0xDD, 0x81, 0xB9, 0x3E, 0x01, 0xA7,
-	0xF8, 0xAE, 0xDF, 0xF8, 0x8B, 0xBE, 0xF6, 0xFE, 0x3D, 0x67, 0x0A, 0xF2,
-	0x9D, 0x02, 0x4E, 0xD4, 0xE1, 0x28, 0xFE, 0xDE, 0x59, 0xBF, 0x63, 0x30,
-	0x73, 0x20, 0x39, 0xC0, 0x48, 0x02, 0xFF, 0x07, 0x0D, 0x53, 0x38, 0x97,
-	0x7C, 0x72, 0xF0, 0x88, 0x00, 0x00, 0x00, 0x00, 0x49, 0x45, 0x4E, 0x44,
-	0xAE, 0x42, 0x60, 0x82
-};
@@ -15,26 +15,28 @@
 #include <GL/gl.h>
 #include <algorithm>
 #include <cstdlib>
+#include <future>
 #include <iostream>
 #include <thread>
 #include <unordered_map>
 #include <utility>
 
-#include "Assets/Fonts/Roboto-Bold.h"
-#include "Assets/Fonts/Roboto-Italic.h"
-#include "Assets/Fonts/Roboto-Regular.h"
-#include "Assets/Images/InfinityAppIcon.h"
-#include "Assets/Images/logo.h"
-#include "Assets/Images/windowIcons.h"
+#include "Assets/Icons.h"
+#include "Backend/AssetPack/AssetPack.hpp"
+#include "Backend/FontAtlasCache/FontAtlasCache.hpp"
+#include "Backend/Image/PixelBuffer.hpp"
+#include "Backend/Image/SvgRasterCache.hpp"
+#include "Backend/Image/TextureAtlas.hpp"
+#include "Backend/Image/TextureResidency.hpp"
 #include "Backend/SystemTray/SystemTray.hpp"
 #include "Backend/TextureQueue/TextureQueue.hpp"
 #include "Backend/UIHelpers/UiHelpers.hpp"
+#include "Backend/Updater/Updater.hpp"
 #include "Frontend/Theme/Theme.hpp"
+#include "Util/Tween/Tween.hpp"
 #include "backends/imgui_impl_glfw.h"
 #include "backends/imgui_impl_opengl3.h"
 #include "imgui_internal.h"
-#define STB_IMAGE_IMPLEMENTATION
-#include "stb_image/stb_image.h"
 
 #ifdef WIN32
 #include <Windows.h>
@@ -85,6 +87,13 @@ namespace Infinity {
   std::expected<void, Errors::Error> Application::Init() {
     std::cout << "Initializing" << std::endl;
 
+    // startup is two branches that meet before ImGui is set up:
+    //   worker: map the asset pack -> inflate the fonts -> bake or load the font atlas -> inflate the icons
+    //   main:   GLFW -> window -> GL context -> GLEW -> upload ring
+    //   joined: ImGui context sharing the atlas -> backends -> icon textures
+    // they only meet at the join, so startup takes as long as the slower branch rather than both added up
+    auto assets_ready = std::async(std::launch::async, PrepareAssets);
+
     glfwSetErrorCallback(GLFWErrorCallback);
 
     if (!glfwInit()) {
@@ -125,9 +134,15 @@ namespace Infinity {
       std::cout << "Failed to initialize GLEW: " << glewGetErrorString(err) << std::endl;
       return std::unexpected(Errors::Error(Errors::ErrorType::Fatal, "Failed to initialize GLEW"));
     }
+    PixelUploadRing::GetInstance().Init();
+
+    const auto font_atlas = assets_ready.get();
+    if (!font_atlas) {
+      return std::unexpected(font_atlas.error());
+    }
 
     IMGUI_CHECKVERSION();
-    ImGui::CreateContext();
+    ImGui::CreateContext(*font_atlas);
     ImGuiIO &io = ImGui::GetIO();
     (void) io;
     io.ConfigFlags |= ImGuiConfigFlags_NavEnableKeyboard;
@@ -148,48 +163,63 @@ namespace Infinity {
     ImGui_ImplGlfw_InitForOpenGL(m_window, true);
     ImGui_ImplOpenGL3_Init(version);
 
-    ImFontConfig font_config;
-    font_config.FontDataOwnedByAtlas = false;
-    ImFont *roboto = io.Fonts->AddFontFromMemoryTTF(g_RobotoRegular, sizeof(g_RobotoRegular), 20.0f, &font_config);
-    m_Fonts["Default"] = roboto;
-    m_Fonts["Bold"] = io.Fonts->AddFontFromMemoryTTF(g_RobotoBold, sizeof(g_RobotoBold), 20.0f, &font_config);
-    m_Fonts["Italic"] = io.Fonts->AddFontFromMemoryTTF(g_RobotoItalic, sizeof(g_RobotoItalic), 20.0f, &font_config);
-    m_Fonts["DefaultLarge"] =
-        io.Fonts->AddFontFromMemoryTTF(g_RobotoRegular, sizeof(g_RobotoRegular), 32.0f, &font_config);
-    m_Fonts["DefaultXLarge"] =
-        io.Fonts->AddFontFromMemoryTTF(g_RobotoRegular, sizeof(g_RobotoRegular), 48.0f, &font_config);
-    m_Fonts["BoldLarge"] = io.Fonts->AddFontFromMemoryTTF(g_RobotoBold, sizeof(g_RobotoBold), 32.0f, &font_config);
-    m_Fonts["BoldXLarge"] = io.Fonts->AddFontFromMemoryTTF(g_RobotoBold, sizeof(g_RobotoBold), 48.0f, &font_config);
-    m_Fonts["h1"] = io.Fonts->AddFontFromMemoryTTF(g_RobotoBold, sizeof(g_RobotoBold), 32.0f, &font_config);
-    m_Fonts["h2"] = io.Fonts->AddFontFromMemoryTTF(g_RobotoBold, sizeof(g_RobotoBold), 24.0f, &font_config);
-    m_Fonts["h3"] = io.Fonts->AddFontFromMemoryTTF(g_RobotoBold, sizeof(g_RobotoBold), 20.0f, &font_config);
-
-    io.FontDefault = roboto;
+    io.FontDefault = FontAtlasCache::GetInstance().Get("Default");
 
     {
-      std::shared_ptr<Image> close_image = Image::LoadFromMemory(g_WindowCloseIcon, sizeof(g_WindowCloseIcon));
+      std::shared_ptr<Image> close_image = Image::LoadFromPack(Icons::WINDOW_CLOSE);
       m_icon_close = close_image;
     }
     {
-      std::shared_ptr<Image> logo = Image::LoadFromMemory(g_infAppIconTransparent, sizeof(g_infAppIconTransparent));
+      std::shared_ptr<Image> logo = Image::LoadFromPack(Icons::INFINITY_APP_ICON);
       m_app_header_icon = logo;
     }
     {
-      std::shared_ptr<Image> minimize_image = Image::LoadFromMemory(g_WindowMinimizeIcon, sizeof(g_WindowMinimizeIcon));
+      std::shared_ptr<Image> minimize_image = Image::LoadFromPack(Icons::WINDOW_MINIMIZE);
       m_icon_minimize = minimize_image;
     }
     {
-      std::shared_ptr<Image> maximize_image = Image::LoadFromMemory(g_WindowMaximizeIcon, sizeof(g_WindowMaximizeIcon));
+      std::shared_ptr<Image> maximize_image = Image::LoadFromPack(Icons::WINDOW_MAXIMIZE);
       m_icon_maximize = maximize_image;
     }
     {
-      std::shared_ptr<Image> restore_image = Image::LoadFromMemory(g_WindowRestoreIcon, sizeof(g_WindowRestoreIcon));
+      std::shared_ptr<Image> restore_image = Image::LoadFromPack(Icons::WINDOW_RESTORE);
       m_icon_restore = restore_image;
     }
 
 
     return {};
   }
+  std::expected<ImFontAtlas *, Errors::Error> Application::PrepareAssets() {
+    auto &assets = AssetPack::GetInstance();
+    if (!assets.Open(std::filesystem::path(Updater::GetCurrentExecutablePath()) / "assets.pak", ASSET_PACK_STAMP)) {
+      return std::unexpected(
+          Errors::Error(Errors::ErrorType::Fatal, "Failed to load assets.pak, reinstall the launcher"));
+    }
+
+    // h1 and h3 are the same fonts as BoldLarge and Bold and share their glyphs. The large bold sizes are only used on
+    // project pages, so they are rasterized the first time one is opened
+    const auto regular = assets.Get("Fonts/Roboto-Regular.ttf");
+    const auto bold = assets.Get("Fonts/Roboto-Bold.ttf");
+    const auto italic = assets.Get("Fonts/Roboto-Italic.ttf");
+    ImFontAtlas *atlas = FontAtlasCache::GetInstance().Init({{"Default", regular.data(), regular.size(), 20.0f},
+                                                             {"Bold", bold.data(), bold.size(), 20.0f},
+                                                             {"Italic", italic.data(), italic.size(), 20.0f},
+                                                             {"DefaultLarge", regular.data(), regular.size(), 32.0f},
+                                                             {"DefaultXLarge", regular.data(), regular.size(), 48.0f},
+                                                             {"BoldLarge", bold.data(), bold.size(), 32.0f, true},
+                                                             {"BoldXLarge", bold.data(), bold.size(), 48.0f, true},
+                                                             {"h1", bold.data(), bold.size(), 32.0f, true},
+                                                             {"h2", bold.data(), bold.size(), 24.0f},
+                                                             {"h3", bold.data(), bold.size(), 20.0f}});
+
+    // the icons are only copied into upload memory once the GL side is up, inflating them is done here
+    for (const auto &icon: {Icons::INFINITY_APP_ICON, Icons::WINDOW_CLOSE, Icons::WINDOW_MINIMIZE,
+                            Icons::WINDOW_MAXIMIZE, Icons::WINDOW_RESTORE}) {
+      assets.Get(icon);
+    }
+    return atlas;
+  }
+
   const char *Application::SetupGLVersion() {
 #if defined(IMGUI_IMPL_OPENGL_ES2)
     // GL ES 2.0 + GLSL 100
@@ -226,9 +256,13 @@ namespace Infinity {
     m_icon_restore.reset();
 
 
+    PixelUploadRing::GetInstance().Shutdown();
+    TextureAtlas::GetInstance().Shutdown();
+    SvgRasterCache::GetInstance().Shutdown();
     ImGui_ImplOpenGL3_Shutdown();
     ImGui_ImplGlfw_Shutdown();
     ImGui::DestroyContext();
+    FontAtlasCache::GetInstance().Shutdown();
 
 
     glfwDestroyWindow(m_window);
@@ -260,19 +294,33 @@ namespace Infinity {
     double last_frame_time = glfwGetTime();
 
     while (!glfwWindowShouldClose(m_window) && m_running) {
-      glfwPollEvents();
+      // nothing has moved for a while, so rather than drawing the same frame again wait for input. The timeout keeps
+      // ambient animations and progress from background work ticking over at a low rate
+      if (m_reduce_fps_on_idle && glfwGetTime() - m_last_activity_time > IDLE_SETTLE_TIME) {
+        glfwWaitEventsTimeout(IDLE_FRAME_TIME);
+      } else {
+        glfwPollEvents();
+      }
+      // input reaches ImGui through the GLFW callbacks, so anything queued there means the user did something
+      bool active = !ImGui::GetCurrentContext()->InputEventsQueue.empty();
       {
         std::scoped_lock lock(m_event_queue_mutex);
 
+        active |= !m_event_queue.empty();
         while (!m_event_queue.empty()) {
           auto &func = m_event_queue.front();
           func();
           m_event_queue.pop();
         }
       }
+      Tweens::GetInstance().Update(m_frame_time);
       m_layer->OnUpdate(m_time_step);
-      ProcessImageQueue();
+      active |= ProcessImageQueue();
 
+      if (FontAtlasCache::GetInstance().Update()) {
+        ImGui_ImplOpenGL3_DestroyFontsTexture();
+        ImGui_ImplOpenGL3_CreateFontsTexture();
+      }
       ImGui_ImplOpenGL3_NewFrame();
       ImGui_ImplGlfw_NewFrame();
       ImGui::NewFrame();
@@ -316,6 +364,9 @@ namespace Infinity {
       glClear(GL_COLOR_BUFFER_BIT);
       ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
       glfwSwapBuffers(m_window);
+      TextureResidency::GetInstance().EndFrame();
+
+      if (active || io.WantTextInput || Tweens::GetInstance().IsAnimating()) m_last_activity_time = glfwGetTime();
 
       const float time = GetTime();
       m_frame_time = time - m_last_frame_time;
@@ -341,24 +392,19 @@ namespace Infinity {
 
   bool Application::IsMaximized() const { return static_cast<bool>(glfwGetWindowAttrib(m_window, GLFW_MAXIMIZED)); }
 
-  ImFont *Application::GetFont(const std::string &name) {
-    if (!s_instance->m_Fonts.contains(name)) {
-      return nullptr;
-    }
-    return s_instance->m_Fonts.at(name);
-  }
-
-  void Application::SetWindowIcon(GLFWwindow *window, const unsigned char *data, const int size) {
-    GLFWimage images[1];
-    images[0].pixels = stbi_load_from_memory(data, size, &images[0].width, &images[0].height, nullptr, 4);
+  ImFont *Application::GetFont(const std::string &name) { return FontAtlasCache::GetInstance().Get(name); }
 
-    if (images[0].pixels == nullptr) {
+  void Application::SetWindowIcon(GLFWwindow *window, const AssetPack::Icon &icon) {
+    const auto pixels = AssetPack::GetInstance().Get(icon);
+    if (pixels.empty()) {
       std::cerr << "Failed to load image" << std::endl;
       return;
     }
 
-    glfwSetWindowIcon(s_instance->m_window, 1, images);
-    stbi_image_free(images[0].pixels);
+    // GLFW copies the pixels, they are only non-const in its signature
+    GLFWimage image{static_cast<int>(icon.width), static_cast<int>(icon.height),
+                    const_cast<unsigned char *>(pixels.data())};
+    glfwSetWindowIcon(window, 1, &image);
   }
 
   void Application::SetWindowTitle(const std::string &title) {
@@ -389,7 +435,7 @@ namespace Infinity {
   }
 
   void Application::CapFPS(double &last_frame_time) const {
-    int fps;
+    unsigned int fps = m_fps_cap;
     if (m_reduce_fps_on_idle) {
       if (glfwGetWindowAttrib(m_window, GLFW_FOCUSED)) {
         fps = m_fps_cap;
@@ -412,11 +458,12 @@ namespace Infinity {
       std::this_thread::yield();
     }
 
-    last_frame_time = target_time;
+    // a frame that ran long, or a wait for input, must not make the following frames race to catch up
+    last_frame_time = std::max(target_time, current_time);
   }
 
 
-  void Application::ProcessImageQueue() {
+  bool Application::ProcessImageQueue() {
     std::vector<std::shared_ptr<Image>> toProcess;
 
     {
@@ -424,9 +471,12 @@ namespace Infinity {
       toProcess.swap(g_texture_creation_queue);
     }
 
+    PixelUploadRing::GetInstance().Poll();
     for (auto &image: toProcess) {
       image->CreateGLTexture();
+      TextureResidency::GetInstance().Track(image);
     }
+    return !toProcess.empty();
   }
 
 
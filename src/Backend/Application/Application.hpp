@@ -12,6 +12,7 @@
 #include <unordered_map>
 #include <utility>
 
+#include "Backend/AssetPack/AssetPack.hpp"
 #include "Backend/Image/Image.hpp"
 #include "Backend/Layer/Layer.hpp"
 #include "GL/glew.h"
@@ -65,6 +66,8 @@ public:
     template<typename F>
     void QueueEvent(F &&func) {
       m_event_queue.push(func);
+      // wake the main loop in case it is waiting for input
+      glfwPostEmptyEvent();
     }
 
     static void SetWindowTitle(const std::string &title);
@@ -89,16 +92,19 @@ public:
 
 private:
     std::expected<void, Errors::Error> Init();
+    // everything Init needs that does not touch GLFW or GL, run on a worker while the window is created
+    static std::expected<ImFontAtlas *, Errors::Error> PrepareAssets();
     static const char *SetupGLVersion();
     std::expected<void, Errors::Error> Shutdown();
-    static void SetWindowIcon(GLFWwindow *window, const unsigned char *data, int size);
+    static void SetWindowIcon(GLFWwindow *window, const AssetPack::Icon &icon);
 
     void DrawTitleBar(float &out_title_bar_height);
     void DrawMenubar() const;
 
     static void GLFWErrorCallback(int error, const char *description);
 
-    static void ProcessImageQueue();
+    // upload decoded images, returns whether there were any
+    static bool ProcessImageQueue();
 
     void CapFPS(double &last_frame_time) const;
 
@@ -108,13 +114,17 @@ private:
     static Application *s_instance;
     GLFWwindow *m_window;
 
-    std::unordered_map<std::string, ImFont *> m_Fonts;
-
     bool m_running = true;
 
     unsigned int m_fps_cap = 144;
     bool m_reduce_fps_on_idle = true;
 
+    // with reduce fps on idle, once nothing has happened for IDLE_SETTLE_TIME seconds frames are only drawn on input
+    // or every IDLE_FRAME_TIME seconds. The settle time gives ImGui's own hover and fade effects time to finish
+    static constexpr double IDLE_SETTLE_TIME = 1.0;
+    static constexpr double IDLE_FRAME_TIME = 1.0 / 15.0;
+    double m_last_activity_time = 0.0;
+
     float m_time_step = 0.0f;
     float m_frame_time = 0.0f;
     float m_last_frame_time = 0.0f;
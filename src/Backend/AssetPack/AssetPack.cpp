@@ -0,0 +1,146 @@
+#include "AssetPack.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+
+#include "zlib.h"
+
+namespace Infinity {
+  AssetPack &AssetPack::GetInstance() {
+    static AssetPack instance;
+    return instance;
+  }
+
+  uint64_t AssetPack::HashName(const std::string_view name) {
+    // FNV-1a, the same as the catalog uses for its group hashes
+    uint64_t hash = 0xcbf29ce484222325ull;
+    for (const char c: name) hash = (hash ^ static_cast<uint8_t>(c)) * 0x100000001b3ull;
+    return hash;
+  }
+
+  bool AssetPack::Open(const std::filesystem::path &path, const uint32_t stamp) {
+    MappedFile file(path);
+    if (!file || file.Size() < sizeof(Header)) {
+      std::cerr << "Failed to open asset pack: " << path.string() << std::endl;
+      return false;
+    }
+
+    const auto *header = reinterpret_cast<const Header *>(file.Data());
+    if (std::memcmp(header->magic, MAGIC, sizeof(MAGIC)) != 0 || header->version != FORMAT_VERSION ||
+        (file.Size() - sizeof(Header)) / sizeof(Entry) < header->count) {
+      std::cerr << "Asset pack is damaged or from another version: " << path.string() << std::endl;
+      return false;
+    }
+    if (header->stamp != stamp) {
+      std::cerr << "Asset pack was built for another version of the launcher: " << path.string() << std::endl;
+      return false;
+    }
+
+    const std::span entries(reinterpret_cast<const Entry *>(file.Data() + sizeof(Header)), header->count);
+    for (const Entry &entry: entries) {
+      if (entry.offset > file.Size() || entry.stored_size > file.Size() - entry.offset ||
+          entry.stored_size > entry.size) {
+        std::cerr << "Asset pack is damaged: " << path.string() << std::endl;
+        return false;
+      }
+    }
+
+    std::lock_guard lock(m_mutex);
+    m_decompressed.clear();
+    m_entries = entries;
+    m_file = std::move(file);
+    return true;
+  }
+
+  std::span<const uint8_t> AssetPack::Get(const std::string_view name) {
+    const uint64_t hash = HashName(name);
+    const auto entry = std::ranges::lower_bound(m_entries, hash, {}, &Entry::name_hash);
+    if (entry == m_entries.end() || entry->name_hash != hash) {
+      std::cerr << "Asset not found in pack: " << name << std::endl;
+      return {};
+    }
+
+    const uint8_t *stored = m_file.Data() + entry->offset;
+    if (entry->stored_size == entry->size) return {stored, entry->size};
+
+    std::lock_guard lock(m_mutex);
+    if (const auto it = m_decompressed.find(hash); it != m_decompressed.end()) return it->second;
+
+    std::vector<uint8_t> data(entry->size);
+    uLongf size = static_cast<uLongf>(data.size());
+    if (uncompress(data.data(), &size, stored, static_cast<uLong>(entry->stored_size)) != Z_OK || size != data.size()) {
+      std::cerr << "Failed to decompress asset: " << name << std::endl;
+      return {};
+    }
+    return m_decompressed.emplace(hash, std::move(data)).first->second;
+  }
+
+  std::span<const uint8_t> AssetPack::Get(const Icon &icon) {
+    const auto pixels = Get(icon.name);
+    if (pixels.size() != static_cast<size_t>(icon.width) * icon.height * 4) {
+      if (!pixels.empty()) std::cerr << "Icon does not match its descriptor: " << icon.name << std::endl;
+      return {};
+    }
+    return pixels;
+  }
+
+  std::expected<uint32_t, std::string> AssetPack::Build(const std::vector<Asset> &assets,
+                                                        const std::filesystem::path &pack_path) {
+    std::vector<Entry> entries;
+    std::vector<std::vector<uint8_t>> blobs;
+    uint64_t offset = sizeof(Header) + assets.size() * sizeof(Entry);
+    uint64_t stamp = HashName("");
+
+    for (const auto &[name, data]: assets) {
+      // FNV-1a over every name and its uncompressed bytes, continued from one asset to the next
+      for (const char c: name) stamp = (stamp ^ static_cast<uint8_t>(c)) * 0x100000001b3ull;
+      for (const uint8_t byte: data) stamp = (stamp ^ byte) * 0x100000001b3ull;
+
+      // fonts and decoded icons shrink well, anything that does not is stored as it is
+      uLongf compressed_size = compressBound(static_cast<uLong>(data.size()));
+      std::vector<uint8_t> compressed(compressed_size);
+      if (compress2(compressed.data(), &compressed_size, data.data(), static_cast<uLong>(data.size()),
+                    Z_BEST_COMPRESSION) != Z_OK) {
+        return std::unexpected("Failed to compress asset: " + name);
+      }
+      compressed.resize(compressed_size);
+
+      const auto &blob = compressed.size() < data.size() ? blobs.emplace_back(std::move(compressed))
+                                                          : blobs.emplace_back(data);
+      entries.push_back({HashName(name), offset, blob.size(), data.size()});
+      offset += blob.size();
+    }
+
+    // the blobs stay in the order they were given, only the index is sorted for lookups
+    std::ranges::sort(entries, {}, &Entry::name_hash);
+    if (std::ranges::adjacent_find(entries, {}, &Entry::name_hash) != entries.end()) {
+      return std::unexpected("Two assets share a name hash, rename one of them");
+    }
+
+    const auto temp_path = std::filesystem::path(pack_path).concat(".tmp");
+    {
+      std::ofstream out(temp_path, std::ios::binary | std::ios::trunc);
+      if (!out) return std::unexpected("Failed to create asset pack: " + temp_path.string());
+
+      Header header{};
+      std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+      header.version = FORMAT_VERSION;
+      header.count = static_cast<uint32_t>(entries.size());
+      header.stamp = static_cast<uint32_t>(stamp ^ stamp >> 32);
+      out.write(reinterpret_cast<const char *>(&header), sizeof(header));
+      out.write(reinterpret_cast<const char *>(entries.data()),
+                static_cast<std::streamsize>(entries.size() * sizeof(Entry)));
+      for (const auto &blob: blobs) {
+        out.write(reinterpret_cast<const char *>(blob.data()), static_cast<std::streamsize>(blob.size()));
+      }
+      if (!out) return std::unexpected("Failed to write asset pack: " + temp_path.string());
+    }
+
+    std::error_code ec;
+    std::filesystem::rename(temp_path, pack_path, ec);
+    if (ec) return std::unexpected("Failed to replace asset pack: " + ec.message());
+    return static_cast<uint32_t>(stamp ^ stamp >> 32);
+  }
+}  // namespace Infinity
@@ -0,0 +1,107 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <expected>
+#include <filesystem>
+#include <mutex>
+#include <span>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "Util/MappedFile/MappedFile.hpp"
+
+namespace Infinity {
+  /**
+   * The launcher's fonts and images, packed into one file at build time and shipped next to the executable.
+   *
+   * The pack is mapped rather than read, and an asset is only decompressed the first time Get asks for it. Assets that
+   * zlib could not shrink are stored as they are and handed out straight from the mapping.
+   *
+   * Every pack carries a stamp hashed from its contents, which the packer also writes into the generated
+   * Assets/Icons.h as ASSET_PACK_STAMP. Open refuses a pack whose stamp differs, so an executable updated without its
+   * pack (or the other way round) fails at startup instead of reading icons of the wrong size.
+   *
+   * Layout (native endian, written and read on the same platform):
+   *   Header
+   *   Entry[count]  sorted by name hash
+   *   data          each asset at its entry's offset
+   */
+  class AssetPack {
+public:
+    struct Asset {
+      std::string name;
+      std::vector<uint8_t> data;
+    };
+
+    // an image decoded to RGBA8 by the packer, the generated Assets/Icons.h has one for every PNG in the pack
+    struct Icon {
+      std::string_view name;
+      uint32_t width;
+      uint32_t height;
+    };
+
+    static AssetPack &GetInstance();
+
+    AssetPack(const AssetPack &) = delete;
+    AssetPack &operator=(const AssetPack &) = delete;
+
+    /**
+     * Map the pack
+     * @param stamp ASSET_PACK_STAMP of the build
+     * @return false if it is missing, damaged or was not built together with this executable
+     */
+    bool Open(const std::filesystem::path &path, uint32_t stamp);
+
+    /**
+     * The asset's bytes, valid until exit. Safe to call from any thread
+     * @param name path relative to the asset directory the pack was built from, e.g. "Fonts/Roboto-Bold.ttf". Decoded
+     * PNGs are named with a .rgba extension instead
+     * @return empty if the pack has no such asset or it does not decompress
+     */
+    std::span<const uint8_t> Get(std::string_view name);
+
+    // the icon's pixels, width * height * 4 bytes, or empty if they are missing or the wrong size
+    std::span<const uint8_t> Get(const Icon &icon);
+
+    /**
+     * Pack the assets into a new file, used by the AssetPacker build tool
+     * @param assets std::vector<Asset>
+     * @param pack_path output file
+     * @return the pack's stamp
+     */
+    static std::expected<uint32_t, std::string> Build(const std::vector<Asset> &assets,
+                                                      const std::filesystem::path &pack_path);
+
+private:
+    struct Header {
+      char magic[4];
+      uint32_t version;
+      uint32_t count;
+      uint32_t stamp;  // hash of every asset's name and contents
+    };
+
+    struct Entry {
+      uint64_t name_hash;
+      uint64_t offset;
+      uint64_t stored_size;  // smaller than size when zlib compressed
+      uint64_t size;
+    };
+
+    AssetPack() = default;
+
+    static uint64_t HashName(std::string_view name);
+
+    static constexpr char MAGIC[4] = {'I', 'A', 'P', 'K'};
+    static constexpr uint32_t FORMAT_VERSION = 1;
+
+private:
+    MappedFile m_file;
+    std::span<const Entry> m_entries;
+
+    std::mutex m_mutex;
+    std::unordered_map<uint64_t, std::vector<uint8_t>> m_decompressed;  // by name hash, nodes keep the data in place
+  };
+}  // namespace Infinity
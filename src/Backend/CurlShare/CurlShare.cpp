@@ -0,0 +1,43 @@
+#include "CurlShare.hpp"
+
+#include <iostream>
+
+namespace Infinity {
+  CurlShare &CurlShare::GetInstance() {
+    static CurlShare instance;
+    return instance;
+  }
+
+  CurlShare::CurlShare() {
+    curl_global_init(CURL_GLOBAL_DEFAULT);
+
+    m_share = curl_share_init();
+    if (!m_share) {
+      std::cerr << "curl_share_init failed, requests will not share connections" << std::endl;
+      return;
+    }
+    curl_share_setopt(m_share, CURLSHOPT_LOCKFUNC, Lock);
+    curl_share_setopt(m_share, CURLSHOPT_UNLOCKFUNC, Unlock);
+    curl_share_setopt(m_share, CURLSHOPT_USERDATA, this);
+    curl_share_setopt(m_share, CURLSHOPT_SHARE, CURL_LOCK_DATA_DNS);
+    curl_share_setopt(m_share, CURLSHOPT_SHARE, CURL_LOCK_DATA_SSL_SESSION);
+    curl_share_setopt(m_share, CURLSHOPT_SHARE, CURL_LOCK_DATA_CONNECT);
+  }
+
+  CurlShare::~CurlShare() {
+    // refuses while a detached loader still has a handle attached, the process is exiting either way
+    if (m_share) curl_share_cleanup(m_share);
+  }
+
+  void CurlShare::Attach(CURL *curl) const {
+    if (m_share) curl_easy_setopt(curl, CURLOPT_SHARE, m_share);
+  }
+
+  void CurlShare::Lock(CURL *, const curl_lock_data data, curl_lock_access, void *user) {
+    static_cast<CurlShare *>(user)->m_locks[data].lock();
+  }
+
+  void CurlShare::Unlock(CURL *, const curl_lock_data data, void *user) {
+    static_cast<CurlShare *>(user)->m_locks[data].unlock();
+  }
+}  // namespace Infinity
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <array>
+#include <mutex>
+
+#include "curl/curl.h"
+
+namespace Infinity {
+  /**
+   * One libcurl share handle for the launcher's short requests: the catalog, images, project details and the beta
+   * check.
+   *
+   * Easy handles attached to it share resolved addresses, TLS sessions and open connections, so a request to a host
+   * the launcher already talked to skips the DNS lookup and the TCP and TLS handshakes. libcurl locks the shared data
+   * from whichever thread is performing, through one mutex per kind of data.
+   */
+  class CurlShare {
+public:
+    // the first call also runs curl_global_init, make it before any other thread uses curl
+    static CurlShare &GetInstance();
+
+    CurlShare(const CurlShare &) = delete;
+    CurlShare &operator=(const CurlShare &) = delete;
+
+    void Attach(CURL *curl) const;
+
+private:
+    CurlShare();
+    ~CurlShare();
+
+    static void Lock(CURL *curl, curl_lock_data data, curl_lock_access access, void *user);
+    static void Unlock(CURL *curl, curl_lock_data data, void *user);
+
+private:
+    CURLSH *m_share = nullptr;
+    std::array<std::mutex, CURL_LOCK_DATA_LAST> m_locks;
+  };
+}  // namespace Infinity
@@ -0,0 +1,468 @@
+#include "DeltaPatch.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <ranges>
+#include <unordered_map>
+
+#include "Backend/ZipExtractor/InstallManifest.hpp"
+#include "zlib.h"
+
+namespace Infinity {
+  namespace {
+    constexpr auto STAGING_SUFFIX = ".idpt-new";
+    constexpr auto BACKUP_SUFFIX = ".idpt-old";
+
+    struct StagedFile {
+      std::string name;
+      std::filesystem::path staging;
+      std::filesystem::path target;
+      uint64_t size;
+      uint32_t crc;
+    };
+
+    /**
+     * Moves the patched files into place. Every target that gets replaced or removed is first renamed to a backup, so
+     * if any step fails the install can be put back exactly as it was
+     */
+    class SwapTransaction {
+  public:
+      ~SwapTransaction() {
+        if (!m_committed) Rollback();
+      }
+
+      bool Replace(const std::filesystem::path &staging, const std::filesystem::path &target, std::error_code &ec) {
+        if (!Backup(target, ec)) return false;
+        std::filesystem::rename(staging, target, ec);
+        if (ec) return false;
+        m_placed.push_back(target);
+        return true;
+      }
+
+      bool Remove(const std::filesystem::path &target, std::error_code &ec) { return Backup(target, ec); }
+
+      // the swap is final, only the backups are left to clean up
+      void Commit() {
+        m_committed = true;
+        std::error_code ec;
+        for (const auto &[target, backup]: m_backups) std::filesystem::remove(backup, ec);
+      }
+
+  private:
+      bool Backup(const std::filesystem::path &target, std::error_code &ec) {
+        if (!std::filesystem::exists(target, ec)) return !ec;
+        auto backup = target;
+        backup += BACKUP_SUFFIX;
+        std::filesystem::rename(target, backup, ec);
+        if (ec) return false;
+        m_backups.emplace_back(target, backup);
+        return true;
+      }
+
+      void Rollback() {
+        std::error_code ec;
+        for (const auto &target: m_placed | std::views::reverse) std::filesystem::remove(target, ec);
+        for (const auto &[target, backup]: m_backups | std::views::reverse) {
+          std::filesystem::rename(backup, target, ec);
+          if (ec) std::cerr << "Failed to restore " << target.string() << ": " << ec.message() << std::endl;
+        }
+      }
+
+      std::vector<std::filesystem::path> m_placed;
+      std::vector<std::pair<std::filesystem::path, std::filesystem::path>> m_backups;  // <target, backup>
+      bool m_committed = false;
+    };
+
+    void UpdateManifest(const std::filesystem::path &root, const std::vector<StagedFile> &patched,
+                        const std::vector<std::pair<std::string, std::filesystem::path>> &removed) {
+      // installs extracted without a manifest are checked file by file on the next update anyway
+      const auto manifest_path = root / InstallManifest::FILE_NAME;
+      if (std::error_code ec; !std::filesystem::exists(manifest_path, ec)) return;
+
+      auto manifest = InstallManifest::Load(manifest_path);
+      for (const auto &file: patched) {
+        if (const auto record = InstallManifest::StampFile(file.target, file.size, file.crc)) {
+          manifest.insert_or_assign(InstallManifest::Key(file.name), record.value());
+        } else {
+          manifest.erase(InstallManifest::Key(file.name));
+        }
+      }
+      for (const auto &name: removed | std::views::keys) manifest.erase(InstallManifest::Key(name));
+      if (!InstallManifest::Save(manifest_path, manifest)) {
+        std::cerr << "Failed to update manifest " << manifest_path.string() << std::endl;
+      }
+    }
+
+    class PatchReader {
+  public:
+      explicit PatchReader(const std::string &path)
+          : m_file(gzopen(path.c_str(), "rb")) {
+        if (m_file) gzbuffer(m_file, 1024 * 1024);
+      }
+      ~PatchReader() {
+        if (m_file) gzclose(m_file);
+      }
+
+      [[nodiscard]] bool IsOpen() const { return m_file != nullptr; }
+
+      bool Read(void *data, const size_t size) {
+        auto *out = static_cast<uint8_t *>(data);
+        size_t done = 0;
+        while (done < size) {
+          const int read = gzread(m_file, out + done, static_cast<unsigned>(std::min<size_t>(size - done, INT32_MAX)));
+          if (read <= 0) return false;
+          done += static_cast<size_t>(read);
+        }
+        return true;
+      }
+
+      template<typename T>
+      bool ReadValue(T &value) {
+        uint8_t bytes[sizeof(T)];
+        if (!Read(bytes, sizeof(T))) return false;
+        value = 0;
+        for (size_t i = 0; i < sizeof(T); ++i) value |= static_cast<T>(bytes[i]) << (8 * i);
+        return true;
+      }
+
+      bool ReadPath(std::string &path) {
+        uint16_t length;
+        if (!ReadValue(length)) return false;
+        path.resize(length);
+        return Read(path.data(), length);
+      }
+
+      [[nodiscard]] int64_t CompressedOffset() const { return gzoffset(m_file); }
+
+  private:
+      gzFile m_file;
+    };
+
+    class PatchWriter {
+  public:
+      explicit PatchWriter(const std::string &path)
+          : m_file(gzopen(path.c_str(), "wb6")) {
+        if (m_file) gzbuffer(m_file, 1024 * 1024);
+      }
+      ~PatchWriter() { Close(); }
+
+      [[nodiscard]] bool IsOpen() const { return m_file != nullptr; }
+
+      bool Close() {
+        if (!m_file) return m_ok;
+        m_ok = gzclose(m_file) == Z_OK && m_ok;
+        m_file = nullptr;
+        return m_ok;
+      }
+
+      void Write(const void *data, const size_t size) {
+        if (size > 0 && gzwrite(m_file, data, static_cast<unsigned>(size)) != static_cast<int>(size)) m_ok = false;
+      }
+
+      template<typename T>
+      void WriteValue(const T value) {
+        uint8_t bytes[sizeof(T)];
+        for (size_t i = 0; i < sizeof(T); ++i) bytes[i] = static_cast<uint8_t>(value >> (8 * i));
+        Write(bytes, sizeof(T));
+      }
+
+      void WritePath(const std::string &path) {
+        WriteValue(static_cast<uint16_t>(path.size()));
+        Write(path.data(), path.size());
+      }
+
+  private:
+      gzFile m_file;
+      bool m_ok = true;
+    };
+
+    bool IsSafeRelativePath(const std::filesystem::path &relative) {
+      return !relative.empty() && !relative.is_absolute() && !relative.has_root_name() && *relative.begin() != "..";
+    }
+
+    std::map<std::string, std::filesystem::path> ListFiles(const std::filesystem::path &root) {
+      std::map<std::string, std::filesystem::path> files;
+      for (const auto &entry: std::filesystem::recursive_directory_iterator(root)) {
+        if (entry.is_regular_file()) {
+          files.emplace(std::filesystem::relative(entry.path(), root).generic_string(), entry.path());
+        }
+      }
+      return files;
+    }
+
+    std::vector<uint8_t> ReadWholeFile(const std::filesystem::path &path) {
+      std::ifstream input(path, std::ios::binary);
+      std::vector<uint8_t> data(std::filesystem::file_size(path));
+      input.read(reinterpret_cast<char *>(data.data()), static_cast<std::streamsize>(data.size()));
+      return data;
+    }
+  }  // namespace
+
+  bool DeltaPatch::IsPatchFile(const std::string &path) {
+    PatchReader reader(path);
+    char magic[4];
+    return reader.IsOpen() && reader.Read(magic, sizeof(magic)) && std::memcmp(magic, MAGIC, sizeof(MAGIC)) == 0;
+  }
+
+  std::expected<void, std::string> DeltaPatch::Apply(const std::string &patch_path, const std::string &install_path,
+                                                     const std::atomic<bool> *cancelled,
+                                                     std::atomic<float> *progress) {
+    PatchReader reader(patch_path);
+    if (!reader.IsOpen()) return std::unexpected("Failed to open patch: " + patch_path);
+
+    std::error_code ec;
+    const auto patch_size = static_cast<double>(std::filesystem::file_size(patch_path, ec));
+    const std::filesystem::path root(install_path);
+
+    std::vector<StagedFile> staged;
+    std::vector<std::pair<std::string, std::filesystem::path>> removed;  // <entry name, target>
+    auto discard = [&](std::string message) -> std::expected<void, std::string> {
+      for (const auto &file: staged) std::filesystem::remove(file.staging, ec);
+      return std::unexpected(std::move(message));
+    };
+
+    char magic[4];
+    uint8_t version;
+    if (!reader.Read(magic, sizeof(magic)) || std::memcmp(magic, MAGIC, sizeof(MAGIC)) != 0 ||
+        !reader.ReadValue(version) || version != FORMAT_VERSION) {
+      return std::unexpected("Not a supported patch file: " + patch_path);
+    }
+
+    std::vector<char> buffer(CHUNK_SIZE);
+    while (true) {
+      if (cancelled && cancelled->load()) return discard("Patch cancelled");
+      if (progress && patch_size > 0) {
+        progress->store(static_cast<float>(static_cast<double>(reader.CompressedOffset()) / patch_size));
+      }
+
+      uint8_t op;
+      if (!reader.ReadValue(op)) return discard("Patch ended unexpectedly");
+      if (op == 'Z') break;
+
+      std::string name;
+      if (!reader.ReadPath(name)) return discard("Patch ended unexpectedly");
+      const auto relative = std::filesystem::path(name).lexically_normal();
+      if (!IsSafeRelativePath(relative)) return discard("Patch entry escapes the install directory: " + name);
+      const auto target = root / relative;
+
+      if (op == 'D') {
+        removed.emplace_back(name, target);
+        continue;
+      }
+      if (op != 'P') return discard("Corrupt patch record");
+
+      uint64_t size;
+      uint32_t expected_crc;
+      uint8_t has_base;
+      if (!reader.ReadValue(size) || !reader.ReadValue(expected_crc) || !reader.ReadValue(has_base)) {
+        return discard("Patch ended unexpectedly");
+      }
+
+      std::ifstream base;
+      if (has_base) {
+        base.open(target, std::ios::binary);
+        if (!base) return discard("Installed file is missing: " + name);
+      }
+
+      auto staging = target;
+      staging += STAGING_SUFFIX;
+      std::filesystem::create_directories(staging.parent_path(), ec);
+      std::ofstream output(staging, std::ios::binary | std::ios::trunc);
+      if (!output) return discard("Failed to create " + staging.string());
+      staged.push_back({name, staging, target, size, expected_crc});
+
+      uLong crc = crc32(0L, Z_NULL, 0);
+      uint64_t written = 0;
+      auto emit = [&](const char *data, const size_t length) {
+        output.write(data, static_cast<std::streamsize>(length));
+        crc = crc32(crc, reinterpret_cast<const Bytef *>(data), static_cast<uInt>(length));
+        written += length;
+      };
+
+      for (uint8_t command; reader.ReadValue(command) && command != 'E';) {
+        if (command == 'C') {
+          uint64_t offset, length;
+          if (!has_base || !reader.ReadValue(offset) || !reader.ReadValue(length)) return discard("Corrupt copy");
+          base.clear();
+          base.seekg(static_cast<std::streamoff>(offset));
+          while (length > 0) {
+            const auto chunk = static_cast<size_t>(std::min<uint64_t>(length, buffer.size()));
+            if (!base.read(buffer.data(), static_cast<std::streamsize>(chunk))) {
+              return discard("Installed file does not match the patch: " + name);
+            }
+            emit(buffer.data(), chunk);
+            length -= chunk;
+          }
+        } else if (command == 'I') {
+          uint32_t length;
+          if (!reader.ReadValue(length)) return discard("Corrupt insert");
+          while (length > 0) {
+            const auto chunk = std::min<size_t>(length, buffer.size());
+            if (!reader.Read(buffer.data(), chunk)) return discard("Patch ended unexpectedly");
+            emit(buffer.data(), chunk);
+            length -= static_cast<uint32_t>(chunk);
+          }
+        } else {
+          return discard("Corrupt patch command in " + name);
+        }
+      }
+
+      output.close();
+      if (output.fail()) return discard("Failed to write " + staging.string());
+      if (written != size || static_cast<uint32_t>(crc) != expected_crc) {
+        return discard("Patched file failed verification: " + name);
+      }
+    }
+
+    // everything verified, swap the new files in, undoing the whole swap if any of it fails
+    {
+      SwapTransaction swap;
+      for (const auto &file: staged) {
+        if (!swap.Replace(file.staging, file.target, ec)) {
+          return discard("Failed to replace " + file.target.string() + ": " + ec.message());
+        }
+      }
+      for (const auto &target: removed | std::views::values) {
+        if (!swap.Remove(target, ec)) return discard("Failed to remove " + target.string() + ": " + ec.message());
+      }
+      swap.Commit();
+    }
+
+    UpdateManifest(root, staged, removed);
+    if (progress) progress->store(1.0f);
+    return {};
+  }
+
+  std::vector<DeltaPatch::Command> DeltaPatch::Diff(const std::vector<uint8_t> &old_data,
+                                                    const std::vector<uint8_t> &new_data) {
+    std::vector<Command> commands;
+    auto push_insert = [&](const uint64_t from, const uint64_t to) {
+      if (to > from) commands.push_back({false, from, to - from});
+    };
+
+    if (old_data.size() < BLOCK_SIZE || new_data.size() < BLOCK_SIZE) {
+      push_insert(0, new_data.size());
+      return commands;
+    }
+
+    // polynomial rolling hash over BLOCK_SIZE bytes, arithmetic wraps mod 2^32
+    constexpr uint32_t base = 257;
+    uint32_t base_pow = 1;
+    for (size_t i = 1; i < BLOCK_SIZE; ++i) base_pow *= base;
+    auto hash_block = [&](const uint8_t *data) {
+      uint32_t hash = 0;
+      for (size_t i = 0; i < BLOCK_SIZE; ++i) hash = hash * base + data[i];
+      return hash;
+    };
+
+    std::unordered_map<uint32_t, uint64_t> index;
+    index.reserve(old_data.size() / BLOCK_SIZE);
+    for (uint64_t offset = 0; offset + BLOCK_SIZE <= old_data.size(); offset += BLOCK_SIZE) {
+      index.try_emplace(hash_block(old_data.data() + offset), offset);
+    }
+
+    uint64_t insert_start = 0;
+    uint64_t pos = 0;
+    uint32_t hash = hash_block(new_data.data());
+    while (pos + BLOCK_SIZE <= new_data.size()) {
+      if (const auto it = index.find(hash); it != index.end() &&
+          std::memcmp(old_data.data() + it->second, new_data.data() + pos, BLOCK_SIZE) == 0) {
+        uint64_t old_start = it->second;
+        uint64_t new_start = pos;
+        while (new_start > insert_start && old_start > 0 && old_data[old_start - 1] == new_data[new_start - 1]) {
+          --old_start;
+          --new_start;
+        }
+        uint64_t length = pos - new_start + BLOCK_SIZE;
+        while (new_start + length < new_data.size() && old_start + length < old_data.size() &&
+               old_data[old_start + length] == new_data[new_start + length]) {
+          ++length;
+        }
+
+        push_insert(insert_start, new_start);
+        commands.push_back({true, old_start, length});
+        pos = new_start + length;
+        insert_start = pos;
+        if (pos + BLOCK_SIZE <= new_data.size()) hash = hash_block(new_data.data() + pos);
+        continue;
+      }
+
+      if (pos + BLOCK_SIZE < new_data.size()) {
+        hash = (hash - new_data[pos] * base_pow) * base + new_data[pos + BLOCK_SIZE];
+      }
+      ++pos;
+    }
+    push_insert(insert_start, new_data.size());
+    return commands;
+  }
+
+  std::expected<void, std::string> DeltaPatch::Build(const std::string &old_dir, const std::string &new_dir,
+                                                     const std::string &patch_path) {
+    std::map<std::string, std::filesystem::path> old_files, new_files;
+    try {
+      old_files = ListFiles(old_dir);
+      new_files = ListFiles(new_dir);
+    } catch (const std::filesystem::filesystem_error &e) {
+      return std::unexpected(std::string(e.what()));
+    }
+
+    PatchWriter writer(patch_path);
+    if (!writer.IsOpen()) return std::unexpected("Failed to create patch: " + patch_path);
+    writer.Write(MAGIC, sizeof(MAGIC));
+    writer.WriteValue(FORMAT_VERSION);
+
+    for (const auto &[name, new_path]: new_files) {
+      const auto new_data = ReadWholeFile(new_path);
+      std::vector<uint8_t> old_data;
+      const auto old_it = old_files.find(name);
+      if (old_it != old_files.end()) {
+        old_data = ReadWholeFile(old_it->second);
+        if (old_data == new_data) continue;
+      }
+
+      // crc32 takes a uInt length, so files of 4 GiB and up are summed in pieces
+      uLong crc = crc32(0L, Z_NULL, 0);
+      for (size_t done = 0; done < new_data.size();) {
+        const auto chunk = static_cast<uInt>(std::min<size_t>(new_data.size() - done, UINT32_MAX));
+        crc = crc32(crc, new_data.data() + done, chunk);
+        done += chunk;
+      }
+      writer.WriteValue(static_cast<uint8_t>('P'));
+      writer.WritePath(name);
+      writer.WriteValue(static_cast<uint64_t>(new_data.size()));
+      writer.WriteValue(static_cast<uint32_t>(crc));
+      writer.WriteValue(static_cast<uint8_t>(old_it != old_files.end()));
+
+      for (const auto &command: Diff(old_data, new_data)) {
+        if (command.copy) {
+          writer.WriteValue(static_cast<uint8_t>('C'));
+          writer.WriteValue(command.offset);
+          writer.WriteValue(command.length);
+          continue;
+        }
+        for (uint64_t done = 0; done < command.length;) {
+          const auto chunk = static_cast<uint32_t>(std::min<uint64_t>(command.length - done, CHUNK_SIZE));
+          writer.WriteValue(static_cast<uint8_t>('I'));
+          writer.WriteValue(chunk);
+          writer.Write(new_data.data() + command.offset + done, chunk);
+          done += chunk;
+        }
+      }
+      writer.WriteValue(static_cast<uint8_t>('E'));
+    }
+
+    for (const auto &name: old_files | std::views::keys) {
+      if (!new_files.contains(name)) {
+        writer.WriteValue(static_cast<uint8_t>('D'));
+        writer.WritePath(name);
+      }
+    }
+    writer.WriteValue(static_cast<uint8_t>('Z'));
+
+    if (!writer.Close()) return std::unexpected("Failed to write patch: " + patch_path);
+    return {};
+  }
+}  // namespace Infinity
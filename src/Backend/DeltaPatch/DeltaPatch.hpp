@@ -0,0 +1,66 @@
+#pragma once
+#include <atomic>
+#include <cstdint>
+#include <expected>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+namespace Infinity {
+  /**
+   * Binary delta patches between two versions of an installed package.
+   *
+   * A patch is a single gzip stream of per-file records. Changed files are rebuilt from COPY ranges of the installed
+   * file and INSERT runs carried in the patch, new files are carried whole and removed files are listed by path.
+   * Apply() reads the stream front to back with a fixed buffer, writes every rebuilt file next to the original and
+   * only swaps them in once the whole patch has been verified. The originals are kept as backups until every swap
+   * has succeeded and are put back otherwise, so a failed patch leaves the install untouched. The install manifest,
+   * if there is one, is updated for the patched and removed files.
+   *
+   * Layout (little endian):
+   *   "IDPT" u8 version
+   *   'P' u16 path_length path u64 size u32 crc u8 has_base, then commands until 'E':
+   *       'C' u64 offset u64 length  copy from the installed file
+   *       'I' u32 length bytes       insert bytes from the patch
+   *   'D' u16 path_length path       delete an installed file
+   *   'Z'                            end of patch
+   */
+  class DeltaPatch {
+public:
+    /**
+     * Apply a patch to an installed package
+     * @param patch_path std::string
+     * @param install_path directory the previous version is installed in
+     * @param cancelled optional flag checked between chunks
+     * @param progress optional 0.0f - 1.0f progress through the patch file
+     */
+    static std::expected<void, std::string> Apply(const std::string &patch_path, const std::string &install_path,
+                                                  const std::atomic<bool> *cancelled = nullptr,
+                                                  std::atomic<float> *progress = nullptr);
+
+    /**
+     * Generate a patch that turns the `old_dir` tree into the `new_dir` tree
+     * @param old_dir std::string
+     * @param new_dir std::string
+     * @param patch_path output file
+     */
+    static std::expected<void, std::string> Build(const std::string &old_dir, const std::string &new_dir,
+                                                  const std::string &patch_path);
+
+    static bool IsPatchFile(const std::string &path);
+
+private:
+    struct Command {
+      bool copy;
+      uint64_t offset;  // into the old file for copies, into the new file for inserts
+      uint64_t length;
+    };
+
+    static std::vector<Command> Diff(const std::vector<uint8_t> &old_data, const std::vector<uint8_t> &new_data);
+
+    static constexpr char MAGIC[4] = {'I', 'D', 'P', 'T'};
+    static constexpr uint8_t FORMAT_VERSION = 1;
+    static constexpr size_t BLOCK_SIZE = 32;
+    static constexpr size_t CHUNK_SIZE = 1024 * 1024;
+  };
+}  // namespace Infinity
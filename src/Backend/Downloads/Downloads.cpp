@@ -1,10 +1,68 @@
 
 #include "Downloads.hpp"
 
+#include <curl/curl.h>
+#include <filesystem>
+#include <fstream>
 #include <iostream>
 #include <ranges>
+#include <thread>
 
 namespace Infinity {
+  namespace {
+    struct StreamContext {
+      CURL *curl = nullptr;
+      const Downloads::StreamSink *sink = nullptr;
+      std::shared_ptr<Downloads::StreamControl> control;
+      std::ofstream archive;
+      int64_t resume_offset = 0;
+      int64_t skip_bytes = 0;
+      bool checked_response = false;
+      bool sink_failed = false;
+    };
+
+    size_t StreamWriteCallback(char *ptr, const size_t size, const size_t nmemb, void *userdata) {
+      auto *context = static_cast<StreamContext *>(userdata);
+      const size_t bytes = size * nmemb;
+
+      if (context->control->paused) {
+        std::unique_lock lock(context->control->mutex);
+        context->control->resume_cv.wait(lock,
+                                         [&] { return !context->control->paused || context->control->cancelled; });
+      }
+      if (context->control->cancelled) return 0;
+
+      if (!context->checked_response) {
+        context->checked_response = true;
+        long http_code = 0;
+        curl_easy_getinfo(context->curl, CURLINFO_RESPONSE_CODE, &http_code);
+        if (context->resume_offset > 0 && http_code != 206) {
+          // the server ignored the range request, so the replayed prefix arrives again
+          context->skip_bytes = context->resume_offset;
+        }
+      }
+
+      const char *data = ptr;
+      size_t remaining = bytes;
+      if (context->skip_bytes > 0) {
+        const auto skipped = static_cast<size_t>(std::min<int64_t>(context->skip_bytes, static_cast<int64_t>(bytes)));
+        context->skip_bytes -= static_cast<int64_t>(skipped);
+        data += skipped;
+        remaining -= skipped;
+      }
+      if (remaining == 0) return bytes;
+
+      if (context->archive.is_open()) {
+        context->archive.write(data, static_cast<std::streamsize>(remaining));
+      }
+      if (!(*context->sink)(reinterpret_cast<const uint8_t *>(data), remaining)) {
+        context->sink_failed = true;
+        return 0;
+      }
+      return bytes;
+    }
+  }  // namespace
+
   Downloads *Downloads::m_instance = nullptr;
   std::mutex Downloads::m_downloads_mutex;
 
@@ -29,7 +87,7 @@ namespace Infinity {
     zoe::Zoe::GlobalUnInit();
   }
 
-  int Downloads::StartDownload(const std::string &url, const std::string &local_path) {
+  int Downloads::StartDownload(const std::string &url, const std::string &local_path, CompletionCallback on_complete) {
     std::lock_guard lock(m_mutex);
     int id = m_next_download_id++;
 
@@ -47,20 +105,23 @@ namespace Infinity {
 
     download.future = download.zoe->start(
         zoe::utf8string(url), zoe::utf8string(local_path),
-        [this, id](const zoe::Result result) {
-          std::lock_guard lock(m_mutex);
-          if (const auto it = m_downloads_map.find(id); it != m_downloads_map.end()) {
-            it->second.completed = true;
-            // switch (result) {
-            //     case zoe::Result::CANCELED:
-            //         it->second.error = zoe::Result::CANCELED;
-            // } TODO: something more advanced like this to actually make use of
-            // the errors
-            std::cout << "Download result: " << result << std::endl;
-            if (result != zoe::Result::SUCCESSED) {
-              it->second.error = result;
+        [this, id, on_complete = std::move(on_complete)](const zoe::Result result) {
+          {
+            std::lock_guard lock(m_mutex);
+            if (const auto it = m_downloads_map.find(id); it != m_downloads_map.end()) {
+              it->second.completed = true;
+              // switch (result) {
+              //     case zoe::Result::CANCELED:
+              //         it->second.error = zoe::Result::CANCELED;
+              // } TODO: something more advanced like this to actually make use of
+              // the errors
+              std::cout << "Download result: " << result << std::endl;
+              if (result != zoe::Result::SUCCESSED) {
+                it->second.error = result;
+              }
             }
           }
+          if (on_complete) on_complete(id, result);
         },
         [this, id](const int64_t total, const int64_t downloaded) {
           std::lock_guard lock(m_mutex);
@@ -79,45 +140,208 @@ namespace Infinity {
     return id;
   }
 
+  int Downloads::StartStreamingDownload(const std::string &url, const std::string &archive_path, StreamSink on_data,
+                                        StreamFinish on_finish, CompletionCallback on_complete) {
+    std::lock_guard lock(m_mutex);
+    int id = m_next_download_id++;
+
+    auto &download = m_downloads_map[id];
+    download.id = id;
+    download.url = url;
+    download.local_path = archive_path;
+    download.paused = false;
+    download.completed = false;
+    download.progress = 0.0;
+    download.size = 0;
+    download.error = 0;
+    download.stream = std::make_shared<StreamControl>();
+
+    auto promise = std::make_shared<std::promise<zoe::Result>>();
+    download.future = promise->get_future().share();
+
+    download.worker = std::jthread([this, id, url, archive_path, on_data = std::move(on_data),
+                                    on_finish = std::move(on_finish), on_complete = std::move(on_complete),
+                                    control = download.stream, promise] {
+      const zoe::Result result = RunStreamingTransfer(id, url, archive_path, on_data, on_finish, control);
+      {
+        std::lock_guard lock(m_mutex);
+        if (const auto it = m_downloads_map.find(id); it != m_downloads_map.end()) {
+          it->second.completed = true;
+          it->second.progress = result == zoe::Result::SUCCESSED ? 1.0f : it->second.progress;
+          if (result != zoe::Result::SUCCESSED) {
+            it->second.error = result;
+          }
+        }
+      }
+      promise->set_value(result);
+      if (on_complete) on_complete(id, result);
+    });
+
+    return id;
+  }
+
+  void Downloads::JoinWorker(std::jthread worker) {
+    if (!worker.joinable()) return;
+    // a completion callback may stop its own download, the thread is already on its way out then
+    if (worker.get_id() == std::this_thread::get_id()) {
+      worker.detach();
+      return;
+    }
+    worker.join();
+  }
+
+  zoe::Result Downloads::RunStreamingTransfer(const int id, const std::string &url, const std::string &archive_path,
+                                              const StreamSink &on_data, const StreamFinish &on_finish,
+                                              const std::shared_ptr<StreamControl> &control) {
+    CURL *curl = curl_easy_init();
+    if (!curl) return zoe::Result::UNKNOWN_ERROR;
+
+    StreamContext context;
+    context.curl = curl;
+    context.sink = &on_data;
+    context.control = control;
+
+    if (!archive_path.empty()) {
+      std::error_code ec;
+      if (const auto existing = std::filesystem::file_size(archive_path, ec); !ec && existing > 0) {
+        // replay the partial archive from disk so only the missing tail has to come over the network
+        std::ifstream partial(archive_path, std::ios::binary);
+        std::vector<char> buffer(1024 * 1024);
+        while (partial && !control->cancelled) {
+          partial.read(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+          if (const auto read = partial.gcount();
+              read > 0 && !on_data(reinterpret_cast<const uint8_t *>(buffer.data()), static_cast<size_t>(read))) {
+            curl_easy_cleanup(curl);
+            return zoe::Result::UNKNOWN_ERROR;
+          }
+        }
+        context.resume_offset = static_cast<int64_t>(existing);
+      }
+      context.archive.open(archive_path, std::ios::binary | std::ios::app);
+    }
+
+    auto on_progress = [](void *clientp, const curl_off_t total, const curl_off_t now, curl_off_t, curl_off_t) -> int {
+      auto *progress = static_cast<std::pair<Downloads *, std::pair<int, StreamContext *>> *>(clientp);
+      auto *self = progress->first;
+      const auto *stream = progress->second.second;
+      if (stream->control->cancelled) return 1;
+
+      std::lock_guard lock(self->m_mutex);
+      if (const auto it = self->m_downloads_map.find(progress->second.first); it != self->m_downloads_map.end()) {
+        const int64_t full = total > 0 ? stream->resume_offset + total : 0;
+        it->second.progress =
+            full > 0 ? static_cast<float>(stream->resume_offset + now) / static_cast<float>(full) : 0.0f;
+        it->second.size = full;
+        curl_off_t speed = 0;
+        curl_easy_getinfo(stream->curl, CURLINFO_SPEED_DOWNLOAD_T, &speed);
+        it->second.speed = speed;
+      }
+      return 0;
+    };
+    std::pair<Downloads *, std::pair<int, StreamContext *>> progress_context{this, {id, &context}};
+
+    curl_easy_setopt(curl, CURLOPT_URL, url.c_str());
+    curl_easy_setopt(curl, CURLOPT_FOLLOWLOCATION, 1L);
+    curl_easy_setopt(curl, CURLOPT_FAILONERROR, 1L);
+    curl_easy_setopt(curl, CURLOPT_USERAGENT, "Infinity-MSFS-Client/1.0");
+    curl_easy_setopt(curl, CURLOPT_BUFFERSIZE, 512L * 1024L);
+    curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, StreamWriteCallback);
+    curl_easy_setopt(curl, CURLOPT_WRITEDATA, &context);
+    curl_easy_setopt(curl, CURLOPT_NOPROGRESS, 0L);
+    curl_easy_setopt(curl, CURLOPT_XFERINFOFUNCTION, +on_progress);
+    curl_easy_setopt(curl, CURLOPT_XFERINFODATA, &progress_context);
+    if (context.resume_offset > 0) {
+      curl_easy_setopt(curl, CURLOPT_RESUME_FROM_LARGE, static_cast<curl_off_t>(context.resume_offset));
+    }
+
+    const CURLcode res = curl_easy_perform(curl);
+    curl_easy_cleanup(curl);
+    context.archive.close();
+
+    if (control->cancelled) return zoe::Result::CANCELED;
+    if (res != CURLE_OK || context.sink_failed) {
+      std::cerr << "Streaming download failed: " << curl_easy_strerror(res) << std::endl;
+      return zoe::Result::UNKNOWN_ERROR;
+    }
+    if (on_finish && !on_finish()) return zoe::Result::UNKNOWN_ERROR;
+    return zoe::Result::SUCCESSED;
+  }
+
   void Downloads::PauseDownload(const int id) {
     std::lock_guard lock(m_mutex);
     if (const auto it = m_downloads_map.find(id); it != m_downloads_map.end()) {
-      it->second.zoe->pause();
+      if (it->second.stream) {
+        it->second.stream->paused = true;
+      } else {
+        it->second.zoe->pause();
+      }
+      it->second.paused = true;
     }
   }
 
   void Downloads::ResumeDownload(const int id) {
     std::lock_guard lock(m_mutex);
     if (const auto it = m_downloads_map.find(id); it != m_downloads_map.end()) {
-      it->second.zoe->resume();
+      if (it->second.stream) {
+        it->second.stream->paused = false;
+        it->second.stream->resume_cv.notify_all();
+      } else {
+        it->second.zoe->resume();
+      }
+      it->second.paused = false;
     }
   }
 
   void Downloads::StopDownload(const int id) {
-    std::lock_guard lock(m_mutex);
-    if (const auto it = m_downloads_map.find(id); it != m_downloads_map.end()) {
-      it->second.zoe->stop();
+    std::jthread worker;
+    {
+      std::lock_guard lock(m_mutex);
+      if (const auto it = m_downloads_map.find(id); it != m_downloads_map.end()) {
+        if (it->second.stream) {
+          it->second.stream->cancelled = true;
+          it->second.stream->resume_cv.notify_all();
+          worker = std::move(it->second.worker);
+        } else {
+          it->second.zoe->stop();
+        }
+      }
     }
+    // joined outside the lock, the transfer takes it to report its result
+    JoinWorker(std::move(worker));
   }
 
   void Downloads::PauseAllDownloads() {
     std::lock_guard lock(m_mutex);
     for (const auto &data: std::views::values(m_downloads_map)) {
-      data.zoe->pause();
+      if (data.stream) {
+        data.stream->paused = true;
+      } else {
+        data.zoe->pause();
+      }
     }
   }
 
   void Downloads::ResumeAllDownloads() {
     std::lock_guard lock(m_mutex);
     for (const auto &data: std::views::values(m_downloads_map)) {
-      data.zoe->resume();
+      if (data.stream) {
+        data.stream->paused = false;
+        data.stream->resume_cv.notify_all();
+      } else {
+        data.zoe->resume();
+      }
     }
   }
 
   void Downloads::StopAllDownloads() {
     std::lock_guard lock(m_mutex);
     for (const auto &data: std::views::values(m_downloads_map)) {
-      data.zoe->stop();
+      if (data.stream) {
+        data.stream->cancelled = true;
+        data.stream->resume_cv.notify_all();
+      } else {
+        data.zoe->stop();
+      }
     }
   }
 
@@ -133,16 +357,40 @@ namespace Infinity {
 
   void Downloads::RemoveDownload(const int id) {
     std::shared_ptr<zoe::Zoe> zoe;
+    std::shared_ptr<StreamControl> stream;
+    std::jthread worker;
     {
       std::lock_guard lock(m_mutex);
       const auto it = m_downloads_map.find(id);
       if (it == m_downloads_map.end()) return;
       zoe = it->second.zoe;
+      stream = it->second.stream;
+      worker = std::move(it->second.worker);
       m_downloads_map.erase(it);
     }
-    if (zoe) {
+    if (stream) {
+      stream->cancelled = true;
+      stream->resume_cv.notify_all();
+    } else if (zoe) {
       zoe->stop();
     }
+    JoinWorker(std::move(worker));
+  }
+
+  void Downloads::Shutdown() {
+    // a finishing transfer can start the next queued install, so keep going until no transfer is left running
+    while (true) {
+      StopAllDownloads();
+      std::vector<std::jthread> workers;
+      {
+        std::lock_guard lock(m_mutex);
+        for (auto &data: std::views::values(m_downloads_map)) {
+          if (data.worker.joinable()) workers.push_back(std::move(data.worker));
+        }
+      }
+      if (workers.empty()) break;
+      for (auto &worker: workers) JoinWorker(std::move(worker));
+    }
   }
 
 
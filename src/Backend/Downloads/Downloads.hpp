@@ -1,11 +1,15 @@
 
 #pragma once
 
+#include <atomic>
+#include <condition_variable>
+#include <functional>
 #include <future>
 #include <map>
 #include <memory>
 #include <mutex>
 #include <string>
+#include <thread>
 #include <vector>
 
 #include "zoe/zoe.h"
@@ -14,6 +18,20 @@ namespace Infinity {
 
   class Downloads {
 public:
+    // receives every chunk of a streaming download in order, returning false aborts the transfer
+    using StreamSink = std::function<bool(const uint8_t *data, size_t size)>;
+    // called once the whole body has been received, returning false marks the download as failed
+    using StreamFinish = std::function<bool()>;
+    // fired once per download after its data has been marked completed, outside of the downloads lock
+    using CompletionCallback = std::function<void(int id, zoe::Result result)>;
+
+    struct StreamControl {
+      std::atomic<bool> paused = false;
+      std::atomic<bool> cancelled = false;
+      std::mutex mutex;
+      std::condition_variable resume_cv;
+    };
+
     struct DownloadData {
       int id;
       std::string url;
@@ -26,6 +44,8 @@ public:
       int64_t size;
       std::shared_future<zoe::Result> future;
       std::shared_ptr<zoe::Zoe> zoe;
+      std::shared_ptr<StreamControl> stream;  // set for streaming downloads, which bypass zoe
+      std::jthread worker;  // runs a streaming transfer, joined by StopDownload, RemoveDownload and Shutdown
 
       DownloadData()
           : id(0)
@@ -45,7 +65,19 @@ public:
     };
 
     static Downloads &GetInstance();
-    int StartDownload(const std::string &url, const std::string &local_path);
+    int StartDownload(const std::string &url, const std::string &local_path, CompletionCallback on_complete = {});
+
+    /**
+     * Start a download whose body is handed to `on_data` as it arrives instead of only being written to disk
+     * @param url std::string
+     * @param archive_path optional copy of the received bytes, if it already holds a partial transfer that prefix is
+     * replayed into `on_data` and only the remainder is requested from the server
+     * @param on_data sink for the body
+     * @param on_finish called after the last chunk
+     * @param on_complete called once the download has finished, failed or been cancelled
+     */
+    int StartStreamingDownload(const std::string &url, const std::string &archive_path, StreamSink on_data,
+                               StreamFinish on_finish, CompletionCallback on_complete = {});
     DownloadData *GetDownloadData(int id);
     void PauseDownload(int id);
     void ResumeDownload(int id);
@@ -58,6 +90,9 @@ public:
     void SetMaxSpeed(int64_t speed);
     void SetDiskCacheSize(int64_t size);
 
+    // stop every download and wait for the streaming transfers to finish, call once before exiting
+    void Shutdown();
+
     Downloads(const Downloads &) = delete;
     Downloads &operator=(const Downloads &) = delete;
 
@@ -70,6 +105,11 @@ private:
 
     void Cleanup();
     void Init(int thread_number = 10);
+    static void JoinWorker(std::jthread worker);
+
+    zoe::Result RunStreamingTransfer(int id, const std::string &url, const std::string &archive_path,
+                                     const StreamSink &on_data, const StreamFinish &on_finish,
+                                     const std::shared_ptr<StreamControl> &control);
 
 private:
     std::map<int, DownloadData> m_downloads_map;
@@ -0,0 +1,299 @@
+#include "FontAtlasCache.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+
+#include "Backend/Updater/Updater.hpp"
+#include "Util/MappedFile/MappedFile.hpp"
+
+namespace Infinity {
+  namespace {
+    // lazy fonts only carry a space until they are used, enough for ImGui to set them up
+    constexpr ImWchar LAZY_RANGES[] = {0x0020, 0x0020, 0};
+    constexpr char MAGIC[4] = {'I', 'F', 'N', 'T'};
+
+    struct Header {
+      char magic[4];
+      uint32_t version;
+      uint64_t key;
+      uint32_t width;
+      uint32_t height;
+      uint32_t font_count;
+      ImVec2 white_pixel;
+      ImVec4 lines[IM_DRAWLIST_TEX_LINES_WIDTH_MAX + 1];
+    };
+
+    struct FontHeader {
+      float size;
+      float ascent;
+      float descent;
+      int32_t metrics_total_surface;
+      uint32_t glyph_count;
+    };
+
+    // FNV-1a, the same as the catalog uses for its group hashes
+    struct Hasher {
+      uint64_t hash = 0xcbf29ce484222325ull;
+
+      void Bytes(const void *data, const size_t size) {
+        const auto *bytes = static_cast<const uint8_t *>(data);
+        for (size_t i = 0; i < size; ++i) hash = (hash ^ bytes[i]) * 0x100000001b3ull;
+      }
+
+      template<typename T>
+      void Value(const T &value) {
+        Bytes(&value, sizeof(T));
+      }
+    };
+  }  // namespace
+
+  FontAtlasCache &FontAtlasCache::GetInstance() {
+    static FontAtlasCache instance;
+    return instance;
+  }
+
+  ImFontAtlas *FontAtlasCache::Init(const std::vector<Font> &fonts, const float scale) {
+    m_atlas = std::make_unique<ImFontAtlas>();
+    m_scale = scale;
+    m_sources.clear();
+    m_names.clear();
+
+    m_cache_dir = std::filesystem::path(Updater::GetConfigDir()) / "cache" / "fonts";
+    std::error_code ec;
+    std::filesystem::create_directories(m_cache_dir, ec);
+    if (ec) {
+      std::cerr << "Failed to create font cache " << m_cache_dir << ": " << ec.message() << std::endl;
+      m_cache_dir.clear();
+    }
+
+    // the software cursor is never drawn, its shapes do not need room in the atlas
+    m_atlas->Flags |= ImFontAtlasFlags_NoMouseCursors;
+
+    auto same_source = [](const Font &a, const Font &b) { return a.data == b.data && a.size_pixels == b.size_pixels; };
+    std::unordered_map<const void *, uint64_t> data_hashes;
+    for (const auto &font: fonts) {
+      const auto existing = std::ranges::find_if(fonts, [&](const Font &other) { return same_source(font, other); });
+      if (existing != fonts.begin() + (&font - fonts.data())) {
+        // the same font under another name, shares the ImFont added for the first one
+        m_names[font.name] = m_names.at(existing->name);
+        continue;
+      }
+
+      // a source is only lazy if every name it goes by is
+      const bool lazy = std::ranges::all_of(fonts, [&](const Font &other) {
+        return !same_source(font, other) || other.lazy;
+      });
+
+      auto [hash, inserted] = data_hashes.try_emplace(font.data);
+      if (inserted) {
+        Hasher hasher;
+        hasher.Bytes(font.data, font.size);
+        hash->second = hasher.hash;
+      }
+
+      ImFontConfig config;
+      config.FontDataOwnedByAtlas = false;
+      if (lazy) config.GlyphRanges = LAZY_RANGES;
+      ImFont *added = m_atlas->AddFontFromMemoryTTF(const_cast<unsigned char *>(font.data),
+                                                    static_cast<int>(font.size), font.size_pixels * scale, &config);
+      m_names[font.name] = m_sources.size();
+      m_sources.push_back({added, hash->second, !lazy, false});
+    }
+
+    Bake();
+    return m_atlas.get();
+  }
+
+  void FontAtlasCache::Shutdown() {
+    m_names.clear();
+    m_sources.clear();
+    m_atlas.reset();
+  }
+
+  ImFont *FontAtlasCache::Get(const std::string &name) {
+    const auto it = m_names.find(name);
+    if (it == m_names.end()) return nullptr;
+    Source &source = m_sources[it->second];
+    if (!source.baked) source.requested = true;
+    return source.font;
+  }
+
+  bool FontAtlasCache::Update() {
+    bool changed = false;
+    for (size_t i = 0; i < m_sources.size(); ++i) {
+      Source &source = m_sources[i];
+      if (!source.requested) continue;
+      m_atlas->ConfigData[static_cast<int>(i)].GlyphRanges = m_atlas->GetGlyphRangesDefault();
+      source.baked = true;
+      source.requested = false;
+      changed = true;
+    }
+    if (changed) Bake();
+    return changed;
+  }
+
+  void FontAtlasCache::Bake() {
+    const uint64_t key = Key();
+    std::ostringstream name;
+    name << "fonts-" << std::hex << std::setw(16) << std::setfill('0') << key << ".bin";
+    const auto path = m_cache_dir / name.str();
+
+    if (!m_cache_dir.empty() && Load(path, key)) return;
+
+    if (!m_atlas->Build()) {
+      std::cerr << "Failed to build the font atlas" << std::endl;
+      return;
+    }
+    if (!m_cache_dir.empty()) Save(path, key);
+  }
+
+  uint64_t FontAtlasCache::Key() const {
+    Hasher hasher;
+    hasher.Value(FORMAT_VERSION);
+    // the glyph tables are stored as ImGui lays them out, a different version may not read them the same way
+    hasher.Value(IMGUI_VERSION_NUM);
+    hasher.Value(sizeof(ImFontGlyph));
+    hasher.Value(m_atlas->Flags);
+    hasher.Value(m_atlas->TexDesiredWidth);
+    hasher.Value(m_atlas->TexGlyphPadding);
+    hasher.Value(m_scale);
+
+    for (size_t i = 0; i < m_sources.size(); ++i) {
+      const ImFontConfig &config = m_atlas->ConfigData[static_cast<int>(i)];
+      hasher.Value(m_sources[i].data_hash);
+      hasher.Value(config.SizePixels);
+      hasher.Value(config.OversampleH);
+      hasher.Value(config.OversampleV);
+      hasher.Value(config.PixelSnapH);
+      hasher.Value(config.GlyphOffset);
+      hasher.Value(config.GlyphMinAdvanceX);
+      hasher.Value(config.GlyphMaxAdvanceX);
+      hasher.Value(config.RasterizerMultiply);
+      for (const ImWchar *range = config.GlyphRanges ? config.GlyphRanges : m_atlas->GetGlyphRangesDefault(); *range;
+           ++range) {
+        hasher.Value(*range);
+      }
+    }
+    return hasher.hash;
+  }
+
+  bool FontAtlasCache::Load(const std::filesystem::path &path, const uint64_t key) {
+    const MappedFile file(path);
+    if (!file) return false;
+
+    size_t offset = 0;
+    auto read = [&](void *out, const size_t size) {
+      if (file.Size() - offset < size) return false;
+      std::memcpy(out, file.Data() + offset, size);
+      offset += size;
+      return true;
+    };
+
+    Header header{};
+    if (!read(&header, sizeof(header)) || std::memcmp(header.magic, MAGIC, sizeof(MAGIC)) != 0 ||
+        header.version != FORMAT_VERSION || header.key != key || header.font_count != m_sources.size() ||
+        header.width == 0 || header.height == 0) {
+      return false;
+    }
+
+    // check the whole file before touching the atlas, a truncated one leaves it as it was
+    std::vector<FontHeader> fonts(header.font_count);
+    std::vector<const uint8_t *> glyphs(header.font_count);
+    for (size_t i = 0; i < fonts.size(); ++i) {
+      if (!read(&fonts[i], sizeof(FontHeader))) return false;
+      const size_t glyph_bytes = static_cast<size_t>(fonts[i].glyph_count) * sizeof(ImFontGlyph);
+      if (file.Size() - offset < glyph_bytes) return false;
+      glyphs[i] = file.Data() + offset;
+      offset += glyph_bytes;
+    }
+    const size_t pixel_count = static_cast<size_t>(header.width) * header.height;
+    if (file.Size() - offset != pixel_count) return false;
+
+    m_atlas->ClearTexData();
+    m_atlas->TexWidth = static_cast<int>(header.width);
+    m_atlas->TexHeight = static_cast<int>(header.height);
+    m_atlas->TexUvScale = ImVec2(1.0f / static_cast<float>(header.width), 1.0f / static_cast<float>(header.height));
+    m_atlas->TexUvWhitePixel = header.white_pixel;
+    std::memcpy(m_atlas->TexUvLines, header.lines, sizeof(header.lines));
+    // the atlas frees its pixels itself, so they are copied out of the mapping rather than pointed at
+    m_atlas->TexPixelsAlpha8 = static_cast<unsigned char *>(IM_ALLOC(pixel_count));
+    std::memcpy(m_atlas->TexPixelsAlpha8, file.Data() + offset, pixel_count);
+
+    for (size_t i = 0; i < fonts.size(); ++i) {
+      ImFont *font = m_atlas->Fonts[static_cast<int>(i)];
+      font->ClearOutputData();
+      font->FontSize = fonts[i].size;
+      font->ConfigData = &m_atlas->ConfigData[static_cast<int>(i)];
+      font->ConfigDataCount = 1;
+      font->ContainerAtlas = m_atlas.get();
+      font->Ascent = fonts[i].ascent;
+      font->Descent = fonts[i].descent;
+      font->MetricsTotalSurface = fonts[i].metrics_total_surface;
+      font->Glyphs.resize(static_cast<int>(fonts[i].glyph_count));
+      if (fonts[i].glyph_count) {
+        std::memcpy(font->Glyphs.Data, glyphs[i], static_cast<size_t>(fonts[i].glyph_count) * sizeof(ImFontGlyph));
+      }
+      font->BuildLookupTable();
+    }
+    m_atlas->TexReady = true;
+    return true;
+  }
+
+  void FontAtlasCache::Save(const std::filesystem::path &path, const uint64_t key) const {
+    // fonts with color glyphs bake to RGBA, which is not worth caching for the fonts the launcher ships
+    if (!m_atlas->TexPixelsAlpha8 || m_atlas->Fonts.Size != static_cast<int>(m_sources.size())) return;
+
+    std::vector<uint8_t> data;
+    auto write = [&data](const void *bytes, const size_t size) {
+      const auto *begin = static_cast<const uint8_t *>(bytes);
+      data.insert(data.end(), begin, begin + size);
+    };
+
+    Header header{};
+    std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+    header.version = FORMAT_VERSION;
+    header.key = key;
+    header.width = static_cast<uint32_t>(m_atlas->TexWidth);
+    header.height = static_cast<uint32_t>(m_atlas->TexHeight);
+    header.font_count = static_cast<uint32_t>(m_atlas->Fonts.Size);
+    header.white_pixel = m_atlas->TexUvWhitePixel;
+    std::memcpy(header.lines, m_atlas->TexUvLines, sizeof(header.lines));
+    write(&header, sizeof(header));
+
+    for (const ImFont *font: m_atlas->Fonts) {
+      const FontHeader font_header{font->FontSize, font->Ascent, font->Descent, font->MetricsTotalSurface,
+                                   static_cast<uint32_t>(font->Glyphs.Size)};
+      write(&font_header, sizeof(font_header));
+      write(font->Glyphs.Data, static_cast<size_t>(font->Glyphs.Size) * sizeof(ImFontGlyph));
+    }
+    write(m_atlas->TexPixelsAlpha8, static_cast<size_t>(m_atlas->TexWidth) * m_atlas->TexHeight);
+
+    // written under a temporary name so a crash never leaves a truncated bake behind
+    const auto temp_path = std::filesystem::path(path).concat(".tmp");
+    {
+      std::ofstream file(temp_path, std::ios::binary | std::ios::trunc);
+      if (!file.write(reinterpret_cast<const char *>(data.data()), static_cast<std::streamsize>(data.size()))) {
+        return;
+      }
+    }
+    std::error_code ec;
+    std::filesystem::rename(temp_path, path, ec);
+    if (ec) {
+      std::filesystem::remove(temp_path, ec);
+      return;
+    }
+
+    // bakes for fonts or ImGui versions that are gone pile up otherwise, keep the most recently written ones
+    std::vector<std::pair<std::filesystem::file_time_type, std::filesystem::path>> bakes;
+    for (const auto &entry: std::filesystem::directory_iterator(m_cache_dir, ec)) {
+      if (entry.path().extension() == ".bin") bakes.emplace_back(entry.last_write_time(ec), entry.path());
+    }
+    if (bakes.size() <= MAX_CACHED_BAKES) return;
+    std::ranges::sort(bakes, std::greater{}, &std::pair<std::filesystem::file_time_type, std::filesystem::path>::first);
+    for (size_t i = MAX_CACHED_BAKES; i < bakes.size(); ++i) std::filesystem::remove(bakes[i].second, ec);
+  }
+}  // namespace Infinity
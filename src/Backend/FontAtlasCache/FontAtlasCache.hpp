@@ -0,0 +1,87 @@
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "imgui.h"
+
+namespace Infinity {
+  /**
+   * The launcher's fonts and the ImGui atlas they are baked into.
+   *
+   * Every bake (alpha texture, glyph tables and metrics) is written to the cache directory under a hash of the ImGui
+   * version, the font data and every setting that changes the result, sizes included. Later starts map that file and
+   * copy it into the atlas instead of rasterizing the fonts again.
+   *
+   * Lazy fonts are registered with the atlas up front, so their ImFont pointer never changes, but they only get
+   * glyphs once Get first asks for them. Update then bakes the atlas again, or loads that combination from the cache,
+   * before the next frame.
+   *
+   * The atlas belongs to the cache rather than to an ImGui context, so Init can bake it on a worker thread while the
+   * window is created and the context is then made to share it. Everything after Init is render thread only.
+   */
+  class FontAtlasCache {
+public:
+    struct Font {
+      std::string name;
+      const unsigned char *data;  // TTF, has to outlive the atlas
+      size_t size;
+      float size_pixels;
+      bool lazy = false;
+    };
+
+    static FontAtlasCache &GetInstance();
+
+    FontAtlasCache(const FontAtlasCache &) = delete;
+    FontAtlasCache &operator=(const FontAtlasCache &) = delete;
+
+    /**
+     * Create the atlas, add the fonts and bake the ones that are not lazy. Needs no ImGui context, fonts with the same
+     * data and size share one ImFont
+     * @param scale multiplies every size
+     * @return the atlas, to be passed to ImGui::CreateContext
+     */
+    ImFontAtlas *Init(const std::vector<Font> &fonts, float scale = 1.0f);
+
+    // free the atlas, after the ImGui context sharing it was destroyed
+    void Shutdown();
+
+    // null for unknown names. A lazy font has no visible glyphs on the frame it is first asked for
+    ImFont *Get(const std::string &name);
+
+    /**
+     * Bake the lazy fonts asked for since the last call, between frames only
+     * @return whether the atlas changed, its texture has to be uploaded again
+     */
+    bool Update();
+
+private:
+    struct Source {
+      ImFont *font;
+      uint64_t data_hash;
+      bool baked;
+      bool requested;  // asked for while not baked yet
+    };
+
+    FontAtlasCache() = default;
+
+    void Bake();
+    [[nodiscard]] uint64_t Key() const;
+    bool Load(const std::filesystem::path &path, uint64_t key);
+    void Save(const std::filesystem::path &path, uint64_t key) const;
+
+    static constexpr uint32_t FORMAT_VERSION = 1;
+    static constexpr size_t MAX_CACHED_BAKES = 8;
+
+private:
+    std::unique_ptr<ImFontAtlas> m_atlas;
+    float m_scale = 1.0f;
+    std::vector<Source> m_sources;  // one per ImFont, in atlas order
+    std::unordered_map<std::string, size_t> m_names;  // name to source
+    std::filesystem::path m_cache_dir;
+  };
+}  // namespace Infinity
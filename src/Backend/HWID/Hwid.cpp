@@ -15,6 +15,13 @@ std::string HWID::GetHWID() {
   return Hash(hwid);
 }
 
+std::shared_future<std::string> HWID::GetShared() {
+  // lspci and WMI take a while, and the answer never changes while the launcher runs
+  static const std::shared_future<std::string> hwid =
+      std::async(std::launch::async, [] { return HWID().GetHWID(); }).share();
+  return hwid;
+}
+
 std::string HWID::GetCPUInfo() {
   std::string cpu_info;
 #if defined(_WIN32)
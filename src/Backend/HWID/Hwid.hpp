@@ -1,6 +1,7 @@
 #pragma once
 
 #include <cstdlib>
+#include <future>
 #include <iomanip>
 #include <iostream>
 #include <sstream>
@@ -39,6 +40,9 @@ class HWID {
 
   std::string GetHWID();
 
+  // worked out once on a worker thread, started by the first call and shared by every caller after it
+  static std::shared_future<std::string> GetShared();
+
   private:
   static std::string GetCPUInfo();
   static std::string GetMotherboardSerial();
@@ -48,6 +52,4 @@ class HWID {
 
   static std::string exec(const char* cmd);  // helper to execute shell commands (Linux only)
 
-
-  // TODO: maybe store hwid in a singleton to avoid repeated system calls
 };
@@ -0,0 +1,145 @@
+#include "AnimatedImage.hpp"
+
+#include <GLFW/glfw3.h>
+#include <algorithm>
+#include <iostream>
+
+#include "webp/decode.h"
+#include "webp/demux.h"
+
+namespace Infinity {
+  namespace {
+    using AnimDecoder = std::unique_ptr<WebPAnimDecoder, decltype(&WebPAnimDecoderDelete)>;
+
+    AnimDecoder CreateDecoder(const std::vector<uint8_t> &data) {
+      WebPAnimDecoderOptions options;
+      if (!WebPAnimDecoderOptionsInit(&options)) return {nullptr, WebPAnimDecoderDelete};
+      options.color_mode = MODE_RGBA;
+      options.use_threads = 0;
+      const WebPData webp{data.data(), data.size()};
+      return {WebPAnimDecoderNew(&webp, &options), WebPAnimDecoderDelete};
+    }
+  }  // namespace
+
+  bool AnimatedImage::IsAnimated(const uint8_t *data, const size_t size) {
+    WebPBitstreamFeatures features;
+    return WebPGetFeatures(data, size, &features) == VP8_STATUS_OK && features.has_animation;
+  }
+
+  std::shared_ptr<AnimatedImage> AnimatedImage::Load(std::vector<uint8_t> data) {
+    WebPAnimInfo info;
+    {
+      const auto decoder = CreateDecoder(data);
+      if (!decoder || !WebPAnimDecoderGetInfo(decoder.get(), &info) || info.frame_count == 0) {
+        std::cerr << "Failed to read animated WebP" << std::endl;
+        return nullptr;
+      }
+    }
+    return std::shared_ptr<AnimatedImage>(
+        new AnimatedImage(std::move(data), info.canvas_width, info.canvas_height, info.loop_count));
+  }
+
+  AnimatedImage::AnimatedImage(std::vector<uint8_t> data, const uint32_t width, const uint32_t height,
+                               const uint32_t loop_count)
+      : m_data(std::move(data))
+      , m_width(width)
+      , m_height(height)
+      , m_loop_count(loop_count)
+      , m_worker([this](const std::stop_token &stop) { Decode(stop); }) {}
+
+  void AnimatedImage::Decode(const std::stop_token &stop) {
+    const auto decoder = CreateDecoder(m_data);
+    if (!decoder) return;
+
+    const size_t frame_size = static_cast<size_t>(m_width) * m_height * 4;
+    size_t write = 0;
+    uint32_t loops = 0;
+    int previous_timestamp = 0;
+
+    while (!stop.stop_requested()) {
+      if (!WebPAnimDecoderHasMoreFrames(decoder.get())) {
+        if (m_loop_count != 0 && ++loops >= m_loop_count) return;  // the last frame stays on screen
+        WebPAnimDecoderReset(decoder.get());
+        previous_timestamp = 0;
+      }
+
+      uint8_t *canvas;
+      int timestamp;
+      if (!WebPAnimDecoderGetNext(decoder.get(), &canvas, &timestamp)) {
+        std::cerr << "Failed to decode animated WebP frame" << std::endl;
+        return;
+      }
+
+      Slot &slot = m_slots[write];
+      {
+        std::unique_lock lock(m_mutex);
+        if (!m_slot_freed.wait(lock, stop, [&slot] { return slot.state == SlotState::Empty; })) return;
+      }
+      // an empty slot is only touched by this thread, so the copy happens outside the lock
+      slot.pixels.assign(canvas, canvas + frame_size);
+      // same as browsers, frames that claim (almost) no duration are shown for 100ms
+      const int duration = timestamp - previous_timestamp;
+      slot.duration_ms = duration <= 10 ? 100 : duration;
+      previous_timestamp = timestamp;
+      {
+        std::scoped_lock lock(m_mutex);
+        slot.state = SlotState::Decoded;
+      }
+      write = (write + 1) % RING_SIZE;
+    }
+  }
+
+  const std::shared_ptr<Image> &AnimatedImage::GetFrame() {
+    const auto now = std::chrono::steady_clock::now();
+    const int frame = ImGui::GetFrameCount();
+    if (frame == m_last_frame) return PeekFrame();
+
+    // a gap in the frames it was drawn means it was offscreen, playback picks up where it left off
+    const bool continuous = frame == m_last_frame + 1;
+    GLFWwindow *window = glfwGetCurrentContext();
+    const bool focused = window && glfwGetWindowAttrib(window, GLFW_FOCUSED);
+    m_last_frame = frame;
+
+    std::scoped_lock lock(m_mutex);
+    for (auto &slot: m_slots) {
+      if (slot.state != SlotState::Decoded) continue;
+      if (slot.texture) {
+        slot.texture->SetData(slot.pixels.data());
+      } else {
+        slot.texture = Image::Create(m_width, m_height, Image::Format::RGBA8, slot.pixels.data());
+      }
+      slot.state = SlotState::Uploaded;
+    }
+
+    if (!m_started) {
+      m_started = m_slots[m_current].state == SlotState::Uploaded;
+      m_elapsed = {};
+    } else if (continuous && focused) {
+      m_elapsed += now - m_last_tick;
+      bool freed = false;
+      while (true) {
+        const auto duration = std::chrono::milliseconds(m_slots[m_current].duration_ms);
+        if (m_elapsed < duration) break;
+        const size_t next = (m_current + 1) % RING_SIZE;
+        if (m_slots[next].state != SlotState::Uploaded) {
+          // the decoder is behind (or the animation ended), hold this frame rather than skipping ahead later
+          m_elapsed = duration;
+          break;
+        }
+        m_elapsed -= duration;
+        m_slots[m_current].state = SlotState::Empty;
+        m_current = next;
+        freed = true;
+      }
+      if (freed) m_slot_freed.notify_all();
+    }
+    m_last_tick = now;
+
+    return PeekFrame();
+  }
+
+  const std::shared_ptr<Image> &AnimatedImage::PeekFrame() const {
+    static const std::shared_ptr<Image> none;
+    return m_started ? m_slots[m_current].texture : none;
+  }
+}  // namespace Infinity
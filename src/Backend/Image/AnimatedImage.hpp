@@ -0,0 +1,90 @@
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <stop_token>
+#include <thread>
+#include <vector>
+
+#include "Image.hpp"
+
+namespace Infinity {
+  /**
+   * An animated WebP that is decoded as it plays.
+   *
+   * A worker thread runs WebPAnimDecoder (which takes care of blending and disposal) and hands composited frames to a
+   * ring of RING_SIZE slots, each with its own texture. The render thread uploads decoded frames and advances
+   * playback by wall clock time, freeing the slot it leaves for the worker to refill. Memory is therefore RING_SIZE
+   * frames no matter how long the animation is.
+   *
+   * Playback only advances while the image is drawn every frame and the window has focus, so an animation that is
+   * offscreen or behind another window is paused, and so is its worker once the ring is full.
+   */
+  class AnimatedImage {
+public:
+    // true if the data is a WebP with more than one frame
+    static bool IsAnimated(const uint8_t *data, size_t size);
+
+    /**
+     * Start decoding an animated WebP
+     * @param data the encoded file, kept for as long as the animation plays
+     * @return nullptr if the data is not an animation libwebp can decode
+     */
+    static std::shared_ptr<AnimatedImage> Load(std::vector<uint8_t> data);
+
+    AnimatedImage(const AnimatedImage &) = delete;
+    AnimatedImage &operator=(const AnimatedImage &) = delete;
+
+    /**
+     * Advance playback and return the frame to draw, render thread only. Call it once per frame for as long as the
+     * image is visible.
+     * @return null until the first frame has been decoded
+     */
+    const std::shared_ptr<Image> &GetFrame();
+
+    // frame shown right now, without advancing playback
+    [[nodiscard]] const std::shared_ptr<Image> &PeekFrame() const;
+
+    [[nodiscard]] uint32_t GetWidth() const { return m_width; }
+    [[nodiscard]] uint32_t GetHeight() const { return m_height; }
+
+    static constexpr size_t RING_SIZE = 3;
+
+private:
+    enum class SlotState { Empty, Decoded, Uploaded };
+
+    struct Slot {
+      std::vector<uint8_t> pixels;  // keeps its capacity between frames
+      std::shared_ptr<Image> texture;
+      int duration_ms = 0;
+      SlotState state = SlotState::Empty;
+    };
+
+    AnimatedImage(std::vector<uint8_t> data, uint32_t width, uint32_t height, uint32_t loop_count);
+
+    void Decode(const std::stop_token &stop);
+
+private:
+    std::vector<uint8_t> m_data;  // WebPAnimDecoder reads from it while decoding
+    uint32_t m_width;
+    uint32_t m_height;
+    uint32_t m_loop_count;  // 0 loops forever
+
+    mutable std::mutex m_mutex;
+    std::condition_variable_any m_slot_freed;
+    std::array<Slot, RING_SIZE> m_slots;
+
+    // render thread only
+    size_t m_current = 0;
+    bool m_started = false;
+    std::chrono::steady_clock::duration m_elapsed{};  // time spent on the current frame
+    std::chrono::steady_clock::time_point m_last_tick;
+    int m_last_frame = -1;  // ImGui frame GetFrame was last called in
+
+    std::jthread m_worker;  // last, so it is stopped before anything it uses is destroyed
+  };
+}  // namespace Infinity
@@ -2,10 +2,20 @@
 
 #include <GLFW/glfw3.h>
 #include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstring>
 #include <curl/curl.h>
 #include <iostream>
+#include <optional>
 
+#include "Backend/CurlShare/CurlShare.hpp"
 #include "Backend/TextureQueue/TextureQueue.hpp"
+#include "PixelBuffer.hpp"
+#include "TextureAtlas.hpp"
+#include "TextureResidency.hpp"
+#include "Util/WorkerPool/WorkerPool.hpp"
 #include "png.h"
 #include "turbojpeg.h"
 #include "webp/decode.h"
@@ -26,9 +36,17 @@ namespace Infinity {
 
   class Image::Impl {
 public:
-    std::vector<uint8_t> pixel_data;
+    PixelBuffer pixel_data;
+    std::vector<uint8_t> encoded_data;  // kept for downloaded images so an evicted texture can be decoded again
     GLuint textureId = 0;
+    std::optional<TextureAtlas::Region> atlas;  // set instead of textureId when the image lives in an atlas page
     void *imguiTextureId = nullptr;
+    DecodeSize decode_size{};  // target the encoded data was decoded for, reloads use it again
+    uint64_t last_used = 0;  // TextureResidency frame
+    std::atomic<bool> reloading = false;
+    // written by a failed reload before it clears `reloading`
+    int reload_failures = 0;
+    std::chrono::steady_clock::time_point reload_retry_at;
 
     ~Impl() { Release(); }
 
@@ -38,10 +56,15 @@ public:
         textureId = 0;
         imguiTextureId = nullptr;
       }
+      if (atlas) {
+        TextureAtlas::GetInstance().Free(*atlas);
+        atlas.reset();
+        imguiTextureId = nullptr;
+      }
     }
   };
 
-  std::unordered_map<ImGuiID, float> Image::s_animation_progress;
+  std::unordered_map<ImGuiID, Tweens::Handle> Image::s_hover_progress;
 
   Image::Image()
       : m_impl(std::make_unique<Impl>()) {}
@@ -78,10 +101,101 @@ public:
       std::cerr << "Error: GLFW context is not set!" << std::endl;
       return;
     }
-    if (m_impl->textureId == 0 && !m_impl->pixel_data.empty()) {
-      AllocateMemory(m_impl->pixel_data.data());
-      m_impl->pixel_data.clear();
+    if (!IsResident() && !m_impl->pixel_data.Empty()) {
+      // the pixels either already sit in a mapped unpack buffer, where the upload reads them from offset 0, or in
+      // client memory
+      const GLuint upload_buffer = m_impl->pixel_data.GetUploadBuffer();
+      const void *pixels = upload_buffer ? nullptr : m_impl->pixel_data.Data();
+      if (upload_buffer) glBindBuffer(GL_PIXEL_UNPACK_BUFFER, upload_buffer);
+
+      // small images share an atlas page so drawing them does not break ImGui's batching
+      if (m_format == Format::RGBA8 && TextureAtlas::Accepts(m_width, m_height)) {
+        m_impl->atlas = TextureAtlas::GetInstance().Insert(m_width, m_height, pixels);
+      }
+      if (m_impl->atlas) {
+        m_impl->imguiTextureId = reinterpret_cast<void *>(static_cast<uintptr_t>(m_impl->atlas->texture));
+      } else {
+        AllocateMemory(pixels);
+      }
+
+      if (upload_buffer) {
+        glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+        PixelUploadRing::GetInstance().Submit(std::move(m_impl->pixel_data));
+      } else {
+        m_impl->pixel_data.Reset();
+      }
     }
+    m_impl->reloading.store(false, std::memory_order_release);
+  }
+
+  bool Image::CanReload() const { return !m_impl->encoded_data.empty(); }
+
+  size_t Image::GetTextureBytes() const {
+    return static_cast<size_t>(m_width) * m_height * GetBytesPerPixel(m_format);
+  }
+
+  uint64_t Image::GetLastUsed() const { return m_impl->last_used; }
+
+  void Image::MarkUsed() const { m_impl->last_used = TextureResidency::GetInstance().GetFrame(); }
+
+  void Image::Evict() const {
+    // an atlased image only frees a corner of a page that stays allocated, evicting it would not save anything
+    if (!CanReload() || IsAtlased() || m_impl->reloading.load(std::memory_order_acquire)) return;
+    Release();
+  }
+
+  void Image::Reload(const std::shared_ptr<Image> &image) {
+    if (!image || !image->CanReload() || image->IsResident()) return;
+    Impl &impl = *image->m_impl;
+    if (impl.reloading.load(std::memory_order_acquire)) return;
+    if (std::chrono::steady_clock::now() < impl.reload_retry_at) return;
+    if (impl.reloading.exchange(true, std::memory_order_acq_rel)) return;
+
+    WorkerPool::GetShared().Push([image] {
+      Impl &impl = *image->m_impl;
+      uint32_t width, height;
+      auto pixels = DecodeImage(impl.encoded_data.data(), impl.encoded_data.size(), width, height, "None",
+                                impl.decode_size);
+      if (pixels.Empty() || width != image->m_width || height != image->m_height) {
+        // the placeholder stays up until the retry delay has passed, doubling with every failure so a texture that
+        // never decodes again is not retried every frame
+        std::cerr << "Failed to reload evicted texture" << std::endl;
+        const auto delay = RELOAD_RETRY_DELAY * (1 << std::min(impl.reload_failures++, 8));
+        impl.reload_retry_at =
+            std::chrono::steady_clock::now() + std::min<std::chrono::milliseconds>(delay, MAX_RELOAD_RETRY_DELAY);
+        impl.reloading.store(false, std::memory_order_release);
+        return;
+      }
+      impl.reload_failures = 0;
+      impl.pixel_data = std::move(pixels);
+      std::lock_guard lock(g_texture_queue_mutex);
+      g_texture_creation_queue.push_back(image);
+    });
+  }
+
+  void Image::RenderPlaceholder(const ImVec2 min, const ImVec2 max) {
+    ImGui::GetWindowDrawList()->AddRectFilled(min, max, IM_COL32(255, 255, 255, 12));
+  }
+
+  void Image::AddImage(ImDrawList *draw_list, const Image &image, ImVec2 p_min, ImVec2 p_max, ImVec2 uv_min,
+                       ImVec2 uv_max, const ImU32 color) {
+    if (image.IsAtlased()) {
+      // clip each axis to the 0 - 1 UV range and shrink the quad by the same fraction
+      auto clip = [](float &p0, float &p1, float &t0, float &t1) {
+        const float range = t1 - t0;
+        if (range == 0.0f) return;
+        const float c0 = std::clamp(t0, 0.0f, 1.0f);
+        const float c1 = std::clamp(t1, 0.0f, 1.0f);
+        const float scale = (p1 - p0) / range;
+        p1 = p0 + (c1 - t0) * scale;
+        p0 = p0 + (c0 - t0) * scale;
+        t0 = c0;
+        t1 = c1;
+      };
+      clip(p_min.x, p_max.x, uv_min.x, uv_max.x);
+      clip(p_min.y, p_max.y, uv_min.y, uv_max.y);
+    }
+    draw_list->AddImage(image.GetImGuiTextureID(), p_min, p_max, image.MapUV(uv_min), image.MapUV(uv_max), color);
   }
 
 
@@ -101,9 +215,9 @@ public:
     }
 
     uint32_t width, height;
-    std::vector<uint8_t> decodedData = DecodeImage(static_cast<const uint8_t *>(data), dataSize, width, height);
+    PixelBuffer decodedData = DecodeImage(static_cast<const uint8_t *>(data), dataSize, width, height);
 
-    if (decodedData.empty()) {
+    if (decodedData.Empty()) {
       return nullptr;
     }
 
@@ -121,6 +235,29 @@ public:
     return image;
   }
 
+  std::shared_ptr<Image> Image::LoadFromPack(const AssetPack::Icon &icon) {
+    const auto pixels = AssetPack::GetInstance().Get(icon);
+    if (pixels.empty()) {
+      return nullptr;
+    }
+
+    PixelBuffer buffer = PixelBuffer::Acquire(pixels.size());
+    std::memcpy(buffer.Data(), pixels.data(), pixels.size());
+
+    auto image = std::make_shared<Image>();
+    image->m_width = icon.width;
+    image->m_height = icon.height;
+    image->m_format = Format::RGBA8;
+
+    image->m_impl->pixel_data = std::move(buffer);
+    {
+      std::lock_guard<std::mutex> lock(g_texture_queue_mutex);
+      g_texture_creation_queue.push_back(image);
+    }
+
+    return image;
+  }
+
   std::shared_ptr<Image> Image::LoadFromURL(const std::string &url) {
     try {
       if (url.contains("discordapp.") && url != Utils::FALLBACK_URL) {
@@ -141,15 +278,16 @@ public:
     }
   }
 
-  std::shared_ptr<Image> Image::LoadFromBinary(const std::vector<uint8_t> &binaryData, const std::string &url_ref) {
+  std::shared_ptr<Image> Image::LoadFromBinary(const std::vector<uint8_t> &binaryData, const std::string &url_ref,
+                                               const DecodeSize decode_size) {
     if (binaryData.empty()) {
       return nullptr;
     }
 
     uint32_t width, height;
-    std::vector<uint8_t> decodedData = DecodeImage(binaryData.data(), binaryData.size(), width, height, url_ref);
+    PixelBuffer decodedData = DecodeImage(binaryData.data(), binaryData.size(), width, height, url_ref, decode_size);
 
-    if (decodedData.empty()) {
+    if (decodedData.Empty()) {
       return nullptr;
     }
 
@@ -159,7 +297,8 @@ public:
     image->m_format = Format::RGBA8;
 
     image->m_impl->pixel_data = std::move(decodedData);
-
+    image->m_impl->encoded_data = binaryData;
+    image->m_impl->decode_size = decode_size;
 
     {
       std::lock_guard lock(g_texture_queue_mutex);
@@ -177,6 +316,7 @@ public:
     }
 
     std::vector<uint8_t> buffer;
+    CurlShare::GetInstance().Attach(curl);
     curl_easy_setopt(curl, CURLOPT_URL, url.c_str());
     curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, Utils::WriteImageCallback);
     curl_easy_setopt(curl, CURLOPT_WRITEDATA, &buffer);
@@ -194,36 +334,107 @@ public:
     return buffer;
   }
 
-  std::vector<uint8_t> Image::DecodeImage(const uint8_t *data, size_t dataSize, uint32_t &outWidth, uint32_t &outHeight,
-                                          const std::string &url_ref) {
+  Image::DecodeSize Image::CoverSize(const uint32_t width, const uint32_t height, const DecodeSize target) {
+    if (width == 0 || height == 0 || (target.width == 0 && target.height == 0)) return {width, height};
+    const double scale =
+        std::max(static_cast<double>(target.width) / width, static_cast<double>(target.height) / height);
+    if (scale >= 1.0) return {width, height};
+    return {std::max(1u, static_cast<uint32_t>(std::ceil(width * scale))),
+            std::max(1u, static_cast<uint32_t>(std::ceil(height * scale)))};
+  }
+
+  PixelBuffer Image::ResampleBox(const uint8_t *pixels, const uint32_t width, const uint32_t height,
+                                 const uint32_t new_width, const uint32_t new_height) {
+    // every destination pixel averages the block of source pixels it covers, only ever used to shrink
+    PixelBuffer result = PixelBuffer::Acquire(static_cast<size_t>(new_width) * new_height * 4);
+    std::vector<uint32_t> column_start(new_width + 1);
+    for (uint32_t x = 0; x <= new_width; ++x) {
+      column_start[x] = static_cast<uint32_t>(static_cast<uint64_t>(x) * width / new_width);
+    }
+
+    for (uint32_t y = 0; y < new_height; ++y) {
+      const uint32_t y0 = static_cast<uint64_t>(y) * height / new_height;
+      const uint32_t y1 = std::max(y0 + 1, static_cast<uint32_t>(static_cast<uint64_t>(y + 1) * height / new_height));
+      uint8_t *out = result.Data() + static_cast<size_t>(y) * new_width * 4;
+
+      for (uint32_t x = 0; x < new_width; ++x) {
+        const uint32_t x0 = column_start[x];
+        const uint32_t x1 = std::max(x0 + 1, column_start[x + 1]);
+        uint32_t sum[4] = {};
+        for (uint32_t sy = y0; sy < y1; ++sy) {
+          const uint8_t *row = pixels + (static_cast<size_t>(sy) * width + x0) * 4;
+          for (uint32_t sx = x0; sx < x1; ++sx, row += 4) {
+            sum[0] += row[0];
+            sum[1] += row[1];
+            sum[2] += row[2];
+            sum[3] += row[3];
+          }
+        }
+        const uint32_t count = (y1 - y0) * (x1 - x0);
+        for (int c = 0; c < 4; ++c) out[x * 4 + c] = static_cast<uint8_t>((sum[c] + count / 2) / count);
+      }
+    }
+    return result;
+  }
+
+  PixelBuffer Image::DecodeImage(const uint8_t *data, size_t dataSize, uint32_t &outWidth, uint32_t &outHeight,
+                                 const std::string &url_ref, const DecodeSize target) {
     auto is_jpeg = [](const uint8_t *d) { return d[0] == 0xFF && d[1] == 0xD8 && d[2] == 0xFF; };
 
     auto is_png = [](const uint8_t *d) { return memcmp(d, "\x89PNG\r\n\x1A\n", 8) == 0; };
 
-    auto decode_jpeg = [&](const uint8_t *d, size_t size) -> std::vector<uint8_t> {
-      tjhandle handle = tjInitDecompress();
+    // Decoders write their output into the final buffer when it already has the target size. Those that can only
+    // produce a fixed set of sizes land somewhere above it instead and decode into scratch memory first, which is
+    // then shrunk into the final buffer.
+    auto output = [&](const uint32_t width, const uint32_t height) {
+      const auto cover = CoverSize(width, height, target);
+      const size_t size = static_cast<size_t>(width) * height * 4;
+      return cover.width == width && cover.height == height ? PixelBuffer::Acquire(size)
+                                                            : PixelBuffer::AcquireScratch(size);
+    };
+    auto fit = [&](PixelBuffer buffer, const uint32_t width, const uint32_t height) {
+      const auto [cover_width, cover_height] = CoverSize(width, height, target);
+      if (cover_width < width || cover_height < height) {
+        buffer = ResampleBox(buffer.Data(), width, height, cover_width, cover_height);
+      }
+      outWidth = cover_width;
+      outHeight = cover_height;
+      return buffer;
+    };
+
+    auto decode_jpeg = [&](const uint8_t *d, size_t size) -> PixelBuffer {
+      // creating a decompressor allocates, so every decoding thread keeps one for its lifetime
+      thread_local const std::unique_ptr<void, int (*)(tjhandle)> handle(tjInitDecompress(), tjDestroy);
       if (!handle) return {};
 
       int width, height, subsamp, colorspace;
-      if (tjDecompressHeader3(handle, d, size, &width, &height, &subsamp, &colorspace) != 0) {
-        tjDestroy(handle);
+      if (tjDecompressHeader3(handle.get(), d, size, &width, &height, &subsamp, &colorspace) != 0) {
         return {};
       }
 
-      std::vector<uint8_t> buffer(width * height * 4);  // RGBA
+      // let the IDCT work at 1/2, 1/4 or 1/8 scale, picking the smallest one that still covers the target
+      const auto cover = CoverSize(width, height, target);
+      int scaled_width = width, scaled_height = height;
+      for (const int denom: {8, 4, 2}) {
+        const tjscalingfactor factor{1, denom};
+        if (TJSCALED(width, factor) >= static_cast<int>(cover.width) &&
+            TJSCALED(height, factor) >= static_cast<int>(cover.height)) {
+          scaled_width = TJSCALED(width, factor);
+          scaled_height = TJSCALED(height, factor);
+          break;
+        }
+      }
 
-      if (tjDecompress2(handle, d, size, buffer.data(), width, 0, height, TJPF_RGBA, TJFLAG_FASTDCT) != 0) {
-        tjDestroy(handle);
+      PixelBuffer buffer = output(scaled_width, scaled_height);  // RGBA
+      if (tjDecompress2(handle.get(), d, size, buffer.Data(), scaled_width, 0, scaled_height, TJPF_RGBA,
+                        TJFLAG_FASTDCT) != 0) {
         return {};
       }
 
-      tjDestroy(handle);
-      outWidth = width;
-      outHeight = height;
-      return buffer;
+      return fit(std::move(buffer), scaled_width, scaled_height);
     };
 
-    auto decode_png = [&](const uint8_t *d, size_t size) -> std::vector<uint8_t> {
+    auto decode_png = [&](const uint8_t *d, size_t size) -> PixelBuffer {
       png_image image{};
       image.version = PNG_IMAGE_VERSION;
 
@@ -232,38 +443,61 @@ public:
       }
 
       image.format = PNG_FORMAT_RGBA;
-      std::vector<uint8_t> buffer(PNG_IMAGE_SIZE(image));
-      if (buffer.empty()) return {};
+      PixelBuffer buffer = output(image.width, image.height);
+      if (buffer.Empty()) {
+        png_image_free(&image);
+        return {};
+      }
 
-      if (!png_image_finish_read(&image, nullptr, buffer.data(), 0, nullptr)) {
+      if (!png_image_finish_read(&image, nullptr, buffer.Data(), 0, nullptr)) {
         return {};
       }
 
-      outWidth = image.width;
-      outHeight = image.height;
+      return fit(std::move(buffer), image.width, image.height);
+    };
+
+    auto decode_webp = [&](const uint8_t *d, size_t size) -> PixelBuffer {
+      WebPDecoderConfig config;
+      if (!WebPInitDecoderConfig(&config) || WebPGetFeatures(d, size, &config.input) != VP8_STATUS_OK) {
+        return {};
+      }
+
+      // libwebp scales while decoding, so the full size image is never materialized
+      const auto [width, height] = CoverSize(config.input.width, config.input.height, target);
+      if (width != static_cast<uint32_t>(config.input.width)) {
+        config.options.use_scaling = 1;
+        config.options.scaled_width = static_cast<int>(width);
+        config.options.scaled_height = static_cast<int>(height);
+      }
+
+      PixelBuffer buffer = PixelBuffer::Acquire(static_cast<size_t>(width) * height * 4);
+      config.output.colorspace = MODE_RGBA;
+      config.output.is_external_memory = 1;
+      config.output.u.RGBA.rgba = buffer.Data();
+      config.output.u.RGBA.stride = static_cast<int>(width * 4);
+      config.output.u.RGBA.size = buffer.Size();
+
+      const VP8StatusCode status = WebPDecode(d, size, &config);
+      WebPFreeDecBuffer(&config.output);
+      if (status != VP8_STATUS_OK) return {};
+
+      outWidth = width;
+      outHeight = height;
       return buffer;
     };
 
     if (dataSize >= 3 && is_jpeg(data)) {
       auto result = decode_jpeg(data, dataSize);
-      if (!result.empty()) return result;
+      if (!result.Empty()) return result;
     }
 
     if (dataSize >= 8 && is_png(data)) {
       auto result = decode_png(data, dataSize);
-      if (!result.empty()) return result;
-    }
-
-    int width = 0, height = 0;
-    if (WebPGetInfo(data, dataSize, &width, &height)) {
-      uint8_t *webpRaw = WebPDecodeRGBA(data, dataSize, &width, &height);
-      if (webpRaw) {
-        outWidth = static_cast<uint32_t>(width);
-        outHeight = static_cast<uint32_t>(height);
-        std::vector<uint8_t> result(webpRaw, webpRaw + (width * height * 4));
-        WebPFree(webpRaw);
-        return result;
-      }
+      if (!result.Empty()) return result;
+    }
+
+    if (auto result = decode_webp(data, dataSize); !result.Empty()) {
+      return result;
     }
 
     std::cerr << "Failed to decode image: unsupported or corrupt format, URL: " << url_ref << std::endl;
@@ -276,7 +510,7 @@ public:
       return;
     }
 
-    if (m_impl->textureId) {
+    if (IsResident()) {
       Release();
     }
 
@@ -314,7 +548,11 @@ public:
   }
 
   void Image::SetData(const void *data) const {
-    if (!data || !m_impl->textureId) return;
+    if (!data || !IsResident()) return;
+    if (m_impl->atlas) {
+      TextureAtlas::Update(*m_impl->atlas, data);
+      return;
+    }
 
     glBindTexture(GL_TEXTURE_2D, m_impl->textureId);
 
@@ -325,7 +563,7 @@ public:
   }
 
   void Image::Resize(const uint32_t width, const uint32_t height) {
-    if (m_impl->textureId && m_width == width && m_height == height) return;
+    if (IsResident() && m_width == width && m_height == height) return;
 
     m_width = width;
     m_height = height;
@@ -336,11 +574,29 @@ public:
 
   void Image::Release() const { m_impl->Release(); }
 
-  uint32_t Image::GetTextureID() const { return m_impl->textureId; }
+  uint32_t Image::GetTextureID() const { return m_impl->atlas ? m_impl->atlas->texture : m_impl->textureId; }
 
   void *Image::GetImGuiTextureID() const { return m_impl->imguiTextureId; }
 
-  float &Image::GetAnimationProgress(const ImGuiID id) { return s_animation_progress[id]; }
+  ImVec2 Image::GetUV0() const { return m_impl->atlas ? m_impl->atlas->uv0 : ImVec2(0.0f, 0.0f); }
+
+  ImVec2 Image::GetUV1() const { return m_impl->atlas ? m_impl->atlas->uv1 : ImVec2(1.0f, 1.0f); }
+
+  ImVec2 Image::MapUV(const ImVec2 uv) const {
+    if (!m_impl->atlas) return uv;
+    const auto &region = *m_impl->atlas;
+    return {region.uv0.x + uv.x * (region.uv1.x - region.uv0.x), region.uv0.y + uv.y * (region.uv1.y - region.uv0.y)};
+  }
+
+  bool Image::IsAtlased() const { return m_impl->atlas.has_value(); }
+
+  float Image::HoverProgress(const Image &image, const bool is_hovered, const float speed) {
+    auto &tweens = Tweens::GetInstance();
+    auto [it, inserted] = s_hover_progress.try_emplace(ImGui::GetID(&image));
+    if (inserted) it->second = tweens.Create(0.0f);
+    tweens.Approach(it->second, is_hovered ? 1.0f : 0.0f, speed);
+    return tweens.Get(it->second);
+  }
 
   uint32_t Image::GetGLFormat(const Format format) {
     switch (format) {
@@ -391,18 +647,33 @@ public:
 
   void Image::RenderImage(const std::unique_ptr<Image> &image, const ImVec2 pos, const float scale) {
     if (!image) return;
-    ImGui::GetWindowDrawList()->AddImage(image->GetImGuiTextureID(), pos,
-                                         {pos.x + image->GetWidth() * scale, pos.y + image->GetHeight() * scale});
+    image->MarkUsed();
+    if (!image->IsResident()) {
+      RenderPlaceholder(pos, {pos.x + image->GetWidth() * scale, pos.y + image->GetHeight() * scale});
+      return;
+    }
+    AddImage(ImGui::GetWindowDrawList(), *image, pos,
+             {pos.x + image->GetWidth() * scale, pos.y + image->GetHeight() * scale}, {0.0f, 0.0f}, {1.0f, 1.0f});
   }
 
   void Image::RenderImage(const std::shared_ptr<Image> &image, const ImVec2 pos, const float scale) {
     if (!image) return;
-    ImGui::GetWindowDrawList()->AddImage(image->GetImGuiTextureID(), pos,
-                                         {pos.x + image->GetWidth() * scale, pos.y + image->GetHeight() * scale});
+    image->MarkUsed();
+    if (!image->IsResident()) {
+      RenderPlaceholder(pos, {pos.x + image->GetWidth() * scale, pos.y + image->GetHeight() * scale});
+      return;
+    }
+    AddImage(ImGui::GetWindowDrawList(), *image, pos,
+             {pos.x + image->GetWidth() * scale, pos.y + image->GetHeight() * scale}, {0.0f, 0.0f}, {1.0f, 1.0f});
   }
 
   void Image::RenderImage(const std::unique_ptr<Image> &image, const ImVec2 pos, const ImVec2 size) {
     if (!image) return;
+    image->MarkUsed();
+    if (!image->IsResident()) {
+      RenderPlaceholder(pos, {pos.x + size.x, pos.y + size.y});
+      return;
+    }
 
     const auto imgWidth = static_cast<float>(image->GetWidth());
     const auto imgHeight = static_cast<float>(image->GetHeight());
@@ -419,14 +690,18 @@ public:
     const float aspect_shown = rescaled_image_size.x / size.x;
     const float uv_x = 1.0f / aspect_shown;
 
-    ImGui::GetWindowDrawList()->AddImage(reinterpret_cast<void *>(static_cast<intptr_t>(image->GetTextureID())), pos,
-                                         {pos.x + size.x, pos.y + size.y}, {0.5f - uv_x / 2.0f, 0.0f},
-                                         {0.5f + uv_x / 2.0f, 1.0f});
+    AddImage(ImGui::GetWindowDrawList(), *image, pos, {pos.x + size.x, pos.y + size.y}, {0.5f - uv_x / 2.0f, 0.0f},
+             {0.5f + uv_x / 2.0f, 1.0f});
   }
 
 
   void Image::RenderImage(const std::shared_ptr<Image> &image, const ImVec2 pos, const ImVec2 size) {
     if (!image) return;
+    image->MarkUsed();
+    if (!image->IsResident()) {
+      RenderPlaceholder(pos, {pos.x + size.x, pos.y + size.y});
+      return;
+    }
 
     const auto imgWidth = static_cast<float>(image->GetWidth());
     const auto imgHeight = static_cast<float>(image->GetHeight());
@@ -443,20 +718,18 @@ public:
     const float aspect_shown = rescaled_image_size.x / size.x;
     const float uv_x = 1.0f / aspect_shown;
 
-    ImGui::GetWindowDrawList()->AddImage(reinterpret_cast<void *>(static_cast<intptr_t>(image->GetTextureID())), pos,
-                                         {pos.x + size.x, pos.y + size.y}, {0.5f - uv_x / 2.0f, 0.0f},
-                                         {0.5f + uv_x / 2.0f, 1.0f});
+    AddImage(ImGui::GetWindowDrawList(), *image, pos, {pos.x + size.x, pos.y + size.y}, {0.5f - uv_x / 2.0f, 0.0f},
+             {0.5f + uv_x / 2.0f, 1.0f});
   }
 
 
   void Image::RenderHomeImage(const std::unique_ptr<Image> &image, const ImVec2 pos, const ImVec2 size,
                               bool is_hovered) {
     if (!image) return;
-
-    ImGuiID id = ImGui::GetID(std::to_string(pos.x + pos.y).c_str());
-
-    if (!s_animation_progress.contains(id)) {
-      s_animation_progress[id] = 0.0f;
+    image->MarkUsed();
+    if (!image->IsResident()) {
+      RenderPlaceholder(pos, {pos.x + size.x, pos.y + size.y});
+      return;
     }
 
     const auto imgWidth = static_cast<float>(image->GetWidth());
@@ -480,19 +753,7 @@ public:
     const float hover_opacity_boost = 0.3f;
     const float zoom_factor = -0.01f;
 
-#ifdef WIN32
-    if (is_hovered) {
-      s_AnimationProgress[id] = min(1.0f, s_AnimationProgress[id] + ImGui::GetIO().DeltaTime * animation_speed);
-    } else {
-      s_AnimationProgress[id] = max(0.0f, s_AnimationProgress[id] - ImGui::GetIO().DeltaTime * animation_speed);
-    }
-#else
-    if (is_hovered) {
-      s_animation_progress[id] = std::min(1.0f, s_animation_progress[id] + ImGui::GetIO().DeltaTime * animation_speed);
-    } else {
-      s_animation_progress[id] = std::max(0.0f, s_animation_progress[id] - ImGui::GetIO().DeltaTime * animation_speed);
-    }
-#endif
+    const float progress = HoverProgress(*image, is_hovered, animation_speed);
 
 
     const int segments = 60;
@@ -500,7 +761,7 @@ public:
     const float segment_height = size.y / segments;
     const float uv_segment_height = 1.0f / segments;
 
-    float zoom_amount = zoom_factor * s_animation_progress[id];
+    float zoom_amount = zoom_factor * progress;
     float uv_x = base_uv_x * (1.0f + zoom_amount);
 
     const float uv_left = 0.5f - uv_x / 2.0f;
@@ -519,7 +780,7 @@ public:
 
       float base_alpha = (float) i / segments;
 
-      float hover_boost = hover_opacity_boost * s_animation_progress[id];
+      float hover_boost = hover_opacity_boost * progress;
 #ifdef WIN32
       float alpha = min(1.0f, base_alpha + hover_boost);
 #else
@@ -527,20 +788,18 @@ public:
 #endif
       ImVec4 tint_color(1.0f, 1.0f, 1.0f, alpha);
 
-      draw_list->AddImage((void *) (intptr_t) image->GetTextureID(), ImVec2(pos.x, y_start),
-                          ImVec2(pos.x + size.x, y_end), ImVec2(uv_left, uv_y_start), ImVec2(uv_right, uv_y_end),
-                          ImGui::ColorConvertFloat4ToU32(tint_color));
+      AddImage(draw_list, *image, ImVec2(pos.x, y_start), ImVec2(pos.x + size.x, y_end), ImVec2(uv_left, uv_y_start),
+               ImVec2(uv_right, uv_y_end), ImGui::ColorConvertFloat4ToU32(tint_color));
     }
   }
 
   void Image::RenderHomeImage(const std::shared_ptr<Image> &image, const ImVec2 pos, const ImVec2 size,
                               bool is_hovered) {
     if (!image) return;
-
-    ImGuiID id = ImGui::GetID(std::to_string(pos.x + pos.y).c_str());
-
-    if (s_animation_progress.find(id) == s_animation_progress.end()) {
-      s_animation_progress[id] = 0.0f;
+    image->MarkUsed();
+    if (!image->IsResident()) {
+      RenderPlaceholder(pos, {pos.x + size.x, pos.y + size.y});
+      return;
     }
 
     const float imgWidth = image->GetWidth();
@@ -564,26 +823,14 @@ public:
     const float hover_opacity_boost = 0.3f;
     const float zoom_factor = -0.01f;
 
-#ifdef WIN32
-    if (is_hovered) {
-      s_AnimationProgress[id] = min(1.0f, s_AnimationProgress[id] + ImGui::GetIO().DeltaTime * animation_speed);
-    } else {
-      s_AnimationProgress[id] = max(0.0f, s_AnimationProgress[id] - ImGui::GetIO().DeltaTime * animation_speed);
-    }
-#else
-    if (is_hovered) {
-      s_animation_progress[id] = std::min(1.0f, s_animation_progress[id] + ImGui::GetIO().DeltaTime * animation_speed);
-    } else {
-      s_animation_progress[id] = std::max(0.0f, s_animation_progress[id] - ImGui::GetIO().DeltaTime * animation_speed);
-    }
-#endif
+    const float progress = HoverProgress(*image, is_hovered, animation_speed);
 
     const int segments = 60;
 
     const float segment_height = size.y / segments;
     const float uv_segment_height = 1.0f / segments;
 
-    float zoom_amount = zoom_factor * s_animation_progress[id];
+    float zoom_amount = zoom_factor * progress;
     float uv_x = base_uv_x * (1.0f + zoom_amount);
 
     const float uv_left = 0.5f - uv_x / 2.0f;
@@ -602,7 +849,7 @@ public:
 
       float base_alpha = (float) i / segments;
 
-      float hover_boost = hover_opacity_boost * s_animation_progress[id];
+      float hover_boost = hover_opacity_boost * progress;
 #ifdef WIN32
       float alpha = min(1.0f, base_alpha + hover_boost);
 #else
@@ -611,14 +858,18 @@ public:
 
       ImVec4 tint_color(1.0f, 1.0f, 1.0f, alpha);
 
-      draw_list->AddImage((void *) (intptr_t) image->GetTextureID(), ImVec2(pos.x, y_start),
-                          ImVec2(pos.x + size.x, y_end), ImVec2(uv_left, uv_y_start), ImVec2(uv_right, uv_y_end),
-                          ImGui::ColorConvertFloat4ToU32(tint_color));
+      AddImage(draw_list, *image, ImVec2(pos.x, y_start), ImVec2(pos.x + size.x, y_end), ImVec2(uv_left, uv_y_start),
+               ImVec2(uv_right, uv_y_end), ImGui::ColorConvertFloat4ToU32(tint_color));
     }
   }
 
   void Image::RenderImage(const std::shared_ptr<Image> &image, ImVec2 pos, ImVec2 size, float opacity) {
     if (!image) return;
+    image->MarkUsed();
+    if (!image->IsResident()) {
+      RenderPlaceholder(pos, {pos.x + size.x, pos.y + size.y});
+      return;
+    }
 
     const float imgWidth = image->GetWidth();
     const float imgHeight = image->GetHeight();
@@ -647,9 +898,8 @@ public:
     ImDrawList *draw_list = ImGui::GetWindowDrawList();
 
     ImVec4 tint_color(1.0f, 1.0f, 1.0f, opacity);
-    draw_list->AddImage((void *) (intptr_t) image->GetTextureID(), ImVec2(pos.x, pos.y),
-                        ImVec2(pos.x + size.x, pos.y + size.y), ImVec2(uvLeft, uvTop), ImVec2(uvRight, uvBottom),
-                        ImGui::ColorConvertFloat4ToU32(tint_color));
+    AddImage(draw_list, *image, ImVec2(pos.x, pos.y), ImVec2(pos.x + size.x, pos.y + size.y), ImVec2(uvLeft, uvTop),
+             ImVec2(uvRight, uvBottom), ImGui::ColorConvertFloat4ToU32(tint_color));
   }
 
 }  // namespace Infinity
@@ -5,11 +5,15 @@
 //
 
 #include <GL/gl.h>
+#include <chrono>
 #include <memory>
 #include <string>
 #include <unordered_map>
 #include <vector>
 
+#include "Backend/AssetPack/AssetPack.hpp"
+#include "PixelBuffer.hpp"
+#include "Util/Tween/Tween.hpp"
 #include "curl/curl.h"
 #include "imgui.h"
 
@@ -21,6 +25,12 @@ namespace Infinity {
 public:
     enum class Format { None, RGBA8, RGBA32F };
 
+    // size an image will be drawn at, 0 on either axis leaves it unconstrained and {0, 0} decodes at full size
+    struct DecodeSize {
+      uint32_t width;
+      uint32_t height;
+    };
+
     Image();
     ~Image();
 
@@ -34,10 +44,13 @@ public:
 
     static std::shared_ptr<Image> LoadFromMemory(const void *data, size_t dataSize);
 
+    // an icon the AssetPacker already decoded, the pixels are only copied into upload memory
+    static std::shared_ptr<Image> LoadFromPack(const AssetPack::Icon &icon);
+
     static std::shared_ptr<Image> LoadFromURL(const std::string &url);
 
     static std::shared_ptr<Image> LoadFromBinary(const std::vector<uint8_t> &binaryData,
-                                                 const std::string &url_ref = "None");
+                                                 const std::string &url_ref = "None", DecodeSize decode_size = {});
 
     static std::vector<uint8_t> FetchFromURL(const std::string &url);
 
@@ -53,8 +66,37 @@ public:
 
     [[nodiscard]] void *GetImGuiTextureID() const;
 
-    static std::vector<uint8_t> DecodeImage(const uint8_t *data, size_t dataSize, uint32_t &outWidth,
-                                            uint32_t &outHeight, const std::string &url_ref = "None");
+    // UV rectangle of the image in its texture, a sub-rectangle for images packed into the TextureAtlas
+    [[nodiscard]] ImVec2 GetUV0() const;
+    [[nodiscard]] ImVec2 GetUV1() const;
+    // map a UV in the 0 - 1 space of the image onto GetUV0() - GetUV1()
+    [[nodiscard]] ImVec2 MapUV(ImVec2 uv) const;
+    [[nodiscard]] bool IsAtlased() const;
+
+    // residency, see TextureResidency
+    [[nodiscard]] bool IsResident() const { return GetTextureID() != 0; }
+    // true for images decoded from downloaded data, which keep the encoded bytes to reload from after eviction
+    [[nodiscard]] bool CanReload() const;
+    [[nodiscard]] size_t GetTextureBytes() const;
+    [[nodiscard]] uint64_t GetLastUsed() const;
+    void MarkUsed() const;
+    void Evict() const;
+    // decode the encoded bytes again on the shared WorkerPool and queue the texture for upload, a failed reload is
+    // retried after RELOAD_RETRY_DELAY, doubling up to MAX_RELOAD_RETRY_DELAY
+    static void Reload(const std::shared_ptr<Image> &image);
+
+    static constexpr std::chrono::milliseconds RELOAD_RETRY_DELAY{500};
+    static constexpr std::chrono::milliseconds MAX_RELOAD_RETRY_DELAY{60000};
+
+    /// <summary>
+    /// Decodes a JPEG, PNG or WebP image to RGBA8. With a target size the result is the smallest size that still
+    /// covers the target while keeping the aspect ratio, images are never scaled up. JPEG and WebP are scaled by the
+    /// decoder itself, anything left over goes through a box filter. The pixels are written straight into mapped upload
+    /// memory when a PixelUploadRing slot is free.
+    /// </summary>
+    /// <param name="target">Size the image will be drawn at, {0, 0} for full resolution</param>
+    static PixelBuffer DecodeImage(const uint8_t *data, size_t dataSize, uint32_t &outWidth, uint32_t &outHeight,
+                                   const std::string &url_ref = "None", DecodeSize target = {});
 
 
     /// <summary>
@@ -81,7 +123,6 @@ public:
     static void RenderHomeImage(const std::unique_ptr<Image> &image, ImVec2 pos, ImVec2 size, bool is_hovered);
     static void RenderHomeImage(const std::shared_ptr<Image> &image, ImVec2 pos, ImVec2 size, bool is_hovered);
 
-    static float &GetAnimationProgress(ImGuiID id);
     void CreateGLTexture();
 
 
@@ -97,13 +138,25 @@ private:
     static uint32_t GetGLInternalFormat(Format format);
     static uint32_t GetGLDataType(Format format);
     static uint32_t GetBytesPerPixel(Format format);
+    static DecodeSize CoverSize(uint32_t width, uint32_t height, DecodeSize target);
+    static PixelBuffer ResampleBox(const uint8_t *pixels, uint32_t width, uint32_t height, uint32_t new_width,
+                                   uint32_t new_height);
+    // drawn where a texture is still loading or was evicted
+    static void RenderPlaceholder(ImVec2 min, ImVec2 max);
+    // AddImage with UVs in the 0 - 1 space of the image. UVs past the edge would sample neighbours in the atlas, so
+    // for atlased images that part of the quad is cut off instead, logos and icons have transparent edges anyway
+    static void AddImage(ImDrawList *draw_list, const Image &image, ImVec2 p_min, ImVec2 p_max, ImVec2 uv_min,
+                         ImVec2 uv_max, ImU32 color = IM_COL32_WHITE);
+    // 0 - 1, moving toward 1 at speed per second while hovered and back to 0 otherwise
+    static float HoverProgress(const Image &image, bool is_hovered, float speed);
 
 
     class Impl;
     std::unique_ptr<Impl> m_impl;
 
 
-    static std::unordered_map<ImGuiID, float> s_animation_progress;
+    // hover animation of each home image, keyed by the image's ImGui id
+    static std::unordered_map<ImGuiID, Tweens::Handle> s_hover_progress;
   };
 
 
@@ -0,0 +1,61 @@
+#include "LazyImage.hpp"
+
+#include <algorithm>
+#include <iostream>
+
+#include "Util/WorkerPool/WorkerPool.hpp"
+
+namespace Infinity {
+  std::atomic<int> LazyImage::s_lookahead = 2;
+
+  const std::shared_ptr<Image> &LazyImage::Get() {
+    if (m_status.load(std::memory_order_acquire) == Status::Ready) {
+      return m_animation ? m_animation->GetFrame() : m_image;
+    }
+    Request();
+    return Peek();
+  }
+
+  const std::shared_ptr<Image> &LazyImage::Peek() const {
+    static const std::shared_ptr<Image> none;
+    if (m_status.load(std::memory_order_acquire) != Status::Ready) return none;
+    return m_animation ? m_animation->PeekFrame() : m_image;
+  }
+
+  void LazyImage::Request() {
+    if (m_url.empty() || m_status.load(std::memory_order_relaxed) != Status::Idle) return;
+    auto expected = Status::Idle;
+    if (!m_status.compare_exchange_strong(expected, Status::Loading, std::memory_order_acq_rel)) return;
+
+    // the task keeps the slot alive even if the snapshot that owned it is dropped meanwhile
+    WorkerPool::GetShared().Push([self = shared_from_this()] { self->Load(); });
+  }
+
+  void LazyImage::Wait() const {
+    m_status.wait(Status::Loading, std::memory_order_acquire);
+  }
+
+  void LazyImage::Load() {
+    std::shared_ptr<Image> image;
+    std::shared_ptr<AnimatedImage> animation;
+    try {
+      auto data = Image::FetchFromURL(m_url);
+      if (AnimatedImage::IsAnimated(data.data(), data.size())) {
+        animation = AnimatedImage::Load(std::move(data));
+      } else {
+        image = Image::LoadFromBinary(data, m_url, m_decode_size);
+      }
+    } catch (const std::exception &e) {
+      std::cerr << "Failed to load image " << m_url << ": " << e.what() << std::endl;
+    }
+
+    m_image = std::move(image);
+    m_animation = std::move(animation);
+    m_status.store(m_image || m_animation ? Status::Ready : Status::Failed, std::memory_order_release);
+    m_status.notify_all();
+  }
+
+  void LazyImage::SetPrefetchLookahead(const int lookahead) {
+    s_lookahead.store(std::clamp(lookahead, 0, 16), std::memory_order_relaxed);
+  }
+}  // namespace Infinity
@@ -0,0 +1,74 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+
+#include "AnimatedImage.hpp"
+#include "Image.hpp"
+
+namespace Infinity {
+  /**
+   * A remote image that is only downloaded once something asks for it.
+   *
+   * Pages call Get() for what they are drawing and Request() for what they expect to draw soon, the first of either
+   * queues a download and decode on the shared WorkerPool, everything after that is an atomic load. Slots are shared
+   * between catalog snapshots for as long as the URL stays the same, so a refresh never reloads an image twice.
+   * Animated WebPs play through AnimatedImage and are drawn like any other image.
+   */
+  class LazyImage : public std::enable_shared_from_this<LazyImage> {
+public:
+    enum class Status : uint8_t { Idle, Loading, Ready, Failed };
+
+    /**
+     * @param url image to download
+     * @param decode_size size the image is drawn at, it is decoded no larger than needed to cover it
+     */
+    explicit LazyImage(std::string url, const Image::DecodeSize decode_size = {})
+        : m_url(std::move(url))
+        , m_decode_size(decode_size) {}
+
+    LazyImage(const LazyImage &) = delete;
+    LazyImage &operator=(const LazyImage &) = delete;
+
+    /**
+     * Image for drawing this frame, starting a load if nothing asked for it yet
+     * @return null until the image has finished loading
+     */
+    const std::shared_ptr<Image> &Get();
+
+    // loaded image or null, never starts a load (debug views)
+    [[nodiscard]] const std::shared_ptr<Image> &Peek() const;
+
+    // start loading without waiting for it, cheap to call every frame
+    void Request();
+
+    // block until a requested load has finished, returns immediately if nothing was requested
+    void Wait() const;
+
+    [[nodiscard]] Status GetStatus() const { return m_status.load(std::memory_order_acquire); }
+    [[nodiscard]] const std::string &GetUrl() const { return m_url; }
+
+    /**
+     * How many images past the one on screen get prefetched, e.g. the projects after the first one when a home card
+     * is hovered, or either side of the selected project on a project page
+     */
+    static void SetPrefetchLookahead(int lookahead);
+    static int GetPrefetchLookahead() { return s_lookahead.load(std::memory_order_relaxed); }
+
+private:
+    void Load();
+
+private:
+    std::string m_url;
+    Image::DecodeSize m_decode_size;
+    // one of these is written once before m_status becomes Ready
+    std::shared_ptr<Image> m_image;
+    std::shared_ptr<AnimatedImage> m_animation;  // animated WebPs, Get() returns whichever frame is current
+    std::atomic<Status> m_status = Status::Idle;
+
+    static std::atomic<int> s_lookahead;
+  };
+}  // namespace Infinity
@@ -0,0 +1,199 @@
+#include "PixelBuffer.hpp"
+
+#include <algorithm>
+#include <iostream>
+#include <utility>
+#include <vector>
+
+namespace Infinity {
+  namespace {
+    // free heap blocks kept for reuse, capped so a burst of large decodes does not pin memory forever
+    class BlockPool {
+  public:
+      static BlockPool &GetInstance() {
+        static BlockPool instance;
+        return instance;
+      }
+
+      std::pair<std::unique_ptr<uint8_t[]>, size_t> Take(const size_t size) {
+        {
+          std::scoped_lock lock(m_mutex);
+          // smallest block that fits, as long as it would not waste more than half of itself
+          auto best = m_blocks.end();
+          for (auto it = m_blocks.begin(); it != m_blocks.end(); ++it) {
+            if (it->second >= size && it->second <= size * 2 && (best == m_blocks.end() || it->second < best->second)) {
+              best = it;
+            }
+          }
+          if (best != m_blocks.end()) {
+            auto block = std::move(*best);
+            m_pooled_bytes -= block.second;
+            m_blocks.erase(best);
+            return block;
+          }
+        }
+        return {std::make_unique_for_overwrite<uint8_t[]>(size), size};
+      }
+
+      void Give(std::unique_ptr<uint8_t[]> block, const size_t capacity) {
+        std::scoped_lock lock(m_mutex);
+        if (m_pooled_bytes + capacity > MAX_POOLED_BYTES) return;
+        m_pooled_bytes += capacity;
+        m_blocks.emplace_back(std::move(block), capacity);
+      }
+
+  private:
+      static constexpr size_t MAX_POOLED_BYTES = 64ull * 1024 * 1024;
+
+      std::mutex m_mutex;
+      std::vector<std::pair<std::unique_ptr<uint8_t[]>, size_t>> m_blocks;
+      size_t m_pooled_bytes = 0;
+    };
+  }  // namespace
+
+  PixelBuffer::PixelBuffer(PixelBuffer &&other) noexcept
+      : m_data(std::exchange(other.m_data, nullptr))
+      , m_size(std::exchange(other.m_size, 0))
+      , m_block(std::move(other.m_block))
+      , m_capacity(std::exchange(other.m_capacity, 0))
+      , m_slot(std::exchange(other.m_slot, -1)) {}
+
+  PixelBuffer &PixelBuffer::operator=(PixelBuffer &&other) noexcept {
+    if (this != &other) {
+      Reset();
+      m_data = std::exchange(other.m_data, nullptr);
+      m_size = std::exchange(other.m_size, 0);
+      m_block = std::move(other.m_block);
+      m_capacity = std::exchange(other.m_capacity, 0);
+      m_slot = std::exchange(other.m_slot, -1);
+    }
+    return *this;
+  }
+
+  PixelBuffer PixelBuffer::Acquire(const size_t size) {
+    PixelBuffer buffer;
+    if (PixelUploadRing::GetInstance().TryAcquire(size, buffer)) return buffer;
+    return AcquireScratch(size);
+  }
+
+  PixelBuffer PixelBuffer::AcquireScratch(const size_t size) {
+    PixelBuffer buffer;
+    if (size == 0) return buffer;
+    auto [block, capacity] = BlockPool::GetInstance().Take(size);
+    buffer.m_data = block.get();
+    buffer.m_size = size;
+    buffer.m_block = std::move(block);
+    buffer.m_capacity = capacity;
+    return buffer;
+  }
+
+  GLuint PixelBuffer::GetUploadBuffer() const {
+    return m_slot >= 0 ? PixelUploadRing::GetInstance().m_slots[m_slot].buffer : 0;
+  }
+
+  void PixelBuffer::Reset() {
+    if (m_slot >= 0) {
+      PixelUploadRing::GetInstance().Release(m_slot);
+    } else if (m_block) {
+      BlockPool::GetInstance().Give(std::move(m_block), m_capacity);
+    }
+    m_data = nullptr;
+    m_size = 0;
+    m_block.reset();
+    m_capacity = 0;
+    m_slot = -1;
+  }
+
+  PixelUploadRing &PixelUploadRing::GetInstance() {
+    static PixelUploadRing instance;
+    return instance;
+  }
+
+  void PixelUploadRing::Init() {
+    if (!GLEW_ARB_buffer_storage) {
+      std::cout << "GL_ARB_buffer_storage is not available, decoded images are staged in pooled memory" << std::endl;
+      return;
+    }
+
+    constexpr GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+    std::scoped_lock lock(m_mutex);
+    for (auto &slot: m_slots) {
+      glGenBuffers(1, &slot.buffer);
+      glBindBuffer(GL_PIXEL_UNPACK_BUFFER, slot.buffer);
+      glBufferStorage(GL_PIXEL_UNPACK_BUFFER, SLOT_SIZE, nullptr, flags);
+      slot.mapped = static_cast<uint8_t *>(glMapBufferRange(GL_PIXEL_UNPACK_BUFFER, 0, SLOT_SIZE, flags));
+      if (!slot.mapped) {
+        std::cerr << "Failed to map pixel upload buffer" << std::endl;
+        glDeleteBuffers(1, &slot.buffer);
+        slot.buffer = 0;
+      }
+    }
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+    m_enabled = std::ranges::any_of(m_slots, [](const Slot &slot) { return slot.mapped != nullptr; });
+  }
+
+  void PixelUploadRing::Shutdown() {
+    std::scoped_lock lock(m_mutex);
+    m_enabled = false;
+    for (auto &slot: m_slots) {
+      if (slot.fence) glDeleteSync(slot.fence);
+      if (slot.buffer) {
+        glBindBuffer(GL_PIXEL_UNPACK_BUFFER, slot.buffer);
+        glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER);
+        glDeleteBuffers(1, &slot.buffer);
+      }
+      slot = {};
+    }
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+  }
+
+  void PixelUploadRing::Poll() {
+    std::scoped_lock lock(m_mutex);
+    for (auto &slot: m_slots) {
+      if (slot.state != SlotState::InFlight) continue;
+      const GLenum status = glClientWaitSync(slot.fence, 0, 0);
+      if (status == GL_ALREADY_SIGNALED || status == GL_CONDITION_SATISFIED) {
+        glDeleteSync(slot.fence);
+        slot.fence = nullptr;
+        slot.state = SlotState::Free;
+      }
+    }
+  }
+
+  void PixelUploadRing::Submit(PixelBuffer &&buffer) {
+    if (buffer.m_slot < 0) {
+      buffer.Reset();
+      return;
+    }
+    {
+      std::scoped_lock lock(m_mutex);
+      auto &slot = m_slots[buffer.m_slot];
+      slot.fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+      slot.state = SlotState::InFlight;
+    }
+    // the slot now belongs to the fence, not the buffer
+    buffer.m_slot = -1;
+    buffer.Reset();
+  }
+
+  bool PixelUploadRing::TryAcquire(const size_t size, PixelBuffer &buffer) {
+    if (size == 0 || size > SLOT_SIZE) return false;
+    std::scoped_lock lock(m_mutex);
+    if (!m_enabled) return false;
+    for (int i = 0; i < static_cast<int>(m_slots.size()); ++i) {
+      auto &slot = m_slots[i];
+      if (slot.state != SlotState::Free || !slot.mapped) continue;
+      slot.state = SlotState::Writing;
+      buffer.m_data = slot.mapped;
+      buffer.m_size = size;
+      buffer.m_slot = i;
+      return true;
+    }
+    return false;
+  }
+
+  void PixelUploadRing::Release(const int slot) {
+    std::scoped_lock lock(m_mutex);
+    if (m_slots[slot].state == SlotState::Writing) m_slots[slot].state = SlotState::Free;
+  }
+}  // namespace Infinity
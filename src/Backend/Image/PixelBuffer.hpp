@@ -0,0 +1,99 @@
+#pragma once
+
+#include "GL/glew.h"
+//
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+
+namespace Infinity {
+  /**
+   * Decoded pixels on their way to a texture.
+   *
+   * The memory either comes from a pool of reusable heap blocks or, for the final pixels of an image, from a slot of
+   * the PixelUploadRing, a persistently mapped pixel unpack buffer. Decoders write into whichever they were given and
+   * the texture upload reads from it, so pixels in a ring slot are never copied on the CPU at all. Move only, the
+   * memory goes back where it came from when the buffer is destroyed.
+   */
+  class PixelBuffer {
+public:
+    PixelBuffer() = default;
+    ~PixelBuffer() { Reset(); }
+
+    PixelBuffer(PixelBuffer &&other) noexcept;
+    PixelBuffer &operator=(PixelBuffer &&other) noexcept;
+    PixelBuffer(const PixelBuffer &) = delete;
+    PixelBuffer &operator=(const PixelBuffer &) = delete;
+
+    // final pixels of an image, mapped upload memory when a ring slot is free and pooled memory otherwise
+    static PixelBuffer Acquire(size_t size);
+    // intermediate pixels that are resampled before upload, always pooled
+    static PixelBuffer AcquireScratch(size_t size);
+
+    [[nodiscard]] uint8_t *Data() const { return m_data; }
+    [[nodiscard]] size_t Size() const { return m_size; }
+    [[nodiscard]] bool Empty() const { return m_size == 0; }
+    // pixel unpack buffer holding the pixels at offset 0, or 0 if they are in ordinary memory
+    [[nodiscard]] GLuint GetUploadBuffer() const;
+
+    void Reset();
+
+private:
+    friend class PixelUploadRing;
+
+    uint8_t *m_data = nullptr;
+    size_t m_size = 0;
+    std::unique_ptr<uint8_t[]> m_block;  // pooled memory
+    size_t m_capacity = 0;
+    int m_slot = -1;  // PixelUploadRing slot
+  };
+
+  /**
+   * A few persistently mapped GL_PIXEL_UNPACK_BUFFERs that decoder threads write into directly.
+   *
+   * Slots are handed out to any thread, the GL side (creation, upload fences, recycling) stays on the render thread. A
+   * slot whose pixels were uploaded is fenced and only reused once the GPU has finished reading it. Needs
+   * GL_ARB_buffer_storage, without it Init() leaves the ring disabled and every buffer comes from the pool.
+   */
+  class PixelUploadRing {
+public:
+    static PixelUploadRing &GetInstance();
+
+    void Init();
+    void Shutdown();
+
+    // recycle slots whose uploads have completed, once per frame before uploading
+    void Poll();
+
+    // call right after the upload reading from `buffer` was issued
+    void Submit(PixelBuffer &&buffer);
+
+    static constexpr size_t SLOT_COUNT = 3;
+    static constexpr size_t SLOT_SIZE = 12ull * 1024 * 1024;  // a 1920x1080 RGBA image with room to spare
+
+private:
+    friend class PixelBuffer;
+
+    enum class SlotState { Free, Writing, InFlight };
+
+    struct Slot {
+      GLuint buffer = 0;
+      uint8_t *mapped = nullptr;
+      GLsync fence = nullptr;
+      SlotState state = SlotState::Free;
+    };
+
+    PixelUploadRing() = default;
+
+    bool TryAcquire(size_t size, PixelBuffer &buffer);
+    void Release(int slot);
+
+private:
+    std::mutex m_mutex;
+    std::array<Slot, SLOT_COUNT> m_slots;
+    bool m_enabled = false;
+  };
+}  // namespace Infinity
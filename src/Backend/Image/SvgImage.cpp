@@ -7,10 +7,13 @@
 #define NANOSVGRAST_IMPLEMENTATION
 #include <GL/glew.h>
 #include <algorithm>
+#include <charconv>
+#include <cmath>
 #include <cstring>
 #include <iostream>
 #include <vector>
 
+#include "SvgRasterCache.hpp"
 #include "nanosvgrast.h"
 //
 #include <GLFW/glfw3.h>
@@ -18,19 +21,15 @@
 namespace Infinity {
   SVGImage::SVGImage() {}
 
-  SVGImage::~SVGImage() {
-    if (m_svg_image) {
-      nsvgDelete(m_svg_image);
-      m_svg_image = nullptr;
-    }
-  }
+  SVGImage::~SVGImage() = default;
 
   SVGImage::SVGImage(SVGImage&& other) noexcept
       : Image(std::move(other))
-      , m_svg_image(other.m_svg_image)
+      , m_svg_image(std::move(other.m_svg_image))
+      , m_color(other.m_color)
       , m_original_width(other.m_original_width)
       , m_original_height(other.m_original_height) {
-    other.m_svg_image = nullptr;
+    other.m_color = 0;
     other.m_original_width = 0.0f;
     other.m_original_height = 0.0f;
   }
@@ -39,21 +38,32 @@ namespace Infinity {
     if (this != &other) {
       Image::operator=(std::move(other));
 
-      if (m_svg_image) {
-        nsvgDelete(m_svg_image);
-      }
-
-      m_svg_image = other.m_svg_image;
+      m_svg_image = std::move(other.m_svg_image);
+      m_color = other.m_color;
       m_original_width = other.m_original_width;
       m_original_height = other.m_original_height;
 
-      other.m_svg_image = nullptr;
+      other.m_color = 0;
       other.m_original_width = 0.0f;
       other.m_original_height = 0.0f;
     }
     return *this;
   }
 
+  std::shared_ptr<SVGImage> SVGImage::FromDocument(NSVGimage* svg_image) {
+    auto image = std::make_shared<SVGImage>();
+    image->m_svg_image = std::shared_ptr<NSVGimage>(svg_image, nsvgDelete);
+    image->m_original_width = svg_image->width;
+    image->m_original_height = svg_image->height;
+
+    // nothing is rasterized up front, RenderSVG rasterizes the sizes it is drawn at on a worker thread
+    image->m_width = static_cast<uint32_t>(svg_image->width);
+    image->m_height = static_cast<uint32_t>(svg_image->height);
+    image->m_format = Format::RGBA8;
+
+    return image;
+  }
+
   std::shared_ptr<SVGImage> SVGImage::LoadFromFile(const std::string& path, float dpi) {
     NSVGimage* svg_image = nsvgParseFromFile(path.c_str(), "px", dpi);
     if (!svg_image) {
@@ -61,14 +71,7 @@ namespace Infinity {
       return nullptr;
     }
 
-    auto image = std::make_shared<SVGImage>();
-    image->m_svg_image = svg_image;
-    image->m_original_width = svg_image->width;
-    image->m_original_height = svg_image->height;
-
-    image->Rasterize(1.0f);
-
-    return image;
+    return FromDocument(svg_image);
   }
 
   std::shared_ptr<SVGImage> SVGImage::LoadFromMemory(const void* data, size_t data_size, float dpi) {
@@ -78,14 +81,7 @@ namespace Infinity {
       return nullptr;
     }
 
-    auto image = std::make_shared<SVGImage>();
-    image->m_svg_image = svg_image;
-    image->m_original_width = svg_image->width;
-    image->m_original_height = svg_image->height;
-
-    image->Rasterize(1.0f);
-
-    return image;
+    return FromDocument(svg_image);
   }
 
   std::shared_ptr<SVGImage> SVGImage::LoadFromURL(const std::string& url, float dpi) {
@@ -169,125 +165,28 @@ namespace Infinity {
     float scale = std::min(scale_x, scale_y);
 #endif
 
-    nsvgRasterize(rast, m_svg_image, 0, 0, scale, pixels.data(), width, height, width * 4);
+    nsvgRasterize(rast, m_svg_image.get(), 0, 0, scale, pixels.data(), width, height, width * 4);
 
     nsvgDeleteRasterizer(rast);
 
-    std::cout << pixels.size() << std::endl;
+    if (m_color) SvgRasterCache::Recolor(pixels, m_color);
+
     return pixels;
   }
 
-  // a really shitty deep copy method (this will leak if it fails)
   std::shared_ptr<SVGImage> SVGImage::Clone() const {
     if (!m_svg_image) {
       return nullptr;
     }
 
     auto clone = std::make_shared<SVGImage>();
-
-    auto cloned_svg = std::unique_ptr<NSVGimage, decltype(&nsvgDelete)>(
-        static_cast<NSVGimage*>(calloc(1, sizeof(NSVGimage))), nsvgDelete);
-
-    if (!cloned_svg) {
-      return nullptr;
-    }
-
-    cloned_svg->width = m_svg_image->width;
-    cloned_svg->height = m_svg_image->height;
-
-    NSVGshape* lastShape = nullptr;
-
-    for (NSVGshape* shape = m_svg_image->shapes; shape != nullptr; shape = shape->next) {
-      struct ShapeDeleter {
-        void operator()(NSVGshape* shape) const {
-          if (!shape) return;
-
-          NSVGpath* path = shape->paths;
-          while (path) {
-            NSVGpath* next = path->next;
-            free(path->pts);
-            free(path);
-            path = next;
-          }
-
-          free(shape);
-        }
-      };
-
-      std::unique_ptr<NSVGshape, ShapeDeleter> newShape(static_cast<NSVGshape*>(calloc(1, sizeof(NSVGshape))),
-                                                        ShapeDeleter());
-
-      if (!newShape) {
-        return nullptr;
-      }
-
-      newShape->id[0] = '\0';
-      if (shape->id[0] != '\0') {
-        strncpy(newShape->id, shape->id, 63);
-        newShape->id[63] = '\0';
-      }
-
-      newShape->fill = shape->fill;
-      newShape->stroke = shape->stroke;
-      newShape->opacity = shape->opacity;
-      newShape->strokeWidth = shape->strokeWidth;
-      newShape->strokeDashOffset = shape->strokeDashOffset;
-      for (int i = 0; i < 8; i++) {
-        newShape->strokeDashArray[i] = shape->strokeDashArray[i];
-      }
-      newShape->strokeDashCount = shape->strokeDashCount;
-      newShape->strokeLineJoin = shape->strokeLineJoin;
-      newShape->strokeLineCap = shape->strokeLineCap;
-      newShape->fillRule = shape->fillRule;
-      newShape->flags = shape->flags;
-
-      NSVGpath* lastPath = nullptr;
-
-      for (NSVGpath* path = shape->paths; path != nullptr; path = path->next) {
-        auto* newPath = static_cast<NSVGpath*>(calloc(1, sizeof(NSVGpath)));
-        if (!newPath) {
-          return nullptr;
-        }
-
-        newPath->closed = path->closed;
-        newPath->npts = path->npts;
-
-        if (path->npts > 0) {
-          newPath->pts = static_cast<float*>(malloc(path->npts * 2 * sizeof(float)));
-          if (!newPath->pts) {
-            free(newPath);
-            return nullptr;
-          }
-          memcpy(newPath->pts, path->pts, path->npts * 2 * sizeof(float));
-        }
-
-        if (lastPath == nullptr) {
-          newShape->paths = newPath;
-        } else {
-          lastPath->next = newPath;
-        }
-        lastPath = newPath;
-      }
-
-      NSVGshape* rawShapePtr = newShape.release();
-
-      if (lastShape == nullptr) {
-        cloned_svg->shapes = rawShapePtr;
-      } else {
-        lastShape->next = rawShapePtr;
-      }
-      lastShape = rawShapePtr;
-    }
-
-    clone->m_svg_image = cloned_svg.release();
-    clone->m_original_width = m_original_height;
+    clone->m_svg_image = m_svg_image;
+    clone->m_color = m_color;
+    clone->m_original_width = m_original_width;
     clone->m_original_height = m_original_height;
-
-    if (m_width > 0 && m_height > 0) {
-      clone->Rasterize(m_width, m_height);
-    } else {
-      clone->Rasterize(1.0f);
-    }
+    clone->m_width = m_width;
+    clone->m_height = m_height;
+    clone->m_format = m_format;
 
     return clone;
   }
@@ -296,65 +195,60 @@ namespace Infinity {
   void SVGImage::RenderSVG(const std::shared_ptr<SVGImage>& svg, ImVec2 pos, float scale) {
     if (!svg) return;
 
-    if (scale != 1.0f) {
-      svg->Rasterize(scale);
-    }
-
-    Image::RenderImage(svg, pos, scale);
+    Draw(svg, pos, {svg->m_original_width * scale, svg->m_original_height * scale}, svg->m_color, 1.0f);
   }
 
   void SVGImage::RenderSVG(const std::shared_ptr<SVGImage>& image, ImVec2 pos, ImVec2 size) {
     if (!image) return;
 
-    float current_aspect = static_cast<float>(image->GetWidth()) / static_cast<float>(image->GetHeight());
-    float requested_aspect = size.x / size.y;
+    Draw(image, pos, size, image->m_color, 1.0f);
+  }
 
-    if (std::abs(current_aspect - requested_aspect) > 0.01f ||
-        std::abs(static_cast<float>(image->GetWidth()) - size.x) > 2.0f ||
-        std::abs(static_cast<float>(image->GetHeight()) - size.y) > 2.0f) {
-      image->Rasterize(static_cast<uint32_t>(size.x), static_cast<uint32_t>(size.y));
-    }
+  void SVGImage::RenderSVG(const std::shared_ptr<SVGImage>& image, ImVec2 pos, ImVec2 size, float opacity) {
+    if (!image) return;
 
-    Image::RenderImage(image, pos, size);
+    Draw(image, pos, size, image->m_color, opacity);
   }
 
+  void SVGImage::RenderSVG(const std::shared_ptr<SVGImage>& image, ImVec2 pos, ImVec2 size, const std::string& color) {
+    if (!image) return;
 
-  void SVGImage::ChangeColor(const std::string& color) {
-    if (m_svg_image) return;
+    const uint32_t parsed = ParseColor(color);
+    Draw(image, pos, size, parsed ? parsed : image->m_color, 1.0f);
+  }
 
-    if (color.empty() || (color[0] != '#' && color.length() != 7)) {
-      std::cerr << "Invalid color format. Expected #RRGGBB\n";
-    }
+  void SVGImage::Draw(const std::shared_ptr<SVGImage>& image, ImVec2 pos, ImVec2 size, uint32_t color,
+                      float opacity) {
+    const auto width = static_cast<uint32_t>(std::lround(std::max(size.x, 0.0f)));
+    const auto height = static_cast<uint32_t>(std::lround(std::max(size.y, 0.0f)));
+    const auto variant = SvgRasterCache::GetInstance().Get(image->m_svg_image, width, height, color);
+    if (!variant) return;
+
+    // the variant is rasterized at the size bucket, which is at most an eighth larger than the size drawn
+    ImVec4 tint_color(1.0f, 1.0f, 1.0f, opacity);
+    ImGui::GetWindowDrawList()->AddImage(variant->GetImGuiTextureID(), pos, ImVec2(pos.x + size.x, pos.y + size.y),
+                                         variant->GetUV0(), variant->GetUV1(),
+                                         ImGui::ColorConvertFloat4ToU32(tint_color));
+  }
 
-    int r, g, b;
-    sscanf(color.c_str(), "%02x%02x%02x", &r, &g, &b);
 
-    for (NSVGshape* shape = m_svg_image->shapes; shape != nullptr; shape = shape->next) {
-      if (shape->fill.type != NSVG_PAINT_NONE) {
-        shape->fill.color = (r << 16) | (g << 8) | b | (255 << 24);
-      }
+  uint32_t SVGImage::ParseColor(const std::string& color) {
+    std::string_view hex = color;
+    if (hex.starts_with('#')) hex.remove_prefix(1);
 
-      if (shape->stroke.type != NSVG_PAINT_NONE) {
-        shape->stroke.color = (r << 16) | (g << 8) | b | (255 << 24);
-      }
+    uint32_t rgb = 0;
+    const auto [end, error] = std::from_chars(hex.data(), hex.data() + hex.size(), rgb, 16);
+    if (hex.size() != 6 || error != std::errc() || end != hex.data() + hex.size()) {
+      std::cerr << "Invalid color format. Expected #RRGGBB\n";
+      return 0;
     }
-    Rasterize(1.0f);
+    return 0xFF000000 | rgb;
   }
 
+  void SVGImage::ChangeColor(const std::string& color) {
+    if (!m_svg_image) return;
 
-  void SVGImage::RenderSVG(const std::shared_ptr<SVGImage>& image, ImVec2 pos, ImVec2 size, float opacity) {
-    if (!image) return;
-
-    float current_aspect = static_cast<float>(image->GetWidth()) / static_cast<float>(image->GetHeight());
-    float requested_aspect = size.x / size.y;
-
-    if (std::abs(current_aspect - requested_aspect) > 0.01f ||
-        std::abs(static_cast<float>(image->GetWidth()) - size.x) > 2.0f ||
-        std::abs(static_cast<float>(image->GetHeight()) - size.y) > 2.0f) {
-      image->Rasterize(static_cast<uint32_t>(size.x), static_cast<uint32_t>(size.y));
-    }
-
-    Image::RenderImage(image, pos, size, opacity);
+    if (const uint32_t parsed = ParseColor(color)) m_color = parsed;
   }
 
 
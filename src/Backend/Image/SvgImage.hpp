@@ -25,6 +25,7 @@ public:
 
     static std::shared_ptr<SVGImage> LoadFromURL(const std::string& url, float dpi = 96.0f);
 
+    // shares the parsed document, which is never modified, so this is cheap
     [[nodiscard]] std::shared_ptr<SVGImage> Clone() const;
 
     bool Rasterize(uint32_t width, uint32_t height);
@@ -34,21 +35,30 @@ public:
     [[nodiscard]] float GetOriginalWidth() const { return m_original_width; }
     [[nodiscard]] float GetOriginalHeight() const { return m_original_height; }
 
+    // drawn from SvgRasterCache, the first draw at a new size shows the nearest cached size until it is rasterized
     static void RenderSVG(const std::shared_ptr<SVGImage>& svg, ImVec2 pos, float scale);
     static void RenderSVG(const std::shared_ptr<SVGImage>& image, ImVec2 pos, ImVec2 size);
     static void RenderSVG(const std::shared_ptr<SVGImage>& image, ImVec2 pos, ImVec2 size, float opacity);
+    // drawn in a single color, without changing the color of the image itself
+    static void RenderSVG(const std::shared_ptr<SVGImage>& image, ImVec2 pos, ImVec2 size, const std::string& color);
 
-    /// @summary Change the color of the SVG image.
+    /// @summary Change the color of the SVG image. Every later RenderSVG draws it in that color, each color is
+    /// rasterized and cached separately.
     /// @param color color in #RRGGBB format
     void ChangeColor(const std::string& color);
 
 
 private:
     static NSVGimage* ParseSVGFromMemory(const void* data, size_t data_size, float dpi);
+    static std::shared_ptr<SVGImage> FromDocument(NSVGimage* svg_image);
+    // 0xFFRRGGBB, or 0 if the color is not #RRGGBB
+    static uint32_t ParseColor(const std::string& color);
+    static void Draw(const std::shared_ptr<SVGImage>& image, ImVec2 pos, ImVec2 size, uint32_t color, float opacity);
 
     std::vector<uint8_t> RasterizeSVG(uint32_t width, uint32_t height) const;
 
-    NSVGimage* m_svg_image = nullptr;
+    std::shared_ptr<NSVGimage> m_svg_image;
+    uint32_t m_color = 0;  // 0 draws the document's own colors
 
     float m_original_width = 0.0f;
     float m_original_height = 0.0f;
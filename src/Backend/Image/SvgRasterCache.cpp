@@ -0,0 +1,172 @@
+#include "SvgRasterCache.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <iostream>
+
+#include "nanosvg.h"
+//
+#include "nanosvgrast.h"
+
+namespace Infinity {
+  SvgRasterCache &SvgRasterCache::GetInstance() {
+    static SvgRasterCache instance;
+    return instance;
+  }
+
+  SvgRasterCache::SvgRasterCache()
+      : m_worker([this](const std::stop_token &stop) { Rasterize(stop); }) {}
+
+  size_t SvgRasterCache::KeyHash::operator()(const Key &key) const {
+    size_t hash = std::hash<const void *>()(key.document);
+    for (const uint32_t value: {key.width, key.height, key.color}) {
+      hash ^= std::hash<uint32_t>()(value) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+    }
+    return hash;
+  }
+
+  uint32_t SvgRasterCache::Bucket(const uint32_t size) {
+    if (size == 0) return 0;
+    const uint32_t step = std::max(4u, std::bit_ceil(size) / 8);
+    return (size + step - 1) / step * step;
+  }
+
+  void SvgRasterCache::Recolor(std::vector<uint8_t> &pixels, const uint32_t color) {
+    // nanosvg's output is not premultiplied, so painting every shape one color only has to replace the color channels
+    // and scale the coverage by the color's alpha
+    const uint8_t r = color >> 16 & 0xFF, g = color >> 8 & 0xFF, b = color & 0xFF, a = color >> 24 & 0xFF;
+    for (size_t i = 0; i + 3 < pixels.size(); i += 4) {
+      pixels[i] = r;
+      pixels[i + 1] = g;
+      pixels[i + 2] = b;
+      pixels[i + 3] = static_cast<uint8_t>((pixels[i + 3] * a + 127) / 255);
+    }
+  }
+
+  std::shared_ptr<Image> SvgRasterCache::Get(const std::shared_ptr<NSVGimage> &document, const uint32_t width,
+                                             const uint32_t height, const uint32_t color) {
+    if (!document || width == 0 || height == 0 || m_shutdown) return nullptr;
+
+    const int frame = ImGui::GetFrameCount();
+    if (frame != m_last_frame) {
+      UploadFinished(frame);
+      Trim(frame);
+      m_last_frame = frame;
+    }
+
+    const Key key{document.get(), Bucket(width), Bucket(height), color};
+    auto [it, inserted] = m_entries.try_emplace(key);
+    Entry &entry = it->second;
+    entry.last_used = frame;
+    if (inserted) {
+      entry.document = document;
+      {
+        std::scoped_lock lock(m_mutex);
+        m_pending.push_back({key, document, {}});
+      }
+      m_job_added.notify_one();
+    }
+    if (entry.texture) return entry.texture;
+
+    // closest in area among the ready variants of this document and color, scaled to fit in the meantime
+    const double wanted = std::log(static_cast<double>(key.width) * key.height);
+    Entry *nearest = nullptr;
+    double nearest_distance = 0.0;
+    for (auto &[other_key, other]: m_entries) {
+      if (!other.texture || other_key.document != key.document || other_key.color != key.color) continue;
+      const double distance = std::abs(std::log(static_cast<double>(other_key.width) * other_key.height) - wanted);
+      if (!nearest || distance < nearest_distance) {
+        nearest = &other;
+        nearest_distance = distance;
+      }
+    }
+    if (!nearest) return nullptr;
+    nearest->last_used = frame;
+    return nearest->texture;
+  }
+
+  void SvgRasterCache::UploadFinished(const int frame) {
+    std::vector<Job> finished;
+    {
+      std::scoped_lock lock(m_mutex);
+      finished.swap(m_finished);
+    }
+    for (auto &job: finished) {
+      const auto it = m_entries.find(job.key);
+      if (it == m_entries.end()) continue;  // dropped while it was rasterizing
+      it->second.texture = Image::Create(job.key.width, job.key.height, Image::Format::RGBA8, job.pixels.data());
+      it->second.last_used = std::max(it->second.last_used, frame - 1);
+      m_bytes += job.pixels.size();
+    }
+  }
+
+  void SvgRasterCache::Trim(const int frame) {
+    // sizes a resize went through without stopping are not worth rasterizing anymore
+    {
+      std::scoped_lock lock(m_mutex);
+      std::erase_if(m_pending, [&](const Job &job) {
+        const auto it = m_entries.find(job.key);
+        if (it == m_entries.end() || it->second.last_used >= frame - 1) return false;
+        m_entries.erase(it);
+        return true;
+      });
+    }
+    if (m_bytes <= MAX_BYTES) return;
+
+    std::vector<std::pair<int, Key>> candidates;
+    for (const auto &[key, entry]: m_entries) {
+      // anything drawn last frame is still on screen
+      if (entry.texture && entry.last_used < frame - 1) candidates.emplace_back(entry.last_used, key);
+    }
+    std::ranges::sort(candidates, {}, &std::pair<int, Key>::first);
+    for (const auto &[last_used, key]: candidates) {
+      if (m_bytes <= MAX_BYTES) break;
+      m_bytes -= static_cast<size_t>(key.width) * key.height * 4;
+      m_entries.erase(key);
+    }
+  }
+
+  void SvgRasterCache::Shutdown() {
+    m_worker.request_stop();
+    if (m_worker.joinable()) m_worker.join();
+    m_shutdown = true;
+    m_entries.clear();
+    m_bytes = 0;
+    std::scoped_lock lock(m_mutex);
+    m_pending.clear();
+    m_finished.clear();
+  }
+
+  void SvgRasterCache::Rasterize(const std::stop_token &stop) {
+    // the rasterizer keeps its edge and coverage buffers between calls, so the worker holds on to one
+    const std::unique_ptr<NSVGrasterizer, decltype(&nsvgDeleteRasterizer)> rasterizer(nsvgCreateRasterizer(),
+                                                                                       nsvgDeleteRasterizer);
+    if (!rasterizer) {
+      std::cerr << "Failed to create rasterizer" << std::endl;
+      return;
+    }
+
+    while (true) {
+      Job job;
+      {
+        std::unique_lock lock(m_mutex);
+        if (!m_job_added.wait(lock, stop, [this] { return !m_pending.empty(); })) return;
+        job = std::move(m_pending.front());
+        m_pending.pop_front();
+      }
+
+      // documents are never modified once parsed, so they can be read here while the render thread uses them
+      const uint32_t width = job.key.width, height = job.key.height;
+      job.pixels.assign(static_cast<size_t>(width) * height * 4, 0);
+      const float scale = std::min(width / job.document->width, height / job.document->height);
+      nsvgRasterize(rasterizer.get(), job.document.get(), 0, 0, scale, job.pixels.data(), static_cast<int>(width),
+                    static_cast<int>(height), static_cast<int>(width * 4));
+
+      if (job.key.color) Recolor(job.pixels, job.key.color);
+
+      std::scoped_lock lock(m_mutex);
+      m_finished.push_back(std::move(job));
+    }
+  }
+}  // namespace Infinity
@@ -0,0 +1,101 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <stop_token>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "Image.hpp"
+
+struct NSVGimage;
+
+namespace Infinity {
+  /**
+   * Rasterized variants of SVG documents, keyed by document, size bucket and color.
+   *
+   * Sizes are rounded up to buckets that are about an eighth of the size apart, so a window resize only produces a
+   * new variant every few steps instead of every frame. A missing variant is rasterized on a worker thread, and until
+   * it is uploaded the nearest variant of the same document and color is drawn scaled. Variants that were not drawn
+   * for a while are dropped least recently drawn first once the cache goes over MAX_BYTES.
+   *
+   * Get and Shutdown are render thread only.
+   */
+  class SvgRasterCache {
+public:
+    static SvgRasterCache &GetInstance();
+
+    SvgRasterCache(const SvgRasterCache &) = delete;
+    SvgRasterCache &operator=(const SvgRasterCache &) = delete;
+
+    /**
+     * Variant to draw a document at the given size
+     * @param color 0xAARRGGBB every visible pixel is painted with, 0 keeps the document's own colors
+     * @return the exact variant if it is ready, otherwise the nearest ready one, or null if there is none yet
+     */
+    std::shared_ptr<Image> Get(const std::shared_ptr<NSVGimage> &document, uint32_t width, uint32_t height,
+                               uint32_t color);
+
+    // stop the worker and release every texture, call before the GL context goes away
+    void Shutdown();
+
+    [[nodiscard]] size_t GetBytes() const { return m_bytes; }
+
+    static uint32_t Bucket(uint32_t size);
+    // paint every pixel of an RGBA8 raster in one 0xAARRGGBB color, keeping its coverage
+    static void Recolor(std::vector<uint8_t> &pixels, uint32_t color);
+
+    static constexpr size_t MAX_BYTES = 32ull * 1024 * 1024;
+
+private:
+    struct Key {
+      const NSVGimage *document;
+      uint32_t width;
+      uint32_t height;
+      uint32_t color;
+
+      bool operator==(const Key &) const = default;
+    };
+
+    struct KeyHash {
+      size_t operator()(const Key &key) const;
+    };
+
+    struct Entry {
+      std::shared_ptr<NSVGimage> document;  // keeps the key's document alive, and with it the address
+      std::shared_ptr<Image> texture;  // null while rasterizing
+      int last_used = 0;  // ImGui frame
+    };
+
+    struct Job {
+      Key key;
+      std::shared_ptr<NSVGimage> document;
+      std::vector<uint8_t> pixels;  // filled by the worker
+    };
+
+    SvgRasterCache();
+    ~SvgRasterCache() = default;
+
+    void Rasterize(const std::stop_token &stop);
+    void UploadFinished(int frame);
+    void Trim(int frame);
+
+private:
+    // render thread only
+    std::unordered_map<Key, Entry, KeyHash> m_entries;
+    size_t m_bytes = 0;
+    int m_last_frame = -1;
+    bool m_shutdown = false;
+
+    std::mutex m_mutex;
+    std::condition_variable_any m_job_added;
+    std::deque<Job> m_pending;
+    std::vector<Job> m_finished;
+
+    std::jthread m_worker;  // last, so it is stopped before anything it uses is destroyed
+  };
+}  // namespace Infinity
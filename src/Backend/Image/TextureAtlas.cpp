@@ -0,0 +1,162 @@
+#include "TextureAtlas.hpp"
+
+#include <iostream>
+
+namespace Infinity {
+  TextureAtlas &TextureAtlas::GetInstance() {
+    static TextureAtlas instance;
+    return instance;
+  }
+
+  std::optional<TextureAtlas::Region> TextureAtlas::Insert(const uint32_t width, const uint32_t height,
+                                                           const void *pixels) {
+    if (!Accepts(width, height)) return std::nullopt;
+    const auto padded_width = static_cast<uint16_t>(width + PADDING * 2);
+    const auto padded_height = static_cast<uint16_t>(height + PADDING * 2);
+
+    std::scoped_lock lock(m_mutex);
+    std::optional<Rect> rect;
+    size_t page_index = 0;
+    for (; page_index < m_pages.size() && !rect; ++page_index) {
+      rect = Allocate(m_pages[page_index], padded_width, padded_height);
+    }
+    if (!rect) {
+      if (m_pages.size() >= MAX_PAGES) return std::nullopt;
+      Page page;
+      page.texture = CreatePageTexture();
+      if (!page.texture) return std::nullopt;
+      m_pages.push_back(std::move(page));
+      page_index = m_pages.size();
+      rect = Allocate(m_pages.back(), padded_width, padded_height);
+    }
+    --page_index;
+
+    Page &page = m_pages[page_index];
+    ++page.live;
+
+    constexpr float texel = 1.0f / PAGE_SIZE;
+    const Region region{page.texture,
+                        {static_cast<float>(rect->x + PADDING) * texel, static_cast<float>(rect->y + PADDING) * texel},
+                        {static_cast<float>(rect->x + PADDING + width) * texel,
+                         static_cast<float>(rect->y + PADDING + height) * texel},
+                        static_cast<uint16_t>(page_index),
+                        rect->x,
+                        rect->y,
+                        rect->width,
+                        rect->height};
+    ClearGutter(region);
+    Update(region, pixels);
+    return region;
+  }
+
+  void TextureAtlas::Update(const Region &region, const void *pixels) {
+    glBindTexture(GL_TEXTURE_2D, region.texture);
+    glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+    glTexSubImage2D(GL_TEXTURE_2D, 0, region.x + PADDING, region.y + PADDING, region.width - PADDING * 2,
+                    region.height - PADDING * 2, GL_RGBA, GL_UNSIGNED_BYTE, pixels);
+  }
+
+  void TextureAtlas::ClearGutter(const Region &region) {
+    // only a fresh page starts out transparent, a reused rectangle still holds whatever image was there before. The
+    // inside is overwritten by Update, so clearing the padded rectangle only takes the four gutter strips
+    static const std::vector<uint8_t> zeros(static_cast<size_t>(MAX_ENTRY_SIZE + PADDING * 2) * PADDING * 4, 0);
+
+    GLint unpack_buffer = 0;
+    glGetIntegerv(GL_PIXEL_UNPACK_BUFFER_BINDING, &unpack_buffer);
+    if (unpack_buffer) glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+    glBindTexture(GL_TEXTURE_2D, region.texture);
+    glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+
+    const GLint right = region.x + region.width - PADDING;
+    const GLint bottom = region.y + region.height - PADDING;
+    const GLsizei inner_height = region.height - PADDING * 2;
+    glTexSubImage2D(GL_TEXTURE_2D, 0, region.x, region.y, region.width, PADDING, GL_RGBA, GL_UNSIGNED_BYTE,
+                    zeros.data());
+    glTexSubImage2D(GL_TEXTURE_2D, 0, region.x, bottom, region.width, PADDING, GL_RGBA, GL_UNSIGNED_BYTE,
+                    zeros.data());
+    glTexSubImage2D(GL_TEXTURE_2D, 0, region.x, region.y + PADDING, PADDING, inner_height, GL_RGBA, GL_UNSIGNED_BYTE,
+                    zeros.data());
+    glTexSubImage2D(GL_TEXTURE_2D, 0, right, region.y + PADDING, PADDING, inner_height, GL_RGBA, GL_UNSIGNED_BYTE,
+                    zeros.data());
+
+    if (unpack_buffer) glBindBuffer(GL_PIXEL_UNPACK_BUFFER, static_cast<GLuint>(unpack_buffer));
+  }
+
+  void TextureAtlas::Free(const Region &region) {
+    std::scoped_lock lock(m_mutex);
+    if (region.page >= m_pages.size() || m_pages[region.page].texture != region.texture) return;
+    Page &page = m_pages[region.page];
+    if (--page.live == 0) {
+      // nothing left on the page, start packing it from the top again
+      page.shelves.clear();
+      page.free_rects.clear();
+      page.next_shelf_y = 0;
+      return;
+    }
+    page.free_rects.push_back({region.x, region.y, region.width, region.height});
+  }
+
+  void TextureAtlas::Shutdown() {
+    std::scoped_lock lock(m_mutex);
+    for (const auto &page: m_pages) glDeleteTextures(1, &page.texture);
+    m_pages.clear();
+  }
+
+  std::optional<TextureAtlas::Rect> TextureAtlas::Allocate(Page &page, const uint16_t width, const uint16_t height) {
+    // space an earlier image left behind, the rest of that rectangle stays unused until the page empties
+    for (auto it = page.free_rects.begin(); it != page.free_rects.end(); ++it) {
+      if (it->width >= width && it->height >= height) {
+        const Rect rect{it->x, it->y, width, height};
+        page.free_rects.erase(it);
+        return rect;
+      }
+    }
+
+    // the shelf wasting the least height that still has room
+    Shelf *best = nullptr;
+    for (auto &shelf: page.shelves) {
+      if (shelf.height >= height && PAGE_SIZE - shelf.used >= width && (!best || shelf.height < best->height)) {
+        best = &shelf;
+      }
+    }
+    // a shelf much taller than the image wastes more than opening a new one would
+    if (best && best->height > height * 2 && page.next_shelf_y + height <= PAGE_SIZE) best = nullptr;
+
+    if (!best) {
+      if (page.next_shelf_y + height > PAGE_SIZE) return std::nullopt;
+      best = &page.shelves.emplace_back(Shelf{page.next_shelf_y, height, 0});
+      page.next_shelf_y += height;
+    }
+
+    const Rect rect{best->used, best->y, width, height};
+    best->used += width;
+    return rect;
+  }
+
+  GLuint TextureAtlas::CreatePageTexture() {
+    GLuint texture = 0;
+    glGenTextures(1, &texture);
+    if (!texture) {
+      std::cerr << "Failed to create atlas page" << std::endl;
+      return 0;
+    }
+    glBindTexture(GL_TEXTURE_2D, texture);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+
+    // the gutters have to be transparent, so the page starts out cleared rather than undefined
+    GLint unpack_buffer = 0;
+    glGetIntegerv(GL_PIXEL_UNPACK_BUFFER_BINDING, &unpack_buffer);
+    if (unpack_buffer) glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+    const std::vector<uint8_t> clear(static_cast<size_t>(PAGE_SIZE) * PAGE_SIZE * 4, 0);
+    glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, PAGE_SIZE, PAGE_SIZE, 0, GL_RGBA, GL_UNSIGNED_BYTE, clear.data());
+    if (unpack_buffer) glBindBuffer(GL_PIXEL_UNPACK_BUFFER, static_cast<GLuint>(unpack_buffer));
+    return texture;
+  }
+}  // namespace Infinity
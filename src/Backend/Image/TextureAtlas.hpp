@@ -0,0 +1,91 @@
+#pragma once
+
+#include "GL/glew.h"
+//
+
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <vector>
+
+#include "imgui.h"
+
+namespace Infinity {
+  /**
+   * Shared textures that small images are packed into.
+   *
+   * ImGui starts a new draw command whenever the texture changes, so every icon and logo living in its own texture
+   * splits the frame into dozens of draws. Images up to MAX_ENTRY_SIZE on both sides are instead placed into
+   * PAGE_SIZE pages with a shelf packer, Image keeps the page texture and the UV rectangle and maps every UV it
+   * draws with onto that rectangle.
+   *
+   * Insert is render thread only since it uploads, Free is safe from any thread (images can be released wherever
+   * their last owner lets go). Space freed in a page is reused by later images that fit it, a page that empties out
+   * is repacked from scratch.
+   */
+  class TextureAtlas {
+public:
+    struct Region {
+      GLuint texture;
+      ImVec2 uv0;
+      ImVec2 uv1;
+      uint16_t page;
+      uint16_t x, y, width, height;  // padded rectangle in the page
+    };
+
+    static TextureAtlas &GetInstance();
+
+    [[nodiscard]] static bool Accepts(uint32_t width, uint32_t height) {
+      return width > 0 && height > 0 && width <= MAX_ENTRY_SIZE && height <= MAX_ENTRY_SIZE;
+    }
+
+    /**
+     * Place an RGBA8 image into a page and upload it
+     * @param pixels tightly packed rows, or an offset into the bound GL_PIXEL_UNPACK_BUFFER
+     * @return std::nullopt if the image is too large for the atlas or every page is full
+     */
+    std::optional<Region> Insert(uint32_t width, uint32_t height, const void *pixels);
+
+    // upload new pixels into a region returned by Insert
+    static void Update(const Region &region, const void *pixels);
+
+    void Free(const Region &region);
+
+    void Shutdown();
+
+    static constexpr uint32_t PAGE_SIZE = 1024;
+    static constexpr uint32_t MAX_ENTRY_SIZE = 512;
+    static constexpr uint32_t MAX_PAGES = 8;
+    static constexpr uint32_t PADDING = 1;  // transparent gutter so linear filtering never picks up a neighbour
+
+private:
+    struct Rect {
+      uint16_t x, y, width, height;
+    };
+
+    struct Shelf {
+      uint16_t y;
+      uint16_t height;
+      uint16_t used;  // width taken from the left
+    };
+
+    struct Page {
+      GLuint texture = 0;
+      std::vector<Shelf> shelves;
+      std::vector<Rect> free_rects;
+      uint16_t next_shelf_y = 0;
+      uint32_t live = 0;
+    };
+
+    TextureAtlas() = default;
+
+    static std::optional<Rect> Allocate(Page &page, uint16_t width, uint16_t height);
+    // make the gutter around a region transparent again before an image is uploaded into it
+    static void ClearGutter(const Region &region);
+    static GLuint CreatePageTexture();
+
+private:
+    std::mutex m_mutex;
+    std::vector<Page> m_pages;
+  };
+}  // namespace Infinity
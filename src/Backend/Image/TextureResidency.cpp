@@ -0,0 +1,51 @@
+#include "TextureResidency.hpp"
+
+#include <algorithm>
+
+#include "Image.hpp"
+
+namespace Infinity {
+  TextureResidency &TextureResidency::GetInstance() {
+    static TextureResidency instance;
+    return instance;
+  }
+
+  void TextureResidency::Track(const std::shared_ptr<Image> &image) {
+    if (!image || !image->CanReload() || image->IsAtlased()) return;
+    // reloaded textures come through here again, they are already in the list
+    const bool tracked = std::ranges::any_of(m_tracked, [&image](const std::weak_ptr<Image> &entry) {
+      return !entry.owner_before(image) && !image.owner_before(entry);
+    });
+    if (!tracked) m_tracked.push_back(image);
+  }
+
+  void TextureResidency::EndFrame() {
+    std::erase_if(m_tracked, [](const std::weak_ptr<Image> &entry) { return entry.expired(); });
+
+    std::vector<std::shared_ptr<Image>> evictable;
+    size_t resident_bytes = 0;
+    for (const auto &entry: m_tracked) {
+      auto image = entry.lock();
+      if (!image) continue;
+      if (!image->IsResident()) {
+        if (image->GetLastUsed() == m_frame) Image::Reload(image);
+        continue;
+      }
+      resident_bytes += image->GetTextureBytes();
+      if (image->GetLastUsed() != m_frame) evictable.push_back(std::move(image));
+    }
+
+    const size_t budget = GetBudget();
+    if (resident_bytes > budget) {
+      std::ranges::sort(evictable, {}, [](const std::shared_ptr<Image> &image) { return image->GetLastUsed(); });
+      for (const auto &image: evictable) {
+        if (resident_bytes <= budget) break;
+        resident_bytes -= image->GetTextureBytes();
+        image->Evict();
+      }
+    }
+
+    m_resident_bytes = resident_bytes;
+    ++m_frame;
+  }
+}  // namespace Infinity
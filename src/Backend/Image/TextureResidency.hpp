@@ -0,0 +1,51 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace Infinity {
+  class Image;
+
+  /**
+   * Keeps the GPU memory used by downloaded images under a budget.
+   *
+   * Every Image::Render* call marks the image as drawn in the current frame. At the end of a frame, textures that were
+   * not drawn are evicted least recently drawn first until the tracked total fits the budget. Evicted images keep
+   * their encoded bytes, so the next time one is drawn it is decoded again on a worker thread and re-uploaded, with a
+   * placeholder shown in the meantime. Only images loaded from downloaded data that own their texture are tracked,
+   * embedded icons and anything packed into the TextureAtlas stay resident.
+   *
+   * Everything except SetBudget is render thread only.
+   */
+  class TextureResidency {
+public:
+    static TextureResidency &GetInstance();
+
+    // called once a texture has been uploaded
+    void Track(const std::shared_ptr<Image> &image);
+
+    // evict over-budget textures and reload evicted ones that were drawn this frame, call after the frame is submitted
+    void EndFrame();
+
+    [[nodiscard]] uint64_t GetFrame() const { return m_frame; }
+
+    void SetBudget(size_t bytes) { m_budget.store(bytes, std::memory_order_relaxed); }
+    [[nodiscard]] size_t GetBudget() const { return m_budget.load(std::memory_order_relaxed); }
+    // bytes held by tracked textures as of the last EndFrame
+    [[nodiscard]] size_t GetResidentBytes() const { return m_resident_bytes; }
+
+    static constexpr size_t DEFAULT_BUDGET = 192ull * 1024 * 1024;
+
+private:
+    TextureResidency() = default;
+
+private:
+    std::vector<std::weak_ptr<Image>> m_tracked;
+    std::atomic<size_t> m_budget = DEFAULT_BUDGET;
+    size_t m_resident_bytes = 0;
+    uint64_t m_frame = 1;  // 0 is never drawn
+  };
+}  // namespace Infinity
@@ -0,0 +1,398 @@
+#include "InstallPipeline.hpp"
+
+#include <algorithm>
+#include <array>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+
+#include "Backend/DeltaPatch/DeltaPatch.hpp"
+#include "Backend/ZipExtractor/ZipExtractor.hpp"
+#include "Backend/ZipExtractor/ZipStreamExtractor.hpp"
+
+namespace Infinity {
+  InstallPipeline::StagePool::StagePool(const size_t workers, std::function<void(const std::shared_ptr<Job> &)> run)
+      : m_run(std::move(run)) {
+    m_workers.reserve(workers);
+    for (size_t i = 0; i < workers; ++i) {
+      m_workers.emplace_back([this](const std::stop_token &stop) { WorkerLoop(stop); });
+    }
+  }
+
+  void InstallPipeline::StagePool::Push(const std::shared_ptr<Job> &job) {
+    {
+      std::lock_guard lock(m_mutex);
+      m_queue.push_back(job);
+    }
+    m_cv.notify_one();
+  }
+
+  void InstallPipeline::StagePool::WorkerLoop(const std::stop_token &stop) {
+    while (true) {
+      std::shared_ptr<Job> job;
+      {
+        std::unique_lock lock(m_mutex);
+        if (!m_cv.wait(lock, stop, [this] { return !m_queue.empty(); })) return;
+        job = std::move(m_queue.front());
+        m_queue.pop_front();
+      }
+      m_run(job);
+    }
+  }
+
+  InstallPipeline &InstallPipeline::GetInstance() {
+    static InstallPipeline instance;
+    return instance;
+  }
+
+  InstallPipeline::InstallPipeline()
+      : m_verify_pool(VERIFY_WORKERS, [this](const std::shared_ptr<Job> &job) { RunVerify(job); })
+      , m_extract_pool(EXTRACT_WORKERS, [this](const std::shared_ptr<Job> &job) { RunExtract(job); })
+      , m_install_pool(INSTALL_WORKERS, [this](const std::shared_ptr<Job> &job) { RunInstall(job); })
+      , m_cleanup_pool(CLEANUP_WORKERS, [this](const std::shared_ptr<Job> &job) { RunCleanup(job); }) {}
+
+  int InstallPipeline::Submit(JobSpec spec) {
+    auto job = std::make_shared<Job>();
+    job->spec = std::move(spec);
+    {
+      std::lock_guard lock(m_jobs_mutex);
+      job->id = m_next_job_id++;
+      m_jobs[job->id] = job;
+    }
+
+    Start(job);
+    return job->id;
+  }
+
+  int InstallPipeline::Replace(const int job_id, JobSpec spec) {
+    auto job = std::make_shared<Job>();
+    job->spec = std::move(spec);
+    std::shared_ptr<Job> previous;
+    {
+      std::lock_guard lock(m_jobs_mutex);
+      job->id = m_next_job_id++;
+      m_jobs[job->id] = job;
+      if (const auto it = m_jobs.find(job_id); it != m_jobs.end()) {
+        // stages are only finished while holding the lock, so the old job cannot finish between here and FinishJob
+        if (IsFinished(it->second->stage)) {
+          m_jobs.erase(it);
+        } else {
+          previous = it->second;
+          previous->successor = job;
+        }
+      }
+    }
+
+    if (!previous) {
+      Start(job);
+      return job->id;
+    }
+    Cancel(job_id);
+    return job->id;
+  }
+
+  void InstallPipeline::Start(const std::shared_ptr<Job> &job) {
+    // a queued replacement can itself be replaced before it ever started
+    if (job->cancelled) {
+      FinishJob(job, Stage::Cancelled);
+      return;
+    }
+    StartDownloadStage(job);
+  }
+
+  void InstallPipeline::StartDownloadStage(const std::shared_ptr<Job> &job) {
+    job->stage = Stage::Download;
+    job->stage_progress = 0.0f;
+    job->started = std::chrono::steady_clock::now();
+
+    auto &downloader = Downloads::GetInstance();
+    auto on_complete = [this, job](int, const zoe::Result result) { OnDownloadComplete(job, result); };
+
+    int download_id;
+    if (job->spec.streaming) {
+      // the extractor lives as long as the transfer, both callbacks run on the download thread
+      std::string output_path = job->spec.install_path;
+      auto extractor = std::make_shared<ZipStreamExtractor>(output_path);
+      auto on_data = [extractor](const uint8_t *data, const size_t size) { return extractor->Feed(data, size); };
+      auto on_finish = [extractor, job] {
+        if (!extractor->Finish()) {
+          std::lock_guard lock(GetInstance().m_jobs_mutex);
+          job->error = "Failed to extract package: " + extractor->GetError();
+          return false;
+        }
+        return true;
+      };
+      download_id = downloader.StartStreamingDownload(job->spec.url,
+                                                      job->spec.keep_archive ? job->spec.archive_path : std::string{},
+                                                      std::move(on_data), std::move(on_finish), std::move(on_complete));
+    } else {
+      download_id = downloader.StartDownload(job->spec.url, job->spec.archive_path, std::move(on_complete));
+    }
+
+    std::lock_guard lock(m_jobs_mutex);
+    job->download_id = download_id;
+  }
+
+  void InstallPipeline::Cancel(const int job_id) {
+    std::shared_ptr<Job> job;
+    int download_id;
+    {
+      std::lock_guard lock(m_jobs_mutex);
+      const auto it = m_jobs.find(job_id);
+      if (it == m_jobs.end()) return;
+      job = it->second;
+      download_id = job->download_id;
+      if (IsFinished(job->stage)) return;
+      job->cancelled = true;
+    }
+
+    if (job->stage == Stage::Download && download_id != -1) {
+      // the download completion callback moves the job to Cancelled
+      Downloads::GetInstance().StopDownload(download_id);
+    }
+  }
+
+  std::optional<InstallPipeline::Progress> InstallPipeline::GetProgress(const int job_id) {
+    std::shared_ptr<Job> job;
+    Progress progress;
+    {
+      std::lock_guard lock(m_jobs_mutex);
+      const auto it = m_jobs.find(job_id);
+      if (it == m_jobs.end()) return std::nullopt;
+      job = it->second;
+      progress.error = job->error;
+      progress.download_id = job->download_id;
+    }
+
+    progress.stage = job->stage;
+    const bool streaming = job->spec.streaming;
+    float stage_fraction = 0.0f;
+    if (progress.stage == Stage::Download) {
+      if (const auto *data = Downloads::GetInstance().GetDownloadData(progress.download_id)) {
+        stage_fraction = std::clamp(data->progress, 0.0f, 1.0f);
+        progress.speed = data->speed;
+      }
+    } else {
+      stage_fraction = std::clamp(job->stage_progress.load(), 0.0f, 1.0f);
+    }
+
+    if (progress.stage == Stage::Done) {
+      progress.fraction = 1.0f;
+    } else if (!IsFinished(progress.stage)) {
+      const float start = StageStart(progress.stage, streaming);
+      const float end = StageStart(static_cast<Stage>(static_cast<int>(progress.stage) + 1), streaming);
+      progress.fraction = start + (end - start) * stage_fraction;
+    }
+
+    if (progress.fraction > 0.01f && !IsFinished(progress.stage)) {
+      const double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - job->started).count();
+      progress.eta_seconds = elapsed * (1.0 - progress.fraction) / progress.fraction;
+    }
+    return progress;
+  }
+
+  void InstallPipeline::Remove(const int job_id) {
+    std::lock_guard lock(m_jobs_mutex);
+    if (const auto it = m_jobs.find(job_id); it != m_jobs.end() && IsFinished(it->second->stage)) {
+      m_jobs.erase(it);
+    }
+  }
+
+  const char *InstallPipeline::GetStageName(const Stage stage) {
+    switch (stage) {
+      case Stage::Download:
+        return "Downloading";
+      case Stage::Verify:
+        return "Verifying";
+      case Stage::Extract:
+        return "Extracting";
+      case Stage::Install:
+        return "Installing";
+      case Stage::Cleanup:
+        return "Cleaning up";
+      case Stage::Done:
+        return "Installed";
+      case Stage::Failed:
+        return "Failed";
+      case Stage::Cancelled:
+        return "Cancelled";
+    }
+    return "Unknown";
+  }
+
+  void InstallPipeline::OnDownloadComplete(const std::shared_ptr<Job> &job, const zoe::Result result) {
+    if (job->cancelled || result == zoe::Result::CANCELED) {
+      FinishJob(job, Stage::Cancelled);
+      return;
+    }
+    if (result != zoe::Result::SUCCESSED) {
+      std::string error;
+      {
+        std::lock_guard lock(m_jobs_mutex);
+        error = job->error.empty() ? "Download failed" : job->error;
+      }
+      FailJob(job, error);
+      return;
+    }
+    // streamed packages were verified entry by entry while they were extracted
+    Advance(job, job->spec.streaming ? Stage::Install : Stage::Verify);
+  }
+
+  void InstallPipeline::Advance(const std::shared_ptr<Job> &job, const Stage next) {
+    if (job->cancelled) {
+      FinishJob(job, Stage::Cancelled);
+      return;
+    }
+    job->stage_progress = 0.0f;
+    job->stage = next;
+    switch (next) {
+      case Stage::Verify:
+        m_verify_pool.Push(job);
+        break;
+      case Stage::Extract:
+        m_extract_pool.Push(job);
+        break;
+      case Stage::Install:
+        m_install_pool.Push(job);
+        break;
+      case Stage::Cleanup:
+        m_cleanup_pool.Push(job);
+        break;
+      default:
+        break;
+    }
+  }
+
+  void InstallPipeline::FailJob(const std::shared_ptr<Job> &job, const std::string &error) {
+    std::cerr << "Install job " << job->id << " failed: " << error << std::endl;
+    {
+      std::lock_guard lock(m_jobs_mutex);
+      job->error = error;
+    }
+    FinishJob(job, Stage::Failed);
+  }
+
+  void InstallPipeline::FinishJob(const std::shared_ptr<Job> &job, const Stage stage) {
+    std::shared_ptr<Job> successor;
+    {
+      std::lock_guard lock(m_jobs_mutex);
+      job->stage = stage;
+      successor = std::move(job->successor);
+      // a replaced job has nobody left asking for its progress
+      if (successor) m_jobs.erase(job->id);
+    }
+    if (successor) Start(successor);
+  }
+
+  void InstallPipeline::RunVerify(const std::shared_ptr<Job> &job) {
+    if (job->cancelled) {
+      FinishJob(job, Stage::Cancelled);
+      return;
+    }
+
+    std::error_code ec;
+    const auto size = std::filesystem::file_size(job->spec.archive_path, ec);
+    if (ec || size == 0) {
+      FailJob(job, "Downloaded archive is missing: " + job->spec.archive_path);
+      return;
+    }
+    if (const auto *data = Downloads::GetInstance().GetDownloadData(job->download_id);
+        data && data->size > 0 && static_cast<int64_t>(size) != data->size) {
+      FailJob(job, "Downloaded archive is incomplete: " + job->spec.archive_path);
+      return;
+    }
+
+    std::array<unsigned char, 4> magic{};
+    std::ifstream archive(job->spec.archive_path, std::ios::binary);
+    archive.read(reinterpret_cast<char *>(magic.data()), magic.size());
+    const bool is_zip = magic[0] == 'P' && magic[1] == 'K' && magic[2] == 0x03 && magic[3] == 0x04;
+    const bool is_gzip = magic[0] == 0x1f && magic[1] == 0x8b;
+    if (!is_zip && !is_gzip) {
+      FailJob(job, "Downloaded file is not an archive: " + job->spec.archive_path);
+      return;
+    }
+
+    Advance(job, Stage::Extract);
+  }
+
+  void InstallPipeline::RunExtract(const std::shared_ptr<Job> &job) {
+    if (job->cancelled) {
+      FinishJob(job, Stage::Cancelled);
+      return;
+    }
+
+    if (job->spec.patch) {
+      const auto patched = DeltaPatch::Apply(job->spec.archive_path, job->spec.install_path, &job->cancelled,
+                                             &job->stage_progress);
+      if (patched) {
+        Advance(job, Stage::Install);
+        return;
+      }
+      if (job->cancelled) {
+        FinishJob(job, Stage::Cancelled);
+        return;
+      }
+      if (job->spec.fallback_url.empty()) {
+        FailJob(job, patched.error());
+        return;
+      }
+
+      // the install was left untouched, so fetching the whole package still works
+      std::cerr << "Patch could not be applied (" << patched.error() << "), downloading the full package" << std::endl;
+      std::error_code ec;
+      std::filesystem::remove(job->spec.archive_path, ec);
+      job->spec.patch = false;
+      job->spec.url = job->spec.fallback_url;
+      job->spec.archive_path = job->spec.install_path + ".zip";
+      job->spec.fallback_url.clear();
+      StartDownloadStage(job);
+      return;
+    }
+
+    ZipExtractor extractor(job->spec.archive_path);
+    extractor.SetCancelFlag(&job->cancelled);
+    extractor.SetProgressSink(&job->stage_progress);
+    if (!extractor.Extract(job->spec.install_path)) {
+      if (job->cancelled) {
+        FinishJob(job, Stage::Cancelled);
+        return;
+      }
+      FailJob(job, "Failed to extract package: " + job->spec.archive_path);
+      return;
+    }
+    Advance(job, Stage::Install);
+  }
+
+  void InstallPipeline::RunInstall(const std::shared_ptr<Job> &job) {
+    if (job->cancelled) {
+      FinishJob(job, Stage::Cancelled);
+      return;
+    }
+
+    if (job->spec.on_install && !job->spec.on_install()) {
+      FailJob(job, "Failed to install package: " + job->spec.install_path);
+      return;
+    }
+    Advance(job, Stage::Cleanup);
+  }
+
+  void InstallPipeline::RunCleanup(const std::shared_ptr<Job> &job) {
+    // cancelling this late would only leave the archive behind, so cleanup always runs to the end
+    if (!job->spec.archive_path.empty()) {
+      std::error_code ec;
+      std::filesystem::remove(job->spec.archive_path, ec);
+      if (ec) {
+        std::cerr << "Failed to remove archive " << job->spec.archive_path << ": " << ec.message() << std::endl;
+      }
+    }
+    FinishJob(job, Stage::Done);
+  }
+
+  float InstallPipeline::StageStart(const Stage stage, const bool streaming) {
+    // rough share of the total install time spent before each stage begins
+    static constexpr std::array<float, 6> archive_stages = {0.0f, 0.70f, 0.75f, 0.95f, 0.98f, 1.0f};
+    static constexpr std::array<float, 6> streaming_stages = {0.0f, 0.95f, 0.95f, 0.95f, 0.98f, 1.0f};
+    const auto index = std::min(static_cast<size_t>(stage), archive_stages.size() - 1);
+    return streaming ? streaming_stages[index] : archive_stages[index];
+  }
+}  // namespace Infinity
@@ -0,0 +1,160 @@
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <stop_token>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Backend/Downloads/Downloads.hpp"
+
+namespace Infinity {
+  /**
+   * Runs package installs as a chain of stages: download → verify → extract → install → cleanup.
+   *
+   * Each job advances as soon as its previous stage reports completion. The download stage is driven by the
+   * completion callback from Downloads, every other stage runs on a small worker pool of its own, so an install never
+   * holds a thread while it waits and the number of concurrent extractions stays bounded no matter how many
+   * downloads are queued.
+   */
+  class InstallPipeline {
+public:
+    enum class Stage { Download, Verify, Extract, Install, Cleanup, Done, Failed, Cancelled };
+
+    struct JobSpec {
+      std::string url;
+      std::string archive_path;
+      std::string install_path;
+      bool streaming = false;     // extraction happens during the download stage
+      // streaming only, mirror the received bytes to archive_path so the transfer can resume
+      bool keep_archive = false;
+      std::function<bool()> on_install;  // optional post-extract step, returning false fails the job
+      bool patch = false;  // the download is a DeltaPatch applied on top of install_path instead of an archive
+      std::string fallback_url;  // full archive to fall back to when the patch cannot be applied
+    };
+
+    struct Progress {
+      Stage stage = Stage::Download;
+      float fraction = 0.0f;    // 0.0f - 1.0f across all stages
+      double eta_seconds = -1;  // negative while there is not enough data to estimate
+      int64_t speed = 0;        // bytes per second while downloading
+      int download_id = -1;
+      std::string error;
+    };
+
+    static InstallPipeline &GetInstance();
+
+    /**
+     * Queue a new install
+     * @param spec JobSpec
+     * @return job id used for progress queries and cancellation
+     */
+    int Submit(JobSpec spec);
+
+    /**
+     * Cancel a job, stopping its download or dropping it before the next stage starts
+     * @param job_id
+     */
+    void Cancel(int job_id);
+
+    /**
+     * Cancel a job and queue a new one in its place. The new job only starts once the old one has finished, so the two
+     * never touch the same archive or install path at once, and the old job is forgotten as soon as it does
+     * @param job_id job to replace, may already be finished or forgotten
+     * @param spec JobSpec
+     * @return id of the new job
+     */
+    int Replace(int job_id, JobSpec spec);
+
+    /**
+     * Returns aggregated progress for a job (if it exists)
+     * @param job_id
+     * @return `Progress` if exists else nullopt
+     */
+    std::optional<Progress> GetProgress(int job_id);
+
+    /**
+     * Forget a finished, failed or cancelled job
+     * @param job_id
+     */
+    void Remove(int job_id);
+
+    static bool IsFinished(const Stage stage) {
+      return stage == Stage::Done || stage == Stage::Failed || stage == Stage::Cancelled;
+    }
+
+    static const char *GetStageName(Stage stage);
+
+    InstallPipeline(const InstallPipeline &) = delete;
+    InstallPipeline &operator=(const InstallPipeline &) = delete;
+
+private:
+    struct Job {
+      int id = 0;
+      JobSpec spec;
+      std::atomic<Stage> stage = Stage::Download;
+      std::atomic<bool> cancelled = false;
+      std::atomic<float> stage_progress = 0.0f;  // progress reported by stages other than the download
+      int download_id = -1;
+      std::string error;
+      std::chrono::steady_clock::time_point started;
+      std::shared_ptr<Job> successor;  // queued by Replace, started once this job finishes
+    };
+
+    // fixed number of workers sharing one queue, workers block on the condition variable while the queue is empty
+    class StagePool {
+  public:
+      StagePool(size_t workers, std::function<void(const std::shared_ptr<Job> &)> run);
+      void Push(const std::shared_ptr<Job> &job);
+
+  private:
+      void WorkerLoop(const std::stop_token &stop);
+
+  private:
+      std::function<void(const std::shared_ptr<Job> &)> m_run;
+      std::deque<std::shared_ptr<Job>> m_queue;
+      std::mutex m_mutex;
+      std::condition_variable_any m_cv;
+      std::vector<std::jthread> m_workers;
+    };
+
+    InstallPipeline();
+
+    void Start(const std::shared_ptr<Job> &job);
+    void StartDownloadStage(const std::shared_ptr<Job> &job);
+    void OnDownloadComplete(const std::shared_ptr<Job> &job, zoe::Result result);
+    void Advance(const std::shared_ptr<Job> &job, Stage next);
+    void FailJob(const std::shared_ptr<Job> &job, const std::string &error);
+    void FinishJob(const std::shared_ptr<Job> &job, Stage stage);
+
+    void RunVerify(const std::shared_ptr<Job> &job);
+    void RunExtract(const std::shared_ptr<Job> &job);
+    void RunInstall(const std::shared_ptr<Job> &job);
+    void RunCleanup(const std::shared_ptr<Job> &job);
+
+    static float StageStart(Stage stage, bool streaming);
+
+private:
+    std::map<int, std::shared_ptr<Job>> m_jobs;
+    std::mutex m_jobs_mutex;
+    int m_next_job_id = 1;
+
+    // declared last so the workers are joined before the job table goes away
+    StagePool m_verify_pool;
+    StagePool m_extract_pool;
+    StagePool m_install_pool;
+    StagePool m_cleanup_pool;
+
+    static constexpr size_t VERIFY_WORKERS = 2;
+    static constexpr size_t EXTRACT_WORKERS = 1;
+    static constexpr size_t INSTALL_WORKERS = 1;
+    static constexpr size_t CLEANUP_WORKERS = 1;
+  };
+}  // namespace Infinity
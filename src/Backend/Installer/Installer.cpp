@@ -1,6 +1,11 @@
-
 #include "Installer.hpp"
 
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+
+#include "Util/State/GroupStateManager.hpp"
+
 namespace Infinity {
   Installer &Installer::GetInstance() {
     static Installer instance;
@@ -9,61 +14,128 @@ namespace Infinity {
 
   void Installer::SetDownloadDir(const std::string &download_dir) { m_download_dir = download_dir; }
 
+  void Installer::SetStreamingInstall(const bool streaming, const bool keep_archive) {
+    m_streaming_install = streaming;
+    m_keep_stream_archive = keep_archive;
+  }
+
 
   void Installer::PushDownload(const std::string &url, const Groups::GroupVariants &download_spec) {
-    auto &downloader = Downloads::GetInstance();
-    if (m_download_dir.empty()) m_download_dir = R"(/home/cameron/Downloads/Infinity.zip)";
-    std::lock_guard lock(m_global_downloads_mutex);
-    for (auto it = m_global_downloads.begin(); it != m_global_downloads.end(); ++it) {
-      if (it->second == download_spec) {
-        // we have already started a download for this product previously
-        m_global_downloads.erase(it);
+    PushJob(MakeArchiveSpec(url), download_spec);
+  }
+
+  void Installer::PushPackage(const Package &package, const Groups::GroupVariants &download_spec) {
+    const std::string release_url =
+        "https://github.com/" + package.owner + "/" + package.repoName + "/releases/download/" + package.version + "/";
+    const std::string install_path = GetInstallPath();
+    const auto installed_version = GetInstalledVersion(install_path);
+
+    const PackagePatch *patch = nullptr;
+    if (installed_version.has_value() && installed_version.value() != package.version && package.patches.has_value()) {
+      for (const auto &candidate: package.patches.value()) {
+        if (candidate.from == installed_version.value() && candidate.to == package.version) {
+          patch = &candidate;
+          break;
+        }
       }
     }
-    auto id = downloader.StartDownload(url, m_download_dir);
+
+    InstallPipeline::JobSpec spec;
+    if (patch) {
+      spec.url = release_url + patch->fileName;
+      spec.install_path = install_path;
+      spec.archive_path = install_path + ".patch";
+      spec.patch = true;
+      spec.fallback_url = release_url + package.fileName;
+    } else {
+      spec = MakeArchiveSpec(release_url + package.fileName);
+    }
+
+    spec.on_install = [install_path, version = package.version] {
+      std::ofstream file(std::filesystem::path(install_path) / VERSION_FILE_NAME, std::ios::trunc);
+      file << version << '\n';
+      return static_cast<bool>(file);
+    };
+    PushJob(std::move(spec), download_spec);
+  }
+
+  std::optional<std::string> Installer::GetInstalledVersion(const std::string &install_path) {
+    std::ifstream file(std::filesystem::path(install_path) / VERSION_FILE_NAME);
+    std::string version;
+    if (!file || !std::getline(file, version) || version.empty()) return std::nullopt;
+    return version;
+  }
+
+  void Installer::PushJob(InstallPipeline::JobSpec spec, const Groups::GroupVariants &download_spec) {
+    auto &pipeline = InstallPipeline::GetInstance();
+    std::lock_guard lock(m_global_downloads_mutex);
+    const auto previous = std::ranges::find_if(
+        m_global_downloads, [&download_spec](const auto &download) { return download.second == download_spec; });
+    int id;
+    if (previous != m_global_downloads.end()) {
+      // we have already started a download for this product previously, it has to stop before the new one can start
+      id = pipeline.Replace(previous->first, std::move(spec));
+      m_global_downloads.erase(previous);
+    } else {
+      id = pipeline.Submit(std::move(spec));
+    }
     m_global_downloads.insert({id, download_spec});
+  }
 
-    StartUnzipWatcher(id, m_download_dir);
+  InstallPipeline::JobSpec Installer::MakeArchiveSpec(const std::string &url) {
+    InstallPipeline::JobSpec spec;
+    spec.url = url;
+    spec.install_path = GetInstallPath();
+    spec.archive_path = m_download_dir;
+
+    // updates go through the archive so unchanged files can be skipped, fresh installs can stream straight to disk
+    std::error_code ec;
+    const bool fresh_install = std::filesystem::is_empty(spec.install_path, ec) || ec;
+    spec.streaming = m_streaming_install && fresh_install;
+    spec.keep_archive = m_keep_stream_archive;
+    return spec;
+  }
+
+  std::string Installer::GetInstallPath() {
+    if (m_download_dir.empty()) m_download_dir = R"(/home/cameron/Downloads/Infinity.zip)";
+    std::string install_path(m_download_dir);
+    if (install_path.ends_with(".zip")) {
+      install_path.erase(install_path.size() - 4);
+    }
+    return install_path;
   }
 
   std::optional<int> Installer::GetActiveDownloadFromEnum(const Groups::GroupVariants &download_variant) {
-    std::lock_guard lock(m_global_downloads_mutex);
-    for (const auto it = m_global_downloads.begin(); it != m_global_downloads.end();) {
-      if (it->second == download_variant) {
-        return it->first;
-      }
+    const auto job = GetJobFromEnum(download_variant);
+    if (!job.has_value()) return std::nullopt;
+    if (const auto progress = InstallPipeline::GetInstance().GetProgress(job.value());
+        progress.has_value() && progress->download_id != -1) {
+      return progress->download_id;
     }
     return std::nullopt;
   }
 
-  void Installer::StartUnzipWatcher(int id, const std::string &file_path) {
-    std::thread([id, file_path] {
-      while (true) {
-        {
-          auto &downloader = Downloads::GetInstance();
-          if (const auto *data = downloader.GetDownloadData(id); data->completed) {
-            auto trim_path = [](std::string &path) {
-              if (path.ends_with(".zip")) {
-                path.erase(path.size() - 4);
-              }
-            };
-            ZipExtractor extractor(file_path);
-            std::string output_path(file_path);
-            trim_path(output_path);
-            extractor.Extract(output_path);
-            // if (!extractor.RemoveArchive()) {
-            //   Errors::Error(Errors::ErrorType::Warning, "Failed to remove archive file: " +
-            //   extractor.GetArchivePath())
-            //       .Dispatch();
-            // }
-            break;
-          }
-        }
+  std::optional<InstallPipeline::Progress> Installer::GetInstallProgress(
+      const Groups::GroupVariants &download_variant) {
+    const auto job = GetJobFromEnum(download_variant);
+    if (!job.has_value()) return std::nullopt;
+    return InstallPipeline::GetInstance().GetProgress(job.value());
+  }
 
+  void Installer::CancelInstall(const Groups::GroupVariants &download_variant) {
+    if (const auto job = GetJobFromEnum(download_variant); job.has_value()) {
+      InstallPipeline::GetInstance().Cancel(job.value());
+    }
+  }
 
-        std::this_thread::sleep_for(std::chrono::seconds(1));
+  std::optional<int> Installer::GetJobFromEnum(const Groups::GroupVariants &download_variant) {
+    std::lock_guard lock(m_global_downloads_mutex);
+    for (const auto &[id, variant]: m_global_downloads) {
+      if (variant == download_variant) {
+        return id;
       }
-    }).detach();
+    }
+    return std::nullopt;
   }
 
 
@@ -5,20 +5,28 @@
 #include <mutex>
 #include <optional>
 #include <string>
-#include <thread>
 #include <vector>
 
-#include "Backend/Downloads/Downloads.hpp"
-#include "Backend/ZipExtractor/ZipExtractor.hpp"
+#include "Backend/Installer/InstallPipeline.hpp"
 #include "Util/Error/Error.hpp"
 #include "Util/GroupUtil/GroupUtil.hpp"
 
 namespace Infinity {
+  struct Package;
+
   class Installer {
 public:
     static Installer &GetInstance();
     void SetDownloadDir(const std::string &download_dir);
 
+    /**
+     * Extract packages while they download rather than after, off by default
+     * @param streaming feed received bytes straight into the extractor, only used for fresh installs so updates can
+     * still skip files that did not change
+     * @param keep_archive also write the archive to the download path so an interrupted install can resume
+     */
+    void SetStreamingInstall(bool streaming, bool keep_archive = false);
+
     /**
      * Start a new download
      * @param url std::string
@@ -26,10 +34,27 @@ public:
      *
      * The download pointer can be obtained by first calling
      * GetActiveDownloadFromEnum() and then using that ID to pass to the
-     * downloader singleton
+     * downloader singleton, overall install progress is available from
+     * GetInstallProgress()
      */
     void PushDownload(const std::string &url, const Groups::GroupVariants &download_spec);
 
+    /**
+     * Install or update a catalog package
+     * @param package Package
+     * @param download_spec Group enum
+     *
+     * When the catalog lists a patch from the installed version to `package.version` only the patch is downloaded,
+     * falling back to the full release archive if it cannot be applied
+     */
+    void PushPackage(const Package &package, const Groups::GroupVariants &download_spec);
+
+    /**
+     * Returns the package version recorded in an install directory (if any)
+     * @param install_path
+     */
+    static std::optional<std::string> GetInstalledVersion(const std::string &install_path);
+
 
     /**
      * Returns the ID for the active download (if it exists)
@@ -38,13 +63,33 @@ public:
      */
     std::optional<int> GetActiveDownloadFromEnum(const Groups::GroupVariants &download_variant);
 
+    /**
+     * Returns the progress of the install pipeline for a product (if one was started)
+     * @param download_variant
+     * @return `InstallPipeline::Progress` if exists else nullopt
+     */
+    std::optional<InstallPipeline::Progress> GetInstallProgress(const Groups::GroupVariants &download_variant);
+
+    /**
+     * Cancel the install for a product, if one is running
+     * @param download_variant
+     */
+    void CancelInstall(const Groups::GroupVariants &download_variant);
+
 private:
-    static void StartUnzipWatcher(int id, const std::string &file_path);
+    std::optional<int> GetJobFromEnum(const Groups::GroupVariants &download_variant);
+    void PushJob(InstallPipeline::JobSpec spec, const Groups::GroupVariants &download_spec);
+    InstallPipeline::JobSpec MakeArchiveSpec(const std::string &url);
+    std::string GetInstallPath();
+
+    static constexpr auto VERSION_FILE_NAME = ".infinity-version";
 
 private:
     static Installer *m_instance;
     std::string m_download_dir;
-    std::map<int, Groups::GroupVariants> m_global_downloads;  // <int id, GroupVariants name>
+    bool m_streaming_install = false;
+    bool m_keep_stream_archive = false;
+    std::map<int, Groups::GroupVariants> m_global_downloads;  // <int install job id, GroupVariants name>
     std::mutex m_global_downloads_mutex;
   };
 }  // namespace Infinity
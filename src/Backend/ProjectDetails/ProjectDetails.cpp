@@ -0,0 +1,181 @@
+#include "ProjectDetails.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <fstream>
+#include <iostream>
+
+#include "Backend/CurlShare/CurlShare.hpp"
+#include "Backend/Updater/Updater.hpp"
+#include "Util/State/Catalog.hpp"
+#include "Util/WorkerPool/WorkerPool.hpp"
+#include "curl/curl.h"
+#include "msgpack.hpp"
+
+namespace Infinity {
+  static size_t DetailWriteCallback(char *ptr, const size_t size, const size_t nmemb, void *userdata) {
+    auto *buffer = static_cast<std::vector<uint8_t> *>(userdata);
+    buffer->insert(buffer->end(), ptr, ptr + size * nmemb);
+    return size * nmemb;
+  }
+
+  ProjectDetails &ProjectDetails::GetInstance() {
+    static ProjectDetails instance;
+    return instance;
+  }
+
+  ProjectDetails::ProjectDetails()
+      : m_cache_dir(std::filesystem::path(Updater::GetConfigDir()) / "cache" / "details") {
+    std::error_code ec;
+    std::filesystem::create_directories(m_cache_dir, ec);
+    if (ec) {
+      std::cerr << "Failed to create detail cache " << m_cache_dir << ": " << ec.message() << std::endl;
+    }
+  }
+
+  std::shared_ptr<const ProjectDetails::Detail> ProjectDetails::Get(const std::string_view blob) {
+    {
+      std::scoped_lock lock(m_mutex);
+      // failed entries fall through so Prefetch can retry them
+      const auto it = m_entries.find(std::string(blob));
+      if (it != m_entries.end() && it->second.status != Status::Failed) return it->second.detail;
+    }
+    Prefetch(blob);
+    return nullptr;
+  }
+
+  void ProjectDetails::Prefetch(const std::string_view blob) {
+    std::string name(blob);
+    {
+      std::scoped_lock lock(m_mutex);
+      const auto [it, inserted] = m_entries.try_emplace(name);
+      Entry &entry = it->second;
+      if (!inserted) {
+        if (entry.status != Status::Failed || std::chrono::steady_clock::now() < entry.retry_at) return;
+        entry.status = Status::Loading;
+      } else if (!IsValidBlobName(blob)) {
+        // a name that cannot be a file never will be, so it is not retried
+        entry.status = Status::Failed;
+        entry.retry_at = std::chrono::steady_clock::time_point::max();
+        return;
+      }
+    }
+    WorkerPool::GetShared().Push([this, name = std::move(name)] { Load(name); });
+  }
+
+  bool ProjectDetails::HasFailed(const std::string_view blob) const {
+    std::scoped_lock lock(m_mutex);
+    const auto it = m_entries.find(std::string(blob));
+    return it != m_entries.end() && it->second.status == Status::Failed;
+  }
+
+  void ProjectDetails::Load(const std::string &blob) {
+    std::shared_ptr<const Detail> detail;
+
+    if (const auto cached = ReadCache(blob); cached.has_value()) {
+      detail = Decode(*cached);
+    }
+    if (!detail) {
+      if (const auto fetched = Fetch(blob); fetched.has_value()) {
+        detail = Decode(*fetched);
+        if (detail) WriteCache(blob, *fetched);
+      }
+    }
+
+    std::scoped_lock lock(m_mutex);
+    auto &entry = m_entries[blob];
+    entry.detail = detail;
+    if (detail) {
+      entry.status = Status::Ready;
+      entry.failures = 0;
+      return;
+    }
+    entry.status = Status::Failed;
+    const auto delay = RETRY_DELAY * (1 << std::min(entry.failures++, 8));
+    entry.retry_at = std::chrono::steady_clock::now() + std::min<std::chrono::seconds>(delay, MAX_RETRY_DELAY);
+  }
+
+  std::optional<std::vector<uint8_t>> ProjectDetails::ReadCache(const std::string &blob) const {
+    std::ifstream file(m_cache_dir / (blob + ".bin"), std::ios::binary | std::ios::ate);
+    if (!file) return std::nullopt;
+
+    std::vector<uint8_t> data(static_cast<size_t>(file.tellg()));
+    file.seekg(0);
+    if (!file.read(reinterpret_cast<char *>(data.data()), static_cast<std::streamsize>(data.size()))) {
+      return std::nullopt;
+    }
+    return data;
+  }
+
+  void ProjectDetails::WriteCache(const std::string &blob, const std::vector<uint8_t> &data) const {
+    // written under a temporary name so a crash never leaves a truncated blob behind
+    const auto path = m_cache_dir / (blob + ".bin");
+    const auto temp_path = m_cache_dir / (blob + ".bin.tmp");
+    {
+      std::ofstream file(temp_path, std::ios::binary | std::ios::trunc);
+      if (!file.write(reinterpret_cast<const char *>(data.data()), static_cast<std::streamsize>(data.size()))) {
+        return;
+      }
+    }
+    std::error_code ec;
+    std::filesystem::rename(temp_path, path, ec);
+    if (ec) std::filesystem::remove(temp_path, ec);
+  }
+
+  std::optional<std::vector<uint8_t>> ProjectDetails::Fetch(const std::string &blob) {
+    CURL *curl = curl_easy_init();
+    if (!curl) {
+      std::cerr << "curl_easy_init failed" << std::endl;
+      return std::nullopt;
+    }
+
+    const std::string url = std::string(BASE_URL) + blob + ".bin";
+    std::vector<uint8_t> buffer;
+    CurlShare::GetInstance().Attach(curl);
+    curl_easy_setopt(curl, CURLOPT_URL, url.c_str());
+    curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, DetailWriteCallback);
+    curl_easy_setopt(curl, CURLOPT_WRITEDATA, &buffer);
+    curl_easy_setopt(curl, CURLOPT_FOLLOWLOCATION, 1L);
+    curl_easy_setopt(curl, CURLOPT_SSL_VERIFYPEER, 1L);
+    curl_easy_setopt(curl, CURLOPT_USERAGENT, "Infinity-MSFS-Client/1.0");
+
+    const CURLcode res = curl_easy_perform(curl);
+    long http_code = 0;
+    curl_easy_getinfo(curl, CURLINFO_RESPONSE_CODE, &http_code);
+    curl_easy_cleanup(curl);
+
+    if (res != CURLE_OK || http_code != 200) {
+      std::cerr << "Failed to fetch project detail " << url << ": "
+                << (res != CURLE_OK ? curl_easy_strerror(res) : "HTTP " + std::to_string(http_code)) << std::endl;
+      return std::nullopt;
+    }
+    return buffer;
+  }
+
+  std::shared_ptr<const ProjectDetails::Detail> ProjectDetails::Decode(const std::vector<uint8_t> &data) {
+    try {
+      const auto raw = InflateGzip(data);
+      const auto handle = msgpack::unpack(reinterpret_cast<const char *>(raw.data()), raw.size());
+      const msgpack::object &root = handle.get();
+      if (root.type != msgpack::type::ARRAY || root.via.array.size < 3) throw msgpack::type_error();
+
+      const auto text = [&root](const uint32_t index) {
+        const auto &field = root.via.array.ptr[index];
+        return field.type == msgpack::type::NIL ? std::string() : field.as<std::string>();
+      };
+      return std::make_shared<const Detail>(Detail{text(0), text(1), text(2)});
+    } catch (const std::exception &e) {
+      std::cerr << "Failed to decode project detail: " << e.what() << std::endl;
+      return nullptr;
+    }
+  }
+
+  bool ProjectDetails::IsValidBlobName(const std::string_view blob) {
+    // blob names end up in a file path, so only allow what a content hash can contain
+    if (blob.empty() || blob.size() > 128) return false;
+    for (const char c: blob) {
+      if (!std::isalnum(static_cast<unsigned char>(c)) && c != '-' && c != '_') return false;
+    }
+    return true;
+  }
+}  // namespace Infinity
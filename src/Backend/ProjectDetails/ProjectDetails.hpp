@@ -0,0 +1,76 @@
+#pragma once
+
+#include <chrono>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace Infinity {
+  /**
+   * Long form project text that the split catalog (index.bin) leaves out.
+   *
+   * Each project in index.bin names a detail blob, a gzip'd msgpack array [changelog, overview, description] stored
+   * next to the index under details/<blob>.bin. Blob names are content hashes, so a blob that was cached on disk once
+   * never has to be checked again. Blobs are loaded on the shared worker pool the first time a page asks for them, or
+   * earlier when something is about to be opened (hovering a card for instance). A blob that failed to load is tried
+   * again by the next Get or Prefetch once its retry delay has passed, the delay doubling with every failure.
+   */
+  class ProjectDetails {
+public:
+    struct Detail {
+      std::string changelog;
+      std::string overview;
+      std::string description;
+    };
+
+    static ProjectDetails &GetInstance();
+
+    /**
+     * Detail for a blob, starting a load if it is not in memory yet
+     * @param blob name from CatalogProject::detail
+     * @return nullptr while the blob is still loading or if it failed to load
+     */
+    std::shared_ptr<const Detail> Get(std::string_view blob);
+
+    /**
+     * Start loading a blob without waiting for it, or retry a failed one whose retry delay has passed
+     * @param blob name from CatalogProject::detail
+     */
+    void Prefetch(std::string_view blob);
+
+    [[nodiscard]] bool HasFailed(std::string_view blob) const;
+
+    static constexpr auto BASE_URL = "https://github.com/infinity-MSFS/groups/raw/refs/heads/main/details/";
+    static constexpr std::chrono::seconds RETRY_DELAY{2};
+    static constexpr std::chrono::seconds MAX_RETRY_DELAY{300};
+
+private:
+    enum class Status { Loading, Ready, Failed };
+
+    struct Entry {
+      Status status = Status::Loading;
+      std::shared_ptr<const Detail> detail;
+      int failures = 0;
+      std::chrono::steady_clock::time_point retry_at;  // Failed entries only
+    };
+
+    ProjectDetails();
+
+    void Load(const std::string &blob);
+    std::optional<std::vector<uint8_t>> ReadCache(const std::string &blob) const;
+    void WriteCache(const std::string &blob, const std::vector<uint8_t> &data) const;
+    static std::optional<std::vector<uint8_t>> Fetch(const std::string &blob);
+    static std::shared_ptr<const Detail> Decode(const std::vector<uint8_t> &data);
+    static bool IsValidBlobName(std::string_view blob);
+
+private:
+    mutable std::mutex m_mutex;
+    std::unordered_map<std::string, Entry> m_entries;
+    std::filesystem::path m_cache_dir;
+  };
+}  // namespace Infinity
@@ -12,7 +12,7 @@
 namespace Infinity::Utils {
   std::unique_ptr<Router> Router::m_instance = nullptr;
 
-  void Router::configure(std::unordered_map<int, std::pair<std::function<void()>, Palette>> pages) {
+  void Router::configure(std::unordered_map<int, std::pair<std::function<void()>, PackedPalette>> pages) {
     if (!m_instance) {
       m_instance = std::unique_ptr<Router>(new Router(std::move(pages)));
     }
@@ -27,17 +27,13 @@ namespace Infinity::Utils {
   }
 
   std::expected<bool, Errors::Error> Router::setPage(const int page_id) {
-    if (m_page_data.contains(page_id)) {
+    if (const Page *page = FindPage(page_id)) {
       m_current_page_id = page_id;
       Background::GetInstance()->SetDotOpacity(page_id < 3 ? 0.3f : 0.1f);
+      const auto &colors = page->palette.colors;
       ColorInterpolation::GetInstance().ChangeGradientColors(
-          hexToImVec4(m_page_data[m_current_page_id].second.primary),
-          hexToImVec4(m_page_data[m_current_page_id].second.secondary),
-          hexToImVec4(m_page_data[m_current_page_id].second.circle1),
-          hexToImVec4(m_page_data[m_current_page_id].second.circle2),
-          hexToImVec4(m_page_data[m_current_page_id].second.circle3),
-          hexToImVec4(m_page_data[m_current_page_id].second.circle4),
-          hexToImVec4(m_page_data[m_current_page_id].second.circle5), 1.0f);
+          UnpackColor(colors[0]), UnpackColor(colors[1]), UnpackColor(colors[2]), UnpackColor(colors[3]),
+          UnpackColor(colors[4]), UnpackColor(colors[5]), UnpackColor(colors[6]), 1.0f);
       return true;
     }
     std::ostringstream oss;
@@ -48,14 +44,26 @@ namespace Infinity::Utils {
   int Router::getPage() const { return m_current_page_id; }
 
   void Router::RenderCurrentPage() {
-    if (m_page_data.contains(m_current_page_id)) {
-      m_page_data[m_current_page_id].first();
+    if (const Page *page = FindPage(m_current_page_id)) {
+      page->render();
     } else {
       throw std::runtime_error("Failed to render page: Page does not exist.");
     }
   }
 
-  Router::Router(std::unordered_map<int, std::pair<std::function<void()>, Palette>> pages)
-      : m_current_page_id(0)
-      , m_page_data(std::move(pages)) {}
+  const Router::Page *Router::FindPage(const int page_id) const {
+    if (page_id < 0 || page_id >= static_cast<int>(m_pages.size()) || !m_pages[page_id].render) {
+      return nullptr;
+    }
+    return &m_pages[page_id];
+  }
+
+  Router::Router(std::unordered_map<int, std::pair<std::function<void()>, PackedPalette>> pages)
+      : m_current_page_id(0) {
+    for (auto &[id, page]: pages) {
+      if (id < 0) continue;
+      if (id >= static_cast<int>(m_pages.size())) m_pages.resize(id + 1);
+      m_pages[id] = {std::move(page.first), page.second};
+    }
+  }
 }  // namespace Infinity::Utils
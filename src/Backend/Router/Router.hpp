@@ -6,14 +6,15 @@
 #include <memory>
 #include <optional>
 #include <unordered_map>
+#include <vector>
 
 #include "Util/Error/Error.hpp"
-#include "Util/State/GroupStateManager.hpp"
+#include "Util/State/CatalogIndex.hpp"
 
 namespace Infinity::Utils {
   class Router {
 public:
-    static void configure(std::unordered_map<int, std::pair<std::function<void()>, Palette>> pages);
+    static void configure(std::unordered_map<int, std::pair<std::function<void()>, PackedPalette>> pages);
 
     static std::optional<Router *> getInstance();
 
@@ -24,10 +25,17 @@ public:
     void RenderCurrentPage();
 
 private:
-    explicit Router(std::unordered_map<int, std::pair<std::function<void()>, Palette>> pages);
+    explicit Router(std::unordered_map<int, std::pair<std::function<void()>, PackedPalette>> pages);
+
+    struct Page {
+      std::function<void()> render;
+      PackedPalette palette;
+    };
+
+    [[nodiscard]] const Page *FindPage(int page_id) const;
 
     static std::unique_ptr<Router> m_instance;
     int m_current_page_id;
-    std::unordered_map<int, std::pair<std::function<void()>, Palette>> m_page_data;
+    std::vector<Page> m_pages;  // indexed by page id, ids without a page have an empty render function
   };
 }  // namespace Infinity::Utils
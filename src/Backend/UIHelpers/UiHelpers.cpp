@@ -39,11 +39,14 @@ namespace Infinity {
                        const ImU32 tintPressed, const ImVec2 rectMin, const ImVec2 rectMax) {
     auto *drawList = ImGui::GetForegroundDrawList();
     if (ImGui::IsItemActive())
-      drawList->AddImage(imagePressed->GetImGuiTextureID(), rectMin, rectMax, ImVec2(0, 0), ImVec2(1, 1), tintPressed);
+      drawList->AddImage(imagePressed->GetImGuiTextureID(), rectMin, rectMax, imagePressed->GetUV0(),
+                         imagePressed->GetUV1(), tintPressed);
     else if (ImGui::IsItemHovered())
-      drawList->AddImage(imagePressed->GetImGuiTextureID(), rectMin, rectMax, ImVec2(0, 0), ImVec2(1, 1), tintHovered);
+      drawList->AddImage(imagePressed->GetImGuiTextureID(), rectMin, rectMax, imagePressed->GetUV0(),
+                         imagePressed->GetUV1(), tintHovered);
     else
-      drawList->AddImage(imagePressed->GetImGuiTextureID(), rectMin, rectMax, ImVec2(0, 0), ImVec2(1, 1), tintNormal);
+      drawList->AddImage(imagePressed->GetImGuiTextureID(), rectMin, rectMax, imagePressed->GetUV0(),
+                         imagePressed->GetUV1(), tintNormal);
   }
 
   void DrawButtonImage(const std::shared_ptr<Image> &imageNormal, const std::shared_ptr<Image> &imageHovered,
@@ -133,17 +136,11 @@ namespace Infinity {
     ImVec2 size = ImVec2(rectMax.x - rectMin.x, rectMax.y - rectMin.y);
 
     if (ImGui::IsItemActive()) {
-      auto svgCopy = svgPressed->Clone();
-      svgCopy->ChangeColor(colorPressed);
-      SVGImage::RenderSVG(svgCopy, rectMin, size);
+      SVGImage::RenderSVG(svgPressed, rectMin, size, colorPressed);
     } else if (ImGui::IsItemHovered()) {
-      auto svgCopy = svgHovered->Clone();
-      svgCopy->ChangeColor(colorHovered);
-      SVGImage::RenderSVG(svgCopy, rectMin, size);
+      SVGImage::RenderSVG(svgHovered, rectMin, size, colorHovered);
     } else {
-      auto svgCopy = svgNormal->Clone();
-      svgCopy->ChangeColor(colorNormal);
-      SVGImage::RenderSVG(svgCopy, rectMin, size);
+      SVGImage::RenderSVG(svgNormal, rectMin, size, colorNormal);
     }
   }
 
@@ -20,7 +20,9 @@ namespace Infinity {
   void Updater::LaunchUpdater(const std::string &updater_path,
                               const std::string &temp_exe_path,
                               const std::string &current_exe_path,
-                              const std::string &pid_file_path) {
+                              const std::string &pid_file_path,
+                              const std::string &temp_pack_path,
+                              const std::string &current_pack_path) {
     std::string command;
 #ifdef WIN32
     auto convert_path = [](std::string path) {
@@ -32,12 +34,16 @@ namespace Infinity {
     std::string win_temp_exe_path = convert_path(temp_exe_path);
     std::string win_current_exe_path = convert_path(current_exe_path);
     std::string win_pid_file_path = convert_path(pid_file_path);
+    std::string win_temp_pack_path = convert_path(temp_pack_path);
+    std::string win_current_pack_path = convert_path(current_pack_path);
 
     command = "start \"\" \"" + win_updater_path + "\" \"" + win_temp_exe_path +
-        "\" \"" + win_current_exe_path + "\" \"" + win_pid_file_path + "\"";
+        "\" \"" + win_current_exe_path + "\" \"" + win_pid_file_path + "\" \"" +
+        win_temp_pack_path + "\" \"" + win_current_pack_path + "\"";
 #else
     command = "\"" + updater_path + "\" \"" + temp_exe_path + "\" \"" +
-        current_exe_path + "\" \"" + pid_file_path +
+        current_exe_path + "\" \"" + pid_file_path + "\" \"" + temp_pack_path +
+        "\" \"" + current_pack_path +
         "\"; read -p 'Press Enter to continue...'";
 #endif
 
@@ -14,10 +14,14 @@ namespace Infinity {
   class Updater {
 public:
     static void WritePidToFile(const std::string& path);
+    // the asset pack is always swapped together with the exe, AssetPack refuses
+    // a pack that was not built with the executable opening it
     static void LaunchUpdater(const std::string& updater_path,
                               const std::string& temp_exe_path,
                               const std::string& current_exe_path,
-                              const std::string& pid_file_path);
+                              const std::string& pid_file_path,
+                              const std::string& temp_pack_path,
+                              const std::string& current_pack_path);
     static std::string GetConfigDir();
     static std::string GetCurrentExecutablePath();
 
@@ -0,0 +1,83 @@
+#include "InstallManifest.hpp"
+
+#include <chrono>
+#include <ctime>
+#include <fstream>
+#include <sstream>
+
+namespace Infinity {
+  namespace {
+    // ZIP stores local time with two second resolution
+    std::optional<std::filesystem::file_time_type> DosTimeToFileTime(const uint32_t dos_date) {
+      std::tm tm{};
+      tm.tm_sec = static_cast<int>(dos_date & 0x1f) * 2;
+      tm.tm_min = static_cast<int>(dos_date >> 5 & 0x3f);
+      tm.tm_hour = static_cast<int>(dos_date >> 11 & 0x1f);
+      tm.tm_mday = static_cast<int>(dos_date >> 16 & 0x1f);
+      tm.tm_mon = static_cast<int>(dos_date >> 21 & 0x0f) - 1;
+      tm.tm_year = static_cast<int>(dos_date >> 25 & 0x7f) + 80;
+      tm.tm_isdst = -1;
+      const std::time_t time = std::mktime(&tm);
+      if (time == -1) return std::nullopt;
+      // map through the current offset between the clocks, clock_cast is not available on every standard library yet
+      const auto since_now = std::chrono::system_clock::from_time_t(time) - std::chrono::system_clock::now();
+      return std::chrono::file_clock::now() +
+          std::chrono::duration_cast<std::filesystem::file_time_type::duration>(since_now);
+    }
+  }  // namespace
+
+  std::string InstallManifest::Key(const std::string &entry_name) {
+    return std::filesystem::path(entry_name).lexically_normal().generic_string();
+  }
+
+  InstallManifest::Records InstallManifest::Load(const std::filesystem::path &path) {
+    Records records;
+    std::ifstream input(path);
+    std::string line;
+    if (!std::getline(input, line) || line != "infinity-manifest 1") return records;
+
+    // <crc> <size> <mtime> <path>, the path is last so it may contain spaces
+    while (std::getline(input, line)) {
+      std::istringstream fields(line);
+      Record record;
+      if (!(fields >> record.crc >> record.size >> record.mtime)) continue;
+      fields.get();
+      std::string name;
+      std::getline(fields, name);
+      if (!name.empty()) records.emplace(std::move(name), record);
+    }
+    return records;
+  }
+
+  bool InstallManifest::Save(const std::filesystem::path &path, const Records &records) {
+    auto temporary = path;
+    temporary += ".tmp";
+    {
+      std::ofstream output(temporary, std::ios::trunc);
+      if (!output) return false;
+      output << "infinity-manifest 1\n";
+      for (const auto &[name, record]: records) {
+        output << record.crc << ' ' << record.size << ' ' << record.mtime << ' ' << name << '\n';
+      }
+      if (!output) return false;
+    }
+    std::error_code ec;
+    std::filesystem::rename(temporary, path, ec);
+    return !ec;
+  }
+
+  std::optional<InstallManifest::Record> InstallManifest::StampFile(const std::filesystem::path &target,
+                                                                    const uint64_t size, const uint32_t crc,
+                                                                    const uint32_t dos_date) {
+    std::error_code ec;
+    if (dos_date != 0) {
+      if (const auto archive_time = DosTimeToFileTime(dos_date); archive_time.has_value()) {
+        std::filesystem::last_write_time(target, archive_time.value(), ec);
+      }
+    }
+    // read the time back, the filesystem may round it
+    const auto mtime = std::filesystem::last_write_time(target, ec);
+    if (ec) return std::nullopt;
+    return Record{size, crc, static_cast<int64_t>(mtime.time_since_epoch().count())};
+  }
+}  // namespace Infinity
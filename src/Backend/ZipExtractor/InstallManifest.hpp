@@ -0,0 +1,49 @@
+#pragma once
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <string>
+#include <unordered_map>
+
+namespace Infinity {
+  /**
+   * The .infinity-manifest kept in an install directory, listing every file the launcher wrote there.
+   *
+   * ZipExtractor, ZipStreamExtractor and DeltaPatch all write into install directories and keep it up to date. A
+   * record is trusted as long as the file's size and modification time still match it, so an incremental update can
+   * skip the file without reading it back. Only needs the standard library, so the PatchBuilder tool can share it.
+   *
+   * Format: a first line "infinity-manifest 1", then one "<crc> <size> <mtime> <path>" line per file.
+   */
+  class InstallManifest {
+public:
+    struct Record {
+      uint64_t size = 0;
+      uint32_t crc = 0;
+      int64_t mtime = 0;  // std::filesystem::file_time_type ticks as reported after the file was written
+    };
+    using Records = std::unordered_map<std::string, Record>;
+
+    static constexpr auto FILE_NAME = ".infinity-manifest";
+
+    // key of an archive entry or patch file name, normalized so every writer agrees on it
+    static std::string Key(const std::string &entry_name);
+
+    // empty if the manifest is missing or in another format
+    static Records Load(const std::filesystem::path &path);
+
+    // written under a temporary name first, so a crash never leaves a truncated manifest behind
+    static bool Save(const std::filesystem::path &path, const Records &records);
+
+    /**
+     * Record a file that was just written
+     * @param target the written file
+     * @param size uncompressed size
+     * @param crc CRC-32 of the contents
+     * @param dos_date modification time from the archive, 0 to keep the time the file was written at
+     * @return nullopt if the file's time could not be read
+     */
+    static std::optional<Record> StampFile(const std::filesystem::path &target, uint64_t size, uint32_t crc,
+                                           uint32_t dos_date = 0);
+  };
+}  // namespace Infinity
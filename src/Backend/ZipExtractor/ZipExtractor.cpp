@@ -1,7 +1,20 @@
-
 #include "ZipExtractor.hpp"
 
+#include <algorithm>
+#include <iostream>
+#include <ranges>
+#include <set>
+#include <thread>
+
 namespace Infinity {
+  namespace {
+    // rejects absolute paths and anything that would climb out of the output directory
+    bool IsSafeEntryPath(const std::filesystem::path &relative) {
+      return !relative.is_absolute() && !relative.has_root_name() &&
+          (relative.empty() || *relative.begin() != "..");
+    }
+  }  // namespace
+
   bool ZipExtractor::ExtractFile(gzFile file, const std::string &output_path) {
     std::ofstream output_file(output_path, std::ios::binary);
     if (!output_file) {
@@ -17,6 +30,7 @@ namespace Infinity {
         output_file.close();
         return false;
       }
+      if (IsCancelled()) return false;
     }
     output_file.close();
     return bytes_read >= 0;
@@ -33,19 +47,276 @@ namespace Infinity {
     }
   }
 
+  const std::vector<ZipExtractor::Entry> &ZipExtractor::GetEntries() {
+    if (!m_central_directory_read) {
+      m_is_zip = ReadCentralDirectory();
+      m_central_directory_read = true;
+    }
+    return m_entries;
+  }
+
+  bool ZipExtractor::ReadCentralDirectory() {
+    unzFile zip = unzOpen64(m_path.c_str());
+    if (!zip) return false;
+
+    unz_global_info64 global_info;
+    if (unzGetGlobalInfo64(zip, &global_info) != UNZ_OK) {
+      unzClose(zip);
+      return false;
+    }
+    m_entries.clear();
+    m_entries.reserve(static_cast<size_t>(global_info.number_entry));
+
+    std::vector<char> name(UINT16_MAX + 1);
+    for (int status = unzGoToFirstFile(zip); status == UNZ_OK; status = unzGoToNextFile(zip)) {
+      unz_file_info64 info;
+      if (unzGetCurrentFileInfo64(zip, &info, name.data(), name.size(), nullptr, 0, nullptr, 0) != UNZ_OK) {
+        unzClose(zip);
+        return false;
+      }
+
+      Entry entry{};
+      entry.name.assign(name.data(), info.size_filename);
+      entry.compressed_size = info.compressed_size;
+      entry.uncompressed_size = info.uncompressed_size;
+      entry.crc = static_cast<uint32_t>(info.crc);
+      entry.dos_date = static_cast<uint32_t>(info.dosDate);
+      entry.directory = entry.name.ends_with('/');
+      unzGetFilePos64(zip, &entry.position);
+
+      if (info.flag & 1) {
+        std::cerr << "ZipExtractor: encrypted entries are not supported: " << entry.name << std::endl;
+        unzClose(zip);
+        return false;
+      }
+      m_entries.push_back(std::move(entry));
+    }
+
+    unzClose(zip);
+    return true;
+  }
+
   bool ZipExtractor::Extract(const std::string &output_file_path) {
-    std::filesystem::create_directory(output_file_path);
+    std::error_code ec;
+    std::filesystem::create_directories(output_file_path, ec);
 
-    gzFile file = gzopen(m_path.c_str(), "rb");
-    if (!file) {
+    GetEntries();
+    if (!m_is_zip) {
+      // not a ZIP, treat it as a single gzip compressed file
+      gzFile file = gzopen(m_path.c_str(), "rb");
+      if (!file) {
+        return false;
+      }
+      gzbuffer(file, CHUNK_SIZE);
+
+      auto target = std::filesystem::path(output_file_path) / std::filesystem::path(m_path).stem();
+      const bool success = ExtractFile(file, target.string());
+
+      gzclose(file);
+      return success;
+    }
+
+    const std::filesystem::path output_path(output_file_path);
+
+    // create the whole tree first so the workers never race on create_directories
+    std::set<std::filesystem::path> directories;
+    for (const auto &entry: m_entries) {
+      const auto relative = std::filesystem::path(entry.name).lexically_normal();
+      if (!IsSafeEntryPath(relative)) {
+        std::cerr << "ZipExtractor: entry escapes the output directory: " << entry.name << std::endl;
+        return false;
+      }
+      directories.insert(entry.directory ? output_path / relative : (output_path / relative).parent_path());
+    }
+    for (const auto &directory: directories) {
+      std::filesystem::create_directories(directory, ec);
+      if (ec) {
+        std::cerr << "ZipExtractor: failed to create directory " << directory << ": " << ec.message() << std::endl;
+        return false;
+      }
+    }
+
+    // largest entries first so one big file does not end up as the tail of the last worker
+    std::vector<size_t> order;
+    order.reserve(m_entries.size());
+    m_total_bytes = 0;
+    for (size_t i = 0; i < m_entries.size(); ++i) {
+      if (m_entries[i].directory) continue;
+      order.push_back(i);
+      m_total_bytes += m_entries[i].uncompressed_size;
+    }
+    std::ranges::sort(order, [this](size_t a, size_t b) {
+      return m_entries[a].uncompressed_size > m_entries[b].uncompressed_size;
+    });
+
+    const auto manifest_path = output_path / InstallManifest::FILE_NAME;
+    m_previous_manifest = m_incremental ? InstallManifest::Load(manifest_path) : Manifest{};
+    m_written.assign(m_entries.size(), std::nullopt);
+    m_skipped_entries = 0;
+    m_bytes_written = 0;
+    if (!ExtractEntries(output_path, order)) return false;
+
+    if (!m_incremental) {
+      std::filesystem::remove(manifest_path, ec);
+      return true;
+    }
+
+    Manifest manifest;
+    manifest.reserve(order.size());
+    for (const size_t index: order) {
+      if (m_written[index].has_value()) {
+        manifest.emplace(InstallManifest::Key(m_entries[index].name), m_written[index].value());
+      }
+    }
+    RemoveStaleFiles(output_path, manifest);
+    if (!InstallManifest::Save(manifest_path, manifest)) {
+      std::cerr << "ZipExtractor: failed to write manifest " << manifest_path << std::endl;
+    }
+    return true;
+  }
+
+  bool ZipExtractor::ExtractEntries(const std::filesystem::path &output_path, const std::vector<size_t> &order) {
+    std::atomic<size_t> next = 0;
+    std::atomic<bool> failed = false;
+
+    auto worker = [&] {
+      unzFile zip = unzOpen64(m_path.c_str());
+      if (!zip) {
+        failed = true;
+        return;
+      }
+      std::vector<char> buffer(CHUNK_SIZE);
+      for (size_t i = next++; i < order.size() && !failed && !IsCancelled(); i = next++) {
+        const auto &entry = m_entries[order[i]];
+        const auto target = output_path / std::filesystem::path(entry.name).lexically_normal();
+        if (std::optional<ManifestRecord> record; m_incremental && IsEntryCurrent(entry, target, buffer, record)) {
+          ++m_skipped_entries;
+          m_written[order[i]] = record.has_value() ? record
+                                                   : InstallManifest::StampFile(target, entry.uncompressed_size,
+                                                                                entry.crc, entry.dos_date);
+          ReportProgress(entry.uncompressed_size);
+          continue;
+        }
+        if (!ExtractEntry(zip, entry, target, buffer)) {
+          failed = true;
+          continue;
+        }
+        if (m_incremental) {
+          m_written[order[i]] = InstallManifest::StampFile(target, entry.uncompressed_size, entry.crc, entry.dos_date);
+        }
+      }
+      unzClose(zip);
+    };
+
+    const size_t hardware = std::max(1u, std::thread::hardware_concurrency());
+    const size_t workers = std::clamp<size_t>((order.size() + ENTRIES_PER_WORKER - 1) / ENTRIES_PER_WORKER, 1,
+                                              std::min(hardware, MAX_WORKERS));
+
+    if (workers == 1) {
+      worker();
+    } else {
+      std::vector<std::jthread> threads;
+      threads.reserve(workers);
+      for (size_t i = 0; i < workers; ++i) {
+        threads.emplace_back(worker);
+      }
+    }
+
+    return !failed && !IsCancelled();
+  }
+
+  bool ZipExtractor::ExtractEntry(unzFile zip, const Entry &entry, const std::filesystem::path &target,
+                                  std::vector<char> &buffer) {
+    auto position = entry.position;
+    if (unzGoToFilePos64(zip, &position) != UNZ_OK || unzOpenCurrentFile(zip) != UNZ_OK) {
+      std::cerr << "ZipExtractor: failed to open entry " << entry.name << std::endl;
+      return false;
+    }
+
+    std::ofstream output(target, std::ios::binary | std::ios::trunc);
+    if (!output) {
+      unzCloseCurrentFile(zip);
+      std::cerr << "ZipExtractor: failed to create " << target << std::endl;
+      return false;
+    }
+    if (entry.uncompressed_size >= PRESIZE_THRESHOLD) {
+      // reserve the final size up front so large files are laid out in one go
+      std::error_code ec;
+      std::filesystem::resize_file(target, entry.uncompressed_size, ec);
+    }
+
+    int bytes_read;
+    while ((bytes_read = unzReadCurrentFile(zip, buffer.data(), static_cast<unsigned>(buffer.size()))) > 0) {
+      output.write(buffer.data(), bytes_read);
+      if (output.bad()) break;
+      ReportProgress(static_cast<uint64_t>(bytes_read));
+      if (IsCancelled()) break;
+    }
+    output.close();
+
+    // a CRC mismatch is only reported when the entry is closed after being read to the end
+    const int close_status = unzCloseCurrentFile(zip);
+    if (bytes_read < 0 || output.fail() || close_status != UNZ_OK) {
+      if (!IsCancelled()) {
+        std::cerr << "ZipExtractor: failed to extract " << entry.name << " (" << bytes_read << ", " << close_status
+                  << ")" << std::endl;
+      }
       return false;
     }
+    return true;
+  }
+
+  bool ZipExtractor::IsEntryCurrent(const Entry &entry, const std::filesystem::path &target, std::vector<char> &buffer,
+                                    std::optional<ManifestRecord> &record) const {
+    std::error_code ec;
+    const auto size = std::filesystem::file_size(target, ec);
+    if (ec || size != entry.uncompressed_size) return false;
+
+    // trust the manifest when the file has not been touched since we wrote it
+    if (const auto it = m_previous_manifest.find(InstallManifest::Key(entry.name)); it != m_previous_manifest.end()) {
+      const auto mtime = std::filesystem::last_write_time(target, ec);
+      if (!ec && it->second.size == size && it->second.crc == entry.crc &&
+          it->second.mtime == static_cast<int64_t>(mtime.time_since_epoch().count())) {
+        record = it->second;
+        return true;
+      }
+    }
 
-    std::string extract_path = std::filesystem::path(m_path).string();
-    const bool success = ExtractFile(file, output_file_path);
+    // otherwise reading the installed file back is still far cheaper than inflating and writing it
+    std::ifstream input(target, std::ios::binary);
+    if (!input) return false;
+    uLong crc = crc32(0L, Z_NULL, 0);
+    while (input) {
+      input.read(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+      if (const auto read = input.gcount(); read > 0) {
+        crc = crc32(crc, reinterpret_cast<const Bytef *>(buffer.data()), static_cast<uInt>(read));
+      }
+    }
+    return static_cast<uint32_t>(crc) == entry.crc;
+  }
+
+  void ZipExtractor::RemoveStaleFiles(const std::filesystem::path &output_path, const Manifest &current) const {
+    for (const auto &name: m_previous_manifest | std::views::keys) {
+      if (current.contains(name)) continue;
+
+      const auto relative = std::filesystem::path(name).lexically_normal();
+      if (!IsSafeEntryPath(relative)) continue;
 
-    gzclose(file);
-    return success;
+      std::error_code ec;
+      auto path = output_path / relative;
+      std::filesystem::remove(path, ec);
+      // prune directories the removal left empty, remove() refuses anything that still has contents
+      for (path = path.parent_path(); path != output_path && path.has_relative_path(); path = path.parent_path()) {
+        if (!std::filesystem::remove(path, ec)) break;
+      }
+    }
+  }
+
+  void ZipExtractor::ReportProgress(const uint64_t bytes) {
+    const uint64_t written = m_bytes_written.fetch_add(bytes) + bytes;
+    if (m_progress && m_total_bytes > 0) {
+      m_progress->store(static_cast<float>(static_cast<double>(written) / static_cast<double>(m_total_bytes)));
+    }
   }
 
   bool ZipExtractor::RemoveArchive() const {
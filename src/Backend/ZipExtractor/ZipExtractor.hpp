@@ -1,27 +1,108 @@
-
 #pragma once
+#include <atomic>
+#include <cstdint>
 #include <filesystem>
 #include <fstream>
+#include <optional>
 #include <string>
 #include <vector>
 
+#include "InstallManifest.hpp"
 #include "Util/Error/Error.hpp"
+#include "minizip/unzip.h"
 #include "zlib.h"
 
 namespace Infinity {
+  /**
+   * Extracts a ZIP archive into a directory.
+   *
+   * The central directory is read once up front, every directory is created before any data is written and the
+   * entries are then inflated in parallel, each worker holding its own handle to the archive. Plain gzip files are
+   * still accepted and are decompressed into a single file inside the output directory.
+   *
+   * In incremental mode (the default) an InstallManifest of what was written is kept in the output directory.
+   * Entries whose size, CRC-32 and modification time already match the installed file are skipped, and files the
+   * manifest knows about that are no longer in the archive are deleted.
+   */
   class ZipExtractor {
 public:
+    struct Entry {
+      std::string name;
+      uint64_t compressed_size;
+      uint64_t uncompressed_size;
+      uint32_t crc;
+      uint32_t dos_date;
+      bool directory;
+      unz64_file_pos position;
+    };
+
     explicit ZipExtractor(const std::string &zip_file_path);
     bool Extract(const std::string &output_file_path);
     bool RemoveArchive() const;
     std::string GetArchivePath() const;
 
+    /**
+     * Entries from the central directory, read on first use
+     * @return empty if the file is not a ZIP archive
+     */
+    const std::vector<Entry> &GetEntries();
+
+    /**
+     * Stop extracting as soon as the workers notice the flag
+     * @param cancelled flag owned by the caller, must outlive Extract()
+     */
+    void SetCancelFlag(const std::atomic<bool> *cancelled) { m_cancelled = cancelled; }
+
+    /**
+     * Receive the fraction of uncompressed bytes written so far
+     * @param progress 0.0f - 1.0f, owned by the caller, must outlive Extract()
+     */
+    void SetProgressSink(std::atomic<float> *progress) { m_progress = progress; }
+
+    /**
+     * Only write entries that differ from the installed files
+     * @param incremental when false every entry is extracted and no manifest is kept
+     */
+    void SetIncremental(const bool incremental) { m_incremental = incremental; }
+
+    [[nodiscard]] size_t GetSkippedEntries() const { return m_skipped_entries; }
+
 private:
+    using ManifestRecord = InstallManifest::Record;
+    using Manifest = InstallManifest::Records;
+
+    bool ReadCentralDirectory();
+    bool ExtractEntries(const std::filesystem::path &output_path, const std::vector<size_t> &order);
+    bool ExtractEntry(unzFile zip, const Entry &entry, const std::filesystem::path &target, std::vector<char> &buffer);
+    bool IsEntryCurrent(const Entry &entry, const std::filesystem::path &target, std::vector<char> &buffer,
+                        std::optional<ManifestRecord> &record) const;
+    void RemoveStaleFiles(const std::filesystem::path &output_path, const Manifest &current) const;
+
     bool ExtractFile(gzFile file, const std::string &output_path);
 
+    [[nodiscard]] bool IsCancelled() const { return m_cancelled && m_cancelled->load(); }
+    void ReportProgress(uint64_t bytes);
+
 private:
     std::string m_path;
     std::vector<uint8_t> m_buffer;
-    static constexpr size_t CHUNK_SIZE = 8192;
+    std::vector<Entry> m_entries;
+    bool m_central_directory_read = false;
+    bool m_is_zip = false;
+
+    const std::atomic<bool> *m_cancelled = nullptr;
+    std::atomic<float> *m_progress = nullptr;
+    std::atomic<uint64_t> m_bytes_written = 0;
+    uint64_t m_total_bytes = 0;
+
+    bool m_incremental = true;
+    Manifest m_previous_manifest;
+    std::vector<std::optional<ManifestRecord>> m_written;  // indexed like m_entries, filled by the workers
+    std::atomic<size_t> m_skipped_entries = 0;
+
+    static constexpr size_t CHUNK_SIZE = 1024 * 1024;
+    static constexpr uint64_t PRESIZE_THRESHOLD = 1024 * 1024;
+    static constexpr size_t MAX_WORKERS = 8;
+    static constexpr size_t ENTRIES_PER_WORKER = 64;
   };
 }  // namespace Infinity
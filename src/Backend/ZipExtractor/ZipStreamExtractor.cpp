@@ -0,0 +1,342 @@
+#include "ZipStreamExtractor.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+
+namespace Infinity {
+  namespace {
+    constexpr uint32_t LOCAL_HEADER_SIGNATURE = 0x04034b50;
+    constexpr uint32_t CENTRAL_HEADER_SIGNATURE = 0x02014b50;
+    constexpr uint32_t END_OF_CENTRAL_DIR_SIGNATURE = 0x06054b50;
+    constexpr uint32_t DATA_DESCRIPTOR_SIGNATURE = 0x08074b50;
+    constexpr size_t LOCAL_HEADER_SIZE = 30;
+
+    constexpr uint16_t FLAG_ENCRYPTED = 0x0001;
+    constexpr uint16_t FLAG_DATA_DESCRIPTOR = 0x0008;
+
+    constexpr uint16_t METHOD_STORED = 0;
+    constexpr uint16_t METHOD_DEFLATED = 8;
+
+    uint16_t ReadU16(const uint8_t *p) { return static_cast<uint16_t>(p[0] | p[1] << 8); }
+
+    uint32_t ReadU32(const uint8_t *p) {
+      return static_cast<uint32_t>(p[0]) | static_cast<uint32_t>(p[1]) << 8 | static_cast<uint32_t>(p[2]) << 16 |
+          static_cast<uint32_t>(p[3]) << 24;
+    }
+
+    uint64_t ReadU64(const uint8_t *p) {
+      return static_cast<uint64_t>(ReadU32(p)) | static_cast<uint64_t>(ReadU32(p + 4)) << 32;
+    }
+  }  // namespace
+
+  ZipStreamExtractor::ZipStreamExtractor(const std::string &output_path)
+      : m_output_path(output_path)
+      , m_file_buffer(FILE_BUFFER_SIZE)
+      , m_out_buffer(OUT_CHUNK_SIZE) {
+    std::error_code ec;
+    std::filesystem::create_directories(m_output_path, ec);
+  }
+
+  ZipStreamExtractor::~ZipStreamExtractor() {
+    if (m_inflate_ready) {
+      inflateEnd(&m_inflate);
+    }
+  }
+
+  bool ZipStreamExtractor::Feed(const uint8_t *data, const size_t size) {
+    if (m_stage == Stage::Failed) return false;
+    if (m_stage == Stage::Done) return true;
+
+    // drop what has already been consumed before growing the buffer again
+    if (m_pending_offset > 0 && m_pending_offset >= m_pending.size() / 2) {
+      m_pending.erase(m_pending.begin(), m_pending.begin() + static_cast<std::ptrdiff_t>(m_pending_offset));
+      m_pending_offset = 0;
+    }
+    m_pending.insert(m_pending.end(), data, data + size);
+
+    bool progressed = true;
+    while (progressed && m_stage != Stage::Failed && m_stage != Stage::Done) {
+      const size_t before = m_pending_offset;
+      const Stage stage_before = m_stage;
+
+      switch (m_stage) {
+        case Stage::LocalHeader:
+          if (!ParseLocalHeader()) return false;
+          break;
+        case Stage::EntryData:
+          if (!(m_entry.method == METHOD_STORED ? ConsumeStored() : ConsumeDeflated())) return false;
+          break;
+        case Stage::SkipData:
+          SkipData();
+          break;
+        case Stage::DataDescriptor:
+          if (!ConsumeDataDescriptor()) return false;
+          break;
+        default:
+          break;
+      }
+
+      progressed = m_pending_offset != before || m_stage != stage_before;
+    }
+
+    return m_stage != Stage::Failed;
+  }
+
+  bool ZipStreamExtractor::Finish() {
+    if (m_stage == Stage::Failed) return false;
+    if (m_stage != Stage::Done && !(m_stage == Stage::LocalHeader && Available() == 0 && m_entries_written > 0)) {
+      return Fail("Archive ended before all entries were received");
+    }
+    SaveManifest();
+    return true;
+  }
+
+  void ZipStreamExtractor::SaveManifest() {
+    const auto manifest_path = m_output_path / InstallManifest::FILE_NAME;
+    if (!InstallManifest::Save(manifest_path, m_manifest)) {
+      std::cerr << "ZipStreamExtractor: failed to write manifest " << manifest_path << std::endl;
+    }
+  }
+
+  bool ZipStreamExtractor::ParseLocalHeader() {
+    if (Available() < 4) return true;
+
+    const uint32_t signature = ReadU32(Cursor());
+    if (signature == CENTRAL_HEADER_SIGNATURE || signature == END_OF_CENTRAL_DIR_SIGNATURE) {
+      // everything after the last local entry is directory metadata we already know
+      m_stage = Stage::Done;
+      m_pending.clear();
+      m_pending_offset = 0;
+      return true;
+    }
+    if (signature != LOCAL_HEADER_SIGNATURE) {
+      return Fail("Invalid local file header signature");
+    }
+    if (Available() < LOCAL_HEADER_SIZE) return true;
+
+    const uint8_t *header = Cursor();
+    const uint16_t name_length = ReadU16(header + 26);
+    const uint16_t extra_length = ReadU16(header + 28);
+    if (Available() < LOCAL_HEADER_SIZE + name_length + extra_length) return true;
+
+    Entry entry;
+    entry.flags = ReadU16(header + 6);
+    entry.method = ReadU16(header + 8);
+    entry.dos_date = ReadU32(header + 10);
+    entry.crc = ReadU32(header + 14);
+    entry.compressed_size = ReadU32(header + 18);
+    uint64_t uncompressed_size = ReadU32(header + 22);
+
+    const std::string name(reinterpret_cast<const char *>(header + LOCAL_HEADER_SIZE), name_length);
+
+    const uint8_t *extra = header + LOCAL_HEADER_SIZE + name_length;
+    for (size_t i = 0; i + 4 <= extra_length;) {
+      const uint16_t tag = ReadU16(extra + i);
+      const uint16_t size = ReadU16(extra + i + 2);
+      if (i + 4 + size > extra_length) break;
+      if (tag == 0x0001) {
+        // zip64 extended information, only the fields saturated in the header are present
+        entry.zip64 = true;
+        size_t field = i + 4;
+        if (uncompressed_size == 0xFFFFFFFF && field + 8 <= i + 4 + size) {
+          uncompressed_size = ReadU64(extra + field);
+          field += 8;
+        }
+        if (entry.compressed_size == 0xFFFFFFFF && field + 8 <= i + 4 + size) {
+          entry.compressed_size = ReadU64(extra + field);
+        }
+      }
+      i += 4 + size;
+    }
+
+    m_pending_offset += LOCAL_HEADER_SIZE + name_length + extra_length;
+
+    if (entry.flags & FLAG_ENCRYPTED) {
+      return Fail("Encrypted entries are not supported: " + name);
+    }
+    if (entry.method != METHOD_STORED && entry.method != METHOD_DEFLATED) {
+      return Fail("Unsupported compression method for entry: " + name);
+    }
+    if (entry.method == METHOD_STORED && (entry.flags & FLAG_DATA_DESCRIPTOR) && !name.ends_with('/')) {
+      return Fail("Stored entries with a trailing data descriptor cannot be streamed: " + name);
+    }
+
+    const auto relative = std::filesystem::path(name).lexically_normal();
+    if (relative.is_absolute() || relative.has_root_name() || (!relative.empty() && *relative.begin() == "..")) {
+      return Fail("Entry escapes the install directory: " + name);
+    }
+    entry.name = name;
+    entry.path = m_output_path / relative;
+    entry.remaining = entry.compressed_size;
+    m_entry = std::move(entry);
+
+    if (name.ends_with('/')) {
+      std::error_code ec;
+      std::filesystem::create_directories(m_entry.path, ec);
+      if (ec) return Fail("Failed to create directory: " + m_entry.path.string());
+      m_entry.directory = true;
+      if (m_entry.flags & FLAG_DATA_DESCRIPTOR) {
+        // streaming zippers (Java's ZipOutputStream for one) write a directory as a deflate stream of unknown size
+        // followed by a data descriptor, only inflating it finds where it ends. A stored one has no data at all
+        m_running_crc = crc32(0L, Z_NULL, 0);
+        if (m_entry.method == METHOD_STORED) {
+          m_stage = Stage::DataDescriptor;
+          return true;
+        }
+        if (!ResetInflate()) return false;
+        m_stage = Stage::EntryData;
+        return true;
+      }
+      // some archivers store an empty deflate stream for directories, which may not have fully arrived yet
+      m_stage = Stage::SkipData;
+      return true;
+    }
+
+    if (!OpenEntry()) return false;
+    m_stage = Stage::EntryData;
+    return true;
+  }
+
+  bool ZipStreamExtractor::OpenEntry() {
+    std::error_code ec;
+    std::filesystem::create_directories(m_entry.path.parent_path(), ec);
+
+    m_file = std::ofstream();
+    m_file.rdbuf()->pubsetbuf(m_file_buffer.data(), static_cast<std::streamsize>(m_file_buffer.size()));
+    m_file.open(m_entry.path, std::ios::binary | std::ios::trunc);
+    if (!m_file) {
+      return Fail("Failed to open output file: " + m_entry.path.string());
+    }
+
+    m_running_crc = crc32(0L, Z_NULL, 0);
+    return m_entry.method != METHOD_DEFLATED || ResetInflate();
+  }
+
+  bool ZipStreamExtractor::ResetInflate() {
+    if (m_inflate_ready) {
+      if (inflateReset(&m_inflate) != Z_OK) return Fail("Failed to reset inflate stream");
+    } else {
+      m_inflate = z_stream{};
+      if (inflateInit2(&m_inflate, -MAX_WBITS) != Z_OK) return Fail("Failed to initialize inflate stream");
+      m_inflate_ready = true;
+    }
+    return true;
+  }
+
+  bool ZipStreamExtractor::WriteOutput(const uint8_t *data, const size_t size) {
+    if (size == 0) return true;
+    if (m_entry.directory) return Fail("Directory entry has contents: " + m_entry.name);
+    m_running_crc = crc32(m_running_crc, data, static_cast<uInt>(size));
+    m_entry.written += size;
+    m_file.write(reinterpret_cast<const char *>(data), static_cast<std::streamsize>(size));
+    if (m_file.bad()) {
+      return Fail("Failed to write output file: " + m_entry.path.string());
+    }
+    return true;
+  }
+
+  bool ZipStreamExtractor::ConsumeStored() {
+    const auto chunk = static_cast<size_t>(std::min<uint64_t>(m_entry.remaining, Available()));
+    if (!WriteOutput(Cursor(), chunk)) return false;
+    m_pending_offset += chunk;
+    m_entry.remaining -= chunk;
+
+    if (m_entry.remaining == 0) {
+      return FinishEntry(m_entry.crc);
+    }
+    return true;
+  }
+
+  void ZipStreamExtractor::SkipData() {
+    const auto chunk = static_cast<size_t>(std::min<uint64_t>(m_entry.remaining, Available()));
+    m_pending_offset += chunk;
+    m_entry.remaining -= chunk;
+    if (m_entry.remaining == 0) m_stage = Stage::LocalHeader;
+  }
+
+  bool ZipStreamExtractor::ConsumeDeflated() {
+    // with a data descriptor the compressed size is unknown, the deflate stream marks its own end
+    const bool bounded = !(m_entry.flags & FLAG_DATA_DESCRIPTOR);
+    const size_t input =
+        bounded ? static_cast<size_t>(std::min<uint64_t>(m_entry.remaining, Available())) : Available();
+    if (input == 0) return true;
+
+    m_inflate.next_in = const_cast<Bytef *>(Cursor());
+    m_inflate.avail_in = static_cast<uInt>(std::min<size_t>(input, UINT32_MAX));
+
+    int ret;
+    do {
+      m_inflate.next_out = m_out_buffer.data();
+      m_inflate.avail_out = static_cast<uInt>(m_out_buffer.size());
+
+      ret = inflate(&m_inflate, Z_NO_FLUSH);
+      if (ret != Z_OK && ret != Z_STREAM_END && ret != Z_BUF_ERROR) {
+        return Fail("Corrupt compressed data in entry: " + m_entry.path.string());
+      }
+      if (!WriteOutput(m_out_buffer.data(), m_out_buffer.size() - m_inflate.avail_out)) return false;
+    } while (ret != Z_STREAM_END && m_inflate.avail_out == 0);
+
+    const size_t consumed = static_cast<size_t>(m_inflate.next_in - Cursor());
+    m_pending_offset += consumed;
+    if (bounded) m_entry.remaining -= consumed;
+
+    if (ret == Z_STREAM_END) {
+      if (m_entry.flags & FLAG_DATA_DESCRIPTOR) {
+        // the CRC in the descriptor only covers what was handed to the stream, a failed final flush has to be caught
+        if (m_file.is_open()) {
+          m_file.close();
+          if (m_file.fail()) return Fail("Failed to flush output file: " + m_entry.path.string());
+        }
+        m_stage = Stage::DataDescriptor;
+        return true;
+      }
+      // skip any padding the compressor may have left inside the declared size
+      m_pending_offset += static_cast<size_t>(std::min<uint64_t>(m_entry.remaining, Available()));
+      return FinishEntry(m_entry.crc);
+    }
+    if (bounded && m_entry.remaining == 0) {
+      return Fail("Compressed data ended early in entry: " + m_entry.path.string());
+    }
+    return true;
+  }
+
+  bool ZipStreamExtractor::ConsumeDataDescriptor() {
+    const size_t size_fields = m_entry.zip64 ? 16 : 8;
+    if (Available() < 4) return true;
+
+    const bool has_signature = ReadU32(Cursor()) == DATA_DESCRIPTOR_SIGNATURE;
+    const size_t descriptor_size = (has_signature ? 4 : 0) + 4 + size_fields;
+    if (Available() < descriptor_size) return true;
+
+    const uint32_t crc = ReadU32(Cursor() + (has_signature ? 4 : 0));
+    m_pending_offset += descriptor_size;
+    return FinishEntry(crc);
+  }
+
+  bool ZipStreamExtractor::FinishEntry(const uint32_t expected_crc) {
+    if (m_file.is_open()) {
+      m_file.close();
+      if (m_file.fail()) return Fail("Failed to flush output file: " + m_entry.path.string());
+    }
+    if (m_running_crc != expected_crc) {
+      return Fail("CRC mismatch in entry: " + m_entry.path.string());
+    }
+    m_stage = Stage::LocalHeader;
+    if (m_entry.directory) return true;
+
+    if (const auto record = InstallManifest::StampFile(m_entry.path, m_entry.written, expected_crc, m_entry.dos_date)) {
+      m_manifest.insert_or_assign(InstallManifest::Key(m_entry.name), record.value());
+    }
+    ++m_entries_written;
+    return true;
+  }
+
+  bool ZipStreamExtractor::Fail(const std::string &message) {
+    std::cerr << "ZipStreamExtractor: " << message << std::endl;
+    if (m_file.is_open()) m_file.close();
+    m_error = message;
+    m_stage = Stage::Failed;
+    return false;
+  }
+}  // namespace Infinity
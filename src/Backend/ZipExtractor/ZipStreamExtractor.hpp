@@ -0,0 +1,103 @@
+#pragma once
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "Backend/ZipExtractor/InstallManifest.hpp"
+#include "zlib.h"
+
+namespace Infinity {
+  /**
+   * Extracts a ZIP archive while its bytes are still arriving.
+   *
+   * Bytes are pushed in order through Feed() (usually straight from the network) and every entry is inflated into
+   * its final location as soon as its data is available, so the archive never has to be written to disk and read back.
+   * Parsing stops at the central directory, which is not needed when walking the local headers front to back.
+   *
+   * Every file written is recorded in the same InstallManifest ZipExtractor keeps, so a later incremental update can
+   * trust and prune a streamed install just like an extracted one.
+   */
+  class ZipStreamExtractor {
+public:
+    explicit ZipStreamExtractor(const std::string &output_path);
+    ~ZipStreamExtractor();
+
+    ZipStreamExtractor(const ZipStreamExtractor &) = delete;
+    ZipStreamExtractor &operator=(const ZipStreamExtractor &) = delete;
+
+    /**
+     * Push the next chunk of the archive
+     * @return false once the stream is found to be corrupt or a file could not be written
+     */
+    bool Feed(const uint8_t *data, size_t size);
+
+    /**
+     * Call after the last chunk has been fed
+     * @return true if every entry was extracted and verified
+     */
+    bool Finish();
+
+    [[nodiscard]] bool Failed() const { return m_stage == Stage::Failed; }
+    [[nodiscard]] const std::string &GetError() const { return m_error; }
+    [[nodiscard]] size_t GetEntriesWritten() const { return m_entries_written; }
+
+private:
+    enum class Stage { LocalHeader, EntryData, SkipData, DataDescriptor, Done, Failed };
+
+    struct Entry {
+      std::filesystem::path path;
+      uint16_t flags = 0;
+      uint16_t method = 0;
+      std::string name;
+      uint32_t crc = 0;
+      uint32_t dos_date = 0;
+      uint64_t compressed_size = 0;
+      uint64_t remaining = 0;
+      uint64_t written = 0;  // uncompressed bytes, the header size is unknown when a data descriptor follows
+      bool zip64 = false;
+      bool directory = false;  // only read through to find the next header, nothing is written or recorded
+    };
+
+    bool ParseLocalHeader();
+    bool ConsumeStored();
+    bool ConsumeDeflated();
+    void SkipData();
+    bool ConsumeDataDescriptor();
+
+    bool OpenEntry();
+    bool ResetInflate();
+    bool FinishEntry(uint32_t expected_crc);
+    bool WriteOutput(const uint8_t *data, size_t size);
+
+    bool Fail(const std::string &message);
+    void SaveManifest();
+
+    [[nodiscard]] size_t Available() const { return m_pending.size() - m_pending_offset; }
+    [[nodiscard]] const uint8_t *Cursor() const { return m_pending.data() + m_pending_offset; }
+
+private:
+    std::filesystem::path m_output_path;
+    Stage m_stage = Stage::LocalHeader;
+    std::string m_error;
+
+    std::vector<uint8_t> m_pending;
+    size_t m_pending_offset = 0;
+
+    Entry m_entry;
+    std::ofstream m_file;
+    std::vector<char> m_file_buffer;
+    uint32_t m_running_crc = 0;
+
+    z_stream m_inflate{};
+    bool m_inflate_ready = false;
+    std::vector<uint8_t> m_out_buffer;
+
+    size_t m_entries_written = 0;
+    InstallManifest::Records m_manifest;
+
+    static constexpr size_t OUT_CHUNK_SIZE = 256 * 1024;
+    static constexpr size_t FILE_BUFFER_SIZE = 1024 * 1024;
+  };
+}  // namespace Infinity
@@ -26,20 +26,29 @@ namespace Infinity {
       , m_window_size({0.0f, 0.0f})
       , m_window_pos({0.0f, 0.0f})
       , m_home_page(true)
-      , m_dot_opacity(0.3f)
-      , m_target_dot_opacity(0.3f)
+      , m_dot_opacity(Tweens::GetInstance().Create(0.3f))
 
   {
     if (s_circle_pos.empty()) {
       s_circle_pos.resize(5);
     }
+
+    // the circles drift around their anchors, alternating direction. Ambient, so they do not keep the app awake
+    auto &tweens = Tweens::GetInstance();
+    for (size_t i = 0; i < m_circle_angles.size(); ++i) {
+      m_circle_angles[i] = tweens.Create(0.0f);
+      if (i % 2 == 0) {
+        tweens.Loop(m_circle_angles[i], 360.0f, 0.0f, CIRCLE_DEGREES_PER_SECOND, false);
+      } else {
+        tweens.Loop(m_circle_angles[i], 0.0f, 360.0f, CIRCLE_DEGREES_PER_SECOND, false);
+      }
+    }
   }
 
   void Background::RenderBackground() {
     m_window_pos = ImGui::GetWindowPos();
     m_window_size = ImGui::GetWindowSize();
 
-    UpdateDotOpacity();
     RenderBackgroundBaseLayer();
     RenderBackgroundGradientLayer();
     RenderBackgroundDotsLayer();
@@ -88,22 +97,8 @@ namespace Infinity {
     }
   }
 
-  void Background::SetDotOpacity(const float opacity) { m_target_dot_opacity = opacity; }
-
-  void Background::UpdateDotOpacity() {
-    constexpr float transitionSpeed = 0.003f;
-
-    if (m_dot_opacity < m_target_dot_opacity) {
-      m_dot_opacity += transitionSpeed;
-      if (m_dot_opacity > m_target_dot_opacity) {
-        m_dot_opacity = m_target_dot_opacity;
-      }
-    } else if (m_dot_opacity > m_target_dot_opacity) {
-      m_dot_opacity -= transitionSpeed;
-      if (m_dot_opacity < m_target_dot_opacity) {
-        m_dot_opacity = m_target_dot_opacity;
-      }
-    }
+  void Background::SetDotOpacity(const float opacity) {
+    Tweens::GetInstance().Approach(m_dot_opacity, opacity, DOT_OPACITY_PER_SECOND);
   }
 
 
@@ -115,6 +110,7 @@ namespace Infinity {
     constexpr float y_center = texture_size / 2.0f;
     constexpr float radius = 1.0f;
     constexpr float aa_width = 1.0f;
+    const float dot_opacity = Tweens::GetInstance().Get(m_dot_opacity);
 
     for (int y = 0; y < texture_size; ++y) {
       for (int x = 0; x < texture_size; ++x) {
@@ -136,7 +132,7 @@ namespace Infinity {
           texture_data[index + 0] = 255;
           texture_data[index + 1] = 255;
           texture_data[index + 2] = 255;
-          texture_data[index + 3] = static_cast<unsigned char>(alpha * m_dot_opacity * 255.0f);
+          texture_data[index + 3] = static_cast<unsigned char>(alpha * dot_opacity * 255.0f);
         }
       }
     }
@@ -163,7 +159,7 @@ namespace Infinity {
     const auto offsetPosition = ImVec2(m_window_pos.x + 10, m_window_pos.y + 10);
     const float windowWidth = ImGui::GetWindowWidth();
     const float windowHeight = ImGui::GetWindowHeight();
-    const auto color = ImColor(1.0f, 1.0f, 1.0f, m_dot_opacity);
+    const auto color = ImColor(1.0f, 1.0f, 1.0f, Tweens::GetInstance().Get(m_dot_opacity));
 
     const ImVec2 uv_min(10.0f / 15.0f, 10.0f / 15.0f);
     const ImVec2 uv_max(uv_min.x + windowWidth / 15.0f, uv_min.y + windowHeight / 15.0f);
@@ -175,12 +171,6 @@ namespace Infinity {
 
 
   void Background::RenderBackgroundGradientLayer() {
-    static float circle1angle = 0.0f;
-    static float circle2angle = 0.0f;
-    static float circle3angle = 0.0f;
-    static float circle4angle = 0.0f;
-    static float circle5angle = 0.0f;
-
     TrySetDefaultPositions();
 
 
@@ -196,26 +186,12 @@ namespace Infinity {
                          ImColor(m_circle_color5));
 
 
-    if (circle1angle - 0.05f < 0.0f)
-      circle1angle = 360.0f;
-    else
-      circle1angle -= 0.05f;
-    if (circle2angle + 0.05f > 360)
-      circle2angle = 0;
-    else
-      circle2angle += 0.05f;
-    if (circle3angle - 0.05f < 0.0f)
-      circle3angle = 360.0f;
-    else
-      circle3angle -= 0.05f;
-    if (circle4angle + 0.05f > 360)
-      circle4angle = 0;
-    else
-      circle4angle += 0.05f;
-    if (circle5angle - 0.05f < 360)
-      circle5angle = 0;
-    else
-      circle5angle -= 0.05f;
+    auto &tweens = Tweens::GetInstance();
+    const float circle1angle = tweens.Get(m_circle_angles[0]);
+    const float circle2angle = tweens.Get(m_circle_angles[1]);
+    const float circle3angle = tweens.Get(m_circle_angles[2]);
+    const float circle4angle = tweens.Get(m_circle_angles[3]);
+    const float circle5angle = tweens.Get(m_circle_angles[4]);
 
     const auto screen_center = ImVec2(ImGui::GetWindowSize().x / 2.0f, ImGui::GetWindowSize().y / 2.0f);
 
@@ -2,12 +2,14 @@
 #pragma once
 
 
+#include <array>
 #include <cmath>
 
 #include "GL/glew.h"
 //
 #include "Frontend/ColorInterpolation/ColorInterpolation.hpp"
 #include "GL/gl.h"
+#include "Util/Tween/Tween.hpp"
 #include "imgui.h"
 #include "vector"
 
@@ -63,8 +65,6 @@ public:
 
 
 private:
-    void UpdateDotOpacity();
-
     void RenderBackgroundDotsLayer();
 
     void RenderBackgroundGradientLayer();
@@ -94,6 +94,10 @@ private:
 
     void CreateDotTexture();
 
+    // the speeds the per frame steps used to have at the default 144 fps cap
+    static constexpr float CIRCLE_DEGREES_PER_SECOND = 7.2f;
+    static constexpr float DOT_OPACITY_PER_SECOND = 0.432f;
+
 private:
     ImVec2 m_window_pos;
     ImVec2 m_window_size;
@@ -105,8 +109,8 @@ private:
     ImVec4 m_circle_color4;
     ImVec4 m_circle_color5;
     bool m_home_page;
-    float m_dot_opacity;
-    float m_target_dot_opacity;
+    Tweens::Handle m_dot_opacity;
+    std::array<Tweens::Handle, 5> m_circle_angles;
     ImTextureID m_dot_texture = nullptr;
   };
 
@@ -1,82 +1,115 @@
 #include "Meteors.hpp"
 
-#include <cmath>
-#include <ctime>
-#include <imgui.h>
+#include <algorithm>
 #include <imgui_internal.h>
 #include <random>
-#include <vector>
 
-namespace Infinity {
-  void Meteor::Respawn(const ImVec2 screen_size) {
-    std::uniform_real_distribution pos_dist(-500.0f, 500.0f);
+#include "Util/Tween/Tween.hpp"
 
-    if (RandomRange(0.0f, 1.0f) > 0.5f) {
-      position = ImVec2(-100.0f - std::abs(pos_dist(GetRNG())), RandomRange(-100.0f, screen_size.y + 200.0f));
-    } else {
-      position = ImVec2(RandomRange(-100.0f, screen_size.x + 200.0f), -100.0f - std::abs(pos_dist(GetRNG())));
+namespace Infinity {
+  Meteors::Meteors(const int count)
+      : m_seed(std::random_device()())
+      , m_screen_size(ImGui::GetIO().DisplaySize) {
+    const auto size = static_cast<size_t>(std::max(count, 0));
+    m_x.resize(size);
+    m_y.resize(size);
+    m_speed.resize(size);
+    m_length.resize(size);
+    for (size_t i = 0; i < size; i++) {
+      Respawn(i, m_screen_size);
     }
-    speed = RandomRange(0.8f, 1.4f);
-
-    length = 80.0f + RandomRange(0.0f, 120.0f);
-    thickness = 0.5f;
-
-    start_color = ImColor(200, 200, 255, 255);
-    end_color = ImColor(200, 200, 255, 0);
   }
 
-  void Meteor::Update(const ImVec2 screen_size) {
-    position.x += speed;
-    position.y += speed;
-
-    if (position.x > screen_size.x + 500 || position.y > screen_size.y + 500) {
-      Respawn(screen_size);
-    }
+  float Meteors::Random(const float min, const float max) {
+    // splitmix64 of the sequence number, good enough for scattering meteors and a handful of instructions
+    uint64_t z = m_seed + ++m_counter * 0x9E3779B97F4A7C15ull;
+    z = (z ^ z >> 30) * 0xBF58476D1CE4E5B9ull;
+    z = (z ^ z >> 27) * 0x94D049BB133111EBull;
+    z ^= z >> 31;
+    const float unit = static_cast<float>(z >> 40) * 0x1.0p-24f;
+    return min + (max - min) * unit;
   }
 
-  void Meteor::Render() const {
-    ImDrawList* draw_list = ImGui::GetWindowDrawList();
-    const auto end_pos = ImVec2(position.x - length, position.y - length);
-
-    constexpr int tail_segments = 28;
-    for (int i = 1; i < tail_segments; i++) {
-      const float alpha = 1.0f - static_cast<float>(i) / tail_segments;
-      ImVec2 tail_start = ImLerp(position, end_pos, (i - 1.0f) / tail_segments);
-      ImVec2 tail_end = ImLerp(position, end_pos, static_cast<float>(i) / tail_segments);
-
-      draw_list->AddLine(tail_end, tail_start,
-                         ImColor(start_color.Value.x, start_color.Value.y, start_color.Value.z, alpha),
-                         thickness * alpha);
+  void Meteors::Respawn(const size_t index, const ImVec2 screen_size) {
+    // off screen above or to the left, far enough out that they do not all arrive at once
+    const float offset = -100.0f - Random(0.0f, 500.0f);
+    if (Random(0.0f, 1.0f) > 0.5f) {
+      m_x[index] = offset;
+      m_y[index] = Random(-100.0f, screen_size.y + 200.0f);
+    } else {
+      m_x[index] = Random(-100.0f, screen_size.x + 200.0f);
+      m_y[index] = offset;
     }
-
-    draw_list->AddCircleFilled(position, thickness * 1.5f, ImColor(200, 200, 255, 255));
+    m_speed[index] = Random(MIN_SPEED, MAX_SPEED);
+    m_length[index] = 80.0f + Random(0.0f, 120.0f);
   }
 
-
   void Meteors::Update() {
-    ImVec2 screen_size = ImGui::GetWindowSize();
-    for (auto& meteor: m_meteors) {
-      meteor.Update(screen_size);
+    m_screen_size = ImGui::GetWindowSize();
+    const float dt = ImGui::GetIO().DeltaTime;
+    const size_t count = m_x.size();
+    float* x = m_x.data();
+    float* y = m_y.data();
+    const float* speed = m_speed.data();
+
+    for (size_t i = 0; i < count; i++) {
+      const float step = speed[i] * dt;
+      x[i] += step;
+      y[i] += step;
     }
-  }
 
-  void Meteors::Render() {
-    for (const auto& meteor: m_meteors) {
-      meteor.Render();
+    const float max_x = m_screen_size.x + 500.0f;
+    const float max_y = m_screen_size.y + 500.0f;
+    for (size_t i = 0; i < count; i++) {
+      if (x[i] > max_x || y[i] > max_y) Respawn(i, m_screen_size);
     }
-  }
-
 
-  std::vector<Meteor> meteors;
-  int count;
+    // moving every frame, so the app should not drop to its idle frame rate while they are on screen
+    Tweens::GetInstance().RequestFrame();
+  }
 
-  Meteors::Meteors(const int count)
-      : m_count(count) {
-    std::srand(static_cast<unsigned>(std::time(nullptr)));
-    ImVec2 screen_size = ImGui::GetIO().DisplaySize;
-    meteors.reserve(m_count);
-    for (int i = 0; i < m_count; i++) {
-      meteors.emplace_back(screen_size);
+  void Meteors::Render() {
+    ImDrawList* draw_list = ImGui::GetWindowDrawList();
+    const ImVec2 uv = draw_list->_Data->TexUvWhitePixel;
+    constexpr ImU32 head_color = IM_COL32(200, 200, 255, 255);
+    constexpr ImU32 clear_color = IM_COL32(200, 200, 255, 0);
+
+    // everything moves along (1, 1), so every tail shares one normal. The edges are transparent, which gives the
+    // anti-aliasing fringe ImGui would otherwise add per line
+    constexpr float fringe = 1.0f;
+    constexpr float half_width = THICKNESS * 0.5f + fringe;
+    constexpr float head_radius = THICKNESS * 1.5f + fringe;
+    constexpr float normal = 0.70710678f;
+
+    // per meteor: a tail narrowing from the head to a point, and a diamond for the head
+    constexpr int vertices = 4 + 5;
+    constexpr int indices = 6 + 12;
+
+    const size_t count = m_x.size();
+    for (size_t first = 0; first < count; first += BATCH_SIZE) {
+      const size_t last = std::min(count, first + BATCH_SIZE);
+      draw_list->PrimReserve(static_cast<int>(last - first) * indices, static_cast<int>(last - first) * vertices);
+
+      for (size_t i = first; i < last; i++) {
+        const ImVec2 head(m_x[i], m_y[i]);
+        const ImVec2 tail(head.x - m_length[i], head.y - m_length[i]);
+        const auto base = static_cast<ImDrawIdx>(draw_list->_VtxCurrentIdx);
+
+        const ImDrawIdx tail_indices[] = {0, 1, 3, 0, 3, 2};
+        for (const ImDrawIdx index: tail_indices) draw_list->PrimWriteIdx(static_cast<ImDrawIdx>(base + index));
+        draw_list->PrimWriteVtx(head, uv, head_color);
+        draw_list->PrimWriteVtx({head.x - normal * half_width, head.y + normal * half_width}, uv, clear_color);
+        draw_list->PrimWriteVtx({head.x + normal * half_width, head.y - normal * half_width}, uv, clear_color);
+        draw_list->PrimWriteVtx(tail, uv, clear_color);
+
+        const ImDrawIdx head_indices[] = {4, 5, 6, 4, 6, 7, 4, 7, 8, 4, 8, 5};
+        for (const ImDrawIdx index: head_indices) draw_list->PrimWriteIdx(static_cast<ImDrawIdx>(base + index));
+        draw_list->PrimWriteVtx(head, uv, head_color);
+        draw_list->PrimWriteVtx({head.x + head_radius, head.y}, uv, clear_color);
+        draw_list->PrimWriteVtx({head.x, head.y + head_radius}, uv, clear_color);
+        draw_list->PrimWriteVtx({head.x - head_radius, head.y}, uv, clear_color);
+        draw_list->PrimWriteVtx({head.x, head.y - head_radius}, uv, clear_color);
+      }
     }
-  };
+  }
 }  // namespace Infinity
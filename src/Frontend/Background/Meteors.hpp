@@ -1,41 +1,16 @@
 #pragma once
-#include <cmath>
-#include <ctime>
+#include <cstdint>
 #include <imgui.h>
-#include <imgui_internal.h>
-#include <random>
 #include <vector>
 
 namespace Infinity {
-  struct Meteor {
-    ImVec2 position;
-    float speed{};
-    float length{};
-    float thickness{};
-    ImColor start_color;
-    ImColor end_color;
-
-    explicit Meteor(const ImVec2 screen_size) { Respawn(screen_size); }
-
-    static std::mt19937& GetRNG() {
-      static std::random_device rd;
-      static std::mt19937 gen(rd());
-      return gen;
-    }
-
-    template<typename T>
-    static T RandomRange(T min, T max) {
-      std::uniform_real_distribution<T> dist(min, max);
-      return dist(GetRNG());
-    }
-
-    void Respawn(ImVec2 screen_size);
-
-    void Update(ImVec2 screen_size);
-
-    void Render() const;
-  };
-
+  /**
+   * Meteors streaking diagonally across the window.
+   *
+   * Each attribute is its own array, so the update is a few flat loops the compiler can vectorize, and the whole
+   * shower is written into the window's draw list as one batch of vertices instead of a line per tail segment.
+   * Respawn positions come from a counter based hash, there is no generator state to carry between meteors.
+   */
   class Meteors {
 public:
     static Meteors* GetInstance(const int count = 100) {
@@ -43,14 +18,31 @@ public:
       return &instance;
     }
 
+    // move every meteor by the frame's delta time, the ones that left the window come back at a new spot
     void Update();
 
     void Render();
 
 private:
-    std::vector<Meteor> m_meteors;
-    int m_count;
-
     explicit Meteors(int count);
+
+    void Respawn(size_t index, ImVec2 screen_size);
+    // uniform in [min, max), the next value of the hash sequence
+    float Random(float min, float max);
+
+    static constexpr float MIN_SPEED = 115.0f;  // pixels per second along each axis
+    static constexpr float MAX_SPEED = 200.0f;
+    static constexpr float THICKNESS = 0.5f;
+    static constexpr int BATCH_SIZE = 4096;  // meteors per PrimReserve, keeps 16 bit indices in range
+
+private:
+    std::vector<float> m_x;
+    std::vector<float> m_y;
+    std::vector<float> m_speed;
+    std::vector<float> m_length;
+
+    uint64_t m_seed;
+    uint64_t m_counter = 0;
+    ImVec2 m_screen_size;
   };
 }  // namespace Infinity
@@ -1,16 +1,13 @@
 #pragma once
 
-#include <algorithm>
-#include <chrono>
+#include <array>
+#include <cstddef>
 #include <tuple>
-#include <utility>
 
 #include "Util/Easing/Easing.hpp"
+#include "Util/Tween/Tween.hpp"
 #include "imgui.h"
 
-using Clock = std::chrono::steady_clock;
-using TimePoint = std::chrono::time_point<Clock>;
-
 class ColorInterpolation {
   public:
   ColorInterpolation(const ColorInterpolation &) = delete;
@@ -43,10 +40,10 @@ class ColorInterpolation {
         , currentColor(current) {}
   };
 
-  std::tuple<Interpolation, Interpolation, Interpolation, Interpolation, Interpolation, Interpolation, Interpolation>
-      m_colors;
+  static constexpr std::size_t COLOR_COUNT = 7;
+
+  std::array<Interpolation, COLOR_COUNT> m_colors;
 
-  float m_duration;
-  TimePoint m_start_time;
-  bool m_active;
+  // linear 0 - 1 progress of the current transition, eased when the colors are read
+  Infinity::Tweens::Handle m_progress;
 };
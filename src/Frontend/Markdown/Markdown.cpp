@@ -476,7 +476,9 @@ namespace Infinity {
                    {Application::GetFont("h3"), true}},
                   nullptr}) {}
 
-  void Markdown::Render(const std::string &text) const { ImGui::MarkdownRenderer(text.c_str(), text.size(), m_Config); }
+  void Markdown::Render(const std::string_view text) const {
+    ImGui::MarkdownRenderer(text.data(), text.size(), m_Config);
+  }
 
 
   void Markdown::LinkCallback(ImGui::MarkdownLinkCallbackData data) {
@@ -6,6 +6,7 @@
 #include <cstdint>
 #include <imgui.h>
 #include <string>
+#include <string_view>
 #ifdef WIN32
 #include <Windows.h>
 #endif
@@ -164,7 +165,7 @@ inline void OpenUrlInBrowser(std::string &url) {
 namespace Infinity {
   class Markdown {
 public:
-    void Render(const std::string &text) const;
+    void Render(std::string_view text) const;
     static Markdown *GetInstance() {
       if (instance == nullptr) {
         instance = new Markdown();
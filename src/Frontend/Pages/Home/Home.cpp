@@ -35,16 +35,12 @@ namespace Infinity {
     }
   }
 
-  void Home::RegisterProject(const std::string &name, std::shared_ptr<Image> image, std::shared_ptr<Image> logo,
-                             const int page_id) {
+  void Home::RegisterProject(const std::string &name, std::shared_ptr<LazyImage> image,
+                             std::shared_ptr<LazyImage> logo, const int page_id) {
     m_HomeProjectButtons.emplace_back(name, image, logo, page_id);
   }
 
-  void Home::RegisterProject(const std::vector<HomeProjectButtonStruct> &projects) {
-    // for (const auto &project: projects) {
-    // }
-    // m_HomeProjectButtons = projects;
-  }
+  void Home::RegisterProject(const std::vector<HomeProjectButtonStruct> &projects) { m_HomeProjectButtons = projects; }
 
   void Home::UnregisterProject(const std::string &name) {
     for (int i = 0; i < m_HomeProjectButtons.size(); i++) {
@@ -144,14 +140,17 @@ namespace Infinity {
     const bool clicked = ImGui::InvisibleButton(project.name.c_str(), size);
 
     const bool is_hovered = ImGui::IsItemHovered();
+    if (is_hovered && project.on_hover) {
+      project.on_hover();
+    }
 
-    Image::RenderHomeImage(project.image, position, size, is_hovered);
-    Image::RenderImage(project.logo, logo_position, logo_size);
+    if (project.image) Image::RenderHomeImage(project.image->Get(), position, size, is_hovered);
+    if (project.logo) Image::RenderImage(project.logo->Get(), logo_position, logo_size);
 
     if (clicked) {
       if (const auto router = Utils::Router::getInstance(); router.has_value()) {
         ProjectPage::ResetState();
-        if (auto result = (*router)->setPage(page_index); !result.has_value()) {
+        if (auto result = (*router)->setPage(project.page_id); !result.has_value()) {
           Errors::Error(result.error()).Dispatch();
         }
       }
@@ -1,27 +1,31 @@
 
 #pragma once
 
+#include <functional>
 #include <memory>
 #include <string>
 #include <utility>
 #include <vector>
 
 #include "Backend/Image/Image.hpp"
+#include "Backend/Image/LazyImage.hpp"
 
 namespace Infinity {
 
   struct HomeProjectButtonStruct {
     std::string name;
-    std::shared_ptr<Image> image;
-    std::shared_ptr<Image> logo;
+    std::shared_ptr<LazyImage> image;  // loaded when the card is first drawn
+    std::shared_ptr<LazyImage> logo;
     int page_id;
+    std::function<void()> on_hover;  // called every frame the card is hovered, used to prefetch the page behind it
 
-    HomeProjectButtonStruct(const std::string &name, std::shared_ptr<Image> image, std::shared_ptr<Image> logo,
-                            const int page_id)
+    HomeProjectButtonStruct(const std::string &name, std::shared_ptr<LazyImage> image,
+                            std::shared_ptr<LazyImage> logo, const int page_id, std::function<void()> on_hover = {})
         : name(name)
         , image(std::move(image))
         , logo(std::move(logo))
-        , page_id(page_id) {}
+        , page_id(page_id)
+        , on_hover(std::move(on_hover)) {}
   };
 
   class Home {
@@ -32,9 +36,10 @@ public:
     static bool DoneLoading() { return m_DoneLoading; };
     static void SetLoaded(const bool loaded) { m_DoneLoading = loaded; }
 
-    void RegisterProject(const std::string &name, std::shared_ptr<Image> image, std::shared_ptr<Image> logo,
+    void RegisterProject(const std::string &name, std::shared_ptr<LazyImage> image, std::shared_ptr<LazyImage> logo,
                          int page_id);
     void UnregisterProject(const std::string &name);
+    // replaces every registered project, render thread only once the home page is showing
     void RegisterProject(const std::vector<HomeProjectButtonStruct> &projects);
     void UnregisterProject(const std::vector<std::string> &projects);
 
@@ -1,55 +1,86 @@
 
 #include "Project.hpp"
 
+#include <algorithm>
 #include <imgui.h>
 #include <utility>
 
 #include "Backend/Image/Image.hpp"
+#include "Backend/Image/LazyImage.hpp"
 #include "Backend/Image/SvgImage.hpp"
 #include "Backend/Installer/Installer.hpp"
 #include "Backend/Notifications/Notifications.hpp"
+#include "Backend/ProjectDetails/ProjectDetails.hpp"
 #include "Frontend/Markdown/Markdown.hpp"
-#include "Util/State/State.hpp"
 
 namespace Infinity {
 
   std::shared_ptr<uint8_t> ProjectPage::m_SelectedAircraft = std::make_shared<uint8_t>(0);
   std::shared_ptr<uint8_t> ProjectPage::m_SelectedPage = std::make_shared<uint8_t>(0);
 
-  ProjectPage::ProjectPage(const std::shared_ptr<GroupData> &group_data,
-                           const std::shared_ptr<GroupDataImages> &state_images)
-      : m_GroupData(group_data)
-      , m_StateImages(state_images)
-      , m_ContentRegion(m_GroupData, m_SelectedPage, m_SelectedAircraft)
-      , m_TopRegion(m_GroupData, m_StateImages, m_SelectedAircraft) {}
-
+  ProjectPage::ProjectPage(const std::shared_ptr<MainState> &state, std::string group_key)
+      : m_State(state)
+      , m_GroupKey(std::move(group_key)) {}
+
+  void ProjectPage::Bind(const CatalogSnapshot &snapshot) {
+    m_Version = snapshot.version;
+    m_Prefetched.reset();
+    m_Group = snapshot.index->FindGroup(m_GroupKey);
+    if (m_Group == CatalogIndex::INVALID_GROUP) {
+      m_ContentRegion.reset();
+      m_TopRegion.reset();
+      return;
+    }
+    const uint64_t revision = snapshot.index->GetGroup(m_Group).revision;
+    if (m_TopRegion && m_ContentRegion && revision == m_Revision) {
+      // the refresh did not touch this group, keep the widgets and just move them onto the new catalog
+      m_TopRegion->Retarget(snapshot.index, snapshot.images, m_Group);
+      m_ContentRegion->Retarget(snapshot.index, m_Group);
+      return;
+    }
+    m_Revision = revision;
+    // the selected project's details are requested when drawn, fetch the others before they get clicked
+    for (const auto &project: snapshot.index->GetProjects(m_Group)) {
+      if (!project.record->detail.empty()) ProjectDetails::GetInstance().Prefetch(project.record->detail);
+    }
+    m_ContentRegion.emplace(snapshot.index, m_Group, m_SelectedPage, m_SelectedAircraft);
+    m_TopRegion.emplace(snapshot.index, snapshot.images, m_Group, m_SelectedAircraft);
+  }
 
   void ProjectPage::Render() {
-    auto &state = State::GetInstance();
-    if (const auto main_state = state.GetPageState<MainState>("main"); main_state.has_value()) {
-      if (!m_StateImages->projectImages.empty()) {
+    const CatalogSnapshot *frame = m_State->GetFrame();
+    if (!frame) return;
+    if (frame->version != m_Version) Bind(*frame);
+    if (!m_TopRegion || !m_ContentRegion) return;
+
+    if (const auto &group = frame->index->GetGroup(m_Group); *m_SelectedAircraft < group.projectCount) {
 #ifdef WIN32
-        constexpr float top_padding = 40.0f;
+      constexpr float top_padding = 40.0f;
 #else
-        constexpr float top_padding = 0.0f;
+      constexpr float top_padding = 0.0f;
 #endif
-
-        // if (!m_StateImages->projectImages.empty() && m_StateImages->projectImages[0].pageBackgroundImage.has_value())
-        // {
-        //   Image::RenderImage(m_StateImages->projectImages[0].pageBackgroundImage.value(), {0.0f, top_padding},
-        //                      {ImGui::GetWindowWidth(), ImGui::GetWindowHeight() / 3.0f}, 0.3f);
-        //   m_TopRegion.Render();
-        //   m_ContentRegion.Render();
-        // } else if (m_StateImages->projectImages[0].backgroundImage) {
-        //   Image::RenderImage(m_StateImages->projectImages[0].backgroundImage, {0.0f, top_padding},
-        //                      {ImGui::GetWindowWidth(), ImGui::GetWindowHeight() / 3.0f}, 0.3f);
-        //   m_TopRegion.Render();
-        //   m_ContentRegion.Render();
-        // }
-        Image::RenderImage(m_StateImages->projectImages[*m_SelectedAircraft].backgroundImage, {0.0f, top_padding},
+      if (m_Prefetched != *m_SelectedAircraft) {
+        Prefetch(*frame, group, *m_SelectedAircraft);
+        m_Prefetched = *m_SelectedAircraft;
+      }
+      if (const auto &background = frame->images->projectBackgrounds[group.firstProject + *m_SelectedAircraft]) {
+        Image::RenderImage(background->Get(), {0.0f, top_padding},
                            {ImGui::GetWindowWidth(), ImGui::GetWindowHeight() / 3.0f}, 0.3f);
-        m_TopRegion.Render();
-        m_ContentRegion.Render();
+      }
+      m_TopRegion->Render();
+      m_ContentRegion->Render();
+    }
+  }
+
+
+  void ProjectPage::Prefetch(const CatalogSnapshot &snapshot, const IndexedGroup &group, const uint8_t selected) {
+    // the selected background is loaded by drawing it, warm up the ones the user is likely to click next
+    const int lookahead = LazyImage::GetPrefetchLookahead();
+    const int first = std::max(0, selected - lookahead);
+    const int last = std::min<int>(group.projectCount - 1, selected + lookahead);
+    for (int slot = first; slot <= last; ++slot) {
+      if (const auto &background = snapshot.images->projectBackgrounds[group.firstProject + slot]) {
+        background->Request();
       }
     }
   }
@@ -134,31 +165,42 @@ namespace Infinity {
     }
   }
 
-  TopRegion::TopRegion(const std::shared_ptr<GroupData> &group_data,
-                       const std::shared_ptr<GroupDataImages> &group_data_images,
+  TopRegion::TopRegion(const std::shared_ptr<const CatalogIndex> &index,
+                       const std::shared_ptr<const CatalogImages> &images, const GroupId group,
                        const std::shared_ptr<uint8_t> &selected_aircraft)
-      : m_GroupData(group_data)
-      , m_GroupDataImages(group_data_images)
-      , m_AircraftSelectButtonBar({}, selected_aircraft)
-      , m_SelectedAircraft(selected_aircraft) {
-    for (int32_t i = 0; i < group_data->projects.size(); i++) {
-      m_AircraftSelectButtons.emplace_back(AircraftSelectButton(group_data->projects[i].name, i, selected_aircraft));
+      : m_AircraftSelectButtonBar({}, selected_aircraft)
+      , m_SelectedAircraft(selected_aircraft)
+      , m_Index(index)
+      , m_Images(images)
+      , m_Group(group) {
+    for (const auto &project: m_Index->GetProjects(m_Group)) {
+      m_AircraftSelectButtons.emplace_back(m_Index->GetName(project.name), project.slot, selected_aircraft);
     }
     m_AircraftSelectButtonBar = AircraftSelectButtonBar(m_AircraftSelectButtons, selected_aircraft);
   }
 
+  void TopRegion::Retarget(const std::shared_ptr<const CatalogIndex> &index,
+                           const std::shared_ptr<const CatalogImages> &images, const GroupId group) {
+    m_Index = index;
+    m_Images = images;
+    m_Group = group;
+  }
+
   void TopRegion::Render() {
     ImGui::PushFont(Application::GetFont("BoldXLarge"));
     const float gap_text_logo = 10.0f;
     const ImVec2 logo_size(150.0f, 150.0f);
-    const auto text_size = ImGui::CalcTextSize(m_GroupData->name.c_str());
-    Image::RenderImage(m_GroupDataImages->logo,
-                       ImVec2(ImGui::GetWindowWidth() / 2 - text_size.x / 2 - logo_size.x / 2 - gap_text_logo,
-                              ImGui::GetWindowHeight() / 8 - logo_size.y / 2),
-                       logo_size);
+    const char *name = m_Index->GetName(m_Index->GetGroup(m_Group).name);
+    const auto text_size = ImGui::CalcTextSize(name);
+    if (const auto &logo = m_Images->groupLogos[m_Group]) {
+      Image::RenderImage(logo->Get(),
+                         ImVec2(ImGui::GetWindowWidth() / 2 - text_size.x / 2 - logo_size.x / 2 - gap_text_logo,
+                                ImGui::GetWindowHeight() / 8 - logo_size.y / 2),
+                         logo_size);
+    }
     ImGui::SetCursorPos(ImVec2(ImGui::GetWindowWidth() / 2 - text_size.x / 2 + logo_size.x / 2 + gap_text_logo,
                                ImGui::GetWindowHeight() / 8 - text_size.y / 2));
-    ImGui::Text("%s", m_GroupData->name.c_str());
+    ImGui::TextUnformatted(name);
     ImGui::PopFont();
     m_AircraftSelectButtonBar.Render();
   }
@@ -233,10 +275,11 @@ namespace Infinity {
     }
   }
 
-  ContentRegion::ContentRegion(const std::shared_ptr<GroupData> &group_data,
+  ContentRegion::ContentRegion(const std::shared_ptr<const CatalogIndex> &index, const GroupId group,
                                const std::shared_ptr<uint8_t> &selected_page,
                                const std::shared_ptr<uint8_t> &selected_aircraft)
-      : m_GroupData(group_data)
+      : m_Index(index)
+      , m_Group(group)
       , m_ButtonBar({}, selected_page)
       , m_SelectedPage(selected_page)
       , m_SelectedAircraft(selected_aircraft) {
@@ -246,13 +289,47 @@ namespace Infinity {
     m_ButtonBar = ContentRegionButtonBar({overview_button, description_button, changelog_button}, m_SelectedPage);
   }
 
+  void ContentRegion::Retarget(const std::shared_ptr<const CatalogIndex> &index, const GroupId group) {
+    m_Index = index;
+    m_Group = group;
+  }
+
+  std::optional<Groups::GroupVariants> ContentRegion::GetSelectedVariant() const {
+    const auto &group = m_Index->GetGroup(m_Group);
+    if (*m_SelectedAircraft >= group.projectCount) return std::nullopt;
+    const auto &project = m_Index->GetProject(group.firstProject + *m_SelectedAircraft);
+    return Groups::FindVariant(m_Index->GetName(group.name), m_Index->GetName(project.name));
+  }
+
   void ContentRegion::RenderInstalledWidget() {
-    ImGui::GetWindowDrawList()->AddRectFilled({40.0f, ImGui::GetWindowHeight() / 3.0f + 10.0f},
-                                              {200.0f, ImGui::GetWindowHeight() / 3.0f + 40.0f},
+    std::string status = "Not Installed";
+    float fraction = 0.0f;
+    const auto variant = GetSelectedVariant();
+    if (const auto progress = variant.has_value() ? Installer::GetInstance().GetInstallProgress(variant.value())
+                                                  : std::nullopt;
+        progress.has_value()) {
+      status = InstallPipeline::GetStageName(progress->stage);
+      if (!InstallPipeline::IsFinished(progress->stage)) {
+        fraction = progress->fraction;
+        status += " " + std::to_string(static_cast<int>(fraction * 100.0f)) + "%";
+        if (progress->eta_seconds >= 0.0) {
+          const int eta = static_cast<int>(progress->eta_seconds);
+          status += " - " + std::to_string(eta / 60) + "m " + std::to_string(eta % 60) + "s left";
+        }
+      }
+    }
+
+    const float top = ImGui::GetWindowHeight() / 3.0f + 10.0f;
+    const float width = std::max(160.0f, ImGui::CalcTextSize(status.c_str()).x + 10.0f);
+    ImGui::GetWindowDrawList()->AddRectFilled({40.0f, top}, {40.0f + width, top + 30.0f},
                                               ImGui::GetColorU32(ImVec4(0.0f, 0.0f, 0.0f, 0.5f)), 10.0f);
+    if (fraction > 0.0f) {
+      ImGui::GetWindowDrawList()->AddRectFilled({40.0f, top + 26.0f}, {40.0f + width * fraction, top + 30.0f},
+                                                ImGui::GetColorU32(ImVec4(1.0f, 1.0f, 1.0f, 0.6f)), 2.0f);
+    }
 
-    ImGui::GetWindowDrawList()->AddText({45.0f, ImGui::GetWindowHeight() / 3.0f + 10.0f + 5.0f},
-                                        ImGui::GetColorU32(ImVec4(1.0f, 1.0f, 1.0f, 0.6f)), "Not Installed");
+    ImGui::GetWindowDrawList()->AddText({45.0f, top + 5.0f}, ImGui::GetColorU32(ImVec4(1.0f, 1.0f, 1.0f, 0.6f)),
+                                        status.c_str());
   }
 
   bool ContentRegion::RenderDownloadButton(const char *label, ImVec2 size, ImVec2 pos) {
@@ -331,48 +408,70 @@ namespace Infinity {
   void ContentRegion::Render() {
     RenderInstalledWidget();
 
-    if (auto package = m_GroupData->projects[*m_SelectedAircraft].package; package.has_value()) {
-      std::string download_link = "https://github.com/" + package.value().owner + "/" + package.value().repoName +
-          "/releases/download/" + package.value().version + "/" + package.value().fileName;
-      auto download_label = "Download Version " + m_GroupData->projects[*m_SelectedAircraft].version;
+    const auto &group = m_Index->GetGroup(m_Group);
+    if (*m_SelectedAircraft >= group.projectCount) return;
+    const auto &project = m_Index->GetProject(group.firstProject + *m_SelectedAircraft);
+    const char *project_name = m_Index->GetName(project.name);
+
+    if (const auto *package = project.record->package) {
+      auto download_label = std::string("Download Version ") + m_Index->GetName(project.version);
       if (RenderDownloadButton(
               download_label.c_str(), {200.0f, 60.0f},
               {ImGui::GetWindowWidth() - 100.0f - 60.0f - 10.0f - 200.0f, ImGui::GetWindowHeight() / 3.0f + 50.0f})) {
-        std::cout << "Download button pressed for: " << download_link << std::endl;
-        Installer::GetInstance().PushDownload(download_link, Groups::DELTA_SIM::C17);
+        std::cout << "Download button pressed for: " << package->fileName << std::endl;
+        if (const auto variant = GetSelectedVariant(); variant.has_value()) {
+          Installer::GetInstance().PushPackage(ToPackage(*package), variant.value());
+        } else {
+          std::cerr << "No install variant is registered for " << project_name << std::endl;
+        }
       }
       if (RenderBugReportButton({120.0f, 60.0f},
                                 {ImGui::GetWindowWidth() - 60.0f - 100.0f, ImGui::GetWindowHeight() / 3.0f + 50.0f})) {
-        std::cout << "Bug report button pressed for: " << m_GroupData->projects[*m_SelectedAircraft].name << std::endl;
+        std::cout << "Bug report button pressed for: " << project_name << std::endl;
       }
     }
 
 
     ImGui::SetCursorPos({40.0f, ImGui::GetWindowHeight() / 3.0f + 50.0f});
     ImGui::PushFont(Application::GetFont("BoldXLarge"));
-    const auto header_size = ImGui::CalcTextSize(m_GroupData->projects[*m_SelectedAircraft].name.c_str());
-    ImGui::Text("%s", m_GroupData->projects[*m_SelectedAircraft].name.c_str());
+    ImGui::TextUnformatted(project_name);
     ImGui::PopFont();
     ImGui::SetCursorPosX(40.0f);
     ImGui::PushFont(Application::GetFont("Bold"));
-    const auto subheader_size = ImGui::CalcTextSize(m_GroupData->name.c_str());
-    ImGui::Text("%s", m_GroupData->name.c_str());
+    ImGui::TextUnformatted(m_Index->GetName(group.name));
     ImGui::PopFont();
     m_ButtonBar.Render();
 
 
+    std::string_view overview = project.record->overview;
+    std::string_view description = project.record->description;
+    std::string_view changelog = project.record->changelog;
+    std::shared_ptr<const ProjectDetails::Detail> detail;
+    if (!project.record->detail.empty()) {
+      detail = ProjectDetails::GetInstance().Get(project.record->detail);
+      if (!detail) {
+        ImGui::TextUnformatted(ProjectDetails::GetInstance().HasFailed(project.record->detail)
+                                   ? "Failed to load project details"
+                                   : "Loading...");
+        return;
+      }
+      overview = detail->overview;
+      description = detail->description;
+      changelog = detail->changelog;
+    }
+
     switch (*m_SelectedPage) {
       case 0: {
-        ImGui::Text("Overview: %s", m_GroupData->projects[*m_SelectedAircraft].overview.c_str());
+        ImGui::Text("Overview: %.*s", static_cast<int>(overview.size()), overview.data());
         break;
       }
       case 1: {
-        Markdown::GetInstance()->Render(m_GroupData->projects[*m_SelectedAircraft].description);
+        Markdown::GetInstance()->Render(description);
 
         break;
       }
       case 2: {
-        ImGui::Text("Changelog: %s", m_GroupData->projects[*m_SelectedAircraft].changelog.c_str());
+        ImGui::Text("Changelog: %.*s", static_cast<int>(changelog.size()), changelog.data());
         break;
       }
       default:
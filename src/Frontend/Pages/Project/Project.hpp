@@ -1,11 +1,13 @@
 
 #pragma once
 
+#include <optional>
 #include <string>
 #include <vector>
 
 #include "Backend/Image/Image.hpp"
 #include "Frontend/ColorInterpolation/ColorInterpolation.hpp"
+#include "Util/GroupUtil/GroupUtil.hpp"
 #include "Util/State/GroupStateManager.hpp"
 
 namespace Infinity {
@@ -40,17 +42,21 @@ private:
 
   class TopRegion {
 public:
-    explicit TopRegion(const std::shared_ptr<GroupData> &group_data,
-                       const std::shared_ptr<GroupDataImages> &group_data_images,
+    explicit TopRegion(const std::shared_ptr<const CatalogIndex> &index,
+                       const std::shared_ptr<const CatalogImages> &images, GroupId group,
                        const std::shared_ptr<uint8_t> &selected_aircraft);
     void Render();
+    // follow the group into a newer catalog where its content is unchanged
+    void Retarget(const std::shared_ptr<const CatalogIndex> &index, const std::shared_ptr<const CatalogImages> &images,
+                  GroupId group);
 
 private:
     AircraftSelectButtonBar m_AircraftSelectButtonBar;
     std::vector<AircraftSelectButton> m_AircraftSelectButtons;
     std::shared_ptr<uint8_t> m_SelectedAircraft;
-    std::shared_ptr<GroupData> m_GroupData;
-    std::shared_ptr<GroupDataImages> m_GroupDataImages;
+    std::shared_ptr<const CatalogIndex> m_Index;
+    std::shared_ptr<const CatalogImages> m_Images;
+    GroupId m_Group;
   };
 
 
@@ -87,12 +93,16 @@ private:
 
   class ContentRegion {
 public:
-    explicit ContentRegion(const std::shared_ptr<GroupData> &group_data, const std::shared_ptr<uint8_t> &selected_page,
+    explicit ContentRegion(const std::shared_ptr<const CatalogIndex> &index, GroupId group,
+                           const std::shared_ptr<uint8_t> &selected_page,
                            const std::shared_ptr<uint8_t> &selected_aircraft);
     void Render();
+    void Retarget(const std::shared_ptr<const CatalogIndex> &index, GroupId group);
 
 private:
     void RenderInstalledWidget();
+    // what the selected project installs as, nullopt if it is not a registered variant
+    [[nodiscard]] std::optional<Groups::GroupVariants> GetSelectedVariant() const;
 
     bool RenderDownloadButton(const char *label, ImVec2 size, ImVec2 pos);
     bool RenderBugReportButton(ImVec2 size, ImVec2 pos);
@@ -102,7 +112,8 @@ private:
     std::string m_Description;
     std::string m_Overview;
 
-    std::shared_ptr<GroupData> m_GroupData;
+    std::shared_ptr<const CatalogIndex> m_Index;
+    GroupId m_Group;
     ContentRegionButtonBar m_ButtonBar;
     std::vector<ContentRegionButton> m_Buttons;
 
@@ -112,22 +123,34 @@ private:
 
   class ProjectPage {
 public:
-    explicit ProjectPage(const std::shared_ptr<GroupData> &group_data,
-                         const std::shared_ptr<GroupDataImages> &state_images);
+    /**
+     * @param state MainState the page renders from, it reads whichever snapshot the frame pinned
+     * @param group_key key of the group in the catalog, resolved again whenever a new catalog is published
+     */
+    explicit ProjectPage(const std::shared_ptr<MainState> &state, std::string group_key);
+    // pages are built once and hold on to the selection, so reset it in place
     static void ResetState() {
-      m_SelectedPage = std::make_shared<uint8_t>(0);
-      m_SelectedAircraft = std::make_shared<uint8_t>(0);
+      *m_SelectedPage = 0;
+      *m_SelectedAircraft = 0;
     }
     void Render();
 
 private:
-    std::shared_ptr<GroupData> m_GroupData;
-    std::shared_ptr<GroupDataImages> m_StateImages;
+    void Bind(const CatalogSnapshot &snapshot);
+    static void Prefetch(const CatalogSnapshot &snapshot, const IndexedGroup &group, uint8_t selected);
+
+private:
+    std::shared_ptr<MainState> m_State;
+    std::string m_GroupKey;
+    uint64_t m_Version = 0;  // snapshot the regions below were built from
+    uint64_t m_Revision = 0;  // IndexedGroup::revision they were built from
+    GroupId m_Group = CatalogIndex::INVALID_GROUP;
+    std::optional<uint8_t> m_Prefetched;  // selection the neighbouring backgrounds were last requested for
 
     static std::shared_ptr<uint8_t> m_SelectedPage;
     static std::shared_ptr<uint8_t> m_SelectedAircraft;
 
-    ContentRegion m_ContentRegion;
-    TopRegion m_TopRegion;
+    std::optional<ContentRegion> m_ContentRegion;
+    std::optional<TopRegion> m_TopRegion;
   };
 }  // namespace Infinity
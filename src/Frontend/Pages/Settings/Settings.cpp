@@ -9,6 +9,8 @@
 
 #include "Backend/Application/Application.hpp"
 #include "Backend/HWID/Hwid.hpp"
+#include "Backend/Image/LazyImage.hpp"
+#include "Backend/Image/TextureResidency.hpp"
 #include "Backend/Updater/Updater.hpp"
 
 
@@ -23,7 +25,9 @@ namespace Infinity {
     //   std::string updater_path = exe_folder + "/Updater.exe";
     //   std::string current_exe = exe_folder + "/InfinityLauncher.exe";
     //   std::string new_exe = exe_folder + "/UPDATE_Infinity";
-    //   Infinity::Updater::LaunchUpdater(updater_path, new_exe, current_exe, pid_dir);
+    //   std::string current_pack = exe_folder + "/assets.pak";
+    //   std::string new_pack = exe_folder + "/UPDATE_assets.pak";
+    //   Infinity::Updater::LaunchUpdater(updater_path, new_exe, current_exe, pid_dir, new_pack, current_pack);
     // }
     // ImGui::Text("Updated InfinityLauncher :)");
 
@@ -37,12 +41,20 @@ namespace Infinity {
     ImGui::Checkbox("Reduce FPS on Unfocus", &reduce_fps_on_unfocus_bool);
     Application::Get().value()->SetReduceFPSOnIdle(reduce_fps_on_unfocus_bool);
 
+    int lookahead = LazyImage::GetPrefetchLookahead();
+    ImGui::SliderInt("Image Prefetch Lookahead", &lookahead, 0, 16, "%d", ImGuiSliderFlags_AlwaysClamp);
+    LazyImage::SetPrefetchLookahead(lookahead);
+
+    auto &residency = TextureResidency::GetInstance();
+    int budget_mb = static_cast<int>(residency.GetBudget() / (1024 * 1024));
+    ImGui::SliderInt("Texture Memory Budget", &budget_mb, 32, 1024, "%d MB", ImGuiSliderFlags_AlwaysClamp);
+    residency.SetBudget(static_cast<size_t>(budget_mb) * 1024 * 1024);
+    ImGui::Text("Textures resident: %.1f MB", static_cast<double>(residency.GetResidentBytes()) / (1024.0 * 1024.0));
+
     ImGui::Separator();
 
     if (ImGui::Button("Copy HWID")) {
-      HWID hwid;
-      auto hwid_string = hwid.GetHWID();
-      ImGui::SetClipboardText(hwid_string.c_str());
+      ImGui::SetClipboardText(HWID::GetShared().get().c_str());
     }
   }
 
@@ -13,258 +13,6 @@
 #include "Util/Error/Error.hpp"
 #include "imgui.h"
 
-static bool printed = false;
-
-static std::random_device rd;
-static std::mt19937 gen(rd());
-static std::uniform_real_distribution<float> dis(0.0f, 1.0f);
-
-static std::random_device rd1;
-static std::mt19937 gen1(rd1());
-static std::uniform_real_distribution<float> dis1(0.0f, 1.0f);
-
-static std::random_device rd2;
-static std::mt19937 gen2(rd2());
-static std::uniform_real_distribution<float> dis2(0.0f, 1.0f);
-
-inline void PrintSVGData(const std::vector<std::pair<ImVec2, ImVec2>> &svg_data) {
-  if (!printed) {
-    for (const auto &segment: svg_data) {
-      printf("(%.2f,%.2f)->(%.2f,%.2f)\n", segment.first.x, segment.first.y, segment.second.x, segment.second.y);
-    }
-  }
-
-  printed = true;
-}
-
-class SVGFlatten {
-  enum class PathCommand { MoveTo, LineTo, CubicBezier, SmoothCubicBezier, ClosePath };
-
-  struct PathCommandData {
-    PathCommand type;
-    std::vector<float> coords;
-  };
-
-  public:
-  explicit SVGFlatten(std::string path_raw, const double resolution)
-      : m_PathRaw(std::move(path_raw))
-      , m_Resolution(resolution)
-      , m_CurrentPoint({0.0, 0.0})
-      , m_LastControlPoint(std::nullopt) {}
-
-  std::vector<std::pair<ImVec2, ImVec2>> GetPoints() {
-    for (const auto commands = ParsePath(m_PathRaw); const auto &command: commands) {
-      auto segments = FlattenCommand(command);
-      m_Points.insert(m_Points.end(), segments.begin(), segments.end());
-    }
-    std::vector<std::pair<ImVec2, ImVec2>> result;
-
-    for (size_t i = 1; i < m_Points.size(); ++i) {
-      result.emplace_back(m_Points[i - 1], m_Points[i]);
-    }
-    return result;
-  }
-
-  static void DrawSVG(ImDrawList *draw_list, std::vector<std::pair<ImVec2, ImVec2>> &svg_data, const ImColor color,
-                      const float thickness, const bool fill, const ImVec2 offset, const float scale) {
-    // if (fill) {
-    //     auto *dl = ImGui::GetWindowDrawList();
-    //     std::vector<ImVec2> fill_points;
-    //     for (auto &[fst, snd]: svg_data) {
-    //         fill_points.emplace_back(
-    //                 fst.x * scale + offset.x,
-    //                 fst.y * scale + offset.y
-    //                 );
-    //         fill_points.emplace_back(
-    //                 snd.x * scale + offset.x,
-    //                 snd.y * scale + offset.y
-    //                 );
-    //     }
-    //
-    //     std::ranges::sort(fill_points,
-    //                       [](const ImVec2 &a, const ImVec2 &b) {
-    //                           return std::tie(a.x, a.y) < std::tie(b.x, b.y);
-    //                       });
-    //     fill_points.erase(
-    //             std::ranges::unique(fill_points,
-    //                                 [](const ImVec2 &a, const ImVec2 &b) {
-    //                                     return a.x == b.x && a.y == b.y;
-    //                                 }).begin(),
-    //             fill_points.end()
-    //             );
-    //     std::cout << "fill_points: " << fill_points.data() << std::endl;
-    //     dl->AddConvexPolyFilled(fill_points.data(),
-    //     static_cast<int>(fill_points.size()), color);
-    // } else {
-    for (auto &i: svg_data) {
-      float random = dis(gen);
-      float random1 = dis1(gen2);
-      float random2 = dis2(gen2);
-      std::cout << random << std::endl;
-      draw_list->AddLine({i.first.x * scale + offset.x, i.first.y * scale + offset.y},
-                         {i.second.x * scale + offset.x, i.second.y * scale + offset.y},
-                         ImColor(random1, random, random2, 1.0f), thickness);
-    }
-
-    //  }
-  }
-
-  void write_points_to_file(const std::vector<std::pair<ImVec2, ImVec2>> &points, const std::string &filename) {
-    std::ofstream file(filename);
-    if (!file.is_open()) {
-      throw std::runtime_error("Could not open file");
-    }
-
-    for (size_t i = 1; i < points.size(); ++i) {
-      file << "DrawLogoLine({" << points[i].first.x << ", " << points[i].first.y << "}, {" << points[i].second.x << ", "
-           << points[i].second.y << "}, scale, offset);\n";
-    }
-  }
-
-  private:
-  static ImVec2 cubic_bezier(const float t, const ImVec2 &p0, const ImVec2 &p1, const ImVec2 &p2, const ImVec2 &p3) {
-    const float u = 1.0f - t;
-    const float tt = t * t;
-    const float uu = u * u;
-    const float uuu = uu * u;
-    const float ttt = tt * t;
-
-    return {uuu * p0.x + 3.0f * uu * t * p1.y + 3.0f * u * tt * p2.x + ttt * p3.y,
-            uuu * p0.x + 3.0f * uu * t * p1.y + 3.0f * u * tt * p2.x + ttt * p3.y};
-  }
-
-  std::vector<ImVec2> FlattenCommand(const PathCommandData &command) {
-    std::vector<ImVec2> result;
-    switch (command.type) {
-      case PathCommand::LineTo:
-      case PathCommand::MoveTo: {
-        m_CurrentPoint = {command.coords[0], command.coords[1]};
-        result.push_back(m_CurrentPoint);
-        break;
-      }
-      case PathCommand::CubicBezier: {
-        const auto start = m_CurrentPoint;
-        const ImVec2 control1 = {command.coords[0], command.coords[1]};
-        ImVec2 control2 = {command.coords[2], command.coords[3]};
-        const ImVec2 end = {command.coords[4], command.coords[5]};
-
-        for (double t = 0.0; t <= 1.0; t += m_Resolution) {
-          auto point = cubic_bezier(t, start, control1, control2, end);
-          result.push_back(point);
-        }
-        result.push_back(end);
-
-        m_LastControlPoint = control2;
-        m_CurrentPoint = end;
-        break;
-      }
-      case PathCommand::SmoothCubicBezier: {
-        const auto start = m_CurrentPoint;
-        const ImVec2 control1 = m_LastControlPoint.has_value()
-            ? ImVec2(start.x + (start.x - m_LastControlPoint->x), start.y + (start.y - m_LastControlPoint->y))
-            : start;
-        ImVec2 control2 = {command.coords[0], command.coords[1]};
-        const ImVec2 end = {command.coords[2], command.coords[3]};
-
-        for (double t = 0.0; t <= 1.0; t += m_Resolution) {
-          auto point = cubic_bezier(t, start, control1, control2, end);
-          result.push_back(point);
-        }
-        result.push_back(end);
-
-        m_LastControlPoint = control2;
-        m_CurrentPoint = end;
-        break;
-      }
-      case PathCommand::ClosePath:
-        break;
-    }
-    return result;
-  }
-
-  static float ParseCoordinates(const std::string &path_data, size_t pos) {
-    while (pos < path_data.size() && (std::isspace(path_data[pos]) || path_data[pos] == ',')) {
-      pos++;
-    }
-    const size_t start = pos;
-
-    if (pos < path_data.length() && (path_data[pos] == '-' || path_data[pos] == '+')) pos++;
-
-    while (pos < path_data.length() && (std::isdigit(path_data[pos]) || path_data[pos] == '.')) {
-      pos++;
-    }
-    const std::string coord_string = path_data.substr(start, pos - start);
-    return coord_string.empty() ? 0.0f : std::stof(coord_string);
-  }
-
-  static std::vector<PathCommandData> ParsePath(const std::string &path_data) {
-    std::vector<PathCommandData> result;
-    size_t pos = 0;
-
-    while (pos < path_data.length()) {
-      const char cmd = path_data[pos];
-      pos++;
-
-      switch (cmd) {
-        case 'm':
-        case 'l':
-        case 'c':
-        case 's':
-        case 'z': {
-          auto error =
-              Infinity::Errors::Error{Infinity::Errors::ErrorType::NonFatal, "Relative Paths commands not supported"};
-          error.Dispatch();
-        }
-        case 'M': {
-          float x = ParseCoordinates(path_data, pos);
-          float y = ParseCoordinates(path_data, pos);
-          result.push_back({PathCommand::MoveTo, {x, y}});
-          break;
-        }
-        case 'L': {
-          float x = ParseCoordinates(path_data, pos);
-          float y = ParseCoordinates(path_data, pos);
-          result.push_back({PathCommand::LineTo, {x, y}});
-          break;
-        }
-        case 'C': {
-          float x1 = ParseCoordinates(path_data, pos);
-          float y1 = ParseCoordinates(path_data, pos);
-          float x2 = ParseCoordinates(path_data, pos);
-          float y2 = ParseCoordinates(path_data, pos);
-          float x = ParseCoordinates(path_data, pos);
-          float y = ParseCoordinates(path_data, pos);
-          result.push_back({PathCommand::CubicBezier, {x1, y1, x2, y2, x, y}});
-          break;
-        }
-        case 'S': {
-          float x2 = ParseCoordinates(path_data, pos);
-          float y2 = ParseCoordinates(path_data, pos);
-          float x = ParseCoordinates(path_data, pos);
-          float y = ParseCoordinates(path_data, pos);
-          result.push_back({PathCommand::SmoothCubicBezier, {x2, y2, x, y}});
-          break;
-        }
-        case 'Z': {
-          result.push_back({PathCommand::ClosePath, {}});
-          break;
-        }
-        default:
-          break;
-      }
-    }
-    return result;
-  }
-
-  private:
-  std::string m_PathRaw;
-  std::vector<ImVec2> m_Points;
-  double m_Resolution;
-  ImVec2 m_CurrentPoint;
-  std::optional<ImVec2> m_LastControlPoint;
-};
-
-
 inline void DrawLogoLine(const ImVec2 pos1, const ImVec2 pos2, const float scale = 1.0f, const ImVec2 offset = {0, 0},
                          const float thickness = 1.0f, int index = 0,
                          const std::vector<unsigned int> &active_index = {}) {
@@ -0,0 +1,241 @@
+#include "SvgPath.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <charconv>
+#include <cmath>
+#include <string>
+
+namespace Infinity {
+  void SvgPolyline::Clear() {
+    points.clear();
+    contours.clear();
+    tolerance = 0.0f;
+  }
+
+  void SvgPolyline::Draw(ImDrawList *draw_list, const ImVec2 offset, const float scale, const ImU32 color,
+                         const float thickness) const {
+    thread_local std::vector<ImVec2> screen;
+    for (const auto &[start, count, closed]: contours) {
+      screen.resize(count);
+      for (uint32_t i = 0; i < count; ++i) {
+        const ImVec2 &point = points[start + i];
+        screen[i] = {offset.x + point.x * scale, offset.y + point.y * scale};
+      }
+      draw_list->AddPolyline(screen.data(), static_cast<int>(count), color,
+                             closed ? ImDrawFlags_Closed : ImDrawFlags_None, thickness);
+    }
+  }
+
+  std::expected<SvgPath, Errors::Error> SvgPath::Parse(const std::string_view data) {
+    auto fail = [](const std::string &message) {
+      return std::unexpected(Errors::Error{Errors::ErrorType::NonFatal, "Invalid SVG path: " + message});
+    };
+
+    const char *it = data.data();
+    const char *const end = it + data.size();
+    auto skip_separators = [&] {
+      while (it != end && (std::isspace(static_cast<unsigned char>(*it)) || *it == ',')) ++it;
+    };
+    auto number = [&](float &value) {
+      skip_separators();
+      if (it != end && *it == '+') ++it;  // from_chars does not take an explicit plus sign
+      const auto [next, error] = std::from_chars(it, end, value);
+      if (error != std::errc()) return false;
+      it = next;
+      return true;
+    };
+
+    SvgPath path;
+    ImVec2 current{0.0f, 0.0f};
+    ImVec2 subpath_start{0.0f, 0.0f};
+    ImVec2 cubic_control{0.0f, 0.0f};  // second control point of the last C or S, reflected by S
+    ImVec2 quad_control{0.0f, 0.0f};  // control point of the last Q or T, reflected by T
+    char command = 0;
+    char previous = 0;
+
+    while (true) {
+      skip_separators();
+      if (it == end) break;
+      if (std::isalpha(static_cast<unsigned char>(*it))) {
+        command = *it++;
+      } else if (command == 0) {
+        return fail("expected a command at offset " + std::to_string(it - data.data()));
+      }
+      // a number without a command repeats the last one
+
+      const bool relative = std::islower(static_cast<unsigned char>(command));
+      const char upper = static_cast<char>(std::toupper(static_cast<unsigned char>(command)));
+      auto point = [&](ImVec2 &p) {
+        if (!number(p.x) || !number(p.y)) return false;
+        if (relative) {
+          p.x += current.x;
+          p.y += current.y;
+        }
+        return true;
+      };
+      auto add = [&](const Verb verb, std::initializer_list<ImVec2> points) {
+        path.m_verbs.push_back(verb);
+        path.m_points.insert(path.m_points.end(), points);
+      };
+
+      if (path.m_verbs.empty() && upper != 'M') return fail("path data has to start with a move command");
+      // drawing on after a close starts a new subpath where the closed one began
+      if (previous == 'Z' && upper != 'M' && upper != 'Z') add(Verb::MoveTo, {subpath_start});
+
+      switch (upper) {
+        case 'M': {
+          ImVec2 p;
+          if (!point(p)) return fail("M needs x y");
+          add(Verb::MoveTo, {p});
+          current = subpath_start = p;
+          // coordinates following a move are line segments
+          command = relative ? 'l' : 'L';
+          break;
+        }
+        case 'L': {
+          ImVec2 p;
+          if (!point(p)) return fail("L needs x y");
+          add(Verb::LineTo, {p});
+          current = p;
+          break;
+        }
+        case 'H': {
+          float x;
+          if (!number(x)) return fail("H needs x");
+          current.x = relative ? current.x + x : x;
+          add(Verb::LineTo, {current});
+          break;
+        }
+        case 'V': {
+          float y;
+          if (!number(y)) return fail("V needs y");
+          current.y = relative ? current.y + y : y;
+          add(Verb::LineTo, {current});
+          break;
+        }
+        case 'C': {
+          ImVec2 c1, c2, p;
+          if (!point(c1) || !point(c2) || !point(p)) return fail("C needs x1 y1 x2 y2 x y");
+          add(Verb::CubicTo, {c1, c2, p});
+          cubic_control = c2;
+          current = p;
+          break;
+        }
+        case 'S': {
+          ImVec2 c2, p;
+          if (!point(c2) || !point(p)) return fail("S needs x2 y2 x y");
+          const ImVec2 c1 = previous == 'C' || previous == 'S'
+              ? ImVec2(2.0f * current.x - cubic_control.x, 2.0f * current.y - cubic_control.y)
+              : current;
+          add(Verb::CubicTo, {c1, c2, p});
+          cubic_control = c2;
+          current = p;
+          break;
+        }
+        case 'Q':
+        case 'T': {
+          ImVec2 q, p;
+          if (upper == 'Q') {
+            if (!point(q) || !point(p)) return fail("Q needs x1 y1 x y");
+          } else {
+            if (!point(p)) return fail("T needs x y");
+            q = previous == 'Q' || previous == 'T'
+                ? ImVec2(2.0f * current.x - quad_control.x, 2.0f * current.y - quad_control.y)
+                : current;
+          }
+          // the same curve as a cubic, its control points two thirds of the way to the quadratic one
+          add(Verb::CubicTo,
+              {ImVec2(current.x + 2.0f / 3.0f * (q.x - current.x), current.y + 2.0f / 3.0f * (q.y - current.y)),
+               ImVec2(p.x + 2.0f / 3.0f * (q.x - p.x), p.y + 2.0f / 3.0f * (q.y - p.y)), p});
+          quad_control = q;
+          current = p;
+          break;
+        }
+        case 'Z': {
+          path.m_verbs.push_back(Verb::Close);
+          current = subpath_start;
+          // Z takes no arguments, so there is nothing a following number could repeat
+          command = 0;
+          break;
+        }
+        case 'A':
+          return fail("arc commands are not supported");
+        default:
+          return fail(std::string("unknown command '") + command + "'");
+      }
+      previous = upper;
+    }
+
+    return path;
+  }
+
+  void SvgPath::Flatten(const float tolerance, SvgPolyline &out) const {
+    out.Clear();
+    out.tolerance = tolerance;
+
+    auto end_contour = [&out] {
+      if (out.contours.empty()) return;
+      auto &contour = out.contours.back();
+      contour.count = static_cast<uint32_t>(out.points.size()) - contour.start;
+    };
+
+    size_t index = 0;
+    ImVec2 current{0.0f, 0.0f};
+    for (const Verb verb: m_verbs) {
+      switch (verb) {
+        case Verb::MoveTo:
+          end_contour();
+          current = m_points[index++];
+          out.contours.push_back({static_cast<uint32_t>(out.points.size()), 0, false});
+          out.points.push_back(current);
+          break;
+        case Verb::LineTo:
+          current = m_points[index++];
+          if (const ImVec2 &last = out.points.back(); last.x != current.x || last.y != current.y) {
+            out.points.push_back(current);
+          }
+          break;
+        case Verb::CubicTo:
+          FlattenCubic(current, m_points[index], m_points[index + 1], m_points[index + 2], tolerance, out.points);
+          current = m_points[index + 2];
+          index += 3;
+          break;
+        case Verb::Close:
+          out.contours.back().closed = true;
+          break;
+      }
+    }
+    end_contour();
+
+    // a lone move has nothing to draw
+    std::erase_if(out.contours, [](const SvgPolyline::Contour &contour) { return contour.count < 2; });
+  }
+
+  void SvgPath::FlattenFor(const float scale, SvgPolyline &out, const float tolerance_px) const {
+    if (scale <= 0.0f || tolerance_px <= 0.0f) return;
+    const float tolerance = tolerance_px / scale;
+    if (out.tolerance > 0.0f && out.tolerance <= tolerance && out.tolerance * 4.0f >= tolerance) return;
+    Flatten(tolerance, out);
+  }
+
+  void SvgPath::FlattenCubic(const ImVec2 p0, const ImVec2 p1, const ImVec2 p2, const ImVec2 p3, const float tolerance,
+                             std::vector<ImVec2> &out) {
+    // Wang's formula: the number of uniform steps that keeps the chords within tolerance of the curve, derived from
+    // the largest second difference of the control polygon
+    const float ddx = std::max(std::abs(p0.x - 2.0f * p1.x + p2.x), std::abs(p1.x - 2.0f * p2.x + p3.x));
+    const float ddy = std::max(std::abs(p0.y - 2.0f * p1.y + p2.y), std::abs(p1.y - 2.0f * p2.y + p3.y));
+    const float dd = std::sqrt(ddx * ddx + ddy * ddy);
+    const int segments = std::clamp(static_cast<int>(std::ceil(std::sqrt(0.75f * dd / tolerance))), 1, 512);
+
+    for (int i = 1; i <= segments; ++i) {
+      const float t = static_cast<float>(i) / static_cast<float>(segments);
+      const float u = 1.0f - t;
+      const float b0 = u * u * u;
+      const float b1 = 3.0f * u * u * t;
+      const float b2 = 3.0f * u * t * t;
+      const float b3 = t * t * t;
+      out.push_back({b0 * p0.x + b1 * p1.x + b2 * p2.x + b3 * p3.x, b0 * p0.y + b1 * p1.y + b2 * p2.y + b3 * p3.y});
+    }
+  }
+}  // namespace Infinity
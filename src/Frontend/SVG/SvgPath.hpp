@@ -0,0 +1,73 @@
+#pragma once
+
+#include <cstdint>
+#include <expected>
+#include <string_view>
+#include <vector>
+
+#include "Util/Error/Error.hpp"
+#include "imgui.h"
+
+namespace Infinity {
+  /**
+   * A flattened path, one contiguous point array split into contours.
+   *
+   * Points are in path units, Draw maps them to the screen. Keep one around per path and refill it with
+   * SvgPath::FlattenFor, it only flattens again when the scale changes enough to need a different tolerance.
+   */
+  struct SvgPolyline {
+    struct Contour {
+      uint32_t start;
+      uint32_t count;
+      bool closed;
+    };
+
+    std::vector<ImVec2> points;
+    std::vector<Contour> contours;
+    float tolerance = 0.0f;  // path units the points were flattened to, 0 if empty
+
+    void Clear();
+
+    // one AddPolyline per contour, points are mapped to offset + point * scale
+    void Draw(ImDrawList *draw_list, ImVec2 offset, float scale, ImU32 color, float thickness) const;
+  };
+
+  /**
+   * SVG path data parsed into a flat command buffer.
+   *
+   * Supports the M, L, H, V, C, S, Q, T and Z commands in both their absolute and relative forms. Everything is
+   * normalized to absolute move, line and cubic commands while parsing, quadratics are raised to cubics. Arcs are not
+   * supported.
+   */
+  class SvgPath {
+public:
+    static std::expected<SvgPath, Errors::Error> Parse(std::string_view data);
+
+    /**
+     * Flatten the path into out, replacing what it held
+     * @param tolerance how far the polyline may stray from the curves, in path units
+     */
+    void Flatten(float tolerance, SvgPolyline &out) const;
+
+    /**
+     * Flatten for drawing at scale, skipped when out already holds a flattening fine enough (and not needlessly fine)
+     * @param tolerance_px how far the polyline may stray from the curves on screen
+     */
+    void FlattenFor(float scale, SvgPolyline &out, float tolerance_px = DEFAULT_TOLERANCE) const;
+
+    [[nodiscard]] bool Empty() const { return m_verbs.empty(); }
+
+    static constexpr float DEFAULT_TOLERANCE = 0.25f;
+
+private:
+    enum class Verb : uint8_t { MoveTo, LineTo, CubicTo, Close };
+
+    SvgPath() = default;
+
+    static void FlattenCubic(ImVec2 p0, ImVec2 p1, ImVec2 p2, ImVec2 p3, float tolerance, std::vector<ImVec2> &out);
+
+private:
+    std::vector<Verb> m_verbs;
+    std::vector<ImVec2> m_points;  // absolute, one per MoveTo and LineTo, three per CubicTo
+  };
+}  // namespace Infinity
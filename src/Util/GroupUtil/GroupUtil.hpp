@@ -2,7 +2,9 @@
 
 #include <cctype>
 #include <map>
+#include <optional>
 #include <string>
+#include <string_view>
 #include <unordered_map>
 #include <utility>
 #include <variant>
@@ -45,8 +47,34 @@ public:
       m_EnumMap[enum_value] = std::make_pair(group_name, aircraft_name);
     }
 
+    /**
+     * Find the enum value registered for a catalog group and project, ignoring case and punctuation so "C-17" and
+     * "QBit Sim" still match
+     * @param group_name std::string_view
+     * @param aircraft_name std::string_view
+     * @return `int enum_value` if exists else nullopt
+     */
+    [[nodiscard]] std::optional<int> Find(const std::string_view group_name, const std::string_view aircraft_name) {
+      const std::string group = Normalize(group_name);
+      const std::string aircraft = Normalize(aircraft_name);
+      for (const auto &[enum_value, names]: m_EnumMap) {
+        if (Normalize(names.first) == group && Normalize(names.second) == aircraft) return enum_value;
+      }
+      return std::nullopt;
+    }
+
 private:
-    EnumRegistry() = default;
+    EnumRegistry() { RegisterEnums(); }
+
+    static std::string Normalize(const std::string_view name) {
+      std::string normalized;
+      for (const char c: name) {
+        if (std::isalnum(static_cast<unsigned char>(c))) {
+          normalized += static_cast<char>(std::toupper(static_cast<unsigned char>(c)));
+        }
+      }
+      return normalized;
+    }
 
 
     void RegisterEnums() {
@@ -76,5 +104,32 @@ private:
 
   using GroupVariants = std::variant<AERO_DYNAMICS, DELTA_SIM, LUNAR_SIM, OUROBOROS_JETS, QBIT_SIM>;
 
+  /**
+   * Resolve the variant a catalog project installs as
+   * @param group_name display name of the project's group
+   * @param aircraft_name display name of the project
+   * @return `GroupVariants` if the project is registered else nullopt
+   */
+  inline std::optional<GroupVariants> FindVariant(const std::string_view group_name,
+                                                  const std::string_view aircraft_name) {
+    const auto value = EnumRegistry::GetInstance().Find(group_name, aircraft_name);
+    if (!value.has_value()) return std::nullopt;
+    // each group's enum values start at its own multiple of 1000
+    switch (value.value() / 1000) {
+      case 1:
+        return static_cast<AERO_DYNAMICS>(value.value());
+      case 2:
+        return static_cast<DELTA_SIM>(value.value());
+      case 3:
+        return static_cast<LUNAR_SIM>(value.value());
+      case 4:
+        return static_cast<OUROBOROS_JETS>(value.value());
+      case 5:
+        return static_cast<QBIT_SIM>(value.value());
+      default:
+        return std::nullopt;
+    }
+  }
+
 
 }  // namespace Infinity::Groups
@@ -0,0 +1,95 @@
+#include "MappedFile.hpp"
+
+#include <utility>
+
+#ifdef WIN32
+#include <Windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace Infinity {
+  MappedFile::MappedFile(const std::filesystem::path &path) {
+#ifdef WIN32
+    const HANDLE file = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                                    FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) return;
+    m_file = file;
+
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(file, &size) || size.QuadPart == 0) {
+      Close();
+      return;
+    }
+    m_mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (!m_mapping) {
+      Close();
+      return;
+    }
+    m_data = static_cast<const uint8_t *>(MapViewOfFile(m_mapping, FILE_MAP_READ, 0, 0, 0));
+    if (!m_data) {
+      Close();
+      return;
+    }
+    m_size = static_cast<size_t>(size.QuadPart);
+#else
+    const int fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) return;
+
+    struct stat info{};
+    if (fstat(fd, &info) != 0 || info.st_size <= 0) {
+      close(fd);
+      return;
+    }
+    void *data = mmap(nullptr, static_cast<size_t>(info.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+    // the mapping keeps the file referenced on its own
+    close(fd);
+    if (data == MAP_FAILED) return;
+
+    m_data = static_cast<const uint8_t *>(data);
+    m_size = static_cast<size_t>(info.st_size);
+#endif
+  }
+
+  MappedFile::~MappedFile() { Close(); }
+
+  MappedFile::MappedFile(MappedFile &&other) noexcept
+      : m_data(std::exchange(other.m_data, nullptr))
+      , m_size(std::exchange(other.m_size, 0))
+#ifdef WIN32
+      , m_file(std::exchange(other.m_file, nullptr))
+      , m_mapping(std::exchange(other.m_mapping, nullptr))
+#endif
+  {
+  }
+
+  MappedFile &MappedFile::operator=(MappedFile &&other) noexcept {
+    if (this != &other) {
+      Close();
+      m_data = std::exchange(other.m_data, nullptr);
+      m_size = std::exchange(other.m_size, 0);
+#ifdef WIN32
+      m_file = std::exchange(other.m_file, nullptr);
+      m_mapping = std::exchange(other.m_mapping, nullptr);
+#endif
+    }
+    return *this;
+  }
+
+  void MappedFile::Close() {
+#ifdef WIN32
+    if (m_data) UnmapViewOfFile(m_data);
+    if (m_mapping) CloseHandle(m_mapping);
+    if (m_file) CloseHandle(m_file);
+    m_file = nullptr;
+    m_mapping = nullptr;
+#else
+    if (m_data) munmap(const_cast<uint8_t *>(m_data), m_size);
+#endif
+    m_data = nullptr;
+    m_size = 0;
+  }
+}  // namespace Infinity
@@ -0,0 +1,40 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+
+namespace Infinity {
+  /**
+   * A whole file mapped read only into memory, unmapped again when it goes out of scope.
+   *
+   * Pages are only read from disk once they are touched, so opening a large file costs nothing up front. Empty and
+   * missing files both leave the mapping invalid.
+   */
+  class MappedFile {
+public:
+    MappedFile() = default;
+    explicit MappedFile(const std::filesystem::path &path);
+    ~MappedFile();
+
+    MappedFile(MappedFile &&other) noexcept;
+    MappedFile &operator=(MappedFile &&other) noexcept;
+    MappedFile(const MappedFile &) = delete;
+    MappedFile &operator=(const MappedFile &) = delete;
+
+    [[nodiscard]] const uint8_t *Data() const { return m_data; }
+    [[nodiscard]] size_t Size() const { return m_size; }
+    explicit operator bool() const { return m_data != nullptr; }
+
+private:
+    void Close();
+
+private:
+    const uint8_t *m_data = nullptr;
+    size_t m_size = 0;
+#ifdef WIN32
+    void *m_file = nullptr;
+    void *m_mapping = nullptr;
+#endif
+  };
+}  // namespace Infinity
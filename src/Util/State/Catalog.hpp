@@ -0,0 +1,276 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <memory_resource>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "msgpack.hpp"
+#include "zlib.h"
+
+namespace Infinity {
+  // Views into a decoded catalog (groups.bin or index.bin). Every string points into the decompressed buffer owned by
+  // the Catalog and every array lives in its arena, so records are only valid while the Catalog that produced them is
+  // alive.
+
+  struct CatalogPackagePatch {
+    std::string_view from;
+    std::string_view to;
+    std::string_view fileName;
+  };
+
+  struct CatalogPackage {
+    std::string_view owner;
+    std::string_view repoName;
+    std::string_view version;
+    std::string_view fileName;
+    std::span<const CatalogPackagePatch> patches;
+  };
+
+  struct CatalogPalette {
+    std::string_view primary;
+    std::string_view secondary;
+    std::string_view circle1;
+    std::string_view circle2;
+    std::string_view circle3;
+    std::string_view circle4;
+    std::string_view circle5;
+  };
+
+  struct CatalogProject {
+    std::string_view name;
+    std::string_view version;
+    std::string_view date;
+    std::string_view changelog;
+    std::string_view overview;
+    std::string_view description;
+    std::string_view background;
+    std::optional<std::string_view> pageBackground;
+    std::span<const std::string_view> variants;
+    const CatalogPackage *package = nullptr;
+    // split catalogs (index.bin) leave changelog, overview and description empty and name a ProjectDetails blob
+    std::string_view detail;
+  };
+
+  struct CatalogBetaProject {
+    std::string_view background;
+  };
+
+  struct CatalogGroup {
+    std::string_view key;
+    std::string_view name;
+    std::span<const CatalogProject> projects;
+    CatalogBetaProject beta;
+    std::string_view logo;
+    std::string_view path;
+    CatalogPalette palette;
+    bool hide = false;
+  };
+
+  /**
+   * Inflate a gzip stream in one pass, sizing the output from the ISIZE trailer
+   * @param compressed gzip data
+   * @return decompressed bytes
+   */
+  inline std::vector<uint8_t> InflateGzip(const std::vector<uint8_t> &compressed) {
+    if (compressed.size() < 18) {
+      throw std::runtime_error("Compressed data is too small to be gzip");
+    }
+
+    // ISIZE is the uncompressed length mod 2^32, so it is only a hint and the buffer still grows if it was wrong
+    const uint8_t *trailer = compressed.data() + compressed.size() - 4;
+    const uint32_t isize = static_cast<uint32_t>(trailer[0]) | static_cast<uint32_t>(trailer[1]) << 8 |
+        static_cast<uint32_t>(trailer[2]) << 16 | static_cast<uint32_t>(trailer[3]) << 24;
+    std::vector<uint8_t> output(std::max<size_t>(isize, 1024));
+
+    z_stream strm{};
+    strm.next_in = const_cast<Bytef *>(compressed.data());
+    strm.avail_in = static_cast<uInt>(compressed.size());
+    if (inflateInit2(&strm, 16 + MAX_WBITS) != Z_OK) {
+      throw std::runtime_error("Failed to initialize zlib for decompression");
+    }
+
+    int ret;
+    while (true) {
+      strm.next_out = output.data() + strm.total_out;
+      strm.avail_out = static_cast<uInt>(output.size() - strm.total_out);
+      ret = inflate(&strm, Z_FINISH);
+      if (ret == Z_STREAM_END) break;
+      if ((ret == Z_OK || ret == Z_BUF_ERROR) && strm.avail_out == 0) {
+        output.resize(output.size() * 2);
+        continue;
+      }
+      inflateEnd(&strm);
+      throw std::runtime_error("Decompression error");
+    }
+
+    output.resize(strm.total_out);
+    inflateEnd(&strm);
+    return output;
+  }
+
+  /**
+   * Decoded groups.bin or index.bin, which share a layout.
+   *
+   * The decompressed buffer is kept alive and msgpack is told to reference strings in place rather than copy them,
+   * all records are then laid out in a single monotonic arena. Decoding is one inflate, one unpack and one walk over
+   * the object tree, with a handful of allocations no matter how many groups and projects are listed.
+   */
+  class Catalog {
+public:
+    static std::shared_ptr<const Catalog> Decode(const std::vector<uint8_t> &compressed) {
+      std::shared_ptr<Catalog> catalog(new Catalog(InflateGzip(compressed)));
+      catalog->Parse();
+      return catalog;
+    }
+
+    Catalog(const Catalog &) = delete;
+    Catalog &operator=(const Catalog &) = delete;
+
+    [[nodiscard]] std::span<const CatalogGroup> GetGroups() const { return m_groups; }
+
+    // groups are kept sorted by key
+    [[nodiscard]] const CatalogGroup *FindGroup(const std::string_view key) const {
+      const auto it = std::ranges::lower_bound(m_groups, key, {}, &CatalogGroup::key);
+      return it != m_groups.end() && it->key == key ? &*it : nullptr;
+    }
+
+    [[nodiscard]] size_t GetDecodedSize() const { return m_buffer.size(); }
+
+private:
+    explicit Catalog(std::vector<uint8_t> buffer)
+        : m_buffer(std::move(buffer))
+        , m_arena(m_buffer.size() / 2 + 1024) {}
+
+    template<typename T>
+    std::span<T> Allocate(const size_t count) {
+      if (count == 0) return {};
+      T *data = std::pmr::polymorphic_allocator<T>(&m_arena).allocate(count);
+      std::uninitialized_value_construct_n(data, count);
+      return {data, count};
+    }
+
+    static const msgpack::object *Field(const msgpack::object &array, const size_t index) {
+      if (array.type != msgpack::type::ARRAY) throw msgpack::type_error();
+      return index < array.via.array.size ? &array.via.array.ptr[index] : nullptr;
+    }
+
+    static bool IsNil(const msgpack::object *object) { return !object || object->type == msgpack::type::NIL; }
+
+    static std::string_view View(const msgpack::object *object) {
+      if (IsNil(object)) return {};
+      if (object->type != msgpack::type::STR) throw msgpack::type_error();
+      return {object->via.str.ptr, object->via.str.size};
+    }
+
+    void Parse() {
+      // strings stay in m_buffer instead of being copied into the msgpack zone
+      constexpr msgpack::unpack_reference_func reference = [](const msgpack::type::object_type type, std::size_t,
+                                                              void *) {
+        return type == msgpack::type::STR || type == msgpack::type::BIN;
+      };
+
+      try {
+        m_handle = msgpack::unpack(reinterpret_cast<const char *>(m_buffer.data()), m_buffer.size(), reference);
+        const msgpack::object &root = m_handle.get();
+        if (root.type != msgpack::type::MAP) throw msgpack::type_error();
+
+        auto groups = Allocate<CatalogGroup>(root.via.map.size);
+        for (uint32_t i = 0; i < root.via.map.size; ++i) {
+          ParseGroup(root.via.map.ptr[i].val, groups[i]);
+          groups[i].key = View(&root.via.map.ptr[i].key);
+        }
+        std::ranges::sort(groups, {}, &CatalogGroup::key);
+        m_groups = groups;
+      } catch (const std::exception &e) {
+        throw std::runtime_error(std::string("MessagePack deserialization error: ") + e.what());
+      }
+    }
+
+    void ParseGroup(const msgpack::object &object, CatalogGroup &group) {
+      group.name = View(Field(object, 0));
+
+      if (const auto *projects = Field(object, 1); !IsNil(projects)) {
+        if (projects->type != msgpack::type::ARRAY) throw msgpack::type_error();
+        auto parsed = Allocate<CatalogProject>(projects->via.array.size);
+        for (uint32_t i = 0; i < projects->via.array.size; ++i) {
+          ParseProject(projects->via.array.ptr[i], parsed[i]);
+        }
+        group.projects = parsed;
+      }
+
+      if (const auto *beta = Field(object, 2); !IsNil(beta)) {
+        group.beta.background = View(Field(*beta, 0));
+      }
+      group.logo = View(Field(object, 3));
+      // index 4 is the deprecated update flag
+      group.path = View(Field(object, 5));
+
+      if (const auto *palette = Field(object, 6); !IsNil(palette)) {
+        group.palette = {View(Field(*palette, 0)), View(Field(*palette, 1)), View(Field(*palette, 2)),
+                         View(Field(*palette, 3)), View(Field(*palette, 4)), View(Field(*palette, 5)),
+                         View(Field(*palette, 6))};
+      }
+
+      if (const auto *hide = Field(object, 7); !IsNil(hide)) {
+        group.hide = hide->as<bool>();
+      }
+    }
+
+    void ParseProject(const msgpack::object &object, CatalogProject &project) {
+      project.name = View(Field(object, 0));
+      project.version = View(Field(object, 1));
+      project.date = View(Field(object, 2));
+      project.changelog = View(Field(object, 3));
+      project.overview = View(Field(object, 4));
+      project.description = View(Field(object, 5));
+      project.background = View(Field(object, 6));
+
+      if (const auto *page_background = Field(object, 7); !IsNil(page_background)) {
+        project.pageBackground = View(page_background);
+      }
+
+      if (const auto *variants = Field(object, 8); !IsNil(variants)) {
+        if (variants->type != msgpack::type::ARRAY) throw msgpack::type_error();
+        auto parsed = Allocate<std::string_view>(variants->via.array.size);
+        for (uint32_t i = 0; i < variants->via.array.size; ++i) {
+          parsed[i] = View(&variants->via.array.ptr[i]);
+        }
+        project.variants = parsed;
+      }
+
+      if (const auto *package = Field(object, 9); !IsNil(package)) {
+        auto &parsed = Allocate<CatalogPackage>(1)[0];
+        parsed.owner = View(Field(*package, 0));
+        parsed.repoName = View(Field(*package, 1));
+        parsed.version = View(Field(*package, 2));
+        parsed.fileName = View(Field(*package, 3));
+
+        if (const auto *patches = Field(*package, 4); !IsNil(patches)) {
+          if (patches->type != msgpack::type::ARRAY) throw msgpack::type_error();
+          auto parsed_patches = Allocate<CatalogPackagePatch>(patches->via.array.size);
+          for (uint32_t i = 0; i < patches->via.array.size; ++i) {
+            const auto &patch = patches->via.array.ptr[i];
+            parsed_patches[i] = {View(Field(patch, 0)), View(Field(patch, 1)), View(Field(patch, 2))};
+          }
+          parsed.patches = parsed_patches;
+        }
+        project.package = &parsed;
+      }
+
+      project.detail = View(Field(object, 10));
+    }
+
+private:
+    std::vector<uint8_t> m_buffer;
+    msgpack::object_handle m_handle;
+    std::pmr::monotonic_buffer_resource m_arena;
+    std::span<const CatalogGroup> m_groups;
+  };
+}  // namespace Infinity
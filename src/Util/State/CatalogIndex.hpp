@@ -0,0 +1,229 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "Catalog.hpp"
+#include "imgui.h"
+
+namespace Infinity {
+  using GroupId = uint16_t;
+  using ProjectId = uint16_t;
+  using NameId = uint32_t;
+
+  /**
+   * Parse "#RRGGBB" or "#RRGGBBAA" (the # is optional) into 0xRRGGBBAA
+   * @param hex std::string_view
+   * @return std::nullopt if the string is not a hex color
+   */
+  constexpr std::optional<uint32_t> ParseHexColor(std::string_view hex) {
+    if (!hex.empty() && hex.front() == '#') hex.remove_prefix(1);
+    if (hex.size() != 6 && hex.size() != 8) return std::nullopt;
+
+    uint32_t value = 0;
+    for (const char c: hex) {
+      uint32_t digit;
+      if (c >= '0' && c <= '9') {
+        digit = c - '0';
+      } else if (c >= 'a' && c <= 'f') {
+        digit = c - 'a' + 10;
+      } else if (c >= 'A' && c <= 'F') {
+        digit = c - 'A' + 10;
+      } else {
+        return std::nullopt;
+      }
+      value = value << 4 | digit;
+    }
+    return hex.size() == 6 ? value << 8 | 0xFF : value;
+  }
+
+  // throws on malformed input, which turns into a compile error when used in a constant expression
+  constexpr uint32_t PackHexColor(const std::string_view hex) {
+    const auto color = ParseHexColor(hex);
+    if (!color) throw std::invalid_argument("Invalid hex color format");
+    return *color;
+  }
+
+  inline ImVec4 UnpackColor(const uint32_t color) {
+    constexpr float scale = 1.0f / 255.0f;
+    return {static_cast<float>(color >> 24 & 0xFF) * scale, static_cast<float>(color >> 16 & 0xFF) * scale,
+            static_cast<float>(color >> 8 & 0xFF) * scale, static_cast<float>(color & 0xFF) * scale};
+  }
+
+  struct PackedPalette {
+    // primary, secondary, circle1 - circle5 as 0xRRGGBBAA
+    std::array<uint32_t, 7> colors{};
+  };
+
+  constexpr PackedPalette PackPalette(const std::string_view primary, const std::string_view secondary,
+                                      const std::string_view circle1, const std::string_view circle2,
+                                      const std::string_view circle3, const std::string_view circle4,
+                                      const std::string_view circle5) {
+    return {{PackHexColor(primary), PackHexColor(secondary), PackHexColor(circle1), PackHexColor(circle2),
+             PackHexColor(circle3), PackHexColor(circle4), PackHexColor(circle5)}};
+  }
+
+  struct IndexedGroup {
+    NameId key;
+    NameId name;
+    ProjectId firstProject;
+    uint16_t projectCount;
+    bool hide;
+    uint64_t revision;  // hash of everything the group's pages show, equal across catalogs when nothing changed
+    const CatalogGroup *record;
+  };
+
+  struct IndexedProject {
+    NameId name;
+    NameId version;
+    GroupId group;
+    uint16_t slot;  // position inside its group
+    const CatalogProject *record;
+  };
+
+  /**
+   * Flat view of a Catalog for the UI.
+   *
+   * Groups and projects sit in two contiguous arrays and are addressed by their position, a group's projects being
+   * the run [firstProject, firstProject + projectCount). Keys, names and versions are interned into one buffer of
+   * null terminated strings so they can be handed straight to ImGui. Anything keyed by group or project (images for
+   * instance) can live in parallel vectors indexed the same way.
+   *
+   * String keys are only needed to resolve a GroupId once, after that every lookup is an array index.
+   */
+  class CatalogIndex {
+public:
+    static constexpr GroupId INVALID_GROUP = std::numeric_limits<GroupId>::max();
+
+    static std::shared_ptr<const CatalogIndex> Build(std::shared_ptr<const Catalog> catalog) {
+      std::shared_ptr<CatalogIndex> index(new CatalogIndex(std::move(catalog)));
+      index->Populate();
+      return index;
+    }
+
+    CatalogIndex(const CatalogIndex &) = delete;
+    CatalogIndex &operator=(const CatalogIndex &) = delete;
+
+    [[nodiscard]] std::span<const IndexedGroup> GetGroups() const { return m_groups; }
+    [[nodiscard]] std::span<const IndexedProject> GetProjects() const { return m_projects; }
+
+    [[nodiscard]] const IndexedGroup &GetGroup(const GroupId id) const { return m_groups[id]; }
+    [[nodiscard]] const IndexedProject &GetProject(const ProjectId id) const { return m_projects[id]; }
+
+    [[nodiscard]] std::span<const IndexedProject> GetProjects(const GroupId id) const {
+      const auto &group = m_groups[id];
+      return std::span(m_projects).subspan(group.firstProject, group.projectCount);
+    }
+
+    // groups keep the catalog's key order, so this is a binary search
+    [[nodiscard]] GroupId FindGroup(const std::string_view key) const {
+      const auto it = std::ranges::lower_bound(m_groups, key, {},
+                                               [this](const IndexedGroup &group) { return GetName(group.key); });
+      return it != m_groups.end() && GetName(it->key) == key ? static_cast<GroupId>(it - m_groups.begin())
+                                                              : INVALID_GROUP;
+    }
+
+    [[nodiscard]] const char *GetName(const NameId id) const { return m_names.data() + id; }
+
+    [[nodiscard]] const std::shared_ptr<const Catalog> &GetCatalog() const { return m_catalog; }
+
+private:
+    explicit CatalogIndex(std::shared_ptr<const Catalog> catalog)
+        : m_catalog(std::move(catalog)) {}
+
+    void Populate() {
+      const auto groups = m_catalog->GetGroups();
+      size_t project_total = 0;
+      for (const auto &group: groups) project_total += group.projects.size();
+      if (groups.size() >= INVALID_GROUP || project_total > std::numeric_limits<ProjectId>::max()) {
+        throw std::runtime_error("Catalog is too large to index");
+      }
+
+      m_groups.reserve(groups.size());
+      m_projects.reserve(project_total);
+      std::unordered_map<std::string_view, NameId> interned;
+
+      for (const auto &group: groups) {
+        const auto group_id = static_cast<GroupId>(m_groups.size());
+        IndexedGroup &indexed = m_groups.emplace_back();
+        indexed.key = Intern(interned, group.key);
+        indexed.name = Intern(interned, group.name);
+        indexed.firstProject = static_cast<ProjectId>(m_projects.size());
+        indexed.projectCount = static_cast<uint16_t>(group.projects.size());
+        indexed.hide = group.hide;
+        indexed.revision = HashGroup(group);
+        indexed.record = &group;
+
+        for (uint16_t slot = 0; slot < group.projects.size(); ++slot) {
+          const auto &project = group.projects[slot];
+          m_projects.push_back({Intern(interned, project.name), Intern(interned, project.version), group_id, slot,
+                                &project});
+        }
+      }
+    }
+
+    static uint64_t HashGroup(const CatalogGroup &group) {
+      // FNV-1a, every field is length prefixed so neighbouring fields cannot run into each other
+      uint64_t hash = 0xcbf29ce484222325ull;
+      const auto mix = [&hash](const std::string_view value) {
+        const auto length = static_cast<uint64_t>(value.size());
+        for (size_t i = 0; i < sizeof(length); ++i) hash = (hash ^ (length >> i * 8 & 0xFF)) * 0x100000001b3ull;
+        for (const char c: value) hash = (hash ^ static_cast<uint8_t>(c)) * 0x100000001b3ull;
+      };
+
+      const auto &palette = group.palette;
+      for (const auto value: {group.name, group.logo, group.path, group.beta.background, palette.primary,
+                              palette.secondary, palette.circle1, palette.circle2, palette.circle3, palette.circle4,
+                              palette.circle5}) {
+        mix(value);
+      }
+      mix(group.hide ? "1" : "0");
+
+      for (const auto &project: group.projects) {
+        for (const auto value: {project.name, project.version, project.date, project.changelog, project.overview,
+                                project.description, project.background, project.pageBackground.value_or(""),
+                                project.detail}) {
+          mix(value);
+        }
+        for (const auto variant: project.variants) mix(variant);
+        if (const auto *package = project.package) {
+          for (const auto value: {package->owner, package->repoName, package->version, package->fileName}) {
+            mix(value);
+          }
+          for (const auto &patch: package->patches) {
+            mix(patch.from);
+            mix(patch.to);
+            mix(patch.fileName);
+          }
+        }
+      }
+      return hash;
+    }
+
+    NameId Intern(std::unordered_map<std::string_view, NameId> &interned, const std::string_view name) {
+      // the keys view the catalog buffer, which outlives the map
+      if (const auto it = interned.find(name); it != interned.end()) return it->second;
+      const auto id = static_cast<NameId>(m_names.size());
+      m_names.append(name);
+      m_names.push_back('\0');
+      interned.emplace(name, id);
+      return id;
+    }
+
+private:
+    std::shared_ptr<const Catalog> m_catalog;
+    std::vector<IndexedGroup> m_groups;
+    std::vector<IndexedProject> m_projects;
+    std::string m_names;
+  };
+}  // namespace Infinity
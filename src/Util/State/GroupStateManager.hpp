@@ -1,21 +1,31 @@
 
 #pragma once
 
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <exception>
 #include <iostream>
 // #include <map>
 #include <future>
 #include <memory>
 #include <mutex>
 #include <optional>
-#include <sstream>
 #include <stdexcept>
 #include <string>
+#include <string_view>
 #include <thread>
+#include <unordered_map>
 #include <vector>
 
+#include "Backend/CurlShare/CurlShare.hpp"
 #include "Backend/HWID/Hwid.hpp"
 #include "Backend/Image/Image.hpp"
+#include "Backend/Image/LazyImage.hpp"
+#include "Catalog.hpp"
+#include "CatalogIndex.hpp"
 #include "Json/json.hpp"
+#include "Snapshot.hpp"
 #include "State.hpp"
 #include "curl/curl.h"
 #include "imgui.h"
@@ -64,323 +74,253 @@ public:
     CurlGuard &operator=(const CurlGuard &) = delete;
   };
 
+  struct PackagePatch {
+    std::string from;  // installed version the patch applies to
+    std::string to;
+    std::string fileName;  // release asset, generated with PatchBuilder
+
+    MSGPACK_DEFINE(from, to, fileName);
+  };
+
   struct Package {
     std::string owner;
     std::string repoName;
     std::string version;
     std::string fileName;
+    std::optional<std::vector<PackagePatch>> patches;
 
-    MSGPACK_DEFINE(owner, repoName, version, fileName);
-  };
-
-  struct Project {
-    std::string name;
-    std::string version;
-    std::string date;
-    std::string changelog;
-    std::string overview;
-    std::string description;
-    std::string background;
-    std::optional<std::string> pageBackground;
-    std::optional<std::vector<std::string>> variants;
-    std::optional<Package> package;
-
-    MSGPACK_DEFINE(name, version, date, changelog, overview, description, background, pageBackground, variants,
-                   package);
-  };
-
-  struct Palette {
-    std::string primary;
-    std::string secondary;
-    std::string circle1;
-    std::string circle2;
-    std::string circle3;
-    std::string circle4;
-    std::string circle5;
-    MSGPACK_DEFINE(primary, secondary, circle1, circle2, circle3, circle4, circle5);
-  };
-
-  struct BetaProject {
-    std::string background;
-
-    MSGPACK_DEFINE(background);
-  };
-
-  struct GroupData {
-    std::string name;
-    std::vector<Project> projects;
-    BetaProject beta;
-    std::string logo;
-    [[deprecated("Handled Via launcher backend")]] std::optional<bool> update;
-    std::string path;
-    Palette palette;
-    std::optional<bool> hide;
-
-    MSGPACK_DEFINE(name, projects, beta, logo, update, path, palette, hide);
-  };
-
-  struct GroupDataState {
-    std::map<std::string, GroupData> groups;
+    MSGPACK_DEFINE(owner, repoName, version, fileName, patches);
   };
 
-  using GroupMap = std::map<std::string, GroupData>;
-  static GroupMap group_data;
-
-  inline std::map<std::string, GroupData> decode_bin(const std::vector<uint8_t> &raw_data) {
-    z_stream strm{};
-    strm.next_in = reinterpret_cast<Bytef *>(const_cast<uint8_t *>(raw_data.data()));
-    strm.avail_in = static_cast<uInt>(raw_data.size());
-
-    if (inflateInit2(&strm, 16 + MAX_WBITS) != Z_OK) {
-      throw std::runtime_error("Failed to initialize zlib for decompression");
-    }
+  inline std::string ToString(const std::string_view view) { return {view.data(), view.size()}; }
 
-    std::vector<uint8_t> decompressed_data;
-    std::array<uint8_t, 8192> buffer{};
-
-    int ret;
-    do {
-      strm.next_out = buffer.data();
-      strm.avail_out = static_cast<uInt>(buffer.size());
-
-      ret = inflate(&strm, Z_NO_FLUSH);
-      if (ret != Z_OK && ret != Z_STREAM_END) {
-        inflateEnd(&strm);
-        throw std::runtime_error("Decompression error");
+  // owning copy of a package, the installer keeps these after the catalog they came from may have been replaced
+  inline Package ToPackage(const CatalogPackage &package) {
+    Package copy{ToString(package.owner), ToString(package.repoName), ToString(package.version),
+                 ToString(package.fileName)};
+    if (!package.patches.empty()) {
+      copy.patches.emplace();
+      for (const auto &patch: package.patches) {
+        copy.patches->push_back({ToString(patch.from), ToString(patch.to), ToString(patch.fileName)});
       }
-
-      size_t decompressed_size = buffer.size() - strm.avail_out;
-      decompressed_data.insert(decompressed_data.end(), buffer.data(), buffer.data() + decompressed_size);
-    } while (ret != Z_STREAM_END);
-
-    inflateEnd(&strm);
-
-    try {
-      msgpack::object_handle oh =
-          msgpack::unpack(reinterpret_cast<const char *>(decompressed_data.data()), decompressed_data.size());
-      msgpack::object obj = oh.get();
-
-      std::map<std::string, GroupData> group_data;
-      obj.convert(group_data);
-      return group_data;
-    } catch (const std::exception &e) {
-      throw std::runtime_error(std::string("MessagePack deserialization error: ") + e.what());
     }
+    return copy;
   }
 
-  // temporary struct for queueing images to be loaded into vulkan textures
-  struct ProjectImagesBin {
-    std::vector<uint8_t> backgroundImage;
-    std::optional<std::vector<uint8_t>> pageBackgroundImage;
-  };
-
-  struct BetaProjectImagesBin {
-    std::vector<uint8_t> background;
+  // backgrounds fill the project page header and the tall home cards, {1920, 1080} covers both in a typical window
+  inline constexpr Image::DecodeSize BACKGROUND_DECODE_SIZE{1920, 1080};
+  // logos are drawn at most a few hundred pixels across
+  inline constexpr Image::DecodeSize LOGO_DECODE_SIZE{512, 512};
+
+  // image slots parallel to the CatalogIndex arrays, null where the catalog has no URL
+  struct CatalogImages {
+    std::vector<std::shared_ptr<LazyImage>> groupLogos;  // by GroupId
+    std::vector<std::shared_ptr<LazyImage>> betaBackgrounds;  // by GroupId
+    std::vector<std::shared_ptr<LazyImage>> projectBackgrounds;  // by ProjectId
+    std::vector<std::shared_ptr<LazyImage>> projectPageBackgrounds;  // by ProjectId
   };
 
-  struct GroupDataImagesBin {
-    std::vector<uint8_t> logo;
-    std::vector<ProjectImagesBin> projectImages;
-    BetaProjectImagesBin beta;
+  // one published version of the catalog, never modified once it has been handed to MainState::Publish
+  struct CatalogSnapshot {
+    uint64_t version = 0;
+    std::shared_ptr<const Catalog> catalog;
+    std::shared_ptr<const CatalogIndex> index;
+    std::shared_ptr<const CatalogImages> images;
   };
 
-  struct StateImagesBin {
-    std::map<std::string, GroupDataImagesBin> groupImages;
+  // the catalog file last downloaded and its ETag, sent back to skip unchanged downloads
+  struct CatalogSource {
+    std::string url;
+    std::string etag;
   };
 
-  //////////////////////////
-
-  struct ProjectImages {
-    std::shared_ptr<Image> backgroundImage;
-    std::optional<std::shared_ptr<Image>> pageBackgroundImage;
-  };
-
-  struct BetaProjectImages {
-    std::shared_ptr<Image> background;
-  };
-
-  struct GroupDataImages {
-    std::shared_ptr<Image> logo;
-    std::vector<ProjectImages> projectImages;
-    BetaProjectImages beta;
-  };
+  class MainState : public PageState {
+public:
+    std::atomic<bool> beta_auth = false;
+
+    /**
+     * Make a new catalog visible to readers, frames that already pinned the previous one keep rendering it
+     * @param snapshot fully populated snapshot, its version is assigned here
+     */
+    void Publish(CatalogSnapshot snapshot) {
+      snapshot.version = ++m_version;
+      m_snapshot.Publish(std::make_shared<const CatalogSnapshot>(std::move(snapshot)));
+    }
 
-  struct StateImages {
-    std::map<std::string, GroupDataImages> groupImages;
-  };
+    // latest published snapshot, null until the first catalog has loaded
+    [[nodiscard]] std::shared_ptr<const CatalogSnapshot> Load() const { return m_snapshot.Load(); }
 
-  inline ImVec4 hexToImVec4(const std::string &hexColor);
+    /**
+     * Pin the latest snapshot for the frame about to be rendered. Render thread only, everything drawn during the
+     * frame reads GetFrame() so a publish halfway through a frame cannot tear it.
+     */
+    const CatalogSnapshot *PinFrame() {
+      m_frame = m_snapshot.Load();
+      return m_frame.get();
+    }
 
-  class MainState : public PageState {
-public:
-    GroupDataState state;
-    StateImages images;
-    bool beta_auth = false;
+    [[nodiscard]] const CatalogSnapshot *GetFrame() const { return m_frame.get(); }
 
-    MainState(GroupDataState &state)
-        : state(state) {}
+    /**
+     * Kept apart from the snapshot so a download that decodes to the same catalog can still record its ETag without
+     * publishing anything
+     */
+    [[nodiscard]] CatalogSource GetSource() const {
+      std::lock_guard lock(m_source_mutex);
+      return m_source;
+    }
 
+    void SetSource(CatalogSource source) {
+      std::lock_guard lock(m_source_mutex);
+      m_source = std::move(source);
+    }
 
     void PrintState() const override {
       ImGui::Begin("State Information");
 
-      if (state.groups.empty()) {
+      const auto snapshot = Load();
+      if (!snapshot || !snapshot->index || snapshot->index->GetGroups().empty()) {
         ImGui::Text("No group data available");
         ImGui::End();
         return;
       }
-      ImGui::Text("Total Groups: %zu", state.groups.size());
+      const auto &index = *snapshot->index;
+      const auto &images = snapshot->images;
+      ImGui::Text("Total Groups: %zu", index.GetGroups().size());
       ImGui::Separator();
 
-      for (const auto &[groupKey, groupData]: state.groups) {
-        if (ImGui::TreeNode(("Group: " + groupData.name + " (" + groupKey + ")").c_str())) {
-          ImGui::Text("Logo URL: %s", groupData.logo.c_str());
-          ImGui::Text("Path: %s", groupData.path.c_str());
+      for (GroupId group_id = 0; group_id < index.GetGroups().size(); ++group_id) {
+        const auto &indexed = index.GetGroup(group_id);
+        const CatalogGroup &group = *indexed.record;
+        ImGui::PushID(group_id);
+        if (ImGui::TreeNode("group", "Group: %s (%s)", index.GetName(indexed.name), index.GetName(indexed.key))) {
+          RenderField("Logo URL", group.logo);
+          RenderField("Path", group.path);
           if (ImGui::TreeNode("Palette")) {
-            try {
-              ImVec4 primaryColor = hexToImVec4(groupData.palette.primary);
-              ImVec4 secondaryColor = hexToImVec4(groupData.palette.secondary);
-              ImVec4 circle1Color = hexToImVec4(groupData.palette.circle1);
-              ImVec4 circle2Color = hexToImVec4(groupData.palette.circle2);
-              ImVec4 circle3Color = hexToImVec4(groupData.palette.circle3);
-              ImVec4 circle4Color = hexToImVec4(groupData.palette.circle4);
-              ImVec4 circle5Color = hexToImVec4(groupData.palette.circle5);
-
-              ImGui::ColorButton("Primary", primaryColor, 0, ImVec2(20, 20));
-              ImGui::SameLine();
-              ImGui::Text("Primary: %s", groupData.palette.primary.c_str());
-
-              ImGui::ColorButton("Secondary", secondaryColor, 0, ImVec2(20, 20));
-              ImGui::SameLine();
-              ImGui::Text("Secondary: %s", groupData.palette.secondary.c_str());
-
-              ImGui::ColorButton("Circle1", circle1Color, 0, ImVec2(20, 20));
-              ImGui::SameLine();
-              ImGui::Text("Circle1: %s", groupData.palette.circle1.c_str());
-
-              ImGui::ColorButton("Circle2", circle2Color, 0, ImVec2(20, 20));
-              ImGui::SameLine();
-              ImGui::Text("Circle2: %s", groupData.palette.circle2.c_str());
-
-              ImGui::ColorButton("Circle3", circle3Color, 0, ImVec2(20, 20));
-              ImGui::SameLine();
-              ImGui::Text("Circle3: %s", groupData.palette.circle3.c_str());
-
-              ImGui::ColorButton("Circle4", circle4Color, 0, ImVec2(20, 20));
-              ImGui::SameLine();
-              ImGui::Text("Circle4: %s", groupData.palette.circle4.c_str());
-
-              ImGui::ColorButton("Circle5", circle5Color, 0, ImVec2(20, 20));
-              ImGui::SameLine();
-              ImGui::Text("Circle5: %s", groupData.palette.circle5.c_str());
-            } catch (const std::invalid_argument &e) {
-              ImGui::TextColored(ImVec4(1.0f, 0.0f, 0.0f, 1.0f), "Error with palette colors: %s", e.what());
+            const std::pair<const char *, std::string_view> colors[] = {
+                {"Primary", group.palette.primary}, {"Secondary", group.palette.secondary},
+                {"Circle1", group.palette.circle1}, {"Circle2", group.palette.circle2},
+                {"Circle3", group.palette.circle3}, {"Circle4", group.palette.circle4},
+                {"Circle5", group.palette.circle5}};
+            for (const auto &[label, hex]: colors) {
+              if (const auto color = ParseHexColor(hex)) {
+                ImGui::ColorButton(label, UnpackColor(*color), 0, ImVec2(20, 20));
+                ImGui::SameLine();
+                RenderField(label, hex);
+              } else {
+                ImGui::TextColored(ImVec4(1.0f, 0.0f, 0.0f, 1.0f), "%s: invalid color \"%.*s\"", label,
+                                   static_cast<int>(hex.size()), hex.data());
+              }
             }
             ImGui::TreePop();
           }
 
-          ImGui::Text("Hidden: %s", groupData.hide.has_value() && *groupData.hide ? "Yes" : "No");
+          ImGui::Text("Hidden: %s", group.hide ? "Yes" : "No");
 
           if (ImGui::TreeNode("Beta Project")) {
-            ImGui::Text("Background URL: %s", groupData.beta.background.c_str());
+            RenderField("Background URL", group.beta.background);
 
-            auto groupImagesIt = images.groupImages.find(groupKey);
-            if (groupImagesIt != images.groupImages.end() && groupImagesIt->second.beta.background) {
+            if (images && images->betaBackgrounds[group_id]) {
               ImGui::Text("Background Image:");
-              void *textureId = groupImagesIt->second.beta.background->GetImGuiTextureID();
-              if (textureId) {
-                ImGui::Image(textureId, ImVec2(100, 100));
-              } else {
-                ImGui::Text("   [Texture not loaded]");
-              }
+              RenderSlotPreview(*images->betaBackgrounds[group_id]);
             }
 
             ImGui::TreePop();
           }
 
-          if (ImGui::TreeNode(("Projects (" + std::to_string(groupData.projects.size()) + ")").c_str())) {
-            for (size_t i = 0; i < groupData.projects.size(); i++) {
-              const auto &project = groupData.projects[i];
-              if (ImGui::TreeNode(("Project: " + project.name + " (" + std::to_string(i) + ")").c_str())) {
-                ImGui::Text("Version: %s", project.version.c_str());
-                ImGui::Text("Date: %s", project.date.c_str());
-
-                if (ImGui::TreeNode("Overview")) {
-                  ImGui::TextWrapped("%s", project.overview.c_str());
-                  ImGui::TreePop();
-                }
-
-                if (ImGui::TreeNode("Description")) {
-                  ImGui::TextWrapped("%s", project.description.c_str());
-                  ImGui::TreePop();
-                }
-
-                if (ImGui::TreeNode("Changelog")) {
-                  ImGui::TextWrapped("%s", project.changelog.c_str());
-                  ImGui::TreePop();
-                }
-
-                ImGui::Text("Background URL: %s", project.background.c_str());
-                if (project.pageBackground) {
-                  ImGui::Text("Page Background URL: %s", project.pageBackground->c_str());
+          if (ImGui::TreeNode("projects", "Projects (%u)", static_cast<unsigned>(indexed.projectCount))) {
+            for (const auto &project: index.GetProjects(group_id)) {
+              const CatalogProject &record = *project.record;
+              const ProjectId project_id = indexed.firstProject + project.slot;
+              ImGui::PushID(project.slot);
+              if (ImGui::TreeNode("project", "Project: %s (%u)", index.GetName(project.name),
+                                  static_cast<unsigned>(project.slot))) {
+                ImGui::Text("Version: %s", index.GetName(project.version));
+                RenderField("Date", record.date);
+
+                // split catalogs keep these in the project's detail blob
+                if (!record.detail.empty()) RenderField("Detail Blob", record.detail);
+                for (const auto &[label, text]: {std::pair{"Overview", record.overview},
+                                                 std::pair{"Description", record.description},
+                                                 std::pair{"Changelog", record.changelog}}) {
+                  if (ImGui::TreeNode(label)) {
+                    ImGui::TextWrapped("%.*s", static_cast<int>(text.size()), text.data());
+                    ImGui::TreePop();
+                  }
                 }
 
-                auto groupImagesIt = images.groupImages.find(groupKey);
-                if (groupImagesIt != images.groupImages.end() && i < groupImagesIt->second.projectImages.size()) {
-                  const auto &projectImages = groupImagesIt->second.projectImages[i];
+                RenderField("Background URL", record.background);
+                if (record.pageBackground) RenderField("Page Background URL", *record.pageBackground);
 
+                if (images) {
                   ImGui::Text("Background Image:");
-                  if (projectImages.backgroundImage) {
-                    void *textureId = projectImages.backgroundImage->GetImGuiTextureID();
-                    if (textureId) {
-                      ImGui::Image(textureId, ImVec2(100, 100));
-                    } else {
-                      ImGui::Text("   [Texture not loaded]");
-                    }
+                  if (const auto &background = images->projectBackgrounds[project_id]) {
+                    RenderSlotPreview(*background);
                   }
 
-                  if (projectImages.pageBackgroundImage) {
+                  if (const auto &page_background = images->projectPageBackgrounds[project_id]) {
                     ImGui::Text("Page Background Image:");
-                    auto textureId = (*projectImages.pageBackgroundImage)->GetImGuiTextureID();
-                    if (textureId) {
-                      ImGui::Image(textureId, ImVec2(100, 100));
-                    } else {
-                      ImGui::Text("   [Texture not loaded]");
-                    }
+                    RenderSlotPreview(*page_background);
                   }
                 }
 
-                if (project.variants && !project.variants->empty()) {
-                  if (ImGui::TreeNode(("Variants (" + std::to_string(project.variants->size()) + ")").c_str())) {
-                    for (const auto &variant: *project.variants) {
-                      ImGui::BulletText("%s", variant.c_str());
+                if (!record.variants.empty()) {
+                  if (ImGui::TreeNode("variants", "Variants (%zu)", record.variants.size())) {
+                    for (const auto variant: record.variants) {
+                      ImGui::BulletText("%.*s", static_cast<int>(variant.size()), variant.data());
                     }
                     ImGui::TreePop();
                   }
                 }
 
-                if (project.package) {
+                if (const auto *package = record.package) {
                   if (ImGui::TreeNode("Package")) {
-                    ImGui::Text("Owner: %s", project.package->owner.c_str());
-                    ImGui::Text("Repo Name: %s", project.package->repoName.c_str());
-                    ImGui::Text("Version: %s", project.package->version.c_str());
-                    ImGui::Text("File Name: %s", project.package->fileName.c_str());
+                    RenderField("Owner", package->owner);
+                    RenderField("Repo Name", package->repoName);
+                    RenderField("Version", package->version);
+                    RenderField("File Name", package->fileName);
                     ImGui::TreePop();
                   }
                 }
 
                 ImGui::TreePop();
               }
+              ImGui::PopID();
             }
             ImGui::TreePop();
           }
 
           ImGui::TreePop();
         }
+        ImGui::PopID();
       }
 
       ImGui::End();
     }
+
+private:
+    // catalog strings are views into its buffer, so they are not null terminated
+    static void RenderField(const char *label, const std::string_view value) {
+      ImGui::Text("%s: %.*s", label, static_cast<int>(value.size()), value.data());
+    }
+
+    // the debug view only shows what pages already loaded, it never starts a download itself
+    static void RenderSlotPreview(const LazyImage &slot) {
+      if (const auto &image = slot.Peek(); image && image->GetImGuiTextureID()) {
+        ImGui::Image(image->GetImGuiTextureID(), ImVec2(100, 100), image->GetUV0(), image->GetUV1());
+      } else if (slot.GetStatus() == LazyImage::Status::Idle) {
+        ImGui::Text("   [Not requested]");
+      } else {
+        ImGui::Text("   [Texture not loaded]");
+      }
+    }
+
+private:
+    SnapshotCell<CatalogSnapshot> m_snapshot;
+    std::atomic<uint64_t> m_version = 0;
+    std::shared_ptr<const CatalogSnapshot> m_frame;  // render thread only
+    mutable std::mutex m_source_mutex;
+    CatalogSource m_source;
   };
 
   static bool CheckAuthorization(const std::string &hwid) {
@@ -396,6 +336,7 @@ public:
     }
 
     std::string response;
+    CurlShare::GetInstance().Attach(curl);
     curl_easy_setopt(curl, CURLOPT_URL, url.c_str());
     curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, AuthWriteCallback);
     curl_easy_setopt(curl, CURLOPT_WRITEDATA, &response);
@@ -418,79 +359,89 @@ public:
     return false;
   }
 
-  inline StateImagesBin FetchAllImages(const GroupDataState &state) {
-    StateImagesBin bin;
-    std::vector<std::future<void>> futures;
-    std::mutex bin_mutex;
-
-    for (const auto &[group_key, group_data]: state.groups) {
-      futures.push_back(std::async(std::launch::async, [&, group_key, group_data] {
-        GroupDataImagesBin group_bin;
-
-        group_bin.logo = Image::FetchFromURL(group_data.logo);
-
-        group_bin.projectImages.reserve(group_data.projects.size());
-        for (const auto &project: group_data.projects) {
-          ProjectImagesBin project_bin;
-          project_bin.backgroundImage = Image::FetchFromURL(project.background);
-
-          if (project.pageBackground) {
-            project_bin.pageBackgroundImage = Image::FetchFromURL(*project.pageBackground);
-          }
-
-          group_bin.projectImages.push_back(std::move(project_bin));
+  /**
+   * Image slots for `index`. Nothing is downloaded here, pages load what they draw (see LazyImage). Every URL that
+   * `previous` already had a slot for keeps that slot, along with its texture or the load still in flight, so a
+   * refresh only ever fetches images that are new and actually get looked at.
+   * @param index catalog to create slots for
+   * @param previous snapshot currently published, may be null
+   */
+  inline std::shared_ptr<const CatalogImages> HandleImages(const CatalogIndex &index,
+                                                           const CatalogSnapshot *previous = nullptr) {
+    std::unordered_map<std::string_view, std::shared_ptr<LazyImage>> known;
+    if (previous && previous->images) {
+      const auto &old_images = *previous->images;
+      for (const auto *slots: {&old_images.groupLogos, &old_images.betaBackgrounds, &old_images.projectBackgrounds,
+                               &old_images.projectPageBackgrounds}) {
+        for (const auto &slot: *slots) {
+          // failed loads get a fresh slot, so a refresh doubles as a retry
+          if (slot && slot->GetStatus() != LazyImage::Status::Failed) known.emplace(slot->GetUrl(), slot);
         }
-        group_bin.beta.background = Image::FetchFromURL(group_data.beta.background);
-        {
-          std::lock_guard lock(bin_mutex);
-          bin.groupImages[group_key] = std::move(group_bin);
-        }
-      }));
-    }
-    for (auto &future: futures) {
-      future.get();
+      }
     }
-    return bin;
-  }
-
-  inline StateImages CreateVulkanImages(const StateImagesBin &bin) {
-    StateImages images;
-
-    for (const auto &[group_key, group_bin]: bin.groupImages) {
-      GroupDataImages group_images;
-
-      group_images.logo = Image::LoadFromBinary(group_bin.logo);
 
-      group_images.projectImages.reserve(group_bin.projectImages.size());
-      for (const auto &project_bin: group_bin.projectImages) {
-        ProjectImages project_images;
-        project_images.backgroundImage = Image::LoadFromBinary(project_bin.backgroundImage);
-
-        if (project_bin.pageBackgroundImage) {
-          project_images.pageBackgroundImage = Image::LoadFromBinary(*project_bin.pageBackgroundImage);
-        }
-
-        group_images.projectImages.push_back(std::move(project_images));
+    size_t reused = 0;
+    const auto slot = [&](const std::string_view url,
+                          const Image::DecodeSize decode_size = BACKGROUND_DECODE_SIZE) -> std::shared_ptr<LazyImage> {
+      if (url.empty()) return nullptr;
+      auto &known_slot = known[url];
+      if (known_slot) {
+        ++reused;
+      } else {
+        known_slot = std::make_shared<LazyImage>(std::string(url), decode_size);
       }
-
-      group_images.beta.background = Image::LoadFromBinary(group_bin.beta.background);
-
-      images.groupImages[group_key] = std::move(group_images);
+      return known_slot;
+    };
+
+    auto images = std::make_shared<CatalogImages>();
+    images->groupLogos.reserve(index.GetGroups().size());
+    images->betaBackgrounds.reserve(index.GetGroups().size());
+    for (const auto &group: index.GetGroups()) {
+      images->groupLogos.push_back(slot(group.record->logo, LOGO_DECODE_SIZE));
+      images->betaBackgrounds.push_back(slot(group.record->beta.background));
+    }
+    images->projectBackgrounds.reserve(index.GetProjects().size());
+    images->projectPageBackgrounds.reserve(index.GetProjects().size());
+    for (const auto &project: index.GetProjects()) {
+      images->projectBackgrounds.push_back(slot(project.record->background));
+      images->projectPageBackgrounds.push_back(project.record->pageBackground ? slot(*project.record->pageBackground)
+                                                                              : nullptr);
+    }
+    if (previous) {
+      std::cout << "Reused " << reused << " image slots" << std::endl;
     }
     return images;
   }
 
-  inline void HandleImages(const GroupDataState &state, StateImages &images) {
-    StateImagesBin bin = FetchAllImages(state);
-    images = CreateVulkanImages(bin);
+  inline size_t HeaderCallback(char *buffer, size_t size, size_t nitems, void *userdata) {
+    const std::string_view line(buffer, size * nitems);
+    constexpr std::string_view name = "etag:";
+    if (line.size() > name.size() &&
+        std::ranges::equal(line.substr(0, name.size()), name, [](const char a, const char b) {
+          return std::tolower(static_cast<unsigned char>(a)) == b;
+        })) {
+      auto value = line.substr(name.size());
+      const auto first = value.find_first_not_of(" \t");
+      const auto last = value.find_last_not_of(" \t\r\n");
+      *static_cast<std::string *>(userdata) =
+          first == std::string_view::npos ? std::string() : std::string(value.substr(first, last - first + 1));
+    }
+    return size * nitems;
   }
 
-  inline void fetch_and_decode_groups(std::shared_ptr<MainState> &thread_state_ptr) {
-    const auto url =
-        "https://github.com/infinity-MSFS/groups/raw/refs/heads/main/"
-        "groups.bin";
-    std::vector<uint8_t> received_data;
+  // index.bin is the split catalog (project text lives in detail blobs, see ProjectDetails), groups.bin the single
+  // file one. Sources are tried in order and a source that is missing on the server falls through to the next.
+  inline constexpr const char *CATALOG_SOURCES[] = {
+      "https://github.com/infinity-MSFS/groups/raw/refs/heads/main/index.bin",
+      "https://github.com/infinity-MSFS/groups/raw/refs/heads/main/groups.bin",
+  };
 
+  /**
+   * GET a catalog file
+   * @param etag sent as If-None-Match when not empty, replaced by the ETag of the response
+   * @return the HTTP status code
+   */
+  inline long FetchCatalogFile(const char *url, std::vector<uint8_t> &received_data, std::string &etag) {
     CURL *curl = curl_easy_init();
     if (!curl) {
       throw std::runtime_error("Failed to initialize CURL");
@@ -498,66 +449,112 @@ public:
 
     CurlGuard guard(curl);
 
+    CurlShare::GetInstance().Attach(curl);
     curl_easy_setopt(curl, CURLOPT_URL, url);
     curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, WriteCallback);
     curl_easy_setopt(curl, CURLOPT_WRITEDATA, &received_data);
+    curl_easy_setopt(curl, CURLOPT_HEADERFUNCTION, HeaderCallback);
+    curl_easy_setopt(curl, CURLOPT_HEADERDATA, &etag);
     curl_easy_setopt(curl, CURLOPT_FOLLOWLOCATION, 1L);
     curl_easy_setopt(curl, CURLOPT_SSL_VERIFYPEER, 1L);
     curl_easy_setopt(curl, CURLOPT_USERAGENT, "Infinity-MSFS-Client/1.0");
 
-    if (const CURLcode res = curl_easy_perform(curl); res != CURLE_OK) {
+    curl_slist *headers = nullptr;
+    if (!etag.empty()) {
+      headers = curl_slist_append(headers, ("If-None-Match: " + etag).c_str());
+      curl_easy_setopt(curl, CURLOPT_HTTPHEADER, headers);
+    }
+    const CURLcode res = curl_easy_perform(curl);
+    curl_slist_free_all(headers);
+    if (res != CURLE_OK) {
       throw std::runtime_error(std::string("Failed to fetch data: ") + curl_easy_strerror(res));
     }
 
-    std::cout << "Fetched data" << received_data.size() << " bytes" << std::endl;
-
     long http_code = 0;
     curl_easy_getinfo(curl, CURLINFO_RESPONSE_CODE, &http_code);
-    if (http_code != 200) {
-      throw std::runtime_error("HTTP error: " + std::to_string(http_code));
-    }
-    GroupDataState state;
-    state.groups = decode_bin(received_data);
-    thread_state_ptr->state = state;
-
-    StateImages images;
-    HandleImages(thread_state_ptr->state, images);
-    std::cout << "Decoded all images\n";
-    thread_state_ptr->images = images;
-
-    // this will simply check if we should render the button to the beta page, all content of the beta page is remote
-    HWID hwid;
-    auto hwid_string = hwid.GetHWID();
-    thread_state_ptr->beta_auth = CheckAuthorization(hwid_string);
+    return http_code;
   }
 
-
-  inline ImVec4 hexToImVec4(const std::string &hexColor) {
-    const std::string hex = (hexColor[0] == '#') ? hexColor.substr(1) : hexColor;
-
-    if (hex.length() != 6 && hex.length() != 8) {
-      throw std::invalid_argument("Invalid hex color format");
+  /**
+   * Download the catalog and publish it as a new snapshot if it differs from the current one. Images, and the pages
+   * showing them, are only touched for groups that actually changed.
+   * @param thread_state_ptr MainState to publish to
+   * @return true if a new snapshot was published
+   */
+  inline bool refresh_groups(const std::shared_ptr<MainState> &thread_state_ptr) {
+    const auto previous = thread_state_ptr->Load();
+    const auto known = thread_state_ptr->GetSource();
+    std::vector<uint8_t> received_data;
+    std::string etag;
+    std::string source;
+
+    for (const char *url: CATALOG_SOURCES) {
+      received_data.clear();
+      // an ETag is only meaningful to the file it came from, and only while the catalog it names is published
+      etag = previous && known.url == url ? known.etag : std::string();
+      const long http_code = FetchCatalogFile(url, received_data, etag);
+      if (http_code == 304) {
+        return false;
+      }
+      if (http_code == 404) {
+        continue;
+      }
+      if (http_code != 200) {
+        throw std::runtime_error("HTTP error: " + std::to_string(http_code));
+      }
+      source = url;
+      break;
+    }
+    if (source.empty()) {
+      throw std::runtime_error("No catalog found on the server");
     }
 
-    float alpha = 1.0f;
+    std::cout << "Fetched data" << received_data.size() << " bytes" << std::endl;
 
-    unsigned int colorValue;
-    std::stringstream ss;
-    ss << std::hex << hex;
-    ss >> colorValue;
+    // everything is built off to the side and published in one go, the render thread keeps drawing the previous
+    // snapshot (or the loading screen) until then
+    CatalogSnapshot snapshot;
+    snapshot.catalog = Catalog::Decode(received_data);
+    snapshot.index = CatalogIndex::Build(snapshot.catalog);
+
+    if (previous && previous->index) {
+      const auto old_groups = previous->index->GetGroups();
+      const auto new_groups = snapshot.index->GetGroups();
+      const bool unchanged = std::ranges::equal(new_groups, old_groups, [&](const auto &a, const auto &b) {
+        return a.revision == b.revision &&
+            std::string_view(snapshot.index->GetName(a.key)) == previous->index->GetName(b.key);
+      });
+      if (unchanged) {
+        // the file was rewritten without changing anything shown, its new ETag still saves the next download
+        thread_state_ptr->SetSource({std::move(source), std::move(etag)});
+        return false;
+      }
+      for (const auto &group: new_groups) {
+        const auto old_id = previous->index->FindGroup(snapshot.index->GetName(group.key));
+        if (old_id == CatalogIndex::INVALID_GROUP || previous->index->GetGroup(old_id).revision != group.revision) {
+          std::cout << "Group " << snapshot.index->GetName(group.key) << " changed" << std::endl;
+        }
+      }
+    }
 
-    float r, g, b;
+    snapshot.images = HandleImages(*snapshot.index, previous.get());
+    thread_state_ptr->Publish(std::move(snapshot));
+    thread_state_ptr->SetSource({std::move(source), std::move(etag)});
+    return true;
+  }
 
-    if (hex.length() == 6) {
-      r = ((colorValue >> 16) & 0xFF) / 255.0f;
-      g = ((colorValue >> 8) & 0xFF) / 255.0f;
-      b = (colorValue & 0xFF) / 255.0f;
-    } else {
-      r = ((colorValue >> 24) & 0xFF) / 255.0f;
-      g = ((colorValue >> 16) & 0xFF) / 255.0f;
-      b = ((colorValue >> 8) & 0xFF) / 255.0f;
-      alpha = (colorValue & 0xFF) / 255.0f;
+  inline void fetch_and_decode_groups(const std::shared_ptr<MainState> &thread_state_ptr) {
+    // a catalog that fails to download must not also hide the beta page, its error is only raised after the check
+    std::exception_ptr catalog_error;
+    try {
+      refresh_groups(thread_state_ptr);
+    } catch (...) {
+      catalog_error = std::current_exception();
     }
-    return {r, g, b, alpha};
+
+    // this will simply check if we should render the button to the beta page, all content of the beta page is remote
+    thread_state_ptr->beta_auth = CheckAuthorization(HWID::GetShared().get());
+    if (catalog_error) std::rethrow_exception(catalog_error);
   }
+
 }  // namespace Infinity
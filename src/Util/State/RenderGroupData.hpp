@@ -1,62 +1,57 @@
-
 #pragma once
 
-#include <map>
 #include <optional>
-#include <sstream>
-#include <string>
-#include <vector>
+#include <string_view>
 
-#include "GroupStateManager.hpp"
+#include "Catalog.hpp"
 #include "imgui.h"
 
 namespace Infinity {
 
 
+  // Catalog strings are views into its buffer, so they are printed with an explicit length
+  inline void RenderField(const char *fieldName, const std::string_view fieldValue) {
+    ImGui::Text("%s: %.*s", fieldName, static_cast<int>(fieldValue.size()), fieldValue.data());
+  }
+
   // Helper function to render std::optional fields
-  template<typename T>
-  void RenderOptionalField(const std::string &fieldName, const std::optional<T> &fieldValue) {
+  inline void RenderOptionalField(const char *fieldName, const std::optional<std::string_view> &fieldValue) {
     if (fieldValue) {
-      ImGui::Text("%s: %s", fieldName.c_str(), fieldValue->c_str());
+      RenderField(fieldName, *fieldValue);
     } else {
-      ImGui::Text("%s: None", fieldName.c_str());
+      ImGui::Text("%s: None", fieldName);
     }
   }
 
-  // Render the `Package` structure
-  void RenderPackage(const Package &package) {
+  // Render the `CatalogPackage` structure
+  inline void RenderPackage(const CatalogPackage &package) {
     ImGui::Text("Package:");
     ImGui::Indent();
-    ImGui::Text("Owner: %s", package.owner.c_str());
-    ImGui::Text("Repo Name: %s", package.repoName.c_str());
-    ImGui::Text("Version: %s", package.version.c_str());
-    ImGui::Text("File Name: %s", package.fileName.c_str());
+    RenderField("Owner", package.owner);
+    RenderField("Repo Name", package.repoName);
+    RenderField("Version", package.version);
+    RenderField("File Name", package.fileName);
     ImGui::Unindent();
   }
 
-  // Render the `Project` structure
-  void RenderProject(const Project &project) {
+  // Render the `CatalogProject` structure
+  inline void RenderProject(const CatalogProject &project) {
     ImGui::Text("Project:");
     ImGui::Indent();
-    ImGui::Text("Name: %s", project.name.c_str());
-    ImGui::Text("Version: %s", project.version.c_str());
-    ImGui::Text("Date: %s", project.date.c_str());
-    ImGui::Text("Changelog: %s", project.changelog.c_str());
-    ImGui::Text("Overview: %s", project.overview.c_str());
-    ImGui::Text("Description: %s", project.description.c_str());
-    ImGui::Text("Background: %s", project.background.c_str());
-
-    if (project.pageBackground) {
-      ImGui::Text("Page Background: %s", project.pageBackground->c_str());
-    } else {
-      ImGui::Text("Page Background: None");
-    }
-
-    if (project.variants) {
+    RenderField("Name", project.name);
+    RenderField("Version", project.version);
+    RenderField("Date", project.date);
+    RenderField("Changelog", project.changelog);
+    RenderField("Overview", project.overview);
+    RenderField("Description", project.description);
+    RenderField("Background", project.background);
+    RenderOptionalField("Page Background", project.pageBackground);
+
+    if (!project.variants.empty()) {
       ImGui::Text("Variants:");
       ImGui::Indent();
-      for (const auto &variant: *project.variants) {
-        ImGui::BulletText("%s", variant.c_str());
+      for (const auto variant: project.variants) {
+        ImGui::BulletText("%.*s", static_cast<int>(variant.size()), variant.data());
       }
       ImGui::Unindent();
     } else {
@@ -72,45 +67,32 @@ namespace Infinity {
     ImGui::Unindent();
   }
 
-  // Render the `Palette` structure
-  void RenderPalette(const Palette &palette) {
+  // Render the `CatalogPalette` structure
+  inline void RenderPalette(const CatalogPalette &palette) {
     ImGui::Text("Palette:");
     ImGui::Indent();
-    ImGui::Text("Primary: %s", palette.primary.c_str());
-    ImGui::Text("Secondary: %s", palette.secondary.c_str());
+    RenderField("Primary", palette.primary);
+    RenderField("Secondary", palette.secondary);
     ImGui::Unindent();
   }
 
-  // Render the `BetaProject` structure
-  void RenderBetaProject(const BetaProject &beta) {
+  // Render the `CatalogBetaProject` structure
+  inline void RenderBetaProject(const CatalogBetaProject &beta) {
     ImGui::Text("Beta Project:");
     ImGui::Indent();
-    ImGui::Text("Background: %s", beta.background.c_str());
+    RenderField("Background", beta.background);
     ImGui::Unindent();
   }
 
-  // Render the `GroupData` structure
-  void RenderGroupData(const GroupData &group) {
+  // Render the `CatalogGroup` structure
+  inline void RenderGroupData(const CatalogGroup &group) {
     ImGui::Text("Group Data:");
     ImGui::Indent();
-    ImGui::Text("Name: %s", group.name.c_str());
-    ImGui::Text("Logo: %s", group.logo.c_str());
-
-    if (group.update) {
-      ImGui::Text("Update: %s", *group.update ? "true" : "false");
-    } else {
-      ImGui::Text("Update: None");
-    }
-
-    ImGui::Text("Path: %s", group.path.c_str());
+    RenderField("Name", group.name);
+    RenderField("Logo", group.logo);
+    RenderField("Path", group.path);
     RenderPalette(group.palette);
-
-    if (group.hide) {
-      ImGui::Text("Hide: %s", *group.hide ? "true" : "false");
-    } else {
-      ImGui::Text("Hide: None");
-    }
-
+    ImGui::Text("Hide: %s", group.hide ? "true" : "false");
     RenderBetaProject(group.beta);
 
     ImGui::Text("Projects:");
@@ -124,13 +106,13 @@ namespace Infinity {
     ImGui::Unindent();
   }
 
-  // Render the `GroupDataState` structure
-  void RenderGroupDataState(const GroupDataState &state) {
-    ImGui::Text("Group Data State:");
+  // Render every group of a `Catalog`
+  inline void RenderCatalog(const Catalog &catalog) {
+    ImGui::Text("Catalog:");
     ImGui::Indent();
-    for (const auto &[groupName, groupData]: state.groups) {
-      ImGui::Text("Group Name: %s", groupName.c_str());
-      RenderGroupData(groupData);
+    for (const auto &group: catalog.GetGroups()) {
+      RenderField("Group Name", group.key);
+      RenderGroupData(group);
       ImGui::Separator();
     }
     ImGui::Unindent();
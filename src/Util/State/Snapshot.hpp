@@ -0,0 +1,43 @@
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <utility>
+
+namespace Infinity {
+  /**
+   * Holds the current version of an immutable value.
+   *
+   * Writers build a complete new value off to the side and Publish() it with a single atomic swap, readers Load() the
+   * current one and keep it alive for as long as they hold the pointer. A reader therefore never sees a half written
+   * value and never waits for one to be built, and a value is freed once the last reader still using it lets go.
+   *
+   * std::atomic<std::shared_ptr> is not lock-free on libstdc++ or MSVC, both guard the pointer with a small internal
+   * lock that is only held while it is copied or swapped. Loading also bumps a reference count, so hot paths should
+   * load once (e.g. per frame) and pass the pointer down.
+   */
+  template<typename T>
+  class SnapshotCell {
+public:
+    SnapshotCell() = default;
+    explicit SnapshotCell(std::shared_ptr<const T> initial)
+        : m_current(std::move(initial)) {}
+
+    SnapshotCell(const SnapshotCell &) = delete;
+    SnapshotCell &operator=(const SnapshotCell &) = delete;
+
+    [[nodiscard]] std::shared_ptr<const T> Load() const { return m_current.load(std::memory_order_acquire); }
+
+    /**
+     * Replace the current value
+     * @param value fully built value, must not be modified after publishing
+     * @return the value that was replaced
+     */
+    std::shared_ptr<const T> Publish(std::shared_ptr<const T> value) {
+      return m_current.exchange(std::move(value), std::memory_order_acq_rel);
+    }
+
+private:
+    std::atomic<std::shared_ptr<const T>> m_current;
+  };
+}  // namespace Infinity
@@ -1,15 +1,19 @@
 
 #pragma once
 
+#include <functional>
 #include <iostream>
 #include <memory>
 #include <mutex>
 #include <optional>
 #include <string>
+#include <string_view>
 #include <typeindex>
 #include <typeinfo>
 #include <unordered_map>
 
+#include "Snapshot.hpp"
+
 namespace Infinity {
   class PageState {
 public:
@@ -18,6 +22,12 @@ public:
     virtual void PrintState() const = 0;
   };
 
+  /**
+   * Registry of page states keyed by type and page id.
+   *
+   * The registry is copy-on-write: registering or removing a state copies the (small) map under a writer lock and
+   * publishes the copy, while lookups read whichever map is current without waiting on the writer lock.
+   */
   class State {
 public:
     static State &GetInstance() {
@@ -27,16 +37,16 @@ public:
 
     template<typename T>
     void RegisterPageState(const std::string &page_id, std::shared_ptr<T> state) {
-      std::scoped_lock lock(m_Mutex);
-      const auto type_id = std::type_index(typeid(T));
-      m_PageStates[type_id][page_id] = state;
+      std::scoped_lock lock(m_WriteMutex);
+      auto registry = std::make_shared<Registry>(*m_Registry.Load());
+      (*registry)[std::type_index(typeid(T))][page_id] = std::move(state);
+      m_Registry.Publish(std::move(registry));
     }
 
     template<typename T>
-    std::optional<std::shared_ptr<T> > GetPageState(const std::string &page_id) {
-      std::scoped_lock lock(m_Mutex);
-      const auto type_id = std::type_index(typeid(T));
-      if (const auto type_it = m_PageStates.find(type_id); type_it != m_PageStates.end()) {
+    std::optional<std::shared_ptr<T> > GetPageState(const std::string_view page_id) const {
+      const auto registry = m_Registry.Load();
+      if (const auto type_it = registry->find(std::type_index(typeid(T))); type_it != registry->end()) {
         if (const auto page_it = type_it->second.find(page_id); page_it != type_it->second.end()) {
           return std::static_pointer_cast<T>(page_it->second);
         }
@@ -46,19 +56,19 @@ public:
 
     template<typename T>
     void RemovePageState(const std::string &page_id) {
-      std::scoped_lock lock(m_Mutex);
-      const auto type_id = std::type_index(typeid(T));
-      if (const auto type_it = m_PageStates.find(type_id); type_it != m_PageStates.end()) {
+      std::scoped_lock lock(m_WriteMutex);
+      auto registry = std::make_shared<Registry>(*m_Registry.Load());
+      if (const auto type_it = registry->find(std::type_index(typeid(T))); type_it != registry->end()) {
         type_it->second.erase(page_id);
         if (type_it->second.empty()) {
-          m_PageStates.erase(type_id);
+          registry->erase(type_it);
         }
       }
+      m_Registry.Publish(std::move(registry));
     }
 
     void PrintAllStates() const {
-      std::scoped_lock lock(m_Mutex);
-      for (const auto &[type_id, pages]: m_PageStates) {
+      for (const auto &[type_id, pages]: *m_Registry.Load()) {
         std::cout << "Type: " << type_id.name() << std::endl;
         for (const auto &[page_id, state]: pages) {
           std::cout << "  Page ID: " << page_id << std::endl;
@@ -70,7 +80,15 @@ public:
 private:
     State() = default;
 
-    std::unordered_map<std::type_index, std::unordered_map<std::string, std::shared_ptr<PageState> > > m_PageStates;
-    mutable std::mutex m_Mutex;
+    struct PageIdHash {
+      using is_transparent = void;
+      size_t operator()(const std::string_view id) const { return std::hash<std::string_view>{}(id); }
+    };
+
+    using PageMap = std::unordered_map<std::string, std::shared_ptr<PageState>, PageIdHash, std::equal_to<> >;
+    using Registry = std::unordered_map<std::type_index, PageMap>;
+
+    SnapshotCell<Registry> m_Registry{std::make_shared<const Registry>()};
+    std::mutex m_WriteMutex;
   };
 }  // namespace Infinity
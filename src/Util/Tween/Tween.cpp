@@ -0,0 +1,130 @@
+#include "Tween.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace Infinity {
+  Tweens &Tweens::GetInstance() {
+    static Tweens instance;
+    return instance;
+  }
+
+  Tweens::Handle Tweens::Create(const float value) {
+    Handle handle;
+    if (!m_free.empty()) {
+      handle = m_free.back();
+      m_free.pop_back();
+    } else {
+      handle = static_cast<Handle>(m_value.size());
+      m_value.push_back(0.0f);
+      m_from.push_back(0.0f);
+      m_to.push_back(0.0f);
+      m_elapsed.push_back(0.0f);
+      m_duration.push_back(0.0f);
+      m_easing.push_back(Easing::EasingTypes::Liner);
+      m_loop.push_back(0);
+      m_keep_awake.push_back(0);
+      m_read.push_back(0);
+    }
+    Set(handle, value);
+    return handle;
+  }
+
+  void Tweens::Release(const Handle handle) {
+    if (handle >= m_value.size()) return;
+    // parked as a finished tween, the update passes do not have to skip anything
+    Set(handle, 0.0f);
+    m_free.push_back(handle);
+  }
+
+  void Tweens::Set(const Handle handle, const float value) {
+    if (handle >= m_value.size()) return;
+    Start(handle, value, value, 1.0f, Easing::EasingTypes::Liner, false, false);
+    m_elapsed[handle] = m_duration[handle];
+  }
+
+  void Tweens::Animate(const Handle handle, const float target, const float duration,
+                       const Easing::EasingTypes easing) {
+    if (handle >= m_value.size()) return;
+    if (duration <= 0.0f) {
+      Set(handle, target);
+      return;
+    }
+    Start(handle, m_value[handle], target, duration, easing, false, true);
+  }
+
+  void Tweens::Approach(const Handle handle, const float target, const float rate) {
+    if (handle >= m_value.size()) return;
+    // already heading there or arrived, restarting would only throw away the progress
+    if (!m_loop[handle] && m_to[handle] == target) return;
+    const float distance = std::abs(target - m_value[handle]);
+    if (rate <= 0.0f || distance == 0.0f) {
+      Set(handle, target);
+      return;
+    }
+    Start(handle, m_value[handle], target, distance / rate, Easing::EasingTypes::Liner, false, true);
+  }
+
+  void Tweens::Loop(const Handle handle, const float from, const float to, const float rate, const bool keep_awake) {
+    if (handle >= m_value.size()) return;
+    const float range = to - from;
+    if (rate <= 0.0f || range == 0.0f) {
+      Set(handle, from);
+      return;
+    }
+    // pick up from the current value if it lies in the range, so starting a loop does not make it jump
+    const float value = m_value[handle];
+    const float duration = std::abs(range) / rate;
+    Start(handle, from, to, duration, Easing::EasingTypes::Liner, true, keep_awake);
+    const float t = std::clamp((value - from) / range, 0.0f, 1.0f);
+    m_elapsed[handle] = t < 1.0f ? t * duration : 0.0f;
+    m_value[handle] = from + range * (m_elapsed[handle] / duration);
+  }
+
+  float Tweens::Get(const Handle handle) {
+    if (handle >= m_value.size()) return 0.0f;
+    m_read[handle] = 1;
+    return m_value[handle];
+  }
+
+  void Tweens::Update(const float dt) {
+    const size_t count = m_value.size();
+
+    // the clock first: loops wrap around, everything else stops at its duration. No branches, so the compiler can
+    // vectorize it
+    for (size_t i = 0; i < count; ++i) {
+      const float elapsed = m_elapsed[i] + dt;
+      const float wrapped = elapsed - m_duration[i] * std::floor(elapsed / m_duration[i]);
+      m_elapsed[i] = m_loop[i] ? wrapped : std::min(elapsed, m_duration[i]);
+    }
+
+    for (size_t i = 0; i < count; ++i) {
+      const float t = m_elapsed[i] / m_duration[i];
+      const float eased = m_easing[i] == Easing::EasingTypes::Liner ? t : Easing::GetEasing(m_easing[i], t);
+      m_value[i] = m_from[i] + (m_to[i] - m_from[i]) * eased;
+    }
+
+    std::ranges::fill(m_read, 0);
+    m_frame_requested = false;
+  }
+
+  bool Tweens::IsAnimating() const {
+    if (m_frame_requested) return true;
+    for (size_t i = 0; i < m_value.size(); ++i) {
+      if (m_loop[i] ? m_keep_awake[i] && m_read[i] : m_elapsed[i] < m_duration[i]) return true;
+    }
+    return false;
+  }
+
+  void Tweens::Start(const Handle handle, const float from, const float to, const float duration,
+                     const Easing::EasingTypes easing, const bool loop, const bool keep_awake) {
+    m_value[handle] = from;
+    m_from[handle] = from;
+    m_to[handle] = to;
+    m_elapsed[handle] = 0.0f;
+    m_duration[handle] = duration;
+    m_easing[handle] = easing;
+    m_loop[handle] = loop;
+    m_keep_awake[handle] = keep_awake;
+  }
+}  // namespace Infinity
@@ -0,0 +1,82 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "Util/Easing/Easing.hpp"
+
+namespace Infinity {
+  /**
+   * Every animated value in the launcher, kept in parallel arrays and advanced together once per frame by the real
+   * frame time, so animations run at the same speed whatever the frame rate is.
+   *
+   * A tween either eases from its current value to a target over a duration, or loops over a range forever. Tweens
+   * are addressed by handle, which stays valid until Release. Application::Run asks IsAnimating whether the next frame
+   * can wait for input instead of being drawn right away.
+   *
+   * Render thread only.
+   */
+  class Tweens {
+public:
+    using Handle = uint32_t;
+
+    static Tweens &GetInstance();
+
+    Tweens(const Tweens &) = delete;
+    Tweens &operator=(const Tweens &) = delete;
+
+    Handle Create(float value);
+    void Release(Handle handle);
+
+    // stop wherever it is and jump to value
+    void Set(Handle handle, float value);
+
+    // ease from the current value to target over duration seconds
+    void Animate(Handle handle, float target, float duration,
+                 Easing::EasingTypes easing = Easing::EasingTypes::Liner);
+
+    // move toward target at rate units per second, nothing changes if it is already on its way there
+    void Approach(Handle handle, float target, float rate);
+
+    /**
+     * Run from one value to another at rate units per second, starting over at from every time it reaches to
+     * @param keep_awake whether the loop needs full frame rate, ambient motion may drop to the idle rate
+     */
+    void Loop(Handle handle, float from, float to, float rate, bool keep_awake);
+
+    [[nodiscard]] float Get(Handle handle);
+
+    // advance every tween by dt seconds, call once per frame before anything reads them
+    void Update(float dt);
+
+    // for effects that move every frame without being a tween, keeps the next frame coming like a running tween would
+    void RequestFrame() { m_frame_requested = true; }
+
+    /**
+     * Whether something is moving that needs the next frame soon: a tween that has not reached its target yet, a loop
+     * that keeps the app awake and was read since the last Update, or a RequestFrame since then
+     */
+    [[nodiscard]] bool IsAnimating() const;
+
+private:
+    Tweens() = default;
+
+    // restart from the beginning, a tween that is done rests at to with elapsed equal to duration
+    void Start(Handle handle, float from, float to, float duration, Easing::EasingTypes easing, bool loop,
+               bool keep_awake);
+
+private:
+    std::vector<float> m_value;
+    std::vector<float> m_from;
+    std::vector<float> m_to;
+    std::vector<float> m_elapsed;
+    std::vector<float> m_duration;
+    std::vector<Easing::EasingTypes> m_easing;
+    std::vector<uint8_t> m_loop;
+    std::vector<uint8_t> m_keep_awake;
+    std::vector<uint8_t> m_read;  // read since the last Update
+
+    std::vector<Handle> m_free;
+    bool m_frame_requested = false;
+  };
+}  // namespace Infinity
@@ -0,0 +1,36 @@
+#include "WorkerPool.hpp"
+
+namespace Infinity {
+  WorkerPool::WorkerPool(const size_t workers) {
+    m_workers.reserve(workers);
+    for (size_t i = 0; i < workers; ++i) {
+      m_workers.emplace_back([this](const std::stop_token &stop) { WorkerLoop(stop); });
+    }
+  }
+
+  WorkerPool &WorkerPool::GetShared() {
+    static WorkerPool instance(SHARED_WORKERS);
+    return instance;
+  }
+
+  void WorkerPool::Push(Task task) {
+    {
+      std::lock_guard lock(m_mutex);
+      m_queue.push_back(std::move(task));
+    }
+    m_cv.notify_one();
+  }
+
+  void WorkerPool::WorkerLoop(const std::stop_token &stop) {
+    while (true) {
+      Task task;
+      {
+        std::unique_lock lock(m_mutex);
+        if (!m_cv.wait(lock, stop, [this] { return !m_queue.empty(); })) return;
+        task = std::move(m_queue.front());
+        m_queue.pop_front();
+      }
+      task();
+    }
+  }
+}  // namespace Infinity
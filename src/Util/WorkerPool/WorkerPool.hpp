@@ -0,0 +1,44 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <stop_token>
+#include <thread>
+#include <vector>
+
+namespace Infinity {
+  /**
+   * A fixed number of threads running queued tasks in the order they were pushed.
+   *
+   * The shared instance does the launcher's small background fetches and decodes (catalog images, evicted texture
+   * reloads, project detail blobs), so a page full of cards queues its loads instead of starting a thread for each.
+   * Workers are stopped and joined when the pool is destroyed, tasks still queued at that point are dropped.
+   */
+  class WorkerPool {
+public:
+    using Task = std::function<void()>;
+
+    explicit WorkerPool(size_t workers);
+
+    WorkerPool(const WorkerPool &) = delete;
+    WorkerPool &operator=(const WorkerPool &) = delete;
+
+    static WorkerPool &GetShared();
+
+    void Push(Task task);
+
+    static constexpr size_t SHARED_WORKERS = 4;
+
+private:
+    void WorkerLoop(const std::stop_token &stop);
+
+private:
+    std::deque<Task> m_queue;
+    std::mutex m_mutex;
+    std::condition_variable_any m_cv;
+    std::vector<std::jthread> m_workers;  // last, so they are stopped before the queue is destroyed
+  };
+}  // namespace Infinity
@@ -1,20 +1,26 @@
 #include <Backend/Updater/Updater.hpp>
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <condition_variable>
 #include <filesystem>
+#include <future>
 #include <iostream>
+#include <mutex>
+#include <thread>
 
 #include "GL/glew.h"
 //
 
-#include "Assets/Images/backArrow.h"
-#include "Assets/Images/backIcon.h"
-#include "Assets/Images/downloadIcon.h"
-#include "Assets/Images/settingsIcon.h"
-#include "Assets/Images/test-tube.h"
+#include "Assets/Icons.h"
 #include "Backend/Application/Application.hpp"
+#include "Backend/CurlShare/CurlShare.hpp"
 #include "Backend/Downloads/Downloads.hpp"
 #include "Backend/HWID/Hwid.hpp"
+#include "Backend/Image/LazyImage.hpp"
 #include "Backend/Image/SvgImage.hpp"
 #include "Backend/Layer/Layer.hpp"
+#include "Backend/ProjectDetails/ProjectDetails.hpp"
 #include "Backend/Router/Router.hpp"
 #include "Backend/UIHelpers/UiHelpers.hpp"
 #include "Frontend/Background/Background.hpp"
@@ -29,6 +35,7 @@
 #include "Util/State/GroupStateManager.hpp"
 #include "Util/State/RenderGroupData.hpp"
 #include "Util/State/State.hpp"
+#include "Util/Tween/Tween.hpp"
 #include "imgui_internal.h"
 
 
@@ -38,14 +45,95 @@ bool g_ApplicationRunning = true;
 
 static int downloadID = -1;
 static bool pages_registered = false;
-static std::vector<unsigned int> active_index = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13};
+static uint64_t home_version = 0;  // catalog snapshot the home page cards were built from
+static constexpr auto CATALOG_REFRESH_INTERVAL = std::chrono::minutes(5);
+// until a first catalog is published the loading screen is up, so it is retried sooner, doubling up to the interval
+static constexpr auto CATALOG_FIRST_RETRY_DELAY = std::chrono::seconds(2);
+static std::vector<unsigned int> active_index(13);  // highlighted segments of the loading logo
+static constexpr unsigned int LOGO_SEGMENTS = 242;
+static constexpr float LOGO_SEGMENTS_PER_SECOND = 144.0f;  // a segment per frame at the default fps cap
 static std::shared_ptr<Infinity::Image> settingsIcon = nullptr;
 static std::shared_ptr<Infinity::Image> backIcon = nullptr;
 static std::shared_ptr<Infinity::Image> downloadsIcon = nullptr;
 static std::shared_ptr<Infinity::Image> betaIcon = nullptr;
 
+struct GroupRoute {
+  int page_id;
+  std::string_view key;
+  const char *title;
+  Infinity::PackedPalette palette;
+};
+
+static constexpr Infinity::PackedPalette default_palette =
+    Infinity::PackPalette("#1271FF1C", "#DD4AFF1C", "#1271FF02", "#DD4AFF02", "#64DCFF02", "#C8323202", "#B4B43202");
+
+static constexpr std::array<GroupRoute, 5> group_routes = {{
+    {4, "aero_dynamics", "Aero Dynamics",
+     Infinity::PackPalette("#050912", "#050505", "#1271FF02", "#DD4AFF02", "#64DCFF02", "#C8323202", "#B4B43202")},
+    {5, "delta_sim", "Delta Sim",
+     Infinity::PackPalette("#4f1a00", "#efaa00", "#1271FF02", "#DD4AFF02", "#64DCFF02", "#C8323202", "#B4B43202")},
+    {6, "lunar_sim", "Lunar Sim",
+     Infinity::PackPalette("#080F19", "#384B5F", "#1271FF02", "#DD4AFF02", "#64DCFF02", "#C8323202", "#B4B43202")},
+    {7, "ouroboros", "Ouroboros Jets",
+     Infinity::PackPalette("#210e3a", "#2a2fff", "#1271FF02", "#DD4AFF02", "#64DCFF02", "#C8323202", "#B4B43202")},
+    {8, "qbitsim", "QBit Sim",
+     Infinity::PackPalette("#210e3a", "#2a2fff", "#1271FF02", "#DD4AFF02", "#64DCFF02", "#C8323202", "#B4B43202")},
+}};
+
+static std::vector<Infinity::HomeProjectButtonStruct> BuildHomeProjects(const Infinity::CatalogSnapshot &snapshot) {
+  const auto &index = *snapshot.index;
+  std::vector<Infinity::HomeProjectButtonStruct> projects;
+  for (const auto &route: group_routes) {
+    const auto group = index.FindGroup(route.key);
+    if (group == Infinity::CatalogIndex::INVALID_GROUP || index.GetGroup(group).projectCount == 0) {
+      std::cerr << "Group " << route.key << " is missing from the catalog" << std::endl;
+      continue;
+    }
+    std::vector<std::string> details;
+    std::vector<std::shared_ptr<Infinity::LazyImage>> backgrounds;
+    for (const auto &project: index.GetProjects(group)) {
+      if (!project.record->detail.empty()) details.emplace_back(project.record->detail);
+      backgrounds.push_back(snapshot.images->projectBackgrounds[index.GetGroup(group).firstProject + project.slot]);
+    }
+    auto card_image = backgrounds.front();
+    // hovering a card warms up the page behind it, which opens on its first project
+    auto prefetch = [details = std::move(details), backgrounds = std::move(backgrounds)] {
+      for (const auto &detail: details) Infinity::ProjectDetails::GetInstance().Prefetch(detail);
+      const size_t lookahead = Infinity::LazyImage::GetPrefetchLookahead();
+      for (size_t i = 0; i < std::min(backgrounds.size(), lookahead + 1); ++i) {
+        if (backgrounds[i]) backgrounds[i]->Request();
+      }
+    };
+    projects.emplace_back(route.title, std::move(card_image), snapshot.images->groupLogos[group], route.page_id,
+                          std::move(prefetch));
+  }
+  return projects;
+}
+
+// the home page is all that shows after the loading screen, so only its logos and card backgrounds are waited for
+static void LoadHomeImages(const Infinity::CatalogSnapshot &snapshot) {
+  std::vector<std::shared_ptr<Infinity::LazyImage>> visible;
+  for (const auto &route: group_routes) {
+    const auto group = snapshot.index->FindGroup(route.key);
+    if (group == Infinity::CatalogIndex::INVALID_GROUP || snapshot.index->GetGroup(group).projectCount == 0) continue;
+    visible.push_back(snapshot.images->groupLogos[group]);
+    visible.push_back(snapshot.images->projectBackgrounds[snapshot.index->GetGroup(group).firstProject]);
+  }
+  for (const auto &image: visible) {
+    if (image) image->Request();
+  }
+  for (const auto &image: visible) {
+    if (image) image->Wait();
+  }
+}
+
 class PageRenderLayer final : public Infinity::Layer {
   public:
+  // the first catalog is already being fetched by Main, `first_catalog` is ready once it and the home page images are
+  PageRenderLayer(std::shared_ptr<Infinity::MainState> main_state, std::future<void> first_catalog)
+      : m_main_state(std::move(main_state))
+      , m_first_catalog(std::move(first_catalog)) {}
+
   void OnAttach() override {
     auto &interpolator = ColorInterpolation::GetInstance();
     interpolator.ChangeGradientColors(
@@ -56,38 +144,49 @@ class PageRenderLayer final : public Infinity::Layer {
 
     auto &state = Infinity::State::GetInstance();
 
-    Infinity::GroupDataState group_state;
-    state.RegisterPageState("main", std::make_shared<Infinity::MainState>(group_state));
-
-    std::thread([] {
-      settingsIcon = Infinity::Image::LoadFromMemory(g_SettingIcon, sizeof(g_SettingIcon));
-      backIcon = Infinity::Image::LoadFromMemory(g_BackIcon, sizeof(g_BackIcon));
-      downloadsIcon = Infinity::Image::LoadFromMemory(g_DownloadIcon, sizeof(g_DownloadIcon));
-      betaIcon = Infinity::Image::LoadFromMemory(g_TestTubeIcon, sizeof(g_TestTubeIcon));
-
-
-      auto thread_state = Infinity::State::GetInstance().GetPageState<Infinity::MainState>("main");
-      std::shared_ptr<Infinity::MainState> &thread_state_ptr = *thread_state;
-
-      fetch_and_decode_groups(thread_state_ptr);
-
-      Infinity::Home::GetInstance()->RegisterProject(
-          "Aero Dynamics", thread_state_ptr->images.groupImages.at("aero_dynamics").projectImages[0].backgroundImage,
-          thread_state_ptr->images.groupImages.at("aero_dynamics").logo, 3);
-      Infinity::Home::GetInstance()->RegisterProject(
-          "Delta Sim", thread_state_ptr->images.groupImages.at("delta_sim").projectImages[0].backgroundImage,
-          thread_state_ptr->images.groupImages.at("delta_sim").logo, 4);
-      Infinity::Home::GetInstance()->RegisterProject(
-          "Lunar Sim", thread_state_ptr->images.groupImages.at("lunar_sim").projectImages[0].backgroundImage,
-          thread_state_ptr->images.groupImages.at("lunar_sim").logo, 5);
-      Infinity::Home::GetInstance()->RegisterProject(
-          "Ouroboros Jets", thread_state_ptr->images.groupImages.at("ouroboros").projectImages[0].backgroundImage,
-          thread_state_ptr->images.groupImages.at("ouroboros").logo, 6);
-      Infinity::Home::GetInstance()->RegisterProject(
-          "QBit Sim", thread_state_ptr->images.groupImages.at("qbitsim").projectImages[0].backgroundImage,
-          thread_state_ptr->images.groupImages.at("qbitsim").logo, 7);
-      Infinity::Home::SetLoaded(true);
-    }).detach();
+    state.RegisterPageState("main", m_main_state);
+
+    m_catalog_thread = std::jthread([thread_state_ptr = m_main_state, first_catalog = std::move(m_first_catalog)](
+                                        const std::stop_token &stop) mutable {
+      settingsIcon = Infinity::Image::LoadFromPack(Infinity::Icons::SETTINGS_ICON);
+      backIcon = Infinity::Image::LoadFromPack(Infinity::Icons::BACK_ICON);
+      downloadsIcon = Infinity::Image::LoadFromPack(Infinity::Icons::DOWNLOAD_ICON);
+      betaIcon = Infinity::Image::LoadFromPack(Infinity::Icons::TEST_TUBE_ICON);
+
+
+      try {
+        first_catalog.get();
+        Infinity::Home::SetLoaded(true);
+      } catch (const std::exception &e) {
+        std::cerr << "Failed to fetch groups: " << e.what() << std::endl;
+      }
+
+      // keep the catalog fresh while the launcher is open, unchanged groups keep their pages and textures
+      std::mutex mutex;
+      std::condition_variable_any wake;
+      std::chrono::milliseconds retry_delay = CATALOG_FIRST_RETRY_DELAY;
+      while (!stop.stop_requested()) {
+        std::chrono::milliseconds delay = CATALOG_REFRESH_INTERVAL;
+        if (!thread_state_ptr->Load()) {
+          delay = retry_delay;
+          retry_delay = std::min<std::chrono::milliseconds>(retry_delay * 2, CATALOG_REFRESH_INTERVAL);
+        }
+        {
+          std::unique_lock lock(mutex);
+          wake.wait_for(lock, stop, delay, [] { return false; });
+        }
+        if (stop.stop_requested()) break;
+        try {
+          // after a failed first fetch the loading screen stays up until a refresh gets through
+          if (Infinity::refresh_groups(thread_state_ptr) && !Infinity::Home::DoneLoading()) {
+            LoadHomeImages(*thread_state_ptr->Load());
+            Infinity::Home::SetLoaded(true);
+          }
+        } catch (const std::exception &e) {
+          std::cerr << "Failed to refresh groups: " << e.what() << std::endl;
+        }
+      }
+    });
   }
 
   void OnUIRender() override {
@@ -100,12 +199,16 @@ class PageRenderLayer final : public Infinity::Layer {
 
 
     auto loading_screen = [] {
-      {
-        for (auto &index: active_index) {
-          if (++index > 241) {
-            index = 0;
-          }
-        }
+      // the highlight runs around the logo forever, only keeping the app awake while the loading screen reads it
+      static const Infinity::Tweens::Handle head = [] {
+        auto &tweens = Infinity::Tweens::GetInstance();
+        const auto handle = tweens.Create(0.0f);
+        tweens.Loop(handle, 0.0f, static_cast<float>(LOGO_SEGMENTS), LOGO_SEGMENTS_PER_SECOND, true);
+        return handle;
+      }();
+      const auto first = static_cast<unsigned int>(Infinity::Tweens::GetInstance().Get(head));
+      for (unsigned int i = 0; i < active_index.size(); ++i) {
+        active_index[i] = (first + i) % LOGO_SEGMENTS;
       }
       DrawInfinityLogoAnimated(0.8f, {ImGui::GetWindowWidth() / 2, ImGui::GetWindowHeight() / 2 - 200.0f},
                                active_index);
@@ -115,9 +218,12 @@ class PageRenderLayer final : public Infinity::Layer {
 
     auto &state = Infinity::State::GetInstance();
 
-    if (const auto main_state = state.GetPageState<Infinity::MainState>("main");
-        main_state.has_value() && !Infinity::Home::DoneLoading()) {
-      if (const std::shared_ptr<Infinity::MainState> &statePtr = *main_state; statePtr->state.groups.empty()) {
+    const auto main_state = state.GetPageState<Infinity::MainState>("main");
+    // pinned once, everything drawn this frame reads the same catalog even if a new one is published meanwhile
+    const Infinity::CatalogSnapshot *frame = main_state.has_value() ? (*main_state)->PinFrame() : nullptr;
+
+    if (main_state.has_value() && !Infinity::Home::DoneLoading()) {
+      if (!frame) {
         bg->RenderBackground();
         loading_screen();
         return;
@@ -126,22 +232,20 @@ class PageRenderLayer final : public Infinity::Layer {
       const std::shared_ptr<Infinity::MainState> &statePtr = *main_state;
       if (!pages_registered) {
         // Pages 0, 1, 2 and 3 are reserved for home, settings, downloads and betas
-        const std::unordered_map<int, std::pair<std::function<void()>, Infinity::Palette>> routes = {
-            {0,
-             {[] { Infinity::Home::GetInstance()->Render(); },
-              {"#1271FF1C", "#DD4AFF1C", "#1271FF02", "#DD4AFF02", "#64DCFF02", "#C8323202", "#B4B43202"}}},
+        std::unordered_map<int, std::pair<std::function<void()>, Infinity::PackedPalette>> routes = {
+            {0, {[] { Infinity::Home::GetInstance()->Render(); }, default_palette}},
             {1,
              {[] {
                 Infinity::Settings settings;
                 settings.Render();
               },
-              {"#1271FF1C", "#DD4AFF1C", "#1271FF02", "#DD4AFF02", "#64DCFF02", "#C8323202", "#B4B43202"}}},
+              default_palette}},
             {2,
              {[] {
                 Downloads downloads;
                 downloads.Render();
               },
-              {"#1271FF1C", "#DD4AFF1C", "#1271FF02", "#DD4AFF02", "#64DCFF02", "#C8323202", "#B4B43202"}}},
+              default_palette}},
             {3,
              {[] {
                 Infinity::Betas betas;
@@ -149,54 +253,24 @@ class PageRenderLayer final : public Infinity::Layer {
 
                 ImGui::Text("Beta");
               },
-              {"#1271FF1C", "#DD4AFF1C", "#1271FF02", "#DD4AFF02", "#64DCFF02", "#C8323202", "#B4B43202"}}},
-            {4,
-             {[statePtr] {
-                Infinity::ProjectPage project_page(
-                    std::make_shared<Infinity::GroupData>(statePtr->state.groups["aero_dynamics"]),
-                    std::make_shared<Infinity::GroupDataImages>(statePtr->images.groupImages["aero_dynamics"]));
-                project_page.Render();
-              },
-              {"#050912", "#050505", "#1271FF02", "#DD4AFF02", "#64DCFF02", "#C8323202", "#B4B43202"}}},
-            {5,
-             {[statePtr] {
-                Infinity::ProjectPage project_page(
-                    std::make_shared<Infinity::GroupData>(statePtr->state.groups["delta_sim"]),
-                    std::make_shared<Infinity::GroupDataImages>(statePtr->images.groupImages["delta_sim"]));
-                project_page.Render();
-              },
-              {"#4f1a00", "#efaa00", "#1271FF02", "#DD4AFF02", "#64DCFF02", "#C8323202", "#B4B43202"}}},
-            {6,
-             {[statePtr] {
-                Infinity::ProjectPage project_page(
-                    std::make_shared<Infinity::GroupData>(statePtr->state.groups.at("lunar_sim")),
-                    std::make_shared<Infinity::GroupDataImages>(statePtr->images.groupImages.at("lunar_sim")));
-                project_page.Render();
-              },
-              {"#080F19", "#384B5F", "#1271FF02", "#DD4AFF02", "#64DCFF02", "#C8323202", "#B4B43202"}}},
-            {7,
-             {[statePtr] {
-                Infinity::ProjectPage project_page(
-                    std::make_shared<Infinity::GroupData>(statePtr->state.groups["ouroboros"]),
-                    std::make_shared<Infinity::GroupDataImages>(statePtr->images.groupImages["ouroboros"]));
-                project_page.Render();
-              },
-              {"#210e3a", "#2a2fff", "#1271FF02", "#DD4AFF02", "#64DCFF02", "#C8323202", "#B4B43202"}}},
-            {8,
-             {[statePtr] {
-                Infinity::ProjectPage project_page(
-                    std::make_shared<Infinity::GroupData>(statePtr->state.groups["qbitsim"]),
-                    std::make_shared<Infinity::GroupDataImages>(statePtr->images.groupImages["qbitsim"]));
-                project_page.Render();
-              },
-              {"#210e3a", "#2a2fff", "#1271FF02", "#DD4AFF02", "#64DCFF02", "#C8323202", "#B4B43202"}}}
+              default_palette}}};
 
-        };
+        // project pages resolve their group key once per published catalog, then only index into it
+        for (const auto &route: group_routes) {
+          auto project_page = std::make_shared<Infinity::ProjectPage>(statePtr, std::string(route.key));
+          routes.emplace(route.page_id, std::make_pair([project_page] { project_page->Render(); }, route.palette));
+        }
         Infinity::Utils::Router::configure(routes);
         Infinity::Utils::Router::getInstance().value()->setPage(0);
 
         pages_registered = true;
       }
+
+      // cards hold on to their textures, so they are rebuilt whenever a refresh publishes a new catalog
+      if (frame && frame->version != home_version) {
+        Infinity::Home::GetInstance()->RegisterProject(BuildHomeProjects(*frame));
+        home_version = frame->version;
+      }
     }
 
     if (!Infinity::Home::DoneLoading()) {
@@ -240,8 +314,7 @@ class PageRenderLayer final : public Infinity::Layer {
                         Infinity::UI::Colors::Theme::text_darker, Infinity::GetItemRect());
       }
 
-      if (auto main_state = state.GetPageState<Infinity::MainState>("main");
-          main_state.has_value() && (*main_state)->beta_auth) {
+      if (main_state.has_value() && (*main_state)->beta_auth) {
         constexpr int buttonWidth3 = 24;
         constexpr int buttonHeight3 = 24;
         ImGui::SetCursorPos(ImVec2(78.0f, 8.0f));
@@ -265,16 +338,33 @@ class PageRenderLayer final : public Infinity::Layer {
   void OnDetach() override {}
 
   void OnUpdate(float ts) override {}
+
+  private:
+  std::shared_ptr<Infinity::MainState> m_main_state;
+  std::future<void> m_first_catalog;
+  std::jthread m_catalog_thread;
 };
 
 
 namespace Infinity {
   void Main(const int argc, char **argv) {
+    // the network goes first. DNS, the TLS handshake, the catalog, the beta check and the home page images all happen
+    // while the window and GL context are created, the layer then only waits for whatever has not arrived yet
+    CurlShare::GetInstance();
+    HWID::GetShared();
+    auto main_state = std::make_shared<MainState>();
+    auto first_catalog = std::async(std::launch::async, [main_state] {
+      fetch_and_decode_groups(main_state);
+      if (const auto snapshot = main_state->Load()) LoadHomeImages(*snapshot);
+    });
+
     while (g_ApplicationRunning) {
-      const auto app = Application::CreateApplication(argc, argv, std::make_unique<PageRenderLayer>());
+      const auto app = Application::CreateApplication(
+          argc, argv, std::make_unique<PageRenderLayer>(main_state, std::move(first_catalog)));
       app->Run();
       g_ApplicationRunning = false;
     }
+    Downloads::GetInstance().Shutdown();
   }
 }  // namespace Infinity
 